@@ -0,0 +1,237 @@
+﻿#if !TYPESCRIPT
+using System.Diagnostics;
+using System.Numerics;
+using cs2.attributes;
+
+/// <summary>
+/// Times the [NativeBatchKernel] entry points against the same work written as plain scalar loops. Under .NET both
+/// sides run the scalar loops; in the C++ output the attributed methods call the runtime BatchKernels instead.
+/// </summary>
+class BatchKernelBenchmark {
+    const int Count = 16384;
+    const int Iterations = 100;
+
+    public static void Main() {
+        Random random = new Random(1234);
+        float[] positionX = CreateValues(random, -50.0f, 50.0f);
+        float[] positionY = CreateValues(random, -50.0f, 50.0f);
+        float[] positionZ = CreateValues(random, -50.0f, 50.0f);
+        float[] rotationX = new float[Count];
+        float[] rotationY = new float[Count];
+        float[] rotationZ = new float[Count];
+        float[] rotationW = new float[Count];
+        for (int i = 0; i < Count; i++) {
+            Quaternion rotation = Quaternion.CreateFromYawPitchRoll(NextSingle(random, -3.0f, 3.0f), NextSingle(random, -3.0f, 3.0f), NextSingle(random, -3.0f, 3.0f));
+            rotationX[i] = rotation.X;
+            rotationY[i] = rotation.Y;
+            rotationZ[i] = rotation.Z;
+            rotationW[i] = rotation.W;
+        }
+        float[] scaleX = CreateValues(random, 0.5f, 2.0f);
+        float[] scaleY = CreateValues(random, 0.5f, 2.0f);
+        float[] scaleZ = CreateValues(random, 0.5f, 2.0f);
+        float[] radius = CreateValues(random, 0.5f, 4.0f);
+
+        Matrix4x4[] world = new Matrix4x4[Count];
+        float[] transformedX = new float[Count];
+        float[] transformedY = new float[Count];
+        float[] transformedZ = new float[Count];
+        uint[] visibleMask = new uint[(Count + 31) / 32];
+        Plane[] frustum = CreateFrustum();
+        Matrix4x4 view = Matrix4x4.CreateLookAt(new Vector3(0.0f, 10.0f, 60.0f), Vector3.Zero, Vector3.UnitY);
+
+        Stopwatch stopwatch = Stopwatch.StartNew();
+        for (int iteration = 0; iteration < Iterations; iteration++) {
+            ComposeTransformsScalar(positionX, positionY, positionZ, rotationX, rotationY, rotationZ, rotationW, scaleX, scaleY, scaleZ, world);
+        }
+        double scalarMilliseconds = stopwatch.Elapsed.TotalMilliseconds;
+        stopwatch.Restart();
+        for (int iteration = 0; iteration < Iterations; iteration++) {
+            ComposeTransforms(positionX, positionY, positionZ, rotationX, rotationY, rotationZ, rotationW, scaleX, scaleY, scaleZ, world);
+        }
+        Report("ComposeTransforms", scalarMilliseconds, stopwatch.Elapsed.TotalMilliseconds);
+
+        stopwatch.Restart();
+        for (int iteration = 0; iteration < Iterations; iteration++) {
+            TransformPointsScalar(view, positionX, positionY, positionZ, transformedX, transformedY, transformedZ);
+        }
+        scalarMilliseconds = stopwatch.Elapsed.TotalMilliseconds;
+        stopwatch.Restart();
+        for (int iteration = 0; iteration < Iterations; iteration++) {
+            TransformPoints(view, positionX, positionY, positionZ, transformedX, transformedY, transformedZ);
+        }
+        Report("TransformPoints", scalarMilliseconds, stopwatch.Elapsed.TotalMilliseconds);
+
+        int scalarVisible = 0;
+        int kernelVisible = 0;
+        stopwatch.Restart();
+        for (int iteration = 0; iteration < Iterations; iteration++) {
+            scalarVisible = CullSpheresScalar(frustum, positionX, positionY, positionZ, radius, visibleMask);
+        }
+        scalarMilliseconds = stopwatch.Elapsed.TotalMilliseconds;
+        stopwatch.Restart();
+        for (int iteration = 0; iteration < Iterations; iteration++) {
+            kernelVisible = CullSpheres(frustum, positionX, positionY, positionZ, radius, visibleMask);
+        }
+        Report("CullSpheres", scalarMilliseconds, stopwatch.Elapsed.TotalMilliseconds);
+        Console.WriteLine($"  visible: scalar {scalarVisible}, kernel {kernelVisible}");
+
+        stopwatch.Restart();
+        for (int iteration = 0; iteration < Iterations; iteration++) {
+            scalarVisible = CullAabbsScalar(frustum, positionX, positionY, positionZ, scaleX, scaleY, scaleZ, visibleMask);
+        }
+        scalarMilliseconds = stopwatch.Elapsed.TotalMilliseconds;
+        stopwatch.Restart();
+        for (int iteration = 0; iteration < Iterations; iteration++) {
+            kernelVisible = CullAabbs(frustum, positionX, positionY, positionZ, scaleX, scaleY, scaleZ, visibleMask);
+        }
+        Report("CullAabbs", scalarMilliseconds, stopwatch.Elapsed.TotalMilliseconds);
+        Console.WriteLine($"  visible: scalar {scalarVisible}, kernel {kernelVisible}");
+    }
+
+    [NativeBatchKernel]
+    static void ComposeTransforms(
+        ReadOnlySpan<float> positionX, ReadOnlySpan<float> positionY, ReadOnlySpan<float> positionZ,
+        ReadOnlySpan<float> rotationX, ReadOnlySpan<float> rotationY, ReadOnlySpan<float> rotationZ, ReadOnlySpan<float> rotationW,
+        ReadOnlySpan<float> scaleX, ReadOnlySpan<float> scaleY, ReadOnlySpan<float> scaleZ,
+        Span<Matrix4x4> destination) {
+        ComposeTransformsScalar(positionX, positionY, positionZ, rotationX, rotationY, rotationZ, rotationW, scaleX, scaleY, scaleZ, destination);
+    }
+
+    static void ComposeTransformsScalar(
+        ReadOnlySpan<float> positionX, ReadOnlySpan<float> positionY, ReadOnlySpan<float> positionZ,
+        ReadOnlySpan<float> rotationX, ReadOnlySpan<float> rotationY, ReadOnlySpan<float> rotationZ, ReadOnlySpan<float> rotationW,
+        ReadOnlySpan<float> scaleX, ReadOnlySpan<float> scaleY, ReadOnlySpan<float> scaleZ,
+        Span<Matrix4x4> destination) {
+        for (int i = 0; i < positionX.Length; i++) {
+            Quaternion rotation = new Quaternion(rotationX[i], rotationY[i], rotationZ[i], rotationW[i]);
+            destination[i] = Matrix4x4.CreateScale(scaleX[i], scaleY[i], scaleZ[i]) *
+                Matrix4x4.CreateFromQuaternion(rotation) *
+                Matrix4x4.CreateTranslation(positionX[i], positionY[i], positionZ[i]);
+        }
+    }
+
+    [NativeBatchKernel]
+    static void TransformPoints(
+        Matrix4x4 matrix,
+        ReadOnlySpan<float> x, ReadOnlySpan<float> y, ReadOnlySpan<float> z,
+        Span<float> destinationX, Span<float> destinationY, Span<float> destinationZ) {
+        TransformPointsScalar(matrix, x, y, z, destinationX, destinationY, destinationZ);
+    }
+
+    static void TransformPointsScalar(
+        Matrix4x4 matrix,
+        ReadOnlySpan<float> x, ReadOnlySpan<float> y, ReadOnlySpan<float> z,
+        Span<float> destinationX, Span<float> destinationY, Span<float> destinationZ) {
+        for (int i = 0; i < x.Length; i++) {
+            Vector3 point = Vector3.Transform(new Vector3(x[i], y[i], z[i]), matrix);
+            destinationX[i] = point.X;
+            destinationY[i] = point.Y;
+            destinationZ[i] = point.Z;
+        }
+    }
+
+    [NativeBatchKernel]
+    static int CullSpheres(
+        ReadOnlySpan<Plane> planes,
+        ReadOnlySpan<float> centerX, ReadOnlySpan<float> centerY, ReadOnlySpan<float> centerZ,
+        ReadOnlySpan<float> radius,
+        Span<uint> visibleMask) {
+        return CullSpheresScalar(planes, centerX, centerY, centerZ, radius, visibleMask);
+    }
+
+    static int CullSpheresScalar(
+        ReadOnlySpan<Plane> planes,
+        ReadOnlySpan<float> centerX, ReadOnlySpan<float> centerY, ReadOnlySpan<float> centerZ,
+        ReadOnlySpan<float> radius,
+        Span<uint> visibleMask) {
+        int visibleCount = 0;
+        visibleMask.Slice(0, (centerX.Length + 31) / 32).Clear();
+        for (int i = 0; i < centerX.Length; i++) {
+            Vector3 center = new Vector3(centerX[i], centerY[i], centerZ[i]);
+            bool visible = true;
+            for (int planeIndex = 0; planeIndex < planes.Length; planeIndex++) {
+                if (Plane.DotCoordinate(planes[planeIndex], center) < -radius[i]) {
+                    visible = false;
+                    break;
+                }
+            }
+
+            if (visible) {
+                visibleMask[i / 32] |= 1u << (i % 32);
+                visibleCount++;
+            }
+        }
+
+        return visibleCount;
+    }
+
+    [NativeBatchKernel]
+    static int CullAabbs(
+        ReadOnlySpan<Plane> planes,
+        ReadOnlySpan<float> centerX, ReadOnlySpan<float> centerY, ReadOnlySpan<float> centerZ,
+        ReadOnlySpan<float> extentX, ReadOnlySpan<float> extentY, ReadOnlySpan<float> extentZ,
+        Span<uint> visibleMask) {
+        return CullAabbsScalar(planes, centerX, centerY, centerZ, extentX, extentY, extentZ, visibleMask);
+    }
+
+    static int CullAabbsScalar(
+        ReadOnlySpan<Plane> planes,
+        ReadOnlySpan<float> centerX, ReadOnlySpan<float> centerY, ReadOnlySpan<float> centerZ,
+        ReadOnlySpan<float> extentX, ReadOnlySpan<float> extentY, ReadOnlySpan<float> extentZ,
+        Span<uint> visibleMask) {
+        int visibleCount = 0;
+        visibleMask.Slice(0, (centerX.Length + 31) / 32).Clear();
+        for (int i = 0; i < centerX.Length; i++) {
+            Vector3 center = new Vector3(centerX[i], centerY[i], centerZ[i]);
+            bool visible = true;
+            for (int planeIndex = 0; planeIndex < planes.Length; planeIndex++) {
+                Plane plane = planes[planeIndex];
+                float reach = extentX[i] * MathF.Abs(plane.Normal.X) + extentY[i] * MathF.Abs(plane.Normal.Y) + extentZ[i] * MathF.Abs(plane.Normal.Z);
+                if (Plane.DotCoordinate(plane, center) + reach < 0.0f) {
+                    visible = false;
+                    break;
+                }
+            }
+
+            if (visible) {
+                visibleMask[i / 32] |= 1u << (i % 32);
+                visibleCount++;
+            }
+        }
+
+        return visibleCount;
+    }
+
+    /// <summary>
+    /// Builds a box-shaped frustum with inward-facing planes: |x| &lt;= 30, |y| &lt;= 20, and -10 &lt;= z &lt;= 40.
+    /// </summary>
+    static Plane[] CreateFrustum() {
+        return new Plane[] {
+            new Plane(1.0f, 0.0f, 0.0f, 30.0f),
+            new Plane(-1.0f, 0.0f, 0.0f, 30.0f),
+            new Plane(0.0f, 1.0f, 0.0f, 20.0f),
+            new Plane(0.0f, -1.0f, 0.0f, 20.0f),
+            new Plane(0.0f, 0.0f, -1.0f, 40.0f),
+            new Plane(0.0f, 0.0f, 1.0f, 10.0f)
+        };
+    }
+
+    static float[] CreateValues(Random random, float minimum, float maximum) {
+        float[] values = new float[Count];
+        for (int i = 0; i < Count; i++) {
+            values[i] = NextSingle(random, minimum, maximum);
+        }
+
+        return values;
+    }
+
+    static float NextSingle(Random random, float minimum, float maximum) {
+        return minimum + (float)random.NextDouble() * (maximum - minimum);
+    }
+
+    static void Report(string kernelName, double scalarMilliseconds, double kernelMilliseconds) {
+        Console.WriteLine($"{kernelName}: scalar {scalarMilliseconds:F2} ms, kernel {kernelMilliseconds:F2} ms ({Count} x {Iterations})");
+    }
+}
+#endif
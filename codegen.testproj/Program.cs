@@ -5,6 +5,8 @@
         MemoryStreamTest.Main();
 
 #if !TYPESCRIPT
+        BatchKernelBenchmark.Main();
+
         Console.ReadLine();
 #endif
     }
@@ -143,6 +143,14 @@ public static class CodegenCliOptionsBuilder {
         platformProfile.IsWindowsHost = string.Equals(platformId, "windows", StringComparison.OrdinalIgnoreCase);
         platformProfile.Name = $"{platformId}-headless";
         platformProfile.DefineName = $"HE_CPP_PLATFORM_{platformId.ToUpperInvariant()}";
+        if (TryGetIntOption(selectedOptions, "vector-width-bits", out int vectorWidthInBits)) {
+            if (!CPPPlatformProfile.IsSupportedVectorWidth(vectorWidthInBits)) {
+                throw new ArgumentException($"The 'vector-width-bits' option must be 0, 128, or 256, but was '{vectorWidthInBits}'.");
+            }
+
+            platformProfile.VectorWidthInBits = vectorWidthInBits;
+        }
+
         return platformProfile;
     }
 
@@ -0,0 +1,26 @@
+namespace cs2.attributes;
+
+/// <summary>
+/// Binds the annotated static method to one native BatchKernels entry point: generated native callers invoke the runtime kernel, whose parameters the method must match in order, and the managed body remains the scalar implementation for other targets.
+/// </summary>
+[AttributeUsage(AttributeTargets.Method, AllowMultiple = false, Inherited = false)]
+public sealed class NativeBatchKernelAttribute : Attribute {
+    /// <summary>
+    /// Gets the runtime kernel name, or null when the kernel shares the method name.
+    /// </summary>
+    public string KernelName { get; }
+
+    /// <summary>
+    /// Initializes a batch-kernel binding that uses the annotated method name.
+    /// </summary>
+    public NativeBatchKernelAttribute() {
+    }
+
+    /// <summary>
+    /// Initializes a batch-kernel binding to one explicitly named runtime kernel.
+    /// </summary>
+    /// <param name="kernelName">BatchKernels member invoked by generated native callers, such as CullSpheres.</param>
+    public NativeBatchKernelAttribute(string kernelName) {
+        KernelName = kernelName;
+    }
+}
@@ -7,6 +7,12 @@ using System.Text.RegularExpressions;
 
 namespace cs2.core {
     public class ConversionPreProcessor {
+        /// <summary>
+        /// Runtime class and header that implement the kernels bound through [NativeBatchKernel].
+        /// </summary>
+        const string NativeBatchKernelClassName = "BatchKernels";
+        const string NativeBatchKernelIncludePath = "system/numerics/batch_kernels.hpp";
+
         /// <summary>
         /// Determines whether a symbol is annotated to force async emission in TypeScript.
         /// </summary>
@@ -94,6 +100,65 @@ namespace cs2.core {
             return false;
         }
 
+        /// <summary>
+        /// Resolves the runtime BatchKernels entry point bound to a method through [NativeBatchKernel], defaulting to the method name.
+        /// </summary>
+        /// <param name="methodSymbol">Method symbol to inspect for attributes.</param>
+        /// <param name="functionName">Qualified native kernel invoked in place of the method.</param>
+        /// <returns>True when the batch-kernel attribute is present.</returns>
+        static bool TryResolveNativeBatchKernelMetadata(IMethodSymbol methodSymbol, out string functionName) {
+            functionName = string.Empty;
+            if (methodSymbol == null) {
+                return false;
+            }
+
+            foreach (AttributeData attribute in methodSymbol.GetAttributes()) {
+                INamedTypeSymbol attributeType = attribute.AttributeClass;
+                if (attributeType == null) {
+                    continue;
+                }
+
+                string attributeName = attributeType.Name;
+                if (!string.Equals(attributeName, "NativeBatchKernelAttribute", StringComparison.Ordinal) &&
+                    !string.Equals(attributeName, "NativeBatchKernel", StringComparison.Ordinal)) {
+                    continue;
+                }
+
+                string kernelName = attribute.ConstructorArguments.Length >= 1
+                    ? attribute.ConstructorArguments[0].Value?.ToString()
+                    : null;
+                functionName = NativeBatchKernelClassName + "::" + (string.IsNullOrWhiteSpace(kernelName) ? methodSymbol.Name : kernelName);
+                return true;
+            }
+
+            return false;
+        }
+
+        static bool TryResolveNativeBatchKernelMetadata(MethodDeclarationSyntax methodDeclaration, out string functionName) {
+            functionName = string.Empty;
+            if (methodDeclaration == null) {
+                return false;
+            }
+
+            foreach (AttributeListSyntax attributeList in methodDeclaration.AttributeLists) {
+                foreach (AttributeSyntax attribute in attributeList.Attributes) {
+                    string attributeName = attribute.Name.ToString();
+                    if (!string.Equals(attributeName, "NativeBatchKernel", StringComparison.Ordinal) &&
+                        !string.Equals(attributeName, "NativeBatchKernelAttribute", StringComparison.Ordinal)) {
+                        continue;
+                    }
+
+                    string kernelName = attribute.ArgumentList?.Arguments.Count >= 1
+                        ? TryReadStringLiteral(attribute.ArgumentList.Arguments[0].Expression)
+                        : string.Empty;
+                    functionName = NativeBatchKernelClassName + "::" + (string.IsNullOrWhiteSpace(kernelName) ? methodDeclaration.Identifier.ValueText : kernelName);
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
         static string TryReadStringLiteral(ExpressionSyntax expression) {
             if (expression is LiteralExpressionSyntax literalExpression &&
                 literalExpression.IsKind(SyntaxKind.StringLiteralExpression)) {
@@ -158,6 +223,17 @@ namespace cs2.core {
             return false;
         }
 
+        /// <summary>
+        /// Determines whether one field is marked [ThreadStatic]; the runtime ignores the attribute on instance fields.
+        /// </summary>
+        /// <param name="fieldSymbol">Field symbol to inspect.</param>
+        /// <returns><c>true</c> when the field carries System.ThreadStaticAttribute.</returns>
+        static bool HasThreadStaticAttribute(IFieldSymbol fieldSymbol) {
+            return fieldSymbol != null &&
+                fieldSymbol.GetAttributes().Any(attribute =>
+                    string.Equals(attribute.AttributeClass?.ToDisplayString(), "System.ThreadStaticAttribute", StringComparison.Ordinal));
+        }
+
         /// <summary>
         /// Applies one source-level code generation rename contract from a type symbol onto the current conversion class when present.
         /// </summary>
@@ -397,6 +473,10 @@ namespace cs2.core {
             } else if (TryResolveNativeFreeFunctionMetadata(method, out nativeFreeFunctionName, out nativeFreeFunctionIncludePath)) {
                 func.NativeFreeFunctionName = nativeFreeFunctionName;
                 func.NativeFreeFunctionIncludePath = nativeFreeFunctionIncludePath;
+            } else if (TryResolveNativeBatchKernelMetadata(methodSymbol, out nativeFreeFunctionName) ||
+                TryResolveNativeBatchKernelMetadata(method, out nativeFreeFunctionName)) {
+                func.NativeFreeFunctionName = nativeFreeFunctionName;
+                func.NativeFreeFunctionIncludePath = NativeBatchKernelIncludePath;
             }
 
             ApplyFunctionReturnType(method.ReturnType, semantic, func);
@@ -762,12 +842,14 @@ namespace cs2.core {
                 variable.AccessType = access;
                 variable.IsOverride = isOverride;
                 variable.DeclarationType = type;
-                if (semantic.GetDeclaredSymbol(variableDeclarator) is IFieldSymbol fieldSymbol &&
-                    TryGetExplicitLayoutOffset(fieldSymbol, out int explicitLayoutOffset)) {
+                IFieldSymbol fieldSymbol = semantic.GetDeclaredSymbol(variableDeclarator) as IFieldSymbol;
+                if (TryGetExplicitLayoutOffset(fieldSymbol, out int explicitLayoutOffset)) {
                     variable.HasExplicitLayoutOffset = true;
                     variable.ExplicitLayoutOffset = explicitLayoutOffset;
                 }
 
+                variable.IsThreadStatic = isStatic && HasThreadStaticAttribute(fieldSymbol);
+
                 if (variableDeclarator.Initializer != null) {
                     variable.AssignmentExpression = variableDeclarator.Initializer.Value;
                     if (variableDeclarator.Initializer.Value is LiteralExpressionSyntax literal) {
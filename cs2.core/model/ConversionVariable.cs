@@ -33,6 +33,10 @@ namespace cs2.core {
         /// Gets or sets a value indicating whether one generated field originated from a C# const declaration.
         /// </summary>
         public bool IsConst { get; set; }
+        /// <summary>
+        /// Gets or sets a value indicating whether one static field carries [ThreadStatic] and needs per-thread storage.
+        /// </summary>
+        public bool IsThreadStatic { get; set; }
         public bool IsOverride { get; set; }
         public bool IsGet { get; set; }
         public bool IsSet { get; set; }
@@ -1180,7 +1180,7 @@ namespace cs2.cpp.tests {
             string headerOutput = File.ReadAllText(Path.Combine(output.OutputPath, "Widget.hpp"));
             string sourceOutput = File.ReadAllText(Path.Combine(output.OutputPath, "Widget.cpp"));
 
-            Assert.Contains("Event Changed;", headerOutput);
+            Assert.Contains("Event<> Changed;", headerOutput);
             Assert.DoesNotContain("Event* Changed;", headerOutput, StringComparison.Ordinal);
             Assert.Contains("Changed += &Widget::Handle;", sourceOutput);
             Assert.Contains("Changed -= &Widget::Handle;", sourceOutput);
@@ -1213,10 +1213,262 @@ namespace cs2.cpp.tests {
             string sourceOutput = File.ReadAllText(Path.Combine(output.OutputPath, "Widget.cpp"));
 
             Assert.Contains("Action<int32_t>* handler;", headerOutput);
-            Assert.Contains("this->handler = new Action<int32_t>(std::bind_front(&Widget::Handle, this));", sourceOutput);
+            Assert.Contains("this->handler = new Action<int32_t>(this, &Widget::Handle);", sourceOutput);
             Assert.DoesNotContain("this->handler = &Widget::Handle;", sourceOutput, StringComparison.Ordinal);
         }
 
+        /// <summary>
+        /// Ensures compound assignment on delegate fields combines and removes through the multicast runtime instead of replacing the stored handler.
+        /// </summary>
+        [Fact]
+        public void WriteOutput_WithDelegateFieldCompoundAssignment_CombinesThroughMulticastRuntime() {
+            string source = """
+                using System;
+
+                public class Widget {
+                    Action<int> handler;
+
+                    public void Handle(int value) {
+                    }
+
+                    public int Count() {
+                        return handler.GetInvocationList().Length;
+                    }
+
+                    public void Wire() {
+                        handler += Handle;
+                        handler += value => Handle(value);
+                        handler -= Handle;
+                    }
+
+                    public Widget Next() {
+                        return this;
+                    }
+
+                    public void Unwire() {
+                        Next().handler -= Handle;
+                    }
+                }
+                """;
+
+            ConversionOutput output = RunConversion(source);
+            string sourceOutput = File.ReadAllText(Path.Combine(output.OutputPath, "Widget.cpp"));
+
+            Assert.Contains("#include \"system/multicast_delegate.hpp\"", sourceOutput);
+            Assert.Contains("this->handler = MulticastDelegate::Combine(this->handler, Action<int32_t>(this, &Widget::Handle));", sourceOutput);
+            Assert.Contains("this->handler = MulticastDelegate::Remove(this->handler, Action<int32_t>(this, &Widget::Handle));", sourceOutput);
+            Assert.Contains("this->handler = MulticastDelegate::Combine(this->handler, Action<int32_t>(", sourceOutput);
+            Assert.Contains("MulticastDelegate::GetInvocationList(this->handler)", sourceOutput);
+            Assert.DoesNotContain("MulticastDelegate::Remove(this->handler, new ", sourceOutput, StringComparison.Ordinal);
+            Assert.DoesNotContain("this->handler += ", sourceOutput, StringComparison.Ordinal);
+            Assert.Matches(@"auto& (__delegateTarget_[0-9A-F]{8}) = [^;]*Next\(\)->handler;\s*\1 = MulticastDelegate::Remove\(\1, Action<int32_t>\(this, &Widget::Handle\)\);", sourceOutput);
+        }
+
+        /// <summary>
+        /// Ensures Task members and static Task and Parallel calls map onto the work-stealing runtime surface.
+        /// </summary>
+        [Fact]
+        public void WriteOutput_WithTaskAndParallelUsage_UsesTaskRuntimeSurface() {
+            string source = """
+                using System;
+                using System.Threading.Tasks;
+
+                public class Widget {
+                    Task<int> pending;
+                    Task completed;
+
+                    public void Start() {
+                        completed = Task.Run(() => { });
+                        Parallel.For(0, 16, index => { });
+                    }
+                }
+                """;
+
+            ConversionOutput output = RunConversion(source);
+            string headerOutput = File.ReadAllText(Path.Combine(output.OutputPath, "Widget.hpp"));
+            string sourceOutput = File.ReadAllText(Path.Combine(output.OutputPath, "Widget.cpp"));
+            string combinedOutput = headerOutput + sourceOutput;
+
+            Assert.Contains("Task_1<int32_t>* pending;", headerOutput);
+            Assert.Contains("Task* completed;", headerOutput);
+            Assert.Contains("#include \"system/threading/tasks/task.hpp\"", combinedOutput);
+            Assert.Contains("#include \"system/threading/tasks/parallel.hpp\"", combinedOutput);
+            Assert.Contains("Task::Run(", sourceOutput);
+            Assert.Contains("Parallel::For(", sourceOutput);
+        }
+
+        /// <summary>
+        /// Ensures async methods and lambdas lower onto C++20 coroutines instead of emitting managed await syntax.
+        /// </summary>
+        [Fact]
+        public void WriteOutput_WithAsyncMethods_LowersToCoroutines() {
+            string source = """
+                using System;
+                using System.Threading.Tasks;
+
+                public class Widget {
+                    int total;
+
+                    public async Task<int> LoadAsync(int value) {
+                        await Task.Yield();
+                        return value + 1;
+                    }
+
+                    public async Task RefreshAsync() {
+                        total = await LoadAsync(total);
+                    }
+
+                    public async ValueTask<int> PeekAsync() => await LoadAsync(total);
+
+                    public async void Fire() {
+                        await RefreshAsync();
+                    }
+
+                    public void Schedule() {
+                        Func<Task<int>> pending = async () => await LoadAsync(2);
+                    }
+                }
+                """;
+
+            ConversionOutput output = RunConversion(source);
+            string headerOutput = File.ReadAllText(Path.Combine(output.OutputPath, "Widget.hpp"));
+            string sourceOutput = File.ReadAllText(Path.Combine(output.OutputPath, "Widget.cpp"));
+
+            Assert.Contains("Task_1<int32_t>* LoadAsync(int32_t value);", headerOutput);
+            Assert.Contains("Task_1<int32_t>* PeekAsync();", headerOutput);
+            Assert.Contains("co_await Task::Yield()", sourceOutput);
+            Assert.Contains("co_return value + 1;", sourceOutput);
+            Assert.Contains("co_return co_await this->LoadAsync(", sourceOutput);
+            Assert.Contains("AsyncVoidMethod::Start([=, this]() mutable -> Task* {", sourceOutput);
+            Assert.Contains("[=, this]() mutable -> Task_1<int32_t>* {", sourceOutput);
+            Assert.DoesNotContain("await ", sourceOutput.Replace("co_await ", string.Empty));
+        }
+
+        /// <summary>
+        /// Ensures concurrent collections map onto the runtime concurrent headers and indexer writes use set_Item.
+        /// </summary>
+        [Fact]
+        public void WriteOutput_WithConcurrentCollections_UsesConcurrentRuntimeSurface() {
+            string source = """
+                using System.Collections.Concurrent;
+
+                public class Widget {
+                    ConcurrentDictionary<string, int> cache = new ConcurrentDictionary<string, int>();
+                    ConcurrentQueue<int> pending = new ConcurrentQueue<int>();
+                    ConcurrentBag<int> spare = new ConcurrentBag<int>();
+
+                    public int Touch(string key) {
+                        cache[key] = 1;
+                        pending.Enqueue(cache[key]);
+                        spare.Add(2);
+                        return cache.GetOrAdd(key, 3);
+                    }
+                }
+                """;
+
+            ConversionOutput output = RunConversion(source);
+            string headerOutput = File.ReadAllText(Path.Combine(output.OutputPath, "Widget.hpp"));
+            string sourceOutput = File.ReadAllText(Path.Combine(output.OutputPath, "Widget.cpp"));
+            string combinedOutput = headerOutput + sourceOutput;
+
+            Assert.Contains("ConcurrentDictionary<std::string, int32_t>* cache;", headerOutput);
+            Assert.Contains("ConcurrentQueue<int32_t>* pending;", headerOutput);
+            Assert.Contains("ConcurrentBag<int32_t>* spare;", headerOutput);
+            Assert.Contains("#include \"system/collections/concurrent/concurrent_dictionary.hpp\"", combinedOutput);
+            Assert.Contains("#include \"system/collections/concurrent/concurrent_queue.hpp\"", combinedOutput);
+            Assert.Contains("#include \"system/collections/concurrent/concurrent_bag.hpp\"", combinedOutput);
+            Assert.Contains("->set_Item(key, 1)", sourceOutput);
+            Assert.Contains("->get_Item(key)", sourceOutput);
+            Assert.Contains("->GetOrAdd(key, 3)", sourceOutput);
+        }
+
+        /// <summary>
+        /// Ensures lock statements lower onto a monitor scope and the slim threading primitives resolve to runtime headers.
+        /// </summary>
+        [Fact]
+        public void WriteOutput_WithLockStatementAndSlimPrimitives_UsesMonitorLockScope() {
+            string source = """
+                using System.Threading;
+
+                public class Widget {
+                    readonly object gate = new object();
+                    SemaphoreSlim throttle = new SemaphoreSlim(2);
+                    ManualResetEventSlim ready = new ManualResetEventSlim(false);
+                    ReaderWriterLockSlim table = new ReaderWriterLockSlim();
+                    int count;
+
+                    public int Touch() {
+                        lock (gate) {
+                            count++;
+                        }
+
+                        throttle.Wait();
+                        ready.Set();
+                        table.EnterReadLock();
+                        table.ExitReadLock();
+                        Monitor.PulseAll(gate);
+                        return throttle.Release();
+                    }
+                }
+                """;
+
+            ConversionOutput output = RunConversion(source);
+            string headerOutput = File.ReadAllText(Path.Combine(output.OutputPath, "Widget.hpp"));
+            string sourceOutput = File.ReadAllText(Path.Combine(output.OutputPath, "Widget.cpp"));
+            string combinedOutput = headerOutput + sourceOutput;
+
+            Assert.Matches(@"MonitorLockScope __lockScope_[0-9A-F]{8}\(", sourceOutput);
+            Assert.DoesNotContain("Lock omitted", sourceOutput, StringComparison.Ordinal);
+            Assert.Contains("Monitor::PulseAll(", sourceOutput);
+            Assert.Contains("SemaphoreSlim* throttle;", headerOutput);
+            Assert.Contains("ManualResetEventSlim* ready;", headerOutput);
+            Assert.Contains("ReaderWriterLockSlim* table;", headerOutput);
+            Assert.Contains("#include \"system/threading/monitor.hpp\"", combinedOutput);
+            Assert.Contains("#include \"system/threading/semaphore_slim.hpp\"", combinedOutput);
+            Assert.Contains("#include \"system/threading/manual_reset_event_slim.hpp\"", combinedOutput);
+            Assert.Contains("#include \"system/threading/reader_writer_lock_slim.hpp\"", combinedOutput);
+        }
+
+        /// <summary>
+        /// Ensures [ThreadStatic] static fields emit thread_local storage and ThreadLocal maps onto the runtime template.
+        /// </summary>
+        [Fact]
+        public void WriteOutput_WithThreadStaticFieldAndThreadLocal_UsesThreadLocalStorage() {
+            string source = """
+                using System;
+                using System.Threading;
+
+                public class Widget {
+                    [ThreadStatic]
+                    static float[] scratch;
+                    static int shared;
+                    ThreadLocal<int> visits = new ThreadLocal<int>(() => 0, true);
+
+                    public int Touch() {
+                        if (scratch == null) {
+                            scratch = new float[64];
+                        }
+
+                        shared++;
+                        return visits.Value;
+                    }
+                }
+                """;
+
+            ConversionOutput output = RunConversion(source);
+            string headerOutput = File.ReadAllText(Path.Combine(output.OutputPath, "Widget.hpp"));
+            string sourceOutput = File.ReadAllText(Path.Combine(output.OutputPath, "Widget.cpp"));
+            string combinedOutput = headerOutput + sourceOutput;
+
+            Assert.Contains("static thread_local Array<float>* scratch;", headerOutput);
+            Assert.Contains("thread_local Array<float>* Widget::scratch", sourceOutput);
+            Assert.Contains("static int32_t shared;", headerOutput);
+            Assert.DoesNotContain("thread_local int32_t Widget::shared", sourceOutput, StringComparison.Ordinal);
+            Assert.Contains("ThreadLocal<int32_t>* visits;", headerOutput);
+            Assert.Contains("->get_Value()", sourceOutput);
+            Assert.Contains("#include \"system/threading/thread_local.hpp\"", combinedOutput);
+        }
+
         /// <summary>
         /// Ensures nongeneric Action callbacks emit valid native delegate types and guarded invocation instead of leaking null-conditional Invoke syntax.
         /// </summary>
@@ -1280,7 +1532,8 @@ namespace cs2.cpp.tests {
             string headerOutput = File.ReadAllText(Path.Combine(output.OutputPath, "Widget.hpp"));
             string sourceOutput = File.ReadAllText(Path.Combine(output.OutputPath, "Widget.cpp"));
 
-            Assert.Contains("::Event CursorEvent;", headerOutput);
+            Assert.Contains("::Event<", headerOutput);
+            Assert.Contains("> CursorEvent;", headerOutput);
             Assert.Contains("this->CursorEvent.Invoke(relPos, delta, state);", sourceOutput);
             Assert.DoesNotContain("this->CursorEvent != nullptr", sourceOutput, StringComparison.Ordinal);
             Assert.DoesNotContain("(*this->CursorEvent)", sourceOutput, StringComparison.Ordinal);
@@ -1786,7 +2039,7 @@ namespace cs2.cpp.tests {
             string headerOutput = File.ReadAllText(Path.Combine(output.OutputPath, "Widget.hpp"));
             string sourceOutput = File.ReadAllText(Path.Combine(output.OutputPath, "Widget.cpp"));
 
-            Assert.Contains("Event Hovered;", headerOutput);
+            Assert.Contains("Event<> Hovered;", headerOutput);
             Assert.Contains("Hovered.Invoke();", sourceOutput);
             Assert.DoesNotContain("Hovered != nullptr", sourceOutput, StringComparison.Ordinal);
             Assert.DoesNotContain("(*Hovered)", sourceOutput, StringComparison.Ordinal);
@@ -2458,6 +2711,34 @@ namespace cs2.cpp.tests {
             Assert.DoesNotContain("System.IO.MemoryStream", sourceOutput, StringComparison.Ordinal);
         }
 
+        /// <summary>
+        /// Ensures System.IO.Compression stream constructions lower to the runtime compression streams and enum members.
+        /// </summary>
+        [Fact]
+        public void WriteOutput_WithCompressionStreamConstruction_UsesRuntimeCompressionStreamTypes() {
+            string source = """
+                using System.IO;
+                using System.IO.Compression;
+
+                public static class AssetCompressor {
+                    public static Stream OpenPacked(Stream stream) {
+                        return new GZipStream(stream, CompressionMode.Decompress);
+                    }
+
+                    public static Stream CreatePacked(Stream stream) {
+                        return new System.IO.Compression.DeflateStream(stream, CompressionLevel.Fastest, true);
+                    }
+                }
+                """;
+
+            ConversionOutput output = RunConversion(source);
+            string sourceOutput = File.ReadAllText(Path.Combine(output.OutputPath, "AssetCompressor.cpp"));
+
+            Assert.Contains("new GZipStream(stream, CompressionMode::Decompress)", sourceOutput);
+            Assert.Contains("new DeflateStream(stream, CompressionLevel::Fastest, true)", sourceOutput);
+            Assert.DoesNotContain("System.IO.Compression", sourceOutput, StringComparison.Ordinal);
+        }
+
         /// <summary>
         /// Ensures generated generic element types drop source namespaces when rendered inside native collection constructions.
         /// </summary>
@@ -3545,7 +3826,7 @@ namespace cs2.cpp.tests {
 
             Assert.Contains("#include \"system/threading/thread.hpp\"", headerOutput, StringComparison.Ordinal);
             Assert.DoesNotContain("#include \"Thread.hpp\"", headerOutput, StringComparison.Ordinal);
-            Assert.Contains("new Thread(new Action<void*>(std::bind_front(&Dispatcher::WorkerLoop, this)))", sourceOutput, StringComparison.Ordinal);
+            Assert.Contains("new Thread(new Action<void*>(this, &Dispatcher::WorkerLoop))", sourceOutput, StringComparison.Ordinal);
             Assert.DoesNotContain("new Thread(&Dispatcher::WorkerLoop)", sourceOutput, StringComparison.Ordinal);
             Assert.True(File.Exists(Path.Combine(output.OutputPath, "system", "threading", "thread.hpp")));
         }
@@ -9858,7 +10139,7 @@ namespace cs2.cpp.tests {
         }
 
         /// <summary>
-        /// Ensures overloaded instance method groups assigned to delegates emit one typed method-pointer cast so std::bind_front selects the intended overload.
+        /// Ensures overloaded instance method groups assigned to delegates emit one typed method-pointer cast so the bound delegate constructor selects the intended overload.
         /// </summary>
         [Fact]
         public void WriteOutput_WithOverloadedDelegateMethodGroup_EmitsTypedMethodPointerCast() {
@@ -9884,7 +10165,8 @@ namespace cs2.cpp.tests {
             string sourceOutput = File.ReadAllText(Path.Combine(output.OutputPath, "Fixture.cpp"));
 
             Assert.Contains("static_cast<void (Fixture::*)(int32_t)>(&Fixture::Work)", sourceOutput, StringComparison.Ordinal);
-            Assert.Contains("std::bind_front(", sourceOutput, StringComparison.Ordinal);
+            Assert.Contains("(this, static_cast<void (Fixture::*)(int32_t)>(&Fixture::Work))", sourceOutput, StringComparison.Ordinal);
+            Assert.DoesNotContain("std::bind_front(", sourceOutput, StringComparison.Ordinal);
         }
 
         /// <summary>
@@ -39,6 +39,19 @@ public class CPPConversionPresetCatalogTests {
         Assert.True(preset.RestrictionProfile.ForbidDebugOnlySystems);
     }
 
+    /// <summary>
+    /// Ensures single-core console presets pin the native thread pool to a fixed worker count.
+    /// </summary>
+    [Fact]
+    public void Resolve_SingleCorePresets_FixThreadPoolWorkerCount() {
+        CPPConversionPresetCatalog catalog = new CPPConversionPresetCatalog();
+
+        Assert.Equal("0", catalog.Resolve("ps2-lite").PlatformOptionValues[CPPCodegenOptionNames.ThreadPoolWorkerCount]);
+        Assert.Equal("0", catalog.Resolve("ds-lite").PlatformOptionValues[CPPCodegenOptionNames.ThreadPoolWorkerCount]);
+        Assert.Equal("0", catalog.Resolve("n64-minimal").PlatformOptionValues[CPPCodegenOptionNames.ThreadPoolWorkerCount]);
+        Assert.Equal("1", catalog.Resolve("native-core-boot").PlatformOptionValues[CPPCodegenOptionNames.ThreadPoolWorkerCount]);
+    }
+
     /// <summary>
     /// Ensures the stripped native preset resolves the native column-vector generated math convention.
     /// </summary>
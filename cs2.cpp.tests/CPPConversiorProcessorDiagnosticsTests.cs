@@ -187,6 +187,36 @@ public class CPPConversiorProcessorDiagnosticsTests {
         Assert.Empty(converter.Report.Diagnostics);
     }
 
+    /// <summary>
+    /// Ensures an event whose delegate signature does not resolve reports one diagnostic instead of an untyped native event.
+    /// </summary>
+    [Fact]
+    public void ReportUnresolvedEventSignature_WithUnresolvedDelegate_ReportsOnce() {
+        string source = """
+            public class Widget {
+                public event MissingHandler Changed;
+            }
+            """;
+
+        CPPCodeConverter converter = new CPPCodeConverter(new CPPConversionRules(), CreateTestOptions());
+        CPPConversiorProcessor processor = new CPPConversiorProcessor(converter);
+        var compilation = RoslynTestHelper.CreateCompilation(source, filePath: "Widget.cs");
+        ConversionClass conversionClass = new ConversionClass {
+            Name = "Widget",
+            TypeSymbol = compilation.GetTypeByMetadataName("Widget")
+        };
+
+        Assert.False(processor.TryGetEventArgumentTypes(conversionClass, "Changed", new CPPProgram(new CPPConversionRules()), out _));
+        processor.ReportUnresolvedEventSignature(conversionClass, "Changed");
+        processor.ReportUnresolvedEventSignature(conversionClass, "Changed");
+
+        CPPConversionDiagnostic diagnostic = Assert.Single(converter.Report.Diagnostics);
+        Assert.Equal("Widget", diagnostic.SourceTypeName);
+        Assert.Equal("Changed", diagnostic.SourceMemberName);
+        Assert.Equal(nameof(SyntaxKind.EventFieldDeclaration), diagnostic.SyntaxKind);
+        Assert.Equal("Widget.cs", diagnostic.FilePath);
+    }
+
     /// <summary>
     /// Creates the current class and function context used for processor diagnostic tests.
     /// </summary>
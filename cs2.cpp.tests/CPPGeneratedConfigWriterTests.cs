@@ -72,6 +72,7 @@ public class CPPGeneratedConfigWriterTests {
         Assert.Contains("#define HE_CPP_RUNTIME_STL_LITE 1", output);
         Assert.Contains("#define HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES 0", output);
         Assert.Contains("#define HE_CPP_GENERATED_FUNCTION_PROFILING 0", output);
+        Assert.Contains("#define HE_CPP_MATH_COLUMN_VECTOR 0", output);
         Assert.Contains("#define HE_CPP_REQ_NATIVE_STRING 1", output);
         Assert.Contains("#define HE_CPP_REQ_NATIVE_LIST 1", output);
         Assert.Contains("#define HE_CPP_REQ_NATIVE_DICTIONARY 1", output);
@@ -97,6 +98,45 @@ public class CPPGeneratedConfigWriterTests {
         Assert.Contains("#define HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES 1", output);
     }
 
+    /// <summary>
+    /// Ensures the generated config writer fixes the native thread-pool worker count when the generic option is set.
+    /// </summary>
+    [Fact]
+    public void Write_WhenThreadPoolWorkerCountIsSet_WritesWorkerCountDefine() {
+        CPPConversionOptions options = CPPConversionOptions.CreateDefault();
+        options.PlatformOptionValues = new Dictionary<string, string>(StringComparer.OrdinalIgnoreCase) {
+            [CPPCodegenOptionNames.ThreadPoolWorkerCount] = "0"
+        };
+        CPPConversionReport report = new CPPConversionReport();
+        CPPRuntimeRequirementRegistrar registrar = new CPPRuntimeRequirementRegistrar(new CPPRuntimeRequirementCatalog(), report);
+        registrar.RegisterDefaults(options);
+
+        string outputFolder = Path.Combine(Path.GetTempPath(), "cs2.cpp.tests", Guid.NewGuid().ToString("N"));
+        string filePath = CPPGeneratedConfigWriter.Write(outputFolder, options, registrar);
+        string output = File.ReadAllText(filePath);
+
+        Assert.Contains("#define HE_CPP_THREAD_POOL_WORKER_COUNT 0", output);
+    }
+
+    /// <summary>
+    /// Ensures the generated config writer fixes the Vector&lt;T&gt; width only when the platform profile pins one.
+    /// </summary>
+    [Fact]
+    public void Write_WhenPlatformProfilePinsVectorWidth_WritesVectorWidthDefine() {
+        CPPConversionOptions options = CPPConversionOptions.CreateDefault();
+        CPPConversionReport report = new CPPConversionReport();
+        CPPRuntimeRequirementRegistrar registrar = new CPPRuntimeRequirementRegistrar(new CPPRuntimeRequirementCatalog(), report);
+        registrar.RegisterDefaults(options);
+
+        string outputFolder = Path.Combine(Path.GetTempPath(), "cs2.cpp.tests", Guid.NewGuid().ToString("N"));
+        string defaultOutput = File.ReadAllText(CPPGeneratedConfigWriter.Write(outputFolder, options, registrar));
+        options.PlatformProfile.VectorWidthInBits = 256;
+        string pinnedOutput = File.ReadAllText(CPPGeneratedConfigWriter.Write(outputFolder, options, registrar));
+
+        Assert.DoesNotContain("HE_CPP_VECTOR_WIDTH_BITS", defaultOutput);
+        Assert.Contains("#define HE_CPP_VECTOR_WIDTH_BITS 256", pinnedOutput);
+    }
+
     /// <summary>
     /// Ensures the generated config writer emits caller-owned custom platform metadata from a generic custom profile.
     /// </summary>
@@ -127,6 +167,7 @@ public class CPPGeneratedConfigWriterTests {
         Assert.Contains("#define HE_CPP_RUNTIME_STL_LITE 1", output);
         Assert.Contains("#define HE_CPP_PLATFORM_IS_LITTLE_ENDIAN 0", output);
         Assert.Contains("#define HE_CPP_PLATFORM_IS_WINDOWS_HOST 0", output);
+        Assert.Contains("#define HE_CPP_MATH_COLUMN_VECTOR 1", output);
         Assert.Contains("#define HE_CPP_RUNTIME_HAS_CUSTOM_FILE_SYSTEM 1", output);
         Assert.Contains("#define HE_CPP_RUNTIME_CUSTOM_FILE_SYSTEM_HEADER \"platform/retro/RetroDiscFileSystem.hpp\"", output);
         Assert.Contains("#define HE_CPP_RUNTIME_CUSTOM_FILE_SYSTEM_TYPE ExamplePlatform::RetroDiscFileSystem", output);
@@ -111,6 +111,7 @@ public class CPPGeneratedFunctionProfilingTests {
         string spinLockHeader = File.ReadAllText(Path.Combine(outputPath, "system", "threading", "spin_lock.hpp"));
 
         Assert.Contains("#include \"../../runtime/generated_profiler.hpp\"", spinLockHeader, StringComparison.Ordinal);
+        Assert.Contains("#define HE_CPP_SPIN_LOCK_STATISTICS 1", spinLockHeader, StringComparison.Ordinal);
         Assert.Contains("HE_CPP_GENERATED_PROFILE_LOCKABLE(std::mutex, ProfileLock, \"SpinLock\");", spinLockHeader, StringComparison.Ordinal);
         Assert.Contains("HE_CPP_GENERATED_PROFILE_BEFORE_LOCK(ProfileLock, profileLockQueued);", spinLockHeader, StringComparison.Ordinal);
         Assert.Contains("HE_CPP_GENERATED_PROFILE_AFTER_LOCK(ProfileLock, profileLockQueued);", spinLockHeader, StringComparison.Ordinal);
@@ -118,6 +119,26 @@ public class CPPGeneratedFunctionProfilingTests {
         Assert.DoesNotContain("lock (", spinLockHeader, StringComparison.Ordinal);
     }
 
+    /// <summary>
+    /// Ensures a profiling-enabled conversion reports the SpinLock contention counters to Tracy after each contended Enter.
+    /// </summary>
+    [Fact]
+    public void WriteOutput_WhenGeneratedFunctionProfilingIsEnabled_PlotsSpinLockContentionStatistics() {
+        string outputPath = CPPGeneratedFunctionProfilingTestFixture.RunConversion(true);
+        string spinLockHeader = File.ReadAllText(Path.Combine(outputPath, "system", "threading", "spin_lock.hpp"));
+        string profilerHeader = File.ReadAllText(Path.Combine(outputPath, "runtime", "generated_profiler.hpp"));
+
+        int snapshotIndex = spinLockHeader.IndexOf("const SpinLockStatistics profileContentionBefore = GetStatistics();", StringComparison.Ordinal);
+        int enterIndex = spinLockHeader.IndexOf("EnterContended();", StringComparison.Ordinal);
+        int reportIndex = spinLockHeader.IndexOf("HE_CPP_GENERATED_PROFILE_SPIN_LOCK_CONTENTION(profileContentionBefore, GetStatistics());", StringComparison.Ordinal);
+        Assert.True(snapshotIndex >= 0 && snapshotIndex < enterIndex && enterIndex < reportIndex);
+        Assert.Contains("#define HE_CPP_GENERATED_PROFILE_SPIN_LOCK_CONTENTION(before, after)", profilerHeader, StringComparison.Ordinal);
+        Assert.Contains("TracyPlot(\"SpinLock contended enters\", static_cast<int64_t>(profileContentionAfter.ContendedEnters));", profilerHeader, StringComparison.Ordinal);
+        Assert.Contains("TracyPlot(\"SpinLock spin rounds\", static_cast<int64_t>(profileContentionAfter.SpinRounds - (before).SpinRounds));", profilerHeader, StringComparison.Ordinal);
+        Assert.Contains("TracyPlot(\"SpinLock yields\", static_cast<int64_t>(profileContentionAfter.Yields - (before).Yields));", profilerHeader, StringComparison.Ordinal);
+        Assert.Contains("TracyPlot(\"SpinLock parks\", static_cast<int64_t>(profileContentionAfter.Parks - (before).Parks));", profilerHeader, StringComparison.Ordinal);
+    }
+
     /// <summary>
     /// Ensures a profiling-disabled conversion leaves runtime allocation and lock templates free of Tracy support references.
     /// </summary>
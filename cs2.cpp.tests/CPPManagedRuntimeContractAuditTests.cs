@@ -245,8 +245,8 @@ namespace cs2.cpp.tests {
             Assert.Contains("static Vector128_1<T> As(const Vector128_1<T>& value)", vector128Runtime, StringComparison.Ordinal);
             Assert.Contains("static Vector256<T> As(const Vector256<T>& value)", vector256Runtime, StringComparison.Ordinal);
             Assert.Contains("class Func<TResult>", funcRuntime, StringComparison.Ordinal);
-            Assert.Contains("#include <functional>", funcRuntime, StringComparison.Ordinal);
-            Assert.Contains("using FuncType = std::function<TResult()>;", funcRuntime, StringComparison.Ordinal);
+            Assert.Contains("#include \"invocation_list.hpp\"", funcRuntime, StringComparison.Ordinal);
+            Assert.Contains("using FuncType = InlineDelegate<TResult()>;", funcRuntime, StringComparison.Ordinal);
             Assert.Contains("TResult operator()() const", funcRuntime, StringComparison.Ordinal);
             Assert.Contains("Array<T>* ToArray() const", spanRuntime, StringComparison.Ordinal);
             Assert.Contains("bool operator==(std::nullptr_t) const", nullableRuntime, StringComparison.Ordinal);
@@ -389,6 +389,136 @@ namespace cs2.cpp.tests {
             AssertRuntimeRequirement(output.Report, "Sse");
         }
 
+        /// <summary>
+        /// Ensures methods that branch on AVX support are emitted as baseline, AVX2, and AVX-512 clones behind a SimdDispatch resolver.
+        /// </summary>
+        [Fact]
+        public void WriteOutput_WithAvxSupportBranches_EmitsSimdDispatchClones() {
+            string source = """
+                using System.Runtime.Intrinsics;
+                using System.Runtime.Intrinsics.X86;
+
+                public class WideKernels {
+                    public static float Sum(float[] values) {
+                        float total = 0;
+                        if (Vector256.IsHardwareAccelerated) {
+                            total = 1;
+                        }
+
+                        return total + values.Length;
+                    }
+
+                    public float Scale(float value) {
+                        return Avx2.IsSupported ? value * 2 : value;
+                    }
+
+                    public float Plain(float value) {
+                        return value;
+                    }
+                }
+                """;
+
+            ConversionOutput output = RunConversion(source);
+            string header = File.ReadAllText(Path.Combine(output.OutputPath, "WideKernels.hpp"));
+            string sourceOutput = File.ReadAllText(Path.Combine(output.OutputPath, "WideKernels.cpp"));
+
+            Assert.Contains("#include \"system/runtime/intrinsics/simd_dispatch.hpp\"", header, StringComparison.Ordinal);
+            Assert.Contains("#if HE_CPP_SIMD_FUNCTION_DISPATCH", header, StringComparison.Ordinal);
+            Assert.Contains("static HE_CPP_AVX2_TARGET float Sum_SimdAvx2(", header, StringComparison.Ordinal);
+            Assert.Contains("HE_CPP_AVX512_TARGET float Scale_SimdAvx512(float value);", header, StringComparison.Ordinal);
+            Assert.Contains("static const auto implementation = SimdDispatch::Select<float (*)(", sourceOutput, StringComparison.Ordinal);
+            Assert.Contains("SimdDispatch::Select<float (WideKernels::*)(float)>(&WideKernels::Scale_SimdBaseline, &WideKernels::Scale_SimdAvx2, &WideKernels::Scale_SimdAvx512);", sourceOutput, StringComparison.Ordinal);
+            Assert.Contains("return (this->*implementation)(std::move(value));", sourceOutput, StringComparison.Ordinal);
+            Assert.Contains("HE_CPP_AVX2_TARGET float WideKernels::Scale_SimdAvx2(float value)", sourceOutput, StringComparison.Ordinal);
+            Assert.Contains("#else", sourceOutput, StringComparison.Ordinal);
+            Assert.DoesNotContain("Plain_SimdBaseline", header, StringComparison.Ordinal);
+            Assert.DoesNotContain("__simd", header + sourceOutput, StringComparison.Ordinal);
+            AssertRuntimeRequirement(output.Report, "SimdDispatch");
+        }
+
+        /// <summary>
+        /// Ensures System.Numerics math value types map to the register-backed runtime header and stay by-value members.
+        /// </summary>
+        [Fact]
+        public void WriteOutput_WithSystemNumericsMathTypes_UsesNativeVectorsHeader() {
+            string source = """
+                using System.Numerics;
+
+                public class SkinnedBone {
+                    public Matrix4x4 World;
+
+                    public Vector3 Apply(Vector3 position, Quaternion rotation) {
+                        Matrix4x4 pose = Matrix4x4.CreateFromQuaternion(rotation) * World;
+                        return Vector3.Transform(position, pose);
+                    }
+                }
+                """;
+
+            ConversionOutput output = RunConversion(source);
+            string header = File.ReadAllText(Path.Combine(output.OutputPath, "SkinnedBone.hpp"));
+            string sourceOutput = File.ReadAllText(Path.Combine(output.OutputPath, "SkinnedBone.cpp"));
+
+            Assert.Contains("#include \"system/numerics/vectors.hpp\"", header, StringComparison.Ordinal);
+            Assert.Contains("Matrix4x4 World;", header, StringComparison.Ordinal);
+            Assert.DoesNotContain("Matrix4x4*", header, StringComparison.Ordinal);
+            Assert.DoesNotContain("#include \"Vector3.hpp\"", header, StringComparison.Ordinal);
+            Assert.DoesNotContain("#include \"Matrix4x4.hpp\"", sourceOutput, StringComparison.Ordinal);
+            Assert.Contains("Vector3::Transform(", sourceOutput, StringComparison.Ordinal);
+            AssertRuntimeRequirement(output.Report, "NativeNumericsVectors");
+        }
+
+        /// <summary>
+        /// Ensures [NativeBatchKernel] methods forward their callers to the runtime batch kernels and emit no member of their own.
+        /// </summary>
+        [Fact]
+        public void WriteOutput_WithNativeBatchKernelMethods_ForwardsCallersToRuntimeKernels() {
+            string source = """
+                using System;
+                using System.Numerics;
+
+                [AttributeUsage(AttributeTargets.Method, AllowMultiple = false, Inherited = false)]
+                internal sealed class NativeBatchKernelAttribute : Attribute {
+                    public NativeBatchKernelAttribute() {
+                    }
+
+                    public NativeBatchKernelAttribute(string kernelName) {
+                    }
+                }
+
+                public class FrustumCuller {
+                    public int Cull(ReadOnlySpan<Plane> planes, ReadOnlySpan<float> x, ReadOnlySpan<float> y, ReadOnlySpan<float> z, ReadOnlySpan<float> radius, Span<uint> visible) {
+                        return CullBoundingSpheres(planes, x, y, z, radius, visible);
+                    }
+
+                    public void Move(Matrix4x4 matrix, ReadOnlySpan<float> x, ReadOnlySpan<float> y, ReadOnlySpan<float> z, Span<float> outX, Span<float> outY, Span<float> outZ) {
+                        TransformPoints(matrix, x, y, z, outX, outY, outZ);
+                    }
+
+                    [NativeBatchKernel("CullSpheres")]
+                    static int CullBoundingSpheres(ReadOnlySpan<Plane> planes, ReadOnlySpan<float> x, ReadOnlySpan<float> y, ReadOnlySpan<float> z, ReadOnlySpan<float> radius, Span<uint> visible) {
+                        return 0;
+                    }
+
+                    [NativeBatchKernel]
+                    static void TransformPoints(Matrix4x4 matrix, ReadOnlySpan<float> x, ReadOnlySpan<float> y, ReadOnlySpan<float> z, Span<float> outX, Span<float> outY, Span<float> outZ) {
+                    }
+                }
+                """;
+
+            ConversionOutput output = RunConversion(source);
+            string header = File.ReadAllText(Path.Combine(output.OutputPath, "FrustumCuller.hpp"));
+            string sourceOutput = File.ReadAllText(Path.Combine(output.OutputPath, "FrustumCuller.cpp"));
+
+            Assert.Contains("#include \"system/numerics/batch_kernels.hpp\"", sourceOutput, StringComparison.Ordinal);
+            Assert.Contains("BatchKernels::CullSpheres(planes, x, y, z, radius, visible)", sourceOutput, StringComparison.Ordinal);
+            Assert.Contains("BatchKernels::TransformPoints(matrix, x, y, z, outX, outY, outZ)", sourceOutput, StringComparison.Ordinal);
+            Assert.DoesNotContain("CullBoundingSpheres", header, StringComparison.Ordinal);
+            Assert.DoesNotContain("FrustumCuller::CullBoundingSpheres", sourceOutput, StringComparison.Ordinal);
+            Assert.DoesNotContain("FrustumCuller::TransformPoints", sourceOutput, StringComparison.Ordinal);
+            Assert.False(File.Exists(Path.Combine(output.OutputPath, "NativeBatchKernelAttribute.hpp")));
+            AssertRuntimeRequirement(output.Report, "NativeBatchKernels");
+        }
+
         /// <summary>
         /// Ensures the portable vector runtime exposes the bridge helpers BEPU uses between Vector, Vector128, and Vector256.
         /// </summary>
@@ -758,6 +888,107 @@ namespace cs2.cpp.tests {
             Assert.True(File.Exists(Path.Combine(output.OutputPath, "system", "binary_primitives.hpp")));
         }
 
+        /// <summary>
+        /// Ensures copies of BitConverter.GetBytes into a byte array become allocation-free WriteBytes calls.
+        /// </summary>
+        [Fact]
+        public void WriteOutput_WithBitConverterGetBytesCopies_RewritesToWriteBytes() {
+            string source = """
+                using System;
+
+                public class PacketWriter {
+                    public void WriteHeader(byte[] buffer, int offset, int id, float scale, long stamp, short partial) {
+                        Array.Copy(BitConverter.GetBytes(id), 0, buffer, offset, 4);
+                        Array.Copy(BitConverter.GetBytes(scale), buffer, sizeof(float));
+                        BitConverter.GetBytes(stamp).CopyTo(buffer, offset + 8);
+                        Array.Copy(BitConverter.GetBytes(partial), 0, buffer, offset, 1);
+                    }
+
+                    public bool WriteSpan(Span<byte> destination, double value) {
+                        return BitConverter.TryWriteBytes(destination, value);
+                    }
+                }
+                """;
+
+            ConversionOutput output = RunConversion(source);
+            string sourceOutput = File.ReadAllText(Path.Combine(output.OutputPath, "PacketWriter.cpp"));
+
+            Assert.Contains("#include \"system/bit_converter.hpp\"", sourceOutput);
+            Assert.Contains("BitConverter::WriteBytes<int32_t>(buffer, offset, id)", sourceOutput);
+            Assert.Contains("BitConverter::WriteBytes<float>(buffer, 0, scale)", sourceOutput);
+            Assert.Contains("BitConverter::WriteBytes<int64_t>(buffer, offset + 8, stamp)", sourceOutput);
+            Assert.DoesNotContain("BitConverter::TryWriteBytes<", sourceOutput);
+            Assert.Contains("BitConverter::GetBytes(partial)", sourceOutput);
+            Assert.Contains("BitConverter::TryWriteBytes(destination, value)", sourceOutput);
+            AssertRuntimeRequirement(output.Report, "BitConverter");
+        }
+
+        /// <summary>
+        /// Ensures BinaryPrimitives Try* calls keep their spans for the length check and span-wide ReverseEndianness forwards both spans.
+        /// </summary>
+        [Fact]
+        public void WriteOutput_WithBinaryPrimitivesTryAndSpanCalls_PassesSpansThrough() {
+            string source = """
+                using System;
+                using System.Buffers.Binary;
+
+                public class VertexSwapper {
+                    public int ReadCount(ReadOnlySpan<byte> header) {
+                        int count;
+                        if (!BinaryPrimitives.TryReadInt32BigEndian(header, out count)) {
+                            return 0;
+                        }
+
+                        return count;
+                    }
+
+                    public void Swap(ReadOnlySpan<uint> source, Span<uint> destination) {
+                        BinaryPrimitives.ReverseEndianness(source, destination);
+                    }
+                }
+                """;
+
+            ConversionOutput output = RunConversion(source);
+            string sourceOutput = File.ReadAllText(Path.Combine(output.OutputPath, "VertexSwapper.cpp"));
+
+            Assert.Contains("#include \"system/binary_primitives.hpp\"", sourceOutput);
+            Assert.Contains("BinaryPrimitives::TryReadInt32BigEndian(header, ", sourceOutput);
+            Assert.DoesNotContain("header.Data", sourceOutput, StringComparison.Ordinal);
+            Assert.Contains("BinaryPrimitives::ReverseEndianness(source, destination)", sourceOutput);
+            AssertRuntimeRequirement(output.Report, "BinaryPrimitives");
+        }
+
+        /// <summary>
+        /// Ensures span extension calls such as IndexOf lower to the vectorized runtime MemoryExtensions header.
+        /// </summary>
+        [Fact]
+        public void WriteOutput_WithMemoryExtensionsUsage_UsesRuntimeMemoryExtensionsHeader() {
+            string source = """
+                using System;
+
+                public class PacketScanner {
+                    public int FindTerminator(ReadOnlySpan<byte> packet) {
+                        return packet.IndexOf((byte)10);
+                    }
+
+                    public bool Matches(ReadOnlySpan<byte> packet, ReadOnlySpan<byte> expected) {
+                        return packet.SequenceEqual(expected);
+                    }
+                }
+                """;
+
+            ConversionOutput output = RunConversion(source);
+            string header = File.ReadAllText(Path.Combine(output.OutputPath, "PacketScanner.hpp"));
+            string sourceOutput = File.ReadAllText(Path.Combine(output.OutputPath, "PacketScanner.cpp"));
+
+            Assert.DoesNotContain("#include \"MemoryExtensions.hpp\"", header, StringComparison.Ordinal);
+            Assert.Contains("#include \"system/memory_extensions.hpp\"", sourceOutput);
+            Assert.Contains("MemoryExtensions::IndexOf(packet, ", sourceOutput);
+            Assert.Contains("MemoryExtensions::SequenceEqual(packet, expected)", sourceOutput);
+            AssertRuntimeRequirement(output.Report, "MemoryExtensions");
+            Assert.True(File.Exists(Path.Combine(output.OutputPath, "system", "memory_extensions.hpp")));
+        }
+
         /// <summary>
         /// Ensures managed argument and operation exceptions resolve through the lightweight runtime exception header.
         /// </summary>
@@ -1117,6 +1348,36 @@ namespace cs2.cpp.tests {
             Assert.True(File.Exists(Path.Combine(output.OutputPath, "system", "io", "stream-reader.hpp")));
         }
 
+        /// <summary>
+        /// Ensures StreamReader.ReadLine declarations lower to the nullable runtime line wrapper shared with StringReader.
+        /// </summary>
+        [Fact]
+        public void WriteOutput_WithSystemIoStreamReaderReadLine_UsesRuntimeLineWrapper() {
+            string source = """
+                using System.IO;
+
+                public static class LineGate {
+                    public static int CountLines(Stream stream) {
+                        using StreamReader reader = new StreamReader(stream);
+                        int count = 0;
+                        string line = reader.ReadLine();
+                        while (line != null) {
+                            count++;
+                            line = reader.ReadLine();
+                        }
+
+                        return count;
+                    }
+                }
+                """;
+
+            ConversionOutput output = RunConversion(source);
+
+            Assert.Contains("StreamReader *reader = new StreamReader(stream);", output.GeneratedText);
+            Assert.Contains("StringReaderLine line = reader->ReadLine();", output.GeneratedText);
+            AssertRuntimeRequirement(output.Report, "StreamReader");
+        }
+
         /// <summary>
         /// Ensures System.Text.RegularExpressions usage resolves to the lightweight runtime regex header instead of synthetic generated headers.
         /// </summary>
@@ -1238,7 +1499,7 @@ namespace cs2.cpp.tests {
 
             Assert.Contains("#include \"runtime/native_event.hpp\"", header);
             Assert.DoesNotContain("#include \"Event.hpp\"", header, StringComparison.Ordinal);
-            Assert.Contains("::Event CursorEvent", output.GeneratedText);
+            Assert.Contains("::Event<int32_t, int32_t, int32_t> CursorEvent", output.GeneratedText);
         AssertRuntimeRequirement(output.Report, "NativeEvent");
         Assert.True(File.Exists(Path.Combine(output.OutputPath, "runtime", "native_event.hpp")));
     }
@@ -1274,8 +1535,8 @@ namespace cs2.cpp.tests {
         ConversionOutput output = RunConversion(source);
         string sourceText = File.ReadAllText(Path.Combine(output.OutputPath, "NintendoDsReturnOverlayComponent.cpp"));
 
-        Assert.Contains("CursorEvent += Event::Bind(this, static_cast<void (NintendoDsReturnOverlayComponent::*)(int32_t, int32_t, int32_t)>(&NintendoDsReturnOverlayComponent::HandleCursorEvent))", sourceText, StringComparison.Ordinal);
-        Assert.Contains("CursorEvent -= Event::Bind(this, static_cast<void (NintendoDsReturnOverlayComponent::*)(int32_t, int32_t, int32_t)>(&NintendoDsReturnOverlayComponent::HandleCursorEvent))", sourceText, StringComparison.Ordinal);
+        Assert.Contains("CursorEvent += BindEventHandler<static_cast<void (NintendoDsReturnOverlayComponent::*)(int32_t, int32_t, int32_t)>(&NintendoDsReturnOverlayComponent::HandleCursorEvent)>(this)", sourceText, StringComparison.Ordinal);
+        Assert.Contains("CursorEvent -= BindEventHandler<static_cast<void (NintendoDsReturnOverlayComponent::*)(int32_t, int32_t, int32_t)>(&NintendoDsReturnOverlayComponent::HandleCursorEvent)>(this)", sourceText, StringComparison.Ordinal);
     }
 
     /// <summary>
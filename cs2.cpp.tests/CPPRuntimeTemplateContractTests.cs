@@ -373,7 +373,7 @@ public sealed class CPPRuntimeTemplateContractTests {
     }
 
     /// <summary>
-    /// Verifies the native event runtime stores and invokes free or static subscribers instead of discarding all event traffic.
+    /// Verifies the native event runtime is typed by the delegate signature and stores subscribers contiguously without argument marshalling.
     /// </summary>
     [Fact]
     public void RuntimeTemplates_native_event_invokes_static_subscribers() {
@@ -386,15 +386,17 @@ public sealed class CPPRuntimeTemplateContractTests {
 
         string source = File.ReadAllText(templatePath);
 
-        Assert.Contains("std::vector<std::unique_ptr<Subscriber>> Subscribers", source, StringComparison.Ordinal);
-        Assert.DoesNotContain("std::vector<Subscriber> Subscribers", source, StringComparison.Ordinal);
-        Assert.Contains("Event& operator+=(void (*handler)(TArgs...))", source, StringComparison.Ordinal);
-        Assert.Contains("std::array<void*, sizeof...(TArgs)> argumentPointers", source, StringComparison.Ordinal);
-        Assert.Contains("subscriber->Invoke(argumentPointers.data());", source, StringComparison.Ordinal);
+        Assert.Contains("template <typename... TArgs>\nclass Event {", source, StringComparison.Ordinal);
+        Assert.Contains("std::vector<Subscriber> Subscribers", source, StringComparison.Ordinal);
+        Assert.DoesNotContain("std::unique_ptr<Subscriber>", source, StringComparison.Ordinal);
+        Assert.Contains("Event& operator+=(void (*handler)(THandlerArgs...))", source, StringComparison.Ordinal);
+        Assert.Contains("thunk(target, args...);", source, StringComparison.Ordinal);
+        Assert.DoesNotContain("argumentPointers", source, StringComparison.Ordinal);
+        Assert.DoesNotContain("std::function", source, StringComparison.Ordinal);
     }
 
     /// <summary>
-    /// Verifies the native event runtime declares an explicit bound-instance helper instead of silently discarding member-method subscriptions.
+    /// Verifies the native event runtime binds instance methods explicitly and stores or rejects other handler shapes instead of silently discarding them.
     /// </summary>
     [Fact]
     public void RuntimeTemplates_native_event_declares_bound_instance_subscription_support() {
@@ -407,9 +409,13 @@ public sealed class CPPRuntimeTemplateContractTests {
 
         string source = File.ReadAllText(templatePath);
 
-        Assert.Contains("static auto Bind(TInstance* instance, void (TInstance::*method)(TArgs...))", source, StringComparison.Ordinal);
-        Assert.Contains("Event& operator+=(BoundHandler<TInstance, TArgs...> handler)", source, StringComparison.Ordinal);
-        Assert.Contains("Event& operator-=(BoundHandler<TInstance, TArgs...> handler)", source, StringComparison.Ordinal);
+        Assert.Contains("EventHandlerBinding<TInstance, Method> BindEventHandler(TInstance* instance)", source, StringComparison.Ordinal);
+        Assert.Contains("Event& operator+=(EventHandlerBinding<TInstance, Method> handler)", source, StringComparison.Ordinal);
+        Assert.Contains("Event& operator-=(EventHandlerBinding<TInstance, Method> handler)", source, StringComparison.Ordinal);
+        Assert.Contains("Add(MakeCallableSubscriber(std::move(handler)));", source, StringComparison.Ordinal);
+        Assert.Contains("Add(MakeCallablePointerSubscriber(handler));", source, StringComparison.Ordinal);
+        Assert.Contains("\"Event handlers must be functions, bound methods, or callables that accept the event arguments.\"", source, StringComparison.Ordinal);
+        Assert.DoesNotContain("Accepts unsupported subscriber shapes", source, StringComparison.Ordinal);
     }
 
     /// <summary>
@@ -480,6 +486,578 @@ public sealed class CPPRuntimeTemplateContractTests {
         Assert.Contains("customStream->ownsMemoryBuffer = false;", source, StringComparison.Ordinal);
     }
 
+    /// <summary>
+    /// Verifies the I/O scheduler runtime template serves reads off-thread with an io_uring opt-in and a synchronous retro fallback.
+    /// </summary>
+    [Fact]
+    public void RuntimeTemplates_io_scheduler_owns_background_read_backends() {
+        string templatePath = Path.Combine(
+            ResolveRepositoryRootPath(),
+            "cs2.cpp",
+            ".net.cpp",
+            "system",
+            "io",
+            "io-scheduler.hpp");
+
+        string source = File.ReadAllText(templatePath);
+
+        Assert.Contains("#define HE_CPP_IO_SCHEDULER_THREADED 0", source, StringComparison.Ordinal);
+        Assert.Contains("defined(HE_CPP_RUNTIME_USE_IO_URING)", source, StringComparison.Ordinal);
+        Assert.Contains("io_uring_prep_read(", source, StringComparison.Ordinal);
+        Assert.Contains("pread(", source, StringComparison.Ordinal);
+        Assert.Contains("std::shared_ptr<IoReadOperation> ReadAsync(int64_t fileOffset, Array<uint8_t>* buffer, int32_t offset, int32_t count, Action<int32_t>* completion = nullptr)", source, StringComparison.Ordinal);
+        Assert.Contains("int32_t DispatchCompletions()", source, StringComparison.Ordinal);
+    }
+
+    /// <summary>
+    /// Verifies the read-ahead stream runtime template double-buffers sequential reads through the I/O scheduler.
+    /// </summary>
+    [Fact]
+    public void RuntimeTemplates_read_ahead_stream_double_buffers_sequential_reads() {
+        string templatePath = Path.Combine(
+            ResolveRepositoryRootPath(),
+            "cs2.cpp",
+            ".net.cpp",
+            "system",
+            "io",
+            "read-ahead-stream.hpp");
+
+        string source = File.ReadAllText(templatePath);
+
+        Assert.Contains("class ReadAheadStream : public Stream", source, StringComparison.Ordinal);
+        Assert.Contains("Block blocks[2];", source, StringComparison.Ordinal);
+        Assert.Contains("Prefetch(active, next.FileOffset + blockSize);", source, StringComparison.Ordinal);
+    }
+
+    /// <summary>
+    /// Verifies the pack file-system runtime template satisfies the custom native file-system contract with a hashed archive index.
+    /// </summary>
+    [Fact]
+    public void RuntimeTemplates_pack_file_system_serves_indexed_archive_views() {
+        string runtimeRootPath = Path.Combine(ResolveRepositoryRootPath(), "cs2.cpp", ".net.cpp", "system", "io");
+
+        string header = File.ReadAllText(Path.Combine(runtimeRootPath, "pack-file-system.hpp"));
+        string source = File.ReadAllText(Path.Combine(runtimeRootPath, "pack-file-system.cpp"));
+
+        Assert.Contains("static bool CanHandlePath(const char* path);", header, StringComparison.Ordinal);
+        Assert.Contains("static bool Exists(const char* path);", header, StringComparison.Ordinal);
+        Assert.Contains("static bool DirectoryExists(const char* path);", header, StringComparison.Ordinal);
+        Assert.Contains("static FileStream* OpenRead(const char* path);", header, StringComparison.Ordinal);
+        Assert.Contains("std::lower_bound(entries.begin(), entries.end(), pathHash", source, StringComparison.Ordinal);
+        Assert.Contains("return new FileStream(file, static_cast<size_t>(entry.DataOffset), entry.OriginalSize);", source, StringComparison.Ordinal);
+        Assert.Contains("payloadSize > static_cast<uint64_t>(archiveLength) - entry.DataOffset", source, StringComparison.Ordinal);
+
+        string fileStreamSource = File.ReadAllText(Path.Combine(runtimeRootPath, "file-stream.cpp"));
+        Assert.Contains("FileStreamReadAt(file, windowOffset + position, buffer.Data, count)", fileStreamSource, StringComparison.Ordinal);
+        Assert.Contains("pread(", fileStreamSource, StringComparison.Ordinal);
+    }
+
+    /// <summary>
+    /// Verifies the directory runtime template defers to custom native file systems that expose directory lookups.
+    /// </summary>
+    [Fact]
+    public void RuntimeTemplates_directory_runtime_defers_to_custom_file_system_directory_lookup() {
+        string templatePath = Path.Combine(
+            ResolveRepositoryRootPath(),
+            "cs2.cpp",
+            ".net.cpp",
+            "system",
+            "io",
+            "directory.cpp");
+
+        string source = File.ReadAllText(templatePath);
+
+        Assert.Contains("#include HE_CPP_RUNTIME_CUSTOM_FILE_SYSTEM_HEADER", source, StringComparison.Ordinal);
+        Assert.Contains("if constexpr (CustomFileSystemHasDirectoryExists<HE_CPP_RUNTIME_CUSTOM_FILE_SYSTEM_TYPE>::value)", source, StringComparison.Ordinal);
+        Assert.Contains("return HE_CPP_RUNTIME_CUSTOM_FILE_SYSTEM_TYPE::DirectoryExists(path.c_str());", source, StringComparison.Ordinal);
+    }
+
+    /// <summary>
+    /// Verifies the Deflate stream runtime template compresses bounded chunks in parallel and emits them in order.
+    /// </summary>
+    [Fact]
+    public void RuntimeTemplates_deflate_stream_compresses_bounded_chunks_in_parallel() {
+        string runtimeRootPath = Path.Combine(ResolveRepositoryRootPath(), "cs2.cpp", ".net.cpp", "system", "io", "compression");
+
+        string codecHeader = File.ReadAllText(Path.Combine(runtimeRootPath, "deflate-codec.hpp"));
+        string streamSource = File.ReadAllText(Path.Combine(runtimeRootPath, "deflate-stream.cpp"));
+        string gzipHeader = File.ReadAllText(Path.Combine(runtimeRootPath, "gzip-stream.hpp"));
+
+        Assert.Contains("static constexpr size_t ChunkSize = 128 * 1024;", codecHeader, StringComparison.Ordinal);
+        Assert.Contains("static constexpr size_t WindowSize = 32 * 1024;", codecHeader, StringComparison.Ordinal);
+        Assert.Contains("CompressionJobs::Run(chunkCount, maxDegreeOfParallelism,", streamSource, StringComparison.Ordinal);
+        Assert.Contains("DeflateEncoder::AppendFinalBlock(finalBlock);", streamSource, StringComparison.Ordinal);
+        Assert.Contains("class GZipStream : public DeflateStream", gzipHeader, StringComparison.Ordinal);
+    }
+
+    /// <summary>
+    /// Verifies the LZ4 stream runtime template writes independent 64 KB frame blocks and stores incompressible blocks raw.
+    /// </summary>
+    [Fact]
+    public void RuntimeTemplates_lz4_stream_writes_independent_frame_blocks() {
+        string runtimeRootPath = Path.Combine(ResolveRepositoryRootPath(), "cs2.cpp", ".net.cpp", "system", "io", "compression");
+
+        string header = File.ReadAllText(Path.Combine(runtimeRootPath, "lz4-stream.hpp"));
+        string source = File.ReadAllText(Path.Combine(runtimeRootPath, "lz4-stream.cpp"));
+
+        Assert.Contains("static constexpr size_t BlockSize = 64 * 1024;", header, StringComparison.Ordinal);
+        Assert.Contains("const uint8_t Lz4FrameMagic[4] = { 0x04, 0x22, 0x4D, 0x18 };", source, StringComparison.Ordinal);
+        Assert.Contains("header = static_cast<uint32_t>(blockLength) | Lz4UncompressedBlockFlag;", source, StringComparison.Ordinal);
+        Assert.Contains("CompressionJobs::Run(blockCount, maxDegreeOfParallelism,", source, StringComparison.Ordinal);
+    }
+
+    /// <summary>
+    /// Verifies the stream runtime template makes span overloads the virtual primitives and copies through a reused buffer.
+    /// </summary>
+    [Fact]
+    public void RuntimeTemplates_stream_copy_reuses_buffer_and_fast_paths_file_copies() {
+        string runtimeRootPath = Path.Combine(ResolveRepositoryRootPath(), "cs2.cpp", ".net.cpp", "system", "io");
+
+        string streamHeader = File.ReadAllText(Path.Combine(runtimeRootPath, "stream.hpp"));
+        string memoryStreamSource = File.ReadAllText(Path.Combine(runtimeRootPath, "memory-stream.cpp"));
+        string fileStreamSource = File.ReadAllText(Path.Combine(runtimeRootPath, "file-stream.cpp"));
+
+        Assert.Contains("virtual size_t Read(Span<uint8_t> buffer) = 0;", streamHeader, StringComparison.Ordinal);
+        Assert.Contains("virtual void Write(ReadOnlySpan<uint8_t> buffer) = 0;", streamHeader, StringComparison.Ordinal);
+        Assert.DoesNotContain("virtual size_t Read(uint8_t* buffer, size_t offset, size_t count)", streamHeader, StringComparison.Ordinal);
+        Assert.DoesNotContain("virtual size_t Read(Array<uint8_t>* buffer, size_t offset, size_t count)", streamHeader, StringComparison.Ordinal);
+        Assert.DoesNotContain("Array<uint8_t> buffer(81920);", streamHeader, StringComparison.Ordinal);
+        Assert.Contains("static thread_local SharedBuffer buffer;", streamHeader, StringComparison.Ordinal);
+        Assert.Contains("destination->Write(buffer.data(), start, buffer.size() - start);", memoryStreamSource, StringComparison.Ordinal);
+        Assert.Contains("copy_file_range(sourceDescriptor, &sourceCursor, destinationDescriptor, &destinationCursor, remaining, 0);", fileStreamSource, StringComparison.Ordinal);
+        Assert.Contains("sendfile(destinationDescriptor, sourceDescriptor, &sourceCursor, remaining);", fileStreamSource, StringComparison.Ordinal);
+    }
+
+    /// <summary>
+    /// Verifies the stream reader runtime template reads lines from a large refill buffer with vectorized newline scans.
+    /// </summary>
+    [Fact]
+    public void RuntimeTemplates_stream_reader_buffers_lines_and_scans_newlines_in_blocks() {
+        string runtimeRootPath = Path.Combine(ResolveRepositoryRootPath(), "cs2.cpp", ".net.cpp", "system", "io");
+
+        string streamReaderHeader = File.ReadAllText(Path.Combine(runtimeRootPath, "stream-reader.hpp"));
+        string stringReaderHeader = File.ReadAllText(Path.Combine(runtimeRootPath, "string-reader.hpp"));
+
+        Assert.Contains("static constexpr size_t DefaultBufferSize = 64 * 1024;", streamReaderHeader, StringComparison.Ordinal);
+        Assert.Contains("bool ReadLine(std::string_view& line) {", streamReaderHeader, StringComparison.Ordinal);
+        Assert.Contains("StringReaderLine ReadLine() {", streamReaderHeader, StringComparison.Ordinal);
+        Assert.Contains("int32_t ReadBlock(Array<char>* destination, int32_t index, int32_t count) {", streamReaderHeader, StringComparison.Ordinal);
+        Assert.Contains("int32_t Peek() {", streamReaderHeader, StringComparison.Ordinal);
+        Assert.Contains("breakPosition = bufferStart + lineOffset;", streamReaderHeader, StringComparison.Ordinal);
+        Assert.Contains("TextEncoding::Utf16LittleEndian", streamReaderHeader, StringComparison.Ordinal);
+        Assert.DoesNotContain("uint8_t buffer[4096];", streamReaderHeader, StringComparison.Ordinal);
+        Assert.Contains("_mm_movemask_epi8(", stringReaderHeader, StringComparison.Ordinal);
+        Assert.Contains("bool ReadLine(std::string_view& line) {", stringReaderHeader, StringComparison.Ordinal);
+        Assert.DoesNotContain("source.substr(", stringReaderHeader, StringComparison.Ordinal);
+    }
+
+    /// <summary>
+    /// Verifies delegate runtime templates store callables inline instead of wrapping std::function.
+    /// </summary>
+    [Fact]
+    public void RuntimeTemplates_delegates_store_bound_methods_inline_without_std_function() {
+        string runtimeRootPath = Path.Combine(ResolveRepositoryRootPath(), "cs2.cpp", ".net.cpp", "system");
+
+        string inlineDelegateHeader = File.ReadAllText(Path.Combine(runtimeRootPath, "inline_delegate.hpp"));
+        string actionHeader = File.ReadAllText(Path.Combine(runtimeRootPath, "action.hpp"));
+        string funcHeader = File.ReadAllText(Path.Combine(runtimeRootPath, "func.hpp"));
+        string delegateHeader = File.ReadAllText(Path.Combine(runtimeRootPath, "delegate.hpp"));
+
+        Assert.Contains("#define HE_CPP_INLINE_DELEGATE_CAPTURE_SIZE (4 * sizeof(void*))", inlineDelegateHeader, StringComparison.Ordinal);
+        Assert.Contains("InlineDelegate(TReceiver receiver, TMethod method)", inlineDelegateHeader, StringComparison.Ordinal);
+        Assert.Contains("std::is_trivially_copyable_v<TCallable>", inlineDelegateHeader, StringComparison.Ordinal);
+        Assert.Contains("std::memcmp(storage, other.storage, comparableSize) == 0", inlineDelegateHeader, StringComparison.Ordinal);
+        Assert.Contains("using FuncType = InlineDelegate<void(TArgs...)>;", actionHeader, StringComparison.Ordinal);
+        Assert.Contains("using FuncType = InlineDelegate<TResult(TArgs...)>;", delegateHeader, StringComparison.Ordinal);
+        Assert.DoesNotContain("std::function", actionHeader, StringComparison.Ordinal);
+        Assert.DoesNotContain("std::function", funcHeader, StringComparison.Ordinal);
+        Assert.DoesNotContain("std::function", delegateHeader, StringComparison.Ordinal);
+    }
+
+    /// <summary>
+    /// Verifies native events tombstone subscribers removed during dispatch and compact after the outermost dispatch instead of erasing mid-iteration.
+    /// </summary>
+    [Fact]
+    public void RuntimeTemplates_native_event_defers_removal_during_dispatch() {
+        string templatePath = Path.Combine(
+            ResolveRepositoryRootPath(),
+            "cs2.cpp",
+            ".net.cpp",
+            "runtime",
+            "native_event.hpp");
+
+        string source = File.ReadAllText(templatePath);
+
+        Assert.Contains("const size_t dispatchCount = Subscribers.size();", source, StringComparison.Ordinal);
+        Assert.Contains("if (subscriber.RemovedGeneration > dispatchGeneration) {", source, StringComparison.Ordinal);
+        Assert.Contains("subscriber.RemovedGeneration = Generation;", source, StringComparison.Ordinal);
+        Assert.Contains("if (--Owner.DispatchDepth == 0 && Owner.RemovedCount != 0) {", source, StringComparison.Ordinal);
+        Assert.DoesNotContain("std::vector<Subscriber> snapshot", source, StringComparison.Ordinal);
+    }
+
+    /// <summary>
+    /// Verifies delegates keep an immutable shared invocation list and expose combine, remove, and invocation-list operations.
+    /// </summary>
+    [Fact]
+    public void RuntimeTemplates_delegates_share_multicast_invocation_lists() {
+        string runtimeRootPath = Path.Combine(ResolveRepositoryRootPath(), "cs2.cpp", ".net.cpp", "system");
+
+        string invocationListHeader = File.ReadAllText(Path.Combine(runtimeRootPath, "invocation_list.hpp"));
+        string multicastHeader = File.ReadAllText(Path.Combine(runtimeRootPath, "multicast_delegate.hpp"));
+        string actionHeader = File.ReadAllText(Path.Combine(runtimeRootPath, "action.hpp"));
+        string delegateHeader = File.ReadAllText(Path.Combine(runtimeRootPath, "delegate.hpp"));
+
+        Assert.Contains("static InvocationList Combine(const InvocationList& first, const InvocationList& second)", invocationListHeader, StringComparison.Ordinal);
+        Assert.Contains("first.block->Used.compare_exchange_strong(expected, total, std::memory_order_acq_rel)", invocationListHeader, StringComparison.Ordinal);
+        Assert.Contains("static InvocationList Remove(const InvocationList& source, const InvocationList& value)", invocationListHeader, StringComparison.Ordinal);
+        Assert.Contains("static TDelegate* Combine(TDelegate* first, typename Identity<TDelegate>::Type* second)", multicastHeader, StringComparison.Ordinal);
+        Assert.Contains("static TDelegate* Remove(TDelegate* source, typename Identity<TDelegate>::Type* value)", multicastHeader, StringComparison.Ordinal);
+        Assert.Contains("static Array<TDelegate*>* GetInvocationList(const TDelegate* value)", multicastHeader, StringComparison.Ordinal);
+        Assert.Contains("InvocationListType targets{};", actionHeader, StringComparison.Ordinal);
+        Assert.Contains("InvocationListType targets{};", delegateHeader, StringComparison.Ordinal);
+    }
+
+    /// <summary>
+    /// Verifies Task and Parallel run on the work-stealing pool and that the worker count can be fixed, including zero.
+    /// </summary>
+    [Fact]
+    public void RuntimeTemplates_thread_pool_schedules_tasks_through_work_stealing_deques() {
+        string threadingRootPath = Path.Combine(ResolveRepositoryRootPath(), "cs2.cpp", ".net.cpp", "system", "threading");
+
+        string dequeHeader = File.ReadAllText(Path.Combine(threadingRootPath, "work_stealing_deque.hpp"));
+        string poolHeader = File.ReadAllText(Path.Combine(threadingRootPath, "thread_pool.hpp"));
+        string taskHeader = File.ReadAllText(Path.Combine(threadingRootPath, "tasks", "task.hpp"));
+        string parallelHeader = File.ReadAllText(Path.Combine(threadingRootPath, "tasks", "parallel.hpp"));
+
+        Assert.Contains("bool TrySteal(T& value)", dequeHeader, StringComparison.Ordinal);
+        Assert.Contains("WorkStealingDeque<ThreadPoolWorkItem*> Deque;", poolHeader, StringComparison.Ordinal);
+        Assert.Contains("#define HE_CPP_THREAD_POOL_WORKER_COUNT -1", poolHeader, StringComparison.Ordinal);
+        Assert.Contains("class Task : protected ThreadPoolWorkItem", taskHeader, StringComparison.Ordinal);
+        Assert.Contains("class Task_1 : public Task", taskHeader, StringComparison.Ordinal);
+        Assert.Contains("static Task* WhenAll(Array<Task*>* tasks);", taskHeader, StringComparison.Ordinal);
+        Assert.Contains("static Task_1<Task*>* WhenAny(Array<Task*>* tasks);", taskHeader, StringComparison.Ordinal);
+        Assert.Contains("const int64_t start = Next.fetch_add(Chunk, std::memory_order_relaxed);", parallelHeader, StringComparison.Ordinal);
+        Assert.Contains("std::lock_guard<std::mutex> guard(PendingMutex);", parallelHeader, StringComparison.Ordinal);
+        Assert.DoesNotContain("state->Pending.notify_all();", parallelHeader, StringComparison.Ordinal);
+    }
+
+    /// <summary>
+    /// Ensures the io_uring backend resubmits short and interrupted reads so it returns the same counts as the positional fallback.
+    /// </summary>
+    [Fact]
+    public void RuntimeTemplates_io_scheduler_resubmits_short_ring_reads() {
+        string runtimeRootPath = Path.Combine(ResolveRepositoryRootPath(), "cs2.cpp", ".net.cpp", "system");
+        string ioSchedulerHeader = File.ReadAllText(Path.Combine(runtimeRootPath, "io", "io-scheduler.hpp"));
+
+        Assert.Contains("bool PrepareRingRead(RingRead* read)", ioSchedulerHeader, StringComparison.Ordinal);
+        Assert.Contains("result == -EINTR || result == -EAGAIN", ioSchedulerHeader, StringComparison.Ordinal);
+        Assert.Contains("errno == EINTR || errno == EAGAIN", ioSchedulerHeader, StringComparison.Ordinal);
+        Assert.DoesNotContain("completionEntry->res < 0 ? 0 : completionEntry->res", ioSchedulerHeader, StringComparison.Ordinal);
+    }
+
+    /// <summary>
+    /// Ensures async methods lower onto coroutines whose frames come from the pooled allocator and whose awaits resume on the pool.
+    /// </summary>
+    [Fact]
+    public void RuntimeTemplates_task_coroutines_use_pooled_frames_and_pool_resumption() {
+        string runtimeRootPath = Path.Combine(ResolveRepositoryRootPath(), "cs2.cpp", ".net.cpp", "system");
+
+        string coroutineHeader = File.ReadAllText(Path.Combine(runtimeRootPath, "threading", "tasks", "task_coroutine.hpp"));
+        string allocatorHeader = File.ReadAllText(Path.Combine(runtimeRootPath, "threading", "tasks", "coroutine_frame_allocator.hpp"));
+        string taskHeader = File.ReadAllText(Path.Combine(runtimeRootPath, "threading", "tasks", "task.hpp"));
+        string ioSchedulerHeader = File.ReadAllText(Path.Combine(runtimeRootPath, "io", "io-scheduler.hpp"));
+
+        Assert.Contains("struct coroutine_traits<Task*, TArgs...>", coroutineHeader, StringComparison.Ordinal);
+        Assert.Contains("struct coroutine_traits<Task_1<TResult>*, TArgs...>", coroutineHeader, StringComparison.Ordinal);
+        Assert.Contains("return CoroutineFrameAllocator::Allocate(size);", coroutineHeader, StringComparison.Ordinal);
+        Assert.Contains("ThreadPool::Schedule(static_cast<TaskAwaiter*>(node));", coroutineHeader, StringComparison.Ordinal);
+        Assert.Contains("class AsyncVoidMethod", coroutineHeader, StringComparison.Ordinal);
+        Assert.Contains("static AsyncVoidDriver Drive(TBody body)", coroutineHeader, StringComparison.Ordinal);
+        Assert.Contains("delete task;", coroutineHeader, StringComparison.Ordinal);
+        Assert.Contains("co_await CompletionAwaiter(task);", coroutineHeader, StringComparison.Ordinal);
+        Assert.DoesNotContain("co_await TaskAwaiter<Task>(task);", coroutineHeader, StringComparison.Ordinal);
+        Assert.Contains("System::Diagnostics::Stopwatch clock;", taskHeader, StringComparison.Ordinal);
+        Assert.Contains("static thread_local ThreadCache cache;", allocatorHeader, StringComparison.Ordinal);
+        Assert.Contains("#include \"system/threading/tasks/task_coroutine.hpp\"", taskHeader, StringComparison.Ordinal);
+        Assert.Contains("bool TryAddContinuation(TaskContinuation* continuation)", taskHeader, StringComparison.Ordinal);
+        Assert.Contains("inline IoReadAwaiter operator co_await(std::shared_ptr<IoReadOperation> operation)", ioSchedulerHeader, StringComparison.Ordinal);
+    }
+
+    /// <summary>
+    /// Ensures the concurrent collections keep lock-free, epoch-reclaimed reads and segment-based queues instead of spin locks.
+    /// </summary>
+    [Fact]
+    public void RuntimeTemplates_concurrent_collections_use_lock_free_reads_and_ring_segments() {
+        string runtimeRootPath = Path.Combine(ResolveRepositoryRootPath(), "cs2.cpp", ".net.cpp", "system");
+        string concurrentRootPath = Path.Combine(runtimeRootPath, "collections", "concurrent");
+
+        string dictionaryHeader = File.ReadAllText(Path.Combine(concurrentRootPath, "concurrent_dictionary.hpp"));
+        string queueHeader = File.ReadAllText(Path.Combine(concurrentRootPath, "concurrent_queue.hpp"));
+        string bagHeader = File.ReadAllText(Path.Combine(concurrentRootPath, "concurrent_bag.hpp"));
+        string reclamationHeader = File.ReadAllText(Path.Combine(runtimeRootPath, "threading", "epoch_reclamation.hpp"));
+
+        Assert.Contains("bool TryGetValue(const TKey& key, TValue& value) const {\n        EpochReclamation::Guard guard;", dictionaryHeader.Replace("\r\n", "\n"), StringComparison.Ordinal);
+        Assert.Contains("EpochReclamation::Retire(removed);", dictionaryHeader, StringComparison.Ordinal);
+        Assert.Contains("TValue GetOrAdd(const TKey& key, TFactory valueFactory)", dictionaryHeader, StringComparison.Ordinal);
+        Assert.Contains("TValue AddOrUpdate(const TKey& key, const TValue& addValue, TUpdateFactory updateValueFactory)", dictionaryHeader, StringComparison.Ordinal);
+        Assert.Contains("Tail.fetch_add(FreezeOffset", queueHeader, StringComparison.Ordinal);
+        Assert.Contains("EpochReclamation::Retire(drained);", queueHeader, StringComparison.Ordinal);
+        Assert.Contains("static thread_local LocalListCache cache;", bagHeader, StringComparison.Ordinal);
+        Assert.Contains("static thread_local RecordOwner owner;", reclamationHeader, StringComparison.Ordinal);
+        Assert.DoesNotContain("SpinLock", dictionaryHeader + queueHeader + bagHeader, StringComparison.Ordinal);
+    }
+
+    /// <summary>
+    /// Ensures SpinLock spins with test-and-test-and-set and backoff before parking instead of exchanging in a bare loop.
+    /// </summary>
+    [Fact]
+    public void RuntimeTemplates_spin_lock_backs_off_and_parks_under_contention() {
+        string spinLockHeader = File.ReadAllText(Path.Combine(ResolveRepositoryRootPath(), "cs2.cpp", ".net.cpp", "system", "threading", "spin_lock.hpp"));
+
+        Assert.Contains("return !Locked.load(std::memory_order_relaxed) && !Locked.exchange(true, std::memory_order_acquire);", spinLockHeader, StringComparison.Ordinal);
+        Assert.Contains("_mm_pause();", spinLockHeader, StringComparison.Ordinal);
+        Assert.Contains("std::this_thread::yield();", spinLockHeader, StringComparison.Ordinal);
+        Assert.Contains("Locked.wait(true, std::memory_order_relaxed);", spinLockHeader, StringComparison.Ordinal);
+        Assert.Contains("Locked.notify_one();", spinLockHeader, StringComparison.Ordinal);
+        Assert.Contains("SpinLockStatistics GetStatistics() const", spinLockHeader, StringComparison.Ordinal);
+        Assert.Contains("$GENERATED_FUNCTION_PROFILING_SPIN_LOCK_FIELD$", spinLockHeader, StringComparison.Ordinal);
+        Assert.Contains("$GENERATED_FUNCTION_PROFILING_SPIN_LOCK_AFTER_CONTENDED_ENTER$", spinLockHeader, StringComparison.Ordinal);
+        Assert.DoesNotContain("while (Locked.exchange(true, std::memory_order_acquire)) {", spinLockHeader, StringComparison.Ordinal);
+    }
+
+    /// <summary>
+    /// Ensures the threading primitives park on futex words after a bounded spin instead of condition-variable round trips.
+    /// </summary>
+    [Fact]
+    public void RuntimeTemplates_threading_primitives_spin_then_park_on_futex_words() {
+        string threadingRoot = Path.Combine(ResolveRepositoryRootPath(), "cs2.cpp", ".net.cpp", "system", "threading");
+        string futexHeader = File.ReadAllText(Path.Combine(threadingRoot, "futex.hpp"));
+        string autoResetEventHeader = File.ReadAllText(Path.Combine(threadingRoot, "auto_reset_event.hpp"));
+        string manualResetEventHeader = File.ReadAllText(Path.Combine(threadingRoot, "manual_reset_event_slim.hpp"));
+        string semaphoreHeader = File.ReadAllText(Path.Combine(threadingRoot, "semaphore_slim.hpp"));
+        string readerWriterHeader = File.ReadAllText(Path.Combine(threadingRoot, "reader_writer_lock_slim.hpp"));
+        string monitorHeader = File.ReadAllText(Path.Combine(threadingRoot, "monitor.hpp"));
+
+        Assert.Contains("FUTEX_WAIT_PRIVATE", futexHeader, StringComparison.Ordinal);
+        Assert.Contains("FUTEX_WAKE_PRIVATE", futexHeader, StringComparison.Ordinal);
+        Assert.Contains("#define HE_CPP_FUTEX_SPIN_COUNT 35", futexHeader, StringComparison.Ordinal);
+        Assert.Contains("bool WaitOne(int32_t millisecondsTimeout) {", autoResetEventHeader, StringComparison.Ordinal);
+        Assert.Contains("bool Reset() {", autoResetEventHeader, StringComparison.Ordinal);
+        Assert.DoesNotContain("std::condition_variable", autoResetEventHeader, StringComparison.Ordinal);
+        Assert.Contains("Futex::WakeAll(signaled);", manualResetEventHeader, StringComparison.Ordinal);
+        Assert.Contains("Futex::SpinPause(iteration);", manualResetEventHeader, StringComparison.Ordinal);
+        Assert.Contains("Task* WaitAsync() {", semaphoreHeader, StringComparison.Ordinal);
+        Assert.Contains("throw SemaphoreFullException(", semaphoreHeader, StringComparison.Ordinal);
+        Assert.Contains("bool TryEnterWriteLock(int32_t millisecondsTimeout) {", readerWriterHeader, StringComparison.Ordinal);
+        Assert.Contains("void EnterUpgradeableReadLock() {", readerWriterHeader, StringComparison.Ordinal);
+        Assert.Contains("class MonitorLockScope {", monitorHeader, StringComparison.Ordinal);
+        Assert.Contains("explicit MonitorLockScope(const T&& obj) = delete;", monitorHeader, StringComparison.Ordinal);
+        Assert.Contains("Table().TryRemove(obj);", monitorHeader, StringComparison.Ordinal);
+        Assert.Contains("EpochReclamation::Retire(&lock);", monitorHeader, StringComparison.Ordinal);
+        Assert.Contains("static bool Wait(const void* obj, int32_t millisecondsTimeout) {", monitorHeader, StringComparison.Ordinal);
+        Assert.Contains("static void PulseAll(const void* obj) {", monitorHeader, StringComparison.Ordinal);
+        Assert.Contains("throw SynchronizationLockException(", monitorHeader, StringComparison.Ordinal);
+    }
+
+    /// <summary>
+    /// Ensures ThreadLocal reads go through the per-thread slot table and values are created lazily from the factory.
+    /// </summary>
+    [Fact]
+    public void RuntimeTemplates_thread_local_reads_per_thread_slot_table_without_locking() {
+        string threadLocalHeader = File.ReadAllText(Path.Combine(ResolveRepositoryRootPath(), "cs2.cpp", ".net.cpp", "system", "threading", "thread_local.hpp"));
+
+        Assert.Contains("static thread_local std::vector<Entry> table;", threadLocalHeader, StringComparison.Ordinal);
+        Assert.Contains("if (index < table.size() && table[index].Id == id && table[index].Slot != nullptr) {", threadLocalHeader, StringComparison.Ordinal);
+        Assert.Contains("const T value = (*valueFactory)();", threadLocalHeader, StringComparison.Ordinal);
+        Assert.Contains("std::unique_ptr<Func<T>> ownedValueFactory;", threadLocalHeader, StringComparison.Ordinal);
+        Assert.DoesNotContain(": ThreadLocal(new Func<T>(valueFactory), trackAllValues)", threadLocalHeader, StringComparison.Ordinal);
+        Assert.Contains("List<T>* get_Values() {", threadLocalHeader, StringComparison.Ordinal);
+        Assert.Contains("bool get_IsValueCreated() const {", threadLocalHeader, StringComparison.Ordinal);
+        Assert.Contains("#define HE_CPP_THREAD_LOCAL_THREADED 0", threadLocalHeader, StringComparison.Ordinal);
+    }
+
+    /// <summary>
+    /// Ensures Vector128 and Vector256 keep register-aligned lanes and lower their operators onto SSE and AVX registers.
+    /// </summary>
+    [Fact]
+    public void RuntimeTemplates_vector128_and_vector256_lower_to_sse_and_avx_registers() {
+        string intrinsicsRoot = Path.Combine(ResolveRepositoryRootPath(), "cs2.cpp", ".net.cpp", "system", "runtime", "intrinsics");
+        string vector128Header = File.ReadAllText(Path.Combine(intrinsicsRoot, "vector128.hpp"));
+        string vector256Header = File.ReadAllText(Path.Combine(intrinsicsRoot, "vector256.hpp"));
+        string simdConfigHeader = File.ReadAllText(Path.Combine(intrinsicsRoot, "simd_config.hpp"));
+        string sseLanesHeader = File.ReadAllText(Path.Combine(intrinsicsRoot, "x86", "sse_lanes.hpp"));
+        string avxLanesHeader = File.ReadAllText(Path.Combine(intrinsicsRoot, "x86", "avx_lanes.hpp"));
+
+        Assert.Contains("class alignas(16) Vector128_1", vector128Header, StringComparison.Ordinal);
+        Assert.Contains("class alignas(32) Vector256", vector256Header, StringComparison.Ordinal);
+        Assert.Contains("Vector128Lanes<T>::Supports(VectorLaneOperation::Arithmetic)", vector128Header, StringComparison.Ordinal);
+        Assert.Contains("class Vector256Registers", vector256Header, StringComparison.Ordinal);
+        Assert.Contains("HE_CPP_DISABLE_SIMD", simdConfigHeader, StringComparison.Ordinal);
+        Assert.Contains("#define HE_CPP_SIMD_AVX2", simdConfigHeader, StringComparison.Ordinal);
+        Assert.Contains("return _mm_add_ps(left, right);", sseLanesHeader, StringComparison.Ordinal);
+        Assert.Contains("return _mm256_add_ps(left, right);", avxLanesHeader, StringComparison.Ordinal);
+    }
+
+    /// <summary>
+    /// Ensures Vector&lt;T&gt; is sized by the platform vector width and that AArch64 builds lower the shared lane backend to NEON.
+    /// </summary>
+    [Fact]
+    public void RuntimeTemplates_vector_width_policy_and_neon_backend() {
+        string runtimeRoot = Path.Combine(ResolveRepositoryRootPath(), "cs2.cpp", ".net.cpp", "system");
+        string vectorHeader = File.ReadAllText(Path.Combine(runtimeRoot, "numerics", "vector.hpp"));
+        string simdConfigHeader = File.ReadAllText(Path.Combine(runtimeRoot, "runtime", "intrinsics", "simd_config.hpp"));
+        string vectorLanesHeader = File.ReadAllText(Path.Combine(runtimeRoot, "runtime", "intrinsics", "vector_lanes.hpp"));
+        string neonLanesHeader = File.ReadAllText(Path.Combine(runtimeRoot, "runtime", "intrinsics", "arm", "neon_lanes.hpp"));
+        string advSimdHeader = File.ReadAllText(Path.Combine(runtimeRoot, "runtime", "intrinsics", "arm", "adv_simd.hpp"));
+
+        Assert.Contains("class alignas(HE_CPP_VECTOR_WIDTH_BITS / 8) Vector_1", vectorHeader, StringComparison.Ordinal);
+        Assert.Contains("#define HE_CPP_VECTOR_WIDTH_BITS 256", simdConfigHeader, StringComparison.Ordinal);
+        Assert.Contains("#define HE_CPP_SIMD_NEON", simdConfigHeader, StringComparison.Ordinal);
+        Assert.Contains("using Vector128Lanes = NeonLanes<T>;", vectorLanesHeader, StringComparison.Ordinal);
+        Assert.Contains("class VectorLaneBlock", vectorLanesHeader, StringComparison.Ordinal);
+        Assert.Contains("return vaddq_f32(left, right);", neonLanesHeader, StringComparison.Ordinal);
+        Assert.Contains("class Arm64", advSimdHeader, StringComparison.Ordinal);
+    }
+
+    /// <summary>
+    /// Ensures Vector512 lowers to AVX-512 registers with opmask comparisons and reaches them through a cpuid check on builds that do not target AVX-512.
+    /// </summary>
+    [Fact]
+    public void RuntimeTemplates_vector512_lowers_to_avx512_with_runtime_dispatch() {
+        string intrinsicsRoot = Path.Combine(ResolveRepositoryRootPath(), "cs2.cpp", ".net.cpp", "system", "runtime", "intrinsics");
+        string vector512Header = File.ReadAllText(Path.Combine(intrinsicsRoot, "vector512.hpp"));
+        string simdConfigHeader = File.ReadAllText(Path.Combine(intrinsicsRoot, "simd_config.hpp"));
+        string cpuFeaturesHeader = File.ReadAllText(Path.Combine(intrinsicsRoot, "cpu_features.hpp"));
+        string avx512LanesHeader = File.ReadAllText(Path.Combine(intrinsicsRoot, "x86", "avx512_lanes.hpp"));
+
+        Assert.Contains("class alignas(64) Vector512", vector512Header, StringComparison.Ordinal);
+        Assert.Contains("CpuFeatures::HasAvx512()", vector512Header, StringComparison.Ordinal);
+        Assert.Contains("#define HE_CPP_SIMD_AVX512_DISPATCH", simdConfigHeader, StringComparison.Ordinal);
+        Assert.Contains("#define HE_CPP_AVX512_TARGET __attribute__((target(", simdConfigHeader, StringComparison.Ordinal);
+        Assert.Contains("static bool HasAvx512()", cpuFeaturesHeader, StringComparison.Ordinal);
+        Assert.Contains("return _mm512_cmp_ps_mask(left, right, _CMP_EQ_OQ);", avx512LanesHeader, StringComparison.Ordinal);
+        Assert.Contains("return _mm512_movepi8_mask(value);", avx512LanesHeader, StringComparison.Ordinal);
+    }
+
+    /// <summary>
+    /// Ensures builds below AVX reach AVX2 Vector256 kernels after a cpuid check and that SimdDispatch picks the per-instruction-set clones of generated methods.
+    /// </summary>
+    [Fact]
+    public void RuntimeTemplates_vector256_dispatches_to_avx2_and_selects_simd_clones() {
+        string intrinsicsRoot = Path.Combine(ResolveRepositoryRootPath(), "cs2.cpp", ".net.cpp", "system", "runtime", "intrinsics");
+        string vector256Header = File.ReadAllText(Path.Combine(intrinsicsRoot, "vector256.hpp"));
+        string simdConfigHeader = File.ReadAllText(Path.Combine(intrinsicsRoot, "simd_config.hpp"));
+        string simdDispatchHeader = File.ReadAllText(Path.Combine(intrinsicsRoot, "simd_dispatch.hpp"));
+        string cpuFeaturesHeader = File.ReadAllText(Path.Combine(intrinsicsRoot, "cpu_features.hpp"));
+
+        Assert.Contains("CpuFeatures::HasAvx2()", vector256Header, StringComparison.Ordinal);
+        Assert.Contains("#define HE_CPP_SIMD_AVX2_DISPATCH", simdConfigHeader, StringComparison.Ordinal);
+        Assert.Contains("#define HE_CPP_AVX2_TARGET __attribute__((target(\"avx2\")))", simdConfigHeader, StringComparison.Ordinal);
+        Assert.Contains("#define HE_CPP_SIMD_FUNCTION_DISPATCH", simdConfigHeader, StringComparison.Ordinal);
+        Assert.Contains("static bool HasAvx2()", cpuFeaturesHeader, StringComparison.Ordinal);
+        Assert.Contains("static TFunction Select(TFunction baseline, TFunction avx2, TFunction avx512)", simdDispatchHeader, StringComparison.Ordinal);
+        foreach (string headerPath in new[] { "cpu_features.hpp", Path.Combine("x86", "avx2.hpp"), Path.Combine("x86", "sse41.hpp"), Path.Combine("x86", "avx_lanes.hpp") }) {
+            byte[] headerBytes = File.ReadAllBytes(Path.Combine(intrinsicsRoot, headerPath));
+            Assert.False(headerBytes.Length >= 3 && headerBytes[0] == 0xEF && headerBytes[1] == 0xBB && headerBytes[2] == 0xBF, $"{headerPath} starts with a UTF-8 byte order mark.");
+        }
+    }
+
+    /// <summary>
+    /// Ensures the System.Numerics math types sit in aligned Float4Lanes registers and lay Matrix4x4 out for the platform math convention.
+    /// </summary>
+    [Fact]
+    public void RuntimeTemplates_numerics_vectors_use_aligned_registers_and_math_convention() {
+        string runtimeRoot = Path.Combine(ResolveRepositoryRootPath(), "cs2.cpp", ".net.cpp");
+        string vectorsHeader = File.ReadAllText(Path.Combine(runtimeRoot, "system", "numerics", "vectors.hpp"));
+        string float4LanesHeader = File.ReadAllText(Path.Combine(runtimeRoot, "system", "runtime", "intrinsics", "float4_lanes.hpp"));
+
+        Assert.Contains("class alignas(16) Vector4", vectorsHeader, StringComparison.Ordinal);
+        Assert.Contains("class alignas(16) Quaternion", vectorsHeader, StringComparison.Ordinal);
+        Assert.Contains("class alignas(16) Plane", vectorsHeader, StringComparison.Ordinal);
+        Assert.Contains("class alignas(16) Matrix4x4", vectorsHeader, StringComparison.Ordinal);
+        Assert.Contains("#if HE_CPP_MATH_COLUMN_VECTOR\n        MultiplyRegisters(right, left, result);", vectorsHeader, StringComparison.Ordinal);
+        Assert.Contains("static bool Invert(const Matrix4x4& matrix, Matrix4x4& result)", vectorsHeader, StringComparison.Ordinal);
+        Assert.Contains("static_assert(sizeof(Vector3) == 12", vectorsHeader, StringComparison.Ordinal);
+        Assert.Contains("return Float4Lanes::LoadUnaligned(&X);", vectorsHeader, StringComparison.Ordinal);
+        Assert.Contains("Float4Lanes::StoreUnaligned(&M11 + registerIndex * 4, value);", vectorsHeader, StringComparison.Ordinal);
+        Assert.DoesNotContain("Float4Lanes::Load(", vectorsHeader, StringComparison.Ordinal);
+        Assert.DoesNotContain("Float4Lanes::Store(", vectorsHeader, StringComparison.Ordinal);
+        Assert.Contains("_mm_shuffle_ps(value, value, _MM_SHUFFLE(Lane, Lane, Lane, Lane))", float4LanesHeader, StringComparison.Ordinal);
+        Assert.Contains("vdupq_laneq_f32(value, Lane)", float4LanesHeader, StringComparison.Ordinal);
+    }
+
+    /// <summary>
+    /// Ensures the batch kernels run in Vector256 lanes behind the same per-ISA clones as dispatched generated methods.
+    /// </summary>
+    [Fact]
+    public void RuntimeTemplates_batch_kernels_use_vector256_lanes_and_simd_dispatch() {
+        string runtimeRoot = Path.Combine(ResolveRepositoryRootPath(), "cs2.cpp", ".net.cpp");
+        string batchKernelsHeader = File.ReadAllText(Path.Combine(runtimeRoot, "system", "numerics", "batch_kernels.hpp"));
+
+        Assert.Contains("using Lanes = Vector256<float>;", batchKernelsHeader, StringComparison.Ordinal);
+        Assert.Contains("SimdDispatch::Select<TFunction>(", batchKernelsHeader, StringComparison.Ordinal);
+        Assert.Contains("HE_CPP_AVX2_TARGET static auto RunAvx2(", batchKernelsHeader, StringComparison.Ordinal);
+        Assert.Contains("static int32_t CullSpheres(", batchKernelsHeader, StringComparison.Ordinal);
+        Assert.Contains("static int32_t CullAabbs(", batchKernelsHeader, StringComparison.Ordinal);
+        Assert.Contains("Vector256Runtime::ExtractMostSignificantBits(culled)", batchKernelsHeader, StringComparison.Ordinal);
+        Assert.Contains("PlaneLanes planeLanes[BroadcastPlaneCapacity];", batchKernelsHeader, StringComparison.Ordinal);
+        Assert.DoesNotContain("std::vector", batchKernelsHeader, StringComparison.Ordinal);
+    }
+
+    /// <summary>
+    /// Ensures MemoryExtensions searches run in lane registers for bitwise-equatable elements and dispatch AVX2 at run time.
+    /// </summary>
+    [Fact]
+    public void RuntimeTemplates_memory_extensions_use_vector_lanes_for_primitive_elements() {
+        string runtimeRoot = Path.Combine(ResolveRepositoryRootPath(), "cs2.cpp", ".net.cpp");
+        string memoryExtensionsHeader = File.ReadAllText(Path.Combine(runtimeRoot, "system", "memory_extensions.hpp"));
+
+        Assert.Contains("Lanes::MoveMask(matches)", memoryExtensionsHeader, StringComparison.Ordinal);
+        Assert.Contains("BitOperations::TrailingZeroCount(mask)", memoryExtensionsHeader, StringComparison.Ordinal);
+        Assert.Contains("HE_CPP_AVX2_TARGET static int32_t IndexOfAnyAvx2(", memoryExtensionsHeader, StringComparison.Ordinal);
+        Assert.Contains("struct MemoryExtensionsLaneBlocks<AvxLanes<TBits>, TBits>", memoryExtensionsHeader, StringComparison.Ordinal);
+        Assert.Contains("HE_CPP_AVX2_TARGET static uint32_t MatchMask(const TBits* data, const Register* values, int32_t valueCount)", memoryExtensionsHeader, StringComparison.Ordinal);
+        Assert.DoesNotContain("static Register Broadcast(", memoryExtensionsHeader, StringComparison.Ordinal);
+        Assert.Contains("CpuFeatures::HasAvx2()", memoryExtensionsHeader, StringComparison.Ordinal);
+        Assert.Contains("static int32_t SequenceCompareTo(", memoryExtensionsHeader, StringComparison.Ordinal);
+        Assert.Contains("static void Reverse(", memoryExtensionsHeader, StringComparison.Ordinal);
+    }
+
+    /// <summary>
+    /// Ensures BitOperations lowers to the C++20 bit intrinsics and counts whole bitsets with the Harley-Seal kernel.
+    /// </summary>
+    [Fact]
+    public void RuntimeTemplates_bit_operations_use_bit_intrinsics_and_harley_seal_popcount() {
+        string runtimeRoot = Path.Combine(ResolveRepositoryRootPath(), "cs2.cpp", ".net.cpp");
+        string bitOperationsHeader = File.ReadAllText(Path.Combine(runtimeRoot, "system", "bit_operations.hpp"));
+
+        Assert.Contains("#include <bit>", bitOperationsHeader, StringComparison.Ordinal);
+        Assert.Contains("static constexpr int32_t PopCount(uint64_t value)", bitOperationsHeader, StringComparison.Ordinal);
+        Assert.Contains("static constexpr uint64_t RotateLeft(uint64_t value, int32_t offset)", bitOperationsHeader, StringComparison.Ordinal);
+        Assert.Contains("static constexpr bool IsPow2(int32_t value)", bitOperationsHeader, StringComparison.Ordinal);
+        Assert.Contains("static int64_t PopCount(ReadOnlySpan<uint64_t> values)", bitOperationsHeader, StringComparison.Ordinal);
+        Assert.Contains("HE_CPP_AVX2_TARGET static int64_t PopCountAvx2(", bitOperationsHeader, StringComparison.Ordinal);
+        Assert.Contains("HE_CPP_AVX2_TARGET static void Xor(Word& result, const Word& left, const Word& right)", bitOperationsHeader, StringComparison.Ordinal);
+        Assert.DoesNotContain("static Word Xor(Word left, Word right)", bitOperationsHeader, StringComparison.Ordinal);
+        Assert.DoesNotContain("while ((value & 1u) == 0u)", bitOperationsHeader, StringComparison.Ordinal);
+    }
+
+    /// <summary>
+    /// Ensures BinaryPrimitives moves values with memcpy, swaps only off-native byte orders, and converts spans in registers.
+    /// </summary>
+    [Fact]
+    public void RuntimeTemplates_binary_primitives_use_memcpy_bswap_and_span_kernels() {
+        string runtimeRoot = Path.Combine(ResolveRepositoryRootPath(), "cs2.cpp", ".net.cpp");
+        string binaryPrimitivesHeader = File.ReadAllText(Path.Combine(runtimeRoot, "system", "binary_primitives.hpp"));
+
+        Assert.Contains("littleEndian != static_cast<bool>(HE_CPP_PLATFORM_IS_LITTLE_ENDIAN)", binaryPrimitivesHeader, StringComparison.Ordinal);
+        Assert.Contains("__builtin_bswap64(value)", binaryPrimitivesHeader, StringComparison.Ordinal);
+        Assert.Contains("static uint64_t ReadUInt64BigEndian(const uint8_t* source)", binaryPrimitivesHeader, StringComparison.Ordinal);
+        Assert.Contains("static bool TryWriteDoubleLittleEndian(Span<uint8_t> destination, double value)", binaryPrimitivesHeader, StringComparison.Ordinal);
+        Assert.Contains("static void ReverseEndianness(ReadOnlySpan<std::type_identity_t<T>> source, Span<T> destination)", binaryPrimitivesHeader, StringComparison.Ordinal);
+        Assert.Contains("_mm256_shuffle_epi8(value, shuffle)", binaryPrimitivesHeader, StringComparison.Ordinal);
+    }
+
     /// <summary>
     /// Resolves the csharpcodegen repository root from the current test assembly location.
     /// </summary>
@@ -112,4 +112,26 @@ public sealed class CodegenCliArgumentParserTests {
         Assert.False(options.PlatformProfile.IsLittleEndian);
         Assert.False(options.PlatformProfile.IsWindowsHost);
     }
+
+    /// <summary>
+    /// Ensures the vector-width-bits option fixes the Vector&lt;T&gt; width on the selected platform profile and rejects widths the native runtime cannot size.
+    /// </summary>
+    [Fact]
+    public void Create_conversion_options_reads_vector_width_from_selected_options() {
+        CodegenCliParsedArguments parsedArguments = new CodegenCliParsedArguments {
+            ProjectPath = @"C:\tmp\fixture.csproj",
+            OutputFolder = @"C:\tmp\generated",
+            PlatformId = "windows",
+            Language = "cpp",
+            Endianness = "little"
+        };
+        parsedArguments.SelectedOptions["vector-width-bits"] = "256";
+
+        CPPConversionOptions options = CodegenCliOptionsBuilder.CreateConversionOptions(parsedArguments);
+
+        Assert.Equal(256, options.PlatformProfile.VectorWidthInBits);
+
+        parsedArguments.SelectedOptions["vector-width-bits"] = "512";
+        Assert.Throws<ArgumentException>(() => CodegenCliOptionsBuilder.CreateConversionOptions(parsedArguments));
+    }
 }
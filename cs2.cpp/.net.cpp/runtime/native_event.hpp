@@ -1,248 +1,400 @@
 #pragma once
 
-#include <algorithm>
-#include <array>
 #include <cstddef>
-#include <functional>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 #include <memory>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
 /// <summary>
-/// Represents a lightweight managed event bridge used by transpiled engine members during native execution.
+/// Bound instance-method subscriber token produced by <see cref="BindEventHandler"/>. The method is a template argument,
+/// so the token only carries the receiver and the event can dispatch through one function pointer.
 /// </summary>
+/// <typeparam name="TInstance">Owning instance type.</typeparam>
+/// <typeparam name="Method">Instance method that receives the callback.</typeparam>
+template <typename TInstance, auto Method>
+struct EventHandlerBinding {
+    TInstance* Instance;
+};
+
+/// <summary>
+/// Binds one instance method to its receiver for event add and remove operators.
+/// </summary>
+/// <typeparam name="Method">Instance method that should receive the callback.</typeparam>
+/// <typeparam name="TInstance">Owning instance type.</typeparam>
+/// <param name="instance">Owning instance that should receive the callback.</param>
+/// <returns>A bound handler token that can be passed to event add or remove operators.</returns>
+template <auto Method, typename TInstance>
+EventHandlerBinding<TInstance, Method> BindEventHandler(TInstance* instance) {
+    static_assert(std::is_member_function_pointer_v<decltype(Method)>, "BindEventHandler requires an instance method.");
+    return EventHandlerBinding<TInstance, Method> { instance };
+}
+
+/// <summary>
+/// Represents a managed event typed by its delegate parameter list. Subscribers are stored contiguously as
+/// <c>{target, thunk}</c> pairs, so adding a function or bound-method handler performs no per-subscriber allocation and
+/// invocation is one direct call through the thunk for each subscriber. Lambdas and delegate objects passed by value
+/// are copied into one shared heap slot; delegate pointers are referenced, not owned.
+/// Handlers may add or remove subscribers while the event is dispatching. Invocation walks the list in place instead
+/// of copying it: additions append past the range the active dispatch walks, and removals only stamp the subscriber
+/// with the generation they happened at, so every dispatch still sees the list as it was when it began. Removed
+/// entries are compacted once the outermost dispatch returns.
+/// </summary>
+/// <typeparam name="TArgs">Native parameter types of the event delegate.</typeparam>
+template <typename... TArgs>
 class Event {
 public:
-    template <typename TInstance, typename... TArgs>
-    struct BoundHandler {
-        TInstance* Instance;
-        void (TInstance::*Method)(TArgs...);
-    };
-
     /// <summary>
-    /// Initializes an empty event bridge.
+    /// Initializes an empty event.
     /// </summary>
     Event() = default;
 
     /// <summary>
-    /// Binds one instance and member-method pair into a removable event subscriber token.
-    /// </summary>
-    /// <typeparam name="TInstance">Owning instance type.</typeparam>
-    /// <typeparam name="TArgs">Native handler argument types.</typeparam>
-    /// <param name="instance">Owning instance that should receive the callback.</param>
-    /// <param name="method">Instance method that should receive the callback.</param>
-    /// <returns>A bound handler token that can be passed to event add or remove operators.</returns>
-    template <typename TInstance, typename... TArgs>
-    static auto Bind(TInstance* instance, void (TInstance::*method)(TArgs...)) {
-        return BoundHandler<TInstance, TArgs...> { instance, method };
-    }
-
-    /// <summary>
-    /// Registers one free or static function subscriber that can be invoked later with a matching argument list.
+    /// Registers one free or static function subscriber.
     /// </summary>
-    /// <typeparam name="TArgs">Native handler argument types.</typeparam>
+    /// <typeparam name="THandlerArgs">Parameter types declared by the handler.</typeparam>
     /// <param name="handler">Free or static function handler being attached to the event.</param>
     /// <returns>The current event so chained subscriptions remain compilable.</returns>
-    template <typename... TArgs>
-    Event& operator+=(void (*handler)(TArgs...)) {
-        if (handler == nullptr) {
-            return *this;
+    template <typename... THandlerArgs>
+    Event& operator+=(void (*handler)(THandlerArgs...)) {
+        if (handler != nullptr) {
+            Add(MakeFunctionSubscriber(handler));
         }
 
-        Subscribers.push_back(std::unique_ptr<Subscriber>(new Subscriber {
-            sizeof...(TArgs),
-            [handler](void** arguments) {
-                InvokeFunctionPointer(handler, arguments, std::index_sequence_for<TArgs...> {});
-            },
-            [handler](const void* candidateHandler) {
-                return candidateHandler != nullptr &&
-                    *static_cast<void (*const*)(TArgs...)>(candidateHandler) == handler;
-            },
-            nullptr
-        }));
         return *this;
     }
 
     /// <summary>
-    /// Registers one bound instance-method subscriber that can be invoked later with a matching argument list.
+    /// Registers one bound instance-method subscriber.
     /// </summary>
     /// <typeparam name="TInstance">Owning instance type.</typeparam>
-    /// <typeparam name="TArgs">Native handler argument types.</typeparam>
+    /// <typeparam name="Method">Instance method that receives the callback.</typeparam>
     /// <param name="handler">Bound instance-method handler token being attached to the event.</param>
     /// <returns>The current event so chained subscriptions remain compilable.</returns>
-    template <typename TInstance, typename... TArgs>
-    Event& operator+=(BoundHandler<TInstance, TArgs...> handler) {
-        if (handler.Instance == nullptr || handler.Method == nullptr) {
-            return *this;
+    template <typename TInstance, auto Method>
+    Event& operator+=(EventHandlerBinding<TInstance, Method> handler) {
+        if (handler.Instance != nullptr) {
+            Add(MakeMethodSubscriber(handler));
         }
 
-        Subscribers.push_back(std::unique_ptr<Subscriber>(new Subscriber {
-            sizeof...(TArgs),
-            [handler](void** arguments) {
-                InvokeBoundMethod(handler.Instance, handler.Method, arguments, std::index_sequence_for<TArgs...> {});
-            },
-            nullptr,
-            [handler](const void* candidateInstance, const void* candidateMethod) {
-                if (candidateInstance == nullptr || candidateMethod == nullptr) {
-                    return false;
-                }
-
-                return static_cast<TInstance*>(const_cast<void*>(candidateInstance)) == handler.Instance &&
-                    *static_cast<void (TInstance::*const*)(TArgs...)>(candidateMethod) == handler.Method;
-            }
-        }));
         return *this;
     }
 
     /// <summary>
-    /// Accepts unsupported subscriber shapes so existing generated unbound instance-method subscriptions remain compilable.
+    /// Registers one callable subscriber: a lambda or delegate object, which is copied, or a pointer to a delegate
+    /// object, which must outlive the subscription. A null handler is ignored, as in managed code.
     /// </summary>
-    /// <typeparam name="THandler">Native handler shape provided by the caller.</typeparam>
-    /// <param name="handler">Handler instance being attached to the event.</param>
+    /// <typeparam name="THandler">Callable type or pointer to a callable type invocable with the event arguments.</typeparam>
+    /// <param name="handler">Handler being attached to the event.</param>
     /// <returns>The current event so chained subscriptions remain compilable.</returns>
     template <typename THandler>
     Event& operator+=(THandler handler) {
-        (void)handler;
-        return *this;
-    }
+        if constexpr (std::is_pointer_v<THandler>) {
+            static_assert(
+                std::is_invocable_v<std::remove_pointer_t<THandler>&, std::add_lvalue_reference_t<TArgs>...>,
+                "Event handler pointers must point to a callable that accepts the event arguments.");
+            if (handler != nullptr) {
+                Add(MakeCallablePointerSubscriber(handler));
+            }
+        } else if constexpr (!std::is_null_pointer_v<THandler>) {
+            static_assert(
+                std::is_invocable_v<THandler&, std::add_lvalue_reference_t<TArgs>...>,
+                "Event handlers must be functions, bound methods, or callables that accept the event arguments.");
+            Add(MakeCallableSubscriber(std::move(handler)));
+        }
 
-    /// <summary>
-    /// Unregisters a subscriber from the event placeholder.
-    /// </summary>
-    /// <typeparam name="THandler">Native handler shape provided by the caller.</typeparam>
-    /// <param name="handler">Handler instance being detached from the event.</param>
-    /// <returns>The current event so chained removals remain compilable.</returns>
-    template <typename THandler>
-    Event& operator-=(THandler handler) {
-        (void)handler;
         return *this;
     }
 
     /// <summary>
-    /// Unregisters one free or static function subscriber from the event.
+    /// Unregisters the most recently added matching free or static function subscriber.
     /// </summary>
-    /// <typeparam name="TArgs">Native handler argument types.</typeparam>
+    /// <typeparam name="THandlerArgs">Parameter types declared by the handler.</typeparam>
     /// <param name="handler">Free or static function handler being detached from the event.</param>
     /// <returns>The current event so chained removals remain compilable.</returns>
-    template <typename... TArgs>
-    Event& operator-=(void (*handler)(TArgs...)) {
-        if (handler == nullptr) {
-            return *this;
+    template <typename... THandlerArgs>
+    Event& operator-=(void (*handler)(THandlerArgs...)) {
+        if (handler != nullptr) {
+            RemoveLast(MakeFunctionSubscriber(handler));
         }
 
-        Subscribers.erase(
-            std::remove_if(
-                Subscribers.begin(),
-                Subscribers.end(),
-                [handler](const std::unique_ptr<Subscriber>& subscriber) {
-                    if (subscriber->ArgumentCount != sizeof...(TArgs) || subscriber->MatchesFunction == nullptr) {
-                        return false;
-                    }
-
-                    return subscriber->MatchesFunction(&handler);
-                }),
-            Subscribers.end());
         return *this;
     }
 
     /// <summary>
-    /// Unregisters one bound instance-method subscriber from the event.
+    /// Unregisters the most recently added matching bound instance-method subscriber.
     /// </summary>
     /// <typeparam name="TInstance">Owning instance type.</typeparam>
-    /// <typeparam name="TArgs">Native handler argument types.</typeparam>
+    /// <typeparam name="Method">Instance method that receives the callback.</typeparam>
     /// <param name="handler">Bound instance-method handler token being detached from the event.</param>
     /// <returns>The current event so chained removals remain compilable.</returns>
-    template <typename TInstance, typename... TArgs>
-    Event& operator-=(BoundHandler<TInstance, TArgs...> handler) {
-        if (handler.Instance == nullptr || handler.Method == nullptr) {
-            return *this;
+    template <typename TInstance, auto Method>
+    Event& operator-=(EventHandlerBinding<TInstance, Method> handler) {
+        if (handler.Instance != nullptr) {
+            RemoveLast(MakeMethodSubscriber(handler));
         }
 
-        Subscribers.erase(
-            std::remove_if(
-                Subscribers.begin(),
-                Subscribers.end(),
-                [handler](const std::unique_ptr<Subscriber>& subscriber) {
-                    if (subscriber->ArgumentCount != sizeof...(TArgs) || subscriber->MatchesBound == nullptr) {
-                        return false;
+        return *this;
+    }
+
+    /// <summary>
+    /// Unregisters the most recently added matching callable subscriber. Pointers match the same pointer or, for
+    /// equality-comparable delegates, an equal delegate; copied callables match only when their type defines equality,
+    /// so removing a distinct lambda is a no-op just as removing a distinct managed lambda is.
+    /// </summary>
+    /// <typeparam name="THandler">Callable type or pointer to a callable type invocable with the event arguments.</typeparam>
+    /// <param name="handler">Handler being detached from the event.</param>
+    /// <returns>The current event so chained removals remain compilable.</returns>
+    template <typename THandler>
+    Event& operator-=(THandler handler) {
+        if constexpr (std::is_pointer_v<THandler>) {
+            static_assert(
+                std::is_invocable_v<std::remove_pointer_t<THandler>&, std::add_lvalue_reference_t<TArgs>...>,
+                "Event handler pointers must point to a callable that accepts the event arguments.");
+            if (handler != nullptr) {
+                using TCallable = std::remove_cv_t<std::remove_pointer_t<THandler>>;
+                RemoveLastWhere(&InvokeCallable<TCallable>, [handler](const SubscriberTarget& target) {
+                    const TCallable* subscribed = static_cast<const TCallable*>(target.Instance);
+                    if constexpr (IsEqualityComparable<TCallable>::value) {
+                        return subscribed == handler || *subscribed == *handler;
+                    } else {
+                        return subscribed == handler;
                     }
+                });
+            }
+        } else if constexpr (!std::is_null_pointer_v<THandler>) {
+            static_assert(
+                std::is_invocable_v<THandler&, std::add_lvalue_reference_t<TArgs>...>,
+                "Event handlers must be functions, bound methods, or callables that accept the event arguments.");
+            if constexpr (IsEqualityComparable<THandler>::value) {
+                RemoveLastWhere(&InvokeCallable<THandler>, [&handler](const SubscriberTarget& target) {
+                    return *static_cast<const THandler*>(target.Instance) == handler;
+                });
+            }
+        }
 
-                    return subscriber->MatchesBound(handler.Instance, &handler.Method);
-                }),
-            Subscribers.end());
         return *this;
     }
 
     /// <summary>
-    /// Invokes all subscribers that were registered with the same arity as the supplied argument list.
+    /// Invokes every subscriber in subscription order.
     /// </summary>
-    /// <typeparam name="TArgs">Native argument shapes forwarded by the transpiled call site.</typeparam>
     /// <param name="args">Arguments supplied by the transpiled call site.</param>
-    template <typename... TArgs>
     void Invoke(TArgs... args) {
-        std::array<void*, sizeof...(TArgs)> argumentPointers { const_cast<void*>(static_cast<const void*>(std::addressof(args)))... };
-        for (std::unique_ptr<Subscriber>& subscriber : Subscribers) {
-            if (subscriber->ArgumentCount == sizeof...(TArgs)) {
-                subscriber->Invoke(argumentPointers.data());
+        const uint64_t dispatchGeneration = Generation;
+        const size_t dispatchCount = Subscribers.size();
+        DispatchScope scope(*this);
+        for (size_t index = 0; index < dispatchCount; ++index) {
+            const Subscriber& subscriber = Subscribers[index];
+            if (subscriber.RemovedGeneration > dispatchGeneration) {
+                // Copied because a handler that subscribes may reallocate the list; owned callables stay at a stable
+                // heap address until the outermost dispatch compacts them.
+                const SubscriberTarget target = subscriber.Target;
+                const SubscriberThunk thunk = subscriber.Thunk;
+                thunk(target, args...);
             }
         }
     }
 
+    /// <summary>
+    /// Gets whether any subscriber is attached.
+    /// </summary>
+    bool HasSubscribers() const {
+        return Subscribers.size() > RemovedCount;
+    }
+
 private:
     /// <summary>
-    /// Stores one type-erased free or static function subscriber.
+    /// Receiver of one subscriber: the instance for bound methods or the function pointer for free functions.
+    /// </summary>
+    union SubscriberTarget {
+        void* Instance;
+        void (*Function)();
+    };
+
+    using SubscriberThunk = void (*)(const SubscriberTarget& target, std::add_lvalue_reference_t<TArgs>... args);
+
+    /// <summary>
+    /// Stores one subscriber as its receiver and the thunk that calls it.
     /// </summary>
     struct Subscriber {
-        /// <summary>
-        /// Number of arguments expected by the subscriber.
-        /// </summary>
-        std::size_t ArgumentCount;
+        SubscriberTarget Target;
+        SubscriberThunk Thunk;
 
         /// <summary>
-        /// Type-erased invocation thunk that reads arguments from the packed invocation array.
+        /// Generation at which the subscriber was removed, or <see cref="LiveGeneration"/> while it is attached.
         /// </summary>
-        std::function<void(void**)> Invoke;
+        uint64_t RemovedGeneration;
 
         /// <summary>
-        /// Optional free-function matcher used by remove operations.
+        /// Keeps a copied callable alive; empty for function pointers, bound methods, and referenced delegates.
         /// </summary>
-        std::function<bool(const void*)> MatchesFunction;
+        std::shared_ptr<void> Owned;
+    };
 
-        /// <summary>
-        /// Optional bound-subscriber matcher used by remove operations.
-        /// </summary>
-        std::function<bool(const void*, const void*)> MatchesBound;
+    static constexpr uint64_t LiveGeneration = std::numeric_limits<uint64_t>::max();
+
+    template <typename TCallable, typename = void>
+    struct IsEqualityComparable : std::false_type {
+    };
+
+    template <typename TCallable>
+    struct IsEqualityComparable<TCallable, std::void_t<decltype(std::declval<const TCallable&>() == std::declval<const TCallable&>())>>
+        : std::true_type {
     };
 
     /// <summary>
-    /// Invokes one stored free or static function by unpacking the argument pointer array.
+    /// Tracks dispatch depth and compacts removed subscribers when the outermost dispatch exits, including by exception.
     /// </summary>
-    /// <typeparam name="TArgs">Argument shapes supplied by the transpiled event invocation.</typeparam>
-    /// <typeparam name="TIndexes">Compile-time argument indexes used to unpack the argument pointer array.</typeparam>
-    /// <param name="handler">Free or static function subscriber.</param>
-    /// <param name="arguments">Packed addresses of the invocation arguments.</param>
-    template <typename... TArgs, std::size_t... TIndexes>
-    static void InvokeFunctionPointer(void (*handler)(TArgs...), void** arguments, std::index_sequence<TIndexes...>) {
-        handler((*static_cast<std::remove_reference_t<TArgs>*>(arguments[TIndexes]))...);
+    struct DispatchScope {
+        Event& Owner;
+
+        explicit DispatchScope(Event& owner)
+            : Owner(owner) {
+            ++Owner.DispatchDepth;
+        }
+
+        ~DispatchScope() {
+            if (--Owner.DispatchDepth == 0 && Owner.RemovedCount != 0) {
+                Owner.Compact();
+            }
+        }
+    };
+
+    template <typename... THandlerArgs>
+    static void InvokeFunction(const SubscriberTarget& target, std::add_lvalue_reference_t<TArgs>... args) {
+        reinterpret_cast<void (*)(THandlerArgs...)>(target.Function)(args...);
+    }
+
+    template <typename TInstance, auto Method>
+    static void InvokeMethod(const SubscriberTarget& target, std::add_lvalue_reference_t<TArgs>... args) {
+        (static_cast<TInstance*>(target.Instance)->*Method)(args...);
+    }
+
+    template <typename TCallable>
+    static void InvokeCallable(const SubscriberTarget& target, std::add_lvalue_reference_t<TArgs>... args) {
+        (*static_cast<TCallable*>(target.Instance))(args...);
+    }
+
+    template <typename... THandlerArgs>
+    static Subscriber MakeFunctionSubscriber(void (*handler)(THandlerArgs...)) {
+        Subscriber subscriber;
+        std::memset(&subscriber.Target, 0, sizeof(SubscriberTarget));
+        subscriber.Target.Function = reinterpret_cast<void (*)()>(handler);
+        subscriber.Thunk = &InvokeFunction<THandlerArgs...>;
+        subscriber.RemovedGeneration = LiveGeneration;
+        return subscriber;
+    }
+
+    template <typename TInstance, auto Method>
+    static Subscriber MakeMethodSubscriber(EventHandlerBinding<TInstance, Method> handler) {
+        Subscriber subscriber;
+        std::memset(&subscriber.Target, 0, sizeof(SubscriberTarget));
+        subscriber.Target.Instance = const_cast<void*>(static_cast<const void*>(handler.Instance));
+        subscriber.Thunk = &InvokeMethod<TInstance, Method>;
+        subscriber.RemovedGeneration = LiveGeneration;
+        return subscriber;
+    }
+
+    template <typename TCallable>
+    static Subscriber MakeCallablePointerSubscriber(TCallable* handler) {
+        using TStored = std::remove_cv_t<TCallable>;
+        Subscriber subscriber;
+        std::memset(&subscriber.Target, 0, sizeof(SubscriberTarget));
+        subscriber.Target.Instance = const_cast<TStored*>(handler);
+        subscriber.Thunk = &InvokeCallable<TStored>;
+        subscriber.RemovedGeneration = LiveGeneration;
+        return subscriber;
+    }
+
+    template <typename TCallable>
+    static Subscriber MakeCallableSubscriber(TCallable&& handler) {
+        using TStored = std::decay_t<TCallable>;
+        std::shared_ptr<TStored> owned = std::make_shared<TStored>(std::forward<TCallable>(handler));
+        Subscriber subscriber;
+        std::memset(&subscriber.Target, 0, sizeof(SubscriberTarget));
+        subscriber.Target.Instance = owned.get();
+        subscriber.Thunk = &InvokeCallable<TStored>;
+        subscriber.RemovedGeneration = LiveGeneration;
+        subscriber.Owned = std::move(owned);
+        return subscriber;
+    }
+
+    void Add(Subscriber&& subscriber) {
+        ++Generation;
+        Subscribers.push_back(std::move(subscriber));
     }
 
     /// <summary>
-    /// Invokes one stored bound instance-method subscriber by unpacking the argument pointer array.
+    /// Removes the last attached subscriber matching <paramref name="candidate"/>, matching managed delegate removal
+    /// order. While dispatching, the entry is only stamped with the new generation so active dispatches keep their view.
     /// </summary>
-    /// <typeparam name="TInstance">Owning instance type.</typeparam>
-    /// <typeparam name="TArgs">Argument shapes supplied by the transpiled event invocation.</typeparam>
-    /// <typeparam name="TIndexes">Compile-time argument indexes used to unpack the argument pointer array.</typeparam>
-    /// <param name="instance">Owning instance receiving the callback.</param>
-    /// <param name="method">Bound member method receiving the callback.</param>
-    /// <param name="arguments">Packed addresses of the invocation arguments.</param>
-    template <typename TInstance, typename... TArgs, std::size_t... TIndexes>
-    static void InvokeBoundMethod(TInstance* instance, void (TInstance::*method)(TArgs...), void** arguments, std::index_sequence<TIndexes...>) {
-        (instance->*method)((*static_cast<std::remove_reference_t<TArgs>*>(arguments[TIndexes]))...);
+    void RemoveLast(const Subscriber& candidate) {
+        RemoveLastWhere(candidate.Thunk, [&candidate](const SubscriberTarget& target) {
+            return std::memcmp(&target, &candidate.Target, sizeof(SubscriberTarget)) == 0;
+        });
     }
 
     /// <summary>
-    /// Subscribers currently attached to this event.
+    /// Removes the last attached subscriber dispatched through <paramref name="thunk"/> whose target satisfies
+    /// <paramref name="matches"/>.
+    /// </summary>
+    template <typename TMatch>
+    void RemoveLastWhere(SubscriberThunk thunk, TMatch matches) {
+        for (size_t index = Subscribers.size(); index > 0; --index) {
+            Subscriber& subscriber = Subscribers[index - 1];
+            if (subscriber.RemovedGeneration != LiveGeneration || subscriber.Thunk != thunk || !matches(subscriber.Target)) {
+                continue;
+            }
+
+            ++Generation;
+            if (DispatchDepth == 0) {
+                Subscribers.erase(Subscribers.begin() + static_cast<std::ptrdiff_t>(index - 1));
+            } else {
+                subscriber.RemovedGeneration = Generation;
+                ++RemovedCount;
+            }
+
+            return;
+        }
+    }
+
+    void Compact() {
+        size_t write = 0;
+        for (size_t read = 0; read < Subscribers.size(); ++read) {
+            if (Subscribers[read].RemovedGeneration == LiveGeneration) {
+                if (write != read) {
+                    Subscribers[write] = std::move(Subscribers[read]);
+                }
+
+                ++write;
+            }
+        }
+
+        Subscribers.resize(write);
+        RemovedCount = 0;
+    }
+
+    /// <summary>
+    /// Subscribers currently attached to this event, including removed entries awaiting compaction.
+    /// </summary>
+    std::vector<Subscriber> Subscribers;
+
+    /// <summary>
+    /// Counter advanced by every add and remove; dispatches compare removal stamps against the value they started at.
+    /// </summary>
+    uint64_t Generation = 0;
+
+    /// <summary>
+    /// Number of dispatches currently running on this event, including nested ones.
+    /// </summary>
+    uint32_t DispatchDepth = 0;
+
+    /// <summary>
+    /// Number of removed entries still present in <see cref="Subscribers"/>.
     /// </summary>
-    std::vector<std::unique_ptr<Subscriber>> Subscribers;
+    size_t RemovedCount = 0;
 };
@@ -301,6 +301,42 @@ public:
     }
 };
 
+class SynchronizationLockException : public Exception {
+public:
+    SynchronizationLockException() noexcept
+        : Exception() {
+        Message = "Object synchronization method was called from an unsynchronized block of code.";
+    }
+
+    explicit SynchronizationLockException(const char* message) noexcept
+        : Exception(message) {
+        Message = "Object synchronization method was called from an unsynchronized block of code.";
+    }
+
+    explicit SynchronizationLockException(const std::string& message) noexcept
+        : Exception(message) {
+        Message = "Object synchronization method was called from an unsynchronized block of code.";
+    }
+};
+
+class SemaphoreFullException : public Exception {
+public:
+    SemaphoreFullException() noexcept
+        : Exception() {
+        Message = "Adding the specified count to the semaphore would cause it to exceed its maximum count.";
+    }
+
+    explicit SemaphoreFullException(const char* message) noexcept
+        : Exception(message) {
+        Message = "Adding the specified count to the semaphore would cause it to exceed its maximum count.";
+    }
+
+    explicit SemaphoreFullException(const std::string& message) noexcept
+        : Exception(message) {
+        Message = "Adding the specified count to the semaphore would cause it to exceed its maximum count.";
+    }
+};
+
 #else
 
 #include <stdexcept>
@@ -544,4 +580,34 @@ public:
     }
 };
 
+class SynchronizationLockException : public Exception {
+public:
+    SynchronizationLockException()
+        : Exception("Object synchronization method was called from an unsynchronized block of code.") {
+    }
+
+    explicit SynchronizationLockException(const char* message)
+        : Exception(message == nullptr ? "Object synchronization method was called from an unsynchronized block of code." : message) {
+    }
+
+    explicit SynchronizationLockException(const std::string& message)
+        : Exception(message) {
+    }
+};
+
+class SemaphoreFullException : public Exception {
+public:
+    SemaphoreFullException()
+        : Exception("Adding the specified count to the semaphore would cause it to exceed its maximum count.") {
+    }
+
+    explicit SemaphoreFullException(const char* message)
+        : Exception(message == nullptr ? "Adding the specified count to the semaphore would cause it to exceed its maximum count." : message) {
+    }
+
+    explicit SemaphoreFullException(const std::string& message)
+        : Exception(message) {
+    }
+};
+
 #endif
@@ -157,7 +157,34 @@ public:
     }
 
     void Fill(const T& value) const {
-        std::fill_n(Data, Length, value);
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            if (Length == 0) {
+                return;
+            }
+
+            if constexpr (sizeof(T) == 1) {
+                unsigned char byte;
+                std::memcpy(&byte, &value, 1);
+                std::memset(Data, byte, Length);
+            } else if constexpr (std::is_default_constructible_v<T> && 64 % sizeof(T) == 0) {
+                // Fixed 64-byte copies of a pre-filled block compile to plain vector stores, whatever the element type.
+                constexpr size_t BlockCount = 64 / sizeof(T);
+                T block[BlockCount];
+                for (size_t index = 0; index < BlockCount; ++index) {
+                    block[index] = value;
+                }
+
+                size_t index = 0;
+                for (; Length - index >= BlockCount; index += BlockCount) {
+                    std::memcpy(Data + index, block, sizeof(block));
+                }
+                std::memcpy(Data + index, block, (Length - index) * sizeof(T));
+            } else {
+                std::fill_n(Data, Length, value);
+            }
+        } else {
+            std::fill_n(Data, Length, value);
+        }
     }
 
     int32_t get_Length() const {
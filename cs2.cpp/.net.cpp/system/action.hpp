@@ -1,25 +1,41 @@
 #ifndef ACTION_HPP
 #define ACTION_HPP
 
-#include <functional>
+#include "invocation_list.hpp"
 
 template<typename... TArgs>
 class Action {
+public:
+    using FuncType = InlineDelegate<void(TArgs...)>;
+    using InvocationListType = InvocationList<void(TArgs...)>;
+
 private:
-    using FuncType = std::function<void(TArgs...)>;
-    FuncType func{};
+    InvocationListType targets{};
 
 public:
     Action() = default;
 
+    explicit Action(InvocationListType list);
+
     explicit Action(FuncType f);
 
     template<typename TCallable>
     explicit Action(TCallable f);
 
+    // Bound instance method; stored inline so binding never allocates
+    template<typename TReceiver, typename TMethod>
+    Action(TReceiver receiver, TMethod method);
+
+    // Invokes every combined target in order; an empty Action is a no-op
     void operator()(TArgs... args) const;
 
+    const InvocationListType& GetInvocationTargets() const;
+
     explicit operator bool() const;
+
+    bool operator==(const Action& other) const;
+
+    bool operator!=(const Action& other) const;
 };
 
 // Include implementation for template functions
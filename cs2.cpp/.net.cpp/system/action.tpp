@@ -3,26 +3,50 @@
 
 #include "action.hpp"
 
-// Function pointer constructor
+// Combined invocation list constructor
 template<typename... TArgs>
-Action<TArgs...>::Action(FuncType f) : func(f) {}
+Action<TArgs...>::Action(InvocationListType list) : targets(std::move(list)) {}
+
+// Delegate storage constructor
+template<typename... TArgs>
+Action<TArgs...>::Action(FuncType f) : targets(std::move(f)) {}
 
 template<typename... TArgs>
 template<typename TCallable>
-Action<TArgs...>::Action(TCallable f) : func(f) {}
+Action<TArgs...>::Action(TCallable f) : targets(FuncType(std::move(f))) {}
+
+template<typename... TArgs>
+template<typename TReceiver, typename TMethod>
+Action<TArgs...>::Action(TReceiver receiver, TMethod method) : targets(FuncType(std::move(receiver), method)) {}
 
 // Invoke function
 template<typename... TArgs>
 void Action<TArgs...>::operator()(TArgs... args) const {
-    if (func) {
-        func(args...);
+    if (targets.GetCount() != 0) {
+        targets.Invoke(std::forward<TArgs>(args)...);
     }
 }
 
+template<typename... TArgs>
+const typename Action<TArgs...>::InvocationListType& Action<TArgs...>::GetInvocationTargets() const {
+    return targets;
+}
+
 // Check if Action is valid
 template<typename... TArgs>
 Action<TArgs...>::operator bool() const {
-    return func != nullptr;
+    return targets.GetCount() != 0;
+}
+
+// Actions are equal when they invoke the same targets in the same order, so a rebound handler can be removed
+template<typename... TArgs>
+bool Action<TArgs...>::operator==(const Action& other) const {
+    return targets == other.targets;
+}
+
+template<typename... TArgs>
+bool Action<TArgs...>::operator!=(const Action& other) const {
+    return targets != other.targets;
 }
 
 #endif // ACTION_TPP
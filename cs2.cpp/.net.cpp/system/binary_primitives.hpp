@@ -1,219 +1,803 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <type_traits>
 #include "bit_converter.hpp"
+#include "../runtime/native_exceptions.hpp"
+#include "../runtime/native_span.hpp"
+#include "system/runtime/intrinsics/cpu_features.hpp"
+#include "system/runtime/intrinsics/simd_config.hpp"
+
+#if HE_CPP_SIMD_SSE2 || HE_CPP_SIMD_AVX2_DISPATCH
+#include <immintrin.h>
+#endif
+
+#if HE_CPP_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <stdlib.h>
+#endif
 
 /// <summary>
-/// Provides the minimal managed BinaryPrimitives surface required by transpiled serializer code.
+/// Managed System.Buffers.Binary.BinaryPrimitives. Reads and writes move the value with one unaligned memcpy and swap
+/// its bytes with the compiler's bswap builtin only when the requested order differs from the target's, so native-order
+/// accesses compile to a single load or store. Span-wide ReverseEndianness swaps whole registers (SSE2, AVX2, NEON).
 /// </summary>
 class BinaryPrimitives {
+    template <typename T>
+    using UnsignedBits = std::conditional_t<sizeof(T) == 1, uint8_t,
+        std::conditional_t<sizeof(T) == 2, uint16_t,
+        std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>>>;
+
+    template <typename T>
+    static constexpr bool IsSwappable = std::is_integral_v<T> && !std::is_same_v<T, bool> &&
+        (sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+    template <typename T>
+    static T Read(const uint8_t* source, bool littleEndian) {
+        UnsignedBits<T> bits;
+        std::memcpy(&bits, source, sizeof(bits));
+        if (littleEndian != static_cast<bool>(HE_CPP_PLATFORM_IS_LITTLE_ENDIAN)) {
+            bits = ReverseEndianness(bits);
+        }
+
+        T value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    template <typename T>
+    static void Write(uint8_t* destination, T value, bool littleEndian) {
+        UnsignedBits<T> bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        if (littleEndian != static_cast<bool>(HE_CPP_PLATFORM_IS_LITTLE_ENDIAN)) {
+            bits = ReverseEndianness(bits);
+        }
+        std::memcpy(destination, &bits, sizeof(bits));
+    }
+
+    template <typename T>
+    static bool TryRead(const ReadOnlySpan<uint8_t>& source, T& value, bool littleEndian) {
+        if (source.Length < sizeof(T)) {
+            value = T();
+            return false;
+        }
+
+        value = Read<T>(source.Data, littleEndian);
+        return true;
+    }
+
+    template <typename T>
+    static bool TryWrite(const Span<uint8_t>& destination, T value, bool littleEndian) {
+        if (destination.Length < sizeof(T)) {
+            return false;
+        }
+
+        Write(destination.Data, value, littleEndian);
+        return true;
+    }
+
+#if HE_CPP_SIMD_SSE2
+    /// <summary>
+    /// Swaps the bytes of every <typeparamref name="TBits"/> lane in one 128-bit register with SSE2 shifts and word
+    /// shuffles, since the byte shuffle needs SSSE3.
+    /// </summary>
+    template <typename TBits>
+    static __m128i ReverseLanes(__m128i value) {
+        value = _mm_or_si128(_mm_slli_epi16(value, 8), _mm_srli_epi16(value, 8));
+        if constexpr (sizeof(TBits) == 4) {
+            value = _mm_shufflelo_epi16(value, _MM_SHUFFLE(2, 3, 0, 1));
+            value = _mm_shufflehi_epi16(value, _MM_SHUFFLE(2, 3, 0, 1));
+        } else if constexpr (sizeof(TBits) == 8) {
+            value = _mm_shufflelo_epi16(value, _MM_SHUFFLE(0, 1, 2, 3));
+            value = _mm_shufflehi_epi16(value, _MM_SHUFFLE(0, 1, 2, 3));
+        }
+        return value;
+    }
+#endif
+
+#if HE_CPP_SIMD_AVX2 || HE_CPP_SIMD_AVX2_DISPATCH
+    /// <summary>
+    /// Swaps the bytes of every lane in 32-byte blocks with one vpshufb each and returns how many elements it converted.
+    /// </summary>
+    template <typename TBits>
+    HE_CPP_AVX2_TARGET static size_t ReverseEndiannessAvx2(const TBits* source, TBits* destination, size_t length) {
+        constexpr size_t Width = 32 / sizeof(TBits);
+        __m128i order;
+        if constexpr (sizeof(TBits) == 2) {
+            order = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+        } else if constexpr (sizeof(TBits) == 4) {
+            order = _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+        } else {
+            order = _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+        }
+        const __m256i shuffle = _mm256_broadcastsi128_si256(order);
+
+        size_t index = 0;
+        for (; length - index >= Width; index += Width) {
+            __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + index));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + index), _mm256_shuffle_epi8(value, shuffle));
+        }
+        return index;
+    }
+#endif
+
+    template <typename TBits>
+    static void ReverseEndiannessBits(const TBits* source, TBits* destination, size_t length) {
+        size_t index = 0;
+#if HE_CPP_SIMD_AVX2
+        index = ReverseEndiannessAvx2(source, destination, length);
+#elif HE_CPP_SIMD_AVX2_DISPATCH
+        if (CpuFeatures::HasAvx2()) {
+            index = ReverseEndiannessAvx2(source, destination, length);
+        }
+#endif
+
+#if HE_CPP_SIMD_SSE2
+        constexpr size_t Width = 16 / sizeof(TBits);
+        for (; length - index >= Width; index += Width) {
+            __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + index));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + index), ReverseLanes<TBits>(value));
+        }
+#elif HE_CPP_SIMD_NEON
+        constexpr size_t Width = 16 / sizeof(TBits);
+        for (; length - index >= Width; index += Width) {
+            uint8x16_t value = vld1q_u8(reinterpret_cast<const uint8_t*>(source + index));
+            if constexpr (sizeof(TBits) == 2) {
+                value = vrev16q_u8(value);
+            } else if constexpr (sizeof(TBits) == 4) {
+                value = vrev32q_u8(value);
+            } else {
+                value = vrev64q_u8(value);
+            }
+            vst1q_u8(reinterpret_cast<uint8_t*>(destination + index), value);
+        }
+#endif
+
+        for (; index < length; ++index) {
+            destination[index] = ReverseEndianness(source[index]);
+        }
+    }
+
 public:
+    static constexpr uint8_t ReverseEndianness(uint8_t value) {
+        return value;
+    }
+
+    static constexpr int8_t ReverseEndianness(int8_t value) {
+        return value;
+    }
+
+    static constexpr uint16_t ReverseEndianness(uint16_t value) {
+        if (std::is_constant_evaluated()) {
+            return static_cast<uint16_t>((value >> 8) | (value << 8));
+        }
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_bswap16(value);
+#elif defined(_MSC_VER)
+        return _byteswap_ushort(value);
+#else
+        return static_cast<uint16_t>((value >> 8) | (value << 8));
+#endif
+    }
+
+    static constexpr int16_t ReverseEndianness(int16_t value) {
+        return static_cast<int16_t>(ReverseEndianness(static_cast<uint16_t>(value)));
+    }
+
+    static constexpr uint32_t ReverseEndianness(uint32_t value) {
+        if (std::is_constant_evaluated()) {
+            return (value >> 24) | ((value >> 8) & 0x0000FF00u) | ((value << 8) & 0x00FF0000u) | (value << 24);
+        }
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_bswap32(value);
+#elif defined(_MSC_VER)
+        return _byteswap_ulong(value);
+#else
+        return (value >> 24) | ((value >> 8) & 0x0000FF00u) | ((value << 8) & 0x00FF0000u) | (value << 24);
+#endif
+    }
+
+    static constexpr int32_t ReverseEndianness(int32_t value) {
+        return static_cast<int32_t>(ReverseEndianness(static_cast<uint32_t>(value)));
+    }
+
+    static constexpr uint64_t ReverseEndianness(uint64_t value) {
+        if (std::is_constant_evaluated()) {
+            return (static_cast<uint64_t>(ReverseEndianness(static_cast<uint32_t>(value))) << 32) |
+                ReverseEndianness(static_cast<uint32_t>(value >> 32));
+        }
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_bswap64(value);
+#elif defined(_MSC_VER)
+        return _byteswap_uint64(value);
+#else
+        return (static_cast<uint64_t>(ReverseEndianness(static_cast<uint32_t>(value))) << 32) |
+            ReverseEndianness(static_cast<uint32_t>(value >> 32));
+#endif
+    }
+
+    static constexpr int64_t ReverseEndianness(int64_t value) {
+        return static_cast<int64_t>(ReverseEndianness(static_cast<uint64_t>(value)));
+    }
+
+    /// <summary>
+    /// Reverses the byte order of every element of <paramref name="source"/> into <paramref name="destination"/>, which
+    /// may be the same memory for an in-place conversion.
+    /// </summary>
+    template <typename T, typename = std::enable_if_t<IsSwappable<T>>>
+    static void ReverseEndianness(ReadOnlySpan<std::type_identity_t<T>> source, Span<T> destination) {
+        if (destination.Length < source.Length) {
+            throw ArgumentException("Destination is too short.", "destination");
+        }
+
+        ReverseEndiannessBits(
+            reinterpret_cast<const UnsignedBits<T>*>(source.Data),
+            reinterpret_cast<UnsignedBits<T>*>(destination.Data),
+            source.Length);
+    }
+
+    /// <summary>
+    /// Reads a signed 16-bit integer from a little-endian byte buffer.
+    /// </summary>
+    static int16_t ReadInt16LittleEndian(const uint8_t* source) {
+        return Read<int16_t>(source, true);
+    }
+
+    /// <summary>
+    /// Reads a signed 16-bit integer from a big-endian byte buffer.
+    /// </summary>
+    static int16_t ReadInt16BigEndian(const uint8_t* source) {
+        return Read<int16_t>(source, false);
+    }
+
     /// <summary>
     /// Reads an unsigned 16-bit integer from a little-endian byte buffer.
     /// </summary>
-    static uint16_t ReadUInt16LittleEndian(const uint8_t* buffer) {
-        return static_cast<uint16_t>(buffer[0]) |
-            static_cast<uint16_t>(buffer[1] << 8);
+    static uint16_t ReadUInt16LittleEndian(const uint8_t* source) {
+        return Read<uint16_t>(source, true);
+    }
+
+    /// <summary>
+    /// Reads an unsigned 16-bit integer from a big-endian byte buffer.
+    /// </summary>
+    static uint16_t ReadUInt16BigEndian(const uint8_t* source) {
+        return Read<uint16_t>(source, false);
     }
 
     /// <summary>
     /// Reads a signed 32-bit integer from a little-endian byte buffer.
     /// </summary>
-    static int32_t ReadInt32LittleEndian(const uint8_t* buffer) {
-        return static_cast<int32_t>(
-            static_cast<uint32_t>(buffer[0]) |
-            (static_cast<uint32_t>(buffer[1]) << 8) |
-            (static_cast<uint32_t>(buffer[2]) << 16) |
-            (static_cast<uint32_t>(buffer[3]) << 24));
+    static int32_t ReadInt32LittleEndian(const uint8_t* source) {
+        return Read<int32_t>(source, true);
+    }
+
+    /// <summary>
+    /// Reads a signed 32-bit integer from a big-endian byte buffer.
+    /// </summary>
+    static int32_t ReadInt32BigEndian(const uint8_t* source) {
+        return Read<int32_t>(source, false);
     }
 
     /// <summary>
     /// Reads an unsigned 32-bit integer from a little-endian byte buffer.
     /// </summary>
-    static uint32_t ReadUInt32LittleEndian(const uint8_t* buffer) {
-        return static_cast<uint32_t>(buffer[0]) |
-            (static_cast<uint32_t>(buffer[1]) << 8) |
-            (static_cast<uint32_t>(buffer[2]) << 16) |
-            (static_cast<uint32_t>(buffer[3]) << 24);
+    static uint32_t ReadUInt32LittleEndian(const uint8_t* source) {
+        return Read<uint32_t>(source, true);
+    }
+
+    /// <summary>
+    /// Reads an unsigned 32-bit integer from a big-endian byte buffer.
+    /// </summary>
+    static uint32_t ReadUInt32BigEndian(const uint8_t* source) {
+        return Read<uint32_t>(source, false);
     }
 
     /// <summary>
     /// Reads a signed 64-bit integer from a little-endian byte buffer.
     /// </summary>
-    static int64_t ReadInt64LittleEndian(const uint8_t* buffer) {
-        return static_cast<int64_t>(
-            static_cast<uint64_t>(buffer[0]) |
-            (static_cast<uint64_t>(buffer[1]) << 8) |
-            (static_cast<uint64_t>(buffer[2]) << 16) |
-            (static_cast<uint64_t>(buffer[3]) << 24) |
-            (static_cast<uint64_t>(buffer[4]) << 32) |
-            (static_cast<uint64_t>(buffer[5]) << 40) |
-            (static_cast<uint64_t>(buffer[6]) << 48) |
-            (static_cast<uint64_t>(buffer[7]) << 56));
+    static int64_t ReadInt64LittleEndian(const uint8_t* source) {
+        return Read<int64_t>(source, true);
     }
 
     /// <summary>
-    /// Reads a double-precision floating point value from a little-endian byte buffer.
+    /// Reads a signed 64-bit integer from a big-endian byte buffer.
     /// </summary>
-    static double ReadDoubleLittleEndian(const uint8_t* buffer) {
-        return BitConverter::Int64BitsToDouble(ReadInt64LittleEndian(buffer));
+    static int64_t ReadInt64BigEndian(const uint8_t* source) {
+        return Read<int64_t>(source, false);
     }
 
     /// <summary>
-    /// Reads an unsigned 16-bit integer from a big-endian byte buffer.
+    /// Reads an unsigned 64-bit integer from a little-endian byte buffer.
     /// </summary>
-    static uint16_t ReadUInt16BigEndian(const uint8_t* buffer) {
-        return static_cast<uint16_t>(buffer[1]) |
-            static_cast<uint16_t>(buffer[0] << 8);
+    static uint64_t ReadUInt64LittleEndian(const uint8_t* source) {
+        return Read<uint64_t>(source, true);
     }
 
     /// <summary>
-    /// Reads a signed 32-bit integer from a big-endian byte buffer.
+    /// Reads an unsigned 64-bit integer from a big-endian byte buffer.
     /// </summary>
-    static int32_t ReadInt32BigEndian(const uint8_t* buffer) {
-        return static_cast<int32_t>(
-            static_cast<uint32_t>(buffer[3]) |
-            (static_cast<uint32_t>(buffer[2]) << 8) |
-            (static_cast<uint32_t>(buffer[1]) << 16) |
-            (static_cast<uint32_t>(buffer[0]) << 24));
+    static uint64_t ReadUInt64BigEndian(const uint8_t* source) {
+        return Read<uint64_t>(source, false);
     }
 
     /// <summary>
-    /// Reads an unsigned 32-bit integer from a big-endian byte buffer.
+    /// Reads a native-sized signed integer from a little-endian byte buffer.
     /// </summary>
-    static uint32_t ReadUInt32BigEndian(const uint8_t* buffer) {
-        return static_cast<uint32_t>(buffer[3]) |
-            (static_cast<uint32_t>(buffer[2]) << 8) |
-            (static_cast<uint32_t>(buffer[1]) << 16) |
-            (static_cast<uint32_t>(buffer[0]) << 24);
+    static intptr_t ReadIntPtrLittleEndian(const uint8_t* source) {
+        return Read<intptr_t>(source, true);
     }
 
     /// <summary>
-    /// Reads a signed 64-bit integer from a big-endian byte buffer.
+    /// Reads a native-sized signed integer from a big-endian byte buffer.
+    /// </summary>
+    static intptr_t ReadIntPtrBigEndian(const uint8_t* source) {
+        return Read<intptr_t>(source, false);
+    }
+
+    /// <summary>
+    /// Reads a native-sized unsigned integer from a little-endian byte buffer.
+    /// </summary>
+    static uintptr_t ReadUIntPtrLittleEndian(const uint8_t* source) {
+        return Read<uintptr_t>(source, true);
+    }
+
+    /// <summary>
+    /// Reads a native-sized unsigned integer from a big-endian byte buffer.
+    /// </summary>
+    static uintptr_t ReadUIntPtrBigEndian(const uint8_t* source) {
+        return Read<uintptr_t>(source, false);
+    }
+
+    /// <summary>
+    /// Reads a single-precision floating point value from a little-endian byte buffer.
+    /// </summary>
+    static float ReadSingleLittleEndian(const uint8_t* source) {
+        return Read<float>(source, true);
+    }
+
+    /// <summary>
+    /// Reads a single-precision floating point value from a big-endian byte buffer.
+    /// </summary>
+    static float ReadSingleBigEndian(const uint8_t* source) {
+        return Read<float>(source, false);
+    }
+
+    /// <summary>
+    /// Reads a double-precision floating point value from a little-endian byte buffer.
     /// </summary>
-    static int64_t ReadInt64BigEndian(const uint8_t* buffer) {
-        return static_cast<int64_t>(
-            static_cast<uint64_t>(buffer[7]) |
-            (static_cast<uint64_t>(buffer[6]) << 8) |
-            (static_cast<uint64_t>(buffer[5]) << 16) |
-            (static_cast<uint64_t>(buffer[4]) << 24) |
-            (static_cast<uint64_t>(buffer[3]) << 32) |
-            (static_cast<uint64_t>(buffer[2]) << 40) |
-            (static_cast<uint64_t>(buffer[1]) << 48) |
-            (static_cast<uint64_t>(buffer[0]) << 56));
+    static double ReadDoubleLittleEndian(const uint8_t* source) {
+        return Read<double>(source, true);
     }
 
     /// <summary>
     /// Reads a double-precision floating point value from a big-endian byte buffer.
     /// </summary>
-    static double ReadDoubleBigEndian(const uint8_t* buffer) {
-        return BitConverter::Int64BitsToDouble(ReadInt64BigEndian(buffer));
+    static double ReadDoubleBigEndian(const uint8_t* source) {
+        return Read<double>(source, false);
+    }
+
+    /// <summary>
+    /// Writes a signed 16-bit integer into a little-endian byte buffer.
+    /// </summary>
+    static void WriteInt16LittleEndian(uint8_t* destination, int16_t value) {
+        Write(destination, value, true);
+    }
+
+    /// <summary>
+    /// Writes a signed 16-bit integer into a big-endian byte buffer.
+    /// </summary>
+    static void WriteInt16BigEndian(uint8_t* destination, int16_t value) {
+        Write(destination, value, false);
     }
 
     /// <summary>
     /// Writes an unsigned 16-bit integer into a little-endian byte buffer.
     /// </summary>
-    static void WriteUInt16LittleEndian(uint8_t* buffer, uint16_t value) {
-        buffer[0] = static_cast<uint8_t>(value & 0xFF);
-        buffer[1] = static_cast<uint8_t>((value >> 8) & 0xFF);
+    static void WriteUInt16LittleEndian(uint8_t* destination, uint16_t value) {
+        Write(destination, value, true);
+    }
+
+    /// <summary>
+    /// Writes an unsigned 16-bit integer into a big-endian byte buffer.
+    /// </summary>
+    static void WriteUInt16BigEndian(uint8_t* destination, uint16_t value) {
+        Write(destination, value, false);
     }
 
     /// <summary>
     /// Writes a signed 32-bit integer into a little-endian byte buffer.
     /// </summary>
-    static void WriteInt32LittleEndian(uint8_t* buffer, int32_t value) {
-        WriteUInt32LittleEndian(buffer, static_cast<uint32_t>(value));
+    static void WriteInt32LittleEndian(uint8_t* destination, int32_t value) {
+        Write(destination, value, true);
+    }
+
+    /// <summary>
+    /// Writes a signed 32-bit integer into a big-endian byte buffer.
+    /// </summary>
+    static void WriteInt32BigEndian(uint8_t* destination, int32_t value) {
+        Write(destination, value, false);
     }
 
     /// <summary>
     /// Writes an unsigned 32-bit integer into a little-endian byte buffer.
     /// </summary>
-    static void WriteUInt32LittleEndian(uint8_t* buffer, uint32_t value) {
-        buffer[0] = static_cast<uint8_t>(value & 0xFF);
-        buffer[1] = static_cast<uint8_t>((value >> 8) & 0xFF);
-        buffer[2] = static_cast<uint8_t>((value >> 16) & 0xFF);
-        buffer[3] = static_cast<uint8_t>((value >> 24) & 0xFF);
+    static void WriteUInt32LittleEndian(uint8_t* destination, uint32_t value) {
+        Write(destination, value, true);
+    }
+
+    /// <summary>
+    /// Writes an unsigned 32-bit integer into a big-endian byte buffer.
+    /// </summary>
+    static void WriteUInt32BigEndian(uint8_t* destination, uint32_t value) {
+        Write(destination, value, false);
     }
 
     /// <summary>
     /// Writes a signed 64-bit integer into a little-endian byte buffer.
     /// </summary>
-    static void WriteInt64LittleEndian(uint8_t* buffer, int64_t value) {
-        WriteUInt64LittleEndian(buffer, static_cast<uint64_t>(value));
+    static void WriteInt64LittleEndian(uint8_t* destination, int64_t value) {
+        Write(destination, value, true);
     }
 
     /// <summary>
-    /// Writes a double-precision floating point value into a little-endian byte buffer.
+    /// Writes a signed 64-bit integer into a big-endian byte buffer.
     /// </summary>
-    static void WriteDoubleLittleEndian(uint8_t* buffer, double value) {
-        WriteInt64LittleEndian(buffer, BitConverter::DoubleToInt64Bits(value));
+    static void WriteInt64BigEndian(uint8_t* destination, int64_t value) {
+        Write(destination, value, false);
     }
 
     /// <summary>
-    /// Writes an unsigned 16-bit integer into a big-endian byte buffer.
+    /// Writes an unsigned 64-bit integer into a little-endian byte buffer.
     /// </summary>
-    static void WriteUInt16BigEndian(uint8_t* buffer, uint16_t value) {
-        buffer[0] = static_cast<uint8_t>((value >> 8) & 0xFF);
-        buffer[1] = static_cast<uint8_t>(value & 0xFF);
+    static void WriteUInt64LittleEndian(uint8_t* destination, uint64_t value) {
+        Write(destination, value, true);
     }
 
     /// <summary>
-    /// Writes a signed 32-bit integer into a big-endian byte buffer.
+    /// Writes an unsigned 64-bit integer into a big-endian byte buffer.
     /// </summary>
-    static void WriteInt32BigEndian(uint8_t* buffer, int32_t value) {
-        WriteUInt32BigEndian(buffer, static_cast<uint32_t>(value));
+    static void WriteUInt64BigEndian(uint8_t* destination, uint64_t value) {
+        Write(destination, value, false);
     }
 
     /// <summary>
-    /// Writes an unsigned 32-bit integer into a big-endian byte buffer.
+    /// Writes a native-sized signed integer into a little-endian byte buffer.
     /// </summary>
-    static void WriteUInt32BigEndian(uint8_t* buffer, uint32_t value) {
-        buffer[0] = static_cast<uint8_t>((value >> 24) & 0xFF);
-        buffer[1] = static_cast<uint8_t>((value >> 16) & 0xFF);
-        buffer[2] = static_cast<uint8_t>((value >> 8) & 0xFF);
-        buffer[3] = static_cast<uint8_t>(value & 0xFF);
+    static void WriteIntPtrLittleEndian(uint8_t* destination, intptr_t value) {
+        Write(destination, value, true);
     }
 
     /// <summary>
-    /// Writes a signed 64-bit integer into a big-endian byte buffer.
+    /// Writes a native-sized signed integer into a big-endian byte buffer.
+    /// </summary>
+    static void WriteIntPtrBigEndian(uint8_t* destination, intptr_t value) {
+        Write(destination, value, false);
+    }
+
+    /// <summary>
+    /// Writes a native-sized unsigned integer into a little-endian byte buffer.
+    /// </summary>
+    static void WriteUIntPtrLittleEndian(uint8_t* destination, uintptr_t value) {
+        Write(destination, value, true);
+    }
+
+    /// <summary>
+    /// Writes a native-sized unsigned integer into a big-endian byte buffer.
     /// </summary>
-    static void WriteInt64BigEndian(uint8_t* buffer, int64_t value) {
-        WriteUInt64BigEndian(buffer, static_cast<uint64_t>(value));
+    static void WriteUIntPtrBigEndian(uint8_t* destination, uintptr_t value) {
+        Write(destination, value, false);
+    }
+
+    /// <summary>
+    /// Writes a single-precision floating point value into a little-endian byte buffer.
+    /// </summary>
+    static void WriteSingleLittleEndian(uint8_t* destination, float value) {
+        Write(destination, value, true);
+    }
+
+    /// <summary>
+    /// Writes a single-precision floating point value into a big-endian byte buffer.
+    /// </summary>
+    static void WriteSingleBigEndian(uint8_t* destination, float value) {
+        Write(destination, value, false);
+    }
+
+    /// <summary>
+    /// Writes a double-precision floating point value into a little-endian byte buffer.
+    /// </summary>
+    static void WriteDoubleLittleEndian(uint8_t* destination, double value) {
+        Write(destination, value, true);
     }
 
     /// <summary>
     /// Writes a double-precision floating point value into a big-endian byte buffer.
     /// </summary>
-    static void WriteDoubleBigEndian(uint8_t* buffer, double value) {
-        WriteInt64BigEndian(buffer, BitConverter::DoubleToInt64Bits(value));
+    static void WriteDoubleBigEndian(uint8_t* destination, double value) {
+        Write(destination, value, false);
     }
 
-private:
     /// <summary>
-    /// Writes an unsigned 64-bit integer into a little-endian byte buffer.
+    /// Reads a signed 16-bit integer from a little-endian span, or returns false when the span is too short.
     /// </summary>
-    static void WriteUInt64LittleEndian(uint8_t* buffer, uint64_t value) {
-        buffer[0] = static_cast<uint8_t>(value & 0xFF);
-        buffer[1] = static_cast<uint8_t>((value >> 8) & 0xFF);
-        buffer[2] = static_cast<uint8_t>((value >> 16) & 0xFF);
-        buffer[3] = static_cast<uint8_t>((value >> 24) & 0xFF);
-        buffer[4] = static_cast<uint8_t>((value >> 32) & 0xFF);
-        buffer[5] = static_cast<uint8_t>((value >> 40) & 0xFF);
-        buffer[6] = static_cast<uint8_t>((value >> 48) & 0xFF);
-        buffer[7] = static_cast<uint8_t>((value >> 56) & 0xFF);
+    static bool TryReadInt16LittleEndian(ReadOnlySpan<uint8_t> source, int16_t& value) {
+        return TryRead(source, value, true);
     }
 
     /// <summary>
-    /// Writes an unsigned 64-bit integer into a big-endian byte buffer.
+    /// Reads a signed 16-bit integer from a big-endian span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryReadInt16BigEndian(ReadOnlySpan<uint8_t> source, int16_t& value) {
+        return TryRead(source, value, false);
+    }
+
+    /// <summary>
+    /// Reads an unsigned 16-bit integer from a little-endian span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryReadUInt16LittleEndian(ReadOnlySpan<uint8_t> source, uint16_t& value) {
+        return TryRead(source, value, true);
+    }
+
+    /// <summary>
+    /// Reads an unsigned 16-bit integer from a big-endian span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryReadUInt16BigEndian(ReadOnlySpan<uint8_t> source, uint16_t& value) {
+        return TryRead(source, value, false);
+    }
+
+    /// <summary>
+    /// Reads a signed 32-bit integer from a little-endian span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryReadInt32LittleEndian(ReadOnlySpan<uint8_t> source, int32_t& value) {
+        return TryRead(source, value, true);
+    }
+
+    /// <summary>
+    /// Reads a signed 32-bit integer from a big-endian span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryReadInt32BigEndian(ReadOnlySpan<uint8_t> source, int32_t& value) {
+        return TryRead(source, value, false);
+    }
+
+    /// <summary>
+    /// Reads an unsigned 32-bit integer from a little-endian span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryReadUInt32LittleEndian(ReadOnlySpan<uint8_t> source, uint32_t& value) {
+        return TryRead(source, value, true);
+    }
+
+    /// <summary>
+    /// Reads an unsigned 32-bit integer from a big-endian span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryReadUInt32BigEndian(ReadOnlySpan<uint8_t> source, uint32_t& value) {
+        return TryRead(source, value, false);
+    }
+
+    /// <summary>
+    /// Reads a signed 64-bit integer from a little-endian span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryReadInt64LittleEndian(ReadOnlySpan<uint8_t> source, int64_t& value) {
+        return TryRead(source, value, true);
+    }
+
+    /// <summary>
+    /// Reads a signed 64-bit integer from a big-endian span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryReadInt64BigEndian(ReadOnlySpan<uint8_t> source, int64_t& value) {
+        return TryRead(source, value, false);
+    }
+
+    /// <summary>
+    /// Reads an unsigned 64-bit integer from a little-endian span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryReadUInt64LittleEndian(ReadOnlySpan<uint8_t> source, uint64_t& value) {
+        return TryRead(source, value, true);
+    }
+
+    /// <summary>
+    /// Reads an unsigned 64-bit integer from a big-endian span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryReadUInt64BigEndian(ReadOnlySpan<uint8_t> source, uint64_t& value) {
+        return TryRead(source, value, false);
+    }
+
+    /// <summary>
+    /// Reads a native-sized signed integer from a little-endian span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryReadIntPtrLittleEndian(ReadOnlySpan<uint8_t> source, intptr_t& value) {
+        return TryRead(source, value, true);
+    }
+
+    /// <summary>
+    /// Reads a native-sized signed integer from a big-endian span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryReadIntPtrBigEndian(ReadOnlySpan<uint8_t> source, intptr_t& value) {
+        return TryRead(source, value, false);
+    }
+
+    /// <summary>
+    /// Reads a native-sized unsigned integer from a little-endian span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryReadUIntPtrLittleEndian(ReadOnlySpan<uint8_t> source, uintptr_t& value) {
+        return TryRead(source, value, true);
+    }
+
+    /// <summary>
+    /// Reads a native-sized unsigned integer from a big-endian span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryReadUIntPtrBigEndian(ReadOnlySpan<uint8_t> source, uintptr_t& value) {
+        return TryRead(source, value, false);
+    }
+
+    /// <summary>
+    /// Reads a single-precision floating point value from a little-endian span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryReadSingleLittleEndian(ReadOnlySpan<uint8_t> source, float& value) {
+        return TryRead(source, value, true);
+    }
+
+    /// <summary>
+    /// Reads a single-precision floating point value from a big-endian span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryReadSingleBigEndian(ReadOnlySpan<uint8_t> source, float& value) {
+        return TryRead(source, value, false);
+    }
+
+    /// <summary>
+    /// Reads a double-precision floating point value from a little-endian span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryReadDoubleLittleEndian(ReadOnlySpan<uint8_t> source, double& value) {
+        return TryRead(source, value, true);
+    }
+
+    /// <summary>
+    /// Reads a double-precision floating point value from a big-endian span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryReadDoubleBigEndian(ReadOnlySpan<uint8_t> source, double& value) {
+        return TryRead(source, value, false);
+    }
+
+    /// <summary>
+    /// Writes a signed 16-bit integer into a little-endian span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryWriteInt16LittleEndian(Span<uint8_t> destination, int16_t value) {
+        return TryWrite(destination, value, true);
+    }
+
+    /// <summary>
+    /// Writes a signed 16-bit integer into a big-endian span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryWriteInt16BigEndian(Span<uint8_t> destination, int16_t value) {
+        return TryWrite(destination, value, false);
+    }
+
+    /// <summary>
+    /// Writes an unsigned 16-bit integer into a little-endian span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryWriteUInt16LittleEndian(Span<uint8_t> destination, uint16_t value) {
+        return TryWrite(destination, value, true);
+    }
+
+    /// <summary>
+    /// Writes an unsigned 16-bit integer into a big-endian span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryWriteUInt16BigEndian(Span<uint8_t> destination, uint16_t value) {
+        return TryWrite(destination, value, false);
+    }
+
+    /// <summary>
+    /// Writes a signed 32-bit integer into a little-endian span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryWriteInt32LittleEndian(Span<uint8_t> destination, int32_t value) {
+        return TryWrite(destination, value, true);
+    }
+
+    /// <summary>
+    /// Writes a signed 32-bit integer into a big-endian span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryWriteInt32BigEndian(Span<uint8_t> destination, int32_t value) {
+        return TryWrite(destination, value, false);
+    }
+
+    /// <summary>
+    /// Writes an unsigned 32-bit integer into a little-endian span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryWriteUInt32LittleEndian(Span<uint8_t> destination, uint32_t value) {
+        return TryWrite(destination, value, true);
+    }
+
+    /// <summary>
+    /// Writes an unsigned 32-bit integer into a big-endian span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryWriteUInt32BigEndian(Span<uint8_t> destination, uint32_t value) {
+        return TryWrite(destination, value, false);
+    }
+
+    /// <summary>
+    /// Writes a signed 64-bit integer into a little-endian span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryWriteInt64LittleEndian(Span<uint8_t> destination, int64_t value) {
+        return TryWrite(destination, value, true);
+    }
+
+    /// <summary>
+    /// Writes a signed 64-bit integer into a big-endian span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryWriteInt64BigEndian(Span<uint8_t> destination, int64_t value) {
+        return TryWrite(destination, value, false);
+    }
+
+    /// <summary>
+    /// Writes an unsigned 64-bit integer into a little-endian span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryWriteUInt64LittleEndian(Span<uint8_t> destination, uint64_t value) {
+        return TryWrite(destination, value, true);
+    }
+
+    /// <summary>
+    /// Writes an unsigned 64-bit integer into a big-endian span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryWriteUInt64BigEndian(Span<uint8_t> destination, uint64_t value) {
+        return TryWrite(destination, value, false);
+    }
+
+    /// <summary>
+    /// Writes a native-sized signed integer into a little-endian span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryWriteIntPtrLittleEndian(Span<uint8_t> destination, intptr_t value) {
+        return TryWrite(destination, value, true);
+    }
+
+    /// <summary>
+    /// Writes a native-sized signed integer into a big-endian span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryWriteIntPtrBigEndian(Span<uint8_t> destination, intptr_t value) {
+        return TryWrite(destination, value, false);
+    }
+
+    /// <summary>
+    /// Writes a native-sized unsigned integer into a little-endian span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryWriteUIntPtrLittleEndian(Span<uint8_t> destination, uintptr_t value) {
+        return TryWrite(destination, value, true);
+    }
+
+    /// <summary>
+    /// Writes a native-sized unsigned integer into a big-endian span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryWriteUIntPtrBigEndian(Span<uint8_t> destination, uintptr_t value) {
+        return TryWrite(destination, value, false);
+    }
+
+    /// <summary>
+    /// Writes a single-precision floating point value into a little-endian span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryWriteSingleLittleEndian(Span<uint8_t> destination, float value) {
+        return TryWrite(destination, value, true);
+    }
+
+    /// <summary>
+    /// Writes a single-precision floating point value into a big-endian span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryWriteSingleBigEndian(Span<uint8_t> destination, float value) {
+        return TryWrite(destination, value, false);
+    }
+
+    /// <summary>
+    /// Writes a double-precision floating point value into a little-endian span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryWriteDoubleLittleEndian(Span<uint8_t> destination, double value) {
+        return TryWrite(destination, value, true);
+    }
+
+    /// <summary>
+    /// Writes a double-precision floating point value into a big-endian span, or returns false when the span is too short.
     /// </summary>
-    static void WriteUInt64BigEndian(uint8_t* buffer, uint64_t value) {
-        buffer[0] = static_cast<uint8_t>((value >> 56) & 0xFF);
-        buffer[1] = static_cast<uint8_t>((value >> 48) & 0xFF);
-        buffer[2] = static_cast<uint8_t>((value >> 40) & 0xFF);
-        buffer[3] = static_cast<uint8_t>((value >> 32) & 0xFF);
-        buffer[4] = static_cast<uint8_t>((value >> 24) & 0xFF);
-        buffer[5] = static_cast<uint8_t>((value >> 16) & 0xFF);
-        buffer[6] = static_cast<uint8_t>((value >> 8) & 0xFF);
-        buffer[7] = static_cast<uint8_t>(value & 0xFF);
+    static bool TryWriteDoubleBigEndian(Span<uint8_t> destination, double value) {
+        return TryWrite(destination, value, false);
     }
 };
@@ -1,56 +1,441 @@
 #pragma once
 
+#include <bit>
 #include <cstdint>
 #include <cstring>
+#include <type_traits>
 #include "../runtime/array.hpp"
+#include "../runtime/native_exceptions.hpp"
+#include "../runtime/native_span.hpp"
+#include "helcpp_config.hpp"
 
 /// <summary>
-/// Provides the minimal managed BitConverter surface required by transpiled serializer code.
+/// Byte order of the target. The generated config states it from the platform profile; hand-built runtimes fall back to
+/// the compiler's predefined byte-order macros.
+/// </summary>
+#ifndef HE_CPP_PLATFORM_IS_LITTLE_ENDIAN
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define HE_CPP_PLATFORM_IS_LITTLE_ENDIAN 0
+#else
+#define HE_CPP_PLATFORM_IS_LITTLE_ENDIAN 1
+#endif
+#endif
+
+/// <summary>
+/// Managed System.BitConverter in the target's byte order. The span overloads (TryWriteBytes and the To* readers over
+/// ReadOnlySpan) move each value with one memcpy and never allocate; GetBytes still returns a new managed array, as
+/// its managed signature requires.
 /// </summary>
 class BitConverter {
+    template <typename T>
+    static Array<uint8_t>* GetBytesOf(T value) {
+        Array<uint8_t>* bytes = new Array<uint8_t>(sizeof(value));
+        std::memcpy(bytes->Data, &value, sizeof(value));
+        return bytes;
+    }
+
+    template <typename T>
+    static bool TryWrite(const Span<uint8_t>& destination, T value) {
+        if (destination.Length < sizeof(value)) {
+            return false;
+        }
+
+        std::memcpy(destination.Data, &value, sizeof(value));
+        return true;
+    }
+
+    template <typename T>
+    static T Read(const ReadOnlySpan<uint8_t>& value) {
+        if (value.Length < sizeof(T)) {
+            throw ArgumentOutOfRangeException("value");
+        }
+
+        T result;
+        std::memcpy(&result, value.Data, sizeof(result));
+        return result;
+    }
+
+    template <typename T>
+    static T Read(Array<uint8_t>* value, int32_t startIndex) {
+        if (value == nullptr) {
+            throw ArgumentNullException("value");
+        }
+
+        if (startIndex < 0 || startIndex >= value->Length) {
+            throw ArgumentOutOfRangeException("startIndex");
+        }
+
+        if (startIndex > value->Length - static_cast<int32_t>(sizeof(T))) {
+            throw ArgumentException("Destination array is not long enough to copy all the items in the collection.", "value");
+        }
+
+        T result;
+        std::memcpy(&result, value->Data + startIndex, sizeof(result));
+        return result;
+    }
+
 public:
+    /// <summary>
+    /// Indicates whether the target stores multi-byte values least significant byte first.
+    /// </summary>
+    static constexpr bool IsLittleEndian = HE_CPP_PLATFORM_IS_LITTLE_ENDIAN != 0;
+
     /// <summary>
     /// Reinterprets the supplied integer bits as a single-precision floating point value.
     /// </summary>
-    static float Int32BitsToSingle(int32_t value) {
-        float result = 0.0f;
-        std::memcpy(&result, &value, sizeof(result));
-        return result;
+    static constexpr float Int32BitsToSingle(int32_t value) {
+        return std::bit_cast<float>(value);
+    }
+
+    /// <summary>
+    /// Reinterprets the supplied integer bits as a single-precision floating point value.
+    /// </summary>
+    static constexpr float UInt32BitsToSingle(uint32_t value) {
+        return std::bit_cast<float>(value);
     }
 
     /// <summary>
     /// Reinterprets the supplied integer bits as a double-precision floating point value.
     /// </summary>
-    static double Int64BitsToDouble(int64_t value) {
-        double result = 0.0;
-        std::memcpy(&result, &value, sizeof(result));
-        return result;
+    static constexpr double Int64BitsToDouble(int64_t value) {
+        return std::bit_cast<double>(value);
+    }
+
+    /// <summary>
+    /// Reinterprets the supplied integer bits as a double-precision floating point value.
+    /// </summary>
+    static constexpr double UInt64BitsToDouble(uint64_t value) {
+        return std::bit_cast<double>(value);
     }
 
     /// <summary>
     /// Reinterprets the supplied double-precision floating point value as a 64-bit integer bit pattern.
     /// </summary>
-    static int64_t DoubleToInt64Bits(double value) {
-        int64_t result = 0;
-        std::memcpy(&result, &value, sizeof(result));
-        return result;
+    static constexpr int64_t DoubleToInt64Bits(double value) {
+        return std::bit_cast<int64_t>(value);
+    }
+
+    /// <summary>
+    /// Reinterprets the supplied double-precision floating point value as an unsigned 64-bit integer bit pattern.
+    /// </summary>
+    static constexpr uint64_t DoubleToUInt64Bits(double value) {
+        return std::bit_cast<uint64_t>(value);
     }
 
     /// <summary>
     /// Reinterprets the supplied single-precision floating point value as a 32-bit integer bit pattern.
     /// </summary>
-    static int32_t SingleToInt32Bits(float value) {
-        int32_t result = 0;
-        std::memcpy(&result, &value, sizeof(result));
-        return result;
+    static constexpr int32_t SingleToInt32Bits(float value) {
+        return std::bit_cast<int32_t>(value);
+    }
+
+    /// <summary>
+    /// Reinterprets the supplied single-precision floating point value as an unsigned 32-bit integer bit pattern.
+    /// </summary>
+    static constexpr uint32_t SingleToUInt32Bits(float value) {
+        return std::bit_cast<uint32_t>(value);
+    }
+
+    /// <summary>
+    /// Packs a Boolean value into a new managed byte array.
+    /// </summary>
+    static Array<uint8_t>* GetBytes(bool value) {
+        return GetBytesOf(value);
+    }
+
+    /// <summary>
+    /// Packs a UTF-16 code unit into a new managed byte array.
+    /// </summary>
+    static Array<uint8_t>* GetBytes(char16_t value) {
+        return GetBytesOf(value);
+    }
+
+    /// <summary>
+    /// Packs a signed 16-bit integer into a new managed byte array.
+    /// </summary>
+    static Array<uint8_t>* GetBytes(int16_t value) {
+        return GetBytesOf(value);
+    }
+
+    /// <summary>
+    /// Packs an unsigned 16-bit integer into a new managed byte array.
+    /// </summary>
+    static Array<uint8_t>* GetBytes(uint16_t value) {
+        return GetBytesOf(value);
     }
 
     /// <summary>
-    /// Packs the supplied single-precision floating point value into a managed-style byte array.
+    /// Packs a signed 32-bit integer into a new managed byte array.
+    /// </summary>
+    static Array<uint8_t>* GetBytes(int32_t value) {
+        return GetBytesOf(value);
+    }
+
+    /// <summary>
+    /// Packs an unsigned 32-bit integer into a new managed byte array.
+    /// </summary>
+    static Array<uint8_t>* GetBytes(uint32_t value) {
+        return GetBytesOf(value);
+    }
+
+    /// <summary>
+    /// Packs a signed 64-bit integer into a new managed byte array.
+    /// </summary>
+    static Array<uint8_t>* GetBytes(int64_t value) {
+        return GetBytesOf(value);
+    }
+
+    /// <summary>
+    /// Packs an unsigned 64-bit integer into a new managed byte array.
+    /// </summary>
+    static Array<uint8_t>* GetBytes(uint64_t value) {
+        return GetBytesOf(value);
+    }
+
+    /// <summary>
+    /// Packs a single-precision floating point value into a new managed byte array.
     /// </summary>
     static Array<uint8_t>* GetBytes(float value) {
-        Array<uint8_t>* bytes = new Array<uint8_t>(sizeof(value));
-        std::memcpy(bytes->Data, &value, sizeof(value));
-        return bytes;
+        return GetBytesOf(value);
+    }
+
+    /// <summary>
+    /// Packs a double-precision floating point value into a new managed byte array.
+    /// </summary>
+    static Array<uint8_t>* GetBytes(double value) {
+        return GetBytesOf(value);
+    }
+
+    /// <summary>
+    /// Writes a Boolean value into the span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryWriteBytes(Span<uint8_t> destination, bool value) {
+        return TryWrite(destination, value);
+    }
+
+    /// <summary>
+    /// Writes a UTF-16 code unit into the span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryWriteBytes(Span<uint8_t> destination, char16_t value) {
+        return TryWrite(destination, value);
+    }
+
+    /// <summary>
+    /// Writes a signed 16-bit integer into the span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryWriteBytes(Span<uint8_t> destination, int16_t value) {
+        return TryWrite(destination, value);
+    }
+
+    /// <summary>
+    /// Writes an unsigned 16-bit integer into the span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryWriteBytes(Span<uint8_t> destination, uint16_t value) {
+        return TryWrite(destination, value);
+    }
+
+    /// <summary>
+    /// Writes a signed 32-bit integer into the span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryWriteBytes(Span<uint8_t> destination, int32_t value) {
+        return TryWrite(destination, value);
+    }
+
+    /// <summary>
+    /// Writes an unsigned 32-bit integer into the span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryWriteBytes(Span<uint8_t> destination, uint32_t value) {
+        return TryWrite(destination, value);
+    }
+
+    /// <summary>
+    /// Writes a signed 64-bit integer into the span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryWriteBytes(Span<uint8_t> destination, int64_t value) {
+        return TryWrite(destination, value);
+    }
+
+    /// <summary>
+    /// Writes an unsigned 64-bit integer into the span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryWriteBytes(Span<uint8_t> destination, uint64_t value) {
+        return TryWrite(destination, value);
+    }
+
+    /// <summary>
+    /// Writes a single-precision floating point value into the span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryWriteBytes(Span<uint8_t> destination, float value) {
+        return TryWrite(destination, value);
+    }
+
+    /// <summary>
+    /// Writes a double-precision floating point value into the span, or returns false when the span is too short.
+    /// </summary>
+    static bool TryWriteBytes(Span<uint8_t> destination, double value) {
+        return TryWrite(destination, value);
+    }
+
+    /// <summary>
+    /// Writes a value at an array offset without allocating. The converter rewrites
+    /// Array.Copy(BitConverter.GetBytes(value), 0, destination, destinationIndex, sizeof(value)) and
+    /// GetBytes(value).CopyTo(destination, destinationIndex) to this call, so it throws where those managed copies throw:
+    /// on a null array, a negative index, or a value that runs past the end of the array.
+    /// </summary>
+    template <typename T, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    static void WriteBytes(Array<uint8_t>* destination, int32_t destinationIndex, T value) {
+        if (destination == nullptr) {
+            throw ArgumentNullException("destination");
+        }
+
+        if (destinationIndex < 0) {
+            throw ArgumentOutOfRangeException("destinationIndex");
+        }
+
+        if (destinationIndex > destination->Length - static_cast<int32_t>(sizeof(value))) {
+            throw ArgumentException("Destination array was not long enough. Check the destination index, length, and the array's lower bounds.", "destination");
+        }
+
+        std::memcpy(destination->Data + destinationIndex, &value, sizeof(value));
+    }
+
+    /// <summary>
+    /// Reads a Boolean value from the array at <paramref name="startIndex"/>.
+    /// </summary>
+    static bool ToBoolean(Array<uint8_t>* value, int32_t startIndex) {
+        return Read<uint8_t>(value, startIndex) != 0;
+    }
+
+    /// <summary>
+    /// Reads a Boolean value from the start of the span.
+    /// </summary>
+    static bool ToBoolean(ReadOnlySpan<uint8_t> value) {
+        return Read<uint8_t>(value) != 0;
+    }
+
+    /// <summary>
+    /// Reads a UTF-16 code unit from the array at <paramref name="startIndex"/>.
+    /// </summary>
+    static char16_t ToChar(Array<uint8_t>* value, int32_t startIndex) {
+        return Read<char16_t>(value, startIndex);
+    }
+
+    /// <summary>
+    /// Reads a UTF-16 code unit from the start of the span.
+    /// </summary>
+    static char16_t ToChar(ReadOnlySpan<uint8_t> value) {
+        return Read<char16_t>(value);
+    }
+
+    /// <summary>
+    /// Reads a signed 16-bit integer from the array at <paramref name="startIndex"/>.
+    /// </summary>
+    static int16_t ToInt16(Array<uint8_t>* value, int32_t startIndex) {
+        return Read<int16_t>(value, startIndex);
+    }
+
+    /// <summary>
+    /// Reads a signed 16-bit integer from the start of the span.
+    /// </summary>
+    static int16_t ToInt16(ReadOnlySpan<uint8_t> value) {
+        return Read<int16_t>(value);
+    }
+
+    /// <summary>
+    /// Reads an unsigned 16-bit integer from the array at <paramref name="startIndex"/>.
+    /// </summary>
+    static uint16_t ToUInt16(Array<uint8_t>* value, int32_t startIndex) {
+        return Read<uint16_t>(value, startIndex);
+    }
+
+    /// <summary>
+    /// Reads an unsigned 16-bit integer from the start of the span.
+    /// </summary>
+    static uint16_t ToUInt16(ReadOnlySpan<uint8_t> value) {
+        return Read<uint16_t>(value);
+    }
+
+    /// <summary>
+    /// Reads a signed 32-bit integer from the array at <paramref name="startIndex"/>.
+    /// </summary>
+    static int32_t ToInt32(Array<uint8_t>* value, int32_t startIndex) {
+        return Read<int32_t>(value, startIndex);
+    }
+
+    /// <summary>
+    /// Reads a signed 32-bit integer from the start of the span.
+    /// </summary>
+    static int32_t ToInt32(ReadOnlySpan<uint8_t> value) {
+        return Read<int32_t>(value);
+    }
+
+    /// <summary>
+    /// Reads an unsigned 32-bit integer from the array at <paramref name="startIndex"/>.
+    /// </summary>
+    static uint32_t ToUInt32(Array<uint8_t>* value, int32_t startIndex) {
+        return Read<uint32_t>(value, startIndex);
+    }
+
+    /// <summary>
+    /// Reads an unsigned 32-bit integer from the start of the span.
+    /// </summary>
+    static uint32_t ToUInt32(ReadOnlySpan<uint8_t> value) {
+        return Read<uint32_t>(value);
+    }
+
+    /// <summary>
+    /// Reads a signed 64-bit integer from the array at <paramref name="startIndex"/>.
+    /// </summary>
+    static int64_t ToInt64(Array<uint8_t>* value, int32_t startIndex) {
+        return Read<int64_t>(value, startIndex);
+    }
+
+    /// <summary>
+    /// Reads a signed 64-bit integer from the start of the span.
+    /// </summary>
+    static int64_t ToInt64(ReadOnlySpan<uint8_t> value) {
+        return Read<int64_t>(value);
+    }
+
+    /// <summary>
+    /// Reads an unsigned 64-bit integer from the array at <paramref name="startIndex"/>.
+    /// </summary>
+    static uint64_t ToUInt64(Array<uint8_t>* value, int32_t startIndex) {
+        return Read<uint64_t>(value, startIndex);
+    }
+
+    /// <summary>
+    /// Reads an unsigned 64-bit integer from the start of the span.
+    /// </summary>
+    static uint64_t ToUInt64(ReadOnlySpan<uint8_t> value) {
+        return Read<uint64_t>(value);
+    }
+
+    /// <summary>
+    /// Reads a single-precision floating point value from the array at <paramref name="startIndex"/>.
+    /// </summary>
+    static float ToSingle(Array<uint8_t>* value, int32_t startIndex) {
+        return Read<float>(value, startIndex);
+    }
+
+    /// <summary>
+    /// Reads a single-precision floating point value from the start of the span.
+    /// </summary>
+    static float ToSingle(ReadOnlySpan<uint8_t> value) {
+        return Read<float>(value);
+    }
+
+    /// <summary>
+    /// Reads a double-precision floating point value from the array at <paramref name="startIndex"/>.
+    /// </summary>
+    static double ToDouble(Array<uint8_t>* value, int32_t startIndex) {
+        return Read<double>(value, startIndex);
+    }
+
+    /// <summary>
+    /// Reads a double-precision floating point value from the start of the span.
+    /// </summary>
+    static double ToDouble(ReadOnlySpan<uint8_t> value) {
+        return Read<double>(value);
     }
 };
@@ -1,107 +1,435 @@
 #ifndef HE_CPP_SYSTEM_BIT_OPERATIONS_HPP
 #define HE_CPP_SYSTEM_BIT_OPERATIONS_HPP
 
+#include <bit>
+#include <cstddef>
 #include <cstdint>
+#include <type_traits>
+#include "../runtime/native_span.hpp"
+#include "system/runtime/intrinsics/cpu_features.hpp"
+#include "system/runtime/intrinsics/simd_config.hpp"
 
+#if HE_CPP_SIMD_AVX2 || HE_CPP_SIMD_AVX2_DISPATCH
+#include <immintrin.h>
+#endif
+
+#if HE_CPP_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+/// <summary>
+/// Words of a bitset for the Harley-Seal population count below, one uint64_t at a time. Any target runs it, and it
+/// counts each sixteenth word only, which matters most where std::popcount has no instruction to lower to.
+/// </summary>
+struct BitOperationsScalarWords {
+    using Word = uint64_t;
+
+    static constexpr size_t WordLength = 1;
+
+    static void Load(Word& result, const uint64_t* data) {
+        result = *data;
+    }
+
+    static void Zero(Word& result) {
+        result = 0ull;
+    }
+
+    static void And(Word& result, const Word& left, const Word& right) {
+        result = left & right;
+    }
+
+    static void Or(Word& result, const Word& left, const Word& right) {
+        result = left | right;
+    }
+
+    static void Xor(Word& result, const Word& left, const Word& right) {
+        result = left ^ right;
+    }
+
+    static void AddCount(Word& total, const Word& value) {
+        total += static_cast<Word>(std::popcount(value));
+    }
+
+    static void ShiftLeft(Word& value, int32_t count) {
+        value <<= count;
+    }
+
+    static int64_t Sum(const Word& value) {
+        return static_cast<int64_t>(value);
+    }
+};
+
+#if HE_CPP_SIMD_AVX2 || HE_CPP_SIMD_AVX2_DISPATCH
+/// <summary>
+/// AVX2 words for the Harley-Seal population count: four uint64_t per register, counted with the nibble lookup in
+/// vpshufb and summed per 64-bit lane by vpsadbw.
+/// </summary>
+struct BitOperationsAvx2Words {
+    using Word = __m256i;
+
+    static constexpr size_t WordLength = 4;
+
+    HE_CPP_AVX2_TARGET static void Load(Word& result, const uint64_t* data) {
+        result = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+    }
+
+    HE_CPP_AVX2_TARGET static void Zero(Word& result) {
+        result = _mm256_setzero_si256();
+    }
+
+    HE_CPP_AVX2_TARGET static void And(Word& result, const Word& left, const Word& right) {
+        result = _mm256_and_si256(left, right);
+    }
+
+    HE_CPP_AVX2_TARGET static void Or(Word& result, const Word& left, const Word& right) {
+        result = _mm256_or_si256(left, right);
+    }
+
+    HE_CPP_AVX2_TARGET static void Xor(Word& result, const Word& left, const Word& right) {
+        result = _mm256_xor_si256(left, right);
+    }
+
+    HE_CPP_AVX2_TARGET static void AddCount(Word& total, const Word& value) {
+        const __m256i lookup = _mm256_setr_epi8(
+            0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+            0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        const __m256i lowNibbles = _mm256_set1_epi8(0x0F);
+        __m256i low = _mm256_and_si256(value, lowNibbles);
+        __m256i high = _mm256_and_si256(_mm256_srli_epi16(value, 4), lowNibbles);
+        __m256i counts = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, low), _mm256_shuffle_epi8(lookup, high));
+        total = _mm256_add_epi64(total, _mm256_sad_epu8(counts, _mm256_setzero_si256()));
+    }
+
+    HE_CPP_AVX2_TARGET static void ShiftLeft(Word& value, int32_t count) {
+        value = _mm256_sll_epi64(value, _mm_cvtsi32_si128(count));
+    }
+
+    HE_CPP_AVX2_TARGET static int64_t Sum(const Word& value) {
+        __m128i pairs = _mm_add_epi64(_mm256_castsi256_si128(value), _mm256_extracti128_si256(value, 1));
+        return _mm_cvtsi128_si64(_mm_add_epi64(pairs, _mm_unpackhi_epi64(pairs, pairs)));
+    }
+};
+#endif
+
+#if HE_CPP_SIMD_NEON
+/// <summary>
+/// NEON words for the Harley-Seal population count: two uint64_t per register, counted per byte by vcnt and widened
+/// to 64-bit lanes by pairwise adds.
+/// </summary>
+struct BitOperationsNeonWords {
+    using Word = uint64x2_t;
+
+    static constexpr size_t WordLength = 2;
+
+    static void Load(Word& result, const uint64_t* data) {
+        result = vld1q_u64(data);
+    }
+
+    static void Zero(Word& result) {
+        result = vdupq_n_u64(0ull);
+    }
+
+    static void And(Word& result, const Word& left, const Word& right) {
+        result = vandq_u64(left, right);
+    }
+
+    static void Or(Word& result, const Word& left, const Word& right) {
+        result = vorrq_u64(left, right);
+    }
+
+    static void Xor(Word& result, const Word& left, const Word& right) {
+        result = veorq_u64(left, right);
+    }
+
+    static void AddCount(Word& total, const Word& value) {
+        total = vaddq_u64(total, vpaddlq_u32(vpaddlq_u16(vpaddlq_u8(vcntq_u8(vreinterpretq_u8_u64(value))))));
+    }
+
+    static void ShiftLeft(Word& value, int32_t count) {
+        value = vshlq_u64(value, vdupq_n_s64(count));
+    }
+
+    static int64_t Sum(const Word& value) {
+        return static_cast<int64_t>(vaddvq_u64(value));
+    }
+};
+#endif
+
+/// <summary>
+/// Managed System.Numerics.BitOperations. The scalar members lower to std::popcount, std::countl_zero, std::countr_zero,
+/// and std::rotl/rotr, which compile to popcnt, lzcnt, tzcnt, and rol where the target has them, and stay usable in
+/// constant expressions. Integer types without an overload of their own (char, ushort, nuint spellings) widen the way
+/// C# converts them implicitly.
+/// </summary>
 class BitOperations {
-public:
-    static int32_t TrailingZeroCount(uint32_t value) {
-        if (value == 0) {
-            return 32;
+    template <typename T>
+    static constexpr bool IsWidenedInteger = std::is_integral_v<T> && !std::is_same_v<T, bool> &&
+        !std::is_same_v<T, int32_t> && !std::is_same_v<T, uint32_t> && !std::is_same_v<T, int64_t> && !std::is_same_v<T, uint64_t>;
+
+    template <typename T>
+    using WidenedUnsigned = std::conditional_t<(sizeof(T) <= sizeof(uint32_t)), uint32_t, uint64_t>;
+
+    template <typename T>
+    static constexpr WidenedUnsigned<T> Widen(T value) {
+        return static_cast<WidenedUnsigned<T>>(static_cast<std::make_unsigned_t<T>>(value));
+    }
+
+    /// <summary>
+    /// One carry-save adder step, folding <paramref name="second"/> and <paramref name="third"/> into
+    /// <paramref name="low"/> and carrying into <paramref name="high"/>. Words pass by reference here and through every
+    /// TWords operation: these kernels carry no target attribute, and an AVX register passed or returned by value
+    /// would change the calling convention.
+    /// </summary>
+    template <typename TWords>
+    HE_CPP_SIMD_ALWAYS_INLINE static void CarrySaveAdd(
+        typename TWords::Word& high,
+        typename TWords::Word& low,
+        const typename TWords::Word& second,
+        const typename TWords::Word& third) {
+        typename TWords::Word partial;
+        typename TWords::Word carries;
+        TWords::Xor(partial, low, second);
+        TWords::And(carries, low, second);
+        TWords::And(high, partial, third);
+        TWords::Or(high, high, carries);
+        TWords::Xor(low, partial, third);
+    }
+
+    template <typename TWords>
+    HE_CPP_SIMD_ALWAYS_INLINE static void CarrySaveAdd(typename TWords::Word& high, typename TWords::Word& low, const uint64_t* data) {
+        typename TWords::Word second;
+        typename TWords::Word third;
+        TWords::Load(second, data);
+        TWords::Load(third, data + TWords::WordLength);
+        CarrySaveAdd<TWords>(high, low, second, third);
+    }
+
+    /// <summary>
+    /// Harley-Seal population count: a carry-save adder tree folds sixteen words into ones, twos, fours, eights, and
+    /// one sixteens word, so only one word in sixteen is counted inside the loop.
+    /// </summary>
+    template <typename TWords>
+    HE_CPP_SIMD_ALWAYS_INLINE static int64_t PopCountWords(const uint64_t* data, size_t length) {
+        using Word = typename TWords::Word;
+        constexpr size_t BlockLength = 16 * TWords::WordLength;
+
+        Word total;
+        Word ones;
+        Word twos;
+        Word fours;
+        Word eights;
+        TWords::Zero(total);
+        TWords::Zero(ones);
+        TWords::Zero(twos);
+        TWords::Zero(fours);
+        TWords::Zero(eights);
+        Word twosA;
+        Word twosB;
+        Word foursA;
+        Word foursB;
+        Word eightsA;
+        Word eightsB;
+        Word sixteens;
+
+        size_t index = 0;
+        const size_t blockEnd = length - length % BlockLength;
+        for (; index < blockEnd; index += BlockLength) {
+            const uint64_t* block = data + index;
+            constexpr size_t Step = TWords::WordLength;
+            CarrySaveAdd<TWords>(twosA, ones, block);
+            CarrySaveAdd<TWords>(twosB, ones, block + 2 * Step);
+            CarrySaveAdd<TWords>(foursA, twos, twosA, twosB);
+            CarrySaveAdd<TWords>(twosA, ones, block + 4 * Step);
+            CarrySaveAdd<TWords>(twosB, ones, block + 6 * Step);
+            CarrySaveAdd<TWords>(foursB, twos, twosA, twosB);
+            CarrySaveAdd<TWords>(eightsA, fours, foursA, foursB);
+            CarrySaveAdd<TWords>(twosA, ones, block + 8 * Step);
+            CarrySaveAdd<TWords>(twosB, ones, block + 10 * Step);
+            CarrySaveAdd<TWords>(foursA, twos, twosA, twosB);
+            CarrySaveAdd<TWords>(twosA, ones, block + 12 * Step);
+            CarrySaveAdd<TWords>(twosB, ones, block + 14 * Step);
+            CarrySaveAdd<TWords>(foursB, twos, twosA, twosB);
+            CarrySaveAdd<TWords>(eightsB, fours, foursA, foursB);
+            CarrySaveAdd<TWords>(sixteens, eights, eightsA, eightsB);
+            TWords::AddCount(total, sixteens);
         }
 
-        int32_t count = 0;
-        while ((value & 1u) == 0u) {
-            value >>= 1;
-            ++count;
+        TWords::ShiftLeft(total, 1);
+        TWords::AddCount(total, eights);
+        TWords::ShiftLeft(total, 1);
+        TWords::AddCount(total, fours);
+        TWords::ShiftLeft(total, 1);
+        TWords::AddCount(total, twos);
+        TWords::ShiftLeft(total, 1);
+        TWords::AddCount(total, ones);
+        const size_t wordEnd = length - length % TWords::WordLength;
+        for (; index < wordEnd; index += TWords::WordLength) {
+            Word word;
+            TWords::Load(word, data + index);
+            TWords::AddCount(total, word);
         }
 
+        int64_t count = TWords::Sum(total);
+        for (; index < length; ++index) {
+            count += std::popcount(data[index]);
+        }
         return count;
     }
 
-    static int32_t TrailingZeroCount(int32_t value) {
+#if HE_CPP_SIMD_AVX2_DISPATCH
+    HE_CPP_AVX2_TARGET static int64_t PopCountAvx2(const uint64_t* data, size_t length) {
+        return PopCountWords<BitOperationsAvx2Words>(data, length);
+    }
+#endif
+
+public:
+    static constexpr bool IsPow2(int32_t value) {
+        return value > 0 && (value & (value - 1)) == 0;
+    }
+
+    static constexpr bool IsPow2(uint32_t value) {
+        return std::has_single_bit(value);
+    }
+
+    static constexpr bool IsPow2(int64_t value) {
+        return value > 0 && (value & (value - 1)) == 0;
+    }
+
+    static constexpr bool IsPow2(uint64_t value) {
+        return std::has_single_bit(value);
+    }
+
+    template <typename T, typename = std::enable_if_t<IsWidenedInteger<T>>>
+    static constexpr bool IsPow2(T value) {
+        return value > 0 && (value & (value - 1)) == 0;
+    }
+
+    static constexpr int32_t TrailingZeroCount(uint32_t value) {
+        return std::countr_zero(value);
+    }
+
+    static constexpr int32_t TrailingZeroCount(int32_t value) {
         return TrailingZeroCount(static_cast<uint32_t>(value));
     }
 
-    static int32_t LeadingZeroCount(uint32_t value) {
-        if (value == 0) {
-            return 32;
-        }
+    static constexpr int32_t TrailingZeroCount(uint64_t value) {
+        return std::countr_zero(value);
+    }
 
-        int32_t count = 0;
-        uint32_t mask = 0x80000000u;
-        while ((value & mask) == 0u) {
-            mask >>= 1;
-            ++count;
-        }
+    static constexpr int32_t TrailingZeroCount(int64_t value) {
+        return TrailingZeroCount(static_cast<uint64_t>(value));
+    }
 
-        return count;
+    template <typename T, typename = std::enable_if_t<IsWidenedInteger<T>>>
+    static constexpr int32_t TrailingZeroCount(T value) {
+        return TrailingZeroCount(Widen(value));
     }
 
-    static int32_t LeadingZeroCount(uint64_t value) {
-        if (value == 0) {
-            return 64;
-        }
+    static constexpr int32_t LeadingZeroCount(uint32_t value) {
+        return std::countl_zero(value);
+    }
 
-        int32_t count = 0;
-        uint64_t mask = 0x8000000000000000ull;
-        while ((value & mask) == 0ull) {
-            mask >>= 1;
-            ++count;
-        }
+    static constexpr int32_t LeadingZeroCount(uint64_t value) {
+        return std::countl_zero(value);
+    }
 
-        return count;
+    template <typename T, typename = std::enable_if_t<IsWidenedInteger<T>>>
+    static constexpr int32_t LeadingZeroCount(T value) {
+        return LeadingZeroCount(Widen(value));
     }
 
-    static int32_t PopCount(uint32_t value) {
-        int32_t count = 0;
-        while (value != 0u) {
-            count += static_cast<int32_t>(value & 1u);
-            value >>= 1;
-        }
+    static constexpr int32_t PopCount(uint32_t value) {
+        return std::popcount(value);
+    }
 
-        return count;
+    static constexpr int32_t PopCount(uint64_t value) {
+        return std::popcount(value);
     }
 
-    static int32_t Log2(uint32_t value) {
-        if (value == 0u) {
-            return 0;
+    template <typename T, typename = std::enable_if_t<IsWidenedInteger<T>>>
+    static constexpr int32_t PopCount(T value) {
+        return PopCount(Widen(value));
+    }
+
+    /// <summary>
+    /// Counts the set bits of a whole bitset. Spans of at least sixteen registers run the Harley-Seal kernel in AVX2
+    /// (entered at run time on x86-64 builds that do not target it), NEON, or 64-bit scalar words.
+    /// </summary>
+    static int64_t PopCount(ReadOnlySpan<uint64_t> values) {
+        const uint64_t* data = values.Data;
+        size_t length = values.Length;
+#if HE_CPP_SIMD_AVX2
+        return PopCountWords<BitOperationsAvx2Words>(data, length);
+#elif HE_CPP_SIMD_NEON
+        return PopCountWords<BitOperationsNeonWords>(data, length);
+#else
+#if HE_CPP_SIMD_AVX2_DISPATCH
+        if (CpuFeatures::HasAvx2()) {
+            return PopCountAvx2(data, length);
         }
+#endif
+        return PopCountWords<BitOperationsScalarWords>(data, length);
+#endif
+    }
 
-        return 31 - LeadingZeroCount(value);
+    static constexpr int32_t Log2(uint32_t value) {
+        return 31 - std::countl_zero(value | 1u);
     }
 
-    static int32_t Log2(int32_t value) {
+    static constexpr int32_t Log2(int32_t value) {
         return Log2(static_cast<uint32_t>(value));
     }
 
-    static uint32_t RoundUpToPowerOf2(uint32_t value) {
-        if (value == 0u) {
-            return 0u;
-        }
+    static constexpr int32_t Log2(uint64_t value) {
+        return 63 - std::countl_zero(value | 1ull);
+    }
 
-        --value;
-        value |= value >> 1;
-        value |= value >> 2;
-        value |= value >> 4;
-        value |= value >> 8;
-        value |= value >> 16;
-        return value + 1u;
+    template <typename T, typename = std::enable_if_t<IsWidenedInteger<T>>>
+    static constexpr int32_t Log2(T value) {
+        return Log2(Widen(value));
     }
 
-    static uint64_t RoundUpToPowerOf2(uint64_t value) {
-        if (value == 0ull) {
-            return 0ull;
-        }
+    static constexpr uint32_t RotateLeft(uint32_t value, int32_t offset) {
+        return std::rotl(value, offset & 31);
+    }
+
+    static constexpr uint64_t RotateLeft(uint64_t value, int32_t offset) {
+        return std::rotl(value, offset & 63);
+    }
+
+    template <typename T, typename = std::enable_if_t<IsWidenedInteger<T>>>
+    static constexpr WidenedUnsigned<T> RotateLeft(T value, int32_t offset) {
+        return RotateLeft(Widen(value), offset);
+    }
+
+    static constexpr uint32_t RotateRight(uint32_t value, int32_t offset) {
+        return std::rotr(value, offset & 31);
+    }
+
+    static constexpr uint64_t RotateRight(uint64_t value, int32_t offset) {
+        return std::rotr(value, offset & 63);
+    }
+
+    template <typename T, typename = std::enable_if_t<IsWidenedInteger<T>>>
+    static constexpr WidenedUnsigned<T> RotateRight(T value, int32_t offset) {
+        return RotateRight(Widen(value), offset);
+    }
+
+    /// <summary>
+    /// Rounds up to the next power of two, returning 0 for 0 and for values above the largest power of two, as the
+    /// managed API does; std::bit_ceil leaves both undefined.
+    /// </summary>
+    static constexpr uint32_t RoundUpToPowerOf2(uint32_t value) {
+        return value - 1u >= 0x80000000u ? 0u : std::bit_ceil(value);
+    }
+
+    static constexpr uint64_t RoundUpToPowerOf2(uint64_t value) {
+        return value - 1ull >= 0x8000000000000000ull ? 0ull : std::bit_ceil(value);
+    }
 
-        --value;
-        value |= value >> 1;
-        value |= value >> 2;
-        value |= value >> 4;
-        value |= value >> 8;
-        value |= value >> 16;
-        value |= value >> 32;
-        return value + 1ull;
+    template <typename T, typename = std::enable_if_t<IsWidenedInteger<T>>>
+    static constexpr WidenedUnsigned<T> RoundUpToPowerOf2(T value) {
+        return RoundUpToPowerOf2(Widen(value));
     }
 };
 
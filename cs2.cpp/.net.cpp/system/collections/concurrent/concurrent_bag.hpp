@@ -0,0 +1,235 @@
+#ifndef HE_CPP_SYSTEM_COLLECTIONS_CONCURRENT_CONCURRENT_BAG_HPP
+#define HE_CPP_SYSTEM_COLLECTIONS_CONCURRENT_CONCURRENT_BAG_HPP
+
+#include "helcpp_config.hpp"
+#include "runtime/array.hpp"
+#include "system/collections/concurrent/concurrent_collection_lock.hpp"
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <utility>
+#include <vector>
+
+#if HE_CPP_CONCURRENT_COLLECTIONS_THREADED
+#include <thread>
+#endif
+
+/// <summary>
+/// Unordered thread-safe collection matching System.Collections.Concurrent.ConcurrentBag. Every thread that adds to a
+/// bag gets its own list: the owner adds and takes at the back under a lock no other thread touches unless it runs out
+/// of items, and an empty thread steals from the front of another thread's list. A producer that also consumes its own
+/// items therefore never contends with other threads.
+/// </summary>
+template <typename T>
+class ConcurrentBag {
+public:
+    ConcurrentBag()
+        : id(NextBagId()) {
+    }
+
+    ~ConcurrentBag() {
+        ThreadList* list = lists.load(std::memory_order_relaxed);
+        while (list != nullptr) {
+            ThreadList* next = list->Next;
+            delete list;
+            list = next;
+        }
+    }
+
+    ConcurrentBag(const ConcurrentBag&) = delete;
+    ConcurrentBag& operator=(const ConcurrentBag&) = delete;
+
+    void Add(const T& item) {
+        ThreadList& list = LocalList();
+        ConcurrentCollectionLockScope scope(list.Lock);
+        list.Items.push_back(item);
+        list.Count.store(list.Count.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    /// <summary>
+    /// Takes the calling thread's most recently added item, or steals the oldest item of another thread's list.
+    /// </summary>
+    bool TryTake(T& item) {
+        ThreadList& local = LocalList();
+        if (TryTakeFrom(local, true, item)) {
+            return true;
+        }
+
+        for (ThreadList* list = lists.load(std::memory_order_acquire); list != nullptr; list = list->Next) {
+            if (list != &local && TryTakeFrom(*list, false, item)) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool TryPeek(T& item) {
+        ThreadList& local = LocalList();
+        if (TryPeekAt(local, true, item)) {
+            return true;
+        }
+
+        for (ThreadList* list = lists.load(std::memory_order_acquire); list != nullptr; list = list->Next) {
+            if (list != &local && TryPeekAt(*list, false, item)) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    int32_t get_Count() const {
+        int32_t count = 0;
+        for (const ThreadList* list = lists.load(std::memory_order_acquire); list != nullptr; list = list->Next) {
+            count += list->Count.load(std::memory_order_acquire);
+        }
+
+        return count;
+    }
+
+    int32_t Count() const {
+        return get_Count();
+    }
+
+    bool get_IsEmpty() const {
+        return get_Count() == 0;
+    }
+
+    void Clear() {
+        for (ThreadList* list = lists.load(std::memory_order_acquire); list != nullptr; list = list->Next) {
+            ConcurrentCollectionLockScope scope(list->Lock);
+            list->Items.clear();
+            list->Count.store(0, std::memory_order_release);
+        }
+    }
+
+    Array<T>* ToArray() {
+        std::vector<T> items;
+        for (ThreadList* list = lists.load(std::memory_order_acquire); list != nullptr; list = list->Next) {
+            ConcurrentCollectionLockScope scope(list->Lock);
+            items.insert(items.end(), list->Items.begin(), list->Items.end());
+        }
+
+        Array<T>* values = new Array<T>(static_cast<int32_t>(items.size()));
+        for (int32_t index = 0; index < values->Length; index++) {
+            (*values)[index] = items[static_cast<size_t>(index)];
+        }
+
+        return values;
+    }
+
+private:
+    /// <summary>
+    /// One thread's items. Lists are only ever pushed onto the bag, so they can be walked without a lock, and they
+    /// outlive their thread so that other threads can still steal what it left behind.
+    /// </summary>
+    struct ThreadList {
+        ConcurrentCollectionLock Lock;
+        std::deque<T> Items;
+        std::atomic<int32_t> Count { 0 };
+#if HE_CPP_CONCURRENT_COLLECTIONS_THREADED
+        std::thread::id Owner;
+#endif
+        ThreadList* Next = nullptr;
+    };
+
+    /// <summary>
+    /// The calling thread's most recently used list, keyed by bag id rather than address so a bag allocated where a
+    /// destroyed one lived never picks up a stale list.
+    /// </summary>
+    struct LocalListCache {
+        uint64_t BagId = 0;
+        ThreadList* List = nullptr;
+    };
+
+    static uint64_t NextBagId() {
+        static std::atomic<uint64_t> nextId(1);
+        return nextId.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    static LocalListCache& LocalCache() {
+#if HE_CPP_CONCURRENT_COLLECTIONS_THREADED
+        static thread_local LocalListCache cache;
+#else
+        static LocalListCache cache;
+#endif
+        return cache;
+    }
+
+    ThreadList& LocalList() {
+        LocalListCache& cache = LocalCache();
+        if (cache.BagId == id) {
+            return *cache.List;
+        }
+
+        ThreadList* owned = nullptr;
+#if HE_CPP_CONCURRENT_COLLECTIONS_THREADED
+        const std::thread::id self = std::this_thread::get_id();
+        for (ThreadList* list = lists.load(std::memory_order_acquire); list != nullptr; list = list->Next) {
+            if (list->Owner == self) {
+                owned = list;
+                break;
+            }
+        }
+#else
+        owned = lists.load(std::memory_order_relaxed);
+#endif
+
+        if (owned == nullptr) {
+            owned = new ThreadList();
+#if HE_CPP_CONCURRENT_COLLECTIONS_THREADED
+            owned->Owner = self;
+#endif
+            ThreadList* headList = lists.load(std::memory_order_relaxed);
+            do {
+                owned->Next = headList;
+            } while (!lists.compare_exchange_weak(headList, owned, std::memory_order_release, std::memory_order_relaxed));
+        }
+
+        cache.BagId = id;
+        cache.List = owned;
+        return *owned;
+    }
+
+    static bool TryTakeFrom(ThreadList& list, bool newest, T& item) {
+        if (list.Count.load(std::memory_order_acquire) == 0) {
+            return false;
+        }
+
+        ConcurrentCollectionLockScope scope(list.Lock);
+        if (list.Items.empty()) {
+            return false;
+        }
+
+        if (newest) {
+            item = std::move(list.Items.back());
+            list.Items.pop_back();
+        } else {
+            item = std::move(list.Items.front());
+            list.Items.pop_front();
+        }
+
+        list.Count.store(list.Count.load(std::memory_order_relaxed) - 1, std::memory_order_release);
+        return true;
+    }
+
+    static bool TryPeekAt(ThreadList& list, bool newest, T& item) {
+        if (list.Count.load(std::memory_order_acquire) == 0) {
+            return false;
+        }
+
+        ConcurrentCollectionLockScope scope(list.Lock);
+        if (list.Items.empty()) {
+            return false;
+        }
+
+        item = newest ? list.Items.back() : list.Items.front();
+        return true;
+    }
+
+    const uint64_t id;
+    std::atomic<ThreadList*> lists { nullptr };
+};
+
+#endif // HE_CPP_SYSTEM_COLLECTIONS_CONCURRENT_CONCURRENT_BAG_HPP
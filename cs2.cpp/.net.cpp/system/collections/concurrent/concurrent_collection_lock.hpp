@@ -0,0 +1,69 @@
+#ifndef HE_CPP_SYSTEM_COLLECTIONS_CONCURRENT_CONCURRENT_COLLECTION_LOCK_HPP
+#define HE_CPP_SYSTEM_COLLECTIONS_CONCURRENT_CONCURRENT_COLLECTION_LOCK_HPP
+
+#include "helcpp_config.hpp"
+#include <cstddef>
+
+#if HE_CPP_PLATFORM_PS2 || HE_CPP_PLATFORM_N64 || HE_CPP_PLATFORM_DS || HE_CPP_RUNTIME_CUSTOM_RETRO
+#define HE_CPP_CONCURRENT_COLLECTIONS_THREADED 0
+#else
+#define HE_CPP_CONCURRENT_COLLECTIONS_THREADED 1
+#endif
+
+#if HE_CPP_CONCURRENT_COLLECTIONS_THREADED
+#include <mutex>
+#endif
+
+/// <summary>
+/// Cache-line size used to keep independently written collection state on separate lines.
+/// </summary>
+#ifndef HE_CPP_CONCURRENT_CACHE_LINE_SIZE
+#define HE_CPP_CONCURRENT_CACHE_LINE_SIZE 64
+#endif
+
+/// <summary>
+/// Writer lock used by the concurrent collections. It parks contended writers in the OS instead of spinning, and
+/// compiles to nothing on targets without threads.
+/// </summary>
+class ConcurrentCollectionLock {
+public:
+    void Lock() {
+#if HE_CPP_CONCURRENT_COLLECTIONS_THREADED
+        mutex.lock();
+#endif
+    }
+
+    void Unlock() {
+#if HE_CPP_CONCURRENT_COLLECTIONS_THREADED
+        mutex.unlock();
+#endif
+    }
+
+private:
+#if HE_CPP_CONCURRENT_COLLECTIONS_THREADED
+    std::mutex mutex;
+#endif
+};
+
+/// <summary>
+/// Holds one <see cref="ConcurrentCollectionLock"/> for the enclosing scope.
+/// </summary>
+class ConcurrentCollectionLockScope {
+public:
+    explicit ConcurrentCollectionLockScope(ConcurrentCollectionLock& heldLock)
+        : held(heldLock) {
+        held.Lock();
+    }
+
+    ~ConcurrentCollectionLockScope() {
+        held.Unlock();
+    }
+
+    ConcurrentCollectionLockScope(const ConcurrentCollectionLockScope&) = delete;
+    ConcurrentCollectionLockScope& operator=(const ConcurrentCollectionLockScope&) = delete;
+
+private:
+    ConcurrentCollectionLock& held;
+};
+
+#endif // HE_CPP_SYSTEM_COLLECTIONS_CONCURRENT_CONCURRENT_COLLECTION_LOCK_HPP
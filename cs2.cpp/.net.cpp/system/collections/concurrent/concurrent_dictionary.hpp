@@ -0,0 +1,632 @@
+#ifndef HE_CPP_SYSTEM_COLLECTIONS_CONCURRENT_CONCURRENT_DICTIONARY_HPP
+#define HE_CPP_SYSTEM_COLLECTIONS_CONCURRENT_CONCURRENT_DICTIONARY_HPP
+
+#include "helcpp_config.hpp"
+#include "runtime/array.hpp"
+#include "runtime/native_dictionary.hpp"
+#include "runtime/native_exceptions.hpp"
+#include "system/collections/concurrent/concurrent_collection_lock.hpp"
+#include "system/collections/generic/key_value_pair.hpp"
+#include "system/threading/epoch_reclamation.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if HE_CPP_CONCURRENT_COLLECTIONS_THREADED
+#include <thread>
+#endif
+
+class StringComparer;
+
+/// <summary>
+/// Thread-safe hash map matching System.Collections.Concurrent.ConcurrentDictionary. Writers serialize on one of a
+/// fixed set of striped locks chosen by key hash, so writers to different stripes never contend. Readers take no lock:
+/// buckets are atomic chains of immutable nodes, an update publishes a replacement node, and unlinked nodes and
+/// replaced tables are freed through <see cref="EpochReclamation"/> once no reader can still reach them. Growing the
+/// table takes every stripe and republishes copies of the live nodes, so a reader walking the old table never follows
+/// a link into a different chain.
+/// </summary>
+template <typename TKey, typename TValue>
+class ConcurrentDictionary {
+    struct Node;
+
+    /// <summary>
+    /// Accepts generated Func pointers and plain callables as value factories, but never a value that could itself be
+    /// stored, so GetOrAdd(key, value) keeps resolving to the value overload.
+    /// </summary>
+    template <typename TFactory, typename... TArgs>
+    static constexpr bool IsFactory =
+        std::is_invocable_r_v<TValue, std::remove_pointer_t<std::decay_t<TFactory>>&, TArgs...> &&
+        !std::is_convertible_v<TFactory, TValue>;
+
+public:
+    /// <summary>
+    /// Snapshot enumerator returned by begin(). Like the managed enumerator it never blocks writers; it walks a copy of
+    /// the pairs that were present while the snapshot was taken.
+    /// </summary>
+    class Enumerator {
+    public:
+        Enumerator() = default;
+
+        explicit Enumerator(std::shared_ptr<std::vector<KeyValuePair<TKey, TValue>>> snapshotItems)
+            : items(std::move(snapshotItems)) {
+        }
+
+        const KeyValuePair<TKey, TValue>& operator*() const {
+            return (*items)[index];
+        }
+
+        const KeyValuePair<TKey, TValue>* operator->() const {
+            return &(*items)[index];
+        }
+
+        Enumerator& operator++() {
+            ++index;
+            return *this;
+        }
+
+        bool operator==(const Enumerator& other) const {
+            return IsAtEnd() == other.IsAtEnd() && (IsAtEnd() || (items == other.items && index == other.index));
+        }
+
+        bool operator!=(const Enumerator& other) const {
+            return !(*this == other);
+        }
+
+    private:
+        bool IsAtEnd() const {
+            return items == nullptr || index >= items->size();
+        }
+
+        std::shared_ptr<std::vector<KeyValuePair<TKey, TValue>>> items;
+        size_t index = 0;
+    };
+
+    ConcurrentDictionary()
+        : ConcurrentDictionary(DefaultConcurrencyLevel(), DefaultCapacity) {
+    }
+
+    explicit ConcurrentDictionary(const StringComparer&)
+        : ConcurrentDictionary() {
+    }
+
+    ConcurrentDictionary(int32_t concurrencyLevel, int32_t capacity) {
+        if (concurrencyLevel < 1) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+            throw ArgumentOutOfRangeException();
+#else
+            throw ArgumentOutOfRangeException("concurrencyLevel");
+#endif
+        }
+
+        if (capacity < 0) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+            throw ArgumentOutOfRangeException();
+#else
+            throw ArgumentOutOfRangeException("capacity");
+#endif
+        }
+
+        stripeCount = RoundUpToPowerOfTwo(static_cast<size_t>(concurrencyLevel) < MaxStripeCount ? static_cast<size_t>(concurrencyLevel) : MaxStripeCount);
+        stripes = new Stripe[stripeCount];
+        size_t bucketCount = RoundUpToPowerOfTwo(static_cast<size_t>(capacity));
+        table.store(new Table(bucketCount > stripeCount ? bucketCount : stripeCount), std::memory_order_release);
+    }
+
+    ~ConcurrentDictionary() {
+        delete table.load(std::memory_order_relaxed);
+        delete[] stripes;
+    }
+
+    ConcurrentDictionary(const ConcurrentDictionary&) = delete;
+    ConcurrentDictionary& operator=(const ConcurrentDictionary&) = delete;
+
+    /// <summary>
+    /// Looks up one key without taking a lock.
+    /// </summary>
+    bool TryGetValue(const TKey& key, TValue& value) const {
+        EpochReclamation::Guard guard;
+        const Node* node = Find(key, HashKey(key));
+        if (node == nullptr) {
+            return false;
+        }
+
+        value = node->Value;
+        return true;
+    }
+
+    bool ContainsKey(const TKey& key) const {
+        EpochReclamation::Guard guard;
+        return Find(key, HashKey(key)) != nullptr;
+    }
+
+    TValue get_Item(const TKey& key) const {
+        TValue value {};
+        if (!TryGetValue(key, value)) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+            throw KeyNotFoundException();
+#else
+            throw KeyNotFoundException("The given key was not present in the dictionary.");
+#endif
+        }
+
+        return value;
+    }
+
+    void set_Item(const TKey& key, const TValue& value) {
+        TValue existing {};
+        Upsert(key, HashKey(key), value, true, existing);
+    }
+
+    bool TryAdd(const TKey& key, const TValue& value) {
+        TValue existing {};
+        return Upsert(key, HashKey(key), value, false, existing);
+    }
+
+    /// <summary>
+    /// Returns the existing value for <paramref name="key"/>, or adds <paramref name="value"/> when it is absent.
+    /// </summary>
+    TValue GetOrAdd(const TKey& key, const TValue& value) {
+        const size_t hash = HashKey(key);
+        {
+            EpochReclamation::Guard guard;
+            const Node* node = Find(key, hash);
+            if (node != nullptr) {
+                return node->Value;
+            }
+        }
+
+        TValue existing {};
+        return Upsert(key, hash, value, false, existing) ? value : existing;
+    }
+
+    /// <summary>
+    /// Returns the existing value for <paramref name="key"/>, or adds the factory's value when it is absent. As in
+    /// .NET the factory runs outside the lock, so racing callers may each invoke it while only one value is stored.
+    /// </summary>
+    template <typename TFactory>
+        requires IsFactory<TFactory, const TKey&>
+    TValue GetOrAdd(const TKey& key, TFactory valueFactory) {
+        const size_t hash = HashKey(key);
+        {
+            EpochReclamation::Guard guard;
+            const Node* node = Find(key, hash);
+            if (node != nullptr) {
+                return node->Value;
+            }
+        }
+
+        const TValue value = InvokeFactory(valueFactory, key);
+        TValue existing {};
+        return Upsert(key, hash, value, false, existing) ? value : existing;
+    }
+
+    /// <summary>
+    /// Adds <paramref name="addValue"/> when the key is absent, otherwise replaces the current value with the update
+    /// factory's result. The factory runs outside the lock and is retried if another writer changed the value first.
+    /// </summary>
+    template <typename TUpdateFactory>
+        requires IsFactory<TUpdateFactory, const TKey&, const TValue&>
+    TValue AddOrUpdate(const TKey& key, const TValue& addValue, TUpdateFactory updateValueFactory) {
+        const size_t hash = HashKey(key);
+        for (;;) {
+            TValue current {};
+            if (TryGetValueWithHash(key, hash, current)) {
+                const TValue updated = InvokeFactory(updateValueFactory, key, current);
+                if (TryReplace(key, hash, updated, current)) {
+                    return updated;
+                }
+            } else {
+                TValue existing {};
+                if (Upsert(key, hash, addValue, false, existing)) {
+                    return addValue;
+                }
+            }
+        }
+    }
+
+    template <typename TAddFactory, typename TUpdateFactory>
+        requires IsFactory<TAddFactory, const TKey&> && IsFactory<TUpdateFactory, const TKey&, const TValue&>
+    TValue AddOrUpdate(const TKey& key, TAddFactory addValueFactory, TUpdateFactory updateValueFactory) {
+        const size_t hash = HashKey(key);
+        for (;;) {
+            TValue current {};
+            if (TryGetValueWithHash(key, hash, current)) {
+                const TValue updated = InvokeFactory(updateValueFactory, key, current);
+                if (TryReplace(key, hash, updated, current)) {
+                    return updated;
+                }
+            } else {
+                const TValue added = InvokeFactory(addValueFactory, key);
+                TValue existing {};
+                if (Upsert(key, hash, added, false, existing)) {
+                    return added;
+                }
+            }
+        }
+    }
+
+    /// <summary>
+    /// Replaces the value for <paramref name="key"/> only while it still equals <paramref name="comparisonValue"/>.
+    /// </summary>
+    bool TryUpdate(const TKey& key, const TValue& newValue, const TValue& comparisonValue) {
+        return TryReplace(key, HashKey(key), newValue, comparisonValue);
+    }
+
+    bool TryRemove(const TKey& key, TValue& value) {
+        const size_t hash = HashKey(key);
+        Stripe& stripe = stripes[hash & (stripeCount - 1)];
+        Node* removed = nullptr;
+        {
+            ConcurrentCollectionLockScope scope(stripe.Lock);
+            Table* current = table.load(std::memory_order_relaxed);
+            std::atomic<Node*>* link = &current->Buckets[hash & current->Mask];
+            for (Node* node = link->load(std::memory_order_relaxed); node != nullptr; node = node->Next.load(std::memory_order_relaxed)) {
+                if (node->Hash == hash && keyEqual(node->Key, key)) {
+                    link->store(node->Next.load(std::memory_order_relaxed), std::memory_order_release);
+                    stripe.Count.store(stripe.Count.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+                    removed = node;
+                    break;
+                }
+
+                link = &node->Next;
+            }
+        }
+
+        if (removed == nullptr) {
+            return false;
+        }
+
+        value = removed->Value;
+        EpochReclamation::Retire(removed);
+        return true;
+    }
+
+    bool TryRemove(const TKey& key) {
+        TValue value {};
+        return TryRemove(key, value);
+    }
+
+    void Clear() {
+        Table* replaced = nullptr;
+        LockAllStripes();
+        replaced = table.load(std::memory_order_relaxed);
+        const size_t bucketCount = RoundUpToPowerOfTwo(static_cast<size_t>(DefaultCapacity));
+        table.store(new Table(bucketCount > stripeCount ? bucketCount : stripeCount), std::memory_order_release);
+        for (size_t index = 0; index < stripeCount; ++index) {
+            stripes[index].Count.store(0, std::memory_order_relaxed);
+        }
+
+        UnlockAllStripes();
+        EpochReclamation::Retire(replaced);
+    }
+
+    /// <summary>
+    /// Sums the per-stripe counts without locking; the result is exact whenever no writer is running.
+    /// </summary>
+    int32_t get_Count() const {
+        int32_t count = 0;
+        for (size_t index = 0; index < stripeCount; ++index) {
+            count += stripes[index].Count.load(std::memory_order_relaxed);
+        }
+
+        return count;
+    }
+
+    int32_t Count() const {
+        return get_Count();
+    }
+
+    bool get_IsEmpty() const {
+        return get_Count() == 0;
+    }
+
+    std::vector<TKey> get_Keys() const {
+        std::vector<TKey> keys;
+        EpochReclamation::Guard guard;
+        ForEachNode([&keys](const Node* node) {
+            keys.push_back(node->Key);
+        });
+
+        return keys;
+    }
+
+    std::vector<TValue> get_Values() const {
+        std::vector<TValue> values;
+        EpochReclamation::Guard guard;
+        ForEachNode([&values](const Node* node) {
+            values.push_back(node->Value);
+        });
+
+        return values;
+    }
+
+    Array<KeyValuePair<TKey, TValue>>* ToArray() const {
+        std::shared_ptr<std::vector<KeyValuePair<TKey, TValue>>> pairs = Snapshot();
+        Array<KeyValuePair<TKey, TValue>>* values = new Array<KeyValuePair<TKey, TValue>>(static_cast<int32_t>(pairs->size()));
+        for (int32_t index = 0; index < values->Length; index++) {
+            (*values)[index] = (*pairs)[static_cast<size_t>(index)];
+        }
+
+        return values;
+    }
+
+    Enumerator begin() const {
+        return Enumerator(Snapshot());
+    }
+
+    Enumerator end() const {
+        return Enumerator();
+    }
+
+private:
+    static constexpr int32_t DefaultCapacity = 31;
+    static constexpr size_t MaxStripeCount = 1024;
+
+    /// <summary>
+    /// Average chain length a stripe may reach before the table doubles.
+    /// </summary>
+    static constexpr size_t MaxLoadFactor = 2;
+
+    struct Node {
+        Node(const TKey& nodeKey, const TValue& nodeValue, size_t nodeHash, Node* next)
+            : Key(nodeKey), Value(nodeValue), Hash(nodeHash), Next(next) {
+        }
+
+        const TKey Key;
+        const TValue Value;
+        const size_t Hash;
+        std::atomic<Node*> Next;
+    };
+
+    struct Table {
+        explicit Table(size_t bucketCount)
+            : Mask(bucketCount - 1), Buckets(new std::atomic<Node*>[bucketCount]) {
+            for (size_t index = 0; index < bucketCount; ++index) {
+                Buckets[index].store(nullptr, std::memory_order_relaxed);
+            }
+        }
+
+        ~Table() {
+            for (size_t index = 0; index <= Mask; ++index) {
+                Node* node = Buckets[index].load(std::memory_order_relaxed);
+                while (node != nullptr) {
+                    Node* next = node->Next.load(std::memory_order_relaxed);
+                    delete node;
+                    node = next;
+                }
+            }
+
+            delete[] Buckets;
+        }
+
+        const size_t Mask;
+        std::atomic<Node*>* const Buckets;
+    };
+
+    struct alignas(HE_CPP_CONCURRENT_CACHE_LINE_SIZE) Stripe {
+        ConcurrentCollectionLock Lock;
+        std::atomic<int32_t> Count { 0 };
+    };
+
+    static int32_t DefaultConcurrencyLevel() {
+#if HE_CPP_CONCURRENT_COLLECTIONS_THREADED
+        const unsigned int hardwareThreads = std::thread::hardware_concurrency();
+        return hardwareThreads == 0 ? 1 : static_cast<int32_t>(hardwareThreads);
+#else
+        return 1;
+#endif
+    }
+
+    static size_t RoundUpToPowerOfTwo(size_t value) {
+        size_t result = 1;
+        while (result < value) {
+            result <<= 1;
+        }
+
+        return result;
+    }
+
+    size_t HashKey(const TKey& key) const {
+        // Spread the hash so identity-hashed integer keys still fill both the stripe and the bucket bits.
+        size_t hash = keyHash(key);
+        hash ^= hash >> 16;
+        hash *= static_cast<size_t>(0x45d9f3bU);
+        hash ^= hash >> 16;
+        return hash;
+    }
+
+    template <typename TFactory, typename... TArgs>
+    static TValue InvokeFactory(TFactory& factory, TArgs&&... args) {
+        if constexpr (std::is_pointer_v<TFactory>) {
+            if (factory == nullptr) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+                throw ArgumentNullException();
+#else
+                throw ArgumentNullException("valueFactory");
+#endif
+            }
+
+            return (*factory)(std::forward<TArgs>(args)...);
+        } else {
+            return factory(std::forward<TArgs>(args)...);
+        }
+    }
+
+    /// <summary>
+    /// Walks one bucket chain. The caller must hold an epoch guard or the bucket's stripe lock.
+    /// </summary>
+    const Node* Find(const TKey& key, size_t hash) const {
+        const Table* current = table.load(std::memory_order_acquire);
+        for (const Node* node = current->Buckets[hash & current->Mask].load(std::memory_order_acquire); node != nullptr;
+             node = node->Next.load(std::memory_order_acquire)) {
+            if (node->Hash == hash && keyEqual(node->Key, key)) {
+                return node;
+            }
+        }
+
+        return nullptr;
+    }
+
+    bool TryGetValueWithHash(const TKey& key, size_t hash, TValue& value) const {
+        EpochReclamation::Guard guard;
+        const Node* node = Find(key, hash);
+        if (node == nullptr) {
+            return false;
+        }
+
+        value = node->Value;
+        return true;
+    }
+
+    /// <summary>
+    /// Inserts the key, or replaces its value when <paramref name="overwrite"/> is set. Returns whether a new key was
+    /// added; when the key already existed its previous value is written to <paramref name="existing"/>.
+    /// </summary>
+    bool Upsert(const TKey& key, size_t hash, const TValue& value, bool overwrite, TValue& existing) {
+        Stripe& stripe = stripes[hash & (stripeCount - 1)];
+        Table* observed = nullptr;
+        Node* replaced = nullptr;
+        bool grow = false;
+        {
+            ConcurrentCollectionLockScope scope(stripe.Lock);
+            observed = table.load(std::memory_order_relaxed);
+            std::atomic<Node*>* head = &observed->Buckets[hash & observed->Mask];
+            std::atomic<Node*>* link = head;
+            for (Node* node = link->load(std::memory_order_relaxed); node != nullptr; node = node->Next.load(std::memory_order_relaxed)) {
+                if (node->Hash == hash && keyEqual(node->Key, key)) {
+                    existing = node->Value;
+                    if (!overwrite) {
+                        return false;
+                    }
+
+                    link->store(new Node(key, value, hash, node->Next.load(std::memory_order_relaxed)), std::memory_order_release);
+                    replaced = node;
+                    break;
+                }
+
+                link = &node->Next;
+            }
+
+            if (replaced == nullptr) {
+                head->store(new Node(key, value, hash, head->load(std::memory_order_relaxed)), std::memory_order_release);
+                const int32_t count = stripe.Count.load(std::memory_order_relaxed) + 1;
+                stripe.Count.store(count, std::memory_order_relaxed);
+                grow = static_cast<size_t>(count) > ((observed->Mask + 1) / stripeCount) * MaxLoadFactor;
+            }
+        }
+
+        if (replaced != nullptr) {
+            EpochReclamation::Retire(replaced);
+            return false;
+        }
+
+        if (grow) {
+            Grow(observed);
+        }
+
+        return true;
+    }
+
+    bool TryReplace(const TKey& key, size_t hash, const TValue& newValue, const TValue& comparisonValue) {
+        Stripe& stripe = stripes[hash & (stripeCount - 1)];
+        Node* replaced = nullptr;
+        {
+            ConcurrentCollectionLockScope scope(stripe.Lock);
+            Table* current = table.load(std::memory_order_relaxed);
+            std::atomic<Node*>* link = &current->Buckets[hash & current->Mask];
+            for (Node* node = link->load(std::memory_order_relaxed); node != nullptr; node = node->Next.load(std::memory_order_relaxed)) {
+                if (node->Hash == hash && keyEqual(node->Key, key)) {
+                    if (!valueEqual(node->Value, comparisonValue)) {
+                        return false;
+                    }
+
+                    link->store(new Node(key, newValue, hash, node->Next.load(std::memory_order_relaxed)), std::memory_order_release);
+                    replaced = node;
+                    break;
+                }
+
+                link = &node->Next;
+            }
+        }
+
+        if (replaced == nullptr) {
+            return false;
+        }
+
+        EpochReclamation::Retire(replaced);
+        return true;
+    }
+
+    /// <summary>
+    /// Doubles the bucket array unless another writer already replaced <paramref name="observed"/>.
+    /// </summary>
+    void Grow(Table* observed) {
+        LockAllStripes();
+        Table* current = table.load(std::memory_order_relaxed);
+        if (current != observed) {
+            UnlockAllStripes();
+            return;
+        }
+
+        const size_t bucketCount = (current->Mask + 1) * 2;
+        Table* grown = new Table(bucketCount);
+        for (size_t index = 0; index <= current->Mask; ++index) {
+            for (Node* node = current->Buckets[index].load(std::memory_order_relaxed); node != nullptr;
+                 node = node->Next.load(std::memory_order_relaxed)) {
+                std::atomic<Node*>& bucket = grown->Buckets[node->Hash & grown->Mask];
+                bucket.store(new Node(node->Key, node->Value, node->Hash, bucket.load(std::memory_order_relaxed)), std::memory_order_relaxed);
+            }
+        }
+
+        table.store(grown, std::memory_order_release);
+        UnlockAllStripes();
+        EpochReclamation::Retire(current);
+    }
+
+    void LockAllStripes() {
+        for (size_t index = 0; index < stripeCount; ++index) {
+            stripes[index].Lock.Lock();
+        }
+    }
+
+    void UnlockAllStripes() {
+        for (size_t index = stripeCount; index > 0; --index) {
+            stripes[index - 1].Lock.Unlock();
+        }
+    }
+
+    template <typename TVisitor>
+    void ForEachNode(TVisitor visitor) const {
+        const Table* current = table.load(std::memory_order_acquire);
+        for (size_t index = 0; index <= current->Mask; ++index) {
+            for (const Node* node = current->Buckets[index].load(std::memory_order_acquire); node != nullptr;
+                 node = node->Next.load(std::memory_order_acquire)) {
+                visitor(node);
+            }
+        }
+    }
+
+    std::shared_ptr<std::vector<KeyValuePair<TKey, TValue>>> Snapshot() const {
+        std::shared_ptr<std::vector<KeyValuePair<TKey, TValue>>> pairs = std::make_shared<std::vector<KeyValuePair<TKey, TValue>>>();
+        EpochReclamation::Guard guard;
+        ForEachNode([&pairs](const Node* node) {
+            pairs->push_back(KeyValuePair<TKey, TValue>(node->Key, node->Value));
+        });
+
+        return pairs;
+    }
+
+    std::atomic<Table*> table { nullptr };
+    Stripe* stripes = nullptr;
+    size_t stripeCount = 1;
+    NativeDictionaryHash<TKey> keyHash;
+    NativeDictionaryEqual<TKey> keyEqual;
+    NativeDictionaryEqual<TValue> valueEqual;
+};
+
+#endif // HE_CPP_SYSTEM_COLLECTIONS_CONCURRENT_CONCURRENT_DICTIONARY_HPP
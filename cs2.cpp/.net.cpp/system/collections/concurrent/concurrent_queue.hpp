@@ -0,0 +1,373 @@
+#ifndef HE_CPP_SYSTEM_COLLECTIONS_CONCURRENT_CONCURRENT_QUEUE_HPP
+#define HE_CPP_SYSTEM_COLLECTIONS_CONCURRENT_CONCURRENT_QUEUE_HPP
+
+#include "helcpp_config.hpp"
+#include "runtime/array.hpp"
+#include "system/collections/concurrent/concurrent_collection_lock.hpp"
+#include "system/threading/epoch_reclamation.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#if HE_CPP_CONCURRENT_COLLECTIONS_THREADED
+#include <thread>
+#endif
+
+/// <summary>
+/// Unbounded multi-producer, multi-consumer FIFO queue matching System.Collections.Concurrent.ConcurrentQueue. As in the
+/// CLR it is a linked list of bounded ring segments: each slot carries a sequence number, so producers and consumers
+/// claim slots with one compare-exchange on the segment's tail or head and never take a lock. When the tail segment
+/// fills it is frozen and a segment of twice the size is appended; drained head segments are retired through
+/// <see cref="EpochReclamation"/>. Only the segment hand-off takes a lock.
+/// </summary>
+template <typename T>
+class ConcurrentQueue {
+public:
+    ConcurrentQueue()
+        : head(new Segment(InitialSegmentLength)) {
+        tail.store(head.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+
+    ~ConcurrentQueue() {
+        Segment* segment = head.load(std::memory_order_relaxed);
+        while (segment != nullptr) {
+            Segment* next = segment->Next.load(std::memory_order_relaxed);
+            delete segment;
+            segment = next;
+        }
+    }
+
+    ConcurrentQueue(const ConcurrentQueue&) = delete;
+    ConcurrentQueue& operator=(const ConcurrentQueue&) = delete;
+
+    void Enqueue(const T& item) {
+        EpochReclamation::Guard guard;
+        for (;;) {
+            Segment* segment = tail.load(std::memory_order_acquire);
+            if (segment->TryEnqueue(item)) {
+                return;
+            }
+
+            AppendSegment(segment);
+        }
+    }
+
+    bool TryDequeue(T& item) {
+        EpochReclamation::Guard guard;
+        for (;;) {
+            Segment* segment = head.load(std::memory_order_acquire);
+            if (segment->TryDequeue(item)) {
+                return true;
+            }
+
+            Segment* next = segment->Next.load(std::memory_order_acquire);
+            if (next == nullptr) {
+                return false;
+            }
+
+            // A successor exists, so the segment is frozen and this second attempt fails only once it is fully drained.
+            if (segment->TryDequeue(item)) {
+                return true;
+            }
+
+            RetireHead(segment, next);
+        }
+    }
+
+    /// <summary>
+    /// Copies the oldest item without removing it. The segment it came from stops recycling slots, so the copy can never
+    /// race with a producer reusing that slot.
+    /// </summary>
+    bool TryPeek(T& item) {
+        EpochReclamation::Guard guard;
+        for (Segment* segment = head.load(std::memory_order_acquire); segment != nullptr;
+             segment = segment->Next.load(std::memory_order_acquire)) {
+            Segment* next = segment->Next.load(std::memory_order_acquire);
+            if (segment->TryPeek(item)) {
+                return true;
+            }
+
+            if (next == nullptr && segment->Next.load(std::memory_order_acquire) == nullptr) {
+                return false;
+            }
+        }
+
+        return false;
+    }
+
+    bool get_IsEmpty() const {
+        EpochReclamation::Guard guard;
+        for (const Segment* segment = head.load(std::memory_order_acquire); segment != nullptr;
+             segment = segment->Next.load(std::memory_order_acquire)) {
+            if (segment->GetCount() > 0) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /// <summary>
+    /// Counts the items in every segment. The result is exact whenever no producer or consumer is running.
+    /// </summary>
+    int32_t get_Count() const {
+        EpochReclamation::Guard guard;
+        size_t count = 0;
+        for (const Segment* segment = head.load(std::memory_order_acquire); segment != nullptr;
+             segment = segment->Next.load(std::memory_order_acquire)) {
+            count += segment->GetCount();
+        }
+
+        return static_cast<int32_t>(count);
+    }
+
+    int32_t Count() const {
+        return get_Count();
+    }
+
+    /// <summary>
+    /// Drops every queued item by swapping in a fresh segment; producers still writing into the old segments lose their
+    /// items, as with the managed Clear.
+    /// </summary>
+    void Clear() {
+        Segment* retired = nullptr;
+        {
+            ConcurrentCollectionLockScope scope(segmentLock);
+            Segment* last = tail.load(std::memory_order_relaxed);
+            last->Freeze();
+            Segment* fresh = new Segment(InitialSegmentLength);
+            retired = head.load(std::memory_order_relaxed);
+            tail.store(fresh, std::memory_order_release);
+            head.store(fresh, std::memory_order_release);
+        }
+
+        while (retired != nullptr) {
+            Segment* next = retired->Next.load(std::memory_order_relaxed);
+            EpochReclamation::Retire(retired);
+            retired = next;
+        }
+    }
+
+    /// <summary>
+    /// Copies the queued items in FIFO order without removing them. Like <see cref="TryPeek"/> it marks the segments
+    /// it reads as preserved so none of the copied slots can be recycled underneath it.
+    /// </summary>
+    Array<T>* ToArray() {
+        std::vector<T> items;
+        {
+            EpochReclamation::Guard guard;
+            for (Segment* segment = head.load(std::memory_order_acquire); segment != nullptr;
+                 segment = segment->Next.load(std::memory_order_acquire)) {
+                segment->AppendTo(items);
+            }
+        }
+
+        Array<T>* values = new Array<T>(static_cast<int32_t>(items.size()));
+        for (int32_t index = 0; index < values->Length; index++) {
+            (*values)[index] = items[static_cast<size_t>(index)];
+        }
+
+        return values;
+    }
+
+private:
+    static constexpr size_t InitialSegmentLength = 32;
+    static constexpr size_t MaxSegmentLength = 1024 * 1024;
+
+    /// <summary>
+    /// Bounded ring of slots. A slot whose sequence equals a position is free for the producer claiming that position;
+    /// one past it means the item is published for the consumer claiming it. Freezing pushes the tail past every
+    /// sequence the ring can hold, so late producers see the ring as full and move on to the next segment.
+    /// </summary>
+    struct Segment {
+        struct Slot {
+            std::atomic<size_t> Sequence;
+            T Item {};
+        };
+
+        explicit Segment(size_t length)
+            : Mask(length - 1), FreezeOffset(length * 2), Slots(new Slot[length]) {
+            for (size_t index = 0; index < length; ++index) {
+                Slots[index].Sequence.store(index, std::memory_order_relaxed);
+            }
+        }
+
+        ~Segment() {
+            delete[] Slots;
+        }
+
+        bool TryEnqueue(const T& item) {
+            size_t position = Tail.load(std::memory_order_relaxed);
+            for (;;) {
+                Slot& slot = Slots[position & Mask];
+                const intptr_t difference = static_cast<intptr_t>(slot.Sequence.load(std::memory_order_acquire) - position);
+                if (difference == 0) {
+                    if (Tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                        slot.Item = item;
+                        slot.Sequence.store(position + 1, std::memory_order_release);
+                        return true;
+                    }
+                } else if (difference < 0) {
+                    return false;
+                } else {
+                    position = Tail.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Fails only when the segment is empty, or when it is frozen and every claimed slot has been consumed. A slot a
+        /// producer has claimed but not yet published is waited for rather than reported as empty.
+        /// </summary>
+        bool TryDequeue(T& item) {
+            size_t position = Head.load(std::memory_order_seq_cst);
+            for (int32_t spins = 0;;) {
+                Slot& slot = Slots[position & Mask];
+                const intptr_t difference = static_cast<intptr_t>(slot.Sequence.load(std::memory_order_acquire) - (position + 1));
+                if (difference == 0) {
+                    if (Head.compare_exchange_weak(position, position + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                        if (PreservedForObservation.load(std::memory_order_seq_cst)) {
+                            item = slot.Item;
+                        } else {
+                            item = std::move(slot.Item);
+                            slot.Item = T {};
+                            slot.Sequence.store(position + Mask + 1, std::memory_order_release);
+                        }
+
+                        return true;
+                    }
+                } else if (difference < 0) {
+                    const bool frozen = Frozen.load(std::memory_order_acquire);
+                    const size_t currentTail = Tail.load(std::memory_order_acquire);
+                    if (static_cast<intptr_t>(currentTail - position) <= 0 ||
+                        (frozen && static_cast<intptr_t>(currentTail - FreezeOffset - position) <= 0)) {
+                        return false;
+                    }
+
+                    Backoff(spins);
+                    position = Head.load(std::memory_order_seq_cst);
+                } else {
+                    position = Head.load(std::memory_order_seq_cst);
+                }
+            }
+        }
+
+        bool TryPeek(T& item) {
+            PreservedForObservation.store(true, std::memory_order_seq_cst);
+            for (int32_t spins = 0;;) {
+                const size_t position = Head.load(std::memory_order_seq_cst);
+                Slot& slot = Slots[position & Mask];
+                const intptr_t difference = static_cast<intptr_t>(slot.Sequence.load(std::memory_order_acquire) - (position + 1));
+                if (difference == 0) {
+                    item = slot.Item;
+                    return true;
+                }
+
+                if (difference < 0) {
+                    const bool frozen = Frozen.load(std::memory_order_acquire);
+                    const size_t currentTail = Tail.load(std::memory_order_acquire);
+                    if (static_cast<intptr_t>(currentTail - position) <= 0 ||
+                        (frozen && static_cast<intptr_t>(currentTail - FreezeOffset - position) <= 0)) {
+                        return false;
+                    }
+
+                    Backoff(spins);
+                }
+            }
+        }
+
+        void AppendTo(std::vector<T>& items) {
+            PreservedForObservation.store(true, std::memory_order_seq_cst);
+            const size_t currentHead = Head.load(std::memory_order_seq_cst);
+            const size_t end = currentHead + GetCount();
+            for (size_t position = currentHead; position != end; ++position) {
+                Slot& slot = Slots[position & Mask];
+                for (int32_t spins = 0; slot.Sequence.load(std::memory_order_acquire) != position + 1;) {
+                    Backoff(spins);
+                }
+
+                items.push_back(slot.Item);
+            }
+        }
+
+        size_t GetCount() const {
+            const size_t currentHead = Head.load(std::memory_order_acquire);
+            const bool frozen = Frozen.load(std::memory_order_acquire);
+            size_t currentTail = Tail.load(std::memory_order_acquire);
+            if (frozen) {
+                currentTail -= FreezeOffset;
+            }
+
+            const intptr_t count = static_cast<intptr_t>(currentTail - currentHead);
+            return count > 0 ? static_cast<size_t>(count) : 0;
+        }
+
+        /// <summary>
+        /// Stops further enqueues. Called once, under the queue's segment lock, before a successor is linked.
+        /// </summary>
+        void Freeze() {
+            // The tail moves first, so a consumer that observes the flag also observes the offset tail.
+            if (!Frozen.load(std::memory_order_relaxed)) {
+                Tail.fetch_add(FreezeOffset, std::memory_order_acq_rel);
+                Frozen.store(true, std::memory_order_release);
+            }
+        }
+
+        size_t Length() const {
+            return Mask + 1;
+        }
+
+        static void Backoff(int32_t& spins) {
+#if HE_CPP_CONCURRENT_COLLECTIONS_THREADED
+            if (++spins > 16) {
+                std::this_thread::yield();
+            }
+#else
+            (void)spins;
+#endif
+        }
+
+        const size_t Mask;
+        const size_t FreezeOffset;
+        Slot* const Slots;
+        alignas(HE_CPP_CONCURRENT_CACHE_LINE_SIZE) std::atomic<size_t> Head { 0 };
+        alignas(HE_CPP_CONCURRENT_CACHE_LINE_SIZE) std::atomic<size_t> Tail { 0 };
+        alignas(HE_CPP_CONCURRENT_CACHE_LINE_SIZE) std::atomic<bool> Frozen { false };
+        std::atomic<bool> PreservedForObservation { false };
+        std::atomic<Segment*> Next { nullptr };
+    };
+
+    void AppendSegment(Segment* full) {
+        ConcurrentCollectionLockScope scope(segmentLock);
+        if (tail.load(std::memory_order_relaxed) != full) {
+            return;
+        }
+
+        full->Freeze();
+        const size_t length = full->Length() * 2 < MaxSegmentLength ? full->Length() * 2 : MaxSegmentLength;
+        Segment* next = new Segment(length);
+        full->Next.store(next, std::memory_order_release);
+        tail.store(next, std::memory_order_release);
+    }
+
+    void RetireHead(Segment* drained, Segment* next) {
+        {
+            ConcurrentCollectionLockScope scope(segmentLock);
+            if (head.load(std::memory_order_relaxed) != drained) {
+                return;
+            }
+
+            head.store(next, std::memory_order_release);
+        }
+
+        EpochReclamation::Retire(drained);
+    }
+
+    alignas(HE_CPP_CONCURRENT_CACHE_LINE_SIZE) std::atomic<Segment*> head;
+    alignas(HE_CPP_CONCURRENT_CACHE_LINE_SIZE) std::atomic<Segment*> tail { nullptr };
+    ConcurrentCollectionLock segmentLock;
+};
+
+#endif // HE_CPP_SYSTEM_COLLECTIONS_CONCURRENT_CONCURRENT_QUEUE_HPP
@@ -1,34 +1,62 @@
 #ifndef HE_CPP_SYSTEM_DELEGATE_HPP
 #define HE_CPP_SYSTEM_DELEGATE_HPP
 
-#include <functional>
+#include "invocation_list.hpp"
 #include <utility>
 
 template <typename TResult, typename... TArgs>
 class Delegate {
 public:
-    using FuncType = std::function<TResult(TArgs...)>;
+    using FuncType = InlineDelegate<TResult(TArgs...)>;
+    using InvocationListType = InvocationList<TResult(TArgs...)>;
 
     Delegate() = default;
 
+    explicit Delegate(InvocationListType list)
+        : targets(std::move(list)) {
+    }
+
     explicit Delegate(FuncType value)
-        : func(std::move(value)) {
+        : targets(std::move(value)) {
     }
 
     template <typename TCallable>
     explicit Delegate(TCallable value)
-        : func(std::move(value)) {
+        : targets(FuncType(std::move(value))) {
     }
 
+    /// <summary>
+    /// Binds an instance method to its receiver; the pair is stored inline so binding never allocates.
+    /// </summary>
+    template <typename TReceiver, typename TMethod>
+    Delegate(TReceiver receiver, TMethod method)
+        : targets(FuncType(std::move(receiver), method)) {
+    }
+
+    /// <summary>
+    /// Invokes every combined target in order and returns the result of the last one.
+    /// </summary>
     TResult operator()(TArgs... args) const {
-        return func(std::forward<TArgs>(args)...);
+        return targets.Invoke(std::forward<TArgs>(args)...);
     }
 
     explicit operator bool() const {
-        return static_cast<bool>(func);
+        return targets.GetCount() != 0;
+    }
+
+    bool operator==(const Delegate& other) const {
+        return targets == other.targets;
+    }
+
+    bool operator!=(const Delegate& other) const {
+        return targets != other.targets;
+    }
+
+    const InvocationListType& GetInvocationTargets() const {
+        return targets;
     }
 private:
-    FuncType func{};
+    InvocationListType targets{};
 };
 
 #endif
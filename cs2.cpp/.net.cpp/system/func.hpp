@@ -1,7 +1,7 @@
 #ifndef FUNC_HPP
 #define FUNC_HPP
 
-#include <functional>
+#include "invocation_list.hpp"
 
 template <typename... TArgs>
 class Func {
@@ -10,41 +10,103 @@ class Func {
 template <typename TResult>
 class Func<TResult> {
 public:
-    using FuncType = std::function<TResult()>;
+    using FuncType = InlineDelegate<TResult()>;
+    using InvocationListType = InvocationList<TResult()>;
 
     Func() = default;
 
+    explicit Func(InvocationListType list);
+
     explicit Func(FuncType value);
 
     template<typename TCallable>
     explicit Func(TCallable value);
 
+    // Bound instance method; stored inline so binding never allocates
+    template<typename TReceiver, typename TMethod>
+    Func(TReceiver receiver, TMethod method);
+
+    // Invokes every combined target in order and returns the last result
     TResult operator()() const;
 
     explicit operator bool() const;
 
+    bool operator==(const Func& other) const;
+
+    bool operator!=(const Func& other) const;
+
+    const InvocationListType& GetInvocationTargets() const;
+
 private:
-    FuncType func{};
+    InvocationListType targets{};
 };
 
 template <typename TArg, typename TResult>
 class Func<TArg, TResult> {
 public:
-    using FuncType = std::function<TResult(TArg)>;
+    using FuncType = InlineDelegate<TResult(TArg)>;
+    using InvocationListType = InvocationList<TResult(TArg)>;
 
     Func() = default;
 
+    explicit Func(InvocationListType list);
+
     explicit Func(FuncType value);
 
     template<typename TCallable>
     explicit Func(TCallable value);
 
+    // Bound instance method; stored inline so binding never allocates
+    template<typename TReceiver, typename TMethod>
+    Func(TReceiver receiver, TMethod method);
+
+    // Invokes every combined target in order and returns the last result
     TResult operator()(TArg arg) const;
 
     explicit operator bool() const;
 
+    bool operator==(const Func& other) const;
+
+    bool operator!=(const Func& other) const;
+
+    const InvocationListType& GetInvocationTargets() const;
+
+private:
+    InvocationListType targets{};
+};
+
+template <typename TArg1, typename TArg2, typename TResult>
+class Func<TArg1, TArg2, TResult> {
+public:
+    using FuncType = InlineDelegate<TResult(TArg1, TArg2)>;
+    using InvocationListType = InvocationList<TResult(TArg1, TArg2)>;
+
+    Func() = default;
+
+    explicit Func(InvocationListType list);
+
+    explicit Func(FuncType value);
+
+    template<typename TCallable>
+    explicit Func(TCallable value);
+
+    // Bound instance method; stored inline so binding never allocates
+    template<typename TReceiver, typename TMethod>
+    Func(TReceiver receiver, TMethod method);
+
+    // Invokes every combined target in order and returns the last result
+    TResult operator()(TArg1 arg1, TArg2 arg2) const;
+
+    explicit operator bool() const;
+
+    bool operator==(const Func& other) const;
+
+    bool operator!=(const Func& other) const;
+
+    const InvocationListType& GetInvocationTargets() const;
+
 private:
-    FuncType func{};
+    InvocationListType targets{};
 };
 
 #include "func.tpp"
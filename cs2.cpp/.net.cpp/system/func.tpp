@@ -4,37 +4,120 @@
 #include "func.hpp"
 
 template<typename TResult>
-Func<TResult>::Func(FuncType value) : func(value) {}
+Func<TResult>::Func(InvocationListType list) : targets(std::move(list)) {}
+
+template<typename TResult>
+Func<TResult>::Func(FuncType value) : targets(std::move(value)) {}
 
 template<typename TResult>
 template<typename TCallable>
-Func<TResult>::Func(TCallable value) : func(value) {}
+Func<TResult>::Func(TCallable value) : targets(FuncType(std::move(value))) {}
+
+template<typename TResult>
+template<typename TReceiver, typename TMethod>
+Func<TResult>::Func(TReceiver receiver, TMethod method) : targets(FuncType(std::move(receiver), method)) {}
 
 template<typename TResult>
 TResult Func<TResult>::operator()() const {
-    return func();
+    return targets.Invoke();
 }
 
 template<typename TResult>
 Func<TResult>::operator bool() const {
-    return static_cast<bool>(func);
+    return targets.GetCount() != 0;
+}
+
+template<typename TResult>
+bool Func<TResult>::operator==(const Func& other) const {
+    return targets == other.targets;
+}
+
+template<typename TResult>
+bool Func<TResult>::operator!=(const Func& other) const {
+    return targets != other.targets;
+}
+
+template<typename TResult>
+const typename Func<TResult>::InvocationListType& Func<TResult>::GetInvocationTargets() const {
+    return targets;
 }
 
 template<typename TArg, typename TResult>
-Func<TArg, TResult>::Func(FuncType value) : func(value) {}
+Func<TArg, TResult>::Func(InvocationListType list) : targets(std::move(list)) {}
+
+template<typename TArg, typename TResult>
+Func<TArg, TResult>::Func(FuncType value) : targets(std::move(value)) {}
 
 template<typename TArg, typename TResult>
 template<typename TCallable>
-Func<TArg, TResult>::Func(TCallable value) : func(value) {}
+Func<TArg, TResult>::Func(TCallable value) : targets(FuncType(std::move(value))) {}
+
+template<typename TArg, typename TResult>
+template<typename TReceiver, typename TMethod>
+Func<TArg, TResult>::Func(TReceiver receiver, TMethod method) : targets(FuncType(std::move(receiver), method)) {}
 
 template<typename TArg, typename TResult>
 TResult Func<TArg, TResult>::operator()(TArg arg) const {
-    return func(arg);
+    return targets.Invoke(std::forward<TArg>(arg));
 }
 
 template<typename TArg, typename TResult>
 Func<TArg, TResult>::operator bool() const {
-    return static_cast<bool>(func);
+    return targets.GetCount() != 0;
+}
+
+template<typename TArg, typename TResult>
+bool Func<TArg, TResult>::operator==(const Func& other) const {
+    return targets == other.targets;
+}
+
+template<typename TArg, typename TResult>
+bool Func<TArg, TResult>::operator!=(const Func& other) const {
+    return targets != other.targets;
+}
+
+template<typename TArg, typename TResult>
+const typename Func<TArg, TResult>::InvocationListType& Func<TArg, TResult>::GetInvocationTargets() const {
+    return targets;
+}
+
+template<typename TArg1, typename TArg2, typename TResult>
+Func<TArg1, TArg2, TResult>::Func(InvocationListType list) : targets(std::move(list)) {}
+
+template<typename TArg1, typename TArg2, typename TResult>
+Func<TArg1, TArg2, TResult>::Func(FuncType value) : targets(std::move(value)) {}
+
+template<typename TArg1, typename TArg2, typename TResult>
+template<typename TCallable>
+Func<TArg1, TArg2, TResult>::Func(TCallable value) : targets(FuncType(std::move(value))) {}
+
+template<typename TArg1, typename TArg2, typename TResult>
+template<typename TReceiver, typename TMethod>
+Func<TArg1, TArg2, TResult>::Func(TReceiver receiver, TMethod method) : targets(FuncType(std::move(receiver), method)) {}
+
+template<typename TArg1, typename TArg2, typename TResult>
+TResult Func<TArg1, TArg2, TResult>::operator()(TArg1 arg1, TArg2 arg2) const {
+    return targets.Invoke(std::forward<TArg1>(arg1), std::forward<TArg2>(arg2));
+}
+
+template<typename TArg1, typename TArg2, typename TResult>
+Func<TArg1, TArg2, TResult>::operator bool() const {
+    return targets.GetCount() != 0;
+}
+
+template<typename TArg1, typename TArg2, typename TResult>
+bool Func<TArg1, TArg2, TResult>::operator==(const Func& other) const {
+    return targets == other.targets;
+}
+
+template<typename TArg1, typename TArg2, typename TResult>
+bool Func<TArg1, TArg2, TResult>::operator!=(const Func& other) const {
+    return targets != other.targets;
+}
+
+template<typename TArg1, typename TArg2, typename TResult>
+const typename Func<TArg1, TArg2, TResult>::InvocationListType& Func<TArg1, TArg2, TResult>::GetInvocationTargets() const {
+    return targets;
 }
 
 #endif // FUNC_TPP
@@ -0,0 +1,253 @@
+#ifndef HE_CPP_SYSTEM_INLINE_DELEGATE_HPP
+#define HE_CPP_SYSTEM_INLINE_DELEGATE_HPP
+
+#include "helcpp_config.hpp"
+#include "../runtime/native_exceptions.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#ifndef HE_CPP_INLINE_DELEGATE_CAPTURE_SIZE
+#define HE_CPP_INLINE_DELEGATE_CAPTURE_SIZE (4 * sizeof(void*))
+#endif
+
+template <typename TSignature>
+class InlineDelegate;
+
+/// <summary>
+/// Callable storage used by Action, Func, and generated delegate aliases. Function pointers, bound instance methods,
+/// and trivially copyable lambdas that fit in <see cref="CaptureSize"/> bytes are stored inline and copied bitwise,
+/// so creating or copying them never allocates. Larger or non-trivial callables are moved into one shared,
+/// reference-counted heap box. Two delegates compare equal when they invoke the same callable type over the same
+/// stored bytes, which lets a freshly bound method or function pointer unsubscribe an earlier one.
+/// </summary>
+template <typename TResult, typename... TArgs>
+class InlineDelegate<TResult(TArgs...)> {
+public:
+    /// <summary>
+    /// Bytes available for inline captures; sized for a receiver plus a member-function pointer or a few locals.
+    /// </summary>
+    static constexpr size_t CaptureSize = HE_CPP_INLINE_DELEGATE_CAPTURE_SIZE;
+
+    InlineDelegate() noexcept
+        : invoker(nullptr), release(nullptr), comparableSize(0) {
+        std::memset(storage, 0, sizeof(storage));
+    }
+
+    InlineDelegate(std::nullptr_t) noexcept
+        : InlineDelegate() {
+    }
+
+    template <typename TCallable, typename = std::enable_if_t<
+        !std::is_same_v<std::decay_t<TCallable>, InlineDelegate> &&
+        std::is_invocable_v<std::decay_t<TCallable>&, TArgs...>>>
+    InlineDelegate(TCallable&& callable)
+        : InlineDelegate() {
+        Store(std::forward<TCallable>(callable));
+    }
+
+    /// <summary>
+    /// Binds an instance method to its receiver without type erasure beyond one function-pointer thunk.
+    /// </summary>
+    template <typename TReceiver, typename TMethod, typename = std::enable_if_t<std::is_member_function_pointer_v<TMethod>>>
+    InlineDelegate(TReceiver receiver, TMethod method)
+        : InlineDelegate() {
+        Store(BoundMethod<TReceiver, TMethod> { std::move(receiver), method });
+    }
+
+    InlineDelegate(const InlineDelegate& other) noexcept
+        : invoker(other.invoker), release(other.release), comparableSize(other.comparableSize) {
+        std::memcpy(storage, other.storage, sizeof(storage));
+        if (release != nullptr) {
+            HeapBoxHeader::FromStorage(storage)->References.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    InlineDelegate(InlineDelegate&& other) noexcept
+        : invoker(other.invoker), release(other.release), comparableSize(other.comparableSize) {
+        std::memcpy(storage, other.storage, sizeof(storage));
+        other.invoker = nullptr;
+        other.release = nullptr;
+        other.comparableSize = 0;
+    }
+
+    ~InlineDelegate() {
+        Reset();
+    }
+
+    InlineDelegate& operator=(const InlineDelegate& other) noexcept {
+        if (this != &other) {
+            InlineDelegate copy(other);
+            *this = std::move(copy);
+        }
+
+        return *this;
+    }
+
+    InlineDelegate& operator=(InlineDelegate&& other) noexcept {
+        if (this != &other) {
+            Reset();
+            invoker = other.invoker;
+            release = other.release;
+            comparableSize = other.comparableSize;
+            std::memcpy(storage, other.storage, sizeof(storage));
+            other.invoker = nullptr;
+            other.release = nullptr;
+            other.comparableSize = 0;
+        }
+
+        return *this;
+    }
+
+    TResult operator()(TArgs... args) const {
+        if (invoker == nullptr) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+            throw InvalidOperationException();
+#else
+            throw InvalidOperationException("The delegate has no invocation target.");
+#endif
+        }
+
+        return invoker(storage, std::forward<TArgs>(args)...);
+    }
+
+    explicit operator bool() const noexcept {
+        return invoker != nullptr;
+    }
+
+    bool operator==(const InlineDelegate& other) const noexcept {
+        return invoker == other.invoker &&
+            comparableSize == other.comparableSize &&
+            std::memcmp(storage, other.storage, comparableSize) == 0;
+    }
+
+    bool operator!=(const InlineDelegate& other) const noexcept {
+        return !(*this == other);
+    }
+
+    bool operator==(std::nullptr_t) const noexcept {
+        return invoker == nullptr;
+    }
+
+    bool operator!=(std::nullptr_t) const noexcept {
+        return invoker != nullptr;
+    }
+
+private:
+    using Invoker = TResult (*)(void* storage, TArgs&&... args);
+
+    template <typename TReceiver, typename TMethod>
+    struct BoundMethod {
+        TReceiver Receiver;
+        TMethod Method;
+
+        TResult operator()(TArgs... args) {
+            if constexpr (std::is_pointer_v<TReceiver>) {
+                return InvokeTarget(Method, Receiver, std::forward<TArgs>(args)...);
+            } else {
+                return InvokeTarget(Method, &Receiver, std::forward<TArgs>(args)...);
+            }
+        }
+    };
+
+    struct HeapBoxHeader {
+        std::atomic<int32_t> References;
+
+        static HeapBoxHeader* FromStorage(const void* storage) {
+            HeapBoxHeader* header;
+            std::memcpy(&header, storage, sizeof(header));
+            return header;
+        }
+    };
+
+    template <typename TCallable>
+    struct HeapBox : HeapBoxHeader {
+        TCallable Callable;
+
+        explicit HeapBox(TCallable&& callable)
+            : HeapBoxHeader { { 1 } }, Callable(std::move(callable)) {
+        }
+    };
+
+    template <typename TCallable>
+    static constexpr bool IsInline =
+        sizeof(TCallable) <= CaptureSize &&
+        alignof(TCallable) <= alignof(std::max_align_t) &&
+        std::is_trivially_copyable_v<TCallable>;
+
+    /// <summary>
+    /// Invokes a target and discards its result when the delegate returns void, matching managed delegate conversion.
+    /// </summary>
+    template <typename TTarget, typename... TInvokeArgs>
+    static TResult InvokeTarget(TTarget&& target, TInvokeArgs&&... args) {
+        if constexpr (std::is_void_v<TResult>) {
+            std::invoke(std::forward<TTarget>(target), std::forward<TInvokeArgs>(args)...);
+        } else {
+            return std::invoke(std::forward<TTarget>(target), std::forward<TInvokeArgs>(args)...);
+        }
+    }
+
+    template <typename TCallable>
+    static TResult InvokeInline(void* storage, TArgs&&... args) {
+        return InvokeTarget(*std::launder(reinterpret_cast<TCallable*>(storage)), std::forward<TArgs>(args)...);
+    }
+
+    template <typename TCallable>
+    static TResult InvokeBoxed(void* storage, TArgs&&... args) {
+        HeapBox<TCallable>* box = static_cast<HeapBox<TCallable>*>(HeapBoxHeader::FromStorage(storage));
+        return InvokeTarget(box->Callable, std::forward<TArgs>(args)...);
+    }
+
+    template <typename TCallable>
+    static void ReleaseBoxed(void* storage) {
+        HeapBoxHeader* header = HeapBoxHeader::FromStorage(storage);
+        if (header->References.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete static_cast<HeapBox<TCallable>*>(header);
+        }
+    }
+
+    template <typename TInput>
+    void Store(TInput&& input) {
+        using TCallable = std::decay_t<TInput>;
+        if constexpr (std::is_pointer_v<TCallable> || std::is_member_function_pointer_v<TCallable>) {
+            if (input == nullptr) {
+                return;
+            }
+        }
+
+        if constexpr (IsInline<TCallable>) {
+            ::new (static_cast<void*>(storage)) TCallable(std::forward<TInput>(input));
+            invoker = &InvokeInline<TCallable>;
+            comparableSize = sizeof(TCallable);
+        } else {
+            HeapBoxHeader* header = new HeapBox<TCallable>(TCallable(std::forward<TInput>(input)));
+            std::memcpy(storage, &header, sizeof(header));
+            invoker = &InvokeBoxed<TCallable>;
+            release = &ReleaseBoxed<TCallable>;
+            comparableSize = sizeof(header);
+        }
+    }
+
+    void Reset() noexcept {
+        if (release != nullptr) {
+            release(storage);
+        }
+
+        invoker = nullptr;
+        release = nullptr;
+        comparableSize = 0;
+        std::memset(storage, 0, sizeof(storage));
+    }
+
+    Invoker invoker;
+    void (*release)(void* storage);
+    size_t comparableSize;
+    alignas(std::max_align_t) mutable unsigned char storage[CaptureSize];
+};
+
+#endif // HE_CPP_SYSTEM_INLINE_DELEGATE_HPP
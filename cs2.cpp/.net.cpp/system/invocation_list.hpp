@@ -0,0 +1,266 @@
+#ifndef HE_CPP_SYSTEM_INVOCATION_LIST_HPP
+#define HE_CPP_SYSTEM_INVOCATION_LIST_HPP
+
+#include "inline_delegate.hpp"
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+template <typename TSignature>
+class InvocationList;
+
+/// <summary>
+/// Immutable invocation list shared by Action, Func, and generated delegate aliases. A single target is stored inline,
+/// so an ordinary delegate never allocates for its list. Combined targets live in one reference-counted block: when a
+/// list still owns the block's tail, combining claims the spare slots in place instead of copying, so repeated
+/// <c>+=</c> on one field is amortized constant time, and removing the most recent handlers shares the remaining prefix.
+/// Lists are never mutated after construction, so invoking one while a handler combines or removes is always safe.
+/// </summary>
+template <typename TResult, typename... TArgs>
+class InvocationList<TResult(TArgs...)> {
+public:
+    using TargetType = InlineDelegate<TResult(TArgs...)>;
+
+    InvocationList() noexcept
+        : block(nullptr), count(0) {
+    }
+
+    explicit InvocationList(TargetType target) noexcept
+        : single(std::move(target)), block(nullptr), count(single ? 1u : 0u) {
+    }
+
+    InvocationList(const InvocationList& other) noexcept
+        : single(other.single), block(other.block), count(other.count) {
+        if (block != nullptr) {
+            block->References.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    InvocationList(InvocationList&& other) noexcept
+        : single(std::move(other.single)), block(other.block), count(other.count) {
+        other.block = nullptr;
+        other.count = 0;
+    }
+
+    ~InvocationList() {
+        Release();
+    }
+
+    InvocationList& operator=(const InvocationList& other) noexcept {
+        if (this != &other) {
+            InvocationList copy(other);
+            *this = std::move(copy);
+        }
+
+        return *this;
+    }
+
+    InvocationList& operator=(InvocationList&& other) noexcept {
+        if (this != &other) {
+            Release();
+            single = std::move(other.single);
+            block = other.block;
+            count = other.count;
+            other.block = nullptr;
+            other.count = 0;
+        }
+
+        return *this;
+    }
+
+    /// <summary>
+    /// Gets the number of targets in the list.
+    /// </summary>
+    int32_t GetCount() const noexcept {
+        return static_cast<int32_t>(count);
+    }
+
+    const TargetType& operator[](int32_t index) const noexcept {
+        return block == nullptr ? single : block->Targets()[index];
+    }
+
+    /// <summary>
+    /// Invokes every target in order and returns the result of the last one, matching managed multicast invocation.
+    /// Invoking an empty list throws through the empty inline target.
+    /// </summary>
+    TResult Invoke(TArgs... args) const {
+        if (block == nullptr) {
+            return single(std::forward<TArgs>(args)...);
+        }
+
+        const TargetType* targets = block->Targets();
+        const uint32_t last = count - 1;
+        for (uint32_t index = 0; index < last; ++index) {
+            targets[index](args...);
+        }
+
+        return targets[last](std::forward<TArgs>(args)...);
+    }
+
+    bool operator==(const InvocationList& other) const noexcept {
+        if (count != other.count) {
+            return false;
+        }
+
+        for (uint32_t index = 0; index < count; ++index) {
+            if ((*this)[static_cast<int32_t>(index)] != other[static_cast<int32_t>(index)]) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool operator!=(const InvocationList& other) const noexcept {
+        return !(*this == other);
+    }
+
+    /// <summary>
+    /// Returns a list that invokes <paramref name="first"/> followed by <paramref name="second"/>.
+    /// </summary>
+    static InvocationList Combine(const InvocationList& first, const InvocationList& second) {
+        if (second.count == 0) {
+            return first;
+        }
+
+        if (first.count == 0) {
+            return second;
+        }
+
+        const uint32_t total = first.count + second.count;
+        if (first.block != nullptr && total <= first.block->Capacity) {
+            // Only the list that ends at the block's high-water mark may extend it; every other holder keeps its prefix.
+            uint32_t expected = first.count;
+            if (first.block->Used.compare_exchange_strong(expected, total, std::memory_order_acq_rel)) {
+                first.block->References.fetch_add(1, std::memory_order_relaxed);
+                CopyTargets(second, 0, second.count, first.block->Targets() + first.count);
+                return InvocationList(first.block, total);
+            }
+        }
+
+        Block* combined = Block::Allocate(GrowCapacity(total));
+        CopyTargets(first, 0, first.count, combined->Targets());
+        CopyTargets(second, 0, second.count, combined->Targets() + first.count);
+        combined->Used.store(total, std::memory_order_relaxed);
+        return InvocationList(combined, total);
+    }
+
+    /// <summary>
+    /// Returns <paramref name="source"/> without the last occurrence of <paramref name="value"/>'s targets as a
+    /// contiguous run, or <paramref name="source"/> unchanged when no such run exists.
+    /// </summary>
+    static InvocationList Remove(const InvocationList& source, const InvocationList& value) {
+        if (value.count == 0 || value.count > source.count) {
+            return source;
+        }
+
+        for (uint32_t start = source.count - value.count + 1; start-- > 0;) {
+            if (!MatchesAt(source, start, value)) {
+                continue;
+            }
+
+            const uint32_t end = start + value.count;
+            if (start == 0 && end == source.count) {
+                return InvocationList();
+            }
+
+            if (end == source.count && source.block != nullptr) {
+                source.block->References.fetch_add(1, std::memory_order_relaxed);
+                return InvocationList(source.block, start);
+            }
+
+            const uint32_t remaining = source.count - value.count;
+            if (remaining == 1) {
+                return InvocationList(source[static_cast<int32_t>(start == 0 ? end : 0)]);
+            }
+
+            Block* reduced = Block::Allocate(GrowCapacity(remaining));
+            CopyTargets(source, 0, start, reduced->Targets());
+            CopyTargets(source, end, source.count, reduced->Targets() + start);
+            reduced->Used.store(remaining, std::memory_order_relaxed);
+            return InvocationList(reduced, remaining);
+        }
+
+        return source;
+    }
+
+private:
+    /// <summary>
+    /// Shared storage for two or more targets. Targets follow the header in the same allocation; slots below
+    /// <see cref="Used"/> are constructed and never change once published.
+    /// </summary>
+    struct alignas(TargetType) Block {
+        std::atomic<int32_t> References;
+        std::atomic<uint32_t> Used;
+        uint32_t Capacity;
+
+        TargetType* Targets() noexcept {
+            return std::launder(reinterpret_cast<TargetType*>(this + 1));
+        }
+
+        static Block* Allocate(uint32_t capacity) {
+            void* memory = ::operator new(sizeof(Block) + sizeof(TargetType) * capacity);
+            Block* block = ::new (memory) Block();
+            block->References.store(1, std::memory_order_relaxed);
+            block->Used.store(0, std::memory_order_relaxed);
+            block->Capacity = capacity;
+            return block;
+        }
+
+        static void Destroy(Block* block) noexcept {
+            TargetType* targets = block->Targets();
+            const uint32_t used = block->Used.load(std::memory_order_relaxed);
+            for (uint32_t index = 0; index < used; ++index) {
+                targets[index].~TargetType();
+            }
+
+            block->~Block();
+            ::operator delete(static_cast<void*>(block));
+        }
+    };
+
+    InvocationList(Block* sharedBlock, uint32_t targetCount) noexcept
+        : block(sharedBlock), count(targetCount) {
+    }
+
+    static uint32_t GrowCapacity(uint32_t required) noexcept {
+        uint32_t capacity = 4;
+        while (capacity < required) {
+            capacity *= 2;
+        }
+
+        return capacity;
+    }
+
+    static void CopyTargets(const InvocationList& source, uint32_t begin, uint32_t end, TargetType* destination) noexcept {
+        for (uint32_t index = begin; index < end; ++index) {
+            ::new (static_cast<void*>(destination++)) TargetType(source[static_cast<int32_t>(index)]);
+        }
+    }
+
+    static bool MatchesAt(const InvocationList& source, uint32_t start, const InvocationList& value) noexcept {
+        for (uint32_t index = 0; index < value.count; ++index) {
+            if (source[static_cast<int32_t>(start + index)] != value[static_cast<int32_t>(index)]) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void Release() noexcept {
+        if (block != nullptr && block->References.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            Block::Destroy(block);
+        }
+
+        block = nullptr;
+        count = 0;
+    }
+
+    TargetType single;
+    Block* block;
+    uint32_t count;
+};
+
+#endif // HE_CPP_SYSTEM_INVOCATION_LIST_HPP
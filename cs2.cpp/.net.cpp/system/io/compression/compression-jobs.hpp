@@ -0,0 +1,67 @@
+#ifndef HE_CPP_SYSTEM_IO_COMPRESSION_COMPRESSION_JOBS_HPP
+#define HE_CPP_SYSTEM_IO_COMPRESSION_COMPRESSION_JOBS_HPP
+
+#include "helcpp_config.hpp"
+#include <cstddef>
+#include <cstdint>
+
+#if HE_CPP_PLATFORM_PS2 || HE_CPP_PLATFORM_N64 || HE_CPP_PLATFORM_DS || HE_CPP_RUNTIME_CUSTOM_RETRO
+#define HE_CPP_COMPRESSION_THREADED 0
+#else
+#define HE_CPP_COMPRESSION_THREADED 1
+#endif
+
+#if HE_CPP_COMPRESSION_THREADED
+#include <atomic>
+#include <thread>
+#include <vector>
+#endif
+
+/// <summary>
+/// Runs independent block-compression jobs, spreading them across worker threads when parallel cooking is requested.
+/// Targets without threads run the jobs in order on the caller.
+/// </summary>
+class CompressionJobs {
+public:
+    /// <summary>
+    /// Invokes <paramref name="job"/> once for every index in [0, jobCount).
+    /// </summary>
+    /// <param name="jobCount">Number of jobs to run.</param>
+    /// <param name="maxDegreeOfParallelism">Upper bound on concurrently running jobs; one or less runs inline.</param>
+    /// <param name="job">Callable invoked with each job index. It must not throw.</param>
+    template<typename TJob>
+    static void Run(size_t jobCount, int32_t maxDegreeOfParallelism, TJob job) {
+#if HE_CPP_COMPRESSION_THREADED
+        const size_t workerCount = maxDegreeOfParallelism > 1 && jobCount > 1
+            ? (jobCount < static_cast<size_t>(maxDegreeOfParallelism) ? jobCount : static_cast<size_t>(maxDegreeOfParallelism))
+            : 1;
+        if (workerCount > 1) {
+            std::atomic<size_t> nextJob(0);
+            std::vector<std::thread> workers;
+            workers.reserve(workerCount - 1);
+            auto drain = [&nextJob, jobCount, &job]() {
+                for (size_t jobIndex = nextJob.fetch_add(1); jobIndex < jobCount; jobIndex = nextJob.fetch_add(1)) {
+                    job(jobIndex);
+                }
+            };
+            for (size_t workerIndex = 1; workerIndex < workerCount; ++workerIndex) {
+                workers.emplace_back(drain);
+            }
+
+            drain();
+            for (std::thread& worker : workers) {
+                worker.join();
+            }
+
+            return;
+        }
+#else
+        (void)maxDegreeOfParallelism;
+#endif
+        for (size_t jobIndex = 0; jobIndex < jobCount; ++jobIndex) {
+            job(jobIndex);
+        }
+    }
+};
+
+#endif // HE_CPP_SYSTEM_IO_COMPRESSION_COMPRESSION_JOBS_HPP
@@ -0,0 +1,16 @@
+#ifndef HE_CPP_SYSTEM_IO_COMPRESSION_COMPRESSION_LEVEL_HPP
+#define HE_CPP_SYSTEM_IO_COMPRESSION_COMPRESSION_LEVEL_HPP
+
+#include <cstdint>
+
+/// <summary>
+/// Trades compression speed against output size, matching the managed enum order.
+/// </summary>
+enum class CompressionLevel : uint8_t {
+    Optimal,
+    Fastest,
+    NoCompression,
+    SmallestSize
+};
+
+#endif // HE_CPP_SYSTEM_IO_COMPRESSION_COMPRESSION_LEVEL_HPP
@@ -0,0 +1,14 @@
+#ifndef HE_CPP_SYSTEM_IO_COMPRESSION_COMPRESSION_MODE_HPP
+#define HE_CPP_SYSTEM_IO_COMPRESSION_COMPRESSION_MODE_HPP
+
+#include <cstdint>
+
+/// <summary>
+/// Selects whether a compression stream compresses data written to it or decompresses data read from it.
+/// </summary>
+enum class CompressionMode : uint8_t {
+    Decompress,
+    Compress
+};
+
+#endif // HE_CPP_SYSTEM_IO_COMPRESSION_COMPRESSION_MODE_HPP
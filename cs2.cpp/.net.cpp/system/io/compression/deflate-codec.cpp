@@ -0,0 +1,864 @@
+#include "deflate-codec.hpp"
+#include "helcpp_config.hpp"
+#include "../../../runtime/native_exceptions.hpp"
+#include <algorithm>
+#include <cstring>
+#include <queue>
+
+namespace {
+    const uint16_t DeflateLengthBase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+    const uint8_t DeflateLengthExtra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+    const uint16_t DeflateDistanceBase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+    const uint8_t DeflateDistanceExtra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+    const uint8_t DeflateCodeLengthOrder[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+    const int DeflateLiteralCount = 286;
+    const int DeflateDistanceCount = 30;
+    const int DeflateEndOfBlock = 256;
+    const size_t DeflateMaxMatch = 258;
+    const size_t DeflateMaxDistance = 32768;
+    const size_t DeflateStoredBlockLimit = 65535;
+
+    void ThrowInvalidDeflateData() {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+        throw InvalidOperationException();
+#else
+        throw InvalidOperationException("The Deflate stream contains invalid data.");
+#endif
+    }
+
+    class DeflateBitWriter {
+    public:
+        explicit DeflateBitWriter(std::vector<uint8_t>& output)
+            : output(output),
+              bits(0),
+              bitCount(0) {
+        }
+
+        void Write(uint32_t value, int count) {
+            bits |= static_cast<uint64_t>(value) << bitCount;
+            bitCount += count;
+            while (bitCount >= 8) {
+                output.push_back(static_cast<uint8_t>(bits));
+                bits >>= 8;
+                bitCount -= 8;
+            }
+        }
+
+        void AlignToByte() {
+            if (bitCount > 0) {
+                output.push_back(static_cast<uint8_t>(bits));
+                bits = 0;
+                bitCount = 0;
+            }
+        }
+
+    private:
+        std::vector<uint8_t>& output;
+        uint64_t bits;
+        int bitCount;
+    };
+
+    uint32_t ReverseDeflateBits(uint32_t code, int length) {
+        uint32_t reversed = 0;
+        for (int bitIndex = 0; bitIndex < length; ++bitIndex) {
+            reversed = (reversed << 1) | (code & 1u);
+            code >>= 1;
+        }
+
+        return reversed;
+    }
+
+    int FindDeflateLengthSymbol(size_t length) {
+        return static_cast<int>(std::upper_bound(DeflateLengthBase, DeflateLengthBase + 29, static_cast<uint16_t>(length)) - DeflateLengthBase) - 1;
+    }
+
+    int FindDeflateDistanceSymbol(size_t distance) {
+        return static_cast<int>(std::upper_bound(DeflateDistanceBase, DeflateDistanceBase + 30, static_cast<uint16_t>(distance)) - DeflateDistanceBase) - 1;
+    }
+
+    // Builds length-limited Huffman code lengths; frequencies are halved and the tree rebuilt until it fits.
+    void BuildDeflateCodeLengths(const uint32_t* frequencies, int symbolCount, int maxLength, uint8_t* lengths) {
+        std::vector<uint32_t> weights(frequencies, frequencies + symbolCount);
+        std::fill(lengths, lengths + symbolCount, static_cast<uint8_t>(0));
+        while (true) {
+            std::vector<uint32_t> nodeWeights;
+            std::vector<int> nodeParents;
+            std::vector<int> leafNodes(static_cast<size_t>(symbolCount), -1);
+            typedef std::pair<uint32_t, int> QueueItem;
+            std::priority_queue<QueueItem, std::vector<QueueItem>, std::greater<QueueItem>> queue;
+            for (int symbol = 0; symbol < symbolCount; ++symbol) {
+                if (weights[static_cast<size_t>(symbol)] == 0) {
+                    continue;
+                }
+
+                leafNodes[static_cast<size_t>(symbol)] = static_cast<int>(nodeWeights.size());
+                queue.push(QueueItem(weights[static_cast<size_t>(symbol)], static_cast<int>(nodeWeights.size())));
+                nodeWeights.push_back(weights[static_cast<size_t>(symbol)]);
+                nodeParents.push_back(-1);
+            }
+
+            if (queue.size() < 2) {
+                return;
+            }
+
+            while (queue.size() > 1) {
+                const QueueItem left = queue.top();
+                queue.pop();
+                const QueueItem right = queue.top();
+                queue.pop();
+                const int parent = static_cast<int>(nodeWeights.size());
+                nodeWeights.push_back(left.first + right.first);
+                nodeParents.push_back(-1);
+                nodeParents[static_cast<size_t>(left.second)] = parent;
+                nodeParents[static_cast<size_t>(right.second)] = parent;
+                queue.push(QueueItem(left.first + right.first, parent));
+            }
+
+            std::vector<int> depths(nodeWeights.size(), 0);
+            for (size_t nodeIndex = nodeWeights.size(); nodeIndex > 0; --nodeIndex) {
+                const int parent = nodeParents[nodeIndex - 1];
+                if (parent >= 0) {
+                    depths[nodeIndex - 1] = depths[static_cast<size_t>(parent)] + 1;
+                }
+            }
+
+            bool fits = true;
+            for (int symbol = 0; symbol < symbolCount; ++symbol) {
+                const int node = leafNodes[static_cast<size_t>(symbol)];
+                const int depth = node >= 0 ? depths[static_cast<size_t>(node)] : 0;
+                fits = fits && depth <= maxLength;
+                lengths[symbol] = static_cast<uint8_t>(depth);
+            }
+
+            if (fits) {
+                return;
+            }
+
+            for (uint32_t& weight : weights) {
+                if (weight != 0) {
+                    weight = (weight + 1) / 2;
+                }
+            }
+        }
+    }
+
+    void BuildDeflateCanonicalCodes(const uint8_t* lengths, int symbolCount, uint16_t* codes) {
+        uint16_t lengthCounts[16] = {};
+        for (int symbol = 0; symbol < symbolCount; ++symbol) {
+            lengthCounts[lengths[symbol]]++;
+        }
+
+        lengthCounts[0] = 0;
+        uint16_t nextCode[16] = {};
+        uint16_t code = 0;
+        for (int length = 1; length < 16; ++length) {
+            code = static_cast<uint16_t>((code + lengthCounts[length - 1]) << 1);
+            nextCode[length] = code;
+        }
+
+        for (int symbol = 0; symbol < symbolCount; ++symbol) {
+            const uint8_t length = lengths[symbol];
+            codes[symbol] = length == 0 ? 0 : static_cast<uint16_t>(ReverseDeflateBits(nextCode[length]++, length));
+        }
+    }
+
+    // Guarantees at least two used symbols so every emitted code is complete.
+    void EnsureTwoDeflateSymbols(uint32_t* frequencies, int symbolCount) {
+        int used = 0;
+        for (int symbol = 0; symbol < symbolCount && used < 2; ++symbol) {
+            used += frequencies[symbol] != 0 ? 1 : 0;
+        }
+
+        for (int symbol = 0; symbol < symbolCount && used < 2; ++symbol) {
+            if (frequencies[symbol] == 0) {
+                frequencies[symbol] = 1;
+                ++used;
+            }
+        }
+    }
+
+    struct DeflateToken {
+        uint16_t LiteralOrLength;
+        uint16_t Distance;
+    };
+
+    struct DeflateMatchSettings {
+        int MaxChain;
+        size_t NiceLength;
+        bool Lazy;
+    };
+
+    DeflateMatchSettings ResolveDeflateMatchSettings(CompressionLevel level) {
+        switch (level) {
+        case CompressionLevel::Fastest: return DeflateMatchSettings{ 4, 32, false };
+        case CompressionLevel::SmallestSize: return DeflateMatchSettings{ 256, DeflateMaxMatch, true };
+        default: return DeflateMatchSettings{ 32, 128, true };
+        }
+    }
+
+    class DeflateMatchFinder {
+    public:
+        static constexpr int HashBits = 15;
+
+        DeflateMatchFinder(const uint8_t* input, size_t length, DeflateMatchSettings settings)
+            : input(input),
+              length(length),
+              settings(settings),
+              head(static_cast<size_t>(1) << HashBits, -1),
+              previous(length, -1) {
+        }
+
+        void Insert(size_t position) {
+            if (position + 3 > length) {
+                return;
+            }
+
+            const uint32_t hash = Hash(position);
+            previous[position] = head[hash];
+            head[hash] = static_cast<int32_t>(position);
+        }
+
+        size_t Find(size_t position, size_t& distance) const {
+            distance = 0;
+            if (position + 3 > length) {
+                return 0;
+            }
+
+            const size_t maxLength = std::min(DeflateMaxMatch, length - position);
+            size_t bestLength = 0;
+            int32_t candidate = head[Hash(position)];
+            for (int chain = 0; candidate >= 0 && chain < settings.MaxChain; ++chain) {
+                const size_t candidatePosition = static_cast<size_t>(candidate);
+                if (position - candidatePosition > DeflateMaxDistance) {
+                    break;
+                }
+
+                if (input[candidatePosition + bestLength] == input[position + bestLength]) {
+                    size_t matchLength = 0;
+                    while (matchLength < maxLength && input[candidatePosition + matchLength] == input[position + matchLength]) {
+                        ++matchLength;
+                    }
+
+                    if (matchLength > bestLength) {
+                        bestLength = matchLength;
+                        distance = position - candidatePosition;
+                        if (matchLength >= settings.NiceLength || matchLength == maxLength) {
+                            break;
+                        }
+                    }
+                }
+
+                candidate = previous[candidatePosition];
+            }
+
+            return bestLength >= 3 ? bestLength : 0;
+        }
+
+    private:
+        uint32_t Hash(size_t position) const {
+            const uint32_t value = (static_cast<uint32_t>(input[position]) << 16) |
+                (static_cast<uint32_t>(input[position + 1]) << 8) |
+                static_cast<uint32_t>(input[position + 2]);
+            return (value * 2654435761u) >> (32 - HashBits);
+        }
+
+        const uint8_t* input;
+        size_t length;
+        DeflateMatchSettings settings;
+        std::vector<int32_t> head;
+        std::vector<int32_t> previous;
+    };
+
+    void TokenizeDeflateChunk(const uint8_t* input, size_t length, CompressionLevel level, std::vector<DeflateToken>& tokens) {
+        const DeflateMatchSettings settings = ResolveDeflateMatchSettings(level);
+        DeflateMatchFinder finder(input, length, settings);
+        size_t position = 0;
+        size_t matchLength = 0;
+        size_t matchDistance = 0;
+        bool hasPendingMatch = false;
+        while (position < length) {
+            if (!hasPendingMatch) {
+                matchLength = finder.Find(position, matchDistance);
+            }
+
+            hasPendingMatch = false;
+            if (matchLength == 0) {
+                tokens.push_back(DeflateToken{ input[position], 0 });
+                finder.Insert(position);
+                ++position;
+                continue;
+            }
+
+            finder.Insert(position);
+            if (settings.Lazy && matchLength < settings.NiceLength) {
+                size_t nextDistance = 0;
+                const size_t nextLength = finder.Find(position + 1, nextDistance);
+                if (nextLength > matchLength) {
+                    tokens.push_back(DeflateToken{ input[position], 0 });
+                    ++position;
+                    matchLength = nextLength;
+                    matchDistance = nextDistance;
+                    hasPendingMatch = true;
+                    continue;
+                }
+            }
+
+            tokens.push_back(DeflateToken{ static_cast<uint16_t>(matchLength), static_cast<uint16_t>(matchDistance) });
+            for (size_t offset = 1; offset < matchLength; ++offset) {
+                finder.Insert(position + offset);
+            }
+
+            position += matchLength;
+        }
+    }
+
+    void WriteDeflateStoredBlocks(const uint8_t* input, size_t length, std::vector<uint8_t>& output) {
+        size_t offset = 0;
+        do {
+            const size_t blockLength = std::min(DeflateStoredBlockLimit, length - offset);
+            DeflateBitWriter writer(output);
+            writer.Write(0, 3);
+            writer.AlignToByte();
+            output.push_back(static_cast<uint8_t>(blockLength));
+            output.push_back(static_cast<uint8_t>(blockLength >> 8));
+            output.push_back(static_cast<uint8_t>(~blockLength));
+            output.push_back(static_cast<uint8_t>(~blockLength >> 8));
+            output.insert(output.end(), input + offset, input + offset + blockLength);
+            offset += blockLength;
+        } while (offset < length);
+    }
+
+    void WriteDeflateDynamicBlock(const std::vector<DeflateToken>& tokens, std::vector<uint8_t>& output) {
+        uint32_t literalFrequencies[DeflateLiteralCount] = {};
+        uint32_t distanceFrequencies[DeflateDistanceCount] = {};
+        for (const DeflateToken& token : tokens) {
+            if (token.Distance == 0) {
+                literalFrequencies[token.LiteralOrLength]++;
+            } else {
+                literalFrequencies[257 + FindDeflateLengthSymbol(token.LiteralOrLength)]++;
+                distanceFrequencies[FindDeflateDistanceSymbol(token.Distance)]++;
+            }
+        }
+
+        literalFrequencies[DeflateEndOfBlock] = 1;
+        EnsureTwoDeflateSymbols(literalFrequencies, DeflateLiteralCount);
+        EnsureTwoDeflateSymbols(distanceFrequencies, DeflateDistanceCount);
+
+        uint8_t literalLengths[DeflateLiteralCount];
+        uint8_t distanceLengths[DeflateDistanceCount];
+        BuildDeflateCodeLengths(literalFrequencies, DeflateLiteralCount, 15, literalLengths);
+        BuildDeflateCodeLengths(distanceFrequencies, DeflateDistanceCount, 15, distanceLengths);
+
+        int literalCodeCount = DeflateLiteralCount;
+        while (literalCodeCount > 257 && literalLengths[literalCodeCount - 1] == 0) {
+            --literalCodeCount;
+        }
+
+        int distanceCodeCount = DeflateDistanceCount;
+        while (distanceCodeCount > 1 && distanceLengths[distanceCodeCount - 1] == 0) {
+            --distanceCodeCount;
+        }
+
+        std::vector<uint8_t> combinedLengths(literalLengths, literalLengths + literalCodeCount);
+        combinedLengths.insert(combinedLengths.end(), distanceLengths, distanceLengths + distanceCodeCount);
+
+        // Run-length encode the code lengths with symbols 16 (repeat previous), 17 and 18 (zero runs).
+        std::vector<uint16_t> lengthSymbols;
+        uint32_t codeLengthFrequencies[19] = {};
+        for (size_t index = 0; index < combinedLengths.size();) {
+            const uint8_t value = combinedLengths[index];
+            size_t runLength = 1;
+            while (index + runLength < combinedLengths.size() && combinedLengths[index + runLength] == value) {
+                ++runLength;
+            }
+
+            size_t remaining = runLength;
+            if (value == 0) {
+                while (remaining >= 11) {
+                    const size_t count = std::min<size_t>(remaining, 138);
+                    lengthSymbols.push_back(static_cast<uint16_t>(18 | ((count - 11) << 8)));
+                    codeLengthFrequencies[18]++;
+                    remaining -= count;
+                }
+
+                if (remaining >= 3) {
+                    lengthSymbols.push_back(static_cast<uint16_t>(17 | ((remaining - 3) << 8)));
+                    codeLengthFrequencies[17]++;
+                    remaining = 0;
+                }
+            } else {
+                lengthSymbols.push_back(value);
+                codeLengthFrequencies[value]++;
+                --remaining;
+                while (remaining >= 3) {
+                    const size_t count = std::min<size_t>(remaining, 6);
+                    lengthSymbols.push_back(static_cast<uint16_t>(16 | ((count - 3) << 8)));
+                    codeLengthFrequencies[16]++;
+                    remaining -= count;
+                }
+            }
+
+            for (; remaining > 0; --remaining) {
+                lengthSymbols.push_back(value);
+                codeLengthFrequencies[value]++;
+            }
+
+            index += runLength;
+        }
+
+        EnsureTwoDeflateSymbols(codeLengthFrequencies, 19);
+        uint8_t codeLengthLengths[19];
+        uint16_t codeLengthCodes[19];
+        BuildDeflateCodeLengths(codeLengthFrequencies, 19, 7, codeLengthLengths);
+        BuildDeflateCanonicalCodes(codeLengthLengths, 19, codeLengthCodes);
+
+        int codeLengthCodeCount = 19;
+        while (codeLengthCodeCount > 4 && codeLengthLengths[DeflateCodeLengthOrder[codeLengthCodeCount - 1]] == 0) {
+            --codeLengthCodeCount;
+        }
+
+        uint16_t literalCodes[DeflateLiteralCount];
+        uint16_t distanceCodes[DeflateDistanceCount];
+        BuildDeflateCanonicalCodes(literalLengths, DeflateLiteralCount, literalCodes);
+        BuildDeflateCanonicalCodes(distanceLengths, DeflateDistanceCount, distanceCodes);
+
+        DeflateBitWriter writer(output);
+        writer.Write(0, 1);
+        writer.Write(2, 2);
+        writer.Write(static_cast<uint32_t>(literalCodeCount - 257), 5);
+        writer.Write(static_cast<uint32_t>(distanceCodeCount - 1), 5);
+        writer.Write(static_cast<uint32_t>(codeLengthCodeCount - 4), 4);
+        for (int index = 0; index < codeLengthCodeCount; ++index) {
+            writer.Write(codeLengthLengths[DeflateCodeLengthOrder[index]], 3);
+        }
+
+        for (uint16_t lengthSymbol : lengthSymbols) {
+            const int symbol = lengthSymbol & 0xFF;
+            writer.Write(codeLengthCodes[symbol], codeLengthLengths[symbol]);
+            if (symbol == 16) {
+                writer.Write(lengthSymbol >> 8, 2);
+            } else if (symbol == 17) {
+                writer.Write(lengthSymbol >> 8, 3);
+            } else if (symbol == 18) {
+                writer.Write(lengthSymbol >> 8, 7);
+            }
+        }
+
+        for (const DeflateToken& token : tokens) {
+            if (token.Distance == 0) {
+                writer.Write(literalCodes[token.LiteralOrLength], literalLengths[token.LiteralOrLength]);
+                continue;
+            }
+
+            const int lengthSymbol = FindDeflateLengthSymbol(token.LiteralOrLength);
+            writer.Write(literalCodes[257 + lengthSymbol], literalLengths[257 + lengthSymbol]);
+            writer.Write(static_cast<uint32_t>(token.LiteralOrLength - DeflateLengthBase[lengthSymbol]), DeflateLengthExtra[lengthSymbol]);
+            const int distanceSymbol = FindDeflateDistanceSymbol(token.Distance);
+            writer.Write(distanceCodes[distanceSymbol], distanceLengths[distanceSymbol]);
+            writer.Write(static_cast<uint32_t>(token.Distance - DeflateDistanceBase[distanceSymbol]), DeflateDistanceExtra[distanceSymbol]);
+        }
+
+        writer.Write(literalCodes[DeflateEndOfBlock], literalLengths[DeflateEndOfBlock]);
+
+        // Sync flush: an empty stored block leaves the chunk byte-aligned so chunks concatenate.
+        writer.Write(0, 3);
+        writer.AlignToByte();
+        const uint8_t syncMarker[4] = { 0x00, 0x00, 0xFF, 0xFF };
+        output.insert(output.end(), syncMarker, syncMarker + 4);
+    }
+}
+
+void DeflateEncoder::CompressChunk(const uint8_t* input, size_t length, CompressionLevel level, std::vector<uint8_t>& output) {
+    if (length == 0) {
+        return;
+    }
+
+    if (level == CompressionLevel::NoCompression) {
+        WriteDeflateStoredBlocks(input, length, output);
+        return;
+    }
+
+    std::vector<DeflateToken> tokens;
+    tokens.reserve(length / 2);
+    TokenizeDeflateChunk(input, length, level, tokens);
+
+    const size_t chunkStart = output.size();
+    WriteDeflateDynamicBlock(tokens, output);
+    const size_t storedSize = length + 5 * (length / DeflateStoredBlockLimit + 1);
+    if (output.size() - chunkStart > storedSize) {
+        output.resize(chunkStart);
+        WriteDeflateStoredBlocks(input, length, output);
+    }
+}
+
+void DeflateEncoder::AppendFinalBlock(std::vector<uint8_t>& output) {
+    // BFINAL=1, fixed Huffman, end-of-block only.
+    output.push_back(0x03);
+    output.push_back(0x00);
+}
+
+void DeflateHuffmanTable::Build(const uint8_t* lengths, int symbolCount) {
+    std::memset(Counts, 0, sizeof(Counts));
+    std::memset(Fast, 0, sizeof(Fast));
+    for (int symbol = 0; symbol < symbolCount; ++symbol) {
+        Counts[lengths[symbol]]++;
+    }
+
+    Counts[0] = 0;
+    int available = 1;
+    for (int length = 1; length < 16; ++length) {
+        available = (available << 1) - Counts[length];
+        if (available < 0) {
+            ThrowInvalidDeflateData();
+        }
+    }
+
+    uint16_t offsets[16] = {};
+    for (int length = 1; length < 15; ++length) {
+        offsets[length + 1] = static_cast<uint16_t>(offsets[length] + Counts[length]);
+    }
+
+    for (int symbol = 0; symbol < symbolCount; ++symbol) {
+        if (lengths[symbol] != 0) {
+            Symbols[offsets[lengths[symbol]]++] = static_cast<uint16_t>(symbol);
+        }
+    }
+
+    uint32_t code = 0;
+    int symbolIndex = 0;
+    for (int length = 1; length <= FastBits; ++length) {
+        for (int count = 0; count < Counts[length]; ++count, ++symbolIndex, ++code) {
+            const uint32_t reversed = ReverseDeflateBits(code, length);
+            for (uint32_t fill = reversed; fill < (1u << FastBits); fill += 1u << length) {
+                Fast[fill] = static_cast<uint16_t>((Symbols[symbolIndex] << 4) | length);
+            }
+        }
+
+        code <<= 1;
+    }
+}
+
+DeflateDecoder::DeflateDecoder(Stream* source)
+    : source(source),
+      input(InputBufferSize),
+      inputPosition(0),
+      inputEnd(0),
+      bitBuffer(0),
+      bitCount(0),
+      window(WindowSize),
+      windowPosition(0),
+      totalOutput(0),
+      state(DecoderState::BlockHeader),
+      lastBlock(false),
+      storedRemaining(0),
+      copyLength(0),
+      copyDistance(0) {
+}
+
+bool DeflateDecoder::FetchByte(uint8_t& value) {
+    if (inputPosition == inputEnd) {
+        inputPosition = 0;
+        inputEnd = source != nullptr ? source->Read(input.data(), 0, input.size()) : 0;
+        if (inputEnd == 0) {
+            return false;
+        }
+    }
+
+    value = input[inputPosition++];
+    return true;
+}
+
+void DeflateDecoder::Fill() {
+    uint8_t value = 0;
+    while (bitCount <= 56 && FetchByte(value)) {
+        bitBuffer |= static_cast<uint64_t>(value) << bitCount;
+        bitCount += 8;
+    }
+}
+
+uint32_t DeflateDecoder::ReadBits(int count) {
+    if (bitCount < count) {
+        Fill();
+        if (bitCount < count) {
+            ThrowInvalidDeflateData();
+        }
+    }
+
+    const uint32_t value = static_cast<uint32_t>(bitBuffer & ((static_cast<uint64_t>(1) << count) - 1));
+    bitBuffer >>= count;
+    bitCount -= count;
+    return value;
+}
+
+void DeflateDecoder::AlignToByte() {
+    const int dropped = bitCount & 7;
+    bitBuffer >>= dropped;
+    bitCount -= dropped;
+}
+
+int DeflateDecoder::ReadAlignedByte() {
+    AlignToByte();
+    if (bitCount >= 8) {
+        const int value = static_cast<int>(bitBuffer & 0xFF);
+        bitBuffer >>= 8;
+        bitCount -= 8;
+        return value;
+    }
+
+    uint8_t value = 0;
+    return FetchByte(value) ? value : -1;
+}
+
+int DeflateDecoder::DecodeSymbol(const DeflateHuffmanTable& table) {
+    if (bitCount < 15) {
+        Fill();
+    }
+
+    const uint16_t entry = table.Fast[bitBuffer & ((1u << DeflateHuffmanTable::FastBits) - 1)];
+    if (entry != 0 && (entry & 15) <= bitCount) {
+        bitBuffer >>= entry & 15;
+        bitCount -= entry & 15;
+        return entry >> 4;
+    }
+
+    int code = 0;
+    int first = 0;
+    int index = 0;
+    for (int length = 1; length < 16; ++length) {
+        if (length > bitCount) {
+            break;
+        }
+
+        code |= static_cast<int>((bitBuffer >> (length - 1)) & 1u);
+        const int count = table.Counts[length];
+        if (code - count < first) {
+            bitBuffer >>= length;
+            bitCount -= length;
+            return table.Symbols[index + (code - first)];
+        }
+
+        index += count;
+        first = (first + count) << 1;
+        code <<= 1;
+    }
+
+    ThrowInvalidDeflateData();
+    return -1;
+}
+
+void DeflateDecoder::ReadDynamicTables() {
+    const int literalCodeCount = static_cast<int>(ReadBits(5)) + 257;
+    const int distanceCodeCount = static_cast<int>(ReadBits(5)) + 1;
+    const int codeLengthCodeCount = static_cast<int>(ReadBits(4)) + 4;
+    if (literalCodeCount > DeflateLiteralCount || distanceCodeCount > DeflateDistanceCount) {
+        ThrowInvalidDeflateData();
+    }
+
+    uint8_t codeLengthLengths[19] = {};
+    for (int index = 0; index < codeLengthCodeCount; ++index) {
+        codeLengthLengths[DeflateCodeLengthOrder[index]] = static_cast<uint8_t>(ReadBits(3));
+    }
+
+    DeflateHuffmanTable codeLengthTable;
+    codeLengthTable.Build(codeLengthLengths, 19);
+
+    uint8_t lengths[DeflateLiteralCount + DeflateDistanceCount] = {};
+    const int totalCodeCount = literalCodeCount + distanceCodeCount;
+    for (int index = 0; index < totalCodeCount;) {
+        const int symbol = DecodeSymbol(codeLengthTable);
+        if (symbol < 16) {
+            lengths[index++] = static_cast<uint8_t>(symbol);
+            continue;
+        }
+
+        uint8_t value = 0;
+        int repeat = 0;
+        if (symbol == 16) {
+            if (index == 0) {
+                ThrowInvalidDeflateData();
+            }
+
+            value = lengths[index - 1];
+            repeat = 3 + static_cast<int>(ReadBits(2));
+        } else if (symbol == 17) {
+            repeat = 3 + static_cast<int>(ReadBits(3));
+        } else {
+            repeat = 11 + static_cast<int>(ReadBits(7));
+        }
+
+        if (index + repeat > totalCodeCount) {
+            ThrowInvalidDeflateData();
+        }
+
+        for (; repeat > 0; --repeat) {
+            lengths[index++] = value;
+        }
+    }
+
+    if (lengths[DeflateEndOfBlock] == 0) {
+        ThrowInvalidDeflateData();
+    }
+
+    literalTable.Build(lengths, literalCodeCount);
+    distanceTable.Build(lengths + literalCodeCount, distanceCodeCount);
+}
+
+void DeflateDecoder::ReadBlockHeader() {
+    if (lastBlock) {
+        state = DecoderState::Done;
+        return;
+    }
+
+    lastBlock = ReadBits(1) != 0;
+    const uint32_t blockType = ReadBits(2);
+    if (blockType == 0) {
+        AlignToByte();
+        const uint32_t length = ReadBits(16);
+        const uint32_t lengthComplement = ReadBits(16);
+        if ((length ^ 0xFFFFu) != lengthComplement) {
+            ThrowInvalidDeflateData();
+        }
+
+        storedRemaining = length;
+        state = DecoderState::Stored;
+    } else if (blockType == 1) {
+        uint8_t lengths[288 + 30];
+        std::memset(lengths, 8, 144);
+        std::memset(lengths + 144, 9, 112);
+        std::memset(lengths + 256, 7, 24);
+        std::memset(lengths + 280, 8, 8);
+        std::memset(lengths + 288, 5, 30);
+        literalTable.Build(lengths, 288);
+        distanceTable.Build(lengths + 288, 30);
+        state = DecoderState::Huffman;
+    } else if (blockType == 2) {
+        ReadDynamicTables();
+        state = DecoderState::Huffman;
+    } else {
+        ThrowInvalidDeflateData();
+    }
+}
+
+void DeflateDecoder::Emit(uint8_t* destination, size_t& produced, uint8_t value) {
+    destination[produced++] = value;
+    window[windowPosition & (WindowSize - 1)] = value;
+    ++windowPosition;
+    ++totalOutput;
+}
+
+size_t DeflateDecoder::Decode(uint8_t* destination, size_t count) {
+    size_t produced = 0;
+    while (produced < count) {
+        if (copyLength > 0) {
+            while (copyLength > 0 && produced < count) {
+                Emit(destination, produced, window[(windowPosition - copyDistance) & (WindowSize - 1)]);
+                --copyLength;
+            }
+
+            continue;
+        }
+
+        switch (state) {
+        case DecoderState::Done:
+            return produced;
+        case DecoderState::BlockHeader:
+            ReadBlockHeader();
+            break;
+        case DecoderState::Stored: {
+            if (storedRemaining == 0) {
+                state = DecoderState::BlockHeader;
+                break;
+            }
+
+            const int value = ReadAlignedByte();
+            if (value < 0) {
+                ThrowInvalidDeflateData();
+            }
+
+            Emit(destination, produced, static_cast<uint8_t>(value));
+            --storedRemaining;
+            break;
+        }
+        case DecoderState::Huffman: {
+            const int symbol = DecodeSymbol(literalTable);
+            if (symbol < 256) {
+                Emit(destination, produced, static_cast<uint8_t>(symbol));
+                break;
+            }
+
+            if (symbol == DeflateEndOfBlock) {
+                state = DecoderState::BlockHeader;
+                break;
+            }
+
+            const int lengthSymbol = symbol - 257;
+            if (lengthSymbol >= 29) {
+                ThrowInvalidDeflateData();
+            }
+
+            copyLength = DeflateLengthBase[lengthSymbol] + ReadBits(DeflateLengthExtra[lengthSymbol]);
+            const int distanceSymbol = DecodeSymbol(distanceTable);
+            if (distanceSymbol >= 30) {
+                ThrowInvalidDeflateData();
+            }
+
+            copyDistance = DeflateDistanceBase[distanceSymbol] + ReadBits(DeflateDistanceExtra[distanceSymbol]);
+            if (copyDistance > totalOutput) {
+                ThrowInvalidDeflateData();
+            }
+
+            break;
+        }
+        }
+    }
+
+    return produced;
+}
+
+bool DeflateDecoder::IsFinished() const {
+    return state == DecoderState::Done && copyLength == 0;
+}
+
+uint32_t DeflateChecksums::Crc32(uint32_t crc, const uint8_t* data, size_t length) {
+    static uint32_t table[256];
+    static bool tableReady = false;
+    if (!tableReady) {
+        for (uint32_t entryIndex = 0; entryIndex < 256; ++entryIndex) {
+            uint32_t value = entryIndex;
+            for (int bitIndex = 0; bitIndex < 8; ++bitIndex) {
+                value = (value & 1u) != 0 ? 0xEDB88320u ^ (value >> 1) : value >> 1;
+            }
+
+            table[entryIndex] = value;
+        }
+
+        tableReady = true;
+    }
+
+    crc = ~crc;
+    for (size_t index = 0; index < length; ++index) {
+        crc = table[(crc ^ data[index]) & 0xFFu] ^ (crc >> 8);
+    }
+
+    return ~crc;
+}
+
+uint32_t DeflateChecksums::Adler32(uint32_t adler, const uint8_t* data, size_t length) {
+    uint32_t low = adler & 0xFFFFu;
+    uint32_t high = adler >> 16;
+    while (length > 0) {
+        const size_t block = std::min<size_t>(length, 5552);
+        for (size_t index = 0; index < block; ++index) {
+            low += data[index];
+            high += low;
+        }
+
+        low %= 65521u;
+        high %= 65521u;
+        data += block;
+        length -= block;
+    }
+
+    return (high << 16) | low;
+}
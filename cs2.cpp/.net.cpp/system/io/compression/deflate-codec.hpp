@@ -0,0 +1,115 @@
+#ifndef HE_CPP_SYSTEM_IO_COMPRESSION_DEFLATE_CODEC_HPP
+#define HE_CPP_SYSTEM_IO_COMPRESSION_DEFLATE_CODEC_HPP
+
+#include "compression-level.hpp"
+#include "../stream.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/// <summary>
+/// Compresses raw Deflate (RFC 1951) data in independent chunks. Every chunk ends on a byte boundary with an empty
+/// stored block, so chunks compressed on different threads concatenate into one valid Deflate stream.
+/// </summary>
+class DeflateEncoder {
+public:
+    /// <summary>
+    /// Number of input bytes compressed as one independent chunk.
+    /// </summary>
+    static constexpr size_t ChunkSize = 128 * 1024;
+
+    /// <summary>
+    /// Appends the compressed form of one chunk, without the final-block marker, to <paramref name="output"/>.
+    /// </summary>
+    static void CompressChunk(const uint8_t* input, size_t length, CompressionLevel level, std::vector<uint8_t>& output);
+
+    /// <summary>
+    /// Appends the empty final block that terminates a Deflate stream.
+    /// </summary>
+    static void AppendFinalBlock(std::vector<uint8_t>& output);
+};
+
+/// <summary>
+/// Canonical Huffman decoding table with a 9-bit direct lookup for short codes.
+/// </summary>
+struct DeflateHuffmanTable {
+    static constexpr int FastBits = 9;
+
+    uint16_t Counts[16];
+    uint16_t Symbols[288];
+    uint16_t Fast[1 << FastBits];
+
+    void Build(const uint8_t* lengths, int symbolCount);
+};
+
+/// <summary>
+/// Streams raw Deflate data out of a source stream with bounded memory: a 32 KB history window plus a 16 KB input
+/// buffer. Output is produced on demand, so a caller can decode arbitrarily large payloads in small reads.
+/// </summary>
+class DeflateDecoder {
+public:
+    explicit DeflateDecoder(Stream* source);
+
+    /// <summary>
+    /// Decodes up to <paramref name="count"/> bytes and returns how many were produced; zero means end of data.
+    /// </summary>
+    size_t Decode(uint8_t* destination, size_t count);
+
+    /// <summary>
+    /// Gets whether the final Deflate block has been fully decoded.
+    /// </summary>
+    bool IsFinished() const;
+
+    /// <summary>
+    /// Reads one byte from the byte-aligned input, used for container headers and trailers. Returns -1 at end of input.
+    /// </summary>
+    int ReadAlignedByte();
+
+private:
+    enum class DecoderState : uint8_t {
+        BlockHeader,
+        Stored,
+        Huffman,
+        Done
+    };
+
+    static constexpr size_t WindowSize = 32 * 1024;
+    static constexpr size_t InputBufferSize = 16 * 1024;
+
+    bool FetchByte(uint8_t& value);
+    void Fill();
+    uint32_t ReadBits(int count);
+    void AlignToByte();
+    int DecodeSymbol(const DeflateHuffmanTable& table);
+    void ReadBlockHeader();
+    void ReadDynamicTables();
+    void Emit(uint8_t* destination, size_t& produced, uint8_t value);
+
+    Stream* source;
+    std::vector<uint8_t> input;
+    size_t inputPosition;
+    size_t inputEnd;
+    uint64_t bitBuffer;
+    int bitCount;
+    std::vector<uint8_t> window;
+    size_t windowPosition;
+    uint64_t totalOutput;
+    DecoderState state;
+    bool lastBlock;
+    uint32_t storedRemaining;
+    uint32_t copyLength;
+    uint32_t copyDistance;
+    DeflateHuffmanTable literalTable;
+    DeflateHuffmanTable distanceTable;
+};
+
+/// <summary>
+/// Checksums used by the zlib and gzip Deflate containers.
+/// </summary>
+class DeflateChecksums {
+public:
+    static uint32_t Crc32(uint32_t crc, const uint8_t* data, size_t length);
+    static uint32_t Adler32(uint32_t adler, const uint8_t* data, size_t length);
+};
+
+#endif // HE_CPP_SYSTEM_IO_COMPRESSION_DEFLATE_CODEC_HPP
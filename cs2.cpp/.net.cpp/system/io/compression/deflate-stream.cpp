@@ -0,0 +1,371 @@
+#include "deflate-stream.hpp"
+#include "compression-jobs.hpp"
+#include <algorithm>
+
+namespace {
+    void ThrowDeflateStreamNotSupported() {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+        throw NotSupportedException();
+#else
+        throw NotSupportedException("Compression streams do not support seeking");
+#endif
+    }
+
+    void ThrowDeflateStreamInvalidData() {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+        throw InvalidOperationException();
+#else
+        throw InvalidOperationException("The compressed stream header or trailer is invalid.");
+#endif
+    }
+}
+
+DeflateStream::DeflateStream(Stream* stream, CompressionMode mode, bool leaveOpen)
+    : DeflateStream(stream, mode, CompressionLevel::Optimal, leaveOpen, DeflateStreamFormat::Raw) {
+}
+
+DeflateStream::DeflateStream(Stream* stream, CompressionLevel compressionLevel, bool leaveOpen)
+    : DeflateStream(stream, CompressionMode::Compress, compressionLevel, leaveOpen, DeflateStreamFormat::Raw) {
+}
+
+DeflateStream::DeflateStream(Stream* stream, CompressionMode mode, CompressionLevel compressionLevel, bool leaveOpen, DeflateStreamFormat format)
+    : baseStream(stream),
+      mode(mode),
+      compressionLevel(compressionLevel),
+      format(format),
+      leaveOpen(leaveOpen),
+      closed(false),
+      headerProcessed(false),
+      trailerProcessed(false),
+      maxDegreeOfParallelism(1),
+      checksum(format == DeflateStreamFormat::ZLib ? 1u : 0u),
+      totalLength(0) {
+    if (stream == nullptr) {
+        throw ArgumentNullException("stream");
+    }
+
+    if (mode == CompressionMode::Decompress) {
+        decoder.reset(new DeflateDecoder(stream));
+    }
+}
+
+DeflateStream::~DeflateStream() {
+    Close();
+}
+
+Stream* DeflateStream::get_BaseStream() const {
+    return baseStream;
+}
+
+int32_t DeflateStream::get_MaxDegreeOfParallelism() const {
+    return maxDegreeOfParallelism;
+}
+
+void DeflateStream::set_MaxDegreeOfParallelism(int32_t value) {
+    if (value < 1) {
+        throw ArgumentOutOfRangeException("value");
+    }
+
+    maxDegreeOfParallelism = value;
+}
+
+size_t DeflateStream::Read(Span<uint8_t> buffer) {
+    ThrowIfClosed();
+    if (mode != CompressionMode::Decompress) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+        throw InvalidOperationException();
+#else
+        throw InvalidOperationException("Reading from a compression stream is not supported");
+#endif
+    }
+
+    if (buffer.Data == nullptr || buffer.Length == 0 || trailerProcessed) {
+        return 0;
+    }
+
+    if (!headerProcessed) {
+        ReadHeader();
+    }
+
+    const size_t produced = decoder->Decode(buffer.Data, buffer.Length);
+    UpdateChecksum(buffer.Data, produced);
+    if (decoder->IsFinished()) {
+        VerifyTrailer();
+    }
+
+    return produced;
+}
+
+void DeflateStream::Write(ReadOnlySpan<uint8_t> buffer) {
+    ThrowIfClosed();
+    if (mode != CompressionMode::Compress) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+        throw InvalidOperationException();
+#else
+        throw InvalidOperationException("Writing to a decompression stream is not supported");
+#endif
+    }
+
+    size_t count = buffer.Length;
+    if (buffer.Data == nullptr || count == 0) {
+        return;
+    }
+
+    if (!headerProcessed) {
+        WriteHeader();
+    }
+
+    const uint8_t* source = buffer.Data;
+    UpdateChecksum(source, count);
+    const size_t batchSize = DeflateEncoder::ChunkSize * static_cast<size_t>(maxDegreeOfParallelism);
+    while (count > 0) {
+        const size_t chunk = std::min(count, batchSize - pending.size());
+        pending.insert(pending.end(), source, source + chunk);
+        source += chunk;
+        count -= chunk;
+        if (pending.size() == batchSize) {
+            CompressPending();
+        }
+    }
+}
+
+size_t DeflateStream::Seek(int64_t, SeekOrigin) {
+    ThrowDeflateStreamNotSupported();
+    return 0;
+}
+
+void DeflateStream::SetLength(size_t) {
+    ThrowDeflateStreamNotSupported();
+}
+
+bool DeflateStream::CanRead() const {
+    return !closed && mode == CompressionMode::Decompress;
+}
+
+bool DeflateStream::CanWrite() const {
+    return !closed && mode == CompressionMode::Compress;
+}
+
+bool DeflateStream::CanSeek() const {
+    return false;
+}
+
+size_t DeflateStream::Length() const {
+    ThrowDeflateStreamNotSupported();
+    return 0;
+}
+
+size_t DeflateStream::Position() const {
+    ThrowDeflateStreamNotSupported();
+    return 0;
+}
+
+void DeflateStream::SetPosition(size_t) {
+    ThrowDeflateStreamNotSupported();
+}
+
+void DeflateStream::InternalReserve(size_t) {
+}
+
+void DeflateStream::InternalWriteByte(uint8_t byte) {
+    Write(&byte, 0, 1);
+}
+
+int DeflateStream::InternalReadByte() {
+    uint8_t byte;
+    return Read(&byte, 0, 1) > 0 ? byte : -1;
+}
+
+void DeflateStream::Flush() {
+    ThrowIfClosed();
+    if (mode == CompressionMode::Compress) {
+        CompressPending();
+        baseStream->Flush();
+    }
+}
+
+void DeflateStream::Close() {
+    if (closed) {
+        return;
+    }
+
+    closed = true;
+    if (mode == CompressionMode::Compress) {
+        if (!headerProcessed) {
+            WriteHeader();
+        }
+
+        CompressPending();
+        std::vector<uint8_t> finalBlock;
+        DeflateEncoder::AppendFinalBlock(finalBlock);
+        baseStream->Write(finalBlock.data(), 0, finalBlock.size());
+        WriteTrailer();
+        baseStream->Flush();
+    }
+
+    decoder.reset();
+    if (!leaveOpen) {
+        baseStream->Close();
+    }
+}
+
+void DeflateStream::Dispose() {
+    Close();
+}
+
+void DeflateStream::CompressPending() {
+    if (pending.empty()) {
+        return;
+    }
+
+    const size_t chunkCount = (pending.size() + DeflateEncoder::ChunkSize - 1) / DeflateEncoder::ChunkSize;
+    std::vector<std::vector<uint8_t>> outputs(chunkCount);
+    const uint8_t* input = pending.data();
+    const size_t inputLength = pending.size();
+    const CompressionLevel level = compressionLevel;
+    CompressionJobs::Run(chunkCount, maxDegreeOfParallelism, [input, inputLength, level, &outputs](size_t chunkIndex) {
+        const size_t chunkOffset = chunkIndex * DeflateEncoder::ChunkSize;
+        const size_t chunkLength = std::min(DeflateEncoder::ChunkSize, inputLength - chunkOffset);
+        DeflateEncoder::CompressChunk(input + chunkOffset, chunkLength, level, outputs[chunkIndex]);
+    });
+
+    for (const std::vector<uint8_t>& output : outputs) {
+        baseStream->Write(output.data(), 0, output.size());
+    }
+
+    pending.clear();
+}
+
+void DeflateStream::WriteHeader() {
+    headerProcessed = true;
+    if (format == DeflateStreamFormat::ZLib) {
+        const uint8_t header[2] = { 0x78, 0x9C };
+        baseStream->Write(header, 0, 2);
+    } else if (format == DeflateStreamFormat::GZip) {
+        const uint8_t header[10] = { 0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF };
+        baseStream->Write(header, 0, 10);
+    }
+}
+
+void DeflateStream::WriteTrailer() {
+    if (format == DeflateStreamFormat::ZLib) {
+        const uint8_t trailer[4] = {
+            static_cast<uint8_t>(checksum >> 24), static_cast<uint8_t>(checksum >> 16),
+            static_cast<uint8_t>(checksum >> 8), static_cast<uint8_t>(checksum)
+        };
+        baseStream->Write(trailer, 0, 4);
+    } else if (format == DeflateStreamFormat::GZip) {
+        const uint8_t trailer[8] = {
+            static_cast<uint8_t>(checksum), static_cast<uint8_t>(checksum >> 8),
+            static_cast<uint8_t>(checksum >> 16), static_cast<uint8_t>(checksum >> 24),
+            static_cast<uint8_t>(totalLength), static_cast<uint8_t>(totalLength >> 8),
+            static_cast<uint8_t>(totalLength >> 16), static_cast<uint8_t>(totalLength >> 24)
+        };
+        baseStream->Write(trailer, 0, 8);
+    }
+}
+
+void DeflateStream::ReadHeader() {
+    headerProcessed = true;
+    if (format == DeflateStreamFormat::ZLib) {
+        const int cmf = decoder->ReadAlignedByte();
+        const int flags = decoder->ReadAlignedByte();
+        if (cmf < 0 || flags < 0 || (cmf & 0x0F) != 8 || ((cmf << 8) | flags) % 31 != 0 || (flags & 0x20) != 0) {
+            ThrowDeflateStreamInvalidData();
+        }
+    } else if (format == DeflateStreamFormat::GZip) {
+        int header[10];
+        for (int& value : header) {
+            value = decoder->ReadAlignedByte();
+            if (value < 0) {
+                ThrowDeflateStreamInvalidData();
+            }
+        }
+
+        if (header[0] != 0x1F || header[1] != 0x8B || header[2] != 8) {
+            ThrowDeflateStreamInvalidData();
+        }
+
+        const int flags = header[3];
+        if ((flags & 0x04) != 0) {
+            const int low = decoder->ReadAlignedByte();
+            const int high = decoder->ReadAlignedByte();
+            if (low < 0 || high < 0) {
+                ThrowDeflateStreamInvalidData();
+            }
+
+            for (int remaining = low | (high << 8); remaining > 0; --remaining) {
+                if (decoder->ReadAlignedByte() < 0) {
+                    ThrowDeflateStreamInvalidData();
+                }
+            }
+        }
+
+        for (int stringFlag = 0x08; stringFlag <= 0x10; stringFlag <<= 1) {
+            if ((flags & stringFlag) == 0) {
+                continue;
+            }
+
+            for (int value = decoder->ReadAlignedByte(); value != 0; value = decoder->ReadAlignedByte()) {
+                if (value < 0) {
+                    ThrowDeflateStreamInvalidData();
+                }
+            }
+        }
+
+        if ((flags & 0x02) != 0) {
+            decoder->ReadAlignedByte();
+            decoder->ReadAlignedByte();
+        }
+    }
+}
+
+uint32_t DeflateStream::ReadTrailerUInt32(bool bigEndian) {
+    uint32_t value = 0;
+    for (int byteIndex = 0; byteIndex < 4; ++byteIndex) {
+        const int byte = decoder->ReadAlignedByte();
+        if (byte < 0) {
+            ThrowDeflateStreamInvalidData();
+        }
+
+        value = bigEndian
+            ? (value << 8) | static_cast<uint32_t>(byte)
+            : value | (static_cast<uint32_t>(byte) << (8 * byteIndex));
+    }
+
+    return value;
+}
+
+void DeflateStream::VerifyTrailer() {
+    trailerProcessed = true;
+    if (format == DeflateStreamFormat::ZLib) {
+        if (ReadTrailerUInt32(true) != checksum) {
+            ThrowDeflateStreamInvalidData();
+        }
+    } else if (format == DeflateStreamFormat::GZip) {
+        const uint32_t expectedCrc = ReadTrailerUInt32(false);
+        const uint32_t expectedLength = ReadTrailerUInt32(false);
+        if (expectedCrc != checksum || expectedLength != totalLength) {
+            ThrowDeflateStreamInvalidData();
+        }
+    }
+}
+
+void DeflateStream::UpdateChecksum(const uint8_t* data, size_t length) {
+    if (format == DeflateStreamFormat::ZLib) {
+        checksum = DeflateChecksums::Adler32(checksum, data, length);
+    } else if (format == DeflateStreamFormat::GZip) {
+        checksum = DeflateChecksums::Crc32(checksum, data, length);
+        totalLength += static_cast<uint32_t>(length);
+    }
+}
+
+void DeflateStream::ThrowIfClosed() const {
+    if (closed) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+        throw InvalidOperationException();
+#else
+        throw InvalidOperationException("Cannot access a closed compression stream");
+#endif
+    }
+}
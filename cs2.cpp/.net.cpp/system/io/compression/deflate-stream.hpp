@@ -0,0 +1,93 @@
+#ifndef HE_CPP_SYSTEM_IO_COMPRESSION_DEFLATE_STREAM_HPP
+#define HE_CPP_SYSTEM_IO_COMPRESSION_DEFLATE_STREAM_HPP
+
+#include "compression-level.hpp"
+#include "compression-mode.hpp"
+#include "deflate-codec.hpp"
+#include "../stream.hpp"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/// <summary>
+/// Stream that compresses or decompresses raw Deflate data over an underlying stream. Compression buffers input into
+/// independent 128 KB chunks, so memory stays bounded and chunks can be compressed on several threads when
+/// <see cref="set_MaxDegreeOfParallelism"/> is raised. Decompression is pull-based and keeps only the 32 KB window.
+/// </summary>
+class DeflateStream : public Stream {
+public:
+    DeflateStream(Stream* stream, CompressionMode mode, bool leaveOpen = false);
+    DeflateStream(Stream* stream, CompressionLevel compressionLevel, bool leaveOpen = false);
+    ~DeflateStream() override;
+
+    /// <summary>
+    /// Gets the stream that receives compressed output or supplies compressed input.
+    /// </summary>
+    Stream* get_BaseStream() const;
+
+    /// <summary>
+    /// Gets or sets how many chunks may be compressed concurrently. The default of one compresses on the writer.
+    /// </summary>
+    int32_t get_MaxDegreeOfParallelism() const;
+    void set_MaxDegreeOfParallelism(int32_t value);
+
+    using Stream::Read;
+    using Stream::Write;
+    size_t Read(Span<uint8_t> buffer) override;
+    void Write(ReadOnlySpan<uint8_t> buffer) override;
+    size_t Seek(int64_t offset, SeekOrigin origin) override;
+    void SetLength(size_t length) override;
+
+    bool CanRead() const override;
+    bool CanWrite() const override;
+    bool CanSeek() const override;
+    size_t Length() const override;
+    size_t Position() const override;
+    void SetPosition(size_t value) override;
+
+    void InternalReserve(size_t count) override;
+    void InternalWriteByte(uint8_t byte) override;
+    int InternalReadByte() override;
+
+    void Flush() override;
+    void Close() override;
+    void Dispose() override;
+
+protected:
+    /// <summary>
+    /// Container wrapped around the raw Deflate data.
+    /// </summary>
+    enum class DeflateStreamFormat : uint8_t {
+        Raw,
+        ZLib,
+        GZip
+    };
+
+    DeflateStream(Stream* stream, CompressionMode mode, CompressionLevel compressionLevel, bool leaveOpen, DeflateStreamFormat format);
+
+private:
+    void CompressPending();
+    void WriteHeader();
+    void WriteTrailer();
+    void ReadHeader();
+    void VerifyTrailer();
+    uint32_t ReadTrailerUInt32(bool bigEndian);
+    void UpdateChecksum(const uint8_t* data, size_t length);
+    void ThrowIfClosed() const;
+
+    Stream* baseStream;
+    CompressionMode mode;
+    CompressionLevel compressionLevel;
+    DeflateStreamFormat format;
+    bool leaveOpen;
+    bool closed;
+    bool headerProcessed;
+    bool trailerProcessed;
+    int32_t maxDegreeOfParallelism;
+    uint32_t checksum;
+    uint32_t totalLength;
+    std::vector<uint8_t> pending;
+    std::unique_ptr<DeflateDecoder> decoder;
+};
+
+#endif // HE_CPP_SYSTEM_IO_COMPRESSION_DEFLATE_STREAM_HPP
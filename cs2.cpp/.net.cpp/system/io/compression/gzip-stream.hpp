@@ -0,0 +1,20 @@
+#ifndef HE_CPP_SYSTEM_IO_COMPRESSION_GZIP_STREAM_HPP
+#define HE_CPP_SYSTEM_IO_COMPRESSION_GZIP_STREAM_HPP
+
+#include "deflate-stream.hpp"
+
+/// <summary>
+/// Deflate stream wrapped in a gzip (RFC 1952) member with a CRC-32 and length trailer.
+/// </summary>
+class GZipStream : public DeflateStream {
+public:
+    GZipStream(Stream* stream, CompressionMode mode, bool leaveOpen = false)
+        : DeflateStream(stream, mode, CompressionLevel::Optimal, leaveOpen, DeflateStreamFormat::GZip) {
+    }
+
+    GZipStream(Stream* stream, CompressionLevel compressionLevel, bool leaveOpen = false)
+        : DeflateStream(stream, CompressionMode::Compress, compressionLevel, leaveOpen, DeflateStreamFormat::GZip) {
+    }
+};
+
+#endif // HE_CPP_SYSTEM_IO_COMPRESSION_GZIP_STREAM_HPP
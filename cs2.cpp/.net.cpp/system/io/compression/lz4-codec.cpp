@@ -0,0 +1,250 @@
+#include "lz4-codec.hpp"
+#include "helcpp_config.hpp"
+#include "../../../runtime/native_exceptions.hpp"
+#include <cstring>
+
+namespace {
+    const int Lz4HashLog = 12;
+    const size_t Lz4MinMatch = 4;
+    const size_t Lz4LastLiterals = 5;
+    const size_t Lz4MatchFindLimit = 12;
+    const size_t Lz4MaxOffset = 65535;
+
+    void ThrowInvalidLz4Data() {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+        throw InvalidOperationException();
+#else
+        throw InvalidOperationException("The LZ4 block contains invalid data.");
+#endif
+    }
+
+    uint32_t ReadLz4UInt32(const uint8_t* data) {
+        uint32_t value;
+        std::memcpy(&value, data, sizeof(value));
+        return value;
+    }
+
+    uint32_t ReadLz4UInt32LittleEndian(const uint8_t* data) {
+        return static_cast<uint32_t>(data[0]) |
+            (static_cast<uint32_t>(data[1]) << 8) |
+            (static_cast<uint32_t>(data[2]) << 16) |
+            (static_cast<uint32_t>(data[3]) << 24);
+    }
+
+    uint32_t HashLz4Sequence(uint32_t sequence) {
+        return (sequence * 2654435761u) >> (32 - Lz4HashLog);
+    }
+
+    size_t Lz4LengthBytes(size_t length) {
+        return length >= 15 ? (length - 15) / 255 + 1 : 0;
+    }
+
+    uint8_t* WriteLz4Length(uint8_t* output, size_t length) {
+        for (length -= 15; length >= 255; length -= 255) {
+            *output++ = 255;
+        }
+
+        *output++ = static_cast<uint8_t>(length);
+        return output;
+    }
+
+    // Writes one sequence and returns the new output cursor, or null when it would overflow the destination.
+    uint8_t* WriteLz4Sequence(uint8_t* output, const uint8_t* outputEnd, const uint8_t* literals, size_t literalLength, size_t offset, size_t matchLength) {
+        const size_t required = 1 + Lz4LengthBytes(literalLength) + literalLength +
+            (matchLength != 0 ? 2 + Lz4LengthBytes(matchLength - Lz4MinMatch) : 0);
+        if (static_cast<size_t>(outputEnd - output) < required) {
+            return nullptr;
+        }
+
+        uint8_t* token = output++;
+        *token = static_cast<uint8_t>((literalLength >= 15 ? 15 : literalLength) << 4);
+        if (literalLength >= 15) {
+            output = WriteLz4Length(output, literalLength);
+        }
+
+        std::memcpy(output, literals, literalLength);
+        output += literalLength;
+        if (matchLength == 0) {
+            return output;
+        }
+
+        *output++ = static_cast<uint8_t>(offset);
+        *output++ = static_cast<uint8_t>(offset >> 8);
+        const size_t matchCode = matchLength - Lz4MinMatch;
+        *token |= static_cast<uint8_t>(matchCode >= 15 ? 15 : matchCode);
+        if (matchCode >= 15) {
+            output = WriteLz4Length(output, matchCode);
+        }
+
+        return output;
+    }
+
+    size_t ReadLz4Length(const uint8_t*& input, const uint8_t* inputEnd) {
+        size_t length = 0;
+        uint8_t value = 255;
+        while (value == 255) {
+            if (input >= inputEnd) {
+                ThrowInvalidLz4Data();
+            }
+
+            value = *input++;
+            length += value;
+        }
+
+        return length;
+    }
+}
+
+size_t Lz4Codec::CompressBlock(const uint8_t* source, size_t length, uint8_t* destination, size_t capacity, int acceleration) {
+    uint8_t* output = destination;
+    const uint8_t* outputEnd = destination + capacity;
+    size_t anchor = 0;
+    if (length > Lz4MatchFindLimit) {
+        uint32_t table[1 << Lz4HashLog] = {};
+        const size_t matchFindLimit = length - Lz4MatchFindLimit;
+        const size_t matchLimit = length - Lz4LastLiterals;
+        const int stepShift = 6;
+        size_t position = 1;
+        size_t searchAttempts = static_cast<size_t>(acceleration > 1 ? acceleration : 1) << stepShift;
+        table[HashLz4Sequence(ReadLz4UInt32(source))] = 0;
+        while (position < matchFindLimit) {
+            const uint32_t sequence = ReadLz4UInt32(source + position);
+            const uint32_t hash = HashLz4Sequence(sequence);
+            size_t candidate = table[hash];
+            table[hash] = static_cast<uint32_t>(position);
+            if (candidate >= position || position - candidate > Lz4MaxOffset || ReadLz4UInt32(source + candidate) != sequence) {
+                position += searchAttempts++ >> stepShift;
+                continue;
+            }
+
+            searchAttempts = static_cast<size_t>(acceleration > 1 ? acceleration : 1) << stepShift;
+            while (position > anchor && candidate > 0 && source[position - 1] == source[candidate - 1]) {
+                --position;
+                --candidate;
+            }
+
+            size_t matchLength = Lz4MinMatch;
+            while (position + matchLength < matchLimit && source[candidate + matchLength] == source[position + matchLength]) {
+                ++matchLength;
+            }
+
+            output = WriteLz4Sequence(output, outputEnd, source + anchor, position - anchor, position - candidate, matchLength);
+            if (output == nullptr) {
+                return 0;
+            }
+
+            position += matchLength;
+            anchor = position;
+            if (position - 2 < matchFindLimit) {
+                table[HashLz4Sequence(ReadLz4UInt32(source + position - 2))] = static_cast<uint32_t>(position - 2);
+            }
+        }
+    }
+
+    output = WriteLz4Sequence(output, outputEnd, source + anchor, length - anchor, 0, 0);
+    return output != nullptr ? static_cast<size_t>(output - destination) : 0;
+}
+
+size_t Lz4Codec::DecompressBlock(const uint8_t* source, size_t length, uint8_t* destination, size_t capacity, size_t prefixLength) {
+    const uint8_t* input = source;
+    const uint8_t* inputEnd = source + length;
+    size_t produced = 0;
+    while (input < inputEnd) {
+        const uint8_t token = *input++;
+        size_t literalLength = token >> 4;
+        if (literalLength == 15) {
+            literalLength += ReadLz4Length(input, inputEnd);
+        }
+
+        if (static_cast<size_t>(inputEnd - input) < literalLength || capacity - produced < literalLength) {
+            ThrowInvalidLz4Data();
+        }
+
+        std::memcpy(destination + produced, input, literalLength);
+        input += literalLength;
+        produced += literalLength;
+        if (input == inputEnd) {
+            break;
+        }
+
+        if (inputEnd - input < 2) {
+            ThrowInvalidLz4Data();
+        }
+
+        const size_t offset = static_cast<size_t>(input[0]) | (static_cast<size_t>(input[1]) << 8);
+        input += 2;
+        size_t matchLength = token & 15u;
+        if (matchLength == 15) {
+            matchLength += ReadLz4Length(input, inputEnd);
+        }
+
+        matchLength += Lz4MinMatch;
+        if (offset == 0 || offset > produced + prefixLength || capacity - produced < matchLength) {
+            ThrowInvalidLz4Data();
+        }
+
+        uint8_t* target = destination + produced;
+        const uint8_t* match = target - offset;
+        if (offset >= matchLength) {
+            std::memcpy(target, match, matchLength);
+        } else {
+            for (size_t index = 0; index < matchLength; ++index) {
+                target[index] = match[index];
+            }
+        }
+
+        produced += matchLength;
+    }
+
+    return produced;
+}
+
+uint32_t Lz4Codec::Xxh32(const uint8_t* data, size_t length, uint32_t seed) {
+    const uint32_t prime1 = 2654435761u;
+    const uint32_t prime2 = 2246822519u;
+    const uint32_t prime3 = 3266489917u;
+    const uint32_t prime4 = 668265263u;
+    const uint32_t prime5 = 374761393u;
+    auto rotate = [](uint32_t value, int count) {
+        return (value << count) | (value >> (32 - count));
+    };
+    auto round = [&rotate, prime1, prime2](uint32_t accumulator, uint32_t lane) {
+        return rotate(accumulator + lane * prime2, 13) * prime1;
+    };
+
+    const uint8_t* cursor = data;
+    const uint8_t* end = data + length;
+    uint32_t hash;
+    if (length >= 16) {
+        uint32_t lane1 = seed + prime1 + prime2;
+        uint32_t lane2 = seed + prime2;
+        uint32_t lane3 = seed;
+        uint32_t lane4 = seed - prime1;
+        for (; end - cursor >= 16; cursor += 16) {
+            lane1 = round(lane1, ReadLz4UInt32LittleEndian(cursor));
+            lane2 = round(lane2, ReadLz4UInt32LittleEndian(cursor + 4));
+            lane3 = round(lane3, ReadLz4UInt32LittleEndian(cursor + 8));
+            lane4 = round(lane4, ReadLz4UInt32LittleEndian(cursor + 12));
+        }
+
+        hash = rotate(lane1, 1) + rotate(lane2, 7) + rotate(lane3, 12) + rotate(lane4, 18);
+    } else {
+        hash = seed + prime5;
+    }
+
+    hash += static_cast<uint32_t>(length);
+    for (; end - cursor >= 4; cursor += 4) {
+        hash = rotate(hash + ReadLz4UInt32LittleEndian(cursor) * prime3, 17) * prime4;
+    }
+
+    for (; cursor < end; ++cursor) {
+        hash = rotate(hash + *cursor * prime5, 11) * prime1;
+    }
+
+    hash ^= hash >> 15;
+    hash *= prime2;
+    hash ^= hash >> 13;
+    hash *= prime3;
+    hash ^= hash >> 16;
+    return hash;
+}
@@ -0,0 +1,40 @@
+#ifndef HE_CPP_SYSTEM_IO_COMPRESSION_LZ4_CODEC_HPP
+#define HE_CPP_SYSTEM_IO_COMPRESSION_LZ4_CODEC_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+/// <summary>
+/// LZ4 block format codec. Blocks are compressed independently with a 4096-entry hash table, so any number of blocks
+/// can be compressed concurrently without shared state.
+/// </summary>
+class Lz4Codec {
+public:
+    /// <summary>
+    /// Gets the worst-case compressed size for an input of <paramref name="length"/> bytes.
+    /// </summary>
+    static size_t CompressBound(size_t length) {
+        return length + length / 255 + 16;
+    }
+
+    /// <summary>
+    /// Compresses one block and returns the compressed size, or zero when the output does not fit in
+    /// <paramref name="capacity"/> bytes.
+    /// </summary>
+    /// <param name="acceleration">Match-search skip factor; larger values trade ratio for speed.</param>
+    static size_t CompressBlock(const uint8_t* source, size_t length, uint8_t* destination, size_t capacity, int acceleration = 1);
+
+    /// <summary>
+    /// Decompresses one block into <paramref name="destination"/> and returns the decoded size. Matches may reference
+    /// up to <paramref name="prefixLength"/> bytes already decoded immediately before <paramref name="destination"/>.
+    /// Malformed input throws <c>InvalidOperationException</c>.
+    /// </summary>
+    static size_t DecompressBlock(const uint8_t* source, size_t length, uint8_t* destination, size_t capacity, size_t prefixLength);
+
+    /// <summary>
+    /// Computes the 32-bit xxHash used for LZ4 frame descriptors and checksums.
+    /// </summary>
+    static uint32_t Xxh32(const uint8_t* data, size_t length, uint32_t seed);
+};
+
+#endif // HE_CPP_SYSTEM_IO_COMPRESSION_LZ4_CODEC_HPP
@@ -0,0 +1,385 @@
+#include "lz4-stream.hpp"
+#include "compression-jobs.hpp"
+#include "lz4-codec.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace {
+    const uint8_t Lz4FrameMagic[4] = { 0x04, 0x22, 0x4D, 0x18 };
+    const uint32_t Lz4UncompressedBlockFlag = 0x80000000u;
+
+    void ThrowLz4StreamNotSupported() {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+        throw NotSupportedException();
+#else
+        throw NotSupportedException("Compression streams do not support seeking");
+#endif
+    }
+
+    void ThrowInvalidLz4Frame() {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+        throw InvalidOperationException();
+#else
+        throw InvalidOperationException("The LZ4 frame contains invalid data.");
+#endif
+    }
+
+    uint32_t ReadLz4FrameUInt32(const uint8_t* data) {
+        return static_cast<uint32_t>(data[0]) |
+            (static_cast<uint32_t>(data[1]) << 8) |
+            (static_cast<uint32_t>(data[2]) << 16) |
+            (static_cast<uint32_t>(data[3]) << 24);
+    }
+}
+
+Lz4Stream::Lz4Stream(Stream* stream, CompressionMode mode, bool leaveOpen)
+    : baseStream(stream),
+      mode(mode),
+      compressionLevel(CompressionLevel::Optimal),
+      leaveOpen(leaveOpen),
+      closed(false),
+      headerProcessed(false),
+      endOfFrame(false),
+      linkedBlocks(false),
+      blockChecksums(false),
+      contentChecksum(false),
+      maxDegreeOfParallelism(1),
+      maxBlockSize(BlockSize),
+      decodedPosition(0),
+      decodedEnd(0) {
+    if (stream == nullptr) {
+        throw ArgumentNullException("stream");
+    }
+}
+
+Lz4Stream::Lz4Stream(Stream* stream, CompressionLevel compressionLevel, bool leaveOpen)
+    : Lz4Stream(stream, CompressionMode::Compress, leaveOpen) {
+    this->compressionLevel = compressionLevel;
+}
+
+Lz4Stream::~Lz4Stream() {
+    Close();
+}
+
+Stream* Lz4Stream::get_BaseStream() const {
+    return baseStream;
+}
+
+int32_t Lz4Stream::get_MaxDegreeOfParallelism() const {
+    return maxDegreeOfParallelism;
+}
+
+void Lz4Stream::set_MaxDegreeOfParallelism(int32_t value) {
+    if (value < 1) {
+        throw ArgumentOutOfRangeException("value");
+    }
+
+    maxDegreeOfParallelism = value;
+}
+
+size_t Lz4Stream::Read(Span<uint8_t> buffer) {
+    ThrowIfClosed();
+    if (mode != CompressionMode::Decompress) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+        throw InvalidOperationException();
+#else
+        throw InvalidOperationException("Reading from a compression stream is not supported");
+#endif
+    }
+
+    if (buffer.Data == nullptr) {
+        return 0;
+    }
+
+    if (!headerProcessed) {
+        ReadFrameHeader();
+    }
+
+    const size_t count = buffer.Length;
+    size_t totalBytesRead = 0;
+    while (totalBytesRead < count) {
+        if (decodedPosition == decodedEnd && !ReadNextBlock()) {
+            break;
+        }
+
+        const size_t chunk = std::min(count - totalBytesRead, decodedEnd - decodedPosition);
+        std::memcpy(buffer.Data + totalBytesRead, decoded.data() + decodedPosition, chunk);
+        decodedPosition += chunk;
+        totalBytesRead += chunk;
+    }
+
+    return totalBytesRead;
+}
+
+void Lz4Stream::Write(ReadOnlySpan<uint8_t> buffer) {
+    ThrowIfClosed();
+    if (mode != CompressionMode::Compress) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+        throw InvalidOperationException();
+#else
+        throw InvalidOperationException("Writing to a decompression stream is not supported");
+#endif
+    }
+
+    size_t count = buffer.Length;
+    if (buffer.Data == nullptr || count == 0) {
+        return;
+    }
+
+    if (!headerProcessed) {
+        WriteFrameHeader();
+    }
+
+    const uint8_t* source = buffer.Data;
+    const size_t batchSize = BlockSize * static_cast<size_t>(maxDegreeOfParallelism);
+    while (count > 0) {
+        const size_t chunk = std::min(count, batchSize - pending.size());
+        pending.insert(pending.end(), source, source + chunk);
+        source += chunk;
+        count -= chunk;
+        if (pending.size() == batchSize) {
+            CompressPending();
+        }
+    }
+}
+
+size_t Lz4Stream::Seek(int64_t, SeekOrigin) {
+    ThrowLz4StreamNotSupported();
+    return 0;
+}
+
+void Lz4Stream::SetLength(size_t) {
+    ThrowLz4StreamNotSupported();
+}
+
+bool Lz4Stream::CanRead() const {
+    return !closed && mode == CompressionMode::Decompress;
+}
+
+bool Lz4Stream::CanWrite() const {
+    return !closed && mode == CompressionMode::Compress;
+}
+
+bool Lz4Stream::CanSeek() const {
+    return false;
+}
+
+size_t Lz4Stream::Length() const {
+    ThrowLz4StreamNotSupported();
+    return 0;
+}
+
+size_t Lz4Stream::Position() const {
+    ThrowLz4StreamNotSupported();
+    return 0;
+}
+
+void Lz4Stream::SetPosition(size_t) {
+    ThrowLz4StreamNotSupported();
+}
+
+void Lz4Stream::InternalReserve(size_t) {
+}
+
+void Lz4Stream::InternalWriteByte(uint8_t byte) {
+    Write(&byte, 0, 1);
+}
+
+int Lz4Stream::InternalReadByte() {
+    uint8_t byte;
+    return Read(&byte, 0, 1) > 0 ? byte : -1;
+}
+
+void Lz4Stream::Flush() {
+    ThrowIfClosed();
+    if (mode == CompressionMode::Compress) {
+        CompressPending();
+        baseStream->Flush();
+    }
+}
+
+void Lz4Stream::Close() {
+    if (closed) {
+        return;
+    }
+
+    closed = true;
+    if (mode == CompressionMode::Compress) {
+        if (!headerProcessed) {
+            WriteFrameHeader();
+        }
+
+        CompressPending();
+        const uint8_t endMark[4] = { 0, 0, 0, 0 };
+        baseStream->Write(endMark, 0, 4);
+        baseStream->Flush();
+    }
+
+    if (!leaveOpen) {
+        baseStream->Close();
+    }
+}
+
+void Lz4Stream::Dispose() {
+    Close();
+}
+
+void Lz4Stream::CompressPending() {
+    if (pending.empty()) {
+        return;
+    }
+
+    const size_t blockCount = (pending.size() + BlockSize - 1) / BlockSize;
+    std::vector<std::vector<uint8_t>> outputs(blockCount);
+    const uint8_t* input = pending.data();
+    const size_t inputLength = pending.size();
+    const CompressionLevel level = compressionLevel;
+    CompressionJobs::Run(blockCount, maxDegreeOfParallelism, [input, inputLength, level, &outputs](size_t blockIndex) {
+        const uint8_t* block = input + blockIndex * BlockSize;
+        const size_t blockLength = std::min(BlockSize, inputLength - blockIndex * BlockSize);
+        std::vector<uint8_t>& output = outputs[blockIndex];
+        output.resize(4 + blockLength);
+        size_t compressedLength = 0;
+        if (level != CompressionLevel::NoCompression) {
+            const int acceleration = level == CompressionLevel::Fastest ? 8 : 1;
+            compressedLength = Lz4Codec::CompressBlock(block, blockLength, output.data() + 4, blockLength - 1, acceleration);
+        }
+
+        uint32_t header = static_cast<uint32_t>(compressedLength);
+        if (compressedLength == 0) {
+            std::memcpy(output.data() + 4, block, blockLength);
+            compressedLength = blockLength;
+            header = static_cast<uint32_t>(blockLength) | Lz4UncompressedBlockFlag;
+        }
+
+        output.resize(4 + compressedLength);
+        output[0] = static_cast<uint8_t>(header);
+        output[1] = static_cast<uint8_t>(header >> 8);
+        output[2] = static_cast<uint8_t>(header >> 16);
+        output[3] = static_cast<uint8_t>(header >> 24);
+    });
+
+    for (const std::vector<uint8_t>& output : outputs) {
+        baseStream->Write(output.data(), 0, output.size());
+    }
+
+    pending.clear();
+}
+
+void Lz4Stream::WriteFrameHeader() {
+    headerProcessed = true;
+    // Version 01, independent blocks, no checksums or content size; 64 KB maximum block size.
+    std::vector<uint8_t> header(Lz4FrameMagic, Lz4FrameMagic + 4);
+    header.push_back(0x60);
+    header.push_back(0x40);
+    header.push_back(static_cast<uint8_t>(Lz4Codec::Xxh32(header.data() + 4, 2, 0) >> 8));
+    baseStream->Write(header.data(), 0, header.size());
+}
+
+void Lz4Stream::ReadFrameHeader() {
+    headerProcessed = true;
+    uint8_t header[15];
+    ReadExactly(header, 6);
+    if (std::memcmp(header, Lz4FrameMagic, 4) != 0) {
+        ThrowInvalidLz4Frame();
+    }
+
+    const uint8_t flags = header[4];
+    if ((flags >> 6) != 1 || (flags & 0x02) != 0 || (header[5] & 0x8F) != 0) {
+        ThrowInvalidLz4Frame();
+    }
+
+    linkedBlocks = (flags & 0x20) == 0;
+    blockChecksums = (flags & 0x10) != 0;
+    contentChecksum = (flags & 0x04) != 0;
+    const int blockSizeCode = (header[5] >> 4) & 0x07;
+    if (blockSizeCode < 4) {
+        ThrowInvalidLz4Frame();
+    }
+
+    maxBlockSize = static_cast<size_t>(1) << (8 + 2 * blockSizeCode);
+    size_t descriptorLength = 2;
+    descriptorLength += (flags & 0x08) != 0 ? 8 : 0;
+    descriptorLength += (flags & 0x01) != 0 ? 4 : 0;
+    ReadExactly(header + 6, descriptorLength - 2 + 1);
+    const uint8_t expected = static_cast<uint8_t>(Lz4Codec::Xxh32(header + 4, descriptorLength, 0) >> 8);
+    if (header[4 + descriptorLength] != expected) {
+        ThrowInvalidLz4Frame();
+    }
+
+    decoded.resize((linkedBlocks ? PrefixSize : 0) + maxBlockSize);
+    compressed.resize(maxBlockSize);
+}
+
+bool Lz4Stream::ReadNextBlock() {
+    if (endOfFrame) {
+        return false;
+    }
+
+    uint8_t sizeBytes[4];
+    ReadExactly(sizeBytes, 4);
+    const uint32_t header = ReadLz4FrameUInt32(sizeBytes);
+    if (header == 0) {
+        endOfFrame = true;
+        if (contentChecksum) {
+            ReadExactly(sizeBytes, 4);
+        }
+
+        return false;
+    }
+
+    const size_t blockLength = header & ~Lz4UncompressedBlockFlag;
+    if (blockLength > maxBlockSize) {
+        ThrowInvalidLz4Frame();
+    }
+
+    ReadExactly(compressed.data(), blockLength);
+    if (blockChecksums) {
+        ReadExactly(sizeBytes, 4);
+        if (ReadLz4FrameUInt32(sizeBytes) != Lz4Codec::Xxh32(compressed.data(), blockLength, 0)) {
+            ThrowInvalidLz4Frame();
+        }
+    }
+
+    // Linked blocks may reference the previous 64 KB of output, so keep it in front of the new block.
+    size_t prefixLength = 0;
+    if (linkedBlocks) {
+        prefixLength = std::min(PrefixSize, decodedEnd);
+        std::memmove(decoded.data(), decoded.data() + decodedEnd - prefixLength, prefixLength);
+    }
+
+    uint8_t* target = decoded.data() + prefixLength;
+    size_t produced = 0;
+    if ((header & Lz4UncompressedBlockFlag) != 0) {
+        std::memcpy(target, compressed.data(), blockLength);
+        produced = blockLength;
+    } else {
+        produced = Lz4Codec::DecompressBlock(compressed.data(), blockLength, target, maxBlockSize, prefixLength);
+    }
+
+    decodedPosition = prefixLength;
+    decodedEnd = prefixLength + produced;
+    return true;
+}
+
+void Lz4Stream::ReadExactly(uint8_t* buffer, size_t count) {
+    size_t totalBytesRead = 0;
+    while (totalBytesRead < count) {
+        const size_t bytesRead = baseStream->Read(buffer, totalBytesRead, count - totalBytesRead);
+        if (bytesRead == 0) {
+            ThrowInvalidLz4Frame();
+        }
+
+        totalBytesRead += bytesRead;
+    }
+}
+
+void Lz4Stream::ThrowIfClosed() const {
+    if (closed) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+        throw InvalidOperationException();
+#else
+        throw InvalidOperationException("Cannot access a closed compression stream");
+#endif
+    }
+}
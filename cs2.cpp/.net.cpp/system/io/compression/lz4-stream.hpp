@@ -0,0 +1,89 @@
+#ifndef HE_CPP_SYSTEM_IO_COMPRESSION_LZ4_STREAM_HPP
+#define HE_CPP_SYSTEM_IO_COMPRESSION_LZ4_STREAM_HPP
+
+#include "compression-level.hpp"
+#include "compression-mode.hpp"
+#include "../stream.hpp"
+#include <cstdint>
+#include <vector>
+
+/// <summary>
+/// Stream that reads or writes the LZ4 frame format. Compression emits independent 64 KB blocks, so memory stays
+/// bounded and blocks can be compressed on several threads when <see cref="set_MaxDegreeOfParallelism"/> is raised.
+/// Decompression accepts frames from other encoders, including linked blocks, block checksums, content sizes, and
+/// dictionary IDs; block checksums are verified while the optional content checksum is skipped.
+/// </summary>
+class Lz4Stream : public Stream {
+public:
+    /// <summary>
+    /// Uncompressed size of each block written by the compressor.
+    /// </summary>
+    static constexpr size_t BlockSize = 64 * 1024;
+
+    Lz4Stream(Stream* stream, CompressionMode mode, bool leaveOpen = false);
+    Lz4Stream(Stream* stream, CompressionLevel compressionLevel, bool leaveOpen = false);
+    ~Lz4Stream() override;
+
+    /// <summary>
+    /// Gets the stream that receives compressed output or supplies compressed input.
+    /// </summary>
+    Stream* get_BaseStream() const;
+
+    /// <summary>
+    /// Gets or sets how many blocks may be compressed concurrently. The default of one compresses on the writer.
+    /// </summary>
+    int32_t get_MaxDegreeOfParallelism() const;
+    void set_MaxDegreeOfParallelism(int32_t value);
+
+    using Stream::Read;
+    using Stream::Write;
+    size_t Read(Span<uint8_t> buffer) override;
+    void Write(ReadOnlySpan<uint8_t> buffer) override;
+    size_t Seek(int64_t offset, SeekOrigin origin) override;
+    void SetLength(size_t length) override;
+
+    bool CanRead() const override;
+    bool CanWrite() const override;
+    bool CanSeek() const override;
+    size_t Length() const override;
+    size_t Position() const override;
+    void SetPosition(size_t value) override;
+
+    void InternalReserve(size_t count) override;
+    void InternalWriteByte(uint8_t byte) override;
+    int InternalReadByte() override;
+
+    void Flush() override;
+    void Close() override;
+    void Dispose() override;
+
+private:
+    static constexpr size_t PrefixSize = 64 * 1024;
+
+    void CompressPending();
+    void WriteFrameHeader();
+    void ReadFrameHeader();
+    bool ReadNextBlock();
+    void ReadExactly(uint8_t* buffer, size_t count);
+    void ThrowIfClosed() const;
+
+    Stream* baseStream;
+    CompressionMode mode;
+    CompressionLevel compressionLevel;
+    bool leaveOpen;
+    bool closed;
+    bool headerProcessed;
+    bool endOfFrame;
+    bool linkedBlocks;
+    bool blockChecksums;
+    bool contentChecksum;
+    int32_t maxDegreeOfParallelism;
+    size_t maxBlockSize;
+    std::vector<uint8_t> pending;
+    std::vector<uint8_t> compressed;
+    std::vector<uint8_t> decoded;
+    size_t decodedPosition;
+    size_t decodedEnd;
+};
+
+#endif // HE_CPP_SYSTEM_IO_COMPRESSION_LZ4_STREAM_HPP
@@ -0,0 +1,20 @@
+#ifndef HE_CPP_SYSTEM_IO_COMPRESSION_ZLIB_STREAM_HPP
+#define HE_CPP_SYSTEM_IO_COMPRESSION_ZLIB_STREAM_HPP
+
+#include "deflate-stream.hpp"
+
+/// <summary>
+/// Deflate stream wrapped in a zlib (RFC 1950) stream with an Adler-32 trailer.
+/// </summary>
+class ZLibStream : public DeflateStream {
+public:
+    ZLibStream(Stream* stream, CompressionMode mode, bool leaveOpen = false)
+        : DeflateStream(stream, mode, CompressionLevel::Optimal, leaveOpen, DeflateStreamFormat::ZLib) {
+    }
+
+    ZLibStream(Stream* stream, CompressionLevel compressionLevel, bool leaveOpen = false)
+        : DeflateStream(stream, CompressionMode::Compress, compressionLevel, leaveOpen, DeflateStreamFormat::ZLib) {
+    }
+};
+
+#endif // HE_CPP_SYSTEM_IO_COMPRESSION_ZLIB_STREAM_HPP
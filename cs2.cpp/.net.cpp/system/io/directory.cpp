@@ -2,9 +2,17 @@
 
 #include "path.hpp"
 
+#include "helcpp_config.hpp"
+
+#if HE_CPP_RUNTIME_HAS_CUSTOM_FILE_SYSTEM
+#include HE_CPP_RUNTIME_CUSTOM_FILE_SYSTEM_HEADER
+#endif
+
 #include <cerrno>
 #include <string>
 #include <sys/stat.h>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #if defined(_WIN32)
@@ -28,6 +36,17 @@ namespace {
 #endif
         return createResult == 0 || errno == EEXIST;
     }
+
+#if HE_CPP_RUNTIME_HAS_CUSTOM_FILE_SYSTEM
+    // Custom file systems predating directory lookups only expose file queries, so the hook is optional.
+    template<typename TFileSystem, typename = void>
+    struct CustomFileSystemHasDirectoryExists : std::false_type {
+    };
+
+    template<typename TFileSystem>
+    struct CustomFileSystemHasDirectoryExists<TFileSystem, std::void_t<decltype(TFileSystem::DirectoryExists(std::declval<const char*>()))>> : std::true_type {
+    };
+#endif
 }
 
 bool Directory::Exists(const std::string& path) {
@@ -35,6 +54,14 @@ bool Directory::Exists(const std::string& path) {
         return false;
     }
 
+#if HE_CPP_RUNTIME_HAS_CUSTOM_FILE_SYSTEM
+    if constexpr (CustomFileSystemHasDirectoryExists<HE_CPP_RUNTIME_CUSTOM_FILE_SYSTEM_TYPE>::value) {
+        if (HE_CPP_RUNTIME_CUSTOM_FILE_SYSTEM_TYPE::CanHandlePath(path.c_str())) {
+            return HE_CPP_RUNTIME_CUSTOM_FILE_SYSTEM_TYPE::DirectoryExists(path.c_str());
+        }
+    }
+#endif
+
     struct stat status;
     return stat(path.c_str(), &status) == 0 && (status.st_mode & S_IFDIR) != 0;
 }
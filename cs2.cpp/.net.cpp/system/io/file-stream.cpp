@@ -16,6 +16,62 @@
 #include <unistd.h>
 #endif
 
+// Linux copies file-to-file inside the kernel; copy_file_range needs glibc 2.27, sendfile is the fallback
+#if defined(__linux__) && !HE_CPP_RUNTIME_CUSTOM_RETRO
+#include <sys/sendfile.h>
+#define HE_CPP_FILE_STREAM_KERNEL_COPY 1
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 27))
+#define HE_CPP_FILE_STREAM_COPY_FILE_RANGE 1
+#endif
+#endif
+
+// Archive windows share one FILE handle, so they read at explicit offsets instead of moving the shared stdio cursor
+#if defined(__unix__) || defined(__APPLE__)
+#define HE_CPP_FILE_STREAM_POSITIONAL_READ 1
+#elif !(HE_CPP_PLATFORM_PS2 || HE_CPP_PLATFORM_N64 || HE_CPP_PLATFORM_DS || HE_CPP_RUNTIME_CUSTOM_RETRO)
+#define HE_CPP_FILE_STREAM_WINDOW_LOCK 1
+#include <mutex>
+#endif
+
+namespace {
+#if HE_CPP_FILE_STREAM_WINDOW_LOCK
+    std::mutex& FileStreamSharedWindowMutex() {
+        static std::mutex mutex;
+        return mutex;
+    }
+#endif
+
+    size_t FileStreamReadAt(std::FILE* file, size_t fileOffset, uint8_t* destination, size_t count) {
+#if HE_CPP_FILE_STREAM_POSITIONAL_READ
+        const int descriptor = fileno(file);
+        size_t totalBytesRead = 0;
+        while (totalBytesRead < count) {
+            const ssize_t bytesRead = pread(
+                descriptor,
+                destination + totalBytesRead,
+                count - totalBytesRead,
+                static_cast<off_t>(fileOffset + totalBytesRead));
+            if (bytesRead <= 0) {
+                break;
+            }
+
+            totalBytesRead += static_cast<size_t>(bytesRead);
+        }
+
+        return totalBytesRead;
+#else
+#if HE_CPP_FILE_STREAM_WINDOW_LOCK
+        std::lock_guard<std::mutex> guard(FileStreamSharedWindowMutex());
+#endif
+        if (std::fseek(file, static_cast<long>(fileOffset), SEEK_SET) != 0) {
+            return 0;
+        }
+
+        return std::fread(destination, 1, count, file);
+#endif
+    }
+}
+
 #if HE_CPP_PLATFORM_PS2
 namespace {
     bool FileStreamSupportStartsWithPs2CdromPrefix(const std::string& path) {
@@ -129,7 +185,7 @@ const char* GetFileMode(FileMode mode) {
 
 // Constructor
 FileStream::FileStream(const uint8_t* data, size_t dataLength)
-    : file(nullptr), memoryBuffer(), position(0), length(0), ownsMemoryBuffer(true), writable(false) {
+    : file(nullptr), sharedFile(), memoryBuffer(), windowOffset(0), position(0), length(0), ownsMemoryBuffer(true), writable(false) {
     if (data == nullptr && dataLength > 0) {
 #if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
         throw InvalidOperationException();
@@ -142,13 +198,32 @@ FileStream::FileStream(const uint8_t* data, size_t dataLength)
     length = memoryBuffer.size();
 }
 
+FileStream::FileStream(std::vector<uint8_t>&& data)
+    : file(nullptr), sharedFile(), memoryBuffer(std::move(data)), windowOffset(0), position(0), length(0), ownsMemoryBuffer(true), writable(false) {
+    length = memoryBuffer.size();
+}
+
+// Read-only window over [offset, offset + length) of a file shared with other streams, such as a pack archive
+FileStream::FileStream(std::shared_ptr<std::FILE> archiveFile, size_t offset, size_t windowLength)
+    : file(archiveFile.get()), sharedFile(std::move(archiveFile)), memoryBuffer(), windowOffset(offset), position(0), length(windowLength), ownsMemoryBuffer(false), writable(false) {
+    if (file == nullptr) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+        throw InvalidOperationException();
+#else
+        throw InvalidOperationException("Cannot create a file stream window over a null file.");
+#endif
+    }
+}
+
 FileStream::FileStream(const char* path, FileMode mode)
-    : file(nullptr), memoryBuffer(), position(0), length(0), ownsMemoryBuffer(false), writable(true) {
+    : file(nullptr), sharedFile(), memoryBuffer(), windowOffset(0), position(0), length(0), ownsMemoryBuffer(false), writable(true) {
 #if HE_CPP_RUNTIME_HAS_CUSTOM_FILE_SYSTEM
     if (path != nullptr && mode == FileMode::Open && HE_CPP_RUNTIME_CUSTOM_FILE_SYSTEM_TYPE::CanHandlePath(path)) {
         std::unique_ptr<FileStream> customStream(HE_CPP_RUNTIME_CUSTOM_FILE_SYSTEM_TYPE::OpenRead(path));
         file = customStream->file;
+        sharedFile.swap(customStream->sharedFile);
         memoryBuffer.swap(customStream->memoryBuffer);
+        windowOffset = customStream->windowOffset;
         position = customStream->position;
         length = customStream->length;
         ownsMemoryBuffer = customStream->ownsMemoryBuffer;
@@ -199,8 +274,10 @@ FileStream::~FileStream() {
 }
 
 // Reads data from file
-size_t FileStream::Read(uint8_t* buffer, size_t offset, size_t count) {
-    if (!CanRead() || !buffer) return 0;
+size_t FileStream::Read(Span<uint8_t> buffer) {
+    if (!CanRead() || !buffer.Data) return 0;
+
+    size_t count = buffer.Length;
 
     if (file == nullptr) {
         size_t available = position >= memoryBuffer.size() ? 0 : memoryBuffer.size() - position;
@@ -209,21 +286,34 @@ size_t FileStream::Read(uint8_t* buffer, size_t offset, size_t count) {
             return 0;
         }
 
-        std::memcpy(buffer + offset, memoryBuffer.data() + position, bytesRead);
+        std::memcpy(buffer.Data, memoryBuffer.data() + position, bytesRead);
         position += bytesRead;
         return bytesRead;
     }
 
+    if (sharedFile != nullptr) {
+        count = std::min(count, position >= length ? 0 : length - position);
+        if (count == 0) {
+            return 0;
+        }
+
+        const size_t windowBytesRead = FileStreamReadAt(file, windowOffset + position, buffer.Data, count);
+        position += windowBytesRead;
+        return windowBytesRead;
+    }
+
     std::fseek(file, position, SEEK_SET);
 
-    size_t bytesRead = std::fread(buffer + offset, 1, count, file);
+    size_t bytesRead = std::fread(buffer.Data, 1, count, file);
     position += bytesRead;
     return bytesRead;
 }
 
 // Writes data to file
-void FileStream::Write(const uint8_t* buffer, size_t offset, size_t count) {
-    if (!CanWrite() || !buffer) return;
+void FileStream::Write(ReadOnlySpan<uint8_t> buffer) {
+    if (!CanWrite() || !buffer.Data) return;
+
+    const size_t count = buffer.Length;
 
     if (file == nullptr) {
         size_t requiredLength = position + count;
@@ -231,7 +321,7 @@ void FileStream::Write(const uint8_t* buffer, size_t offset, size_t count) {
             memoryBuffer.resize(requiredLength);
         }
 
-        std::memcpy(memoryBuffer.data() + position, buffer + offset, count);
+        std::memcpy(memoryBuffer.data() + position, buffer.Data, count);
         position += count;
         length = memoryBuffer.size();
         return;
@@ -239,7 +329,7 @@ void FileStream::Write(const uint8_t* buffer, size_t offset, size_t count) {
 
     std::fseek(file, position, SEEK_SET);
 
-    size_t bytesWritten = std::fwrite(buffer + offset, 1, count, file);
+    size_t bytesWritten = std::fwrite(buffer.Data, 1, count, file);
     position += bytesWritten;
     UpdateLength();
 }
@@ -248,7 +338,7 @@ void FileStream::Write(const uint8_t* buffer, size_t offset, size_t count) {
 size_t FileStream::Seek(int64_t offset, SeekOrigin origin) {
     if (!CanSeek()) return position;
 
-    if (file == nullptr) {
+    if (file == nullptr || sharedFile != nullptr) {
         int64_t basePosition = 0;
         switch (origin) {
         case SeekOrigin::Begin: basePosition = 0; break;
@@ -281,6 +371,10 @@ size_t FileStream::Seek(int64_t offset, SeekOrigin origin) {
 
 // Truncates or extends the file
 void FileStream::SetLength(size_t newLength) {
+    if (sharedFile != nullptr) {
+        return;
+    }
+
     if (file == nullptr) {
         if (!writable) {
             return;
@@ -305,6 +399,10 @@ void FileStream::SetLength(size_t newLength) {
 
 // Updates the stored file length
 void FileStream::UpdateLength() {
+    if (sharedFile != nullptr) {
+        return;
+    }
+
     if (!file) {
         length = memoryBuffer.size();
         return;
@@ -318,7 +416,7 @@ void FileStream::UpdateLength() {
 
 // Properties
 bool FileStream::CanRead() const { return file != nullptr || ownsMemoryBuffer; }
-bool FileStream::CanWrite() const { return file != nullptr || (ownsMemoryBuffer && writable); }
+bool FileStream::CanWrite() const { return (file != nullptr && sharedFile == nullptr) || (ownsMemoryBuffer && writable); }
 bool FileStream::CanSeek() const { return file != nullptr || ownsMemoryBuffer; }
 
 size_t FileStream::Length() const { return length; }
@@ -344,7 +442,10 @@ void FileStream::Flush() {
 
 // Closes the file
 void FileStream::Close() {
-    if (file) {
+    if (sharedFile != nullptr) {
+        sharedFile.reset();
+        file = nullptr;
+    } else if (file) {
         std::fclose(file);
         file = nullptr;
     }
@@ -360,3 +461,89 @@ void FileStream::Close() {
 void FileStream::Dispose() {
     Close();
 }
+
+// Copies the remaining bytes without staging them in a user-space buffer where the source allows it
+void FileStream::CopyTo(Stream* destination, int32_t bufferSize) {
+    if (destination == nullptr || destination == this || !CanRead()) {
+        Stream::CopyTo(destination, bufferSize);
+        return;
+    }
+
+    if (file == nullptr) {
+        if (position >= memoryBuffer.size()) {
+            return;
+        }
+
+        const size_t start = position;
+        position = memoryBuffer.size();
+        destination->Write(memoryBuffer.data(), start, memoryBuffer.size() - start);
+        return;
+    }
+
+    FileStream* fileDestination = dynamic_cast<FileStream*>(destination);
+    if (fileDestination != nullptr && TryKernelCopyTo(fileDestination)) {
+        return;
+    }
+
+    Stream::CopyTo(destination, bufferSize);
+}
+
+// Returns true when every remaining byte was copied; a partial copy advances both positions so the caller can finish
+bool FileStream::TryKernelCopyTo(FileStream* destination) {
+#if HE_CPP_FILE_STREAM_KERNEL_COPY
+    if (destination->file == nullptr || !destination->CanWrite()) {
+        return false;
+    }
+
+    UpdateLength();
+    if (position >= length) {
+        return true;
+    }
+
+    std::fflush(file);
+    std::fflush(destination->file);
+    const int sourceDescriptor = fileno(file);
+    const int destinationDescriptor = fileno(destination->file);
+    int64_t sourceOffset = static_cast<int64_t>(windowOffset + position);
+    int64_t destinationOffset = static_cast<int64_t>(destination->position);
+    size_t remaining = length - position;
+    bool useCopyFileRange = true;
+    while (remaining > 0) {
+        ssize_t copied = -1;
+#if HE_CPP_FILE_STREAM_COPY_FILE_RANGE
+        if (useCopyFileRange) {
+            loff_t sourceCursor = sourceOffset;
+            loff_t destinationCursor = destinationOffset;
+            copied = copy_file_range(sourceDescriptor, &sourceCursor, destinationDescriptor, &destinationCursor, remaining, 0);
+            useCopyFileRange = copied >= 0;
+        }
+#else
+        useCopyFileRange = false;
+#endif
+        if (!useCopyFileRange) {
+            // sendfile writes at the destination descriptor offset, so position it explicitly
+            off_t sourceCursor = static_cast<off_t>(sourceOffset);
+            copied = lseek(destinationDescriptor, static_cast<off_t>(destinationOffset), SEEK_SET) < 0
+                ? -1
+                : sendfile(destinationDescriptor, sourceDescriptor, &sourceCursor, remaining);
+        }
+
+        if (copied <= 0) {
+            break;
+        }
+
+        sourceOffset += copied;
+        destinationOffset += copied;
+        remaining -= static_cast<size_t>(copied);
+    }
+
+    const size_t copiedTotal = length - position - remaining;
+    position += copiedTotal;
+    destination->position += copiedTotal;
+    destination->UpdateLength();
+    return remaining == 0;
+#else
+    (void)destination;
+    return false;
+#endif
+}
@@ -7,6 +7,7 @@
 #include "file-access.hpp"
 #include "file-share.hpp"
 #include <cstdio>  // For std::FILE*
+#include <memory>
 #include <vector>
 #include <string>
 #include "file-mode.hpp"
@@ -14,24 +15,31 @@
 class FileStream : public Stream {
 private:
     std::FILE* file;
+    std::shared_ptr<std::FILE> sharedFile;  // Set when the stream is a read-only window into a shared archive file
     std::vector<uint8_t> memoryBuffer;
+    size_t windowOffset;
     size_t position;
     size_t length;
     bool ownsMemoryBuffer;
     bool writable;
 
     void UpdateLength();  // Helper to update file size
+    bool TryKernelCopyTo(FileStream* destination);  // Copies file-to-file without a user-space buffer
 
 public:
     FileStream(const uint8_t* data, size_t length);
+    explicit FileStream(std::vector<uint8_t>&& data);
+    FileStream(std::shared_ptr<std::FILE> archiveFile, size_t offset, size_t length);
     FileStream(const char* path, FileMode mode);
     FileStream(const char* path, FileMode mode, FileAccess access, FileShare share);
     FileStream(const std::string& path, FileMode mode);
     FileStream(const std::string& path, FileMode mode, FileAccess access, FileShare share);
     ~FileStream() override;
 
-    size_t Read(uint8_t* buffer, size_t offset, size_t count) override;
-    void Write(const uint8_t* buffer, size_t offset, size_t count) override;
+    using Stream::Read;
+    using Stream::Write;
+    size_t Read(Span<uint8_t> buffer) override;
+    void Write(ReadOnlySpan<uint8_t> buffer) override;
     size_t Seek(int64_t offset, SeekOrigin origin) override;
     void SetLength(size_t length) override;
 
@@ -46,6 +54,7 @@ public:
     void InternalReserve(size_t count) override;
     void InternalWriteByte(uint8_t byte) override;
     int InternalReadByte() override;
+    void CopyTo(Stream* destination, int32_t bufferSize = DefaultCopyBufferSize) override;
 
     void Dispose() override;
     void Close() override;
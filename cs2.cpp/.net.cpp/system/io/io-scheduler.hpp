@@ -0,0 +1,690 @@
+#ifndef HE_CPP_SYSTEM_IO_IO_SCHEDULER_HPP
+#define HE_CPP_SYSTEM_IO_IO_SCHEDULER_HPP
+
+#include "helcpp_config.hpp"
+#include "runtime/array.hpp"
+#include "runtime/native_exceptions.hpp"
+#include "system/action.hpp"
+#include "system/threading/tasks/task.hpp"
+#include "system/threading/thread_pool.hpp"
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if HE_CPP_PLATFORM_PS2 || HE_CPP_PLATFORM_N64 || HE_CPP_PLATFORM_DS || HE_CPP_RUNTIME_CUSTOM_RETRO
+#define HE_CPP_IO_SCHEDULER_THREADED 0
+#else
+#define HE_CPP_IO_SCHEDULER_THREADED 1
+#endif
+
+#if HE_CPP_IO_SCHEDULER_THREADED && defined(__linux__) && defined(HE_CPP_RUNTIME_USE_IO_URING) && defined(__has_include)
+#if __has_include(<liburing.h>)
+#define HE_CPP_IO_SCHEDULER_IO_URING 1
+#endif
+#endif
+
+#ifndef HE_CPP_IO_SCHEDULER_IO_URING
+#define HE_CPP_IO_SCHEDULER_IO_URING 0
+#endif
+
+#if HE_CPP_IO_SCHEDULER_THREADED
+#include <condition_variable>
+#include <thread>
+#endif
+
+#if HE_CPP_IO_SCHEDULER_IO_URING
+#include <liburing.h>
+#endif
+
+#if defined(_WIN32)
+#include <fcntl.h>
+#include <io.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#define HE_CPP_IO_SCHEDULER_POSITIONAL_READ 1
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifndef HE_CPP_IO_SCHEDULER_POSITIONAL_READ
+#define HE_CPP_IO_SCHEDULER_POSITIONAL_READ 0
+#endif
+
+/// <summary>
+/// Owns one read-only native file handle that the I/O scheduler can read at arbitrary offsets without
+/// disturbing any FileStream cursor. Handles are shared between in-flight operations so closing the
+/// owning reader never invalidates a request the I/O thread is still serving.
+/// </summary>
+class AsyncFileHandle {
+public:
+    /// <summary>
+    /// Opens the file at the supplied path for positional reads.
+    /// </summary>
+    /// <param name="path">Host path of the file to open.</param>
+    explicit AsyncFileHandle(const std::string& path)
+        : descriptor(-1),
+          file(nullptr),
+          length(0) {
+#if defined(_WIN32)
+        descriptor = _open(path.c_str(), _O_RDONLY | _O_BINARY);
+        if (descriptor >= 0) {
+            length = _lseeki64(descriptor, 0, SEEK_END);
+        }
+#elif HE_CPP_IO_SCHEDULER_POSITIONAL_READ
+        descriptor = open(path.c_str(), O_RDONLY);
+        struct stat fileStat;
+        if (descriptor >= 0 && fstat(descriptor, &fileStat) == 0) {
+            length = static_cast<int64_t>(fileStat.st_size);
+        }
+#else
+        file = std::fopen(path.c_str(), "rb");
+        if (file != nullptr && std::fseek(file, 0, SEEK_END) == 0) {
+            length = static_cast<int64_t>(std::ftell(file));
+        }
+#endif
+        if (!IsOpen()) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+            throw FileNotFoundException();
+#else
+            throw FileNotFoundException(std::string("Failed to open file: ") + path);
+#endif
+        }
+    }
+
+    AsyncFileHandle(const AsyncFileHandle&) = delete;
+    AsyncFileHandle& operator=(const AsyncFileHandle&) = delete;
+
+    ~AsyncFileHandle() {
+#if defined(_WIN32)
+        if (descriptor >= 0) {
+            _close(descriptor);
+        }
+#elif HE_CPP_IO_SCHEDULER_POSITIONAL_READ
+        if (descriptor >= 0) {
+            close(descriptor);
+        }
+#else
+        if (file != nullptr) {
+            std::fclose(file);
+        }
+#endif
+    }
+
+    /// <summary>
+    /// Gets whether the native handle was opened successfully.
+    /// </summary>
+    bool IsOpen() const {
+        return descriptor >= 0 || file != nullptr;
+    }
+
+    /// <summary>
+    /// Gets the file length captured when the handle was opened.
+    /// </summary>
+    int64_t Length() const {
+        return length;
+    }
+
+    /// <summary>
+    /// Gets the native descriptor used by kernel-queue backends, or -1 when the handle is stdio-backed.
+    /// </summary>
+    int NativeDescriptor() const {
+        return descriptor;
+    }
+
+    /// <summary>
+    /// Blocks the calling thread while reading up to <paramref name="count"/> bytes at <paramref name="fileOffset"/>.
+    /// </summary>
+    /// <param name="fileOffset">Absolute file offset to read from.</param>
+    /// <param name="destination">Destination buffer.</param>
+    /// <param name="count">Maximum number of bytes to read.</param>
+    /// <returns>The number of bytes read, which is only short at end of file or on error.</returns>
+    int32_t ReadAt(int64_t fileOffset, uint8_t* destination, int32_t count) {
+        if (destination == nullptr || count <= 0 || fileOffset >= length) {
+            return 0;
+        }
+
+        int32_t totalBytesRead = 0;
+#if HE_CPP_IO_SCHEDULER_POSITIONAL_READ
+        while (totalBytesRead < count) {
+            const ssize_t bytesRead = pread(
+                descriptor,
+                destination + totalBytesRead,
+                static_cast<size_t>(count - totalBytesRead),
+                static_cast<off_t>(fileOffset + totalBytesRead));
+            if (bytesRead < 0 && (errno == EINTR || errno == EAGAIN)) {
+                continue;
+            }
+
+            if (bytesRead <= 0) {
+                break;
+            }
+
+            totalBytesRead += static_cast<int32_t>(bytesRead);
+        }
+#else
+        std::lock_guard<std::mutex> guard(seekMutex);
+#if defined(_WIN32)
+        if (_lseeki64(descriptor, fileOffset, SEEK_SET) < 0) {
+            return 0;
+        }
+
+        while (totalBytesRead < count) {
+            const int bytesRead = _read(descriptor, destination + totalBytesRead, static_cast<unsigned int>(count - totalBytesRead));
+            if (bytesRead <= 0) {
+                break;
+            }
+
+            totalBytesRead += bytesRead;
+        }
+#else
+        if (std::fseek(file, static_cast<long>(fileOffset), SEEK_SET) != 0) {
+            return 0;
+        }
+
+        totalBytesRead = static_cast<int32_t>(std::fread(destination, 1, static_cast<size_t>(count), file));
+#endif
+#endif
+        return totalBytesRead;
+    }
+
+private:
+    int descriptor;
+    std::FILE* file;
+    int64_t length;
+#if !HE_CPP_IO_SCHEDULER_POSITIONAL_READ
+    std::mutex seekMutex;
+#endif
+};
+
+class IoReadOperation;
+
+/// <summary>
+/// Intrusive completion hook run on the I/O thread when a read finishes. Awaiters embed one so awaiting a read does not
+/// allocate.
+/// </summary>
+struct IoCompletionCallback {
+    void (*Invoke)(IoCompletionCallback* callback, IoReadOperation* operation);
+};
+
+/// <summary>
+/// Tracks one queued positional read. The destination buffer must stay alive until <see cref="IsCompleted"/> reports true.
+/// </summary>
+class IoReadOperation {
+public:
+    IoReadOperation(std::shared_ptr<AsyncFileHandle> handle, int64_t fileOffset, uint8_t* destination, int32_t count, Action<int32_t>* completion)
+        : Handle(std::move(handle)),
+          FileOffset(fileOffset),
+          Destination(destination),
+          Count(count),
+          Completion(completion),
+          bytesRead(0),
+          completed(false),
+          callback(nullptr) {
+    }
+
+    /// <summary>
+    /// Gets whether the read has finished and <see cref="get_BytesRead"/> is final.
+    /// </summary>
+    bool IsCompleted() const {
+        return completed.load(std::memory_order_acquire);
+    }
+
+    /// <summary>
+    /// Gets the number of bytes transferred by the completed read.
+    /// </summary>
+    int32_t get_BytesRead() const {
+        return bytesRead.load(std::memory_order_acquire);
+    }
+
+    /// <summary>
+    /// Blocks until the I/O backend finishes the read and returns the number of bytes transferred.
+    /// Completion callbacks still run from <c>IoScheduler::DispatchCompletions</c>.
+    /// </summary>
+    int32_t Wait() {
+#if HE_CPP_IO_SCHEDULER_THREADED
+        completed.wait(false, std::memory_order_acquire);
+#endif
+        return get_BytesRead();
+    }
+
+    /// <summary>
+    /// Registers the single callback run on the I/O thread once the read completes. Returns <c>false</c> without
+    /// running it when the read has already completed.
+    /// </summary>
+    bool TryAddCompletionCallback(IoCompletionCallback* completionCallback) {
+        IoCompletionCallback* expected = nullptr;
+        return callback.compare_exchange_strong(expected, completionCallback, std::memory_order_acq_rel, std::memory_order_acquire);
+    }
+
+    std::shared_ptr<AsyncFileHandle> Handle;
+    int64_t FileOffset;
+    uint8_t* Destination;
+    int32_t Count;
+    Action<int32_t>* Completion;
+
+private:
+    friend class IoScheduler;
+
+    void Complete(int32_t value) {
+        bytesRead.store(value, std::memory_order_release);
+        completed.store(true, std::memory_order_release);
+#if HE_CPP_IO_SCHEDULER_THREADED
+        completed.notify_all();
+#endif
+
+        IoCompletionCallback* registered = callback.exchange(CompletedMarker(), std::memory_order_acq_rel);
+        if (registered != nullptr) {
+            registered->Invoke(registered, this);
+        }
+    }
+
+    static IoCompletionCallback* CompletedMarker() {
+        static IoCompletionCallback marker { nullptr };
+        return &marker;
+    }
+
+    std::atomic<int32_t> bytesRead;
+    std::atomic<bool> completed;
+    std::atomic<IoCompletionCallback*> callback;
+};
+
+#if HE_CPP_TASK_COROUTINES
+/// <summary>
+/// Lets lowered async methods <c>co_await</c> a queued read and receive the byte count. The coroutine resumes on the
+/// ThreadPool rather than on the I/O thread, so slow continuations never hold up other reads. On targets without
+/// threads the read has already completed at submission and the await does not suspend.
+/// </summary>
+class IoReadAwaiter final : private IoCompletionCallback, private ThreadPoolWorkItem {
+public:
+    explicit IoReadAwaiter(std::shared_ptr<IoReadOperation> awaitedOperation)
+        : IoCompletionCallback { &OnCompleted }, ThreadPoolWorkItem { &Resume }, operation(std::move(awaitedOperation)) {
+    }
+
+    bool await_ready() const {
+        return operation->IsCompleted();
+    }
+
+    bool await_suspend(std::coroutine_handle<> handle) {
+        continuation = handle;
+        return operation->TryAddCompletionCallback(this);
+    }
+
+    int32_t await_resume() const {
+        return operation->get_BytesRead();
+    }
+
+private:
+    static void OnCompleted(IoCompletionCallback* node, IoReadOperation* completed) {
+        (void)completed;
+        ThreadPool::Schedule(static_cast<IoReadAwaiter*>(node));
+    }
+
+    static void Resume(ThreadPoolWorkItem* item) {
+        static_cast<IoReadAwaiter*>(item)->continuation.resume();
+    }
+
+    std::shared_ptr<IoReadOperation> operation;
+    std::coroutine_handle<> continuation;
+};
+
+inline IoReadAwaiter operator co_await(std::shared_ptr<IoReadOperation> operation) {
+    return IoReadAwaiter(std::move(operation));
+}
+#endif
+
+/// <summary>
+/// Serves asynchronous positional file reads on background I/O threads so asset loading does not stall the caller.
+/// Linux builds that define <c>HE_CPP_RUNTIME_USE_IO_URING</c> and link liburing submit reads through one io_uring
+/// queue; every other threaded target uses a small pool of blocking reader threads. Retro targets without threads
+/// complete each request synchronously at submission so the same calling code runs everywhere.
+/// Completion delegates are queued and invoked by <see cref="DispatchCompletions"/> on the thread that owns the
+/// engine state, typically once per frame, instead of on the I/O thread.
+/// </summary>
+class IoScheduler {
+public:
+    /// <summary>
+    /// Gets the process-wide scheduler, created with a single I/O thread on first use.
+    /// </summary>
+    static IoScheduler& Shared() {
+        static IoScheduler scheduler(1);
+        return scheduler;
+    }
+
+    /// <summary>
+    /// Starts a scheduler with the requested number of blocking reader threads. The io_uring backend always uses one
+    /// submission thread and ignores the count.
+    /// </summary>
+    /// <param name="workerCount">Number of reader threads for the portable backend; values below one use one thread.</param>
+    explicit IoScheduler(int32_t workerCount)
+        : stopping(false) {
+#if HE_CPP_IO_SCHEDULER_IO_URING
+        (void)workerCount;
+        ringReady = io_uring_queue_init(QueueDepth, &ring, 0) == 0;
+        workers.emplace_back([this]() { RunRingWorker(); });
+#elif HE_CPP_IO_SCHEDULER_THREADED
+        const int32_t resolvedWorkerCount = workerCount < 1 ? 1 : workerCount;
+        for (int32_t workerIndex = 0; workerIndex < resolvedWorkerCount; ++workerIndex) {
+            workers.emplace_back([this]() { RunBlockingWorker(); });
+        }
+#else
+        (void)workerCount;
+#endif
+    }
+
+    IoScheduler(const IoScheduler&) = delete;
+    IoScheduler& operator=(const IoScheduler&) = delete;
+
+    ~IoScheduler() {
+#if HE_CPP_IO_SCHEDULER_THREADED
+        {
+            std::lock_guard<std::mutex> guard(queueMutex);
+            stopping = true;
+        }
+
+        queueSignal.notify_all();
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+#endif
+#if HE_CPP_IO_SCHEDULER_IO_URING
+        if (ringReady) {
+            io_uring_queue_exit(&ring);
+        }
+#endif
+    }
+
+    /// <summary>
+    /// Queues a read of <paramref name="count"/> bytes at <paramref name="fileOffset"/> into <paramref name="destination"/>.
+    /// </summary>
+    /// <param name="handle">Shared file handle to read from.</param>
+    /// <param name="fileOffset">Absolute file offset to read from.</param>
+    /// <param name="destination">Destination buffer that must outlive the operation.</param>
+    /// <param name="count">Maximum number of bytes to read.</param>
+    /// <param name="completion">Optional delegate invoked with the byte count from <see cref="DispatchCompletions"/>.</param>
+    /// <returns>The queued operation.</returns>
+    std::shared_ptr<IoReadOperation> Submit(
+        std::shared_ptr<AsyncFileHandle> handle,
+        int64_t fileOffset,
+        uint8_t* destination,
+        int32_t count,
+        Action<int32_t>* completion = nullptr) {
+        if (handle == nullptr) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+            throw ArgumentNullException();
+#else
+            throw ArgumentNullException("handle");
+#endif
+        }
+
+        std::shared_ptr<IoReadOperation> operation = std::make_shared<IoReadOperation>(
+            std::move(handle),
+            fileOffset,
+            destination,
+            count,
+            completion);
+#if HE_CPP_IO_SCHEDULER_THREADED
+        {
+            std::lock_guard<std::mutex> guard(queueMutex);
+            pending.push_back(operation);
+        }
+
+        queueSignal.notify_one();
+#else
+        Finish(operation, operation->Handle->ReadAt(operation->FileOffset, operation->Destination, operation->Count));
+#endif
+        return operation;
+    }
+
+    /// <summary>
+    /// Invokes the completion delegates of every finished operation on the calling thread.
+    /// </summary>
+    /// <returns>The number of completions dispatched.</returns>
+    int32_t DispatchCompletions() {
+        std::deque<std::shared_ptr<IoReadOperation>> ready;
+        {
+            std::lock_guard<std::mutex> guard(completionMutex);
+            ready.swap(completed);
+        }
+
+        for (const std::shared_ptr<IoReadOperation>& operation : ready) {
+            if (operation->Completion != nullptr) {
+                (*operation->Completion)(operation->get_BytesRead());
+            }
+        }
+
+        return static_cast<int32_t>(ready.size());
+    }
+
+private:
+    void Finish(const std::shared_ptr<IoReadOperation>& operation, int32_t bytesRead) {
+        // Store the result before publishing so DispatchCompletions never observes an unfinished operation.
+        operation->Complete(bytesRead);
+        if (operation->Completion != nullptr) {
+            std::lock_guard<std::mutex> guard(completionMutex);
+            completed.push_back(operation);
+        }
+    }
+
+#if HE_CPP_IO_SCHEDULER_THREADED && !HE_CPP_IO_SCHEDULER_IO_URING
+    void RunBlockingWorker() {
+        while (true) {
+            std::shared_ptr<IoReadOperation> operation;
+            {
+                std::unique_lock<std::mutex> lock(queueMutex);
+                queueSignal.wait(lock, [this]() { return stopping || !pending.empty(); });
+                if (pending.empty()) {
+                    return;
+                }
+
+                operation = std::move(pending.front());
+                pending.pop_front();
+            }
+
+            Finish(operation, operation->Handle->ReadAt(operation->FileOffset, operation->Destination, operation->Count));
+        }
+    }
+#endif
+
+#if HE_CPP_IO_SCHEDULER_IO_URING
+    static constexpr unsigned QueueDepth = 64;
+
+    /// <summary>
+    /// One operation in the ring and the bytes its completions have delivered so far, so a short read can be
+    /// resubmitted for the remainder.
+    /// </summary>
+    struct RingRead {
+        std::shared_ptr<IoReadOperation> Operation;
+        int32_t Transferred;
+    };
+
+    /// <summary>
+    /// Queues the rest of <paramref name="read"/> in the ring, or returns false when the submission queue is full.
+    /// </summary>
+    bool PrepareRingRead(RingRead* read) {
+        io_uring_sqe* entry = io_uring_get_sqe(&ring);
+        if (entry == nullptr) {
+            return false;
+        }
+
+        IoReadOperation& operation = *read->Operation;
+        io_uring_prep_read(
+            entry,
+            operation.Handle->NativeDescriptor(),
+            operation.Destination + read->Transferred,
+            static_cast<unsigned>(operation.Count - read->Transferred),
+            static_cast<__u64>(operation.FileOffset + read->Transferred));
+        io_uring_sqe_set_data(entry, read);
+        return true;
+    }
+
+    /// <summary>
+    /// Finishes <paramref name="read"/> with a blocking read of whatever it still lacks, for when the ring cannot take it.
+    /// </summary>
+    void FinishRingReadBlocking(const RingRead& read) {
+        const IoReadOperation& operation = *read.Operation;
+        Finish(read.Operation, read.Transferred + operation.Handle->ReadAt(
+            operation.FileOffset + read.Transferred,
+            operation.Destination + read.Transferred,
+            operation.Count - read.Transferred));
+    }
+
+    void RunRingWorker() {
+        unsigned inFlight = 0;
+        while (true) {
+            std::deque<std::shared_ptr<IoReadOperation>> batch;
+            {
+                std::unique_lock<std::mutex> lock(queueMutex);
+                if (inFlight == 0) {
+                    queueSignal.wait(lock, [this]() { return stopping || !pending.empty(); });
+                }
+
+                if (stopping && pending.empty() && inFlight == 0) {
+                    return;
+                }
+
+                while (!pending.empty() && inFlight + batch.size() < QueueDepth) {
+                    batch.push_back(std::move(pending.front()));
+                    pending.pop_front();
+                }
+            }
+
+            for (std::shared_ptr<IoReadOperation>& operation : batch) {
+                std::unique_ptr<RingRead> read(new RingRead { std::move(operation), 0 });
+                if (!ringReady || read->Operation->Handle->NativeDescriptor() < 0 || read->Operation->Count <= 0 || !PrepareRingRead(read.get())) {
+                    FinishRingReadBlocking(*read);
+                    continue;
+                }
+
+                read.release();
+                ++inFlight;
+            }
+
+            if (inFlight == 0) {
+                continue;
+            }
+
+            io_uring_submit(&ring);
+            io_uring_cqe* completionEntry = nullptr;
+            if (io_uring_wait_cqe(&ring, &completionEntry) != 0) {
+                continue;
+            }
+
+            do {
+                std::unique_ptr<RingRead> read(static_cast<RingRead*>(io_uring_cqe_get_data(completionEntry)));
+                const int result = completionEntry->res;
+                io_uring_cqe_seen(&ring, completionEntry);
+
+                // Short reads and interrupted reads go back into the ring for the remainder, so this backend returns
+                // the same counts as AsyncFileHandle::ReadAt: short only at end of file or on a hard error.
+                if (result > 0) {
+                    read->Transferred += result;
+                }
+
+                const bool remaining = result == -EINTR || result == -EAGAIN || (result > 0 && read->Transferred < read->Operation->Count);
+                if (remaining && PrepareRingRead(read.get())) {
+                    read.release();
+                    continue;
+                }
+
+                --inFlight;
+                if (remaining) {
+                    FinishRingReadBlocking(*read);
+                } else {
+                    Finish(read->Operation, read->Transferred);
+                }
+            } while (io_uring_peek_cqe(&ring, &completionEntry) == 0);
+        }
+    }
+
+    io_uring ring;
+    bool ringReady;
+#endif
+
+    bool stopping;
+    std::mutex completionMutex;
+    std::deque<std::shared_ptr<IoReadOperation>> completed;
+#if HE_CPP_IO_SCHEDULER_THREADED
+    std::mutex queueMutex;
+    std::condition_variable queueSignal;
+    std::deque<std::shared_ptr<IoReadOperation>> pending;
+    std::vector<std::thread> workers;
+#endif
+};
+
+/// <summary>
+/// Reads a file through the shared I/O scheduler with managed-style <c>ReadAsync</c> calls.
+/// </summary>
+class AsyncFileReader {
+public:
+    /// <summary>
+    /// Opens the file at the supplied path for asynchronous reads.
+    /// </summary>
+    /// <param name="path">Host path of the file to open.</param>
+    /// <param name="scheduler">Scheduler that serves the reads, or null for <see cref="IoScheduler::Shared"/>.</param>
+    explicit AsyncFileReader(const std::string& path, IoScheduler* scheduler = nullptr)
+        : handle(std::make_shared<AsyncFileHandle>(path)),
+          scheduler(scheduler != nullptr ? scheduler : &IoScheduler::Shared()) {
+    }
+
+    /// <summary>
+    /// Gets the file length in bytes.
+    /// </summary>
+    int64_t Length() const {
+        return handle->Length();
+    }
+
+    /// <summary>
+    /// Queues a read into a managed byte array.
+    /// </summary>
+    /// <param name="fileOffset">Absolute file offset to read from.</param>
+    /// <param name="buffer">Destination array that must outlive the operation.</param>
+    /// <param name="offset">Destination offset inside <paramref name="buffer"/>.</param>
+    /// <param name="count">Maximum number of bytes to read.</param>
+    /// <param name="completion">Optional delegate invoked with the byte count from <c>IoScheduler::DispatchCompletions</c>.</param>
+    /// <returns>The queued operation.</returns>
+    std::shared_ptr<IoReadOperation> ReadAsync(int64_t fileOffset, Array<uint8_t>* buffer, int32_t offset, int32_t count, Action<int32_t>* completion = nullptr) {
+        if (buffer == nullptr) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+            throw ArgumentNullException();
+#else
+            throw ArgumentNullException("buffer");
+#endif
+        }
+
+        if (offset < 0 || count < 0 || offset > buffer->Length - count) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+            throw ArgumentOutOfRangeException();
+#else
+            throw ArgumentOutOfRangeException("count");
+#endif
+        }
+
+        return scheduler->Submit(handle, fileOffset, buffer->Data + offset, count, completion);
+    }
+
+    /// <summary>
+    /// Queues a read into a raw native buffer.
+    /// </summary>
+    std::shared_ptr<IoReadOperation> ReadAsync(int64_t fileOffset, uint8_t* destination, int32_t count, Action<int32_t>* completion = nullptr) {
+        return scheduler->Submit(handle, fileOffset, destination, count, completion);
+    }
+
+    /// <summary>
+    /// Gets the scheduler that serves this reader.
+    /// </summary>
+    IoScheduler* get_Scheduler() const {
+        return scheduler;
+    }
+
+private:
+    std::shared_ptr<AsyncFileHandle> handle;
+    IoScheduler* scheduler;
+};
+
+#endif // HE_CPP_SYSTEM_IO_IO_SCHEDULER_HPP
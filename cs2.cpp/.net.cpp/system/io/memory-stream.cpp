@@ -13,24 +13,25 @@ MemoryStream::MemoryStream(Array<uint8_t>* data, bool writable)
 }
 
 // Read data into a buffer
-size_t MemoryStream::Read(uint8_t* outBuffer, size_t offset, size_t count) {
-    if (!CanRead() || !outBuffer) return 0;
+size_t MemoryStream::Read(Span<uint8_t> outBuffer) {
+    if (!CanRead() || !outBuffer.Data) return 0;
 
-    size_t readable = std::min(count, buffer.size() - position);
-    std::memcpy(outBuffer + offset, buffer.data() + position, readable);
+    size_t readable = std::min(outBuffer.Length, buffer.size() - position);
+    std::memcpy(outBuffer.Data, buffer.data() + position, readable);
     position += readable;
     return readable;
 }
 
 // Write data from a buffer
-void MemoryStream::Write(const uint8_t* inBuffer, size_t offset, size_t count) {
-    if (!CanWrite() || !inBuffer) return;
+void MemoryStream::Write(ReadOnlySpan<uint8_t> inBuffer) {
+    if (!CanWrite() || !inBuffer.Data) return;
 
+    const size_t count = inBuffer.Length;
     if (position + count > buffer.size()) {
         buffer.resize(position + count);
     }
 
-    std::memcpy(buffer.data() + position, inBuffer + offset, count);
+    std::memcpy(buffer.data() + position, inBuffer.Data, count);
     position += count;
 }
 
@@ -97,3 +98,19 @@ Array<uint8_t>* MemoryStream::ToArray() {
 
     return data;
 }
+
+// Copies the unread bytes with one Write call instead of staging them through a scratch buffer
+void MemoryStream::CopyTo(Stream* destination, int32_t bufferSize) {
+    if (destination == nullptr || destination == this) {
+        Stream::CopyTo(destination, bufferSize);
+        return;
+    }
+
+    if (position >= buffer.size()) {
+        return;
+    }
+
+    const size_t start = position;
+    position = buffer.size();
+    destination->Write(buffer.data(), start, buffer.size() - start);
+}
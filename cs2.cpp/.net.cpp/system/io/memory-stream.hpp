@@ -20,8 +20,10 @@ public:
     ~MemoryStream() override = default;
 
     // Stream Implementation
-    size_t Read(uint8_t* outBuffer, size_t offset, size_t count) override;
-    void Write(const uint8_t* inBuffer, size_t offset, size_t count) override;
+    using Stream::Read;
+    using Stream::Write;
+    size_t Read(Span<uint8_t> outBuffer) override;
+    void Write(ReadOnlySpan<uint8_t> inBuffer) override;
     size_t Seek(int64_t offset, SeekOrigin origin) override;
     void SetLength(size_t length) override;
 
@@ -39,6 +41,7 @@ public:
     void InternalWriteByte(uint8_t byte) override;
     int InternalReadByte() override;
     Array<uint8_t>* ToArray();
+    void CopyTo(Stream* destination, int32_t bufferSize = DefaultCopyBufferSize) override;
 
     // Stream Management
     void Flush() override {}
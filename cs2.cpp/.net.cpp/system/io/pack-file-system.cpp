@@ -0,0 +1,392 @@
+#include "pack-file-system.hpp"
+#include "helcpp_config.hpp"
+#include "compression/deflate-stream.hpp"
+#include "compression/lz4-stream.hpp"
+#include "../../runtime/native_exceptions.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace {
+    const uint8_t PackArchiveMagic[4] = { 'H', 'P', 'A', 'K' };
+
+    uint32_t PackReadUInt32(const uint8_t* source) {
+        return static_cast<uint32_t>(source[0]) |
+            (static_cast<uint32_t>(source[1]) << 8) |
+            (static_cast<uint32_t>(source[2]) << 16) |
+            (static_cast<uint32_t>(source[3]) << 24);
+    }
+
+    uint64_t PackReadUInt64(const uint8_t* source) {
+        return static_cast<uint64_t>(PackReadUInt32(source)) |
+            (static_cast<uint64_t>(PackReadUInt32(source + 4)) << 32);
+    }
+
+    void PackWriteUInt32(uint8_t* destination, uint32_t value) {
+        destination[0] = static_cast<uint8_t>(value);
+        destination[1] = static_cast<uint8_t>(value >> 8);
+        destination[2] = static_cast<uint8_t>(value >> 16);
+        destination[3] = static_cast<uint8_t>(value >> 24);
+    }
+
+    void PackWriteUInt64(uint8_t* destination, uint64_t value) {
+        PackWriteUInt32(destination, static_cast<uint32_t>(value));
+        PackWriteUInt32(destination + 4, static_cast<uint32_t>(value >> 32));
+    }
+
+    void ThrowInvalidArchive(const std::string& archivePath) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+        (void)archivePath;
+        throw InvalidOperationException();
+#else
+        throw InvalidOperationException(std::string("Invalid pack archive: ") + archivePath);
+#endif
+    }
+
+    bool ReadExact(std::FILE* file, void* destination, size_t count) {
+        return count == 0 || std::fread(destination, 1, count, file) == count;
+    }
+
+    std::vector<std::shared_ptr<PackArchive>>& MountedPackArchives() {
+        static std::vector<std::shared_ptr<PackArchive>> archives;
+        return archives;
+    }
+
+    const PackArchive* FindPackEntry(const char* path, const PackEntry*& entry) {
+        entry = nullptr;
+        if (path == nullptr) {
+            return nullptr;
+        }
+
+        const std::string normalizedPath = PackFileSystem::NormalizePath(path);
+        std::vector<std::shared_ptr<PackArchive>>& archives = MountedPackArchives();
+        std::string relativePath;
+        for (size_t archiveIndex = archives.size(); archiveIndex > 0; --archiveIndex) {
+            const PackArchive& archive = *archives[archiveIndex - 1];
+            if (!archive.TryGetRelativePath(normalizedPath, relativePath)) {
+                continue;
+            }
+
+            entry = archive.FindEntry(relativePath);
+            if (entry != nullptr) {
+                return &archive;
+            }
+        }
+
+        return nullptr;
+    }
+}
+
+PackArchive::PackArchive(const std::string& archivePath, const std::string& archiveMountPoint)
+    : file(std::fopen(archivePath.c_str(), "rb"), [](std::FILE* handle) { if (handle != nullptr) std::fclose(handle); }),
+      mountPoint(PackFileSystem::NormalizePath(archiveMountPoint.c_str())) {
+    if (file == nullptr) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+        throw FileNotFoundException();
+#else
+        throw FileNotFoundException(std::string("Failed to open pack archive: ") + archivePath);
+#endif
+    }
+
+    if (std::fseek(file.get(), 0, SEEK_END) != 0) {
+        ThrowInvalidArchive(archivePath);
+    }
+
+    const long archiveLength = std::ftell(file.get());
+    if (archiveLength < 0 || std::fseek(file.get(), 0, SEEK_SET) != 0) {
+        ThrowInvalidArchive(archivePath);
+    }
+
+    uint8_t header[HeaderSize];
+    if (!ReadExact(file.get(), header, HeaderSize) ||
+        std::memcmp(header, PackArchiveMagic, sizeof(PackArchiveMagic)) != 0 ||
+        PackReadUInt32(header + 4) != FormatVersion) {
+        ThrowInvalidArchive(archivePath);
+    }
+
+    const uint32_t entryCount = PackReadUInt32(header + 8);
+    const uint32_t nameTableSize = PackReadUInt32(header + 12);
+    std::vector<uint8_t> index(static_cast<size_t>(entryCount) * EntrySize);
+    names.resize(nameTableSize);
+    if (!ReadExact(file.get(), index.data(), index.size()) || !ReadExact(file.get(), names.data(), names.size())) {
+        ThrowInvalidArchive(archivePath);
+    }
+
+    if (!names.empty() && names.back() != '\0') {
+        ThrowInvalidArchive(archivePath);
+    }
+
+    entries.resize(entryCount);
+    for (uint32_t entryIndex = 0; entryIndex < entryCount; ++entryIndex) {
+        const uint8_t* record = index.data() + static_cast<size_t>(entryIndex) * EntrySize;
+        PackEntry& entry = entries[entryIndex];
+        entry.PathHash = PackReadUInt64(record);
+        entry.DataOffset = PackReadUInt64(record + 8);
+        entry.StoredSize = PackReadUInt32(record + 16);
+        entry.OriginalSize = PackReadUInt32(record + 20);
+        entry.NameOffset = PackReadUInt32(record + 24);
+        entry.Flags = PackReadUInt32(record + 28);
+        if (entry.NameOffset >= nameTableSize) {
+            ThrowInvalidArchive(archivePath);
+        }
+
+        // Stored entries are windowed at their original size, compressed ones are decoded from their stored size
+        const uint64_t payloadSize = entry.Compression() == PackEntryCompression::None ? entry.OriginalSize : entry.StoredSize;
+        if (entry.DataOffset > static_cast<uint64_t>(archiveLength) || payloadSize > static_cast<uint64_t>(archiveLength) - entry.DataOffset) {
+            ThrowInvalidArchive(archivePath);
+        }
+
+        const char* name = names.data() + entry.NameOffset;
+        const size_t nameLength = std::strlen(name);
+        for (size_t separatorIndex = 0; separatorIndex < nameLength; ++separatorIndex) {
+            if (name[separatorIndex] == '/') {
+                directoryHashes.push_back(PackFileSystem::HashPath(name, separatorIndex));
+            }
+        }
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const PackEntry& left, const PackEntry& right) {
+        return left.PathHash < right.PathHash;
+    });
+    std::sort(directoryHashes.begin(), directoryHashes.end());
+    directoryHashes.erase(std::unique(directoryHashes.begin(), directoryHashes.end()), directoryHashes.end());
+}
+
+bool PackArchive::TryGetRelativePath(const std::string& normalizedPath, std::string& relativePath) const {
+    if (mountPoint.empty()) {
+        relativePath = normalizedPath;
+        return true;
+    }
+
+    if (normalizedPath.compare(0, mountPoint.size(), mountPoint) != 0) {
+        return false;
+    }
+
+    if (normalizedPath.size() == mountPoint.size()) {
+        relativePath.clear();
+        return true;
+    }
+
+    if (normalizedPath[mountPoint.size()] != '/') {
+        return false;
+    }
+
+    relativePath.assign(normalizedPath, mountPoint.size() + 1, std::string::npos);
+    return true;
+}
+
+const PackEntry* PackArchive::FindEntry(const std::string& relativePath) const {
+    const uint64_t pathHash = PackFileSystem::HashPath(relativePath.data(), relativePath.size());
+    auto candidate = std::lower_bound(entries.begin(), entries.end(), pathHash, [](const PackEntry& entry, uint64_t value) {
+        return entry.PathHash < value;
+    });
+    for (; candidate != entries.end() && candidate->PathHash == pathHash; ++candidate) {
+        if (relativePath == GetEntryName(*candidate)) {
+            return &*candidate;
+        }
+    }
+
+    return nullptr;
+}
+
+bool PackArchive::ContainsDirectory(const std::string& relativePath) const {
+    if (relativePath.empty()) {
+        return !entries.empty();
+    }
+
+    return std::binary_search(
+        directoryHashes.begin(),
+        directoryHashes.end(),
+        PackFileSystem::HashPath(relativePath.data(), relativePath.size()));
+}
+
+FileStream* PackArchive::OpenEntry(const PackEntry& entry) const {
+    if (entry.Compression() == PackEntryCompression::None) {
+        return new FileStream(file, static_cast<size_t>(entry.DataOffset), entry.OriginalSize);
+    }
+
+    if (entry.Compression() == PackEntryCompression::Lz4 || entry.Compression() == PackEntryCompression::Deflate) {
+        FileStream storedStream(file, static_cast<size_t>(entry.DataOffset), entry.StoredSize);
+        std::unique_ptr<Stream> decoder;
+        if (entry.Compression() == PackEntryCompression::Lz4) {
+            decoder.reset(new Lz4Stream(&storedStream, CompressionMode::Decompress, true));
+        } else {
+            decoder.reset(new DeflateStream(&storedStream, CompressionMode::Decompress, true));
+        }
+
+        std::vector<uint8_t> data(entry.OriginalSize);
+        size_t totalBytesRead = 0;
+        while (totalBytesRead < data.size()) {
+            const size_t bytesRead = decoder->Read(data.data(), totalBytesRead, data.size() - totalBytesRead);
+            if (bytesRead == 0) {
+                break;
+            }
+
+            totalBytesRead += bytesRead;
+        }
+
+        data.resize(totalBytesRead);
+        return new FileStream(std::move(data));
+    }
+
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+    throw NotSupportedException();
+#else
+    throw NotSupportedException(std::string("Unsupported pack entry compression: ") + GetEntryName(entry));
+#endif
+}
+
+const char* PackArchive::GetEntryName(const PackEntry& entry) const {
+    return names.data() + entry.NameOffset;
+}
+
+void PackFileSystem::Mount(const std::string& archivePath, const std::string& mountPoint) {
+    MountedPackArchives().push_back(std::make_shared<PackArchive>(archivePath, mountPoint));
+}
+
+void PackFileSystem::UnmountAll() {
+    MountedPackArchives().clear();
+}
+
+bool PackFileSystem::CanHandlePath(const char* path) {
+    return Exists(path) || DirectoryExists(path);
+}
+
+bool PackFileSystem::Exists(const char* path) {
+    const PackEntry* entry = nullptr;
+    return FindPackEntry(path, entry) != nullptr;
+}
+
+bool PackFileSystem::DirectoryExists(const char* path) {
+    if (path == nullptr) {
+        return false;
+    }
+
+    const std::string normalizedPath = NormalizePath(path);
+    std::string relativePath;
+    for (const std::shared_ptr<PackArchive>& archive : MountedPackArchives()) {
+        if (archive->TryGetRelativePath(normalizedPath, relativePath) && archive->ContainsDirectory(relativePath)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+FileStream* PackFileSystem::OpenRead(const char* path) {
+    const PackEntry* entry = nullptr;
+    const PackArchive* archive = FindPackEntry(path, entry);
+    if (archive == nullptr) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+        throw FileNotFoundException();
+#else
+        throw FileNotFoundException(std::string("Failed to open file: ") + (path != nullptr ? path : ""));
+#endif
+    }
+
+    return archive->OpenEntry(*entry);
+}
+
+std::string PackFileSystem::NormalizePath(const char* path) {
+    std::string normalizedPath;
+    if (path == nullptr) {
+        return normalizedPath;
+    }
+
+    const bool rooted = path[0] == '/' || path[0] == '\\';
+    size_t segmentStart = 0;
+    for (size_t index = 0;; ++index) {
+        const char character = path[index];
+        if (character != '\0' && character != '/' && character != '\\') {
+            continue;
+        }
+
+        const size_t segmentLength = index - segmentStart;
+        const bool currentDirectorySegment = segmentLength == 1 && path[segmentStart] == '.';
+        if (segmentLength > 0 && !currentDirectorySegment) {
+            if (!normalizedPath.empty() || rooted) {
+                normalizedPath.push_back('/');
+            }
+
+            normalizedPath.append(path + segmentStart, segmentLength);
+        }
+
+        if (character == '\0') {
+            break;
+        }
+
+        segmentStart = index + 1;
+    }
+
+    return normalizedPath;
+}
+
+uint64_t PackFileSystem::HashPath(const char* path, size_t length) {
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t index = 0; index < length; ++index) {
+        hash ^= static_cast<uint8_t>(path[index]);
+        hash *= 1099511628211ull;
+    }
+
+    return hash;
+}
+
+void PackFileSystem::WriteArchive(const std::string& archivePath, const std::vector<std::pair<std::string, std::string>>& files) {
+    std::vector<PackEntry> entries(files.size());
+    std::vector<std::vector<uint8_t>> payloads(files.size());
+    std::vector<char> names;
+    for (size_t fileIndex = 0; fileIndex < files.size(); ++fileIndex) {
+        const std::string relativePath = NormalizePath(files[fileIndex].first.c_str());
+        FileStream source(files[fileIndex].second, FileMode::Open);
+        payloads[fileIndex].resize(source.Length());
+        source.Read(payloads[fileIndex].data(), 0, payloads[fileIndex].size());
+
+        PackEntry& entry = entries[fileIndex];
+        entry.PathHash = HashPath(relativePath.data(), relativePath.size());
+        entry.StoredSize = static_cast<uint32_t>(payloads[fileIndex].size());
+        entry.OriginalSize = entry.StoredSize;
+        entry.NameOffset = static_cast<uint32_t>(names.size());
+        entry.Flags = static_cast<uint32_t>(PackEntryCompression::None);
+        names.insert(names.end(), relativePath.begin(), relativePath.end());
+        names.push_back('\0');
+    }
+
+    uint64_t dataOffset = PackArchive::HeaderSize + entries.size() * PackArchive::EntrySize + names.size();
+    for (PackEntry& entry : entries) {
+        entry.DataOffset = dataOffset;
+        dataOffset += entry.StoredSize;
+    }
+
+    std::vector<uint8_t> index(PackArchive::HeaderSize + entries.size() * PackArchive::EntrySize);
+    std::memcpy(index.data(), PackArchiveMagic, sizeof(PackArchiveMagic));
+    PackWriteUInt32(index.data() + 4, PackArchive::FormatVersion);
+    PackWriteUInt32(index.data() + 8, static_cast<uint32_t>(entries.size()));
+    PackWriteUInt32(index.data() + 12, static_cast<uint32_t>(names.size()));
+
+    std::vector<size_t> order(entries.size());
+    for (size_t entryIndex = 0; entryIndex < order.size(); ++entryIndex) {
+        order[entryIndex] = entryIndex;
+    }
+
+    std::sort(order.begin(), order.end(), [&entries](size_t left, size_t right) {
+        return entries[left].PathHash < entries[right].PathHash;
+    });
+    for (size_t recordIndex = 0; recordIndex < order.size(); ++recordIndex) {
+        const PackEntry& entry = entries[order[recordIndex]];
+        uint8_t* record = index.data() + PackArchive::HeaderSize + recordIndex * PackArchive::EntrySize;
+        PackWriteUInt64(record, entry.PathHash);
+        PackWriteUInt64(record + 8, entry.DataOffset);
+        PackWriteUInt32(record + 16, entry.StoredSize);
+        PackWriteUInt32(record + 20, entry.OriginalSize);
+        PackWriteUInt32(record + 24, entry.NameOffset);
+        PackWriteUInt32(record + 28, entry.Flags);
+    }
+
+    FileStream output(archivePath, FileMode::Create);
+    output.Write(index.data(), 0, index.size());
+    output.Write(reinterpret_cast<const uint8_t*>(names.data()), 0, names.size());
+    for (const std::vector<uint8_t>& payload : payloads) {
+        output.Write(payload.data(), 0, payload.size());
+    }
+
+    output.Flush();
+}
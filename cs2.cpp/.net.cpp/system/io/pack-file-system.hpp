@@ -0,0 +1,142 @@
+#ifndef HE_CPP_SYSTEM_IO_PACK_FILE_SYSTEM_HPP
+#define HE_CPP_SYSTEM_IO_PACK_FILE_SYSTEM_HPP
+
+#include "file-stream.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+/// <summary>
+/// Identifies how one pack entry payload is stored inside the archive.
+/// </summary>
+enum class PackEntryCompression : uint8_t {
+    None = 0,
+    Lz4 = 1,
+    Deflate = 2
+};
+
+/// <summary>
+/// Describes one file stored in a pack archive. The on-disk record is 32 little-endian bytes in this field order.
+/// </summary>
+struct PackEntry {
+    uint64_t PathHash;
+    uint64_t DataOffset;
+    uint32_t StoredSize;
+    uint32_t OriginalSize;
+    uint32_t NameOffset;
+    uint32_t Flags;
+
+    /// <summary>
+    /// Gets the compression codec stored in the low byte of <see cref="Flags"/>.
+    /// </summary>
+    PackEntryCompression Compression() const {
+        return static_cast<PackEntryCompression>(Flags & 0xFFu);
+    }
+};
+
+/// <summary>
+/// One mounted pack archive: a 16-byte header (<c>HPAK</c>, version, entry count, name-table size), the entry index
+/// sorted by path hash, the NUL-terminated name table, then the entry payloads. The index is read once at mount time
+/// and lookups are a binary search over path hashes, so opening an entry never touches the host file system.
+/// </summary>
+class PackArchive {
+public:
+    static constexpr uint32_t FormatVersion = 1;
+    static constexpr size_t HeaderSize = 16;
+    static constexpr size_t EntrySize = 32;
+
+    /// <summary>
+    /// Opens an archive and loads its index.
+    /// </summary>
+    /// <param name="archivePath">Host path of the archive.</param>
+    /// <param name="mountPoint">Path prefix under which archive entries appear; empty mounts at the root.</param>
+    PackArchive(const std::string& archivePath, const std::string& mountPoint);
+
+    /// <summary>
+    /// Resolves a normalized path to its archive-relative form when it lies under this archive mount point.
+    /// </summary>
+    bool TryGetRelativePath(const std::string& normalizedPath, std::string& relativePath) const;
+
+    /// <summary>
+    /// Finds the entry for an archive-relative path, or null when the archive does not contain it.
+    /// </summary>
+    const PackEntry* FindEntry(const std::string& relativePath) const;
+
+    /// <summary>
+    /// Gets whether any archive entry lives under the supplied archive-relative directory.
+    /// </summary>
+    bool ContainsDirectory(const std::string& relativePath) const;
+
+    /// <summary>
+    /// Opens a read-only stream over one entry. Stored entries are windows into the shared archive file; LZ4-frame and
+    /// raw Deflate entries are decoded into memory.
+    /// </summary>
+    FileStream* OpenEntry(const PackEntry& entry) const;
+
+    /// <summary>
+    /// Gets the entry index in path-hash order.
+    /// </summary>
+    const std::vector<PackEntry>& Entries() const {
+        return entries;
+    }
+
+    /// <summary>
+    /// Gets the archive-relative path of one entry.
+    /// </summary>
+    const char* GetEntryName(const PackEntry& entry) const;
+
+private:
+    std::shared_ptr<std::FILE> file;
+    std::string mountPoint;
+    std::vector<PackEntry> entries;
+    std::vector<char> names;
+    std::vector<uint64_t> directoryHashes;
+};
+
+/// <summary>
+/// Built-in virtual file system over mounted pack archives. It satisfies the
+/// <c>HE_CPP_RUNTIME_CUSTOM_FILE_SYSTEM_TYPE</c> contract, so setting the platform options
+/// <c>native-file-system-header="system/io/pack-file-system.hpp"</c> and <c>native-file-system-type=PackFileSystem</c>
+/// routes <c>File</c>, <c>Directory</c>, and <c>FileStream</c> lookups through the archive index. Paths that are not in
+/// any mounted archive fall through to the host file system.
+/// </summary>
+class PackFileSystem {
+public:
+    /// <summary>
+    /// Mounts an archive. Archives mounted later take precedence over earlier ones for the same path.
+    /// </summary>
+    /// <param name="archivePath">Host path of the archive.</param>
+    /// <param name="mountPoint">Path prefix under which archive entries appear; empty mounts at the root.</param>
+    static void Mount(const std::string& archivePath, const std::string& mountPoint = std::string());
+
+    /// <summary>
+    /// Unmounts every archive. Streams opened from an archive keep its file handle alive until they close.
+    /// </summary>
+    static void UnmountAll();
+
+    static bool CanHandlePath(const char* path);
+    static bool Exists(const char* path);
+    static bool DirectoryExists(const char* path);
+    static FileStream* OpenRead(const char* path);
+
+    /// <summary>
+    /// Normalizes a path for index lookups: forward slashes, no empty or <c>.</c> segments, no trailing slash.
+    /// </summary>
+    static std::string NormalizePath(const char* path);
+
+    /// <summary>
+    /// Hashes an archive-relative path with 64-bit FNV-1a.
+    /// </summary>
+    static uint64_t HashPath(const char* path, size_t length);
+
+    /// <summary>
+    /// Writes an archive from host files for content cooking. Each pair maps an archive-relative path to a host path;
+    /// entries are stored uncompressed.
+    /// </summary>
+    static void WriteArchive(const std::string& archivePath, const std::vector<std::pair<std::string, std::string>>& files);
+};
+
+#endif // HE_CPP_SYSTEM_IO_PACK_FILE_SYSTEM_HPP
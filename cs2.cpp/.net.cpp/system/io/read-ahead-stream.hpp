@@ -0,0 +1,198 @@
+#ifndef HE_CPP_SYSTEM_IO_READ_AHEAD_STREAM_HPP
+#define HE_CPP_SYSTEM_IO_READ_AHEAD_STREAM_HPP
+
+#include "stream.hpp"
+#include "io-scheduler.hpp"
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+/// <summary>
+/// Read-only stream that double-buffers sequential reads through the I/O scheduler. While the caller consumes one
+/// block the next block is already in flight, so decode work overlaps disk latency. Seeking outside the two resident
+/// blocks waits for in-flight reads and restarts the prefetch window at the new position.
+/// </summary>
+class ReadAheadStream : public Stream {
+public:
+    /// <summary>
+    /// Default block size used for each of the two read-ahead buffers.
+    /// </summary>
+    static constexpr int32_t DefaultBlockSize = 64 * 1024;
+
+    /// <summary>
+    /// Opens the file at the supplied path and starts prefetching its first two blocks.
+    /// </summary>
+    /// <param name="path">Host path of the file to stream.</param>
+    /// <param name="blockSize">Size of each read-ahead block in bytes.</param>
+    /// <param name="scheduler">Scheduler that serves the reads, or null for <c>IoScheduler::Shared</c>.</param>
+    explicit ReadAheadStream(const std::string& path, int32_t blockSize = DefaultBlockSize, IoScheduler* scheduler = nullptr)
+        : reader(path, scheduler),
+          blockSize(blockSize > 0 ? static_cast<size_t>(blockSize) : static_cast<size_t>(DefaultBlockSize)),
+          length(static_cast<size_t>(reader.Length())),
+          position(0),
+          activeIndex(0),
+          open(true) {
+        blocks[0].Data.resize(this->blockSize);
+        blocks[1].Data.resize(this->blockSize);
+        Restart(0);
+    }
+
+    ~ReadAheadStream() override {
+        Close();
+    }
+
+    using Stream::Read;
+    using Stream::Write;
+
+    size_t Read(Span<uint8_t> buffer) override {
+        if (!open || buffer.Data == nullptr) {
+            return 0;
+        }
+
+        const size_t count = buffer.Length;
+        size_t totalBytesRead = 0;
+        while (totalBytesRead < count && position < length) {
+            Block& block = AcquireBlockForPosition();
+            const size_t blockOffset = position - block.FileOffset;
+            if (blockOffset >= block.Available) {
+                break;
+            }
+
+            const size_t chunk = std::min(count - totalBytesRead, block.Available - blockOffset);
+            std::memcpy(buffer.Data + totalBytesRead, block.Data.data() + blockOffset, chunk);
+            position += chunk;
+            totalBytesRead += chunk;
+        }
+
+        return totalBytesRead;
+    }
+
+    void Write(ReadOnlySpan<uint8_t>) override {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+        throw NotSupportedException();
+#else
+        throw NotSupportedException("ReadAheadStream is read-only");
+#endif
+    }
+
+    size_t Seek(int64_t offset, SeekOrigin origin) override {
+        int64_t basePosition = 0;
+        switch (origin) {
+        case SeekOrigin::Begin: basePosition = 0; break;
+        case SeekOrigin::Current: basePosition = static_cast<int64_t>(position); break;
+        case SeekOrigin::End: basePosition = static_cast<int64_t>(length); break;
+        }
+
+        SetPosition(static_cast<size_t>(std::max<int64_t>(0, basePosition + offset)));
+        return position;
+    }
+
+    void SetLength(size_t) override {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+        throw NotSupportedException();
+#else
+        throw NotSupportedException("ReadAheadStream is read-only");
+#endif
+    }
+
+    bool CanRead() const override { return open; }
+    bool CanWrite() const override { return false; }
+    bool CanSeek() const override { return open; }
+
+    size_t Length() const override { return length; }
+    size_t Position() const override { return position; }
+    void SetPosition(size_t value) override { position = std::min(value, length); }
+
+    void InternalReserve(size_t) override {}
+
+    void InternalWriteByte(uint8_t byte) override {
+        Write(&byte, 0, 1);
+    }
+
+    int InternalReadByte() override {
+        uint8_t byte;
+        return Read(&byte, 0, 1) > 0 ? byte : -1;
+    }
+
+    void Dispose() override {
+        Close();
+    }
+
+    void Close() override {
+        if (!open) {
+            return;
+        }
+
+        Complete(blocks[0]);
+        Complete(blocks[1]);
+        open = false;
+    }
+
+private:
+    struct Block {
+        std::vector<uint8_t> Data;
+        size_t FileOffset = 0;
+        size_t Available = 0;
+        std::shared_ptr<IoReadOperation> Pending;
+    };
+
+    void Prefetch(Block& block, size_t fileOffset) {
+        block.FileOffset = fileOffset;
+        block.Available = 0;
+        block.Pending = fileOffset < length
+            ? reader.ReadAsync(static_cast<int64_t>(fileOffset), block.Data.data(), static_cast<int32_t>(blockSize))
+            : nullptr;
+    }
+
+    static void Complete(Block& block) {
+        if (block.Pending != nullptr) {
+            block.Available = static_cast<size_t>(block.Pending->Wait());
+            block.Pending = nullptr;
+        }
+    }
+
+    bool Contains(const Block& block, size_t value) const {
+        return value >= block.FileOffset && value - block.FileOffset < blockSize;
+    }
+
+    void Restart(size_t value) {
+        Complete(blocks[0]);
+        Complete(blocks[1]);
+        const size_t alignedOffset = value - value % blockSize;
+        activeIndex = 0;
+        Prefetch(blocks[0], alignedOffset);
+        Prefetch(blocks[1], alignedOffset + blockSize);
+    }
+
+    Block& AcquireBlockForPosition() {
+        Block& active = blocks[activeIndex];
+        if (Contains(active, position)) {
+            Complete(active);
+            return active;
+        }
+
+        Block& next = blocks[activeIndex ^ 1];
+        if (Contains(next, position) && next.FileOffset == active.FileOffset + blockSize) {
+            Complete(active);
+            Complete(next);
+            Prefetch(active, next.FileOffset + blockSize);
+            activeIndex ^= 1;
+            return next;
+        }
+
+        Restart(position);
+        Complete(blocks[activeIndex]);
+        return blocks[activeIndex];
+    }
+
+    AsyncFileReader reader;
+    size_t blockSize;
+    size_t length;
+    size_t position;
+    int activeIndex;
+    bool open;
+    Block blocks[2];
+};
+
+#endif // HE_CPP_SYSTEM_IO_READ_AHEAD_STREAM_HPP
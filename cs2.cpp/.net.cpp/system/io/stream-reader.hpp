@@ -1,22 +1,213 @@
 #ifndef STREAM_READER_HPP
 #define STREAM_READER_HPP
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include "stream.hpp"
+#include "string-reader.hpp"
 #include "../text/encoding.hpp"
 
+/// <summary>
+/// Buffered text reader over a runtime stream. Text is decoded into a refillable buffer of at least 64 KB, so
+/// <c>ReadLine</c> over arbitrarily large files keeps memory bounded. A byte-order mark selects UTF-8 or UTF-16
+/// decoding; UTF-16 input is transcoded to the runtime UTF-8 string representation as it is read.
+/// </summary>
 class StreamReader {
+public:
+    /// <summary>
+    /// Minimum size of the decoded text buffer.
+    /// </summary>
+    static constexpr size_t DefaultBufferSize = 64 * 1024;
+
 private:
+    enum class TextEncoding : uint8_t {
+        Utf8,
+        Utf16LittleEndian,
+        Utf16BigEndian
+    };
+
     Stream* stream;
     bool leaveOpen;
     bool disposed;
+    bool detectEncoding;
+    bool endOfInput;
+    TextEncoding encoding;
+    std::vector<char> buffer;
+    size_t bufferStart;
+    size_t bufferEnd;
+    std::vector<uint8_t> rawBuffer;
+    size_t rawEnd;
+    uint32_t pendingHighSurrogate;
+
+    /// <summary>
+    /// Reads raw bytes and checks for a byte-order mark before the first decode.
+    /// </summary>
+    void DetectEncoding() {
+        detectEncoding = false;
+        while (rawEnd < 3) {
+            const size_t bytesRead = stream->Read(rawBuffer.data(), rawEnd, rawBuffer.size() - rawEnd);
+            if (bytesRead == 0) {
+                break;
+            }
+
+            rawEnd += bytesRead;
+        }
+
+        size_t bomLength = 0;
+        if (rawEnd >= 3 && rawBuffer[0] == 0xEF && rawBuffer[1] == 0xBB && rawBuffer[2] == 0xBF) {
+            bomLength = 3;
+        } else if (rawEnd >= 2 && rawBuffer[0] == 0xFF && rawBuffer[1] == 0xFE) {
+            encoding = TextEncoding::Utf16LittleEndian;
+            bomLength = 2;
+        } else if (rawEnd >= 2 && rawBuffer[0] == 0xFE && rawBuffer[1] == 0xFF) {
+            encoding = TextEncoding::Utf16BigEndian;
+            bomLength = 2;
+        }
+
+        std::memmove(rawBuffer.data(), rawBuffer.data() + bomLength, rawEnd - bomLength);
+        rawEnd -= bomLength;
+    }
+
+    void AppendUtf8(uint32_t codePoint) {
+        if (codePoint < 0x80) {
+            buffer[bufferEnd++] = static_cast<char>(codePoint);
+        } else if (codePoint < 0x800) {
+            buffer[bufferEnd++] = static_cast<char>(0xC0 | (codePoint >> 6));
+            buffer[bufferEnd++] = static_cast<char>(0x80 | (codePoint & 0x3F));
+        } else if (codePoint < 0x10000) {
+            buffer[bufferEnd++] = static_cast<char>(0xE0 | (codePoint >> 12));
+            buffer[bufferEnd++] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+            buffer[bufferEnd++] = static_cast<char>(0x80 | (codePoint & 0x3F));
+        } else {
+            buffer[bufferEnd++] = static_cast<char>(0xF0 | (codePoint >> 18));
+            buffer[bufferEnd++] = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+            buffer[bufferEnd++] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+            buffer[bufferEnd++] = static_cast<char>(0x80 | (codePoint & 0x3F));
+        }
+    }
+
+    /// <summary>
+    /// Transcodes buffered UTF-16 code units into the text buffer while at least four bytes of space remain.
+    /// </summary>
+    void DecodeUtf16() {
+        const bool littleEndian = encoding == TextEncoding::Utf16LittleEndian;
+        size_t rawPosition = 0;
+        for (; rawPosition + 2 <= rawEnd && buffer.size() - bufferEnd >= 4; rawPosition += 2) {
+            const uint32_t unit = littleEndian
+                ? static_cast<uint32_t>(rawBuffer[rawPosition]) | (static_cast<uint32_t>(rawBuffer[rawPosition + 1]) << 8)
+                : (static_cast<uint32_t>(rawBuffer[rawPosition]) << 8) | static_cast<uint32_t>(rawBuffer[rawPosition + 1]);
+            if (pendingHighSurrogate != 0) {
+                const uint32_t highSurrogate = pendingHighSurrogate;
+                pendingHighSurrogate = 0;
+                if (unit >= 0xDC00 && unit <= 0xDFFF) {
+                    AppendUtf8(0x10000 + ((highSurrogate - 0xD800) << 10) + (unit - 0xDC00));
+                    continue;
+                }
+
+                AppendUtf8(0xFFFD);
+            }
+
+            if (unit >= 0xD800 && unit <= 0xDBFF) {
+                pendingHighSurrogate = unit;
+            } else {
+                AppendUtf8(unit >= 0xDC00 && unit <= 0xDFFF ? 0xFFFD : unit);
+            }
+        }
+
+        std::memmove(rawBuffer.data(), rawBuffer.data() + rawPosition, rawEnd - rawPosition);
+        rawEnd -= rawPosition;
+    }
+
+    /// <summary>
+    /// Moves unread text to the front of the buffer, growing it when it is already full, then decodes more input.
+    /// Returns false once the underlying stream is exhausted and no text was added.
+    /// </summary>
+    bool Refill() {
+        if (disposed || endOfInput) {
+            return false;
+        }
+
+        if (bufferStart > 0) {
+            std::memmove(buffer.data(), buffer.data() + bufferStart, bufferEnd - bufferStart);
+            bufferEnd -= bufferStart;
+            bufferStart = 0;
+        }
+
+        if (buffer.size() - bufferEnd < 4) {
+            buffer.resize(buffer.size() * 2);
+        }
+
+        if (detectEncoding) {
+            DetectEncoding();
+        }
+
+        const size_t previousEnd = bufferEnd;
+        if (encoding == TextEncoding::Utf8) {
+            if (rawEnd > 0) {
+                const size_t carried = std::min(rawEnd, buffer.size() - bufferEnd);
+                std::memcpy(buffer.data() + bufferEnd, rawBuffer.data(), carried);
+                std::memmove(rawBuffer.data(), rawBuffer.data() + carried, rawEnd - carried);
+                rawEnd -= carried;
+                bufferEnd += carried;
+            }
+
+            if (bufferEnd == previousEnd) {
+                bufferEnd += stream->Read(reinterpret_cast<uint8_t*>(buffer.data()), bufferEnd, buffer.size() - bufferEnd);
+            }
+        } else {
+            while (bufferEnd == previousEnd) {
+                if (rawEnd < 2) {
+                    const size_t bytesRead = stream->Read(rawBuffer.data(), rawEnd, rawBuffer.size() - rawEnd);
+                    if (bytesRead == 0) {
+                        if (pendingHighSurrogate != 0) {
+                            pendingHighSurrogate = 0;
+                            AppendUtf8(0xFFFD);
+                        }
+
+                        break;
+                    }
+
+                    rawEnd += bytesRead;
+                    continue;
+                }
+
+                DecodeUtf16();
+            }
+        }
+
+        endOfInput = bufferEnd == previousEnd;
+        return !endOfInput;
+    }
 
 public:
-    StreamReader(Stream* sourceStream, const Encoding&, bool, int32_t, bool leaveOpenStream)
-        : stream(sourceStream), leaveOpen(leaveOpenStream), disposed(false) {
+    explicit StreamReader(Stream* sourceStream)
+        : StreamReader(sourceStream, Encoding::UTF8, true, -1, false) {
+    }
+
+    StreamReader(Stream* sourceStream, bool detectEncodingFromByteOrderMarks)
+        : StreamReader(sourceStream, Encoding::UTF8, detectEncodingFromByteOrderMarks, -1, false) {
+    }
+
+    StreamReader(Stream* sourceStream, const Encoding& sourceEncoding, bool detectEncodingFromByteOrderMarks = true, int32_t bufferSize = -1, bool leaveOpenStream = false)
+        : stream(sourceStream),
+          leaveOpen(leaveOpenStream),
+          disposed(false),
+          detectEncoding(detectEncodingFromByteOrderMarks),
+          endOfInput(false),
+          encoding(TextEncoding::Utf8),
+          buffer(std::max(DefaultBufferSize, bufferSize > 0 ? static_cast<size_t>(bufferSize) : static_cast<size_t>(0))),
+          bufferStart(0),
+          bufferEnd(0),
+          rawBuffer(DefaultBufferSize),
+          rawEnd(0),
+          pendingHighSurrogate(0) {
+        (void)sourceEncoding;
         if (stream == nullptr) {
             throw std::invalid_argument("sourceStream");
         }
@@ -26,22 +217,162 @@ public:
         Dispose();
     }
 
-    std::string ReadToEnd() {
-        std::string result;
-        uint8_t buffer[4096];
+    /// <summary>
+    /// Gets the underlying stream.
+    /// </summary>
+    Stream* get_BaseStream() const {
+        return stream;
+    }
 
-        while (true) {
-            size_t bytesRead = stream->Read(buffer, 0, sizeof(buffer));
-            if (bytesRead == 0) {
+    /// <summary>
+    /// Gets whether every character has been read.
+    /// </summary>
+    bool get_EndOfStream() {
+        return bufferStart == bufferEnd && !Refill();
+    }
+
+    /// <summary>
+    /// Returns the next character without consuming it, or -1 at end of stream.
+    /// </summary>
+    int32_t Peek() {
+        if (bufferStart == bufferEnd && !Refill()) {
+            return -1;
+        }
+
+        return static_cast<uint8_t>(buffer[bufferStart]);
+    }
+
+    /// <summary>
+    /// Reads the next character, or returns -1 at end of stream.
+    /// </summary>
+    int32_t Read() {
+        if (bufferStart == bufferEnd && !Refill()) {
+            return -1;
+        }
+
+        return static_cast<uint8_t>(buffer[bufferStart++]);
+    }
+
+    /// <summary>
+    /// Reads up to <paramref name="count"/> characters that are already buffered, refilling at most once.
+    /// </summary>
+    int32_t Read(Array<char>* destination, int32_t index, int32_t count) {
+        if (destination == nullptr) {
+            throw ArgumentNullException("buffer");
+        }
+
+        if (index < 0 || count < 0 || destination->Length - index < count) {
+            throw ArgumentOutOfRangeException("count");
+        }
+
+        return static_cast<int32_t>(Read(Span<char>(destination->Data + index, static_cast<size_t>(count))));
+    }
+
+    /// <summary>
+    /// Reads up to the span length in characters that are already buffered, refilling at most once.
+    /// </summary>
+    size_t Read(const Span<char>& destination) {
+        if (destination.Length == 0 || (bufferStart == bufferEnd && !Refill())) {
+            return 0;
+        }
+
+        const size_t copied = std::min(destination.Length, bufferEnd - bufferStart);
+        std::memcpy(destination.Data, buffer.data() + bufferStart, copied);
+        bufferStart += copied;
+        return copied;
+    }
+
+    /// <summary>
+    /// Reads exactly <paramref name="count"/> characters unless the stream ends first.
+    /// </summary>
+    int32_t ReadBlock(Array<char>* destination, int32_t index, int32_t count) {
+        int32_t totalRead = 0;
+        while (totalRead < count) {
+            const int32_t charactersRead = Read(destination, index + totalRead, count - totalRead);
+            if (charactersRead == 0) {
                 break;
             }
 
-            result.append(reinterpret_cast<const char*>(buffer), bytesRead);
+            totalRead += charactersRead;
         }
 
+        return totalRead;
+    }
+
+    /// <summary>
+    /// Reads one line into a view of the internal buffer without copying. The view is valid until the next call on
+    /// this reader. Returns false at end of stream.
+    /// </summary>
+    bool ReadLine(std::string_view& line) {
+        size_t scanPosition = bufferStart;
+        while (true) {
+            const char* lineBreak = TextReaderFindLineBreak(buffer.data() + scanPosition, buffer.data() + bufferEnd);
+            size_t breakPosition = static_cast<size_t>(lineBreak - buffer.data());
+            if (breakPosition < bufferEnd) {
+                // A carriage return at the end of the buffer may be the first half of CRLF. Refill compacts the
+                // buffer even when no text follows, so the break is re-based on the new buffer start either way.
+                if (buffer[breakPosition] == '\r' && breakPosition + 1 == bufferEnd && !endOfInput) {
+                    const size_t lineOffset = breakPosition - bufferStart;
+                    const bool refilled = Refill();
+                    breakPosition = bufferStart + lineOffset;
+                    if (refilled) {
+                        scanPosition = breakPosition;
+                        continue;
+                    }
+                }
+
+                line = std::string_view(buffer.data() + bufferStart, breakPosition - bufferStart);
+                size_t nextStart = breakPosition + 1;
+                if (buffer[breakPosition] == '\r' && nextStart < bufferEnd && buffer[nextStart] == '\n') {
+                    ++nextStart;
+                }
+
+                bufferStart = nextStart;
+                return true;
+            }
+
+            const size_t lineOffset = bufferEnd - bufferStart;
+            if (!Refill()) {
+                if (bufferStart == bufferEnd) {
+                    line = std::string_view();
+                    return false;
+                }
+
+                line = std::string_view(buffer.data() + bufferStart, bufferEnd - bufferStart);
+                bufferStart = bufferEnd;
+                return true;
+            }
+
+            scanPosition = bufferStart + lineOffset;
+        }
+    }
+
+    /// <summary>
+    /// Reads one line, or returns a null line at end of stream.
+    /// </summary>
+    StringReaderLine ReadLine() {
+        std::string_view line;
+        if (!ReadLine(line)) {
+            return StringReaderLine(std::string(), false);
+        }
+
+        return StringReaderLine(std::string(line), true);
+    }
+
+    std::string ReadToEnd() {
+        std::string result;
+        do {
+            result.append(buffer.data() + bufferStart, bufferEnd - bufferStart);
+            bufferStart = bufferEnd;
+        } while (Refill());
+
         return result;
     }
 
+    void Close() {
+        Dispose();
+    }
+
     void Dispose() {
         if (!disposed && !leaveOpen && stream != nullptr) {
             stream->Dispose();
@@ -8,37 +8,53 @@
 #include "../../runtime/array.hpp"
 #include "../../runtime/native_span.hpp"
 #include "seek-origin.hpp"  // Assuming this exists like in your TypeScript
+#include <vector>
+
+#if HE_CPP_PLATFORM_PS2 || HE_CPP_PLATFORM_N64 || HE_CPP_PLATFORM_DS || HE_CPP_RUNTIME_CUSTOM_RETRO
+#define HE_CPP_STREAM_THREADED 0
+#else
+#define HE_CPP_STREAM_THREADED 1
+#endif
 
 class Stream {
 public:
     virtual ~Stream() = default;
 
-    // Abstract methods
-    virtual size_t Read(uint8_t* buffer, size_t offset, size_t count) = 0;
-    virtual void Write(const uint8_t* buffer, size_t offset, size_t count) = 0;
+    // Abstract methods. Spans are the primitives every stream implements, generated subclasses included.
+    virtual size_t Read(Span<uint8_t> buffer) = 0;
+    virtual void Write(ReadOnlySpan<uint8_t> buffer) = 0;
     virtual size_t Seek(int64_t offset, SeekOrigin origin) = 0;
     virtual void SetLength(size_t length) = 0;
 
-    virtual size_t Read(Span<uint8_t> buffer) {
-        return Read(buffer.Data, 0, buffer.Length);
+    // Pointer and array overloads adapt onto the span primitives, so every read or write costs exactly one virtual
+    // dispatch regardless of which managed overload the caller used. Subclasses bring them back into scope with
+    // using Stream::Read and using Stream::Write.
+    size_t Read(uint8_t* buffer, size_t offset, size_t count) {
+        return buffer == nullptr
+            ? 0
+            : Read(Span<uint8_t>(buffer, offset, count));
     }
 
-    virtual size_t Read(Array<uint8_t>* buffer, size_t offset, size_t count) {
+    size_t Read(Array<uint8_t>* buffer, size_t offset, size_t count) {
         return buffer == nullptr
             ? 0
-            : Read(buffer->Data, offset, count);
+            : Read(Span<uint8_t>(buffer->Data, offset, count));
     }
 
-    virtual void Write(Span<uint8_t> buffer) {
-        Write(buffer.Data, 0, buffer.Length);
+    void Write(const uint8_t* buffer, size_t offset, size_t count) {
+        if (buffer == nullptr) {
+            return;
+        }
+
+        Write(ReadOnlySpan<uint8_t>(buffer, offset, count));
     }
 
-    virtual void Write(Array<uint8_t>* buffer, size_t offset, size_t count) {
+    void Write(Array<uint8_t>* buffer, size_t offset, size_t count) {
         if (buffer == nullptr) {
             return;
         }
 
-        Write(buffer->Data, offset, count);
+        Write(ReadOnlySpan<uint8_t>(buffer->Data, offset, count));
     }
 
     // Properties
@@ -94,21 +110,87 @@ public:
     virtual void Close() {}
     virtual void Flush() {}
 
-    virtual void CopyTo(Stream* destination) {
+    static constexpr int32_t DefaultCopyBufferSize = 81920;
+
+    /// <summary>
+    /// Copies the remaining bytes of this stream into <paramref name="destination"/>. Streams with direct access to
+    /// their bytes override this to skip the intermediate buffer.
+    /// </summary>
+    virtual void CopyTo(Stream* destination, int32_t bufferSize = DefaultCopyBufferSize) {
         if (destination == nullptr) {
             return;
         }
 
-        Array<uint8_t> buffer(81920);
+        StreamCopyBuffer buffer(bufferSize > 0 ? static_cast<size_t>(bufferSize) : static_cast<size_t>(DefaultCopyBufferSize));
         while (true) {
-            size_t bytesRead = Read(buffer.Data, 0, static_cast<size_t>(buffer.Length));
+            size_t bytesRead = Read(Span<uint8_t>(buffer.Data(), buffer.Size()));
             if (bytesRead == 0) {
                 break;
             }
 
-            destination->Write(buffer.Data, 0, bytesRead);
+            destination->Write(ReadOnlySpan<uint8_t>(buffer.Data(), bytesRead));
         }
     }
+
+protected:
+    /// <summary>
+    /// Scratch buffer for <see cref="CopyTo"/> that reuses one per-thread allocation. A nested copy on the same thread,
+    /// such as a destination whose Write copies another stream, falls back to a private allocation.
+    /// </summary>
+    class StreamCopyBuffer {
+    public:
+        explicit StreamCopyBuffer(size_t size)
+            : rented(!Shared().InUse && size <= MaxSharedSize),
+              length(size),
+              owned() {
+            if (rented) {
+                Shared().InUse = true;
+                if (Shared().Bytes.size() < size) {
+                    Shared().Bytes.resize(size);
+                }
+            } else {
+                owned.resize(size);
+            }
+        }
+
+        ~StreamCopyBuffer() {
+            if (rented) {
+                Shared().InUse = false;
+            }
+        }
+
+        StreamCopyBuffer(const StreamCopyBuffer&) = delete;
+        StreamCopyBuffer& operator=(const StreamCopyBuffer&) = delete;
+
+        uint8_t* Data() {
+            return rented ? Shared().Bytes.data() : owned.data();
+        }
+
+        size_t Size() const {
+            return length;
+        }
+
+    private:
+        static constexpr size_t MaxSharedSize = 1024 * 1024;
+
+        struct SharedBuffer {
+            std::vector<uint8_t> Bytes;
+            bool InUse = false;
+        };
+
+        static SharedBuffer& Shared() {
+#if HE_CPP_STREAM_THREADED
+            static thread_local SharedBuffer buffer;
+#else
+            static SharedBuffer buffer;
+#endif
+            return buffer;
+        }
+
+        bool rented;
+        size_t length;
+        std::vector<uint8_t> owned;
+    };
 };
 
 #endif // STREAM_HPP
@@ -2,7 +2,63 @@
 #define STRING_READER_HPP
 
 #include <cstddef>
+#include <cstdint>
 #include <string>
+#include <string_view>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define HE_CPP_TEXT_READER_SSE2 1
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define HE_CPP_TEXT_READER_NEON 1
+#endif
+
+/// <summary>
+/// Finds the first carriage return or line feed in [begin, end), or returns end. Scans 16 bytes per step on SSE2 and
+/// AArch64 NEON targets.
+/// </summary>
+inline const char* TextReaderFindLineBreak(const char* begin, const char* end) {
+    const char* cursor = begin;
+#if HE_CPP_TEXT_READER_SSE2
+    const __m128i lineFeed = _mm_set1_epi8('\n');
+    const __m128i carriageReturn = _mm_set1_epi8('\r');
+    for (; end - cursor >= 16; cursor += 16) {
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+        const int mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(bytes, lineFeed), _mm_cmpeq_epi8(bytes, carriageReturn)));
+        if (mask != 0) {
+#if defined(__GNUC__) || defined(__clang__)
+            return cursor + __builtin_ctz(static_cast<unsigned int>(mask));
+#else
+            int index = 0;
+            while ((mask & (1 << index)) == 0) {
+                ++index;
+            }
+
+            return cursor + index;
+#endif
+        }
+    }
+#elif HE_CPP_TEXT_READER_NEON
+    const uint8x16_t lineFeed = vdupq_n_u8('\n');
+    const uint8x16_t carriageReturn = vdupq_n_u8('\r');
+    for (; end - cursor >= 16; cursor += 16) {
+        const uint8x16_t bytes = vld1q_u8(reinterpret_cast<const uint8_t*>(cursor));
+        const uint8x16_t matches = vorrq_u8(vceqq_u8(bytes, lineFeed), vceqq_u8(bytes, carriageReturn));
+        if (vmaxvq_u8(matches) != 0) {
+            break;
+        }
+    }
+#endif
+    for (; cursor < end; ++cursor) {
+        if (*cursor == '\n' || *cursor == '\r') {
+            return cursor;
+        }
+    }
+
+    return end;
+}
 
 class StringReaderLine {
 private:
@@ -18,6 +74,10 @@ public:
         : hasValue(hasLine), value(lineValue) {
     }
 
+    StringReaderLine(std::string&& lineValue, bool hasLine)
+        : hasValue(hasLine), value(std::move(lineValue)) {
+    }
+
     bool operator==(std::nullptr_t) const {
         return !hasValue;
     }
@@ -41,28 +101,37 @@ public:
         : source(text), position(0) {
     }
 
-    StringReaderLine ReadLine() {
+    /// <summary>
+    /// Reads one line as a view into the source text without copying. Returns false at end of text.
+    /// </summary>
+    bool ReadLine(std::string_view& line) {
         if (position >= source.size()) {
-            return StringReaderLine(std::string(), false);
+            line = std::string_view();
+            return false;
         }
 
-        size_t lineEnd = source.find_first_of("\r\n", position);
-        if (lineEnd == std::string::npos) {
-            std::string line = source.substr(position);
-            position = source.size();
-            return StringReaderLine(line, true);
+        const char* begin = source.data() + position;
+        const char* end = source.data() + source.size();
+        const char* lineBreak = TextReaderFindLineBreak(begin, end);
+        line = std::string_view(begin, static_cast<size_t>(lineBreak - begin));
+        position = static_cast<size_t>(lineBreak - source.data());
+        if (lineBreak != end) {
+            position++;
+            if (*lineBreak == '\r' && position < source.size() && source[position] == '\n') {
+                position++;
+            }
         }
 
-        std::string line = source.substr(position, lineEnd - position);
-        position = lineEnd + 1;
+        return true;
+    }
 
-        if (position < source.size() &&
-            source[lineEnd] == '\r' &&
-            source[position] == '\n') {
-            position++;
+    StringReaderLine ReadLine() {
+        std::string_view line;
+        if (!ReadLine(line)) {
+            return StringReaderLine(std::string(), false);
         }
 
-        return StringReaderLine(line, true);
+        return StringReaderLine(std::string(line), true);
     }
 
     void Dispose() {
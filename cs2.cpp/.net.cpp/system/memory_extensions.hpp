@@ -0,0 +1,648 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include "../runtime/array.hpp"
+#include "../runtime/native_exceptions.hpp"
+#include "../runtime/native_span.hpp"
+#include "system/bit_operations.hpp"
+#include "system/runtime/intrinsics/cpu_features.hpp"
+#include "system/runtime/intrinsics/vector_lanes.hpp"
+
+/// <summary>
+/// Reads the elements behind each receiver shape a converted MemoryExtensions call can pass: Span, ReadOnlySpan, and a
+/// managed array, which C# converts to a span implicitly.
+/// </summary>
+template <typename TSpan>
+struct MemoryExtensionsSpan;
+
+template <typename T>
+struct MemoryExtensionsSpan<Span<T>> {
+    using Element = T;
+
+    static T* Data(const Span<T>& span) {
+        return span.Data;
+    }
+
+    static int32_t Length(const Span<T>& span) {
+        return span.get_Length();
+    }
+};
+
+template <typename T>
+struct MemoryExtensionsSpan<ReadOnlySpan<T>> {
+    using Element = T;
+
+    static const T* Data(const ReadOnlySpan<T>& span) {
+        return span.Data;
+    }
+
+    static int32_t Length(const ReadOnlySpan<T>& span) {
+        return span.get_Length();
+    }
+};
+
+template <typename T>
+struct MemoryExtensionsSpan<Array<T>*> {
+    using Element = T;
+
+    static T* Data(Array<T>* array) {
+        return array != nullptr ? array->Data : nullptr;
+    }
+
+    static int32_t Length(Array<T>* array) {
+        return array != nullptr ? array->Length : 0;
+    }
+};
+
+/// <summary>
+/// The register work of one MemoryExtensions step on <typeparamref name="TLanes"/>: broadcasting the search values,
+/// and comparing one unaligned block against them or against a second run. Registers cross these functions only
+/// through pointers, so MemoryExtensionsLaneKernels never holds a register in a call it makes.
+/// </summary>
+template <typename TLanes, typename TBits>
+struct MemoryExtensionsLaneBlocks {
+    using Register = typename TLanes::Register;
+
+    static constexpr int32_t Width = static_cast<int32_t>(sizeof(Register) / sizeof(TBits));
+
+    HE_CPP_SIMD_ALWAYS_INLINE static void Broadcast(const TBits* values, int32_t valueCount, Register* registers) {
+        alignas(sizeof(Register)) TBits lanes[Width];
+        for (int32_t valueIndex = 0; valueIndex < valueCount; ++valueIndex) {
+            for (int32_t laneIndex = 0; laneIndex < Width; ++laneIndex) {
+                lanes[laneIndex] = values[valueIndex];
+            }
+            registers[valueIndex] = TLanes::Load(lanes);
+        }
+    }
+
+    HE_CPP_SIMD_ALWAYS_INLINE static uint32_t MatchMask(const TBits* data, const Register* values, int32_t valueCount) {
+        Register block = TLanes::LoadUnaligned(data);
+        Register matches = TLanes::CompareEqual(block, values[0]);
+        for (int32_t valueIndex = 1; valueIndex < valueCount; ++valueIndex) {
+            matches = TLanes::Or(matches, TLanes::CompareEqual(block, values[valueIndex]));
+        }
+        return TLanes::MoveMask(matches);
+    }
+
+    HE_CPP_SIMD_ALWAYS_INLINE static uint32_t EqualMask(const TBits* left, const TBits* right) {
+        return TLanes::MoveMask(TLanes::CompareEqual(TLanes::LoadUnaligned(left), TLanes::LoadUnaligned(right)));
+    }
+};
+
+#if HE_CPP_SIMD_AVX2_DISPATCH
+/// <summary>
+/// The same blocks on the AVX2 lanes that builds dispatching at run time enter, compiled for AVX2 like AvxLanes
+/// itself. Only the HE_CPP_AVX2_TARGET entry points in MemoryExtensionsKernels reach them.
+/// </summary>
+template <typename TBits>
+struct MemoryExtensionsLaneBlocks<AvxLanes<TBits>, TBits> {
+    using Lanes = AvxLanes<TBits>;
+    using Register = typename Lanes::Register;
+
+    static constexpr int32_t Width = static_cast<int32_t>(sizeof(Register) / sizeof(TBits));
+
+    HE_CPP_AVX2_TARGET static void Broadcast(const TBits* values, int32_t valueCount, Register* registers) {
+        alignas(sizeof(Register)) TBits lanes[Width];
+        for (int32_t valueIndex = 0; valueIndex < valueCount; ++valueIndex) {
+            for (int32_t laneIndex = 0; laneIndex < Width; ++laneIndex) {
+                lanes[laneIndex] = values[valueIndex];
+            }
+            registers[valueIndex] = Lanes::Load(lanes);
+        }
+    }
+
+    HE_CPP_AVX2_TARGET static uint32_t MatchMask(const TBits* data, const Register* values, int32_t valueCount) {
+        Register block = Lanes::LoadUnaligned(data);
+        Register matches = Lanes::CompareEqual(block, values[0]);
+        for (int32_t valueIndex = 1; valueIndex < valueCount; ++valueIndex) {
+            matches = Lanes::Or(matches, Lanes::CompareEqual(block, values[valueIndex]));
+        }
+        return Lanes::MoveMask(matches);
+    }
+
+    HE_CPP_AVX2_TARGET static uint32_t EqualMask(const TBits* left, const TBits* right) {
+        return Lanes::MoveMask(Lanes::CompareEqual(Lanes::LoadUnaligned(left), Lanes::LoadUnaligned(right)));
+    }
+};
+#endif
+
+/// <summary>
+/// Register kernels behind MemoryExtensions for lanes of <typeparamref name="TBits"/> on one backend: each step
+/// compares a whole register and turns the lane mask into an index with one bit scan, and the tail that does not fill
+/// a register runs the same test one element at a time.
+/// </summary>
+template <template <typename> class TLanes, typename TBits>
+struct MemoryExtensionsLaneKernels {
+    using Blocks = MemoryExtensionsLaneBlocks<TLanes<TBits>, TBits>;
+    using Register = typename Blocks::Register;
+
+    static constexpr int32_t Width = Blocks::Width;
+    static constexpr uint32_t FullMask = Width == 32 ? 0xFFFFFFFFu : ((1u << Width) - 1u);
+
+    static constexpr int32_t MaxValueCount = 5;
+
+    HE_CPP_SIMD_ALWAYS_INLINE static bool MatchesAny(TBits element, const TBits* values, int32_t valueCount) {
+        for (int32_t valueIndex = 0; valueIndex < valueCount; ++valueIndex) {
+            if (element == values[valueIndex]) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    HE_CPP_SIMD_ALWAYS_INLINE static int32_t IndexOfAny(const TBits* data, int32_t length, const TBits* values, int32_t valueCount) {
+        Register registers[MaxValueCount];
+        Blocks::Broadcast(values, valueCount, registers);
+
+        int32_t index = 0;
+        for (; length - index >= Width; index += Width) {
+            uint32_t mask = Blocks::MatchMask(data + index, registers, valueCount);
+            if (mask != 0u) {
+                return index + BitOperations::TrailingZeroCount(mask);
+            }
+        }
+
+        for (; index < length; ++index) {
+            if (MatchesAny(data[index], values, valueCount)) {
+                return index;
+            }
+        }
+        return -1;
+    }
+
+    HE_CPP_SIMD_ALWAYS_INLINE static int32_t LastIndexOfAny(const TBits* data, int32_t length, const TBits* values, int32_t valueCount) {
+        Register registers[MaxValueCount];
+        Blocks::Broadcast(values, valueCount, registers);
+
+        int32_t index = length;
+        for (; index >= Width; index -= Width) {
+            uint32_t mask = Blocks::MatchMask(data + index - Width, registers, valueCount);
+            if (mask != 0u) {
+                return index - Width + 31 - BitOperations::LeadingZeroCount(mask);
+            }
+        }
+
+        while (index > 0) {
+            --index;
+            if (MatchesAny(data[index], values, valueCount)) {
+                return index;
+            }
+        }
+        return -1;
+    }
+
+    /// <summary>
+    /// Returns the first index where the two runs differ, or <paramref name="length"/> when they are equal.
+    /// </summary>
+    HE_CPP_SIMD_ALWAYS_INLINE static int32_t Mismatch(const TBits* left, const TBits* right, int32_t length) {
+        int32_t index = 0;
+        for (; length - index >= Width; index += Width) {
+            uint32_t equal = Blocks::EqualMask(left + index, right + index);
+            if (equal != FullMask) {
+                return index + BitOperations::TrailingZeroCount(~equal & FullMask);
+            }
+        }
+
+        for (; index < length; ++index) {
+            if (left[index] != right[index]) {
+                return index;
+            }
+        }
+        return length;
+    }
+};
+
+/// <summary>
+/// Picks the register kernels for each search: the widest backend the compile target has for
+/// <typeparamref name="TBits"/>, or the AVX2 kernels when a build that dispatches at run time finds AVX2, which it
+/// enters through the HE_CPP_AVX2_TARGET functions below so their register work compiles for AVX2. Lane types no
+/// backend compares return false, leaving the caller's scalar loop.
+/// </summary>
+template <typename TBits>
+class MemoryExtensionsKernels {
+    static constexpr bool UsesWideLanes = Vector256Lanes<TBits>::Supports(VectorLaneOperation::CompareEqual);
+    static constexpr bool UsesLanes = Vector128Lanes<TBits>::Supports(VectorLaneOperation::CompareEqual);
+
+#if HE_CPP_SIMD_AVX2_DISPATCH
+    using DispatchKernels = MemoryExtensionsLaneKernels<Vector256DispatchLanes, TBits>;
+
+    HE_CPP_AVX2_TARGET static int32_t IndexOfAnyAvx2(const TBits* data, int32_t length, const TBits* values, int32_t valueCount) {
+        return DispatchKernels::IndexOfAny(data, length, values, valueCount);
+    }
+
+    HE_CPP_AVX2_TARGET static int32_t LastIndexOfAnyAvx2(const TBits* data, int32_t length, const TBits* values, int32_t valueCount) {
+        return DispatchKernels::LastIndexOfAny(data, length, values, valueCount);
+    }
+
+    HE_CPP_AVX2_TARGET static int32_t MismatchAvx2(const TBits* left, const TBits* right, int32_t length) {
+        return DispatchKernels::Mismatch(left, right, length);
+    }
+
+    static bool UsesDispatchLanes() {
+        return Vector256DispatchLanes<TBits>::Supports(VectorLaneOperation::CompareEqual) && CpuFeatures::HasAvx2();
+    }
+#endif
+
+public:
+    static constexpr bool Enabled = UsesWideLanes || UsesLanes;
+
+    /// <summary>
+    /// Most values IndexOfAny compares in registers; longer value sets scan one element at a time.
+    /// </summary>
+    static constexpr int32_t MaxValueCount = 5;
+
+    static int32_t IndexOfAny(const TBits* data, int32_t length, const TBits* values, int32_t valueCount) {
+#if HE_CPP_SIMD_AVX2_DISPATCH
+        if (UsesDispatchLanes()) {
+            return IndexOfAnyAvx2(data, length, values, valueCount);
+        }
+#endif
+        if constexpr (UsesWideLanes) {
+            return MemoryExtensionsLaneKernels<Vector256Lanes, TBits>::IndexOfAny(data, length, values, valueCount);
+        } else {
+            return MemoryExtensionsLaneKernels<Vector128Lanes, TBits>::IndexOfAny(data, length, values, valueCount);
+        }
+    }
+
+    static int32_t LastIndexOfAny(const TBits* data, int32_t length, const TBits* values, int32_t valueCount) {
+#if HE_CPP_SIMD_AVX2_DISPATCH
+        if (UsesDispatchLanes()) {
+            return LastIndexOfAnyAvx2(data, length, values, valueCount);
+        }
+#endif
+        if constexpr (UsesWideLanes) {
+            return MemoryExtensionsLaneKernels<Vector256Lanes, TBits>::LastIndexOfAny(data, length, values, valueCount);
+        } else {
+            return MemoryExtensionsLaneKernels<Vector128Lanes, TBits>::LastIndexOfAny(data, length, values, valueCount);
+        }
+    }
+
+    static int32_t Mismatch(const TBits* left, const TBits* right, int32_t length) {
+#if HE_CPP_SIMD_AVX2_DISPATCH
+        if (UsesDispatchLanes()) {
+            return MismatchAvx2(left, right, length);
+        }
+#endif
+        if constexpr (UsesWideLanes) {
+            return MemoryExtensionsLaneKernels<Vector256Lanes, TBits>::Mismatch(left, right, length);
+        } else {
+            return MemoryExtensionsLaneKernels<Vector128Lanes, TBits>::Mismatch(left, right, length);
+        }
+    }
+};
+
+/// <summary>
+/// Reverses the lanes of one 128-bit register of <typeparamref name="TBits"/>, for MemoryExtensions.Reverse. Lane sizes
+/// without a shuffle sequence here report Enabled as false.
+/// </summary>
+template <typename TBits>
+struct MemoryExtensionsReverseLanes {
+#if HE_CPP_SIMD_SSE2
+    static constexpr bool Enabled = true;
+    static constexpr int32_t Width = static_cast<int32_t>(16 / sizeof(TBits));
+
+    static void ReverseBlock(const TBits* source, TBits* destination) {
+        __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+        if constexpr (sizeof(TBits) == 1) {
+            value = _mm_or_si128(_mm_slli_epi16(value, 8), _mm_srli_epi16(value, 8));
+        }
+        if constexpr (sizeof(TBits) <= 2) {
+            value = _mm_shufflelo_epi16(value, _MM_SHUFFLE(0, 1, 2, 3));
+            value = _mm_shufflehi_epi16(value, _MM_SHUFFLE(0, 1, 2, 3));
+            value = _mm_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2));
+        } else if constexpr (sizeof(TBits) == 4) {
+            value = _mm_shuffle_epi32(value, _MM_SHUFFLE(0, 1, 2, 3));
+        } else {
+            value = _mm_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), value);
+    }
+#elif HE_CPP_SIMD_NEON
+    static constexpr bool Enabled = true;
+    static constexpr int32_t Width = static_cast<int32_t>(16 / sizeof(TBits));
+
+    static void ReverseBlock(const TBits* source, TBits* destination) {
+        uint8x16_t value = vld1q_u8(reinterpret_cast<const uint8_t*>(source));
+        if constexpr (sizeof(TBits) == 1) {
+            value = vrev64q_u8(value);
+        } else if constexpr (sizeof(TBits) == 2) {
+            value = vreinterpretq_u8_u16(vrev64q_u16(vreinterpretq_u16_u8(value)));
+        } else if constexpr (sizeof(TBits) == 4) {
+            value = vreinterpretq_u8_u32(vrev64q_u32(vreinterpretq_u32_u8(value)));
+        }
+        vst1q_u8(reinterpret_cast<uint8_t*>(destination), vextq_u8(value, value, 8));
+    }
+#else
+    static constexpr bool Enabled = false;
+#endif
+};
+
+/// <summary>
+/// Managed System.MemoryExtensions over spans and arrays. Searches, comparisons, and Reverse on integer, character,
+/// Boolean, and enum elements compare their bit patterns in SSE2/AVX2/NEON registers; floating-point elements keep the
+/// managed Equals and CompareTo semantics (NaN equals NaN, and -0.0 equals 0.0) and, like other elements, run the
+/// scalar loops.
+/// </summary>
+class MemoryExtensions {
+    template <typename TSpan>
+    using ElementOf = typename MemoryExtensionsSpan<TSpan>::Element;
+
+    template <typename T>
+    static constexpr bool ComparesBits = (std::is_integral_v<T> || std::is_enum_v<T>) &&
+        (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+    template <typename T>
+    using Bits = VectorLaneBits<T>;
+
+    template <typename T>
+    static const Bits<T>* AsBits(const T* data) {
+        return reinterpret_cast<const Bits<T>*>(data);
+    }
+
+    template <typename T>
+    static bool ElementEquals(const T& left, const T& right) {
+        if constexpr (std::is_floating_point_v<T>) {
+            return left == right || (left != left && right != right);
+        } else if constexpr (std::is_pointer_v<T> || std::is_arithmetic_v<T> || std::is_enum_v<T>) {
+            return left == right;
+        } else if constexpr (requires(const T& a, const T& b) { a.Equals(b); }) {
+            return left.Equals(right);
+        } else {
+            return left == right;
+        }
+    }
+
+    template <typename T>
+    static int32_t ElementCompare(const T& left, const T& right) {
+        if constexpr (std::is_floating_point_v<T>) {
+            if (left < right) {
+                return -1;
+            }
+            if (left > right) {
+                return 1;
+            }
+            if (left == right) {
+                return 0;
+            }
+            return left != left ? (right != right ? 0 : -1) : 1;
+        } else if constexpr (std::is_integral_v<T> && sizeof(T) < sizeof(int32_t)) {
+            return static_cast<int32_t>(left) - static_cast<int32_t>(right);
+        } else if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>) {
+            return left < right ? -1 : (right < left ? 1 : 0);
+        } else if constexpr (std::is_pointer_v<T>) {
+            if (left == nullptr) {
+                return right == nullptr ? 0 : -1;
+            }
+            return left->CompareTo(right);
+        } else {
+            return left.CompareTo(right);
+        }
+    }
+
+    template <typename T>
+    static int32_t IndexOfAny(const T* data, int32_t length, const T* values, int32_t valueCount) {
+        if constexpr (ComparesBits<T> && MemoryExtensionsKernels<Bits<T>>::Enabled) {
+            if (valueCount > 0 && valueCount <= MemoryExtensionsKernels<Bits<T>>::MaxValueCount) {
+                return MemoryExtensionsKernels<Bits<T>>::IndexOfAny(AsBits(data), length, AsBits(values), valueCount);
+            }
+        }
+
+        for (int32_t index = 0; index < length; ++index) {
+            for (int32_t valueIndex = 0; valueIndex < valueCount; ++valueIndex) {
+                if (ElementEquals(data[index], values[valueIndex])) {
+                    return index;
+                }
+            }
+        }
+        return -1;
+    }
+
+    template <typename T>
+    static int32_t LastIndexOfAny(const T* data, int32_t length, const T* values, int32_t valueCount) {
+        if constexpr (ComparesBits<T> && MemoryExtensionsKernels<Bits<T>>::Enabled) {
+            if (valueCount > 0 && valueCount <= MemoryExtensionsKernels<Bits<T>>::MaxValueCount) {
+                return MemoryExtensionsKernels<Bits<T>>::LastIndexOfAny(AsBits(data), length, AsBits(values), valueCount);
+            }
+        }
+
+        for (int32_t index = length - 1; index >= 0; --index) {
+            for (int32_t valueIndex = 0; valueIndex < valueCount; ++valueIndex) {
+                if (ElementEquals(data[index], values[valueIndex])) {
+                    return index;
+                }
+            }
+        }
+        return -1;
+    }
+
+    template <typename T>
+    static int32_t Mismatch(const T* left, const T* right, int32_t length) {
+        if constexpr (ComparesBits<T> && MemoryExtensionsKernels<Bits<T>>::Enabled) {
+            return MemoryExtensionsKernels<Bits<T>>::Mismatch(AsBits(left), AsBits(right), length);
+        } else {
+            for (int32_t index = 0; index < length; ++index) {
+                if (!ElementEquals(left[index], right[index])) {
+                    return index;
+                }
+            }
+            return length;
+        }
+    }
+
+    template <typename T>
+    static int32_t IndexOfSequence(const T* data, int32_t length, const T* value, int32_t valueLength) {
+        if (valueLength == 0) {
+            return 0;
+        }
+
+        int32_t start = 0;
+        int32_t lastStart = length - valueLength;
+        while (start <= lastStart) {
+            int32_t found = IndexOfAny(data + start, lastStart - start + 1, value, 1);
+            if (found < 0) {
+                return -1;
+            }
+
+            start += found;
+            if (Mismatch(data + start + 1, value + 1, valueLength - 1) == valueLength - 1) {
+                return start;
+            }
+            ++start;
+        }
+        return -1;
+    }
+
+public:
+    template <typename T>
+    static Span<T> AsSpan(Array<T>* array) {
+        return Span<T>(array);
+    }
+
+    template <typename T>
+    static Span<T> AsSpan(Array<T>* array, int32_t start) {
+        int32_t length = array != nullptr ? array->Length : 0;
+        if (start < 0 || start > length) {
+            throw ArgumentOutOfRangeException("start");
+        }
+        return Span<T>(array, static_cast<size_t>(start), static_cast<size_t>(length - start));
+    }
+
+    template <typename T>
+    static Span<T> AsSpan(Array<T>* array, int32_t start, int32_t length) {
+        int32_t arrayLength = array != nullptr ? array->Length : 0;
+        if (start < 0 || length < 0 || start > arrayLength - length) {
+            throw ArgumentOutOfRangeException(start < 0 || start > arrayLength ? "start" : "length");
+        }
+        return Span<T>(array, static_cast<size_t>(start), static_cast<size_t>(length));
+    }
+
+    template <typename TSpan>
+    static int32_t IndexOf(const TSpan& span, const ElementOf<TSpan>& value) {
+        return IndexOfAny(MemoryExtensionsSpan<TSpan>::Data(span), MemoryExtensionsSpan<TSpan>::Length(span), &value, 1);
+    }
+
+    template <typename TSpan, typename TValues, typename = typename MemoryExtensionsSpan<TValues>::Element>
+    static int32_t IndexOf(const TSpan& span, const TValues& value) {
+        return IndexOfSequence(
+            MemoryExtensionsSpan<TSpan>::Data(span),
+            MemoryExtensionsSpan<TSpan>::Length(span),
+            MemoryExtensionsSpan<TValues>::Data(value),
+            MemoryExtensionsSpan<TValues>::Length(value));
+    }
+
+    template <typename TSpan>
+    static int32_t LastIndexOf(const TSpan& span, const ElementOf<TSpan>& value) {
+        return LastIndexOfAny(MemoryExtensionsSpan<TSpan>::Data(span), MemoryExtensionsSpan<TSpan>::Length(span), &value, 1);
+    }
+
+    template <typename TSpan>
+    static bool Contains(const TSpan& span, const ElementOf<TSpan>& value) {
+        return IndexOf(span, value) >= 0;
+    }
+
+    template <typename TSpan>
+    static int32_t IndexOfAny(const TSpan& span, const ElementOf<TSpan>& value0, const ElementOf<TSpan>& value1) {
+        ElementOf<TSpan> values[] = { value0, value1 };
+        return IndexOfAny(MemoryExtensionsSpan<TSpan>::Data(span), MemoryExtensionsSpan<TSpan>::Length(span), values, 2);
+    }
+
+    template <typename TSpan>
+    static int32_t IndexOfAny(const TSpan& span, const ElementOf<TSpan>& value0, const ElementOf<TSpan>& value1, const ElementOf<TSpan>& value2) {
+        ElementOf<TSpan> values[] = { value0, value1, value2 };
+        return IndexOfAny(MemoryExtensionsSpan<TSpan>::Data(span), MemoryExtensionsSpan<TSpan>::Length(span), values, 3);
+    }
+
+    template <typename TSpan, typename TValues, typename = typename MemoryExtensionsSpan<TValues>::Element>
+    static int32_t IndexOfAny(const TSpan& span, const TValues& values) {
+        return IndexOfAny(
+            MemoryExtensionsSpan<TSpan>::Data(span),
+            MemoryExtensionsSpan<TSpan>::Length(span),
+            MemoryExtensionsSpan<TValues>::Data(values),
+            MemoryExtensionsSpan<TValues>::Length(values));
+    }
+
+    template <typename TSpan>
+    static int32_t LastIndexOfAny(const TSpan& span, const ElementOf<TSpan>& value0, const ElementOf<TSpan>& value1) {
+        ElementOf<TSpan> values[] = { value0, value1 };
+        return LastIndexOfAny(MemoryExtensionsSpan<TSpan>::Data(span), MemoryExtensionsSpan<TSpan>::Length(span), values, 2);
+    }
+
+    template <typename TSpan, typename TValues, typename = typename MemoryExtensionsSpan<TValues>::Element>
+    static int32_t LastIndexOfAny(const TSpan& span, const TValues& values) {
+        return LastIndexOfAny(
+            MemoryExtensionsSpan<TSpan>::Data(span),
+            MemoryExtensionsSpan<TSpan>::Length(span),
+            MemoryExtensionsSpan<TValues>::Data(values),
+            MemoryExtensionsSpan<TValues>::Length(values));
+    }
+
+    template <typename TSpan>
+    static bool ContainsAny(const TSpan& span, const ElementOf<TSpan>& value0, const ElementOf<TSpan>& value1) {
+        return IndexOfAny(span, value0, value1) >= 0;
+    }
+
+    template <typename TSpan>
+    static bool ContainsAny(const TSpan& span, const ElementOf<TSpan>& value0, const ElementOf<TSpan>& value1, const ElementOf<TSpan>& value2) {
+        return IndexOfAny(span, value0, value1, value2) >= 0;
+    }
+
+    template <typename TSpan, typename TValues, typename = typename MemoryExtensionsSpan<TValues>::Element>
+    static bool ContainsAny(const TSpan& span, const TValues& values) {
+        return IndexOfAny(span, values) >= 0;
+    }
+
+    template <typename TSpan, typename TOther>
+    static bool SequenceEqual(const TSpan& span, const TOther& other) {
+        int32_t length = MemoryExtensionsSpan<TSpan>::Length(span);
+        if (length != MemoryExtensionsSpan<TOther>::Length(other)) {
+            return false;
+        }
+        return Mismatch(MemoryExtensionsSpan<TSpan>::Data(span), MemoryExtensionsSpan<TOther>::Data(other), length) == length;
+    }
+
+    template <typename TSpan, typename TOther>
+    static int32_t SequenceCompareTo(const TSpan& span, const TOther& other) {
+        int32_t length = MemoryExtensionsSpan<TSpan>::Length(span);
+        int32_t otherLength = MemoryExtensionsSpan<TOther>::Length(other);
+        int32_t sharedLength = std::min(length, otherLength);
+        auto* data = MemoryExtensionsSpan<TSpan>::Data(span);
+        auto* otherData = MemoryExtensionsSpan<TOther>::Data(other);
+        int32_t index = Mismatch(data, otherData, sharedLength);
+        if (index < sharedLength) {
+            int32_t result = ElementCompare(data[index], otherData[index]);
+            if (result != 0) {
+                return result;
+            }
+
+            // Elements whose equality and ordering disagree reach here, such as distinct object pointers that
+            // CompareTo ranks equal or user types whose Equals is stricter than CompareTo; keep comparing.
+            for (++index; index < sharedLength; ++index) {
+                result = ElementCompare(data[index], otherData[index]);
+                if (result != 0) {
+                    return result;
+                }
+            }
+        }
+        return length < otherLength ? -1 : (length > otherLength ? 1 : 0);
+    }
+
+    template <typename TSpan, typename TOther>
+    static bool StartsWith(const TSpan& span, const TOther& value) {
+        int32_t valueLength = MemoryExtensionsSpan<TOther>::Length(value);
+        return valueLength <= MemoryExtensionsSpan<TSpan>::Length(span) &&
+            Mismatch(MemoryExtensionsSpan<TSpan>::Data(span), MemoryExtensionsSpan<TOther>::Data(value), valueLength) == valueLength;
+    }
+
+    template <typename TSpan, typename TOther>
+    static bool EndsWith(const TSpan& span, const TOther& value) {
+        int32_t length = MemoryExtensionsSpan<TSpan>::Length(span);
+        int32_t valueLength = MemoryExtensionsSpan<TOther>::Length(value);
+        return valueLength <= length &&
+            Mismatch(MemoryExtensionsSpan<TSpan>::Data(span) + (length - valueLength), MemoryExtensionsSpan<TOther>::Data(value), valueLength) == valueLength;
+    }
+
+    template <typename TSpan>
+    static void Reverse(const TSpan& span) {
+        using T = ElementOf<TSpan>;
+        T* data = MemoryExtensionsSpan<TSpan>::Data(span);
+        int32_t left = 0;
+        int32_t right = MemoryExtensionsSpan<TSpan>::Length(span);
+        if constexpr (std::is_trivially_copyable_v<T> && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)) {
+            using ReverseLanes = MemoryExtensionsReverseLanes<Bits<T>>;
+            if constexpr (ReverseLanes::Enabled) {
+                Bits<T>* bits = reinterpret_cast<Bits<T>*>(data);
+                Bits<T> front[ReverseLanes::Width];
+                Bits<T> back[ReverseLanes::Width];
+                for (; right - left >= 2 * ReverseLanes::Width; left += ReverseLanes::Width, right -= ReverseLanes::Width) {
+                    ReverseLanes::ReverseBlock(bits + left, front);
+                    ReverseLanes::ReverseBlock(bits + right - ReverseLanes::Width, back);
+                    std::copy(back, back + ReverseLanes::Width, bits + left);
+                    std::copy(front, front + ReverseLanes::Width, bits + right - ReverseLanes::Width);
+                }
+            }
+        }
+        std::reverse(data + left, data + right);
+    }
+};
@@ -1,9 +1,119 @@
 #pragma once
 
+#include "../runtime/array.hpp"
+#include <cstdint>
+#include <utility>
+
 /// <summary>
-/// Provides a lightweight base type for generated managed delegate declarations.
+/// Provides a lightweight base type for generated managed delegate declarations, plus the combine, remove, and
+/// invocation-list operations shared by Action, Func, and generated delegate aliases. Delegates are immutable, so
+/// combining or removing returns a new delegate whose invocation list shares storage with its operands where possible.
 /// </summary>
 class MulticastDelegate {
+private:
+    /// <summary>
+    /// Keeps the second operand out of template deduction so the first operand alone decides the delegate type.
+    /// </summary>
+    template <typename T>
+    struct Identity {
+        using Type = T;
+    };
+
 public:
     virtual ~MulticastDelegate() = default;
+
+    /// <summary>
+    /// Returns a delegate that invokes <paramref name="first"/> followed by <paramref name="second"/>; a null
+    /// operand yields the other operand unchanged.
+    /// </summary>
+    template <typename TDelegate>
+    static TDelegate* Combine(TDelegate* first, typename Identity<TDelegate>::Type* second) {
+        if (second == nullptr) {
+            return first;
+        }
+
+        if (first == nullptr) {
+            return second;
+        }
+
+        return Combine(first, *second);
+    }
+
+    /// <summary>
+    /// Returns a delegate that invokes <paramref name="first"/> followed by <paramref name="second"/>. The operand is
+    /// a temporary, such as a lowered lambda or method group, so only the combined result is allocated.
+    /// </summary>
+    template <typename TDelegate>
+    static TDelegate* Combine(TDelegate* first, const typename Identity<TDelegate>::Type& second) {
+        if (second.GetInvocationTargets().GetCount() == 0) {
+            return first;
+        }
+
+        if (first == nullptr) {
+            return new TDelegate(second);
+        }
+
+        using TInvocationList = typename TDelegate::InvocationListType;
+        return new TDelegate(TInvocationList::Combine(first->GetInvocationTargets(), second.GetInvocationTargets()));
+    }
+
+    /// <summary>
+    /// Returns <paramref name="source"/> without the last occurrence of <paramref name="value"/>'s invocation list,
+    /// null when nothing remains, or <paramref name="source"/> itself when <paramref name="value"/> is not found.
+    /// </summary>
+    template <typename TDelegate>
+    static TDelegate* Remove(TDelegate* source, typename Identity<TDelegate>::Type* value) {
+        if (source == nullptr || value == nullptr) {
+            return source;
+        }
+
+        return Remove(source, *value);
+    }
+
+    /// <summary>
+    /// Returns <paramref name="source"/> without the last occurrence of <paramref name="value"/>'s invocation list. The
+    /// operand is only compared, so lowered lambdas and method groups pass a stack temporary instead of allocating.
+    /// </summary>
+    template <typename TDelegate>
+    static TDelegate* Remove(TDelegate* source, const typename Identity<TDelegate>::Type& value) {
+        if (source == nullptr) {
+            return source;
+        }
+
+        using TInvocationList = typename TDelegate::InvocationListType;
+        const TInvocationList& sourceTargets = source->GetInvocationTargets();
+        TInvocationList remaining = TInvocationList::Remove(sourceTargets, value.GetInvocationTargets());
+        if (remaining.GetCount() == 0) {
+            return nullptr;
+        }
+
+        if (remaining.GetCount() == sourceTargets.GetCount()) {
+            return source;
+        }
+
+        return new TDelegate(std::move(remaining));
+    }
+
+    /// <summary>
+    /// Returns one single-target delegate per entry of <paramref name="value"/>'s invocation list, in invocation order.
+    /// </summary>
+    template <typename TDelegate>
+    static Array<TDelegate*>* GetInvocationList(const TDelegate* value) {
+        if (value == nullptr) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+            throw ArgumentNullException();
+#else
+            throw ArgumentNullException("value");
+#endif
+        }
+
+        using TInvocationList = typename TDelegate::InvocationListType;
+        const TInvocationList& targets = value->GetInvocationTargets();
+        Array<TDelegate*>* result = new Array<TDelegate*>(targets.GetCount());
+        for (int32_t index = 0; index < targets.GetCount(); ++index) {
+            result->Data[index] = new TDelegate(TInvocationList(targets[index]));
+        }
+
+        return result;
+    }
 };
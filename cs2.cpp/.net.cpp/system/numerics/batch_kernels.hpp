@@ -0,0 +1,446 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include "../../runtime/native_exceptions.hpp"
+#include "../../runtime/native_span.hpp"
+#include "system/numerics/vectors.hpp"
+#include "system/runtime/intrinsics/simd_dispatch.hpp"
+#include "system/runtime/intrinsics/vector256.hpp"
+
+/// <summary>
+/// Batch math kernels over structure-of-arrays spans, bound to converted C# methods marked [NativeBatchKernel]. Each
+/// kernel walks its spans eight elements at a time in Vector256&lt;float&gt; lanes; the last partial block is padded
+/// with zeros and only its live lanes are written back, so every element takes the same arithmetic path. Like the
+/// generated methods that branch on Avx2.IsSupported, each kernel is compiled as a baseline, an AVX2, and an AVX-512
+/// clone that SimdDispatch binds on first call, so the Vector256 operations inline for the machine's widest registers.
+/// </summary>
+class BatchKernels {
+    using Lanes = Vector256<float>;
+
+    static constexpr int32_t BlockSize = Lanes::LaneCount;
+
+    /// <summary>
+    /// One frustum plane broadcast across the lanes, with the absolute normal the box test projects extents onto.
+    /// </summary>
+    struct PlaneLanes {
+        Lanes NormalX;
+        Lanes NormalY;
+        Lanes NormalZ;
+        Lanes Distance;
+        Lanes AbsoluteNormalX;
+        Lanes AbsoluteNormalY;
+        Lanes AbsoluteNormalZ;
+    };
+
+    template <typename T>
+    static void RequireLength(const T& span, int32_t count, const char* parameterName) {
+        if (span.get_Length() < count) {
+            throw ArgumentOutOfRangeException(parameterName);
+        }
+    }
+
+    HE_CPP_SIMD_ALWAYS_INLINE static Lanes LoadBlock(const ReadOnlySpan<float>& source, int32_t index, int32_t laneCount) {
+        if (laneCount == BlockSize) {
+            return Vector256Runtime::Load(source.Data + index);
+        }
+
+        Lanes result;
+        for (int32_t laneIndex = 0; laneIndex < laneCount; ++laneIndex) {
+            result.Values[laneIndex] = source.Data[index + laneIndex];
+        }
+        return result;
+    }
+
+    HE_CPP_SIMD_ALWAYS_INLINE static void StoreBlock(const Lanes& value, const Span<float>& destination, int32_t index, int32_t laneCount) {
+        if (laneCount == BlockSize) {
+            Vector256Runtime::Store(value, destination.Data + index);
+            return;
+        }
+
+        for (int32_t laneIndex = 0; laneIndex < laneCount; ++laneIndex) {
+            destination.Data[index + laneIndex] = value.Values[laneIndex];
+        }
+    }
+
+    /// <summary>
+    /// Planes broadcast once per call into a stack array: the six of a view frustum. Further planes are broadcast again
+    /// for each block instead of growing the array on the heap.
+    /// </summary>
+    static constexpr int32_t BroadcastPlaneCapacity = 6;
+
+    HE_CPP_SIMD_ALWAYS_INLINE static PlaneLanes BroadcastPlane(const Plane& plane) {
+        PlaneLanes lanes;
+        lanes.NormalX = Lanes(plane.Normal.X);
+        lanes.NormalY = Lanes(plane.Normal.Y);
+        lanes.NormalZ = Lanes(plane.Normal.Z);
+        lanes.Distance = Lanes(plane.D);
+        lanes.AbsoluteNormalX = Lanes(std::fabs(plane.Normal.X));
+        lanes.AbsoluteNormalY = Lanes(std::fabs(plane.Normal.Y));
+        lanes.AbsoluteNormalZ = Lanes(std::fabs(plane.Normal.Z));
+        return lanes;
+    }
+
+    HE_CPP_SIMD_ALWAYS_INLINE static void BroadcastPlanes(const ReadOnlySpan<Plane>& planes, PlaneLanes (&broadcast)[BroadcastPlaneCapacity]) {
+        int32_t broadcastCount = std::min(planes.get_Length(), BroadcastPlaneCapacity);
+        for (int32_t planeIndex = 0; planeIndex < broadcastCount; ++planeIndex) {
+            broadcast[planeIndex] = BroadcastPlane(planes.Data[planeIndex]);
+        }
+    }
+
+    /// <summary>
+    /// Returns plane <paramref name="planeIndex"/> in lanes, from the broadcast array or, past its capacity, from
+    /// <paramref name="overflow"/>.
+    /// </summary>
+    HE_CPP_SIMD_ALWAYS_INLINE static const PlaneLanes& PlaneAt(const ReadOnlySpan<Plane>& planes, const PlaneLanes (&broadcast)[BroadcastPlaneCapacity], int32_t planeIndex, PlaneLanes& overflow) {
+        if (planeIndex < BroadcastPlaneCapacity) {
+            return broadcast[planeIndex];
+        }
+
+        overflow = BroadcastPlane(planes.Data[planeIndex]);
+        return overflow;
+    }
+
+    HE_CPP_SIMD_ALWAYS_INLINE static Lanes DistanceToPlane(const PlaneLanes& plane, const Lanes& x, const Lanes& y, const Lanes& z) {
+        return x * plane.NormalX + y * plane.NormalY + z * plane.NormalZ + plane.Distance;
+    }
+
+    /// <summary>
+    /// Clears the mask words that will receive <paramref name="count"/> visibility bits.
+    /// </summary>
+    static void ClearMask(const Span<uint32_t>& visibleMask, int32_t count) {
+        int32_t wordCount = (count + 31) / 32;
+        RequireLength(visibleMask, wordCount, "visibleMask");
+        for (int32_t wordIndex = 0; wordIndex < wordCount; ++wordIndex) {
+            visibleMask.Data[wordIndex] = 0u;
+        }
+    }
+
+    /// <summary>
+    /// Sets the visibility bits of one block from the lanes the planes rejected and returns how many stayed visible.
+    /// </summary>
+    HE_CPP_SIMD_ALWAYS_INLINE static int32_t WriteVisibleBits(const Lanes& culled, const Span<uint32_t>& visibleMask, int32_t index, int32_t laneCount) {
+        uint32_t liveLanes = (1u << laneCount) - 1u;
+        uint32_t visible = ~Vector256Runtime::ExtractMostSignificantBits(culled) & liveLanes;
+        visibleMask.Data[index / 32] |= visible << (index % 32);
+
+        int32_t visibleCount = 0;
+        while (visible != 0u) {
+            visible &= visible - 1u;
+            ++visibleCount;
+        }
+        return visibleCount;
+    }
+
+    HE_CPP_SIMD_ALWAYS_INLINE static void ComposeTransformsLanes(
+        const ReadOnlySpan<float>& positionX,
+        const ReadOnlySpan<float>& positionY,
+        const ReadOnlySpan<float>& positionZ,
+        const ReadOnlySpan<float>& rotationX,
+        const ReadOnlySpan<float>& rotationY,
+        const ReadOnlySpan<float>& rotationZ,
+        const ReadOnlySpan<float>& rotationW,
+        const ReadOnlySpan<float>& scaleX,
+        const ReadOnlySpan<float>& scaleY,
+        const ReadOnlySpan<float>& scaleZ,
+        const Span<Matrix4x4>& destination) {
+        int32_t count = positionX.get_Length();
+        RequireLength(positionY, count, "positionY");
+        RequireLength(positionZ, count, "positionZ");
+        RequireLength(rotationX, count, "rotationX");
+        RequireLength(rotationY, count, "rotationY");
+        RequireLength(rotationZ, count, "rotationZ");
+        RequireLength(rotationW, count, "rotationW");
+        RequireLength(scaleX, count, "scaleX");
+        RequireLength(scaleY, count, "scaleY");
+        RequireLength(scaleZ, count, "scaleZ");
+        RequireLength(destination, count, "destination");
+
+        Lanes one(1.0f);
+        Lanes two(2.0f);
+        for (int32_t index = 0; index < count; index += BlockSize) {
+            int32_t laneCount = std::min(BlockSize, count - index);
+            Lanes x = LoadBlock(rotationX, index, laneCount);
+            Lanes y = LoadBlock(rotationY, index, laneCount);
+            Lanes z = LoadBlock(rotationZ, index, laneCount);
+            Lanes w = LoadBlock(rotationW, index, laneCount);
+            Lanes sx = LoadBlock(scaleX, index, laneCount);
+            Lanes sy = LoadBlock(scaleY, index, laneCount);
+            Lanes sz = LoadBlock(scaleZ, index, laneCount);
+
+            Lanes xx = x * x;
+            Lanes yy = y * y;
+            Lanes zz = z * z;
+            Lanes xy = x * y;
+            Lanes wz = z * w;
+            Lanes xz = z * x;
+            Lanes wy = y * w;
+            Lanes yz = y * z;
+            Lanes wx = x * w;
+
+            Lanes m11 = (one - two * (yy + zz)) * sx;
+            Lanes m12 = two * (xy + wz) * sx;
+            Lanes m13 = two * (xz - wy) * sx;
+            Lanes m21 = two * (xy - wz) * sy;
+            Lanes m22 = (one - two * (zz + xx)) * sy;
+            Lanes m23 = two * (yz + wx) * sy;
+            Lanes m31 = two * (xz + wy) * sz;
+            Lanes m32 = two * (yz - wx) * sz;
+            Lanes m33 = (one - two * (yy + xx)) * sz;
+
+            for (int32_t laneIndex = 0; laneIndex < laneCount; ++laneIndex) {
+                int32_t transformIndex = index + laneIndex;
+                destination.Data[transformIndex] = Matrix4x4(
+                    m11.Values[laneIndex], m12.Values[laneIndex], m13.Values[laneIndex], 0.0f,
+                    m21.Values[laneIndex], m22.Values[laneIndex], m23.Values[laneIndex], 0.0f,
+                    m31.Values[laneIndex], m32.Values[laneIndex], m33.Values[laneIndex], 0.0f,
+                    positionX.Data[transformIndex], positionY.Data[transformIndex], positionZ.Data[transformIndex], 1.0f);
+            }
+        }
+    }
+
+    HE_CPP_SIMD_ALWAYS_INLINE static void ComposeHierarchyLanes(
+        const ReadOnlySpan<Matrix4x4>& local,
+        const ReadOnlySpan<int32_t>& parentIndices,
+        const Span<Matrix4x4>& world) {
+        int32_t count = local.get_Length();
+        RequireLength(parentIndices, count, "parentIndices");
+        RequireLength(world, count, "world");
+
+        for (int32_t index = 0; index < count; ++index) {
+            int32_t parentIndex = parentIndices.Data[index];
+            if (parentIndex < 0) {
+                world.Data[index] = local.Data[index];
+            } else if (parentIndex < index) {
+                world.Data[index] = Matrix4x4::Multiply(local.Data[index], world.Data[parentIndex]);
+            } else {
+                throw ArgumentOutOfRangeException("parentIndices");
+            }
+        }
+    }
+
+    HE_CPP_SIMD_ALWAYS_INLINE static void TransformPointsLanes(
+        const Matrix4x4& matrix,
+        const ReadOnlySpan<float>& x,
+        const ReadOnlySpan<float>& y,
+        const ReadOnlySpan<float>& z,
+        const Span<float>& destinationX,
+        const Span<float>& destinationY,
+        const Span<float>& destinationZ) {
+        int32_t count = x.get_Length();
+        RequireLength(y, count, "y");
+        RequireLength(z, count, "z");
+        RequireLength(destinationX, count, "destinationX");
+        RequireLength(destinationY, count, "destinationY");
+        RequireLength(destinationZ, count, "destinationZ");
+
+        Lanes m11(matrix.M11);
+        Lanes m12(matrix.M12);
+        Lanes m13(matrix.M13);
+        Lanes m21(matrix.M21);
+        Lanes m22(matrix.M22);
+        Lanes m23(matrix.M23);
+        Lanes m31(matrix.M31);
+        Lanes m32(matrix.M32);
+        Lanes m33(matrix.M33);
+        Lanes m41(matrix.M41);
+        Lanes m42(matrix.M42);
+        Lanes m43(matrix.M43);
+        for (int32_t index = 0; index < count; index += BlockSize) {
+            int32_t laneCount = std::min(BlockSize, count - index);
+            Lanes px = LoadBlock(x, index, laneCount);
+            Lanes py = LoadBlock(y, index, laneCount);
+            Lanes pz = LoadBlock(z, index, laneCount);
+            StoreBlock(px * m11 + py * m21 + pz * m31 + m41, destinationX, index, laneCount);
+            StoreBlock(px * m12 + py * m22 + pz * m32 + m42, destinationY, index, laneCount);
+            StoreBlock(px * m13 + py * m23 + pz * m33 + m43, destinationZ, index, laneCount);
+        }
+    }
+
+    HE_CPP_SIMD_ALWAYS_INLINE static int32_t CullSpheresLanes(
+        const ReadOnlySpan<Plane>& planes,
+        const ReadOnlySpan<float>& centerX,
+        const ReadOnlySpan<float>& centerY,
+        const ReadOnlySpan<float>& centerZ,
+        const ReadOnlySpan<float>& radius,
+        const Span<uint32_t>& visibleMask) {
+        int32_t count = centerX.get_Length();
+        RequireLength(centerY, count, "centerY");
+        RequireLength(centerZ, count, "centerZ");
+        RequireLength(radius, count, "radius");
+        ClearMask(visibleMask, count);
+
+        PlaneLanes planeLanes[BroadcastPlaneCapacity];
+        BroadcastPlanes(planes, planeLanes);
+        PlaneLanes overflowPlane;
+        Lanes zero;
+        int32_t visibleCount = 0;
+        for (int32_t index = 0; index < count; index += BlockSize) {
+            int32_t laneCount = std::min(BlockSize, count - index);
+            Lanes x = LoadBlock(centerX, index, laneCount);
+            Lanes y = LoadBlock(centerY, index, laneCount);
+            Lanes z = LoadBlock(centerZ, index, laneCount);
+            Lanes negativeRadius = zero - LoadBlock(radius, index, laneCount);
+
+            Lanes culled;
+            for (int32_t planeIndex = 0; planeIndex < planes.get_Length(); ++planeIndex) {
+                const PlaneLanes& plane = PlaneAt(planes, planeLanes, planeIndex, overflowPlane);
+                culled = Vector256Runtime::BitwiseOr(culled, Vector256Runtime::LessThan(DistanceToPlane(plane, x, y, z), negativeRadius));
+            }
+            visibleCount += WriteVisibleBits(culled, visibleMask, index, laneCount);
+        }
+        return visibleCount;
+    }
+
+    HE_CPP_SIMD_ALWAYS_INLINE static int32_t CullAabbsLanes(
+        const ReadOnlySpan<Plane>& planes,
+        const ReadOnlySpan<float>& centerX,
+        const ReadOnlySpan<float>& centerY,
+        const ReadOnlySpan<float>& centerZ,
+        const ReadOnlySpan<float>& extentX,
+        const ReadOnlySpan<float>& extentY,
+        const ReadOnlySpan<float>& extentZ,
+        const Span<uint32_t>& visibleMask) {
+        int32_t count = centerX.get_Length();
+        RequireLength(centerY, count, "centerY");
+        RequireLength(centerZ, count, "centerZ");
+        RequireLength(extentX, count, "extentX");
+        RequireLength(extentY, count, "extentY");
+        RequireLength(extentZ, count, "extentZ");
+        ClearMask(visibleMask, count);
+
+        PlaneLanes planeLanes[BroadcastPlaneCapacity];
+        BroadcastPlanes(planes, planeLanes);
+        PlaneLanes overflowPlane;
+        Lanes zero;
+        int32_t visibleCount = 0;
+        for (int32_t index = 0; index < count; index += BlockSize) {
+            int32_t laneCount = std::min(BlockSize, count - index);
+            Lanes x = LoadBlock(centerX, index, laneCount);
+            Lanes y = LoadBlock(centerY, index, laneCount);
+            Lanes z = LoadBlock(centerZ, index, laneCount);
+            Lanes ex = LoadBlock(extentX, index, laneCount);
+            Lanes ey = LoadBlock(extentY, index, laneCount);
+            Lanes ez = LoadBlock(extentZ, index, laneCount);
+
+            Lanes culled;
+            for (int32_t planeIndex = 0; planeIndex < planes.get_Length(); ++planeIndex) {
+                const PlaneLanes& plane = PlaneAt(planes, planeLanes, planeIndex, overflowPlane);
+                Lanes reach = ex * plane.AbsoluteNormalX + ey * plane.AbsoluteNormalY + ez * plane.AbsoluteNormalZ;
+                culled = Vector256Runtime::BitwiseOr(culled, Vector256Runtime::LessThan(DistanceToPlane(plane, x, y, z) + reach, zero));
+            }
+            visibleCount += WriteVisibleBits(culled, visibleMask, index, laneCount);
+        }
+        return visibleCount;
+    }
+
+    /// <summary>
+    /// Runs one kernel body in the clone compiled for the running machine, or directly where nothing is dispatched.
+    /// </summary>
+    template <auto Kernel, typename... TArgs>
+    static auto Dispatch(const TArgs&... args) {
+#if HE_CPP_SIMD_FUNCTION_DISPATCH
+        using TFunction = decltype(&RunBaseline<Kernel, TArgs...>);
+        static const TFunction implementation = SimdDispatch::Select<TFunction>(
+            &RunBaseline<Kernel, TArgs...>,
+            &RunAvx2<Kernel, TArgs...>,
+            &RunAvx512<Kernel, TArgs...>);
+        return implementation(args...);
+#else
+        return Kernel(args...);
+#endif
+    }
+
+    template <auto Kernel, typename... TArgs>
+    static auto RunBaseline(const TArgs&... args) {
+        return Kernel(args...);
+    }
+
+    template <auto Kernel, typename... TArgs>
+    HE_CPP_AVX2_TARGET static auto RunAvx2(const TArgs&... args) {
+        return Kernel(args...);
+    }
+
+    template <auto Kernel, typename... TArgs>
+    HE_CPP_AVX512_TARGET static auto RunAvx512(const TArgs&... args) {
+        return Kernel(args...);
+    }
+
+public:
+    /// <summary>
+    /// Writes the world matrix <c>CreateScale(s) * CreateFromQuaternion(r) * CreateTranslation(p)</c> of each
+    /// transform whose position, rotation, and scale components arrive as separate spans.
+    /// </summary>
+    static void ComposeTransforms(
+        const ReadOnlySpan<float>& positionX,
+        const ReadOnlySpan<float>& positionY,
+        const ReadOnlySpan<float>& positionZ,
+        const ReadOnlySpan<float>& rotationX,
+        const ReadOnlySpan<float>& rotationY,
+        const ReadOnlySpan<float>& rotationZ,
+        const ReadOnlySpan<float>& rotationW,
+        const ReadOnlySpan<float>& scaleX,
+        const ReadOnlySpan<float>& scaleY,
+        const ReadOnlySpan<float>& scaleZ,
+        const Span<Matrix4x4>& destination) {
+        Dispatch<&ComposeTransformsLanes>(positionX, positionY, positionZ, rotationX, rotationY, rotationZ, rotationW, scaleX, scaleY, scaleZ, destination);
+    }
+
+    /// <summary>
+    /// Writes <c>local[i] * world[parentIndices[i]]</c>, or <c>local[i]</c> for a root (a negative parent index), in
+    /// array order. Parents must precede their children, so each parent's world matrix is final when it is read.
+    /// </summary>
+    static void ComposeHierarchy(
+        const ReadOnlySpan<Matrix4x4>& local,
+        const ReadOnlySpan<int32_t>& parentIndices,
+        const Span<Matrix4x4>& world) {
+        Dispatch<&ComposeHierarchyLanes>(local, parentIndices, world);
+    }
+
+    /// <summary>
+    /// Writes <c>Vector3.Transform(point, matrix)</c> for each point whose coordinates arrive as separate spans.
+    /// </summary>
+    static void TransformPoints(
+        const Matrix4x4& matrix,
+        const ReadOnlySpan<float>& x,
+        const ReadOnlySpan<float>& y,
+        const ReadOnlySpan<float>& z,
+        const Span<float>& destinationX,
+        const Span<float>& destinationY,
+        const Span<float>& destinationZ) {
+        Dispatch<&TransformPointsLanes>(matrix, x, y, z, destinationX, destinationY, destinationZ);
+    }
+
+    /// <summary>
+    /// Tests each bounding sphere against the frustum planes, whose normals face into the frustum, and sets bit
+    /// <c>i % 32</c> of <c>visibleMask[i / 32]</c> when sphere i is not entirely behind any plane. Returns the number
+    /// of visible spheres.
+    /// </summary>
+    static int32_t CullSpheres(
+        const ReadOnlySpan<Plane>& planes,
+        const ReadOnlySpan<float>& centerX,
+        const ReadOnlySpan<float>& centerY,
+        const ReadOnlySpan<float>& centerZ,
+        const ReadOnlySpan<float>& radius,
+        const Span<uint32_t>& visibleMask) {
+        return Dispatch<&CullSpheresLanes>(planes, centerX, centerY, centerZ, radius, visibleMask);
+    }
+
+    /// <summary>
+    /// Tests each axis-aligned box, given by center and half extents, against the frustum planes the way
+    /// <see cref="CullSpheres"/> tests spheres: a box is culled when its corner furthest along a plane's normal is
+    /// still behind that plane.
+    /// </summary>
+    static int32_t CullAabbs(
+        const ReadOnlySpan<Plane>& planes,
+        const ReadOnlySpan<float>& centerX,
+        const ReadOnlySpan<float>& centerY,
+        const ReadOnlySpan<float>& centerZ,
+        const ReadOnlySpan<float>& extentX,
+        const ReadOnlySpan<float>& extentY,
+        const ReadOnlySpan<float>& extentZ,
+        const Span<uint32_t>& visibleMask) {
+        return Dispatch<&CullAabbsLanes>(planes, centerX, centerY, centerZ, extentX, extentY, extentZ, visibleMask);
+    }
+};
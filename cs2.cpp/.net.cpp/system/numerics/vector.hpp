@@ -8,6 +8,7 @@
 #include <type_traits>
 #include "../../runtime/native_string.hpp"
 #include "../../runtime/native_span.hpp"
+#include "system/runtime/intrinsics/vector_lanes.hpp"
 
 template <typename T>
 class Vector128_1;
@@ -15,10 +16,17 @@ class Vector128_1;
 template <typename T>
 class Vector256;
 
+/// <summary>
+/// Managed System.Numerics.Vector&lt;T&gt;. Its width is HE_CPP_VECTOR_WIDTH_BITS, chosen by the platform profile or the
+/// compile target, and its lanes sit in register-aligned storage so the operators run on the SSE/AVX or NEON backend.
+/// </summary>
 template <typename T>
-class Vector_1 {
+class alignas(HE_CPP_VECTOR_WIDTH_BITS / 8) Vector_1 {
 public:
-    static constexpr int32_t LaneCount = sizeof(T) >= 16 ? 1 : static_cast<int32_t>(16 / sizeof(T));
+    static constexpr int32_t ByteCount = HE_CPP_VECTOR_WIDTH_BITS / 8;
+    static constexpr int32_t LaneCount = sizeof(T) >= ByteCount ? 1 : static_cast<int32_t>(ByteCount / sizeof(T));
+
+    static_assert(ByteCount == 16 || ByteCount == 32, "HE_CPP_VECTOR_WIDTH_BITS must be 128 or 256.");
 
     T Values[LaneCount];
 
@@ -89,8 +97,12 @@ public:
         return Vector_1(static_cast<T>(1));
     }
 
-    static bool get_IsSupported() {
-        return true;
+    /// <summary>
+    /// Reports whether <typeparamref name="T"/> is one of the managed Vector&lt;T&gt; element types.
+    /// </summary>
+    static constexpr bool get_IsSupported() {
+        return std::is_floating_point_v<T> ||
+            (std::is_integral_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char16_t> && sizeof(T) <= 8);
     }
 
     T& get_Item(int32_t index) {
@@ -121,6 +133,13 @@ public:
 
     Vector_1 operator-() const {
         Vector_1 result;
+        if constexpr (VectorLaneBlock<T, ByteCount>::Supports(VectorLaneOperation::Arithmetic)) {
+            VectorLaneBlock<T, ByteCount>::template Unary<VectorLaneOperation::Arithmetic>(Values, result.Values, [](auto lanes, auto valueLanes) {
+                return decltype(lanes)::Negate(valueLanes);
+            });
+            return result;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < LaneCount; ++laneIndex) {
             result.Values[laneIndex] = -Values[laneIndex];
         }
@@ -272,9 +291,22 @@ private:
     }
 };
 
+/// <summary>
+/// Register backend for System.Numerics.Vector&lt;T&gt; at the configured width.
+/// </summary>
+template <typename T>
+using VectorRegisters = VectorLaneBlock<T, Vector_1<T>::ByteCount>;
+
 template <typename T>
 Vector_1<T> operator+(const Vector_1<T>& left, const Vector_1<T>& right) {
     Vector_1<T> result;
+    if constexpr (VectorRegisters<T>::Supports(VectorLaneOperation::Arithmetic)) {
+        VectorRegisters<T>::template Binary<VectorLaneOperation::Arithmetic>(left.Values, right.Values, result.Values, [](auto lanes, auto leftLanes, auto rightLanes) {
+            return decltype(lanes)::Add(leftLanes, rightLanes);
+        });
+        return result;
+    }
+
     for (int32_t laneIndex = 0; laneIndex < Vector_1<T>::get_Count(); ++laneIndex) {
         result.Values[laneIndex] = left.Values[laneIndex] + right.Values[laneIndex];
     }
@@ -284,6 +316,13 @@ Vector_1<T> operator+(const Vector_1<T>& left, const Vector_1<T>& right) {
 template <typename T>
 Vector_1<T> operator-(const Vector_1<T>& left, const Vector_1<T>& right) {
     Vector_1<T> result;
+    if constexpr (VectorRegisters<T>::Supports(VectorLaneOperation::Arithmetic)) {
+        VectorRegisters<T>::template Binary<VectorLaneOperation::Arithmetic>(left.Values, right.Values, result.Values, [](auto lanes, auto leftLanes, auto rightLanes) {
+            return decltype(lanes)::Subtract(leftLanes, rightLanes);
+        });
+        return result;
+    }
+
     for (int32_t laneIndex = 0; laneIndex < Vector_1<T>::get_Count(); ++laneIndex) {
         result.Values[laneIndex] = left.Values[laneIndex] - right.Values[laneIndex];
     }
@@ -293,6 +332,13 @@ Vector_1<T> operator-(const Vector_1<T>& left, const Vector_1<T>& right) {
 template <typename T>
 Vector_1<T> operator*(const Vector_1<T>& left, const Vector_1<T>& right) {
     Vector_1<T> result;
+    if constexpr (VectorRegisters<T>::Supports(VectorLaneOperation::Multiply)) {
+        VectorRegisters<T>::template Binary<VectorLaneOperation::Multiply>(left.Values, right.Values, result.Values, [](auto lanes, auto leftLanes, auto rightLanes) {
+            return decltype(lanes)::Multiply(leftLanes, rightLanes);
+        });
+        return result;
+    }
+
     for (int32_t laneIndex = 0; laneIndex < Vector_1<T>::get_Count(); ++laneIndex) {
         result.Values[laneIndex] = left.Values[laneIndex] * right.Values[laneIndex];
     }
@@ -302,6 +348,13 @@ Vector_1<T> operator*(const Vector_1<T>& left, const Vector_1<T>& right) {
 template <typename T>
 Vector_1<T> operator/(const Vector_1<T>& left, const Vector_1<T>& right) {
     Vector_1<T> result;
+    if constexpr (VectorRegisters<T>::Supports(VectorLaneOperation::Divide)) {
+        VectorRegisters<T>::template Binary<VectorLaneOperation::Divide>(left.Values, right.Values, result.Values, [](auto lanes, auto leftLanes, auto rightLanes) {
+            return decltype(lanes)::Divide(leftLanes, rightLanes);
+        });
+        return result;
+    }
+
     for (int32_t laneIndex = 0; laneIndex < Vector_1<T>::get_Count(); ++laneIndex) {
         result.Values[laneIndex] = left.Values[laneIndex] / right.Values[laneIndex];
     }
@@ -310,29 +363,17 @@ Vector_1<T> operator/(const Vector_1<T>& left, const Vector_1<T>& right) {
 
 template <typename T>
 Vector_1<T> operator+(const Vector_1<T>& left, const T& right) {
-    Vector_1<T> result;
-    for (int32_t laneIndex = 0; laneIndex < Vector_1<T>::get_Count(); ++laneIndex) {
-        result.Values[laneIndex] = left.Values[laneIndex] + right;
-    }
-    return result;
+    return left + Vector_1<T>(right);
 }
 
 template <typename T>
 Vector_1<T> operator-(const Vector_1<T>& left, const T& right) {
-    Vector_1<T> result;
-    for (int32_t laneIndex = 0; laneIndex < Vector_1<T>::get_Count(); ++laneIndex) {
-        result.Values[laneIndex] = left.Values[laneIndex] - right;
-    }
-    return result;
+    return left - Vector_1<T>(right);
 }
 
 template <typename T>
 Vector_1<T> operator*(const Vector_1<T>& left, const T& right) {
-    Vector_1<T> result;
-    for (int32_t laneIndex = 0; laneIndex < Vector_1<T>::get_Count(); ++laneIndex) {
-        result.Values[laneIndex] = left.Values[laneIndex] * right;
-    }
-    return result;
+    return left * Vector_1<T>(right);
 }
 
 template <typename T>
@@ -342,11 +383,7 @@ Vector_1<T> operator*(const T& left, const Vector_1<T>& right) {
 
 template <typename T>
 Vector_1<T> operator/(const Vector_1<T>& left, const T& right) {
-    Vector_1<T> result;
-    for (int32_t laneIndex = 0; laneIndex < Vector_1<T>::get_Count(); ++laneIndex) {
-        result.Values[laneIndex] = left.Values[laneIndex] / right;
-    }
-    return result;
+    return left / Vector_1<T>(right);
 }
 
 class Vector {
@@ -370,11 +407,11 @@ class Vector {
     static T BitwiseAndScalar(const T& left, const T& right) {
         if constexpr (std::is_integral_v<T>) {
             return static_cast<T>(left & right);
-        } else if constexpr (std::is_same_v<T, float>) {
-            uint32_t bits = BitCast<uint32_t>(left) & BitCast<uint32_t>(right);
-            return BitCastBack<float>(bits);
+        } else if constexpr (std::is_floating_point_v<T>) {
+            VectorLaneBits<T> bits = BitCast<VectorLaneBits<T>>(left) & BitCast<VectorLaneBits<T>>(right);
+            return BitCastBack<T>(bits);
         } else {
-            static_assert(std::is_integral_v<T> || std::is_same_v<T, float>, "Unsupported Vector bitwise operand type.");
+            static_assert(std::is_integral_v<T> || std::is_floating_point_v<T>, "Unsupported Vector bitwise operand type.");
         }
     }
 
@@ -382,11 +419,11 @@ class Vector {
     static T BitwiseOrScalar(const T& left, const T& right) {
         if constexpr (std::is_integral_v<T>) {
             return static_cast<T>(left | right);
-        } else if constexpr (std::is_same_v<T, float>) {
-            uint32_t bits = BitCast<uint32_t>(left) | BitCast<uint32_t>(right);
-            return BitCastBack<float>(bits);
+        } else if constexpr (std::is_floating_point_v<T>) {
+            VectorLaneBits<T> bits = BitCast<VectorLaneBits<T>>(left) | BitCast<VectorLaneBits<T>>(right);
+            return BitCastBack<T>(bits);
         } else {
-            static_assert(std::is_integral_v<T> || std::is_same_v<T, float>, "Unsupported Vector bitwise operand type.");
+            static_assert(std::is_integral_v<T> || std::is_floating_point_v<T>, "Unsupported Vector bitwise operand type.");
         }
     }
 
@@ -394,11 +431,11 @@ class Vector {
     static T XorScalar(const T& left, const T& right) {
         if constexpr (std::is_integral_v<T>) {
             return static_cast<T>(left ^ right);
-        } else if constexpr (std::is_same_v<T, float>) {
-            uint32_t bits = BitCast<uint32_t>(left) ^ BitCast<uint32_t>(right);
-            return BitCastBack<float>(bits);
+        } else if constexpr (std::is_floating_point_v<T>) {
+            VectorLaneBits<T> bits = BitCast<VectorLaneBits<T>>(left) ^ BitCast<VectorLaneBits<T>>(right);
+            return BitCastBack<T>(bits);
         } else {
-            static_assert(std::is_integral_v<T> || std::is_same_v<T, float>, "Unsupported Vector xor operand type.");
+            static_assert(std::is_integral_v<T> || std::is_floating_point_v<T>, "Unsupported Vector xor operand type.");
         }
     }
 
@@ -406,11 +443,11 @@ class Vector {
     static T OnesComplementScalar(const T& value) {
         if constexpr (std::is_integral_v<T>) {
             return static_cast<T>(~value);
-        } else if constexpr (std::is_same_v<T, float>) {
-            uint32_t bits = ~BitCast<uint32_t>(value);
-            return BitCastBack<float>(bits);
+        } else if constexpr (std::is_floating_point_v<T>) {
+            VectorLaneBits<T> bits = ~BitCast<VectorLaneBits<T>>(value);
+            return BitCastBack<T>(bits);
         } else {
-            static_assert(std::is_integral_v<T> || std::is_same_v<T, float>, "Unsupported Vector complement operand type.");
+            static_assert(std::is_integral_v<T> || std::is_floating_point_v<T>, "Unsupported Vector complement operand type.");
         }
     }
 
@@ -419,7 +456,47 @@ class Vector {
         return condition ? -1 : 0;
     }
 
+    /// <summary>
+    /// Whether a compare on <typeparamref name="T"/> lanes can run on the register backend and hand its lane mask
+    /// straight to the Vector&lt;int&gt; the comparison methods return, which needs lanes as wide as int.
+    /// </summary>
+    template <typename T>
+    static constexpr bool HasInt32CompareLanes(VectorLaneOperation operation) {
+        return sizeof(T) == sizeof(int32_t) && VectorRegisters<T>::Supports(operation);
+    }
+
+    template <VectorLaneOperation Operation, typename T, typename TOperation>
+    static Vector_1<int32_t> CompareLanes(const Vector_1<T>& left, const Vector_1<T>& right, TOperation operation) {
+        Vector_1<T> mask;
+        VectorRegisters<T>::template Binary<Operation>(left.Values, right.Values, mask.Values, operation);
+        Vector_1<int32_t> result;
+        std::memcpy(result.Values, mask.Values, sizeof(result.Values));
+        return result;
+    }
+
+    /// <summary>
+    /// Runs one compare on the register backend and gathers one bit per lane for the All and Any queries.
+    /// </summary>
+    template <VectorLaneOperation Operation, typename T, typename TOperation>
+    static uint32_t CompareBits(const Vector_1<T>& left, const Vector_1<T>& right, TOperation operation) {
+        Vector_1<T> mask;
+        VectorRegisters<T>::template Binary<Operation>(left.Values, right.Values, mask.Values, operation);
+        return VectorRegisters<T>::MoveMask(mask.Values);
+    }
+
+    template <typename T>
+    static constexpr uint32_t AllLaneBits() {
+        return Vector_1<T>::LaneCount >= 32 ? 0xFFFFFFFFu : (1u << Vector_1<T>::LaneCount) - 1u;
+    }
+
 public:
+    /// <summary>
+    /// Reports whether Vector&lt;T&gt; operations run on vector registers on the compile target.
+    /// </summary>
+    static constexpr bool get_IsHardwareAccelerated() {
+        return VectorRegisters<int32_t>::Supports(VectorLaneOperation::Arithmetic);
+    }
+
     template <typename T>
     static Vector_1<T> Abs(const Vector_1<T>& value) {
         Vector_1<T> result;
@@ -440,6 +517,14 @@ public:
 
     template <typename T>
     static Vector_1<T> AndNot(const Vector_1<T>& left, const Vector_1<T>& right) {
+        if constexpr (VectorRegisters<T>::Supports(VectorLaneOperation::Arithmetic)) {
+            Vector_1<T> result;
+            VectorRegisters<T>::template Binary<VectorLaneOperation::Arithmetic>(left.Values, right.Values, result.Values, [](auto lanes, auto leftLanes, auto rightLanes) {
+                return decltype(lanes)::AndNot(leftLanes, rightLanes);
+            });
+            return result;
+        }
+
         return BitwiseAnd(OnesComplement(right), left);
     }
 
@@ -477,6 +562,13 @@ public:
     template <typename T>
     static Vector_1<T> BitwiseAnd(const Vector_1<T>& left, const Vector_1<T>& right) {
         Vector_1<T> result;
+        if constexpr (VectorRegisters<T>::Supports(VectorLaneOperation::Arithmetic)) {
+            VectorRegisters<T>::template Binary<VectorLaneOperation::Arithmetic>(left.Values, right.Values, result.Values, [](auto lanes, auto leftLanes, auto rightLanes) {
+                return decltype(lanes)::And(leftLanes, rightLanes);
+            });
+            return result;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector_1<T>::get_Count(); ++laneIndex) {
             result.Values[laneIndex] = BitwiseAndScalar(left.Values[laneIndex], right.Values[laneIndex]);
         }
@@ -486,6 +578,13 @@ public:
     template <typename T>
     static Vector_1<T> BitwiseOr(const Vector_1<T>& left, const Vector_1<T>& right) {
         Vector_1<T> result;
+        if constexpr (VectorRegisters<T>::Supports(VectorLaneOperation::Arithmetic)) {
+            VectorRegisters<T>::template Binary<VectorLaneOperation::Arithmetic>(left.Values, right.Values, result.Values, [](auto lanes, auto leftLanes, auto rightLanes) {
+                return decltype(lanes)::Or(leftLanes, rightLanes);
+            });
+            return result;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector_1<T>::get_Count(); ++laneIndex) {
             result.Values[laneIndex] = BitwiseOrScalar(left.Values[laneIndex], right.Values[laneIndex]);
         }
@@ -495,6 +594,22 @@ public:
     template <typename T>
     static Vector_1<T> ConditionalSelect(const Vector_1<int32_t>& condition, const Vector_1<T>& left, const Vector_1<T>& right) {
         Vector_1<T> result;
+        if constexpr (sizeof(T) == sizeof(int32_t) && VectorRegisters<T>::Supports(VectorLaneOperation::Arithmetic) &&
+            VectorRegisters<int32_t>::Supports(VectorLaneOperation::CompareOrder)) {
+            // Each lane follows the sign of its condition lane; comparing against zero spreads that sign across the lane.
+            const Vector_1<int32_t> zero;
+            Vector_1<int32_t> conditionMask;
+            VectorRegisters<int32_t>::template Binary<VectorLaneOperation::CompareOrder>(condition.Values, zero.Values, conditionMask.Values, [](auto lanes, auto leftLanes, auto rightLanes) {
+                return decltype(lanes)::CompareLessThan(leftLanes, rightLanes);
+            });
+            Vector_1<T> mask;
+            std::memcpy(mask.Values, conditionMask.Values, sizeof(mask.Values));
+            VectorRegisters<T>::template Ternary<VectorLaneOperation::Arithmetic>(mask.Values, left.Values, right.Values, result.Values, [](auto lanes, auto maskLanes, auto leftLanes, auto rightLanes) {
+                return decltype(lanes)::Select(maskLanes, leftLanes, rightLanes);
+            });
+            return result;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector_1<T>::get_Count(); ++laneIndex) {
             result.Values[laneIndex] = condition.Values[laneIndex] < 0 ? left.Values[laneIndex] : right.Values[laneIndex];
         }
@@ -517,6 +632,12 @@ public:
 
     template <typename T>
     static Vector_1<int32_t> Equals(const Vector_1<T>& left, const Vector_1<T>& right) {
+        if constexpr (HasInt32CompareLanes<T>(VectorLaneOperation::CompareEqual)) {
+            return CompareLanes<VectorLaneOperation::CompareEqual>(left, right, [](auto lanes, auto leftLanes, auto rightLanes) {
+                return decltype(lanes)::CompareEqual(leftLanes, rightLanes);
+            });
+        }
+
         Vector_1<int32_t> result;
         for (int32_t laneIndex = 0; laneIndex < Vector_1<T>::get_Count(); ++laneIndex) {
             result.Values[laneIndex] = ComparisonMask<T>(left.Values[laneIndex] == right.Values[laneIndex]);
@@ -526,6 +647,12 @@ public:
 
     template <typename T>
     static bool EqualsAll(const Vector_1<T>& left, const Vector_1<T>& right) {
+        if constexpr (VectorRegisters<T>::Supports(VectorLaneOperation::CompareEqual)) {
+            return CompareBits<VectorLaneOperation::CompareEqual>(left, right, [](auto lanes, auto leftLanes, auto rightLanes) {
+                return decltype(lanes)::CompareEqual(leftLanes, rightLanes);
+            }) == AllLaneBits<T>();
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector_1<T>::get_Count(); ++laneIndex) {
             if (!(left.Values[laneIndex] == right.Values[laneIndex])) {
                 return false;
@@ -536,6 +663,12 @@ public:
 
     template <typename T>
     static bool EqualsAny(const Vector_1<T>& left, const Vector_1<T>& right) {
+        if constexpr (VectorRegisters<T>::Supports(VectorLaneOperation::CompareEqual)) {
+            return CompareBits<VectorLaneOperation::CompareEqual>(left, right, [](auto lanes, auto leftLanes, auto rightLanes) {
+                return decltype(lanes)::CompareEqual(leftLanes, rightLanes);
+            }) != 0;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector_1<T>::get_Count(); ++laneIndex) {
             if (left.Values[laneIndex] == right.Values[laneIndex]) {
                 return true;
@@ -559,6 +692,12 @@ public:
 
     template <typename T>
     static Vector_1<int32_t> GreaterThan(const Vector_1<T>& left, const Vector_1<T>& right) {
+        if constexpr (HasInt32CompareLanes<T>(VectorLaneOperation::CompareOrder)) {
+            return CompareLanes<VectorLaneOperation::CompareOrder>(left, right, [](auto lanes, auto leftLanes, auto rightLanes) {
+                return decltype(lanes)::CompareGreaterThan(leftLanes, rightLanes);
+            });
+        }
+
         Vector_1<int32_t> result;
         for (int32_t laneIndex = 0; laneIndex < Vector_1<T>::get_Count(); ++laneIndex) {
             result.Values[laneIndex] = ComparisonMask<T>(left.Values[laneIndex] > right.Values[laneIndex]);
@@ -568,6 +707,12 @@ public:
 
     template <typename T>
     static bool GreaterThanAny(const Vector_1<T>& left, const Vector_1<T>& right) {
+        if constexpr (VectorRegisters<T>::Supports(VectorLaneOperation::CompareOrder)) {
+            return CompareBits<VectorLaneOperation::CompareOrder>(left, right, [](auto lanes, auto leftLanes, auto rightLanes) {
+                return decltype(lanes)::CompareGreaterThan(leftLanes, rightLanes);
+            }) != 0;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector_1<T>::get_Count(); ++laneIndex) {
             if (left.Values[laneIndex] > right.Values[laneIndex]) {
                 return true;
@@ -578,6 +723,12 @@ public:
 
     template <typename T>
     static Vector_1<int32_t> GreaterThanOrEqual(const Vector_1<T>& left, const Vector_1<T>& right) {
+        if constexpr (HasInt32CompareLanes<T>(VectorLaneOperation::CompareOrder)) {
+            return CompareLanes<VectorLaneOperation::CompareOrder>(right, left, [](auto lanes, auto leftLanes, auto rightLanes) {
+                return decltype(lanes)::CompareLessThanOrEqual(leftLanes, rightLanes);
+            });
+        }
+
         Vector_1<int32_t> result;
         for (int32_t laneIndex = 0; laneIndex < Vector_1<T>::get_Count(); ++laneIndex) {
             result.Values[laneIndex] = ComparisonMask<T>(left.Values[laneIndex] >= right.Values[laneIndex]);
@@ -587,6 +738,12 @@ public:
 
     template <typename T>
     static Vector_1<int32_t> LessThan(const Vector_1<T>& left, const Vector_1<T>& right) {
+        if constexpr (HasInt32CompareLanes<T>(VectorLaneOperation::CompareOrder)) {
+            return CompareLanes<VectorLaneOperation::CompareOrder>(left, right, [](auto lanes, auto leftLanes, auto rightLanes) {
+                return decltype(lanes)::CompareLessThan(leftLanes, rightLanes);
+            });
+        }
+
         Vector_1<int32_t> result;
         for (int32_t laneIndex = 0; laneIndex < Vector_1<T>::get_Count(); ++laneIndex) {
             result.Values[laneIndex] = ComparisonMask<T>(left.Values[laneIndex] < right.Values[laneIndex]);
@@ -596,6 +753,12 @@ public:
 
     template <typename T>
     static bool LessThanAll(const Vector_1<T>& left, const Vector_1<T>& right) {
+        if constexpr (VectorRegisters<T>::Supports(VectorLaneOperation::CompareOrder)) {
+            return CompareBits<VectorLaneOperation::CompareOrder>(left, right, [](auto lanes, auto leftLanes, auto rightLanes) {
+                return decltype(lanes)::CompareLessThan(leftLanes, rightLanes);
+            }) == AllLaneBits<T>();
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector_1<T>::get_Count(); ++laneIndex) {
             if (!(left.Values[laneIndex] < right.Values[laneIndex])) {
                 return false;
@@ -606,6 +769,12 @@ public:
 
     template <typename T>
     static bool LessThanAny(const Vector_1<T>& left, const Vector_1<T>& right) {
+        if constexpr (VectorRegisters<T>::Supports(VectorLaneOperation::CompareOrder)) {
+            return CompareBits<VectorLaneOperation::CompareOrder>(left, right, [](auto lanes, auto leftLanes, auto rightLanes) {
+                return decltype(lanes)::CompareLessThan(leftLanes, rightLanes);
+            }) != 0;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector_1<T>::get_Count(); ++laneIndex) {
             if (left.Values[laneIndex] < right.Values[laneIndex]) {
                 return true;
@@ -616,6 +785,12 @@ public:
 
     template <typename T>
     static Vector_1<int32_t> LessThanOrEqual(const Vector_1<T>& left, const Vector_1<T>& right) {
+        if constexpr (HasInt32CompareLanes<T>(VectorLaneOperation::CompareOrder)) {
+            return CompareLanes<VectorLaneOperation::CompareOrder>(left, right, [](auto lanes, auto leftLanes, auto rightLanes) {
+                return decltype(lanes)::CompareLessThanOrEqual(leftLanes, rightLanes);
+            });
+        }
+
         Vector_1<int32_t> result;
         for (int32_t laneIndex = 0; laneIndex < Vector_1<T>::get_Count(); ++laneIndex) {
             result.Values[laneIndex] = ComparisonMask<T>(left.Values[laneIndex] <= right.Values[laneIndex]);
@@ -626,6 +801,13 @@ public:
     template <typename T>
     static Vector_1<T> Max(const Vector_1<T>& left, const Vector_1<T>& right) {
         Vector_1<T> result;
+        if constexpr (VectorRegisters<T>::Supports(VectorLaneOperation::CompareOrder)) {
+            VectorRegisters<T>::template Binary<VectorLaneOperation::CompareOrder>(left.Values, right.Values, result.Values, [](auto lanes, auto leftLanes, auto rightLanes) {
+                return decltype(lanes)::Max(leftLanes, rightLanes);
+            });
+            return result;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector_1<T>::get_Count(); ++laneIndex) {
             result.Values[laneIndex] = std::max(left.Values[laneIndex], right.Values[laneIndex]);
         }
@@ -640,6 +822,13 @@ public:
     template <typename T>
     static Vector_1<T> Min(const Vector_1<T>& left, const Vector_1<T>& right) {
         Vector_1<T> result;
+        if constexpr (VectorRegisters<T>::Supports(VectorLaneOperation::CompareOrder)) {
+            VectorRegisters<T>::template Binary<VectorLaneOperation::CompareOrder>(left.Values, right.Values, result.Values, [](auto lanes, auto leftLanes, auto rightLanes) {
+                return decltype(lanes)::Min(leftLanes, rightLanes);
+            });
+            return result;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector_1<T>::get_Count(); ++laneIndex) {
             result.Values[laneIndex] = std::min(left.Values[laneIndex], right.Values[laneIndex]);
         }
@@ -654,6 +843,13 @@ public:
     template <typename T>
     static Vector_1<T> OnesComplement(const Vector_1<T>& value) {
         Vector_1<T> result;
+        if constexpr (VectorRegisters<T>::Supports(VectorLaneOperation::Arithmetic)) {
+            VectorRegisters<T>::template Unary<VectorLaneOperation::Arithmetic>(value.Values, result.Values, [](auto lanes, auto valueLanes) {
+                return decltype(lanes)::Xor(valueLanes, decltype(lanes)::AllBitsSet());
+            });
+            return result;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector_1<T>::get_Count(); ++laneIndex) {
             result.Values[laneIndex] = OnesComplementScalar(value.Values[laneIndex]);
         }
@@ -672,6 +868,13 @@ public:
     template <typename T>
     static Vector_1<T> Xor(const Vector_1<T>& left, const Vector_1<T>& right) {
         Vector_1<T> result;
+        if constexpr (VectorRegisters<T>::Supports(VectorLaneOperation::Arithmetic)) {
+            VectorRegisters<T>::template Binary<VectorLaneOperation::Arithmetic>(left.Values, right.Values, result.Values, [](auto lanes, auto leftLanes, auto rightLanes) {
+                return decltype(lanes)::Xor(leftLanes, rightLanes);
+            });
+            return result;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector_1<T>::get_Count(); ++laneIndex) {
             result.Values[laneIndex] = XorScalar(left.Values[laneIndex], right.Values[laneIndex]);
         }
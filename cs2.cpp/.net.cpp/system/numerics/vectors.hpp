@@ -0,0 +1,1954 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include "../../runtime/native_exceptions.hpp"
+#include "../../runtime/native_string.hpp"
+#include "system/number.hpp"
+#include "system/runtime/intrinsics/float4_lanes.hpp"
+
+/// <summary>
+/// Matrix convention of the platform profile (CPPGeneratedMathConventionKind), written to the generated config. The
+/// managed API keeps its row-vector meaning either way; a column-vector platform stores Matrix4x4 transposed, one
+/// column per register, so the matrix can be handed to its graphics API without a copy.
+/// </summary>
+#ifndef HE_CPP_MATH_COLUMN_VECTOR
+#define HE_CPP_MATH_COLUMN_VECTOR 0
+#endif
+
+class Vector4;
+class Quaternion;
+class Plane;
+class Matrix4x4;
+
+/// <summary>
+/// Combines component hash codes the way the System.Numerics types feed them to HashCode.Combine: in field order.
+/// </summary>
+inline int32_t CombineNumericsHashCode(int32_t hash, float value) {
+    return static_cast<int32_t>(static_cast<uint32_t>(hash) * 31u + static_cast<uint32_t>(Number::GetHashCode(value)));
+}
+
+/// <summary>
+/// Managed System.Numerics.Vector2. It keeps the managed 8-byte layout so arrays and interop structs that embed it
+/// line up with the C# side; its arithmetic is scalar, which the compiler vectorizes where that pays off.
+/// </summary>
+class Vector2 {
+public:
+    float X;
+    float Y;
+
+    Vector2()
+        : X(0.0f), Y(0.0f) {
+    }
+
+    explicit Vector2(float value)
+        : X(value), Y(value) {
+    }
+
+    Vector2(float x, float y)
+        : X(x), Y(y) {
+    }
+
+    static Vector2 get_Zero() {
+        return Vector2();
+    }
+
+    static Vector2 get_One() {
+        return Vector2(1.0f);
+    }
+
+    static Vector2 get_UnitX() {
+        return Vector2(1.0f, 0.0f);
+    }
+
+    static Vector2 get_UnitY() {
+        return Vector2(0.0f, 1.0f);
+    }
+
+    float get_Item(int32_t index) const {
+        ValidateIndex(index);
+        return index == 0 ? X : Y;
+    }
+
+    void set_Item(int32_t index, float value) {
+        ValidateIndex(index);
+        (index == 0 ? X : Y) = value;
+    }
+
+    static Vector2 Abs(const Vector2& value) {
+        return Vector2(std::fabs(value.X), std::fabs(value.Y));
+    }
+
+    static Vector2 Add(const Vector2& left, const Vector2& right) {
+        return Vector2(left.X + right.X, left.Y + right.Y);
+    }
+
+    static Vector2 Clamp(const Vector2& value, const Vector2& min, const Vector2& max) {
+        return Min(Max(value, min), max);
+    }
+
+    static float Distance(const Vector2& left, const Vector2& right) {
+        return std::sqrt(DistanceSquared(left, right));
+    }
+
+    static float DistanceSquared(const Vector2& left, const Vector2& right) {
+        Vector2 difference = Subtract(left, right);
+        return Dot(difference, difference);
+    }
+
+    static Vector2 Divide(const Vector2& left, const Vector2& right) {
+        return Vector2(left.X / right.X, left.Y / right.Y);
+    }
+
+    static Vector2 Divide(const Vector2& left, float divisor) {
+        return Vector2(left.X / divisor, left.Y / divisor);
+    }
+
+    static float Dot(const Vector2& left, const Vector2& right) {
+        return left.X * right.X + left.Y * right.Y;
+    }
+
+    static Vector2 Lerp(const Vector2& left, const Vector2& right, float amount) {
+        return Vector2(left.X + (right.X - left.X) * amount, left.Y + (right.Y - left.Y) * amount);
+    }
+
+    static Vector2 Max(const Vector2& left, const Vector2& right) {
+        return Vector2(left.X > right.X ? left.X : right.X, left.Y > right.Y ? left.Y : right.Y);
+    }
+
+    static Vector2 Min(const Vector2& left, const Vector2& right) {
+        return Vector2(left.X < right.X ? left.X : right.X, left.Y < right.Y ? left.Y : right.Y);
+    }
+
+    static Vector2 Multiply(const Vector2& left, const Vector2& right) {
+        return Vector2(left.X * right.X, left.Y * right.Y);
+    }
+
+    static Vector2 Multiply(const Vector2& left, float right) {
+        return Vector2(left.X * right, left.Y * right);
+    }
+
+    static Vector2 Multiply(float left, const Vector2& right) {
+        return Multiply(right, left);
+    }
+
+    static Vector2 Negate(const Vector2& value) {
+        return Vector2(-value.X, -value.Y);
+    }
+
+    static Vector2 Normalize(const Vector2& value) {
+        return Divide(value, value.Length());
+    }
+
+    static Vector2 Reflect(const Vector2& vector, const Vector2& normal) {
+        float dot = Dot(vector, normal);
+        return Vector2(vector.X - 2.0f * dot * normal.X, vector.Y - 2.0f * dot * normal.Y);
+    }
+
+    static Vector2 SquareRoot(const Vector2& value) {
+        return Vector2(std::sqrt(value.X), std::sqrt(value.Y));
+    }
+
+    static Vector2 Subtract(const Vector2& left, const Vector2& right) {
+        return Vector2(left.X - right.X, left.Y - right.Y);
+    }
+
+    static Vector2 Transform(const Vector2& position, const Matrix4x4& matrix);
+    static Vector2 Transform(const Vector2& value, const Quaternion& rotation);
+    static Vector2 TransformNormal(const Vector2& normal, const Matrix4x4& matrix);
+
+    float Length() const {
+        return std::sqrt(LengthSquared());
+    }
+
+    float LengthSquared() const {
+        return Dot(*this, *this);
+    }
+
+    bool Equals(const Vector2& other) const {
+        return X == other.X && Y == other.Y;
+    }
+
+    int32_t GetHashCode() const {
+        return CombineNumericsHashCode(Number::GetHashCode(X), Y);
+    }
+
+    std::string ToString() const {
+        return "<" + String::ToJoinString(X) + ", " + String::ToJoinString(Y) + ">";
+    }
+
+    Vector2 operator-() const {
+        return Negate(*this);
+    }
+
+private:
+    static void ValidateIndex(int32_t index) {
+        if (index < 0 || index >= 2) {
+            throw ArgumentOutOfRangeException("index");
+        }
+    }
+};
+
+inline Vector2 operator+(const Vector2& left, const Vector2& right) {
+    return Vector2::Add(left, right);
+}
+
+inline Vector2 operator-(const Vector2& left, const Vector2& right) {
+    return Vector2::Subtract(left, right);
+}
+
+inline Vector2 operator*(const Vector2& left, const Vector2& right) {
+    return Vector2::Multiply(left, right);
+}
+
+inline Vector2 operator*(const Vector2& left, float right) {
+    return Vector2::Multiply(left, right);
+}
+
+inline Vector2 operator*(float left, const Vector2& right) {
+    return Vector2::Multiply(right, left);
+}
+
+inline Vector2 operator/(const Vector2& left, const Vector2& right) {
+    return Vector2::Divide(left, right);
+}
+
+inline Vector2 operator/(const Vector2& left, float right) {
+    return Vector2::Divide(left, right);
+}
+
+inline bool operator==(const Vector2& left, const Vector2& right) {
+    return left.Equals(right);
+}
+
+inline bool operator!=(const Vector2& left, const Vector2& right) {
+    return !left.Equals(right);
+}
+
+/// <summary>
+/// Managed System.Numerics.Vector3. Like Vector2 it keeps the managed 12-byte layout; padding it to a register would
+/// break every array and interop struct that embeds it. Transforms by Matrix4x4 still run on the matrix registers.
+/// </summary>
+class Vector3 {
+public:
+    float X;
+    float Y;
+    float Z;
+
+    Vector3()
+        : X(0.0f), Y(0.0f), Z(0.0f) {
+    }
+
+    explicit Vector3(float value)
+        : X(value), Y(value), Z(value) {
+    }
+
+    Vector3(const Vector2& value, float z)
+        : X(value.X), Y(value.Y), Z(z) {
+    }
+
+    Vector3(float x, float y, float z)
+        : X(x), Y(y), Z(z) {
+    }
+
+    static Vector3 get_Zero() {
+        return Vector3();
+    }
+
+    static Vector3 get_One() {
+        return Vector3(1.0f);
+    }
+
+    static Vector3 get_UnitX() {
+        return Vector3(1.0f, 0.0f, 0.0f);
+    }
+
+    static Vector3 get_UnitY() {
+        return Vector3(0.0f, 1.0f, 0.0f);
+    }
+
+    static Vector3 get_UnitZ() {
+        return Vector3(0.0f, 0.0f, 1.0f);
+    }
+
+    float get_Item(int32_t index) const {
+        ValidateIndex(index);
+        return index == 0 ? X : (index == 1 ? Y : Z);
+    }
+
+    void set_Item(int32_t index, float value) {
+        ValidateIndex(index);
+        (index == 0 ? X : (index == 1 ? Y : Z)) = value;
+    }
+
+    static Vector3 Abs(const Vector3& value) {
+        return Vector3(std::fabs(value.X), std::fabs(value.Y), std::fabs(value.Z));
+    }
+
+    static Vector3 Add(const Vector3& left, const Vector3& right) {
+        return Vector3(left.X + right.X, left.Y + right.Y, left.Z + right.Z);
+    }
+
+    static Vector3 Clamp(const Vector3& value, const Vector3& min, const Vector3& max) {
+        return Min(Max(value, min), max);
+    }
+
+    static Vector3 Cross(const Vector3& left, const Vector3& right) {
+        return Vector3(
+            left.Y * right.Z - left.Z * right.Y,
+            left.Z * right.X - left.X * right.Z,
+            left.X * right.Y - left.Y * right.X);
+    }
+
+    static float Distance(const Vector3& left, const Vector3& right) {
+        return std::sqrt(DistanceSquared(left, right));
+    }
+
+    static float DistanceSquared(const Vector3& left, const Vector3& right) {
+        Vector3 difference = Subtract(left, right);
+        return Dot(difference, difference);
+    }
+
+    static Vector3 Divide(const Vector3& left, const Vector3& right) {
+        return Vector3(left.X / right.X, left.Y / right.Y, left.Z / right.Z);
+    }
+
+    static Vector3 Divide(const Vector3& left, float divisor) {
+        return Vector3(left.X / divisor, left.Y / divisor, left.Z / divisor);
+    }
+
+    static float Dot(const Vector3& left, const Vector3& right) {
+        return left.X * right.X + left.Y * right.Y + left.Z * right.Z;
+    }
+
+    static Vector3 Lerp(const Vector3& left, const Vector3& right, float amount) {
+        return Vector3(
+            left.X + (right.X - left.X) * amount,
+            left.Y + (right.Y - left.Y) * amount,
+            left.Z + (right.Z - left.Z) * amount);
+    }
+
+    static Vector3 Max(const Vector3& left, const Vector3& right) {
+        return Vector3(
+            left.X > right.X ? left.X : right.X,
+            left.Y > right.Y ? left.Y : right.Y,
+            left.Z > right.Z ? left.Z : right.Z);
+    }
+
+    static Vector3 Min(const Vector3& left, const Vector3& right) {
+        return Vector3(
+            left.X < right.X ? left.X : right.X,
+            left.Y < right.Y ? left.Y : right.Y,
+            left.Z < right.Z ? left.Z : right.Z);
+    }
+
+    static Vector3 Multiply(const Vector3& left, const Vector3& right) {
+        return Vector3(left.X * right.X, left.Y * right.Y, left.Z * right.Z);
+    }
+
+    static Vector3 Multiply(const Vector3& left, float right) {
+        return Vector3(left.X * right, left.Y * right, left.Z * right);
+    }
+
+    static Vector3 Multiply(float left, const Vector3& right) {
+        return Multiply(right, left);
+    }
+
+    static Vector3 Negate(const Vector3& value) {
+        return Vector3(-value.X, -value.Y, -value.Z);
+    }
+
+    static Vector3 Normalize(const Vector3& value) {
+        return Divide(value, value.Length());
+    }
+
+    static Vector3 Reflect(const Vector3& vector, const Vector3& normal) {
+        float dot = Dot(vector, normal);
+        return Vector3(
+            vector.X - 2.0f * dot * normal.X,
+            vector.Y - 2.0f * dot * normal.Y,
+            vector.Z - 2.0f * dot * normal.Z);
+    }
+
+    static Vector3 SquareRoot(const Vector3& value) {
+        return Vector3(std::sqrt(value.X), std::sqrt(value.Y), std::sqrt(value.Z));
+    }
+
+    static Vector3 Subtract(const Vector3& left, const Vector3& right) {
+        return Vector3(left.X - right.X, left.Y - right.Y, left.Z - right.Z);
+    }
+
+    static Vector3 Transform(const Vector3& position, const Matrix4x4& matrix);
+    static Vector3 Transform(const Vector3& value, const Quaternion& rotation);
+    static Vector3 TransformNormal(const Vector3& normal, const Matrix4x4& matrix);
+
+    float Length() const {
+        return std::sqrt(LengthSquared());
+    }
+
+    float LengthSquared() const {
+        return Dot(*this, *this);
+    }
+
+    bool Equals(const Vector3& other) const {
+        return X == other.X && Y == other.Y && Z == other.Z;
+    }
+
+    int32_t GetHashCode() const {
+        return CombineNumericsHashCode(CombineNumericsHashCode(Number::GetHashCode(X), Y), Z);
+    }
+
+    std::string ToString() const {
+        return "<" + String::ToJoinString(X) + ", " + String::ToJoinString(Y) + ", " + String::ToJoinString(Z) + ">";
+    }
+
+    Vector3 operator-() const {
+        return Negate(*this);
+    }
+
+private:
+    static void ValidateIndex(int32_t index) {
+        if (index < 0 || index >= 3) {
+            throw ArgumentOutOfRangeException("index");
+        }
+    }
+};
+
+inline Vector3 operator+(const Vector3& left, const Vector3& right) {
+    return Vector3::Add(left, right);
+}
+
+inline Vector3 operator-(const Vector3& left, const Vector3& right) {
+    return Vector3::Subtract(left, right);
+}
+
+inline Vector3 operator*(const Vector3& left, const Vector3& right) {
+    return Vector3::Multiply(left, right);
+}
+
+inline Vector3 operator*(const Vector3& left, float right) {
+    return Vector3::Multiply(left, right);
+}
+
+inline Vector3 operator*(float left, const Vector3& right) {
+    return Vector3::Multiply(right, left);
+}
+
+inline Vector3 operator/(const Vector3& left, const Vector3& right) {
+    return Vector3::Divide(left, right);
+}
+
+inline Vector3 operator/(const Vector3& left, float right) {
+    return Vector3::Divide(left, right);
+}
+
+inline bool operator==(const Vector3& left, const Vector3& right) {
+    return left.Equals(right);
+}
+
+inline bool operator!=(const Vector3& left, const Vector3& right) {
+    return !left.Equals(right);
+}
+
+/// <summary>
+/// Managed System.Numerics.Vector4, 16-byte aligned so every operation is one Float4Lanes register operation.
+/// </summary>
+class alignas(16) Vector4 {
+public:
+    float X;
+    float Y;
+    float Z;
+    float W;
+
+    Vector4()
+        : X(0.0f), Y(0.0f), Z(0.0f), W(0.0f) {
+    }
+
+    explicit Vector4(float value)
+        : X(value), Y(value), Z(value), W(value) {
+    }
+
+    Vector4(const Vector2& value, float z, float w)
+        : X(value.X), Y(value.Y), Z(z), W(w) {
+    }
+
+    Vector4(const Vector3& value, float w)
+        : X(value.X), Y(value.Y), Z(value.Z), W(w) {
+    }
+
+    Vector4(float x, float y, float z, float w)
+        : X(x), Y(y), Z(z), W(w) {
+    }
+
+    static Vector4 get_Zero() {
+        return Vector4();
+    }
+
+    static Vector4 get_One() {
+        return Vector4(1.0f);
+    }
+
+    static Vector4 get_UnitX() {
+        return Vector4(1.0f, 0.0f, 0.0f, 0.0f);
+    }
+
+    static Vector4 get_UnitY() {
+        return Vector4(0.0f, 1.0f, 0.0f, 0.0f);
+    }
+
+    static Vector4 get_UnitZ() {
+        return Vector4(0.0f, 0.0f, 1.0f, 0.0f);
+    }
+
+    static Vector4 get_UnitW() {
+        return Vector4(0.0f, 0.0f, 0.0f, 1.0f);
+    }
+
+    float get_Item(int32_t index) const {
+        ValidateIndex(index);
+        return (&X)[index];
+    }
+
+    void set_Item(int32_t index, float value) {
+        ValidateIndex(index);
+        (&X)[index] = value;
+    }
+
+    /// <summary>
+    /// Loads the components as one register. The load is unaligned because a packed struct or a raw buffer can hold a
+    /// Vector4 below its natural 16-byte alignment.
+    /// </summary>
+    Float4Lanes::Register LoadRegister() const {
+        return Float4Lanes::LoadUnaligned(&X);
+    }
+
+    static Vector4 FromRegister(Float4Lanes::Register value) {
+        Vector4 result;
+        Float4Lanes::StoreUnaligned(&result.X, value);
+        return result;
+    }
+
+    static Vector4 Abs(const Vector4& value) {
+        return FromRegister(Float4Lanes::Abs(value.LoadRegister()));
+    }
+
+    static Vector4 Add(const Vector4& left, const Vector4& right) {
+        return FromRegister(Float4Lanes::Add(left.LoadRegister(), right.LoadRegister()));
+    }
+
+    static Vector4 Clamp(const Vector4& value, const Vector4& min, const Vector4& max) {
+        return FromRegister(Float4Lanes::Min(Float4Lanes::Max(value.LoadRegister(), min.LoadRegister()), max.LoadRegister()));
+    }
+
+    static float Distance(const Vector4& left, const Vector4& right) {
+        return std::sqrt(DistanceSquared(left, right));
+    }
+
+    static float DistanceSquared(const Vector4& left, const Vector4& right) {
+        Float4Lanes::Register difference = Float4Lanes::Subtract(left.LoadRegister(), right.LoadRegister());
+        return Float4Lanes::Dot(difference, difference);
+    }
+
+    static Vector4 Divide(const Vector4& left, const Vector4& right) {
+        return FromRegister(Float4Lanes::Divide(left.LoadRegister(), right.LoadRegister()));
+    }
+
+    static Vector4 Divide(const Vector4& left, float divisor) {
+        return FromRegister(Float4Lanes::Divide(left.LoadRegister(), Float4Lanes::Broadcast(divisor)));
+    }
+
+    static float Dot(const Vector4& left, const Vector4& right) {
+        return Float4Lanes::Dot(left.LoadRegister(), right.LoadRegister());
+    }
+
+    static Vector4 Lerp(const Vector4& left, const Vector4& right, float amount) {
+        Float4Lanes::Register start = left.LoadRegister();
+        return FromRegister(Float4Lanes::MultiplyAdd(Float4Lanes::Subtract(right.LoadRegister(), start), Float4Lanes::Broadcast(amount), start));
+    }
+
+    static Vector4 Max(const Vector4& left, const Vector4& right) {
+        return FromRegister(Float4Lanes::Max(left.LoadRegister(), right.LoadRegister()));
+    }
+
+    static Vector4 Min(const Vector4& left, const Vector4& right) {
+        return FromRegister(Float4Lanes::Min(left.LoadRegister(), right.LoadRegister()));
+    }
+
+    static Vector4 Multiply(const Vector4& left, const Vector4& right) {
+        return FromRegister(Float4Lanes::Multiply(left.LoadRegister(), right.LoadRegister()));
+    }
+
+    static Vector4 Multiply(const Vector4& left, float right) {
+        return FromRegister(Float4Lanes::Multiply(left.LoadRegister(), Float4Lanes::Broadcast(right)));
+    }
+
+    static Vector4 Multiply(float left, const Vector4& right) {
+        return Multiply(right, left);
+    }
+
+    static Vector4 Negate(const Vector4& value) {
+        return FromRegister(Float4Lanes::Negate(value.LoadRegister()));
+    }
+
+    static Vector4 Normalize(const Vector4& value) {
+        Float4Lanes::Register lanes = value.LoadRegister();
+        return FromRegister(Float4Lanes::Divide(lanes, Float4Lanes::Broadcast(std::sqrt(Float4Lanes::Dot(lanes, lanes)))));
+    }
+
+    static Vector4 SquareRoot(const Vector4& value) {
+        return FromRegister(Float4Lanes::Sqrt(value.LoadRegister()));
+    }
+
+    static Vector4 Subtract(const Vector4& left, const Vector4& right) {
+        return FromRegister(Float4Lanes::Subtract(left.LoadRegister(), right.LoadRegister()));
+    }
+
+    static Vector4 Transform(const Vector2& position, const Matrix4x4& matrix);
+    static Vector4 Transform(const Vector3& position, const Matrix4x4& matrix);
+    static Vector4 Transform(const Vector4& vector, const Matrix4x4& matrix);
+    static Vector4 Transform(const Vector2& value, const Quaternion& rotation);
+    static Vector4 Transform(const Vector3& value, const Quaternion& rotation);
+    static Vector4 Transform(const Vector4& value, const Quaternion& rotation);
+
+    float Length() const {
+        return std::sqrt(LengthSquared());
+    }
+
+    float LengthSquared() const {
+        return Dot(*this, *this);
+    }
+
+    bool Equals(const Vector4& other) const {
+        return Float4Lanes::EqualsAll(LoadRegister(), other.LoadRegister());
+    }
+
+    int32_t GetHashCode() const {
+        return CombineNumericsHashCode(CombineNumericsHashCode(CombineNumericsHashCode(Number::GetHashCode(X), Y), Z), W);
+    }
+
+    std::string ToString() const {
+        return "<" + String::ToJoinString(X) + ", " + String::ToJoinString(Y) + ", " + String::ToJoinString(Z) + ", " +
+            String::ToJoinString(W) + ">";
+    }
+
+    Vector4 operator-() const {
+        return Negate(*this);
+    }
+
+private:
+    static void ValidateIndex(int32_t index) {
+        if (index < 0 || index >= 4) {
+            throw ArgumentOutOfRangeException("index");
+        }
+    }
+};
+
+static_assert(sizeof(Vector2) == 8, "Vector2 must keep the managed layout.");
+static_assert(sizeof(Vector3) == 12, "Vector3 must keep the managed layout.");
+static_assert(sizeof(Vector4) == 16 && alignof(Vector4) == 16, "Vector4 must fill exactly one aligned register.");
+
+inline Vector4 operator+(const Vector4& left, const Vector4& right) {
+    return Vector4::Add(left, right);
+}
+
+inline Vector4 operator-(const Vector4& left, const Vector4& right) {
+    return Vector4::Subtract(left, right);
+}
+
+inline Vector4 operator*(const Vector4& left, const Vector4& right) {
+    return Vector4::Multiply(left, right);
+}
+
+inline Vector4 operator*(const Vector4& left, float right) {
+    return Vector4::Multiply(left, right);
+}
+
+inline Vector4 operator*(float left, const Vector4& right) {
+    return Vector4::Multiply(right, left);
+}
+
+inline Vector4 operator/(const Vector4& left, const Vector4& right) {
+    return Vector4::Divide(left, right);
+}
+
+inline Vector4 operator/(const Vector4& left, float right) {
+    return Vector4::Divide(left, right);
+}
+
+inline bool operator==(const Vector4& left, const Vector4& right) {
+    return left.Equals(right);
+}
+
+inline bool operator!=(const Vector4& left, const Vector4& right) {
+    return !left.Equals(right);
+}
+
+/// <summary>
+/// Managed System.Numerics.Quaternion, laid out and aligned like Vector4 so the component-wise operations and the
+/// Lerp/Slerp blends run on one register.
+/// </summary>
+class alignas(16) Quaternion {
+public:
+    float X;
+    float Y;
+    float Z;
+    float W;
+
+    Quaternion()
+        : X(0.0f), Y(0.0f), Z(0.0f), W(0.0f) {
+    }
+
+    Quaternion(const Vector3& vectorPart, float scalarPart)
+        : X(vectorPart.X), Y(vectorPart.Y), Z(vectorPart.Z), W(scalarPart) {
+    }
+
+    Quaternion(float x, float y, float z, float w)
+        : X(x), Y(y), Z(z), W(w) {
+    }
+
+    static Quaternion get_Identity() {
+        return Quaternion(0.0f, 0.0f, 0.0f, 1.0f);
+    }
+
+    static Quaternion get_Zero() {
+        return Quaternion();
+    }
+
+    bool get_IsIdentity() const {
+        return Equals(get_Identity());
+    }
+
+    float get_Item(int32_t index) const {
+        ValidateIndex(index);
+        return (&X)[index];
+    }
+
+    void set_Item(int32_t index, float value) {
+        ValidateIndex(index);
+        (&X)[index] = value;
+    }
+
+    Float4Lanes::Register LoadRegister() const {
+        return Float4Lanes::LoadUnaligned(&X);
+    }
+
+    static Quaternion FromRegister(Float4Lanes::Register value) {
+        Quaternion result;
+        Float4Lanes::StoreUnaligned(&result.X, value);
+        return result;
+    }
+
+    static Quaternion Add(const Quaternion& left, const Quaternion& right) {
+        return FromRegister(Float4Lanes::Add(left.LoadRegister(), right.LoadRegister()));
+    }
+
+    /// <summary>
+    /// Returns the rotation <paramref name="value1"/> followed by <paramref name="value2"/>.
+    /// </summary>
+    static Quaternion Concatenate(const Quaternion& value1, const Quaternion& value2) {
+        return Multiply(value2, value1);
+    }
+
+    static Quaternion Conjugate(const Quaternion& value) {
+        return Quaternion(-value.X, -value.Y, -value.Z, value.W);
+    }
+
+    static Quaternion CreateFromAxisAngle(const Vector3& axis, float angle) {
+        float halfAngle = angle * 0.5f;
+        float sine = std::sin(halfAngle);
+        return Quaternion(axis.X * sine, axis.Y * sine, axis.Z * sine, std::cos(halfAngle));
+    }
+
+    static Quaternion CreateFromRotationMatrix(const Matrix4x4& matrix);
+
+    static Quaternion CreateFromYawPitchRoll(float yaw, float pitch, float roll) {
+        float sinRoll = std::sin(roll * 0.5f);
+        float cosRoll = std::cos(roll * 0.5f);
+        float sinPitch = std::sin(pitch * 0.5f);
+        float cosPitch = std::cos(pitch * 0.5f);
+        float sinYaw = std::sin(yaw * 0.5f);
+        float cosYaw = std::cos(yaw * 0.5f);
+        return Quaternion(
+            cosYaw * sinPitch * cosRoll + sinYaw * cosPitch * sinRoll,
+            sinYaw * cosPitch * cosRoll - cosYaw * sinPitch * sinRoll,
+            cosYaw * cosPitch * sinRoll - sinYaw * sinPitch * cosRoll,
+            cosYaw * cosPitch * cosRoll + sinYaw * sinPitch * sinRoll);
+    }
+
+    static Quaternion Divide(const Quaternion& left, const Quaternion& right) {
+        return Multiply(left, Inverse(right));
+    }
+
+    static float Dot(const Quaternion& left, const Quaternion& right) {
+        return Float4Lanes::Dot(left.LoadRegister(), right.LoadRegister());
+    }
+
+    static Quaternion Inverse(const Quaternion& value) {
+        float inverseNorm = 1.0f / value.LengthSquared();
+        return Quaternion(-value.X * inverseNorm, -value.Y * inverseNorm, -value.Z * inverseNorm, value.W * inverseNorm);
+    }
+
+    static Quaternion Lerp(const Quaternion& quaternion1, const Quaternion& quaternion2, float amount) {
+        Float4Lanes::Register start = quaternion1.LoadRegister();
+        Float4Lanes::Register end = quaternion2.LoadRegister();
+        Float4Lanes::Register endWeight = Float4Lanes::Broadcast(Float4Lanes::Dot(start, end) >= 0.0f ? amount : -amount);
+        Float4Lanes::Register blended = Float4Lanes::MultiplyAdd(
+            end,
+            endWeight,
+            Float4Lanes::Multiply(start, Float4Lanes::Broadcast(1.0f - amount)));
+        return FromRegister(Float4Lanes::Divide(blended, Float4Lanes::Broadcast(std::sqrt(Float4Lanes::Dot(blended, blended)))));
+    }
+
+    static Quaternion Multiply(const Quaternion& left, const Quaternion& right) {
+        float crossX = left.Y * right.Z - left.Z * right.Y;
+        float crossY = left.Z * right.X - left.X * right.Z;
+        float crossZ = left.X * right.Y - left.Y * right.X;
+        float dot = left.X * right.X + left.Y * right.Y + left.Z * right.Z;
+        return Quaternion(
+            left.X * right.W + right.X * left.W + crossX,
+            left.Y * right.W + right.Y * left.W + crossY,
+            left.Z * right.W + right.Z * left.W + crossZ,
+            left.W * right.W - dot);
+    }
+
+    static Quaternion Multiply(const Quaternion& left, float right) {
+        return FromRegister(Float4Lanes::Multiply(left.LoadRegister(), Float4Lanes::Broadcast(right)));
+    }
+
+    static Quaternion Negate(const Quaternion& value) {
+        return FromRegister(Float4Lanes::Negate(value.LoadRegister()));
+    }
+
+    static Quaternion Normalize(const Quaternion& value) {
+        Float4Lanes::Register lanes = value.LoadRegister();
+        return FromRegister(Float4Lanes::Divide(lanes, Float4Lanes::Broadcast(std::sqrt(Float4Lanes::Dot(lanes, lanes)))));
+    }
+
+    static Quaternion Slerp(const Quaternion& quaternion1, const Quaternion& quaternion2, float amount) {
+        constexpr float SlerpEpsilon = 1e-6f;
+
+        float cosOmega = Dot(quaternion1, quaternion2);
+        bool flip = false;
+        if (cosOmega < 0.0f) {
+            flip = true;
+            cosOmega = -cosOmega;
+        }
+
+        float startWeight;
+        float endWeight;
+        if (cosOmega > 1.0f - SlerpEpsilon) {
+            startWeight = 1.0f - amount;
+            endWeight = flip ? -amount : amount;
+        } else {
+            float omega = std::acos(cosOmega);
+            float inverseSinOmega = 1.0f / std::sin(omega);
+            startWeight = std::sin((1.0f - amount) * omega) * inverseSinOmega;
+            endWeight = flip
+                ? -std::sin(amount * omega) * inverseSinOmega
+                : std::sin(amount * omega) * inverseSinOmega;
+        }
+
+        return FromRegister(Float4Lanes::MultiplyAdd(
+            quaternion2.LoadRegister(),
+            Float4Lanes::Broadcast(endWeight),
+            Float4Lanes::Multiply(quaternion1.LoadRegister(), Float4Lanes::Broadcast(startWeight))));
+    }
+
+    static Quaternion Subtract(const Quaternion& left, const Quaternion& right) {
+        return FromRegister(Float4Lanes::Subtract(left.LoadRegister(), right.LoadRegister()));
+    }
+
+    float Length() const {
+        return std::sqrt(LengthSquared());
+    }
+
+    float LengthSquared() const {
+        return Dot(*this, *this);
+    }
+
+    bool Equals(const Quaternion& other) const {
+        return Float4Lanes::EqualsAll(LoadRegister(), other.LoadRegister());
+    }
+
+    int32_t GetHashCode() const {
+        return CombineNumericsHashCode(CombineNumericsHashCode(CombineNumericsHashCode(Number::GetHashCode(X), Y), Z), W);
+    }
+
+    std::string ToString() const {
+        return "{X:" + String::ToJoinString(X) + " Y:" + String::ToJoinString(Y) + " Z:" + String::ToJoinString(Z) +
+            " W:" + String::ToJoinString(W) + "}";
+    }
+
+    Quaternion operator-() const {
+        return Negate(*this);
+    }
+
+private:
+    static void ValidateIndex(int32_t index) {
+        if (index < 0 || index >= 4) {
+            throw ArgumentOutOfRangeException("index");
+        }
+    }
+};
+
+static_assert(sizeof(Quaternion) == 16 && alignof(Quaternion) == 16, "Quaternion must fill exactly one aligned register.");
+
+inline Quaternion operator+(const Quaternion& left, const Quaternion& right) {
+    return Quaternion::Add(left, right);
+}
+
+inline Quaternion operator-(const Quaternion& left, const Quaternion& right) {
+    return Quaternion::Subtract(left, right);
+}
+
+inline Quaternion operator*(const Quaternion& left, const Quaternion& right) {
+    return Quaternion::Multiply(left, right);
+}
+
+inline Quaternion operator*(const Quaternion& left, float right) {
+    return Quaternion::Multiply(left, right);
+}
+
+inline Quaternion operator/(const Quaternion& left, const Quaternion& right) {
+    return Quaternion::Divide(left, right);
+}
+
+inline bool operator==(const Quaternion& left, const Quaternion& right) {
+    return left.Equals(right);
+}
+
+inline bool operator!=(const Quaternion& left, const Quaternion& right) {
+    return !left.Equals(right);
+}
+
+/// <summary>
+/// Managed System.Numerics.Plane: the 12-byte Normal followed by D fills one aligned register, which Dot reads whole.
+/// </summary>
+class alignas(16) Plane {
+public:
+    Vector3 Normal;
+    float D;
+
+    Plane()
+        : Normal(), D(0.0f) {
+    }
+
+    Plane(float x, float y, float z, float d)
+        : Normal(x, y, z), D(d) {
+    }
+
+    Plane(const Vector3& normal, float d)
+        : Normal(normal), D(d) {
+    }
+
+    explicit Plane(const Vector4& value)
+        : Normal(value.X, value.Y, value.Z), D(value.W) {
+    }
+
+    Float4Lanes::Register LoadRegister() const {
+        return Float4Lanes::LoadUnaligned(&Normal.X);
+    }
+
+    static Plane CreateFromVertices(const Vector3& point1, const Vector3& point2, const Vector3& point3) {
+        Vector3 normal = Vector3::Normalize(Vector3::Cross(point2 - point1, point3 - point1));
+        return Plane(normal, -Vector3::Dot(normal, point1));
+    }
+
+    static float Dot(const Plane& plane, const Vector4& value) {
+        return Float4Lanes::Dot(plane.LoadRegister(), value.LoadRegister());
+    }
+
+    static float DotCoordinate(const Plane& plane, const Vector3& value) {
+        return Vector3::Dot(plane.Normal, value) + plane.D;
+    }
+
+    static float DotNormal(const Plane& plane, const Vector3& value) {
+        return Vector3::Dot(plane.Normal, value);
+    }
+
+    static Plane Normalize(const Plane& value) {
+        constexpr float NormalizeEpsilon = 1.192092896e-07f;
+
+        float normalLengthSquared = value.Normal.LengthSquared();
+        if (std::fabs(normalLengthSquared - 1.0f) < NormalizeEpsilon) {
+            return value;
+        }
+
+        float normalLength = std::sqrt(normalLengthSquared);
+        return Plane(value.Normal / normalLength, value.D / normalLength);
+    }
+
+    static Plane Transform(const Plane& plane, const Matrix4x4& matrix);
+
+    static Plane Transform(const Plane& plane, const Quaternion& rotation) {
+        return Plane(Vector3::Transform(plane.Normal, rotation), plane.D);
+    }
+
+    bool Equals(const Plane& other) const {
+        return Float4Lanes::EqualsAll(LoadRegister(), other.LoadRegister());
+    }
+
+    int32_t GetHashCode() const {
+        return CombineNumericsHashCode(Normal.GetHashCode(), D);
+    }
+
+    std::string ToString() const {
+        return "{Normal:" + Normal.ToString() + " D:" + String::ToJoinString(D) + "}";
+    }
+};
+
+static_assert(sizeof(Plane) == 16 && alignof(Plane) == 16, "Plane must fill exactly one aligned register.");
+
+inline bool operator==(const Plane& left, const Plane& right) {
+    return left.Equals(right);
+}
+
+inline bool operator!=(const Plane& left, const Plane& right) {
+    return !left.Equals(right);
+}
+
+/// <summary>
+/// Managed System.Numerics.Matrix4x4: row-vector semantics (<c>Transform(v, a * b)</c> applies <c>a</c> first) over four
+/// aligned registers. Rows are the registers by default; under HE_CPP_MATH_COLUMN_VECTOR the fields are declared
+/// column by column, so each register holds a column and the memory image is the transposed matrix a column-vector
+/// graphics API expects. Named-field code is the same under both layouts; only the register kernels below differ.
+/// </summary>
+class alignas(16) Matrix4x4 {
+public:
+#if HE_CPP_MATH_COLUMN_VECTOR
+    float M11;
+    float M21;
+    float M31;
+    float M41;
+    float M12;
+    float M22;
+    float M32;
+    float M42;
+    float M13;
+    float M23;
+    float M33;
+    float M43;
+    float M14;
+    float M24;
+    float M34;
+    float M44;
+#else
+    float M11;
+    float M12;
+    float M13;
+    float M14;
+    float M21;
+    float M22;
+    float M23;
+    float M24;
+    float M31;
+    float M32;
+    float M33;
+    float M34;
+    float M41;
+    float M42;
+    float M43;
+    float M44;
+#endif
+
+    Matrix4x4() {
+        Float4Lanes::Register zero = Float4Lanes::Broadcast(0.0f);
+        for (int32_t registerIndex = 0; registerIndex < 4; ++registerIndex) {
+            StoreRegister(registerIndex, zero);
+        }
+    }
+
+    Matrix4x4(
+        float m11, float m12, float m13, float m14,
+        float m21, float m22, float m23, float m24,
+        float m31, float m32, float m33, float m34,
+        float m41, float m42, float m43, float m44) {
+        M11 = m11;
+        M12 = m12;
+        M13 = m13;
+        M14 = m14;
+        M21 = m21;
+        M22 = m22;
+        M23 = m23;
+        M24 = m24;
+        M31 = m31;
+        M32 = m32;
+        M33 = m33;
+        M34 = m34;
+        M41 = m41;
+        M42 = m42;
+        M43 = m43;
+        M44 = m44;
+    }
+
+    static Matrix4x4 get_Identity() {
+        return Matrix4x4(
+            1.0f, 0.0f, 0.0f, 0.0f,
+            0.0f, 1.0f, 0.0f, 0.0f,
+            0.0f, 0.0f, 1.0f, 0.0f,
+            0.0f, 0.0f, 0.0f, 1.0f);
+    }
+
+    bool get_IsIdentity() const {
+        return Equals(get_Identity());
+    }
+
+    Vector3 get_Translation() const {
+        return Vector3(M41, M42, M43);
+    }
+
+    void set_Translation(const Vector3& value) {
+        M41 = value.X;
+        M42 = value.Y;
+        M43 = value.Z;
+    }
+
+    float get_Item(int32_t row, int32_t column) const {
+        ValidateIndex(row, column);
+        return (&M11)[StorageIndex(row, column)];
+    }
+
+    void set_Item(int32_t row, int32_t column, float value) {
+        ValidateIndex(row, column);
+        (&M11)[StorageIndex(row, column)] = value;
+    }
+
+    /// <summary>
+    /// Loads storage register <paramref name="registerIndex"/>: row registerIndex + 1, or that column under
+    /// HE_CPP_MATH_COLUMN_VECTOR.
+    /// </summary>
+    Float4Lanes::Register LoadRegister(int32_t registerIndex) const {
+        return Float4Lanes::LoadUnaligned(&M11 + registerIndex * 4);
+    }
+
+    void StoreRegister(int32_t registerIndex, Float4Lanes::Register value) {
+        Float4Lanes::StoreUnaligned(&M11 + registerIndex * 4, value);
+    }
+
+    /// <summary>
+    /// Loads the four rows whatever the storage layout, for transforming row vectors.
+    /// </summary>
+    void LoadRows(Float4Lanes::Register& row0, Float4Lanes::Register& row1, Float4Lanes::Register& row2, Float4Lanes::Register& row3) const {
+        row0 = LoadRegister(0);
+        row1 = LoadRegister(1);
+        row2 = LoadRegister(2);
+        row3 = LoadRegister(3);
+#if HE_CPP_MATH_COLUMN_VECTOR
+        Float4Lanes::Transpose(row0, row1, row2, row3);
+#endif
+    }
+
+    static Matrix4x4 Add(const Matrix4x4& left, const Matrix4x4& right) {
+        Matrix4x4 result;
+        for (int32_t registerIndex = 0; registerIndex < 4; ++registerIndex) {
+            result.StoreRegister(registerIndex, Float4Lanes::Add(left.LoadRegister(registerIndex), right.LoadRegister(registerIndex)));
+        }
+        return result;
+    }
+
+    static Matrix4x4 CreateFromAxisAngle(const Vector3& axis, float angle) {
+        float x = axis.X;
+        float y = axis.Y;
+        float z = axis.Z;
+        float sine = std::sin(angle);
+        float cosine = std::cos(angle);
+        float xx = x * x;
+        float yy = y * y;
+        float zz = z * z;
+        float xy = x * y;
+        float xz = x * z;
+        float yz = y * z;
+
+        Matrix4x4 result = get_Identity();
+        result.M11 = xx + cosine * (1.0f - xx);
+        result.M12 = xy - cosine * xy + sine * z;
+        result.M13 = xz - cosine * xz - sine * y;
+        result.M21 = xy - cosine * xy - sine * z;
+        result.M22 = yy + cosine * (1.0f - yy);
+        result.M23 = yz - cosine * yz + sine * x;
+        result.M31 = xz - cosine * xz + sine * y;
+        result.M32 = yz - cosine * yz - sine * x;
+        result.M33 = zz + cosine * (1.0f - zz);
+        return result;
+    }
+
+    static Matrix4x4 CreateFromQuaternion(const Quaternion& quaternion) {
+        float xx = quaternion.X * quaternion.X;
+        float yy = quaternion.Y * quaternion.Y;
+        float zz = quaternion.Z * quaternion.Z;
+        float xy = quaternion.X * quaternion.Y;
+        float wz = quaternion.Z * quaternion.W;
+        float xz = quaternion.Z * quaternion.X;
+        float wy = quaternion.Y * quaternion.W;
+        float yz = quaternion.Y * quaternion.Z;
+        float wx = quaternion.X * quaternion.W;
+
+        Matrix4x4 result = get_Identity();
+        result.M11 = 1.0f - 2.0f * (yy + zz);
+        result.M12 = 2.0f * (xy + wz);
+        result.M13 = 2.0f * (xz - wy);
+        result.M21 = 2.0f * (xy - wz);
+        result.M22 = 1.0f - 2.0f * (zz + xx);
+        result.M23 = 2.0f * (yz + wx);
+        result.M31 = 2.0f * (xz + wy);
+        result.M32 = 2.0f * (yz - wx);
+        result.M33 = 1.0f - 2.0f * (yy + xx);
+        return result;
+    }
+
+    static Matrix4x4 CreateFromYawPitchRoll(float yaw, float pitch, float roll) {
+        return CreateFromQuaternion(Quaternion::CreateFromYawPitchRoll(yaw, pitch, roll));
+    }
+
+    static Matrix4x4 CreateLookAt(const Vector3& cameraPosition, const Vector3& cameraTarget, const Vector3& cameraUpVector) {
+        Vector3 zAxis = Vector3::Normalize(cameraPosition - cameraTarget);
+        Vector3 xAxis = Vector3::Normalize(Vector3::Cross(cameraUpVector, zAxis));
+        Vector3 yAxis = Vector3::Cross(zAxis, xAxis);
+        return Matrix4x4(
+            xAxis.X, yAxis.X, zAxis.X, 0.0f,
+            xAxis.Y, yAxis.Y, zAxis.Y, 0.0f,
+            xAxis.Z, yAxis.Z, zAxis.Z, 0.0f,
+            -Vector3::Dot(xAxis, cameraPosition), -Vector3::Dot(yAxis, cameraPosition), -Vector3::Dot(zAxis, cameraPosition), 1.0f);
+    }
+
+    static Matrix4x4 CreateOrthographic(float width, float height, float zNearPlane, float zFarPlane) {
+        Matrix4x4 result = get_Identity();
+        result.M11 = 2.0f / width;
+        result.M22 = 2.0f / height;
+        result.M33 = 1.0f / (zNearPlane - zFarPlane);
+        result.M43 = zNearPlane * result.M33;
+        return result;
+    }
+
+    static Matrix4x4 CreateOrthographicOffCenter(float left, float right, float bottom, float top, float zNearPlane, float zFarPlane) {
+        Matrix4x4 result = get_Identity();
+        result.M11 = 2.0f / (right - left);
+        result.M22 = 2.0f / (top - bottom);
+        result.M33 = 1.0f / (zNearPlane - zFarPlane);
+        result.M41 = (left + right) / (left - right);
+        result.M42 = (top + bottom) / (bottom - top);
+        result.M43 = zNearPlane / (zNearPlane - zFarPlane);
+        return result;
+    }
+
+    static Matrix4x4 CreatePerspective(float width, float height, float nearPlaneDistance, float farPlaneDistance) {
+        ValidatePlaneDistances(nearPlaneDistance, farPlaneDistance);
+
+        Matrix4x4 result;
+        result.M11 = 2.0f * nearPlaneDistance / width;
+        result.M22 = 2.0f * nearPlaneDistance / height;
+        ApplyPerspectiveDepth(result, nearPlaneDistance, farPlaneDistance);
+        return result;
+    }
+
+    static Matrix4x4 CreatePerspectiveFieldOfView(float fieldOfView, float aspectRatio, float nearPlaneDistance, float farPlaneDistance) {
+        if (fieldOfView <= 0.0f || fieldOfView >= 3.14159265358979323846f) {
+            throw ArgumentOutOfRangeException("fieldOfView");
+        }
+
+        ValidatePlaneDistances(nearPlaneDistance, farPlaneDistance);
+
+        float yScale = 1.0f / std::tan(fieldOfView * 0.5f);
+        Matrix4x4 result;
+        result.M11 = yScale / aspectRatio;
+        result.M22 = yScale;
+        ApplyPerspectiveDepth(result, nearPlaneDistance, farPlaneDistance);
+        return result;
+    }
+
+    static Matrix4x4 CreatePerspectiveOffCenter(float left, float right, float bottom, float top, float nearPlaneDistance, float farPlaneDistance) {
+        ValidatePlaneDistances(nearPlaneDistance, farPlaneDistance);
+
+        Matrix4x4 result;
+        result.M11 = 2.0f * nearPlaneDistance / (right - left);
+        result.M22 = 2.0f * nearPlaneDistance / (top - bottom);
+        result.M31 = (left + right) / (right - left);
+        result.M32 = (top + bottom) / (top - bottom);
+        ApplyPerspectiveDepth(result, nearPlaneDistance, farPlaneDistance);
+        return result;
+    }
+
+    static Matrix4x4 CreateReflection(const Plane& value) {
+        Plane plane = Plane::Normalize(value);
+        float a = plane.Normal.X;
+        float b = plane.Normal.Y;
+        float c = plane.Normal.Z;
+        float fa = -2.0f * a;
+        float fb = -2.0f * b;
+        float fc = -2.0f * c;
+        return Matrix4x4(
+            fa * a + 1.0f, fb * a, fc * a, 0.0f,
+            fa * b, fb * b + 1.0f, fc * b, 0.0f,
+            fa * c, fb * c, fc * c + 1.0f, 0.0f,
+            fa * plane.D, fb * plane.D, fc * plane.D, 1.0f);
+    }
+
+    static Matrix4x4 CreateRotationX(float radians) {
+        return CreateRotationX(radians, Vector3());
+    }
+
+    static Matrix4x4 CreateRotationX(float radians, const Vector3& centerPoint) {
+        float cosine = std::cos(radians);
+        float sine = std::sin(radians);
+        Matrix4x4 result = get_Identity();
+        result.M22 = cosine;
+        result.M23 = sine;
+        result.M32 = -sine;
+        result.M33 = cosine;
+        result.M42 = centerPoint.Y * (1.0f - cosine) + centerPoint.Z * sine;
+        result.M43 = centerPoint.Z * (1.0f - cosine) - centerPoint.Y * sine;
+        return result;
+    }
+
+    static Matrix4x4 CreateRotationY(float radians) {
+        return CreateRotationY(radians, Vector3());
+    }
+
+    static Matrix4x4 CreateRotationY(float radians, const Vector3& centerPoint) {
+        float cosine = std::cos(radians);
+        float sine = std::sin(radians);
+        Matrix4x4 result = get_Identity();
+        result.M11 = cosine;
+        result.M13 = -sine;
+        result.M31 = sine;
+        result.M33 = cosine;
+        result.M41 = centerPoint.X * (1.0f - cosine) - centerPoint.Z * sine;
+        result.M43 = centerPoint.Z * (1.0f - cosine) + centerPoint.X * sine;
+        return result;
+    }
+
+    static Matrix4x4 CreateRotationZ(float radians) {
+        return CreateRotationZ(radians, Vector3());
+    }
+
+    static Matrix4x4 CreateRotationZ(float radians, const Vector3& centerPoint) {
+        float cosine = std::cos(radians);
+        float sine = std::sin(radians);
+        Matrix4x4 result = get_Identity();
+        result.M11 = cosine;
+        result.M12 = sine;
+        result.M21 = -sine;
+        result.M22 = cosine;
+        result.M41 = centerPoint.X * (1.0f - cosine) + centerPoint.Y * sine;
+        result.M42 = centerPoint.Y * (1.0f - cosine) - centerPoint.X * sine;
+        return result;
+    }
+
+    static Matrix4x4 CreateScale(float scale) {
+        return CreateScale(scale, scale, scale);
+    }
+
+    static Matrix4x4 CreateScale(float scale, const Vector3& centerPoint) {
+        return CreateScale(scale, scale, scale, centerPoint);
+    }
+
+    static Matrix4x4 CreateScale(const Vector3& scales) {
+        return CreateScale(scales.X, scales.Y, scales.Z);
+    }
+
+    static Matrix4x4 CreateScale(const Vector3& scales, const Vector3& centerPoint) {
+        return CreateScale(scales.X, scales.Y, scales.Z, centerPoint);
+    }
+
+    static Matrix4x4 CreateScale(float xScale, float yScale, float zScale) {
+        return CreateScale(xScale, yScale, zScale, Vector3());
+    }
+
+    static Matrix4x4 CreateScale(float xScale, float yScale, float zScale, const Vector3& centerPoint) {
+        Matrix4x4 result = get_Identity();
+        result.M11 = xScale;
+        result.M22 = yScale;
+        result.M33 = zScale;
+        result.M41 = centerPoint.X * (1.0f - xScale);
+        result.M42 = centerPoint.Y * (1.0f - yScale);
+        result.M43 = centerPoint.Z * (1.0f - zScale);
+        return result;
+    }
+
+    static Matrix4x4 CreateTranslation(const Vector3& position) {
+        return CreateTranslation(position.X, position.Y, position.Z);
+    }
+
+    static Matrix4x4 CreateTranslation(float xPosition, float yPosition, float zPosition) {
+        Matrix4x4 result = get_Identity();
+        result.M41 = xPosition;
+        result.M42 = yPosition;
+        result.M43 = zPosition;
+        return result;
+    }
+
+    static Matrix4x4 CreateWorld(const Vector3& position, const Vector3& forward, const Vector3& up) {
+        Vector3 zAxis = Vector3::Normalize(-forward);
+        Vector3 xAxis = Vector3::Normalize(Vector3::Cross(up, zAxis));
+        Vector3 yAxis = Vector3::Cross(zAxis, xAxis);
+        return Matrix4x4(
+            xAxis.X, xAxis.Y, xAxis.Z, 0.0f,
+            yAxis.X, yAxis.Y, yAxis.Z, 0.0f,
+            zAxis.X, zAxis.Y, zAxis.Z, 0.0f,
+            position.X, position.Y, position.Z, 1.0f);
+    }
+
+    /// <summary>
+    /// Splits a scale-rotation-translation matrix into its parts. Returns <c>false</c>, with an identity rotation,
+    /// when the matrix also shears or projects.
+    /// </summary>
+    static bool Decompose(const Matrix4x4& matrix, Vector3& scale, Quaternion& rotation, Vector3& translation) {
+        constexpr float DecomposeEpsilon = 0.0001f;
+
+        translation = matrix.get_Translation();
+        Vector3 basis[3] = {
+            Vector3(matrix.M11, matrix.M12, matrix.M13),
+            Vector3(matrix.M21, matrix.M22, matrix.M23),
+            Vector3(matrix.M31, matrix.M32, matrix.M33)
+        };
+        const Vector3 canonicalBasis[3] = { Vector3::get_UnitX(), Vector3::get_UnitY(), Vector3::get_UnitZ() };
+        float scales[3] = { basis[0].Length(), basis[1].Length(), basis[2].Length() };
+
+        int32_t a;
+        int32_t b;
+        int32_t c;
+        if (scales[0] < scales[1]) {
+            if (scales[1] < scales[2]) {
+                a = 2; b = 1; c = 0;
+            } else {
+                a = 1;
+                if (scales[0] < scales[2]) {
+                    b = 2; c = 0;
+                } else {
+                    b = 0; c = 2;
+                }
+            }
+        } else {
+            if (scales[0] < scales[2]) {
+                a = 2; b = 0; c = 1;
+            } else {
+                a = 0;
+                if (scales[1] < scales[2]) {
+                    b = 2; c = 1;
+                } else {
+                    b = 1; c = 2;
+                }
+            }
+        }
+
+        if (scales[a] < DecomposeEpsilon) {
+            basis[a] = canonicalBasis[a];
+        }
+        basis[a] = Vector3::Normalize(basis[a]);
+
+        if (scales[b] < DecomposeEpsilon) {
+            float absX = std::fabs(basis[a].X);
+            float absY = std::fabs(basis[a].Y);
+            float absZ = std::fabs(basis[a].Z);
+            int32_t leastAligned;
+            if (absX < absY) {
+                leastAligned = absY < absZ ? 0 : (absX < absZ ? 0 : 2);
+            } else {
+                leastAligned = absX < absZ ? 1 : (absY < absZ ? 1 : 2);
+            }
+            basis[b] = Vector3::Cross(basis[a], canonicalBasis[leastAligned]);
+        }
+        basis[b] = Vector3::Normalize(basis[b]);
+
+        if (scales[c] < DecomposeEpsilon) {
+            basis[c] = Vector3::Cross(basis[a], basis[b]);
+        }
+        basis[c] = Vector3::Normalize(basis[c]);
+
+        Matrix4x4 rotationMatrix(
+            basis[0].X, basis[0].Y, basis[0].Z, 0.0f,
+            basis[1].X, basis[1].Y, basis[1].Z, 0.0f,
+            basis[2].X, basis[2].Y, basis[2].Z, 0.0f,
+            0.0f, 0.0f, 0.0f, 1.0f);
+        float determinant = rotationMatrix.GetDeterminant();
+        if (determinant < 0.0f) {
+            scales[a] = -scales[a];
+            basis[a] = -basis[a];
+            rotationMatrix.M11 = basis[0].X;
+            rotationMatrix.M12 = basis[0].Y;
+            rotationMatrix.M13 = basis[0].Z;
+            rotationMatrix.M21 = basis[1].X;
+            rotationMatrix.M22 = basis[1].Y;
+            rotationMatrix.M23 = basis[1].Z;
+            rotationMatrix.M31 = basis[2].X;
+            rotationMatrix.M32 = basis[2].Y;
+            rotationMatrix.M33 = basis[2].Z;
+            determinant = -determinant;
+        }
+
+        scale = Vector3(scales[0], scales[1], scales[2]);
+        determinant -= 1.0f;
+        determinant *= determinant;
+        if (DecomposeEpsilon < determinant) {
+            rotation = Quaternion::get_Identity();
+            return false;
+        }
+
+        rotation = Quaternion::CreateFromRotationMatrix(rotationMatrix);
+        return true;
+    }
+
+    float GetDeterminant() const {
+        float a = M11, b = M12, c = M13, d = M14;
+        float e = M21, f = M22, g = M23, h = M24;
+        float i = M31, j = M32, k = M33, l = M34;
+        float m = M41, n = M42, o = M43, p = M44;
+
+        float kpMinusLo = k * p - l * o;
+        float jpMinusLn = j * p - l * n;
+        float joMinusKn = j * o - k * n;
+        float ipMinusLm = i * p - l * m;
+        float ioMinusKm = i * o - k * m;
+        float inMinusJm = i * n - j * m;
+
+        return a * (f * kpMinusLo - g * jpMinusLn + h * joMinusKn) -
+            b * (e * kpMinusLo - g * ipMinusLm + h * ioMinusKm) +
+            c * (e * jpMinusLn - f * ipMinusLm + h * inMinusJm) -
+            d * (e * joMinusKn - f * ioMinusKm + g * inMinusJm);
+    }
+
+    /// <summary>
+    /// Inverts <paramref name="matrix"/> by cofactor expansion. Returns <c>false</c> and a NaN matrix when it is
+    /// singular.
+    /// </summary>
+    static bool Invert(const Matrix4x4& matrix, Matrix4x4& result) {
+        float a = matrix.M11, b = matrix.M12, c = matrix.M13, d = matrix.M14;
+        float e = matrix.M21, f = matrix.M22, g = matrix.M23, h = matrix.M24;
+        float i = matrix.M31, j = matrix.M32, k = matrix.M33, l = matrix.M34;
+        float m = matrix.M41, n = matrix.M42, o = matrix.M43, p = matrix.M44;
+
+        float kpMinusLo = k * p - l * o;
+        float jpMinusLn = j * p - l * n;
+        float joMinusKn = j * o - k * n;
+        float ipMinusLm = i * p - l * m;
+        float ioMinusKm = i * o - k * m;
+        float inMinusJm = i * n - j * m;
+
+        float a11 = +(f * kpMinusLo - g * jpMinusLn + h * joMinusKn);
+        float a12 = -(e * kpMinusLo - g * ipMinusLm + h * ioMinusKm);
+        float a13 = +(e * jpMinusLn - f * ipMinusLm + h * inMinusJm);
+        float a14 = -(e * joMinusKn - f * ioMinusKm + g * inMinusJm);
+
+        float determinant = a * a11 + b * a12 + c * a13 + d * a14;
+        if (std::fabs(determinant) < 1.401298e-45f) {
+            Float4Lanes::Register nan = Float4Lanes::Broadcast(std::nanf(""));
+            for (int32_t registerIndex = 0; registerIndex < 4; ++registerIndex) {
+                result.StoreRegister(registerIndex, nan);
+            }
+            return false;
+        }
+
+        float inverseDeterminant = 1.0f / determinant;
+
+        result.M11 = a11 * inverseDeterminant;
+        result.M21 = a12 * inverseDeterminant;
+        result.M31 = a13 * inverseDeterminant;
+        result.M41 = a14 * inverseDeterminant;
+
+        result.M12 = -(b * kpMinusLo - c * jpMinusLn + d * joMinusKn) * inverseDeterminant;
+        result.M22 = +(a * kpMinusLo - c * ipMinusLm + d * ioMinusKm) * inverseDeterminant;
+        result.M32 = -(a * jpMinusLn - b * ipMinusLm + d * inMinusJm) * inverseDeterminant;
+        result.M42 = +(a * joMinusKn - b * ioMinusKm + c * inMinusJm) * inverseDeterminant;
+
+        float gpMinusHo = g * p - h * o;
+        float fpMinusHn = f * p - h * n;
+        float foMinusGn = f * o - g * n;
+        float epMinusHm = e * p - h * m;
+        float eoMinusGm = e * o - g * m;
+        float enMinusFm = e * n - f * m;
+
+        result.M13 = +(b * gpMinusHo - c * fpMinusHn + d * foMinusGn) * inverseDeterminant;
+        result.M23 = -(a * gpMinusHo - c * epMinusHm + d * eoMinusGm) * inverseDeterminant;
+        result.M33 = +(a * fpMinusHn - b * epMinusHm + d * enMinusFm) * inverseDeterminant;
+        result.M43 = -(a * foMinusGn - b * eoMinusGm + c * enMinusFm) * inverseDeterminant;
+
+        float glMinusHk = g * l - h * k;
+        float flMinusHj = f * l - h * j;
+        float fkMinusGj = f * k - g * j;
+        float elMinusHi = e * l - h * i;
+        float ekMinusGi = e * k - g * i;
+        float ejMinusFi = e * j - f * i;
+
+        result.M14 = -(b * glMinusHk - c * flMinusHj + d * fkMinusGj) * inverseDeterminant;
+        result.M24 = +(a * glMinusHk - c * elMinusHi + d * ekMinusGi) * inverseDeterminant;
+        result.M34 = -(a * flMinusHj - b * elMinusHi + d * ejMinusFi) * inverseDeterminant;
+        result.M44 = +(a * fkMinusGj - b * ekMinusGi + c * ejMinusFi) * inverseDeterminant;
+        return true;
+    }
+
+    static Matrix4x4 Lerp(const Matrix4x4& matrix1, const Matrix4x4& matrix2, float amount) {
+        Float4Lanes::Register weight = Float4Lanes::Broadcast(amount);
+        Matrix4x4 result;
+        for (int32_t registerIndex = 0; registerIndex < 4; ++registerIndex) {
+            Float4Lanes::Register start = matrix1.LoadRegister(registerIndex);
+            result.StoreRegister(registerIndex, Float4Lanes::MultiplyAdd(Float4Lanes::Subtract(matrix2.LoadRegister(registerIndex), start), weight, start));
+        }
+        return result;
+    }
+
+    /// <summary>
+    /// Returns <c>left * right</c>, the transform that applies <paramref name="left"/> first. Each result register is
+    /// four broadcast multiply-adds over the registers of one operand, so no horizontal sums are needed in either
+    /// layout; the column layout only swaps which operand supplies the broadcast lanes.
+    /// </summary>
+    static Matrix4x4 Multiply(const Matrix4x4& left, const Matrix4x4& right) {
+        Matrix4x4 result;
+#if HE_CPP_MATH_COLUMN_VECTOR
+        MultiplyRegisters(right, left, result);
+#else
+        MultiplyRegisters(left, right, result);
+#endif
+        return result;
+    }
+
+    static Matrix4x4 Multiply(const Matrix4x4& left, float right) {
+        Float4Lanes::Register factor = Float4Lanes::Broadcast(right);
+        Matrix4x4 result;
+        for (int32_t registerIndex = 0; registerIndex < 4; ++registerIndex) {
+            result.StoreRegister(registerIndex, Float4Lanes::Multiply(left.LoadRegister(registerIndex), factor));
+        }
+        return result;
+    }
+
+    static Matrix4x4 Negate(const Matrix4x4& value) {
+        Matrix4x4 result;
+        for (int32_t registerIndex = 0; registerIndex < 4; ++registerIndex) {
+            result.StoreRegister(registerIndex, Float4Lanes::Negate(value.LoadRegister(registerIndex)));
+        }
+        return result;
+    }
+
+    static Matrix4x4 Subtract(const Matrix4x4& left, const Matrix4x4& right) {
+        Matrix4x4 result;
+        for (int32_t registerIndex = 0; registerIndex < 4; ++registerIndex) {
+            result.StoreRegister(registerIndex, Float4Lanes::Subtract(left.LoadRegister(registerIndex), right.LoadRegister(registerIndex)));
+        }
+        return result;
+    }
+
+    /// <summary>
+    /// Applies <paramref name="rotation"/> after <paramref name="value"/>.
+    /// </summary>
+    static Matrix4x4 Transform(const Matrix4x4& value, const Quaternion& rotation) {
+        float x2 = rotation.X + rotation.X;
+        float y2 = rotation.Y + rotation.Y;
+        float z2 = rotation.Z + rotation.Z;
+        float wx2 = rotation.W * x2;
+        float wy2 = rotation.W * y2;
+        float wz2 = rotation.W * z2;
+        float xx2 = rotation.X * x2;
+        float xy2 = rotation.X * y2;
+        float xz2 = rotation.X * z2;
+        float yy2 = rotation.Y * y2;
+        float yz2 = rotation.Y * z2;
+        float zz2 = rotation.Z * z2;
+
+        Matrix4x4 rotationMatrix(
+            1.0f - yy2 - zz2, xy2 + wz2, xz2 - wy2, 0.0f,
+            xy2 - wz2, 1.0f - xx2 - zz2, yz2 + wx2, 0.0f,
+            xz2 + wy2, yz2 - wx2, 1.0f - xx2 - yy2, 0.0f,
+            0.0f, 0.0f, 0.0f, 1.0f);
+        return Multiply(value, rotationMatrix);
+    }
+
+    static Matrix4x4 Transpose(const Matrix4x4& matrix) {
+        Float4Lanes::Register register0 = matrix.LoadRegister(0);
+        Float4Lanes::Register register1 = matrix.LoadRegister(1);
+        Float4Lanes::Register register2 = matrix.LoadRegister(2);
+        Float4Lanes::Register register3 = matrix.LoadRegister(3);
+        Float4Lanes::Transpose(register0, register1, register2, register3);
+
+        Matrix4x4 result;
+        result.StoreRegister(0, register0);
+        result.StoreRegister(1, register1);
+        result.StoreRegister(2, register2);
+        result.StoreRegister(3, register3);
+        return result;
+    }
+
+    bool Equals(const Matrix4x4& other) const {
+        return Float4Lanes::EqualsAll(LoadRegister(0), other.LoadRegister(0)) &&
+            Float4Lanes::EqualsAll(LoadRegister(1), other.LoadRegister(1)) &&
+            Float4Lanes::EqualsAll(LoadRegister(2), other.LoadRegister(2)) &&
+            Float4Lanes::EqualsAll(LoadRegister(3), other.LoadRegister(3));
+    }
+
+    int32_t GetHashCode() const {
+        int32_t hash = 0;
+        for (int32_t row = 0; row < 4; ++row) {
+            for (int32_t column = 0; column < 4; ++column) {
+                hash = CombineNumericsHashCode(hash, (&M11)[StorageIndex(row, column)]);
+            }
+        }
+        return hash;
+    }
+
+    std::string ToString() const {
+        std::string builder = "{ ";
+        for (int32_t row = 0; row < 4; ++row) {
+            builder += "{";
+            for (int32_t column = 0; column < 4; ++column) {
+                builder += "M" + String::ToJoinString(row + 1) + String::ToJoinString(column + 1) + ":" +
+                    String::ToJoinString((&M11)[StorageIndex(row, column)]);
+                if (column < 3) {
+                    builder += " ";
+                }
+            }
+            builder += "} ";
+        }
+        builder += "}";
+        return builder;
+    }
+
+    Matrix4x4 operator-() const {
+        return Negate(*this);
+    }
+
+private:
+    static int32_t StorageIndex(int32_t row, int32_t column) {
+#if HE_CPP_MATH_COLUMN_VECTOR
+        return column * 4 + row;
+#else
+        return row * 4 + column;
+#endif
+    }
+
+    static void ValidateIndex(int32_t row, int32_t column) {
+        if (row < 0 || row >= 4) {
+            throw ArgumentOutOfRangeException("row");
+        }
+
+        if (column < 0 || column >= 4) {
+            throw ArgumentOutOfRangeException("column");
+        }
+    }
+
+    static void ValidatePlaneDistances(float nearPlaneDistance, float farPlaneDistance) {
+        if (nearPlaneDistance <= 0.0f) {
+            throw ArgumentOutOfRangeException("nearPlaneDistance");
+        }
+
+        if (farPlaneDistance <= 0.0f) {
+            throw ArgumentOutOfRangeException("farPlaneDistance");
+        }
+
+        if (nearPlaneDistance >= farPlaneDistance) {
+            throw ArgumentOutOfRangeException("nearPlaneDistance");
+        }
+    }
+
+    static void ApplyPerspectiveDepth(Matrix4x4& result, float nearPlaneDistance, float farPlaneDistance) {
+        float negativeFarRange = std::isinf(farPlaneDistance) ? -1.0f : farPlaneDistance / (nearPlaneDistance - farPlaneDistance);
+        result.M33 = negativeFarRange;
+        result.M34 = -1.0f;
+        result.M43 = nearPlaneDistance * negativeFarRange;
+    }
+
+    /// <summary>
+    /// Writes register i of <paramref name="result"/> as register i of <paramref name="broadcast"/> times the matrix
+    /// whose rows are the registers of <paramref name="rows"/>.
+    /// </summary>
+    static void MultiplyRegisters(const Matrix4x4& broadcast, const Matrix4x4& rows, Matrix4x4& result) {
+        Float4Lanes::Register row0 = rows.LoadRegister(0);
+        Float4Lanes::Register row1 = rows.LoadRegister(1);
+        Float4Lanes::Register row2 = rows.LoadRegister(2);
+        Float4Lanes::Register row3 = rows.LoadRegister(3);
+        for (int32_t registerIndex = 0; registerIndex < 4; ++registerIndex) {
+            result.StoreRegister(registerIndex, Float4Lanes::CombineRows(broadcast.LoadRegister(registerIndex), row0, row1, row2, row3));
+        }
+    }
+};
+
+static_assert(sizeof(Matrix4x4) == 64 && alignof(Matrix4x4) == 16, "Matrix4x4 must fill exactly four aligned registers.");
+
+inline Matrix4x4 operator+(const Matrix4x4& left, const Matrix4x4& right) {
+    return Matrix4x4::Add(left, right);
+}
+
+inline Matrix4x4 operator-(const Matrix4x4& left, const Matrix4x4& right) {
+    return Matrix4x4::Subtract(left, right);
+}
+
+inline Matrix4x4 operator*(const Matrix4x4& left, const Matrix4x4& right) {
+    return Matrix4x4::Multiply(left, right);
+}
+
+inline Matrix4x4 operator*(const Matrix4x4& left, float right) {
+    return Matrix4x4::Multiply(left, right);
+}
+
+inline bool operator==(const Matrix4x4& left, const Matrix4x4& right) {
+    return left.Equals(right);
+}
+
+inline bool operator!=(const Matrix4x4& left, const Matrix4x4& right) {
+    return !left.Equals(right);
+}
+
+/// <summary>
+/// Returns <c>x * row0 + y * row1 + z * row2 + w * row3</c> of <paramref name="matrix"/>, with each weight broadcast
+/// from <paramref name="weights"/>. Lanes whose weight is not used are passed as zero and skipped.
+/// </summary>
+template <int32_t WeightCount, bool AddTranslation>
+inline Float4Lanes::Register TransformByMatrixRows(Float4Lanes::Register weights, const Matrix4x4& matrix) {
+    Float4Lanes::Register row0;
+    Float4Lanes::Register row1;
+    Float4Lanes::Register row2;
+    Float4Lanes::Register row3;
+    matrix.LoadRows(row0, row1, row2, row3);
+
+    Float4Lanes::Register result = Float4Lanes::Multiply(Float4Lanes::BroadcastLane<0>(weights), row0);
+    result = Float4Lanes::MultiplyAdd(Float4Lanes::BroadcastLane<1>(weights), row1, result);
+    if constexpr (WeightCount >= 3) {
+        result = Float4Lanes::MultiplyAdd(Float4Lanes::BroadcastLane<2>(weights), row2, result);
+    }
+
+    if constexpr (WeightCount >= 4) {
+        result = Float4Lanes::MultiplyAdd(Float4Lanes::BroadcastLane<3>(weights), row3, result);
+    } else if constexpr (AddTranslation) {
+        result = Float4Lanes::Add(result, row3);
+    }
+
+    return result;
+}
+
+inline Vector2 Vector2::Transform(const Vector2& position, const Matrix4x4& matrix) {
+    Vector4 result = Vector4::FromRegister(TransformByMatrixRows<2, true>(Float4Lanes::Create(position.X, position.Y, 0.0f, 0.0f), matrix));
+    return Vector2(result.X, result.Y);
+}
+
+inline Vector2 Vector2::Transform(const Vector2& value, const Quaternion& rotation) {
+    Vector4 result = Vector4::Transform(value, rotation);
+    return Vector2(result.X, result.Y);
+}
+
+inline Vector2 Vector2::TransformNormal(const Vector2& normal, const Matrix4x4& matrix) {
+    Vector4 result = Vector4::FromRegister(TransformByMatrixRows<2, false>(Float4Lanes::Create(normal.X, normal.Y, 0.0f, 0.0f), matrix));
+    return Vector2(result.X, result.Y);
+}
+
+inline Vector3 Vector3::Transform(const Vector3& position, const Matrix4x4& matrix) {
+    Vector4 result = Vector4::FromRegister(TransformByMatrixRows<3, true>(Float4Lanes::Create(position.X, position.Y, position.Z, 0.0f), matrix));
+    return Vector3(result.X, result.Y, result.Z);
+}
+
+inline Vector3 Vector3::Transform(const Vector3& value, const Quaternion& rotation) {
+    Vector4 result = Vector4::Transform(value, rotation);
+    return Vector3(result.X, result.Y, result.Z);
+}
+
+inline Vector3 Vector3::TransformNormal(const Vector3& normal, const Matrix4x4& matrix) {
+    Vector4 result = Vector4::FromRegister(TransformByMatrixRows<3, false>(Float4Lanes::Create(normal.X, normal.Y, normal.Z, 0.0f), matrix));
+    return Vector3(result.X, result.Y, result.Z);
+}
+
+inline Vector4 Vector4::Transform(const Vector2& position, const Matrix4x4& matrix) {
+    return FromRegister(TransformByMatrixRows<2, true>(Float4Lanes::Create(position.X, position.Y, 0.0f, 0.0f), matrix));
+}
+
+inline Vector4 Vector4::Transform(const Vector3& position, const Matrix4x4& matrix) {
+    return FromRegister(TransformByMatrixRows<3, true>(Float4Lanes::Create(position.X, position.Y, position.Z, 0.0f), matrix));
+}
+
+inline Vector4 Vector4::Transform(const Vector4& vector, const Matrix4x4& matrix) {
+    return FromRegister(TransformByMatrixRows<4, false>(vector.LoadRegister(), matrix));
+}
+
+inline Vector4 Vector4::Transform(const Vector2& value, const Quaternion& rotation) {
+    return Transform(Vector4(value, 0.0f, 1.0f), rotation);
+}
+
+inline Vector4 Vector4::Transform(const Vector3& value, const Quaternion& rotation) {
+    return Transform(Vector4(value, 1.0f), rotation);
+}
+
+/// <summary>
+/// Rotates the xyz part of <paramref name="value"/> by <paramref name="rotation"/> and keeps w.
+/// </summary>
+inline Vector4 Vector4::Transform(const Vector4& value, const Quaternion& rotation) {
+    float x2 = rotation.X + rotation.X;
+    float y2 = rotation.Y + rotation.Y;
+    float z2 = rotation.Z + rotation.Z;
+    float wx2 = rotation.W * x2;
+    float wy2 = rotation.W * y2;
+    float wz2 = rotation.W * z2;
+    float xx2 = rotation.X * x2;
+    float xy2 = rotation.X * y2;
+    float xz2 = rotation.X * z2;
+    float yy2 = rotation.Y * y2;
+    float yz2 = rotation.Y * z2;
+    float zz2 = rotation.Z * z2;
+
+    Float4Lanes::Register weights = Float4Lanes::Create(value.X, value.Y, value.Z, 0.0f);
+    Float4Lanes::Register result = Float4Lanes::Multiply(
+        Float4Lanes::BroadcastLane<0>(weights),
+        Float4Lanes::Create(1.0f - yy2 - zz2, xy2 + wz2, xz2 - wy2, 0.0f));
+    result = Float4Lanes::MultiplyAdd(
+        Float4Lanes::BroadcastLane<1>(weights),
+        Float4Lanes::Create(xy2 - wz2, 1.0f - xx2 - zz2, yz2 + wx2, 0.0f),
+        result);
+    result = Float4Lanes::MultiplyAdd(
+        Float4Lanes::BroadcastLane<2>(weights),
+        Float4Lanes::Create(xz2 + wy2, yz2 - wx2, 1.0f - xx2 - yy2, 0.0f),
+        result);
+
+    Vector4 rotated = FromRegister(result);
+    rotated.W = value.W;
+    return rotated;
+}
+
+/// <summary>
+/// Builds the rotation from the upper 3x3 of <paramref name="matrix"/>, which must be orthonormal.
+/// </summary>
+inline Quaternion Quaternion::CreateFromRotationMatrix(const Matrix4x4& matrix) {
+    float trace = matrix.M11 + matrix.M22 + matrix.M33;
+    if (trace > 0.0f) {
+        float root = std::sqrt(trace + 1.0f);
+        float inverseRoot = 0.5f / root;
+        return Quaternion(
+            (matrix.M23 - matrix.M32) * inverseRoot,
+            (matrix.M31 - matrix.M13) * inverseRoot,
+            (matrix.M12 - matrix.M21) * inverseRoot,
+            root * 0.5f);
+    }
+
+    if (matrix.M11 >= matrix.M22 && matrix.M11 >= matrix.M33) {
+        float root = std::sqrt(1.0f + matrix.M11 - matrix.M22 - matrix.M33);
+        float inverseRoot = 0.5f / root;
+        return Quaternion(
+            0.5f * root,
+            (matrix.M12 + matrix.M21) * inverseRoot,
+            (matrix.M13 + matrix.M31) * inverseRoot,
+            (matrix.M23 - matrix.M32) * inverseRoot);
+    }
+
+    if (matrix.M22 > matrix.M33) {
+        float root = std::sqrt(1.0f + matrix.M22 - matrix.M11 - matrix.M33);
+        float inverseRoot = 0.5f / root;
+        return Quaternion(
+            (matrix.M21 + matrix.M12) * inverseRoot,
+            0.5f * root,
+            (matrix.M32 + matrix.M23) * inverseRoot,
+            (matrix.M31 - matrix.M13) * inverseRoot);
+    }
+
+    float root = std::sqrt(1.0f + matrix.M33 - matrix.M11 - matrix.M22);
+    float inverseRoot = 0.5f / root;
+    return Quaternion(
+        (matrix.M31 + matrix.M13) * inverseRoot,
+        (matrix.M32 + matrix.M23) * inverseRoot,
+        0.5f * root,
+        (matrix.M12 - matrix.M21) * inverseRoot);
+}
+
+/// <summary>
+/// Transforms <paramref name="plane"/> by <paramref name="matrix"/>: the plane coefficients times the inverse
+/// transpose, which is the inverse applied as a column vector.
+/// </summary>
+inline Plane Plane::Transform(const Plane& plane, const Matrix4x4& matrix) {
+    Matrix4x4 inverse;
+    Matrix4x4::Invert(matrix, inverse);
+    Vector4 result = Vector4::Transform(Vector4(plane.Normal, plane.D), Matrix4x4::Transpose(inverse));
+    return Plane(result);
+}
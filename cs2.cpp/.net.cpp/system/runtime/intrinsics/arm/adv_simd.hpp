@@ -0,0 +1,225 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "system/runtime/intrinsics/vector128.hpp"
+
+/// <summary>
+/// Managed System.Runtime.Intrinsics.Arm.AdvSimd. On AArch64 targets each method maps to its NEON instruction through
+/// the Vector128 backend; elsewhere the lane loops reproduce the instruction's result, so code that branches on
+/// IsSupported keeps working on every preset.
+/// </summary>
+class AdvSimd {
+    template <typename T>
+    static T MaskValue(bool condition) {
+        T value;
+        std::memset(&value, condition ? 0xFF : 0, sizeof(T));
+        return value;
+    }
+
+    template <typename T>
+    static VectorLaneBits<T> ToBits(const T& value) {
+        VectorLaneBits<T> bits;
+        std::memcpy(&bits, &value, sizeof(T));
+        return bits;
+    }
+
+    template <typename T>
+    static T FromBits(VectorLaneBits<T> bits) {
+        T value;
+        std::memcpy(&value, &bits, sizeof(T));
+        return value;
+    }
+
+    /// <summary>
+    /// Runs <paramref name="operation"/> on the NEON registers when the lane type supports
+    /// <typeparamref name="Operation"/>, or <paramref name="scalar"/> on each lane pair otherwise.
+    /// </summary>
+    template <VectorLaneOperation Operation, typename T, typename TOperation, typename TScalar>
+    static Vector128_1<T> Binary(const Vector128_1<T>& left, const Vector128_1<T>& right, TOperation operation, TScalar scalar) {
+        Vector128_1<T> result;
+        if constexpr (VectorLaneBlock<T, 16>::Supports(Operation)) {
+            VectorLaneBlock<T, 16>::template Binary<Operation>(left.Values, right.Values, result.Values, operation);
+            return result;
+        }
+
+        for (int32_t laneIndex = 0; laneIndex < Vector128_1<T>::LaneCount; ++laneIndex) {
+            result.Values[laneIndex] = scalar(left.Values[laneIndex], right.Values[laneIndex]);
+        }
+
+        return result;
+    }
+
+public:
+    static constexpr bool get_IsSupported() {
+        return HE_CPP_SIMD_NEON != 0;
+    }
+
+    template <typename T>
+    static Vector128_1<T> Add(const Vector128_1<T>& left, const Vector128_1<T>& right) {
+        return Binary<VectorLaneOperation::Arithmetic>(left, right, [](auto lanes, auto leftLanes, auto rightLanes) {
+            return decltype(lanes)::Add(leftLanes, rightLanes);
+        }, [](const T& leftValue, const T& rightValue) {
+            return static_cast<T>(leftValue + rightValue);
+        });
+    }
+
+    template <typename T>
+    static Vector128_1<T> Subtract(const Vector128_1<T>& left, const Vector128_1<T>& right) {
+        return Binary<VectorLaneOperation::Arithmetic>(left, right, [](auto lanes, auto leftLanes, auto rightLanes) {
+            return decltype(lanes)::Subtract(leftLanes, rightLanes);
+        }, [](const T& leftValue, const T& rightValue) {
+            return static_cast<T>(leftValue - rightValue);
+        });
+    }
+
+    template <typename T>
+    static Vector128_1<T> Multiply(const Vector128_1<T>& left, const Vector128_1<T>& right) {
+        return Binary<VectorLaneOperation::Multiply>(left, right, [](auto lanes, auto leftLanes, auto rightLanes) {
+            return decltype(lanes)::Multiply(leftLanes, rightLanes);
+        }, [](const T& leftValue, const T& rightValue) {
+            return static_cast<T>(leftValue * rightValue);
+        });
+    }
+
+    template <typename T>
+    static Vector128_1<T> Negate(const Vector128_1<T>& value) {
+        return -value;
+    }
+
+    template <typename T>
+    static Vector128_1<T> And(const Vector128_1<T>& left, const Vector128_1<T>& right) {
+        return Binary<VectorLaneOperation::Arithmetic>(left, right, [](auto lanes, auto leftLanes, auto rightLanes) {
+            return decltype(lanes)::And(leftLanes, rightLanes);
+        }, [](const T& leftValue, const T& rightValue) {
+            return FromBits<T>(static_cast<VectorLaneBits<T>>(ToBits(leftValue) & ToBits(rightValue)));
+        });
+    }
+
+    template <typename T>
+    static Vector128_1<T> Or(const Vector128_1<T>& left, const Vector128_1<T>& right) {
+        return Binary<VectorLaneOperation::Arithmetic>(left, right, [](auto lanes, auto leftLanes, auto rightLanes) {
+            return decltype(lanes)::Or(leftLanes, rightLanes);
+        }, [](const T& leftValue, const T& rightValue) {
+            return FromBits<T>(static_cast<VectorLaneBits<T>>(ToBits(leftValue) | ToBits(rightValue)));
+        });
+    }
+
+    template <typename T>
+    static Vector128_1<T> Xor(const Vector128_1<T>& left, const Vector128_1<T>& right) {
+        return Binary<VectorLaneOperation::Arithmetic>(left, right, [](auto lanes, auto leftLanes, auto rightLanes) {
+            return decltype(lanes)::Xor(leftLanes, rightLanes);
+        }, [](const T& leftValue, const T& rightValue) {
+            return FromBits<T>(static_cast<VectorLaneBits<T>>(ToBits(leftValue) ^ ToBits(rightValue)));
+        });
+    }
+
+    /// <summary>
+    /// Computes <c>value &amp; ~mask</c>, as bic does.
+    /// </summary>
+    template <typename T>
+    static Vector128_1<T> BitwiseClear(const Vector128_1<T>& value, const Vector128_1<T>& mask) {
+        return Binary<VectorLaneOperation::Arithmetic>(value, mask, [](auto lanes, auto valueLanes, auto maskLanes) {
+            return decltype(lanes)::AndNot(valueLanes, maskLanes);
+        }, [](const T& valueLane, const T& maskLane) {
+            return FromBits<T>(static_cast<VectorLaneBits<T>>(ToBits(valueLane) & static_cast<VectorLaneBits<T>>(~ToBits(maskLane))));
+        });
+    }
+
+    /// <summary>
+    /// Takes each bit from <paramref name="left"/> where <paramref name="select"/> is set and from
+    /// <paramref name="right"/> elsewhere, as bsl does.
+    /// </summary>
+    template <typename T>
+    static Vector128_1<T> BitwiseSelect(const Vector128_1<T>& select, const Vector128_1<T>& left, const Vector128_1<T>& right) {
+        return Vector128::ConditionalSelect(select, left, right);
+    }
+
+    template <typename T>
+    static Vector128_1<T> CompareEqual(const Vector128_1<T>& left, const Vector128_1<T>& right) {
+        return Binary<VectorLaneOperation::CompareEqual>(left, right, [](auto lanes, auto leftLanes, auto rightLanes) {
+            return decltype(lanes)::CompareEqual(leftLanes, rightLanes);
+        }, [](const T& leftValue, const T& rightValue) {
+            return MaskValue<T>(leftValue == rightValue);
+        });
+    }
+
+    template <typename T>
+    static Vector128_1<T> CompareGreaterThan(const Vector128_1<T>& left, const Vector128_1<T>& right) {
+        return Binary<VectorLaneOperation::CompareOrder>(left, right, [](auto lanes, auto leftLanes, auto rightLanes) {
+            return decltype(lanes)::CompareGreaterThan(leftLanes, rightLanes);
+        }, [](const T& leftValue, const T& rightValue) {
+            return MaskValue<T>(leftValue > rightValue);
+        });
+    }
+
+    template <typename T>
+    static Vector128_1<T> CompareGreaterThanOrEqual(const Vector128_1<T>& left, const Vector128_1<T>& right) {
+        return CompareLessThanOrEqual(right, left);
+    }
+
+    template <typename T>
+    static Vector128_1<T> CompareLessThan(const Vector128_1<T>& left, const Vector128_1<T>& right) {
+        return Binary<VectorLaneOperation::CompareOrder>(left, right, [](auto lanes, auto leftLanes, auto rightLanes) {
+            return decltype(lanes)::CompareLessThan(leftLanes, rightLanes);
+        }, [](const T& leftValue, const T& rightValue) {
+            return MaskValue<T>(leftValue < rightValue);
+        });
+    }
+
+    template <typename T>
+    static Vector128_1<T> CompareLessThanOrEqual(const Vector128_1<T>& left, const Vector128_1<T>& right) {
+        return Binary<VectorLaneOperation::CompareOrder>(left, right, [](auto lanes, auto leftLanes, auto rightLanes) {
+            return decltype(lanes)::CompareLessThanOrEqual(leftLanes, rightLanes);
+        }, [](const T& leftValue, const T& rightValue) {
+            return MaskValue<T>(leftValue <= rightValue);
+        });
+    }
+
+    /// <summary>
+    /// Lane-wise maximum with Vector128.Max semantics: <paramref name="left"/> wins ties and unordered lanes.
+    /// </summary>
+    template <typename T>
+    static Vector128_1<T> Max(const Vector128_1<T>& left, const Vector128_1<T>& right) {
+        return Vector128::Max(left, right);
+    }
+
+    /// <summary>
+    /// Lane-wise minimum with Vector128.Min semantics: <paramref name="left"/> wins ties and unordered lanes.
+    /// </summary>
+    template <typename T>
+    static Vector128_1<T> Min(const Vector128_1<T>& left, const Vector128_1<T>& right) {
+        return Vector128::Min(left, right);
+    }
+
+    template <typename T>
+    static Vector128_1<T> LoadVector128(const T* source) {
+        return Vector128::Load(source);
+    }
+
+    template <typename T>
+    static void Store(T* destination, const Vector128_1<T>& value) {
+        Vector128::Store(value, destination);
+    }
+
+    /// <summary>
+    /// Managed AdvSimd.Arm64: the A64-only forms, which the AArch64 backend always has.
+    /// </summary>
+    class Arm64 {
+    public:
+        static constexpr bool get_IsSupported() {
+            return HE_CPP_SIMD_NEON != 0;
+        }
+
+        template <typename T>
+        static Vector128_1<T> Divide(const Vector128_1<T>& left, const Vector128_1<T>& right) {
+            return AdvSimd::Binary<VectorLaneOperation::Divide>(left, right, [](auto lanes, auto leftLanes, auto rightLanes) {
+                return decltype(lanes)::Divide(leftLanes, rightLanes);
+            }, [](const T& leftValue, const T& rightValue) {
+                return static_cast<T>(leftValue / rightValue);
+            });
+        }
+    };
+};
@@ -0,0 +1,745 @@
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+#include "system/runtime/intrinsics/simd_config.hpp"
+#include "system/runtime/intrinsics/vector_lane_operation.hpp"
+
+#if HE_CPP_SIMD_NEON
+#include <arm_neon.h>
+
+/// <summary>
+/// Per-lane-type AArch64 Advanced SIMD instructions. NEON spells every operation per element type and returns
+/// comparison masks as unsigned vectors, so each lane type gets one specialization that hides both; lane types
+/// without one keep the portable loops.
+/// </summary>
+template <typename TLane>
+struct NeonRegisterOperations {
+    using Register = uint8x16_t;
+};
+
+template <>
+struct NeonRegisterOperations<int8_t> {
+    using Register = int8x16_t;
+
+    static Register Load(const int8_t* source) {
+        return vld1q_s8(source);
+    }
+
+    static void Store(int8_t* destination, Register value) {
+        vst1q_s8(destination, value);
+    }
+
+    static uint8x16_t ToBytes(Register value) {
+        return vreinterpretq_u8_s8(value);
+    }
+
+    static Register FromBytes(uint8x16_t value) {
+        return vreinterpretq_s8_u8(value);
+    }
+
+    static Register Add(Register left, Register right) {
+        return vaddq_s8(left, right);
+    }
+
+    static Register Subtract(Register left, Register right) {
+        return vsubq_s8(left, right);
+    }
+
+    static Register Multiply(Register left, Register right) {
+        return vmulq_s8(left, right);
+    }
+
+    static Register CompareEqual(Register left, Register right) {
+        return FromBytes(vceqq_s8(left, right));
+    }
+
+    static Register CompareGreaterThan(Register left, Register right) {
+        return FromBytes(vcgtq_s8(left, right));
+    }
+
+    static Register CompareLessThan(Register left, Register right) {
+        return FromBytes(vcltq_s8(left, right));
+    }
+
+    static Register CompareLessThanOrEqual(Register left, Register right) {
+        return FromBytes(vcleq_s8(left, right));
+    }
+
+    static Register Min(Register left, Register right) {
+        return vminq_s8(left, right);
+    }
+
+    static Register Max(Register left, Register right) {
+        return vmaxq_s8(left, right);
+    }
+};
+
+template <>
+struct NeonRegisterOperations<uint8_t> {
+    using Register = uint8x16_t;
+
+    static Register Load(const uint8_t* source) {
+        return vld1q_u8(source);
+    }
+
+    static void Store(uint8_t* destination, Register value) {
+        vst1q_u8(destination, value);
+    }
+
+    static uint8x16_t ToBytes(Register value) {
+        return value;
+    }
+
+    static Register FromBytes(uint8x16_t value) {
+        return value;
+    }
+
+    static Register Add(Register left, Register right) {
+        return vaddq_u8(left, right);
+    }
+
+    static Register Subtract(Register left, Register right) {
+        return vsubq_u8(left, right);
+    }
+
+    static Register Multiply(Register left, Register right) {
+        return vmulq_u8(left, right);
+    }
+
+    static Register CompareEqual(Register left, Register right) {
+        return FromBytes(vceqq_u8(left, right));
+    }
+
+    static Register CompareGreaterThan(Register left, Register right) {
+        return FromBytes(vcgtq_u8(left, right));
+    }
+
+    static Register CompareLessThan(Register left, Register right) {
+        return FromBytes(vcltq_u8(left, right));
+    }
+
+    static Register CompareLessThanOrEqual(Register left, Register right) {
+        return FromBytes(vcleq_u8(left, right));
+    }
+
+    static Register Min(Register left, Register right) {
+        return vminq_u8(left, right);
+    }
+
+    static Register Max(Register left, Register right) {
+        return vmaxq_u8(left, right);
+    }
+};
+
+template <>
+struct NeonRegisterOperations<int16_t> {
+    using Register = int16x8_t;
+
+    static Register Load(const int16_t* source) {
+        return vld1q_s16(source);
+    }
+
+    static void Store(int16_t* destination, Register value) {
+        vst1q_s16(destination, value);
+    }
+
+    static uint8x16_t ToBytes(Register value) {
+        return vreinterpretq_u8_s16(value);
+    }
+
+    static Register FromBytes(uint8x16_t value) {
+        return vreinterpretq_s16_u8(value);
+    }
+
+    static Register Add(Register left, Register right) {
+        return vaddq_s16(left, right);
+    }
+
+    static Register Subtract(Register left, Register right) {
+        return vsubq_s16(left, right);
+    }
+
+    static Register Multiply(Register left, Register right) {
+        return vmulq_s16(left, right);
+    }
+
+    static Register CompareEqual(Register left, Register right) {
+        return FromBytes(vreinterpretq_u8_u16(vceqq_s16(left, right)));
+    }
+
+    static Register CompareGreaterThan(Register left, Register right) {
+        return FromBytes(vreinterpretq_u8_u16(vcgtq_s16(left, right)));
+    }
+
+    static Register CompareLessThan(Register left, Register right) {
+        return FromBytes(vreinterpretq_u8_u16(vcltq_s16(left, right)));
+    }
+
+    static Register CompareLessThanOrEqual(Register left, Register right) {
+        return FromBytes(vreinterpretq_u8_u16(vcleq_s16(left, right)));
+    }
+
+    static Register Min(Register left, Register right) {
+        return vminq_s16(left, right);
+    }
+
+    static Register Max(Register left, Register right) {
+        return vmaxq_s16(left, right);
+    }
+};
+
+template <>
+struct NeonRegisterOperations<uint16_t> {
+    using Register = uint16x8_t;
+
+    static Register Load(const uint16_t* source) {
+        return vld1q_u16(source);
+    }
+
+    static void Store(uint16_t* destination, Register value) {
+        vst1q_u16(destination, value);
+    }
+
+    static uint8x16_t ToBytes(Register value) {
+        return vreinterpretq_u8_u16(value);
+    }
+
+    static Register FromBytes(uint8x16_t value) {
+        return vreinterpretq_u16_u8(value);
+    }
+
+    static Register Add(Register left, Register right) {
+        return vaddq_u16(left, right);
+    }
+
+    static Register Subtract(Register left, Register right) {
+        return vsubq_u16(left, right);
+    }
+
+    static Register Multiply(Register left, Register right) {
+        return vmulq_u16(left, right);
+    }
+
+    static Register CompareEqual(Register left, Register right) {
+        return FromBytes(vreinterpretq_u8_u16(vceqq_u16(left, right)));
+    }
+
+    static Register CompareGreaterThan(Register left, Register right) {
+        return FromBytes(vreinterpretq_u8_u16(vcgtq_u16(left, right)));
+    }
+
+    static Register CompareLessThan(Register left, Register right) {
+        return FromBytes(vreinterpretq_u8_u16(vcltq_u16(left, right)));
+    }
+
+    static Register CompareLessThanOrEqual(Register left, Register right) {
+        return FromBytes(vreinterpretq_u8_u16(vcleq_u16(left, right)));
+    }
+
+    static Register Min(Register left, Register right) {
+        return vminq_u16(left, right);
+    }
+
+    static Register Max(Register left, Register right) {
+        return vmaxq_u16(left, right);
+    }
+};
+
+template <>
+struct NeonRegisterOperations<int32_t> {
+    using Register = int32x4_t;
+
+    static Register Load(const int32_t* source) {
+        return vld1q_s32(source);
+    }
+
+    static void Store(int32_t* destination, Register value) {
+        vst1q_s32(destination, value);
+    }
+
+    static uint8x16_t ToBytes(Register value) {
+        return vreinterpretq_u8_s32(value);
+    }
+
+    static Register FromBytes(uint8x16_t value) {
+        return vreinterpretq_s32_u8(value);
+    }
+
+    static Register Add(Register left, Register right) {
+        return vaddq_s32(left, right);
+    }
+
+    static Register Subtract(Register left, Register right) {
+        return vsubq_s32(left, right);
+    }
+
+    static Register Multiply(Register left, Register right) {
+        return vmulq_s32(left, right);
+    }
+
+    static Register CompareEqual(Register left, Register right) {
+        return FromBytes(vreinterpretq_u8_u32(vceqq_s32(left, right)));
+    }
+
+    static Register CompareGreaterThan(Register left, Register right) {
+        return FromBytes(vreinterpretq_u8_u32(vcgtq_s32(left, right)));
+    }
+
+    static Register CompareLessThan(Register left, Register right) {
+        return FromBytes(vreinterpretq_u8_u32(vcltq_s32(left, right)));
+    }
+
+    static Register CompareLessThanOrEqual(Register left, Register right) {
+        return FromBytes(vreinterpretq_u8_u32(vcleq_s32(left, right)));
+    }
+
+    static Register Min(Register left, Register right) {
+        return vminq_s32(left, right);
+    }
+
+    static Register Max(Register left, Register right) {
+        return vmaxq_s32(left, right);
+    }
+};
+
+template <>
+struct NeonRegisterOperations<uint32_t> {
+    using Register = uint32x4_t;
+
+    static Register Load(const uint32_t* source) {
+        return vld1q_u32(source);
+    }
+
+    static void Store(uint32_t* destination, Register value) {
+        vst1q_u32(destination, value);
+    }
+
+    static uint8x16_t ToBytes(Register value) {
+        return vreinterpretq_u8_u32(value);
+    }
+
+    static Register FromBytes(uint8x16_t value) {
+        return vreinterpretq_u32_u8(value);
+    }
+
+    static Register Add(Register left, Register right) {
+        return vaddq_u32(left, right);
+    }
+
+    static Register Subtract(Register left, Register right) {
+        return vsubq_u32(left, right);
+    }
+
+    static Register Multiply(Register left, Register right) {
+        return vmulq_u32(left, right);
+    }
+
+    static Register CompareEqual(Register left, Register right) {
+        return FromBytes(vreinterpretq_u8_u32(vceqq_u32(left, right)));
+    }
+
+    static Register CompareGreaterThan(Register left, Register right) {
+        return FromBytes(vreinterpretq_u8_u32(vcgtq_u32(left, right)));
+    }
+
+    static Register CompareLessThan(Register left, Register right) {
+        return FromBytes(vreinterpretq_u8_u32(vcltq_u32(left, right)));
+    }
+
+    static Register CompareLessThanOrEqual(Register left, Register right) {
+        return FromBytes(vreinterpretq_u8_u32(vcleq_u32(left, right)));
+    }
+
+    static Register Min(Register left, Register right) {
+        return vminq_u32(left, right);
+    }
+
+    static Register Max(Register left, Register right) {
+        return vmaxq_u32(left, right);
+    }
+};
+
+template <>
+struct NeonRegisterOperations<int64_t> {
+    using Register = int64x2_t;
+
+    static Register Load(const int64_t* source) {
+        return vld1q_s64(source);
+    }
+
+    static void Store(int64_t* destination, Register value) {
+        vst1q_s64(destination, value);
+    }
+
+    static uint8x16_t ToBytes(Register value) {
+        return vreinterpretq_u8_s64(value);
+    }
+
+    static Register FromBytes(uint8x16_t value) {
+        return vreinterpretq_s64_u8(value);
+    }
+
+    static Register Add(Register left, Register right) {
+        return vaddq_s64(left, right);
+    }
+
+    static Register Subtract(Register left, Register right) {
+        return vsubq_s64(left, right);
+    }
+
+    static Register CompareEqual(Register left, Register right) {
+        return FromBytes(vreinterpretq_u8_u64(vceqq_s64(left, right)));
+    }
+
+    static Register CompareGreaterThan(Register left, Register right) {
+        return FromBytes(vreinterpretq_u8_u64(vcgtq_s64(left, right)));
+    }
+
+    static Register CompareLessThan(Register left, Register right) {
+        return FromBytes(vreinterpretq_u8_u64(vcltq_s64(left, right)));
+    }
+
+    static Register CompareLessThanOrEqual(Register left, Register right) {
+        return FromBytes(vreinterpretq_u8_u64(vcleq_s64(left, right)));
+    }
+};
+
+template <>
+struct NeonRegisterOperations<uint64_t> {
+    using Register = uint64x2_t;
+
+    static Register Load(const uint64_t* source) {
+        return vld1q_u64(source);
+    }
+
+    static void Store(uint64_t* destination, Register value) {
+        vst1q_u64(destination, value);
+    }
+
+    static uint8x16_t ToBytes(Register value) {
+        return vreinterpretq_u8_u64(value);
+    }
+
+    static Register FromBytes(uint8x16_t value) {
+        return vreinterpretq_u64_u8(value);
+    }
+
+    static Register Add(Register left, Register right) {
+        return vaddq_u64(left, right);
+    }
+
+    static Register Subtract(Register left, Register right) {
+        return vsubq_u64(left, right);
+    }
+
+    static Register CompareEqual(Register left, Register right) {
+        return FromBytes(vreinterpretq_u8_u64(vceqq_u64(left, right)));
+    }
+
+    static Register CompareGreaterThan(Register left, Register right) {
+        return FromBytes(vreinterpretq_u8_u64(vcgtq_u64(left, right)));
+    }
+
+    static Register CompareLessThan(Register left, Register right) {
+        return FromBytes(vreinterpretq_u8_u64(vcltq_u64(left, right)));
+    }
+
+    static Register CompareLessThanOrEqual(Register left, Register right) {
+        return FromBytes(vreinterpretq_u8_u64(vcleq_u64(left, right)));
+    }
+};
+
+template <>
+struct NeonRegisterOperations<float> {
+    using Register = float32x4_t;
+
+    static Register Load(const float* source) {
+        return vld1q_f32(source);
+    }
+
+    static void Store(float* destination, Register value) {
+        vst1q_f32(destination, value);
+    }
+
+    static uint8x16_t ToBytes(Register value) {
+        return vreinterpretq_u8_f32(value);
+    }
+
+    static Register FromBytes(uint8x16_t value) {
+        return vreinterpretq_f32_u8(value);
+    }
+
+    static Register Add(Register left, Register right) {
+        return vaddq_f32(left, right);
+    }
+
+    static Register Subtract(Register left, Register right) {
+        return vsubq_f32(left, right);
+    }
+
+    static Register Multiply(Register left, Register right) {
+        return vmulq_f32(left, right);
+    }
+
+    static Register Divide(Register left, Register right) {
+        return vdivq_f32(left, right);
+    }
+
+    static Register Negate(Register value) {
+        return vnegq_f32(value);
+    }
+
+    static Register CompareEqual(Register left, Register right) {
+        return FromBytes(vreinterpretq_u8_u32(vceqq_f32(left, right)));
+    }
+
+    static Register CompareGreaterThan(Register left, Register right) {
+        return FromBytes(vreinterpretq_u8_u32(vcgtq_f32(left, right)));
+    }
+
+    static Register CompareLessThan(Register left, Register right) {
+        return FromBytes(vreinterpretq_u8_u32(vcltq_f32(left, right)));
+    }
+
+    static Register CompareLessThanOrEqual(Register left, Register right) {
+        return FromBytes(vreinterpretq_u8_u32(vcleq_f32(left, right)));
+    }
+};
+
+template <>
+struct NeonRegisterOperations<double> {
+    using Register = float64x2_t;
+
+    static Register Load(const double* source) {
+        return vld1q_f64(source);
+    }
+
+    static void Store(double* destination, Register value) {
+        vst1q_f64(destination, value);
+    }
+
+    static uint8x16_t ToBytes(Register value) {
+        return vreinterpretq_u8_f64(value);
+    }
+
+    static Register FromBytes(uint8x16_t value) {
+        return vreinterpretq_f64_u8(value);
+    }
+
+    static Register Add(Register left, Register right) {
+        return vaddq_f64(left, right);
+    }
+
+    static Register Subtract(Register left, Register right) {
+        return vsubq_f64(left, right);
+    }
+
+    static Register Multiply(Register left, Register right) {
+        return vmulq_f64(left, right);
+    }
+
+    static Register Divide(Register left, Register right) {
+        return vdivq_f64(left, right);
+    }
+
+    static Register Negate(Register value) {
+        return vnegq_f64(value);
+    }
+
+    static Register CompareEqual(Register left, Register right) {
+        return FromBytes(vreinterpretq_u8_u64(vceqq_f64(left, right)));
+    }
+
+    static Register CompareGreaterThan(Register left, Register right) {
+        return FromBytes(vreinterpretq_u8_u64(vcgtq_f64(left, right)));
+    }
+
+    static Register CompareLessThan(Register left, Register right) {
+        return FromBytes(vreinterpretq_u8_u64(vcltq_f64(left, right)));
+    }
+
+    static Register CompareLessThanOrEqual(Register left, Register right) {
+        return FromBytes(vreinterpretq_u8_u64(vcleq_f64(left, right)));
+    }
+};
+
+/// <summary>
+/// Fixed-width NEON element type that stores lanes of <typeparamref name="T"/>; char, long, and the other aliases map
+/// onto the element of the same size and signedness.
+/// </summary>
+template <typename T>
+using NeonLaneType = std::conditional_t<std::is_floating_point_v<T>, T,
+    std::conditional_t<std::is_signed_v<T>, std::make_signed_t<VectorLaneBits<T>>, VectorLaneBits<T>>>;
+
+/// <summary>
+/// AArch64 NEON lowering of the 128-bit lane operations for one lane type. Unlike SSE2, NEON has every integer width
+/// for multiply (up to 32 bits), ordering, and min/max, and divides floating-point lanes natively.
+/// </summary>
+template <typename T>
+struct NeonLanes {
+    static constexpr bool IsFloatingPoint = std::is_same_v<T, float> || std::is_same_v<T, double>;
+    static constexpr bool IsInteger = std::is_integral_v<T> && !std::is_same_v<T, bool> &&
+        (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+    static constexpr bool Enabled = IsFloatingPoint || IsInteger;
+
+    using Lane = NeonLaneType<T>;
+    using Operations = NeonRegisterOperations<Lane>;
+    using Register = typename Operations::Register;
+
+    static constexpr bool Supports(VectorLaneOperation operation) {
+        switch (operation) {
+        case VectorLaneOperation::Arithmetic:
+        case VectorLaneOperation::CompareEqual:
+        case VectorLaneOperation::CompareOrder:
+            return Enabled;
+        case VectorLaneOperation::Multiply:
+            return IsFloatingPoint || (IsInteger && sizeof(T) <= 4);
+        case VectorLaneOperation::Divide:
+            return IsFloatingPoint;
+        }
+
+        return false;
+    }
+
+    static Register Load(const T* source) {
+        return Operations::Load(reinterpret_cast<const Lane*>(source));
+    }
+
+    static Register LoadUnaligned(const T* source) {
+        return Operations::Load(reinterpret_cast<const Lane*>(source));
+    }
+
+    static void Store(T* destination, Register value) {
+        Operations::Store(reinterpret_cast<Lane*>(destination), value);
+    }
+
+    static void StoreUnaligned(T* destination, Register value) {
+        Operations::Store(reinterpret_cast<Lane*>(destination), value);
+    }
+
+    static Register Zero() {
+        return Operations::FromBytes(vdupq_n_u8(0));
+    }
+
+    static Register AllBitsSet() {
+        return Operations::FromBytes(vdupq_n_u8(0xFF));
+    }
+
+    static Register Add(Register left, Register right) {
+        return Operations::Add(left, right);
+    }
+
+    static Register Subtract(Register left, Register right) {
+        return Operations::Subtract(left, right);
+    }
+
+    static Register Multiply(Register left, Register right) {
+        return Operations::Multiply(left, right);
+    }
+
+    static Register Divide(Register left, Register right) {
+        return Operations::Divide(left, right);
+    }
+
+    static Register Negate(Register value) {
+        if constexpr (IsFloatingPoint) {
+            return Operations::Negate(value);
+        } else {
+            return Subtract(Zero(), value);
+        }
+    }
+
+    static Register And(Register left, Register right) {
+        return Operations::FromBytes(vandq_u8(Operations::ToBytes(left), Operations::ToBytes(right)));
+    }
+
+    static Register Or(Register left, Register right) {
+        return Operations::FromBytes(vorrq_u8(Operations::ToBytes(left), Operations::ToBytes(right)));
+    }
+
+    static Register Xor(Register left, Register right) {
+        return Operations::FromBytes(veorq_u8(Operations::ToBytes(left), Operations::ToBytes(right)));
+    }
+
+    /// <summary>
+    /// Computes <c>left &amp; ~right</c>; bic already takes its operands in the managed AndNot order.
+    /// </summary>
+    static Register AndNot(Register left, Register right) {
+        return Operations::FromBytes(vbicq_u8(Operations::ToBytes(left), Operations::ToBytes(right)));
+    }
+
+    /// <summary>
+    /// Takes each bit from <paramref name="left"/> where <paramref name="mask"/> is set and from
+    /// <paramref name="right"/> elsewhere, as bsl does.
+    /// </summary>
+    static Register Select(Register mask, Register left, Register right) {
+        return Operations::FromBytes(vbslq_u8(Operations::ToBytes(mask), Operations::ToBytes(left), Operations::ToBytes(right)));
+    }
+
+    static Register CompareEqual(Register left, Register right) {
+        return Operations::CompareEqual(left, right);
+    }
+
+    static Register CompareGreaterThan(Register left, Register right) {
+        return Operations::CompareGreaterThan(left, right);
+    }
+
+    static Register CompareLessThan(Register left, Register right) {
+        return Operations::CompareLessThan(left, right);
+    }
+
+    static Register CompareLessThanOrEqual(Register left, Register right) {
+        return Operations::CompareLessThanOrEqual(left, right);
+    }
+
+    /// <summary>
+    /// Matches std::min(left, right). fmin returns NaN for unordered lanes where std::min keeps
+    /// <paramref name="left"/>, so floating-point and 64-bit lanes select on a compare instead.
+    /// </summary>
+    static Register Min(Register left, Register right) {
+        if constexpr (IsInteger && sizeof(T) <= 4) {
+            return Operations::Min(left, right);
+        } else {
+            return Select(CompareLessThan(right, left), right, left);
+        }
+    }
+
+    /// <summary>
+    /// Matches std::max(left, right): <paramref name="left"/> wins ties and unordered lanes.
+    /// </summary>
+    static Register Max(Register left, Register right) {
+        if constexpr (IsInteger && sizeof(T) <= 4) {
+            return Operations::Max(left, right);
+        } else {
+            return Select(CompareLessThan(left, right), right, left);
+        }
+    }
+
+    /// <summary>
+    /// Gathers the most significant bit of every lane into the low bits of the result. NEON has no movemask, so each
+    /// sign bit is shifted down, moved to its lane's bit position, and summed across the register.
+    /// </summary>
+    static uint32_t MoveMask(Register value) {
+        const uint8x16_t bytes = Operations::ToBytes(value);
+        if constexpr (sizeof(T) == 1) {
+            static const int8_t positions[16] = { 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7 };
+            const uint8x16_t bits = vshlq_u8(vshrq_n_u8(bytes, 7), vld1q_s8(positions));
+            return static_cast<uint32_t>(vaddv_u8(vget_low_u8(bits))) |
+                (static_cast<uint32_t>(vaddv_u8(vget_high_u8(bits))) << 8);
+        } else if constexpr (sizeof(T) == 2) {
+            static const int16_t positions[8] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+            const uint16x8_t bits = vshlq_u16(vshrq_n_u16(vreinterpretq_u16_u8(bytes), 15), vld1q_s16(positions));
+            return static_cast<uint32_t>(vaddvq_u16(bits));
+        } else if constexpr (sizeof(T) == 4) {
+            static const int32_t positions[4] = { 0, 1, 2, 3 };
+            const uint32x4_t bits = vshlq_u32(vshrq_n_u32(vreinterpretq_u32_u8(bytes), 31), vld1q_s32(positions));
+            return vaddvq_u32(bits);
+        } else {
+            const uint64x2_t bits = vshrq_n_u64(vreinterpretq_u64_u8(bytes), 63);
+            return static_cast<uint32_t>(vgetq_lane_u64(bits, 0) | (vgetq_lane_u64(bits, 1) << 1));
+        }
+    }
+};
+#endif
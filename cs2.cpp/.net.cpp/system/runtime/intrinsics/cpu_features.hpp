@@ -0,0 +1,142 @@
+#pragma once
+
+#include <cstdint>
+
+#include "system/runtime/intrinsics/simd_config.hpp"
+
+#if HE_CPP_SIMD_X86_TARGET
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+/// <summary>
+/// Instruction sets the running CPU and operating system provide, read once through cpuid. The HE_CPP_SIMD_* macros
+/// state what every function in the build may assume; these answer whether a runtime-dispatched path may be entered.
+/// </summary>
+class CpuFeatures {
+#if HE_CPP_SIMD_X86_TARGET
+    struct CpuidResult {
+        uint32_t Eax;
+        uint32_t Ebx;
+        uint32_t Ecx;
+        uint32_t Edx;
+    };
+
+    static CpuidResult QueryCpuid(uint32_t leaf, uint32_t subleaf) {
+        CpuidResult result = {};
+#if defined(_MSC_VER) && !defined(__clang__)
+        int registers[4];
+        __cpuidex(registers, static_cast<int>(leaf), static_cast<int>(subleaf));
+        result.Eax = static_cast<uint32_t>(registers[0]);
+        result.Ebx = static_cast<uint32_t>(registers[1]);
+        result.Ecx = static_cast<uint32_t>(registers[2]);
+        result.Edx = static_cast<uint32_t>(registers[3]);
+#else
+        unsigned int eax = 0;
+        unsigned int ebx = 0;
+        unsigned int ecx = 0;
+        unsigned int edx = 0;
+        if (__get_cpuid_count(leaf, subleaf, &eax, &ebx, &ecx, &edx)) {
+            result.Eax = eax;
+            result.Ebx = ebx;
+            result.Ecx = ecx;
+            result.Edx = edx;
+        }
+#endif
+        return result;
+    }
+
+    /// <summary>
+    /// Reads XCR0, the register state the operating system saves across context switches.
+    /// </summary>
+    static uint64_t ReadEnabledRegisterState() {
+#if defined(_MSC_VER) && !defined(__clang__)
+        return static_cast<uint64_t>(_xgetbv(0));
+#else
+        uint32_t low = 0;
+        uint32_t high = 0;
+        __asm__ volatile("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+        return (static_cast<uint64_t>(high) << 32) | low;
+#endif
+    }
+#endif
+
+    /// <summary>
+    /// Instruction sets found on the running machine. The AVX sets also require the operating system to save their
+    /// registers.
+    /// </summary>
+    struct FeatureSet {
+        bool Sse41;
+        bool Avx;
+        bool Avx2;
+        bool Avx512;
+    };
+
+    static FeatureSet Detect() {
+        FeatureSet features = {};
+#if HE_CPP_SIMD_X86_TARGET
+        const CpuidResult vendor = QueryCpuid(0, 0);
+        const CpuidResult leaf1 = QueryCpuid(1, 0);
+        constexpr uint32_t Sse41Bit = 1u << 19;
+        constexpr uint32_t OsXsaveBit = 1u << 27;
+        constexpr uint32_t AvxBit = 1u << 28;
+        features.Sse41 = (leaf1.Ecx & Sse41Bit) != 0;
+        if ((leaf1.Ecx & (OsXsaveBit | AvxBit)) != (OsXsaveBit | AvxBit)) {
+            return features;
+        }
+
+        // XMM and YMM state for AVX; the opmask registers and both parts of the ZMM state on top for AVX-512.
+        constexpr uint64_t AvxRegisterState = 0x6;
+        constexpr uint64_t Avx512RegisterState = 0xE6;
+        const uint64_t enabledState = ReadEnabledRegisterState();
+        features.Avx = (enabledState & AvxRegisterState) == AvxRegisterState;
+
+        // MSVC's __cpuidex answers a leaf above the maximum with the highest leaf's data, so check before reading 7.
+        if (!features.Avx || vendor.Eax < 7) {
+            return features;
+        }
+
+        const uint32_t leaf7Ebx = QueryCpuid(7, 0).Ebx;
+        constexpr uint32_t Avx2Bit = 1u << 5;
+        constexpr uint32_t Avx512FBit = 1u << 16;
+        constexpr uint32_t Avx512DqBit = 1u << 17;
+        constexpr uint32_t Avx512BwBit = 1u << 30;
+        constexpr uint32_t Avx512VlBit = 1u << 31;
+        constexpr uint32_t Avx512Bits = Avx2Bit | Avx512FBit | Avx512DqBit | Avx512BwBit | Avx512VlBit;
+        features.Avx2 = (leaf7Ebx & Avx2Bit) != 0;
+        features.Avx512 = (leaf7Ebx & Avx512Bits) == Avx512Bits && (enabledState & Avx512RegisterState) == Avx512RegisterState;
+#endif
+        return features;
+    }
+
+    /// <summary>
+    /// Filled in during static initialization, before main, so reading it costs one load. Static initializers in
+    /// other translation units that run first see every feature absent and take the baseline paths.
+    /// </summary>
+    static inline const FeatureSet Detected = Detect();
+
+public:
+    static bool HasSse41() {
+        return Detected.Sse41;
+    }
+
+    static bool HasAvx() {
+        return Detected.Avx;
+    }
+
+    static bool HasAvx2() {
+        return Detected.Avx2;
+    }
+
+    /// <summary>
+    /// Reports AVX-512 F, BW, DQ, and VL with the operating system saving the opmask and ZMM registers: the set the
+    /// Vector512 backend compiles for.
+    /// </summary>
+    static bool HasAvx512() {
+        return Detected.Avx512;
+    }
+};
+
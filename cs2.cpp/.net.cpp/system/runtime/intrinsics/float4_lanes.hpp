@@ -0,0 +1,336 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+#include "system/runtime/intrinsics/simd_config.hpp"
+
+#if HE_CPP_SIMD_SSE2
+#include <immintrin.h>
+#elif HE_CPP_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+/// <summary>
+/// One register of four float lanes for the System.Numerics math types. Unlike the lane backends behind Vector128 it
+/// exposes the shuffles those types need (lane broadcasts, horizontal sums, and a 4x4 transpose). Every operation
+/// rounds like the scalar expression it replaces: multiply-add stays a multiply and an add, and Min and Max keep the
+/// managed <c>left &lt; right ? left : right</c> choice, NaN lanes included.
+/// </summary>
+struct Float4Lanes {
+#if HE_CPP_SIMD_SSE2
+    using Register = __m128;
+
+    static Register Load(const float* source) {
+        return _mm_load_ps(source);
+    }
+
+    static Register LoadUnaligned(const float* source) {
+        return _mm_loadu_ps(source);
+    }
+
+    static void Store(float* destination, Register value) {
+        _mm_store_ps(destination, value);
+    }
+
+    static void StoreUnaligned(float* destination, Register value) {
+        _mm_storeu_ps(destination, value);
+    }
+
+    static Register Create(float x, float y, float z, float w) {
+        return _mm_setr_ps(x, y, z, w);
+    }
+
+    static Register Broadcast(float value) {
+        return _mm_set1_ps(value);
+    }
+
+    static float GetX(Register value) {
+        return _mm_cvtss_f32(value);
+    }
+
+    template <int32_t Lane>
+    static Register BroadcastLane(Register value) {
+        return _mm_shuffle_ps(value, value, _MM_SHUFFLE(Lane, Lane, Lane, Lane));
+    }
+
+    static Register Add(Register left, Register right) {
+        return _mm_add_ps(left, right);
+    }
+
+    static Register Subtract(Register left, Register right) {
+        return _mm_sub_ps(left, right);
+    }
+
+    static Register Multiply(Register left, Register right) {
+        return _mm_mul_ps(left, right);
+    }
+
+    static Register Divide(Register left, Register right) {
+        return _mm_div_ps(left, right);
+    }
+
+    static Register Negate(Register value) {
+        return _mm_xor_ps(value, _mm_set1_ps(-0.0f));
+    }
+
+    static Register Abs(Register value) {
+        return _mm_andnot_ps(_mm_set1_ps(-0.0f), value);
+    }
+
+    static Register Min(Register left, Register right) {
+        return _mm_min_ps(left, right);
+    }
+
+    static Register Max(Register left, Register right) {
+        return _mm_max_ps(left, right);
+    }
+
+    static Register Sqrt(Register value) {
+        return _mm_sqrt_ps(value);
+    }
+
+    /// <summary>
+    /// Sums all four lanes as <c>(x + z) + (y + w)</c>.
+    /// </summary>
+    static float Sum(Register value) {
+        Register pairs = _mm_add_ps(value, _mm_movehl_ps(value, value));
+        return _mm_cvtss_f32(_mm_add_ss(pairs, _mm_shuffle_ps(pairs, pairs, _MM_SHUFFLE(1, 1, 1, 1))));
+    }
+
+    static bool EqualsAll(Register left, Register right) {
+        return _mm_movemask_ps(_mm_cmpeq_ps(left, right)) == 0xF;
+    }
+
+    static void Transpose(Register& row0, Register& row1, Register& row2, Register& row3) {
+        Register low01 = _mm_unpacklo_ps(row0, row1);
+        Register high01 = _mm_unpackhi_ps(row0, row1);
+        Register low23 = _mm_unpacklo_ps(row2, row3);
+        Register high23 = _mm_unpackhi_ps(row2, row3);
+        row0 = _mm_movelh_ps(low01, low23);
+        row1 = _mm_movehl_ps(low23, low01);
+        row2 = _mm_movelh_ps(high01, high23);
+        row3 = _mm_movehl_ps(high23, high01);
+    }
+#elif HE_CPP_SIMD_NEON
+    using Register = float32x4_t;
+
+    static Register Load(const float* source) {
+        return vld1q_f32(source);
+    }
+
+    static Register LoadUnaligned(const float* source) {
+        return vld1q_f32(source);
+    }
+
+    static void Store(float* destination, Register value) {
+        vst1q_f32(destination, value);
+    }
+
+    static void StoreUnaligned(float* destination, Register value) {
+        vst1q_f32(destination, value);
+    }
+
+    static Register Create(float x, float y, float z, float w) {
+        const float values[4] = { x, y, z, w };
+        return vld1q_f32(values);
+    }
+
+    static Register Broadcast(float value) {
+        return vdupq_n_f32(value);
+    }
+
+    static float GetX(Register value) {
+        return vgetq_lane_f32(value, 0);
+    }
+
+    template <int32_t Lane>
+    static Register BroadcastLane(Register value) {
+        return vdupq_laneq_f32(value, Lane);
+    }
+
+    static Register Add(Register left, Register right) {
+        return vaddq_f32(left, right);
+    }
+
+    static Register Subtract(Register left, Register right) {
+        return vsubq_f32(left, right);
+    }
+
+    static Register Multiply(Register left, Register right) {
+        return vmulq_f32(left, right);
+    }
+
+    static Register Divide(Register left, Register right) {
+        return vdivq_f32(left, right);
+    }
+
+    static Register Negate(Register value) {
+        return vnegq_f32(value);
+    }
+
+    static Register Abs(Register value) {
+        return vabsq_f32(value);
+    }
+
+    static Register Min(Register left, Register right) {
+        return vbslq_f32(vcltq_f32(left, right), left, right);
+    }
+
+    static Register Max(Register left, Register right) {
+        return vbslq_f32(vcgtq_f32(left, right), left, right);
+    }
+
+    static Register Sqrt(Register value) {
+        return vsqrtq_f32(value);
+    }
+
+    /// <summary>
+    /// Sums all four lanes as <c>(x + z) + (y + w)</c>.
+    /// </summary>
+    static float Sum(Register value) {
+        float32x2_t pairs = vadd_f32(vget_low_f32(value), vget_high_f32(value));
+        return vget_lane_f32(pairs, 0) + vget_lane_f32(pairs, 1);
+    }
+
+    static bool EqualsAll(Register left, Register right) {
+        return vminvq_u32(vceqq_f32(left, right)) == 0xFFFFFFFFu;
+    }
+
+    static void Transpose(Register& row0, Register& row1, Register& row2, Register& row3) {
+        float32x4_t even01 = vtrn1q_f32(row0, row1);
+        float32x4_t odd01 = vtrn2q_f32(row0, row1);
+        float32x4_t even23 = vtrn1q_f32(row2, row3);
+        float32x4_t odd23 = vtrn2q_f32(row2, row3);
+        row0 = vreinterpretq_f32_f64(vtrn1q_f64(vreinterpretq_f64_f32(even01), vreinterpretq_f64_f32(even23)));
+        row1 = vreinterpretq_f32_f64(vtrn1q_f64(vreinterpretq_f64_f32(odd01), vreinterpretq_f64_f32(odd23)));
+        row2 = vreinterpretq_f32_f64(vtrn2q_f64(vreinterpretq_f64_f32(even01), vreinterpretq_f64_f32(even23)));
+        row3 = vreinterpretq_f32_f64(vtrn2q_f64(vreinterpretq_f64_f32(odd01), vreinterpretq_f64_f32(odd23)));
+    }
+#else
+    struct Register {
+        float Lanes[4];
+    };
+
+    static Register Load(const float* source) {
+        return Register{ { source[0], source[1], source[2], source[3] } };
+    }
+
+    static Register LoadUnaligned(const float* source) {
+        return Load(source);
+    }
+
+    static void Store(float* destination, Register value) {
+        for (int32_t laneIndex = 0; laneIndex < 4; ++laneIndex) {
+            destination[laneIndex] = value.Lanes[laneIndex];
+        }
+    }
+
+    static void StoreUnaligned(float* destination, Register value) {
+        Store(destination, value);
+    }
+
+    static Register Create(float x, float y, float z, float w) {
+        return Register{ { x, y, z, w } };
+    }
+
+    static Register Broadcast(float value) {
+        return Register{ { value, value, value, value } };
+    }
+
+    static float GetX(Register value) {
+        return value.Lanes[0];
+    }
+
+    template <int32_t Lane>
+    static Register BroadcastLane(Register value) {
+        return Broadcast(value.Lanes[Lane]);
+    }
+
+    static Register Add(Register left, Register right) {
+        return Create(left.Lanes[0] + right.Lanes[0], left.Lanes[1] + right.Lanes[1], left.Lanes[2] + right.Lanes[2], left.Lanes[3] + right.Lanes[3]);
+    }
+
+    static Register Subtract(Register left, Register right) {
+        return Create(left.Lanes[0] - right.Lanes[0], left.Lanes[1] - right.Lanes[1], left.Lanes[2] - right.Lanes[2], left.Lanes[3] - right.Lanes[3]);
+    }
+
+    static Register Multiply(Register left, Register right) {
+        return Create(left.Lanes[0] * right.Lanes[0], left.Lanes[1] * right.Lanes[1], left.Lanes[2] * right.Lanes[2], left.Lanes[3] * right.Lanes[3]);
+    }
+
+    static Register Divide(Register left, Register right) {
+        return Create(left.Lanes[0] / right.Lanes[0], left.Lanes[1] / right.Lanes[1], left.Lanes[2] / right.Lanes[2], left.Lanes[3] / right.Lanes[3]);
+    }
+
+    static Register Negate(Register value) {
+        return Create(-value.Lanes[0], -value.Lanes[1], -value.Lanes[2], -value.Lanes[3]);
+    }
+
+    static Register Abs(Register value) {
+        return Create(std::fabs(value.Lanes[0]), std::fabs(value.Lanes[1]), std::fabs(value.Lanes[2]), std::fabs(value.Lanes[3]));
+    }
+
+    static Register Min(Register left, Register right) {
+        Register result;
+        for (int32_t laneIndex = 0; laneIndex < 4; ++laneIndex) {
+            result.Lanes[laneIndex] = left.Lanes[laneIndex] < right.Lanes[laneIndex] ? left.Lanes[laneIndex] : right.Lanes[laneIndex];
+        }
+        return result;
+    }
+
+    static Register Max(Register left, Register right) {
+        Register result;
+        for (int32_t laneIndex = 0; laneIndex < 4; ++laneIndex) {
+            result.Lanes[laneIndex] = left.Lanes[laneIndex] > right.Lanes[laneIndex] ? left.Lanes[laneIndex] : right.Lanes[laneIndex];
+        }
+        return result;
+    }
+
+    static Register Sqrt(Register value) {
+        return Create(std::sqrt(value.Lanes[0]), std::sqrt(value.Lanes[1]), std::sqrt(value.Lanes[2]), std::sqrt(value.Lanes[3]));
+    }
+
+    /// <summary>
+    /// Sums all four lanes as <c>(x + z) + (y + w)</c>.
+    /// </summary>
+    static float Sum(Register value) {
+        return (value.Lanes[0] + value.Lanes[2]) + (value.Lanes[1] + value.Lanes[3]);
+    }
+
+    static bool EqualsAll(Register left, Register right) {
+        return left.Lanes[0] == right.Lanes[0] && left.Lanes[1] == right.Lanes[1] &&
+            left.Lanes[2] == right.Lanes[2] && left.Lanes[3] == right.Lanes[3];
+    }
+
+    static void Transpose(Register& row0, Register& row1, Register& row2, Register& row3) {
+        Register rows[4] = { row0, row1, row2, row3 };
+        row0 = Create(rows[0].Lanes[0], rows[1].Lanes[0], rows[2].Lanes[0], rows[3].Lanes[0]);
+        row1 = Create(rows[0].Lanes[1], rows[1].Lanes[1], rows[2].Lanes[1], rows[3].Lanes[1]);
+        row2 = Create(rows[0].Lanes[2], rows[1].Lanes[2], rows[2].Lanes[2], rows[3].Lanes[2]);
+        row3 = Create(rows[0].Lanes[3], rows[1].Lanes[3], rows[2].Lanes[3], rows[3].Lanes[3]);
+    }
+#endif
+
+    /// <summary>
+    /// Returns <c>left * right + addend</c> lane by lane, rounding after the multiply.
+    /// </summary>
+    static Register MultiplyAdd(Register left, Register right, Register addend) {
+        return Add(Multiply(left, right), addend);
+    }
+
+    static float Dot(Register left, Register right) {
+        return Sum(Multiply(left, right));
+    }
+
+    /// <summary>
+    /// Returns <c>x * row0 + y * row1 + z * row2 + w * row3</c>: the row vector <paramref name="value"/> times the
+    /// matrix whose rows are the four registers.
+    /// </summary>
+    static Register CombineRows(Register value, Register row0, Register row1, Register row2, Register row3) {
+        Register result = Multiply(BroadcastLane<0>(value), row0);
+        result = MultiplyAdd(BroadcastLane<1>(value), row1, result);
+        result = MultiplyAdd(BroadcastLane<2>(value), row2, result);
+        return MultiplyAdd(BroadcastLane<3>(value), row3, result);
+    }
+};
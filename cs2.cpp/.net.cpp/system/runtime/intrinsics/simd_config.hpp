@@ -0,0 +1,145 @@
+#pragma once
+
+#include "helcpp_config.hpp"
+
+/// <summary>
+/// Instruction sets the runtime vector types lower to, resolved from the compiler's target flags (-msse4.1, -mavx2,
+/// -march=x86-64-v4, /arch:AVX2, or an AArch64 target for NEON). Console presets and HE_CPP_DISABLE_SIMD turn every
+/// set off so the per-lane loops remain the only implementation. Predefining one of the HE_CPP_SIMD_* macros to 0 opts
+/// that set out on its own.
+/// </summary>
+#if HE_CPP_PLATFORM_PS2 || HE_CPP_PLATFORM_N64 || HE_CPP_PLATFORM_DS || HE_CPP_RUNTIME_CUSTOM_RETRO || HE_CPP_DISABLE_SIMD
+#define HE_CPP_SIMD_X86_TARGET 0
+#define HE_CPP_SIMD_ARM64_TARGET 0
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define HE_CPP_SIMD_X86_TARGET 1
+#define HE_CPP_SIMD_ARM64_TARGET 0
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define HE_CPP_SIMD_X86_TARGET 0
+#define HE_CPP_SIMD_ARM64_TARGET 1
+#else
+#define HE_CPP_SIMD_X86_TARGET 0
+#define HE_CPP_SIMD_ARM64_TARGET 0
+#endif
+
+#ifndef HE_CPP_SIMD_SSE2
+#define HE_CPP_SIMD_SSE2 HE_CPP_SIMD_X86_TARGET
+#endif
+
+#ifndef HE_CPP_SIMD_SSE41
+#if HE_CPP_SIMD_SSE2 && (defined(__SSE4_1__) || defined(__AVX__))
+#define HE_CPP_SIMD_SSE41 1
+#else
+#define HE_CPP_SIMD_SSE41 0
+#endif
+#endif
+
+#ifndef HE_CPP_SIMD_AVX
+#if HE_CPP_SIMD_SSE41 && defined(__AVX__)
+#define HE_CPP_SIMD_AVX 1
+#else
+#define HE_CPP_SIMD_AVX 0
+#endif
+#endif
+
+#ifndef HE_CPP_SIMD_AVX2
+#if HE_CPP_SIMD_AVX && defined(__AVX2__)
+#define HE_CPP_SIMD_AVX2 1
+#else
+#define HE_CPP_SIMD_AVX2 0
+#endif
+#endif
+
+/// <summary>
+/// AVX-512 with the F, BW, DQ, and VL subsets (the x86-64-v4 level): byte and word lanes need BW, and the mask moves
+/// behind ExtractMostSignificantBits need BW and DQ.
+/// </summary>
+#ifndef HE_CPP_SIMD_AVX512
+#if HE_CPP_SIMD_AVX2 && defined(__AVX512F__) && defined(__AVX512BW__) && defined(__AVX512DQ__) && defined(__AVX512VL__)
+#define HE_CPP_SIMD_AVX512 1
+#else
+#define HE_CPP_SIMD_AVX512 0
+#endif
+#endif
+
+/// <summary>
+/// x86-64 builds that do not target AVX-512 still carry the Vector512 register kernels, compiled for AVX-512 through
+/// HE_CPP_AVX512_TARGET, and enter them only after CpuFeatures reports the instruction set, so one binary serves
+/// machines with and without it. MSVC compiles AVX-512 intrinsics in any function and needs no attribute.
+/// </summary>
+#ifndef HE_CPP_SIMD_AVX512_DISPATCH
+#if !HE_CPP_SIMD_AVX512 && HE_CPP_SIMD_X86_TARGET && (defined(__x86_64__) || defined(_M_X64)) && (defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER))
+#define HE_CPP_SIMD_AVX512_DISPATCH 1
+#else
+#define HE_CPP_SIMD_AVX512_DISPATCH 0
+#endif
+#endif
+
+#if HE_CPP_SIMD_AVX512_DISPATCH && (defined(__GNUC__) || defined(__clang__))
+#define HE_CPP_AVX512_TARGET __attribute__((target("avx2,avx512f,avx512bw,avx512dq,avx512vl")))
+#else
+#define HE_CPP_AVX512_TARGET
+#endif
+
+/// <summary>
+/// The same arrangement one level down: x86-64 builds that do not target AVX compile AvxLanes for AVX2 through
+/// HE_CPP_AVX2_TARGET and let Vector256 enter it once CpuFeatures reports AVX2. Builds that target AVX without AVX2
+/// keep their float-only AvxLanes, since its functions inline into code that was not compiled for AVX2.
+/// </summary>
+#ifndef HE_CPP_SIMD_AVX2_DISPATCH
+#if !HE_CPP_SIMD_AVX && HE_CPP_SIMD_X86_TARGET && (defined(__x86_64__) || defined(_M_X64)) && (defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER))
+#define HE_CPP_SIMD_AVX2_DISPATCH 1
+#else
+#define HE_CPP_SIMD_AVX2_DISPATCH 0
+#endif
+#endif
+
+#if HE_CPP_SIMD_AVX2_DISPATCH && (defined(__GNUC__) || defined(__clang__))
+#define HE_CPP_AVX2_TARGET __attribute__((target("avx2")))
+#else
+#define HE_CPP_AVX2_TARGET
+#endif
+
+/// <summary>
+/// Generated methods that branch on Avx2.IsSupported or Vector256/Vector512.IsHardwareAccelerated are emitted as a
+/// baseline, an HE_CPP_AVX2_TARGET, and an HE_CPP_AVX512_TARGET clone behind a resolver that SimdDispatch binds once.
+/// Only GCC and Clang compile each clone for its own instruction set, so other compilers keep the single definition.
+/// </summary>
+#ifndef HE_CPP_SIMD_FUNCTION_DISPATCH
+#if (HE_CPP_SIMD_AVX2_DISPATCH || HE_CPP_SIMD_AVX512_DISPATCH) && (defined(__GNUC__) || defined(__clang__))
+#define HE_CPP_SIMD_FUNCTION_DISPATCH 1
+#else
+#define HE_CPP_SIMD_FUNCTION_DISPATCH 0
+#endif
+#endif
+
+/// <summary>
+/// Marks the Vector256 and Vector512 operations that lead to a target-attributed block kernel. GCC gives up on
+/// inlining such a kernel into its baseline caller for good, even after that caller inlines into an AVX2 or AVX-512
+/// clone, unless every function between the clone and the kernel is forced inline.
+/// </summary>
+#if HE_CPP_SIMD_FUNCTION_DISPATCH
+#define HE_CPP_SIMD_ALWAYS_INLINE __attribute__((always_inline))
+#else
+#define HE_CPP_SIMD_ALWAYS_INLINE
+#endif
+
+/// <summary>
+/// AArch64 Advanced SIMD. 32-bit ARM NEON lacks double lanes, 64-bit compares, and vector division, so it stays on the
+/// portable loops.
+/// </summary>
+#ifndef HE_CPP_SIMD_NEON
+#define HE_CPP_SIMD_NEON HE_CPP_SIMD_ARM64_TARGET
+#endif
+
+/// <summary>
+/// Bit width of System.Numerics.Vector&lt;T&gt;, 128 or 256. The platform profile fixes it through the generated config;
+/// otherwise it follows the widest integer vectors the target accelerates, as the managed runtime sizes Vector&lt;T&gt;.
+/// </summary>
+#ifndef HE_CPP_VECTOR_WIDTH_BITS
+#if HE_CPP_SIMD_AVX2
+#define HE_CPP_VECTOR_WIDTH_BITS 256
+#else
+#define HE_CPP_VECTOR_WIDTH_BITS 128
+#endif
+#endif
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "system/runtime/intrinsics/cpu_features.hpp"
+#include "system/runtime/intrinsics/simd_config.hpp"
+
+/// <summary>
+/// Picks one of the clones the code generator emits for a method that branches on Avx2.IsSupported or
+/// Vector256/Vector512.IsHardwareAccelerated when HE_CPP_SIMD_FUNCTION_DISPATCH is on. The generated resolver keeps the
+/// choice in a function-local static, so each later call costs one indirect call, and inside the chosen clone those
+/// branches and the Vector256/Vector512 kernels inline for the instruction set the clone was compiled for.
+/// </summary>
+class SimdDispatch {
+public:
+    /// <summary>
+    /// Returns the widest clone the running machine can execute. Works with plain and member function pointers.
+    /// </summary>
+    template <typename TFunction>
+    static TFunction Select(TFunction baseline, TFunction avx2, TFunction avx512) {
+        if (CpuFeatures::HasAvx512()) {
+            return avx512;
+        }
+
+        if (CpuFeatures::HasAvx2()) {
+            return avx2;
+        }
+
+        return baseline;
+    }
+};
@@ -7,19 +7,24 @@
 #include <type_traits>
 
 #include "system/numerics/vector.hpp"
+#include "system/runtime/intrinsics/vector_lanes.hpp"
 
+/// <summary>
+/// Managed Vector128&lt;T&gt;. The lanes live in 16-byte aligned storage so the SSE and NEON backends load them into a
+/// vector register with one aligned move; the per-lane loops below serve the targets without one.
+/// </summary>
 template <typename T>
-class Vector128_1 {
+class alignas(16) Vector128_1 {
     static T AllBitsSetValue() {
-        if constexpr (std::is_same_v<T, float>) {
-            uint32_t bits = 0xFFFFFFFFu;
+        if constexpr (std::is_floating_point_v<T>) {
+            VectorLaneBits<T> bits = static_cast<VectorLaneBits<T>>(~VectorLaneBits<T>());
             T value;
             std::memcpy(&value, &bits, sizeof(T));
             return value;
         } else if constexpr (std::is_integral_v<T>) {
             return static_cast<T>(~T());
         } else {
-            static_assert(std::is_same_v<T, float> || std::is_integral_v<T>, "Unsupported Vector128 mask lane type.");
+            static_assert(std::is_floating_point_v<T> || std::is_integral_v<T>, "Unsupported Vector128 mask lane type.");
         }
     }
 
@@ -92,6 +97,12 @@ public:
 
     Vector128_1 operator-() const {
         Vector128_1 result;
+        if constexpr (Vector128Lanes<T>::Supports(VectorLaneOperation::Arithmetic)) {
+            using Lanes = Vector128Lanes<T>;
+            Lanes::Store(result.Values, Lanes::Negate(Lanes::Load(Values)));
+            return result;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < LaneCount; ++laneIndex) {
             result.Values[laneIndex] = -Values[laneIndex];
         }
@@ -106,6 +117,12 @@ Vector128_1<T> operator|(const Vector128_1<T>& left, const Vector128_1<T>& right
 template <typename T>
 Vector128_1<T> operator+(const Vector128_1<T>& left, const Vector128_1<T>& right) {
     Vector128_1<T> result;
+    if constexpr (Vector128Lanes<T>::Supports(VectorLaneOperation::Arithmetic)) {
+        using Lanes = Vector128Lanes<T>;
+        Lanes::Store(result.Values, Lanes::Add(Lanes::Load(left.Values), Lanes::Load(right.Values)));
+        return result;
+    }
+
     for (int32_t laneIndex = 0; laneIndex < Vector128_1<T>::LaneCount; ++laneIndex) {
         result.Values[laneIndex] = left.Values[laneIndex] + right.Values[laneIndex];
     }
@@ -114,6 +131,12 @@ Vector128_1<T> operator+(const Vector128_1<T>& left, const Vector128_1<T>& right
 
 template <typename T>
 Vector128_1<T>& operator+=(Vector128_1<T>& left, const Vector128_1<T>& right) {
+    if constexpr (Vector128Lanes<T>::Supports(VectorLaneOperation::Arithmetic)) {
+        using Lanes = Vector128Lanes<T>;
+        Lanes::Store(left.Values, Lanes::Add(Lanes::Load(left.Values), Lanes::Load(right.Values)));
+        return left;
+    }
+
     for (int32_t laneIndex = 0; laneIndex < Vector128_1<T>::LaneCount; ++laneIndex) {
         left.Values[laneIndex] += right.Values[laneIndex];
     }
@@ -161,8 +184,8 @@ class Vector128 {
 
     template <typename T>
     static bool MaskLaneIsSet(const T& value) {
-        if constexpr (std::is_same_v<T, float>) {
-            return BitCast<uint32_t>(value) != 0;
+        if constexpr (std::is_floating_point_v<T>) {
+            return BitCast<VectorLaneBits<T>>(value) != 0;
         } else {
             return value != 0;
         }
@@ -170,12 +193,12 @@ class Vector128 {
 
     template <typename T>
     static T AllBitsSetValue() {
-        if constexpr (std::is_same_v<T, float>) {
-            return BitCastBack<float>(0xFFFFFFFFu);
+        if constexpr (std::is_floating_point_v<T>) {
+            return BitCastBack<T>(static_cast<VectorLaneBits<T>>(~VectorLaneBits<T>()));
         } else if constexpr (std::is_integral_v<T>) {
             return static_cast<T>(~T());
         } else {
-            static_assert(std::is_same_v<T, float> || std::is_integral_v<T>, "Unsupported Vector128 mask lane type.");
+            static_assert(std::is_floating_point_v<T> || std::is_integral_v<T>, "Unsupported Vector128 mask lane type.");
         }
     }
 
@@ -186,8 +209,8 @@ class Vector128 {
 
     template <typename T>
     static T BitwiseAndScalar(const T& left, const T& right) {
-        if constexpr (std::is_same_v<T, float>) {
-            return BitCastBack<float>(BitCast<uint32_t>(left) & BitCast<uint32_t>(right));
+        if constexpr (std::is_floating_point_v<T>) {
+            return BitCastBack<T>(BitCast<VectorLaneBits<T>>(left) & BitCast<VectorLaneBits<T>>(right));
         } else {
             return static_cast<T>(left & right);
         }
@@ -195,8 +218,8 @@ class Vector128 {
 
     template <typename T>
     static T BitwiseOrScalar(const T& left, const T& right) {
-        if constexpr (std::is_same_v<T, float>) {
-            return BitCastBack<float>(BitCast<uint32_t>(left) | BitCast<uint32_t>(right));
+        if constexpr (std::is_floating_point_v<T>) {
+            return BitCastBack<T>(BitCast<VectorLaneBits<T>>(left) | BitCast<VectorLaneBits<T>>(right));
         } else {
             return static_cast<T>(left | right);
         }
@@ -243,13 +266,19 @@ public:
         return value.template AsVector<TTo>();
     }
 
-    static bool get_IsHardwareAccelerated() {
-        return false;
+    static constexpr bool get_IsHardwareAccelerated() {
+        return Vector128Lanes<float>::Enabled;
     }
 
     template <typename T>
     static Vector128_1<T> BitwiseAnd(const Vector128_1<T>& left, const Vector128_1<T>& right) {
         Vector128_1<T> result;
+        if constexpr (Vector128Lanes<T>::Supports(VectorLaneOperation::Arithmetic)) {
+            using Lanes = Vector128Lanes<T>;
+            Lanes::Store(result.Values, Lanes::And(Lanes::Load(left.Values), Lanes::Load(right.Values)));
+            return result;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector128_1<T>::LaneCount; ++laneIndex) {
             result.Values[laneIndex] = BitwiseAndScalar(left.Values[laneIndex], right.Values[laneIndex]);
         }
@@ -259,15 +288,65 @@ public:
     template <typename T>
     static Vector128_1<T> BitwiseOr(const Vector128_1<T>& left, const Vector128_1<T>& right) {
         Vector128_1<T> result;
+        if constexpr (Vector128Lanes<T>::Supports(VectorLaneOperation::Arithmetic)) {
+            using Lanes = Vector128Lanes<T>;
+            Lanes::Store(result.Values, Lanes::Or(Lanes::Load(left.Values), Lanes::Load(right.Values)));
+            return result;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector128_1<T>::LaneCount; ++laneIndex) {
             result.Values[laneIndex] = BitwiseOrScalar(left.Values[laneIndex], right.Values[laneIndex]);
         }
         return result;
     }
 
+    template <typename T>
+    static Vector128_1<T> Xor(const Vector128_1<T>& left, const Vector128_1<T>& right) {
+        Vector128_1<T> result;
+        if constexpr (Vector128Lanes<T>::Supports(VectorLaneOperation::Arithmetic)) {
+            using Lanes = Vector128Lanes<T>;
+            Lanes::Store(result.Values, Lanes::Xor(Lanes::Load(left.Values), Lanes::Load(right.Values)));
+            return result;
+        }
+
+        for (int32_t laneIndex = 0; laneIndex < Vector128_1<T>::LaneCount; ++laneIndex) {
+            if constexpr (std::is_floating_point_v<T>) {
+                result.Values[laneIndex] = BitCastBack<T>(BitCast<VectorLaneBits<T>>(left.Values[laneIndex]) ^ BitCast<VectorLaneBits<T>>(right.Values[laneIndex]));
+            } else {
+                result.Values[laneIndex] = static_cast<T>(left.Values[laneIndex] ^ right.Values[laneIndex]);
+            }
+        }
+        return result;
+    }
+
+    template <typename T>
+    static Vector128_1<T> AndNot(const Vector128_1<T>& left, const Vector128_1<T>& right) {
+        Vector128_1<T> result;
+        if constexpr (Vector128Lanes<T>::Supports(VectorLaneOperation::Arithmetic)) {
+            using Lanes = Vector128Lanes<T>;
+            Lanes::Store(result.Values, Lanes::AndNot(Lanes::Load(left.Values), Lanes::Load(right.Values)));
+            return result;
+        }
+
+        for (int32_t laneIndex = 0; laneIndex < Vector128_1<T>::LaneCount; ++laneIndex) {
+            if constexpr (std::is_floating_point_v<T>) {
+                result.Values[laneIndex] = BitCastBack<T>(BitCast<VectorLaneBits<T>>(left.Values[laneIndex]) & (~BitCast<VectorLaneBits<T>>(right.Values[laneIndex])));
+            } else {
+                result.Values[laneIndex] = static_cast<T>(left.Values[laneIndex] & (~right.Values[laneIndex]));
+            }
+        }
+        return result;
+    }
+
     template <typename T>
     static Vector128_1<T> ConditionalSelect(const Vector128_1<T>& condition, const Vector128_1<T>& left, const Vector128_1<T>& right) {
         Vector128_1<T> result;
+        if constexpr (Vector128Lanes<T>::Supports(VectorLaneOperation::Arithmetic)) {
+            using Lanes = Vector128Lanes<T>;
+            Lanes::Store(result.Values, Lanes::Select(Lanes::Load(condition.Values), Lanes::Load(left.Values), Lanes::Load(right.Values)));
+            return result;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector128_1<T>::LaneCount; ++laneIndex) {
             result.Values[laneIndex] = MaskLaneIsSet(condition.Values[laneIndex]) ? left.Values[laneIndex] : right.Values[laneIndex];
         }
@@ -317,6 +396,12 @@ public:
     template <typename T>
     static Vector128_1<T> Equals(const Vector128_1<T>& left, const Vector128_1<T>& right) {
         Vector128_1<T> result;
+        if constexpr (Vector128Lanes<T>::Supports(VectorLaneOperation::CompareEqual)) {
+            using Lanes = Vector128Lanes<T>;
+            Lanes::Store(result.Values, Lanes::CompareEqual(Lanes::Load(left.Values), Lanes::Load(right.Values)));
+            return result;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector128_1<T>::LaneCount; ++laneIndex) {
             result.Values[laneIndex] = left.Values[laneIndex] == right.Values[laneIndex] ? AllBitsSetValue<T>() : ZeroValue<T>();
         }
@@ -325,11 +410,18 @@ public:
 
     template <typename T>
     static int32_t ExtractMostSignificantBits(const Vector128_1<T>& value) {
+        if constexpr (Vector128Lanes<T>::Supports(VectorLaneOperation::Arithmetic)) {
+            using Lanes = Vector128Lanes<T>;
+            return static_cast<int32_t>(Lanes::MoveMask(Lanes::Load(value.Values)));
+        }
+
         int32_t result = 0;
         for (int32_t laneIndex = 0; laneIndex < Vector128_1<T>::LaneCount; ++laneIndex) {
             bool laneMsbSet;
-            if constexpr (std::is_same_v<T, float>) {
-                laneMsbSet = (BitCast<uint32_t>(value.Values[laneIndex]) & 0x80000000u) != 0;
+            if constexpr (std::is_floating_point_v<T>) {
+                laneMsbSet = (BitCast<VectorLaneBits<T>>(value.Values[laneIndex]) >> (sizeof(T) * 8 - 1)) != 0;
+            } else if constexpr (std::is_integral_v<T>) {
+                laneMsbSet = (static_cast<std::make_unsigned_t<T>>(value.Values[laneIndex]) >> (sizeof(T) * 8 - 1)) != 0;
             } else {
                 laneMsbSet = value.Values[laneIndex] < 0;
             }
@@ -344,6 +436,12 @@ public:
     template <typename T>
     static Vector128_1<T> LessThan(const Vector128_1<T>& left, const Vector128_1<T>& right) {
         Vector128_1<T> result;
+        if constexpr (Vector128Lanes<T>::Supports(VectorLaneOperation::CompareOrder)) {
+            using Lanes = Vector128Lanes<T>;
+            Lanes::Store(result.Values, Lanes::CompareLessThan(Lanes::Load(left.Values), Lanes::Load(right.Values)));
+            return result;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector128_1<T>::LaneCount; ++laneIndex) {
             result.Values[laneIndex] = left.Values[laneIndex] < right.Values[laneIndex] ? AllBitsSetValue<T>() : ZeroValue<T>();
         }
@@ -353,6 +451,12 @@ public:
     template <typename T>
     static Vector128_1<T> LessThanOrEqual(const Vector128_1<T>& left, const Vector128_1<T>& right) {
         Vector128_1<T> result;
+        if constexpr (Vector128Lanes<T>::Supports(VectorLaneOperation::CompareOrder)) {
+            using Lanes = Vector128Lanes<T>;
+            Lanes::Store(result.Values, Lanes::CompareLessThanOrEqual(Lanes::Load(left.Values), Lanes::Load(right.Values)));
+            return result;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector128_1<T>::LaneCount; ++laneIndex) {
             result.Values[laneIndex] = left.Values[laneIndex] <= right.Values[laneIndex] ? AllBitsSetValue<T>() : ZeroValue<T>();
         }
@@ -362,6 +466,12 @@ public:
     template <typename T>
     static Vector128_1<T> Load(const T* source) {
         Vector128_1<T> result;
+        if constexpr (Vector128Lanes<T>::Supports(VectorLaneOperation::Arithmetic)) {
+            using Lanes = Vector128Lanes<T>;
+            Lanes::Store(result.Values, Lanes::LoadUnaligned(source));
+            return result;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector128_1<T>::LaneCount; ++laneIndex) {
             result.Values[laneIndex] = source[laneIndex];
         }
@@ -377,6 +487,12 @@ public:
     template <typename T>
     static Vector128_1<T> Max(const Vector128_1<T>& left, const Vector128_1<T>& right) {
         Vector128_1<T> result;
+        if constexpr (Vector128Lanes<T>::Supports(VectorLaneOperation::CompareOrder)) {
+            using Lanes = Vector128Lanes<T>;
+            Lanes::Store(result.Values, Lanes::Max(Lanes::Load(left.Values), Lanes::Load(right.Values)));
+            return result;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector128_1<T>::LaneCount; ++laneIndex) {
             result.Values[laneIndex] = std::max(left.Values[laneIndex], right.Values[laneIndex]);
         }
@@ -386,6 +502,12 @@ public:
     template <typename T>
     static Vector128_1<T> Min(const Vector128_1<T>& left, const Vector128_1<T>& right) {
         Vector128_1<T> result;
+        if constexpr (Vector128Lanes<T>::Supports(VectorLaneOperation::CompareOrder)) {
+            using Lanes = Vector128Lanes<T>;
+            Lanes::Store(result.Values, Lanes::Min(Lanes::Load(left.Values), Lanes::Load(right.Values)));
+            return result;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector128_1<T>::LaneCount; ++laneIndex) {
             result.Values[laneIndex] = std::min(left.Values[laneIndex], right.Values[laneIndex]);
         }
@@ -394,6 +516,12 @@ public:
 
     template <typename T>
     static void Store(const Vector128_1<T>& value, T* destination) {
+        if constexpr (Vector128Lanes<T>::Supports(VectorLaneOperation::Arithmetic)) {
+            using Lanes = Vector128Lanes<T>;
+            Lanes::StoreUnaligned(destination, Lanes::Load(value.Values));
+            return;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector128_1<T>::LaneCount; ++laneIndex) {
             destination[laneIndex] = value.Values[laneIndex];
         }
@@ -418,9 +546,31 @@ Vector128_1<T> operator|(const Vector128_1<T>& left, const Vector128_1<T>& right
 template <typename T>
 Vector128_1<T> operator-(const Vector128_1<T>& left, const Vector128_1<T>& right) {
     Vector128_1<T> result;
+    if constexpr (Vector128Lanes<T>::Supports(VectorLaneOperation::Arithmetic)) {
+        using Lanes = Vector128Lanes<T>;
+        Lanes::Store(result.Values, Lanes::Subtract(Lanes::Load(left.Values), Lanes::Load(right.Values)));
+        return result;
+    }
+
     for (int32_t laneIndex = 0; laneIndex < Vector128_1<T>::LaneCount; ++laneIndex) {
         result.Values[laneIndex] = left.Values[laneIndex] - right.Values[laneIndex];
     }
 
     return result;
 }
+
+template <typename T>
+Vector128_1<T> operator*(const Vector128_1<T>& left, const Vector128_1<T>& right) {
+    Vector128_1<T> result;
+    if constexpr (Vector128Lanes<T>::Supports(VectorLaneOperation::Multiply)) {
+        using Lanes = Vector128Lanes<T>;
+        Lanes::Store(result.Values, Lanes::Multiply(Lanes::Load(left.Values), Lanes::Load(right.Values)));
+        return result;
+    }
+
+    for (int32_t laneIndex = 0; laneIndex < Vector128_1<T>::LaneCount; ++laneIndex) {
+        result.Values[laneIndex] = left.Values[laneIndex] * right.Values[laneIndex];
+    }
+
+    return result;
+}
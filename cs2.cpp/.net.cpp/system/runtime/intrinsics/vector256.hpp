@@ -5,9 +5,15 @@
 #include <cstring>
 
 #include "system/numerics/vector.hpp"
+#include "system/runtime/intrinsics/cpu_features.hpp"
+#include "system/runtime/intrinsics/vector_lanes.hpp"
 
+/// <summary>
+/// Managed Vector256&lt;T&gt;. The lanes live in 32-byte aligned storage so an AVX register, or a pair of 128-bit
+/// registers on targets without one, loads them with aligned moves; the per-lane loops serve the remaining targets.
+/// </summary>
 template <typename T>
-class Vector256 {
+class alignas(32) Vector256 {
 public:
     static constexpr int32_t LaneCount = sizeof(T) >= 32 ? 1 : static_cast<int32_t>(32 / sizeof(T));
 
@@ -30,8 +36,8 @@ public:
     }
 
     static Vector256 get_AllBitsSet() {
-        if constexpr (std::is_same_v<T, float>) {
-            uint32_t bits = 0xFFFFFFFFu;
+        if constexpr (std::is_floating_point_v<T>) {
+            VectorLaneBits<T> bits = static_cast<VectorLaneBits<T>>(~VectorLaneBits<T>());
             T value;
             std::memcpy(&value, &bits, sizeof(T));
             return Vector256(value);
@@ -107,9 +113,87 @@ public:
     }
 };
 
+/// <summary>
+/// Runs Vector256 lane operations on AVX registers when the build targets AVX, or on x86-64 builds that do not, when
+/// CpuFeatures finds AVX2 on the running machine; otherwise on each 128-bit half through Vector128's backend. Each Try
+/// method returns false when no backend has the operation for this lane type, leaving the caller's per-lane loop.
+/// </summary>
 template <typename T>
-Vector256<T> operator+(const Vector256<T>& left, const Vector256<T>& right) {
+class Vector256Registers {
+    using Block = VectorLaneBlock<T, 32>;
+    using WideLanes = Vector256DispatchLanes<T>;
+
+public:
+    static constexpr bool Supports(VectorLaneOperation operation) {
+        return Block::Supports(operation);
+    }
+
+    /// <summary>
+    /// Reports whether the dispatched AVX2 kernels may run: the cached cpuid result on builds that dispatch, false on
+    /// the rest, whose Block already uses every register the target has.
+    /// </summary>
+    static bool UsesWideRegister() {
+#if HE_CPP_SIMD_AVX2_DISPATCH
+        return WideLanes::Enabled && CpuFeatures::HasAvx2();
+#else
+        return false;
+#endif
+    }
+
+    template <VectorLaneKernel Kernel>
+    HE_CPP_SIMD_ALWAYS_INLINE static bool TryBinary(const Vector256<T>& left, const Vector256<T>& right, Vector256<T>& result) {
+        constexpr VectorLaneOperation Operation = VectorLaneKernelOperation(Kernel);
+        if constexpr (WideLanes::Supports(Operation)) {
+            if (UsesWideRegister()) {
+                WideLanes::template BinaryBlock<Kernel>(left.Values, right.Values, result.Values);
+                return true;
+            }
+        }
+
+        if constexpr (Block::Supports(Operation)) {
+            Block::template Binary<Operation>(left.Values, right.Values, result.Values, [](auto lanes, auto leftLanes, auto rightLanes) {
+                return ApplyVectorLaneKernel<Kernel>(lanes, leftLanes, rightLanes);
+            });
+            return true;
+        }
+
+        return false;
+    }
+
+    HE_CPP_SIMD_ALWAYS_INLINE static bool TryMoveMask(const Vector256<T>& value, uint32_t& mask) {
+        if constexpr (WideLanes::Supports(VectorLaneOperation::Arithmetic)) {
+            if (UsesWideRegister()) {
+                mask = WideLanes::MoveMaskBlock(value.Values);
+                return true;
+            }
+        }
+
+        if constexpr (Block::Supports(VectorLaneOperation::Arithmetic)) {
+            mask = Block::MoveMask(value.Values);
+            return true;
+        }
+
+        return false;
+    }
+
+    static Vector256<T> LoadUnaligned(const T* source) {
+        Vector256<T> result;
+        Block::LoadUnaligned(source, result.Values);
+        return result;
+    }
+
+    static void StoreUnaligned(const Vector256<T>& value, T* destination) {
+        Block::StoreUnaligned(value.Values, destination);
+    }
+};
+
+template <typename T>
+HE_CPP_SIMD_ALWAYS_INLINE inline Vector256<T> operator+(const Vector256<T>& left, const Vector256<T>& right) {
     Vector256<T> result;
+    if (Vector256Registers<T>::template TryBinary<VectorLaneKernel::Add>(left, right, result)) {
+        return result;
+    }
+
     for (int32_t laneIndex = 0; laneIndex < Vector256<T>::LaneCount; ++laneIndex) {
         result.Values[laneIndex] = left.Values[laneIndex] + right.Values[laneIndex];
     }
@@ -118,8 +202,12 @@ Vector256<T> operator+(const Vector256<T>& left, const Vector256<T>& right) {
 }
 
 template <typename T>
-Vector256<T> operator-(const Vector256<T>& left, const Vector256<T>& right) {
+HE_CPP_SIMD_ALWAYS_INLINE inline Vector256<T> operator-(const Vector256<T>& left, const Vector256<T>& right) {
     Vector256<T> result;
+    if (Vector256Registers<T>::template TryBinary<VectorLaneKernel::Subtract>(left, right, result)) {
+        return result;
+    }
+
     for (int32_t laneIndex = 0; laneIndex < Vector256<T>::LaneCount; ++laneIndex) {
         result.Values[laneIndex] = left.Values[laneIndex] - right.Values[laneIndex];
     }
@@ -128,8 +216,12 @@ Vector256<T> operator-(const Vector256<T>& left, const Vector256<T>& right) {
 }
 
 template <typename T>
-Vector256<T> operator*(const Vector256<T>& left, const Vector256<T>& right) {
+HE_CPP_SIMD_ALWAYS_INLINE inline Vector256<T> operator*(const Vector256<T>& left, const Vector256<T>& right) {
     Vector256<T> result;
+    if (Vector256Registers<T>::template TryBinary<VectorLaneKernel::Multiply>(left, right, result)) {
+        return result;
+    }
+
     for (int32_t laneIndex = 0; laneIndex < Vector256<T>::LaneCount; ++laneIndex) {
         result.Values[laneIndex] = left.Values[laneIndex] * right.Values[laneIndex];
     }
@@ -166,18 +258,22 @@ class Vector256Runtime {
 
     template <typename T>
     static T AllBitsSetValue() {
-        if constexpr (std::is_same_v<T, float>) {
-            return BitCastBack<float>(0xFFFFFFFFu);
+        if constexpr (std::is_floating_point_v<T>) {
+            return BitCastBack<T>(static_cast<VectorLaneBits<T>>(~VectorLaneBits<T>()));
         } else if constexpr (std::is_integral_v<T>) {
             return static_cast<T>(~T());
         } else {
-            static_assert(std::is_same_v<T, float> || std::is_integral_v<T>, "Unsupported Vector256 mask lane type.");
+            static_assert(std::is_floating_point_v<T> || std::is_integral_v<T>, "Unsupported Vector256 mask lane type.");
         }
     }
 
 public:
-    static bool get_IsHardwareAccelerated() {
-        return false;
+    /// <summary>
+    /// Reports AVX2, as the managed runtime does: with AVX alone only the floating-point lanes have 256-bit registers.
+    /// On builds that dispatch at run time this is the cached cpuid answer rather than a constant.
+    /// </summary>
+    HE_CPP_SIMD_ALWAYS_INLINE static bool get_IsHardwareAccelerated() {
+        return Vector256Lanes<int32_t>::Enabled || Vector256Registers<int32_t>::UsesWideRegister();
     }
 
     template <typename T>
@@ -242,11 +338,15 @@ public:
 
     template <typename T>
     static Vector256<T> Load(const T* source) {
-        Vector256<T> result;
         if (source == nullptr) {
-            return result;
+            return Vector256<T>();
+        }
+
+        if constexpr (Vector256Registers<T>::Supports(VectorLaneOperation::Arithmetic)) {
+            return Vector256Registers<T>::LoadUnaligned(source);
         }
 
+        Vector256<T> result;
         for (int32_t laneIndex = 0; laneIndex < Vector256<T>::LaneCount; ++laneIndex) {
             result.Values[laneIndex] = source[laneIndex];
         }
@@ -259,66 +359,87 @@ public:
             return;
         }
 
+        if constexpr (Vector256Registers<T>::Supports(VectorLaneOperation::Arithmetic)) {
+            Vector256Registers<T>::StoreUnaligned(value, target);
+            return;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector256<T>::LaneCount; ++laneIndex) {
             target[laneIndex] = value.Values[laneIndex];
         }
     }
 
     template <typename T>
-    static Vector256<T> BitwiseOr(const Vector256<T>& left, const Vector256<T>& right) {
+    HE_CPP_SIMD_ALWAYS_INLINE static Vector256<T> BitwiseOr(const Vector256<T>& left, const Vector256<T>& right) {
         Vector256<T> result;
+        if (Vector256Registers<T>::template TryBinary<VectorLaneKernel::Or>(left, right, result)) {
+            return result;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector256<T>::LaneCount; ++laneIndex) {
-            if constexpr (std::is_same_v<T, float>) {
-                result.Values[laneIndex] = BitCastBack<float>(BitCast<uint32_t>(left.Values[laneIndex]) | BitCast<uint32_t>(right.Values[laneIndex]));
-            } else {
-                result.Values[laneIndex] = static_cast<T>(left.Values[laneIndex] | right.Values[laneIndex]);
-            }
+            using TBits = VectorLaneBits<T>;
+            TBits leftBits = BitCast<TBits>(left.Values[laneIndex]);
+            TBits rightBits = BitCast<TBits>(right.Values[laneIndex]);
+            result.Values[laneIndex] = BitCastBack<T>(static_cast<TBits>(leftBits | rightBits));
         }
         return result;
     }
 
     template <typename T>
-    static Vector256<T> BitwiseAnd(const Vector256<T>& left, const Vector256<T>& right) {
+    HE_CPP_SIMD_ALWAYS_INLINE static Vector256<T> BitwiseAnd(const Vector256<T>& left, const Vector256<T>& right) {
         Vector256<T> result;
+        if (Vector256Registers<T>::template TryBinary<VectorLaneKernel::And>(left, right, result)) {
+            return result;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector256<T>::LaneCount; ++laneIndex) {
-            if constexpr (std::is_same_v<T, float>) {
-                result.Values[laneIndex] = BitCastBack<float>(BitCast<uint32_t>(left.Values[laneIndex]) & BitCast<uint32_t>(right.Values[laneIndex]));
-            } else {
-                result.Values[laneIndex] = static_cast<T>(left.Values[laneIndex] & right.Values[laneIndex]);
-            }
+            using TBits = VectorLaneBits<T>;
+            TBits leftBits = BitCast<TBits>(left.Values[laneIndex]);
+            TBits rightBits = BitCast<TBits>(right.Values[laneIndex]);
+            result.Values[laneIndex] = BitCastBack<T>(static_cast<TBits>(leftBits & rightBits));
         }
         return result;
     }
 
     template <typename T>
-    static Vector256<T> Xor(const Vector256<T>& left, const Vector256<T>& right) {
+    HE_CPP_SIMD_ALWAYS_INLINE static Vector256<T> Xor(const Vector256<T>& left, const Vector256<T>& right) {
         Vector256<T> result;
+        if (Vector256Registers<T>::template TryBinary<VectorLaneKernel::Xor>(left, right, result)) {
+            return result;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector256<T>::LaneCount; ++laneIndex) {
-            if constexpr (std::is_same_v<T, float>) {
-                result.Values[laneIndex] = BitCastBack<float>(BitCast<uint32_t>(left.Values[laneIndex]) ^ BitCast<uint32_t>(right.Values[laneIndex]));
-            } else {
-                result.Values[laneIndex] = static_cast<T>(left.Values[laneIndex] ^ right.Values[laneIndex]);
-            }
+            using TBits = VectorLaneBits<T>;
+            TBits leftBits = BitCast<TBits>(left.Values[laneIndex]);
+            TBits rightBits = BitCast<TBits>(right.Values[laneIndex]);
+            result.Values[laneIndex] = BitCastBack<T>(static_cast<TBits>(leftBits ^ rightBits));
         }
         return result;
     }
 
     template <typename T>
-    static Vector256<T> AndNot(const Vector256<T>& left, const Vector256<T>& right) {
+    HE_CPP_SIMD_ALWAYS_INLINE static Vector256<T> AndNot(const Vector256<T>& left, const Vector256<T>& right) {
         Vector256<T> result;
+        if (Vector256Registers<T>::template TryBinary<VectorLaneKernel::AndNot>(left, right, result)) {
+            return result;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector256<T>::LaneCount; ++laneIndex) {
-            if constexpr (std::is_same_v<T, float>) {
-                result.Values[laneIndex] = BitCastBack<float>(BitCast<uint32_t>(left.Values[laneIndex]) & (~BitCast<uint32_t>(right.Values[laneIndex])));
-            } else {
-                result.Values[laneIndex] = static_cast<T>(left.Values[laneIndex] & (~right.Values[laneIndex]));
-            }
+            using TBits = VectorLaneBits<T>;
+            TBits leftBits = BitCast<TBits>(left.Values[laneIndex]);
+            TBits rightBits = BitCast<TBits>(right.Values[laneIndex]);
+            result.Values[laneIndex] = BitCastBack<T>(static_cast<TBits>(leftBits & (~rightBits)));
         }
         return result;
     }
 
     template <typename T>
-    static Vector256<T> LessThan(const Vector256<T>& left, const Vector256<T>& right) {
+    HE_CPP_SIMD_ALWAYS_INLINE static Vector256<T> LessThan(const Vector256<T>& left, const Vector256<T>& right) {
         Vector256<T> result;
+        if (Vector256Registers<T>::template TryBinary<VectorLaneKernel::CompareLessThan>(left, right, result)) {
+            return result;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector256<T>::LaneCount; ++laneIndex) {
             result.Values[laneIndex] = left.Values[laneIndex] < right.Values[laneIndex] ? AllBitsSetValue<T>() : T();
         }
@@ -326,8 +447,12 @@ public:
     }
 
     template <typename T>
-    static Vector256<T> LessThanOrEqual(const Vector256<T>& left, const Vector256<T>& right) {
+    HE_CPP_SIMD_ALWAYS_INLINE static Vector256<T> LessThanOrEqual(const Vector256<T>& left, const Vector256<T>& right) {
         Vector256<T> result;
+        if (Vector256Registers<T>::template TryBinary<VectorLaneKernel::CompareLessThanOrEqual>(left, right, result)) {
+            return result;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector256<T>::LaneCount; ++laneIndex) {
             result.Values[laneIndex] = left.Values[laneIndex] <= right.Values[laneIndex] ? AllBitsSetValue<T>() : T();
         }
@@ -335,8 +460,12 @@ public:
     }
 
     template <typename T>
-    static Vector256<T> Equals(const Vector256<T>& left, const Vector256<T>& right) {
+    HE_CPP_SIMD_ALWAYS_INLINE static Vector256<T> Equals(const Vector256<T>& left, const Vector256<T>& right) {
         Vector256<T> result;
+        if (Vector256Registers<T>::template TryBinary<VectorLaneKernel::CompareEqual>(left, right, result)) {
+            return result;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector256<T>::LaneCount; ++laneIndex) {
             result.Values[laneIndex] = left.Values[laneIndex] == right.Values[laneIndex] ? AllBitsSetValue<T>() : T();
         }
@@ -344,17 +473,16 @@ public:
     }
 
     template <typename T>
-    static uint32_t ExtractMostSignificantBits(const Vector256<T>& value) {
+    HE_CPP_SIMD_ALWAYS_INLINE static uint32_t ExtractMostSignificantBits(const Vector256<T>& value) {
         uint32_t bits = 0;
+        if (Vector256Registers<T>::TryMoveMask(value, bits)) {
+            return bits;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector256<T>::LaneCount && laneIndex < 32; ++laneIndex) {
-            if constexpr (std::is_same_v<T, float>) {
-                uint32_t laneBits = BitCast<uint32_t>(value.Values[laneIndex]);
-                bits |= ((laneBits >> 31) & 1u) << laneIndex;
-            } else {
-                using TBits = std::make_unsigned_t<T>;
-                TBits laneBits = static_cast<TBits>(value.Values[laneIndex]);
-                bits |= ((laneBits >> ((sizeof(TBits) * 8) - 1)) & 1u) << laneIndex;
-            }
+            using TBits = VectorLaneBits<T>;
+            TBits laneBits = BitCast<TBits>(value.Values[laneIndex]);
+            bits |= ((laneBits >> ((sizeof(TBits) * 8) - 1)) & 1u) << laneIndex;
         }
         return bits;
     }
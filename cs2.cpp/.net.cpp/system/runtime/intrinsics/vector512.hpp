@@ -6,12 +6,207 @@
 #include <type_traits>
 
 #include "system/numerics/vector.hpp"
+#include "system/runtime/intrinsics/cpu_features.hpp"
+#include "system/runtime/intrinsics/vector_lanes.hpp"
 
+/// <summary>
+/// Managed Vector512&lt;T&gt;. The lanes live in 64-byte aligned storage so one AVX-512 register loads them with an
+/// aligned move; without one, the operations run on AVX or SSE registers over each 256- or 128-bit part.
+/// </summary>
 template <typename T>
-class Vector512;
+class alignas(64) Vector512 {
+public:
+    static constexpr int32_t LaneCount = sizeof(T) >= 64 ? 1 : static_cast<int32_t>(64 / sizeof(T));
+
+    T Values[LaneCount];
+
+    Vector512() {
+        for (int32_t laneIndex = 0; laneIndex < LaneCount; ++laneIndex) {
+            Values[laneIndex] = T();
+        }
+    }
+
+    explicit Vector512(const T& value) {
+        for (int32_t laneIndex = 0; laneIndex < LaneCount; ++laneIndex) {
+            Values[laneIndex] = value;
+        }
+    }
+
+    static Vector512 get_Zero() {
+        return Vector512(T());
+    }
+
+    static Vector512 get_AllBitsSet() {
+        if constexpr (std::is_floating_point_v<T>) {
+            VectorLaneBits<T> bits = static_cast<VectorLaneBits<T>>(~VectorLaneBits<T>());
+            T value;
+            std::memcpy(&value, &bits, sizeof(T));
+            return Vector512(value);
+        } else {
+            return Vector512(static_cast<T>(~T()));
+        }
+    }
+
+    T& operator[](size_t index) {
+        return Values[index];
+    }
+
+    const T& operator[](size_t index) const {
+        return Values[index];
+    }
+};
 
 /// <summary>
-/// Provides a portable subset of System.Runtime.Intrinsics.Vector512 used by transpiled managed numerics.
+/// Runs Vector512 lane operations on one AVX-512 register when the build targets AVX-512, or on x86-64 builds that do
+/// not, when CpuFeatures finds it on the running machine; otherwise on each 256- or 128-bit part through
+/// VectorLaneBlock. Each Try method returns false when no backend has the operation for this lane type, leaving the
+/// caller's per-lane loop.
+/// </summary>
+template <typename T>
+class Vector512Registers {
+    using Block = VectorLaneBlock<T, 64>;
+    using WideLanes = Vector512Lanes<T>;
+
+public:
+    /// <summary>
+    /// Reports whether the AVX-512 kernels may run: a constant on builds that target AVX-512, a cached cpuid result
+    /// on builds that dispatch.
+    /// </summary>
+    static bool UsesWideRegister() {
+#if HE_CPP_SIMD_AVX512
+        return WideLanes::Enabled;
+#elif HE_CPP_SIMD_AVX512_DISPATCH
+        return WideLanes::Enabled && CpuFeatures::HasAvx512();
+#else
+        return false;
+#endif
+    }
+
+    template <VectorLaneKernel Kernel>
+    HE_CPP_SIMD_ALWAYS_INLINE static bool TryBinary(const Vector512<T>& left, const Vector512<T>& right, Vector512<T>& result) {
+        constexpr VectorLaneOperation Operation = VectorLaneKernelOperation(Kernel);
+        if constexpr (WideLanes::Supports(Operation)) {
+            if (UsesWideRegister()) {
+                WideLanes::template BinaryBlock<Kernel>(left.Values, right.Values, result.Values);
+                return true;
+            }
+        }
+
+        if constexpr (Block::Supports(Operation)) {
+            Block::template Binary<Operation>(left.Values, right.Values, result.Values, [](auto lanes, auto leftLanes, auto rightLanes) {
+                return ApplyVectorLaneKernel<Kernel>(lanes, leftLanes, rightLanes);
+            });
+            return true;
+        }
+
+        return false;
+    }
+
+    /// <summary>
+    /// Compares every lane pair into <paramref name="mask"/>, one bit per lane. On AVX-512 the bits come straight
+    /// from the opmask register the comparison writes.
+    /// </summary>
+    template <VectorLaneKernel Kernel>
+    HE_CPP_SIMD_ALWAYS_INLINE static bool TryCompareMask(const Vector512<T>& left, const Vector512<T>& right, uint64_t& mask) {
+        constexpr VectorLaneOperation Operation = VectorLaneKernelOperation(Kernel);
+        if constexpr (WideLanes::Supports(Operation)) {
+            if (UsesWideRegister()) {
+                mask = WideLanes::template CompareMaskBlock<Kernel>(left.Values, right.Values);
+                return true;
+            }
+        }
+
+        if constexpr (Block::Supports(Operation)) {
+            alignas(64) T comparison[Vector512<T>::LaneCount];
+            Block::template Binary<Operation>(left.Values, right.Values, comparison, [](auto lanes, auto leftLanes, auto rightLanes) {
+                return ApplyVectorLaneKernel<Kernel>(lanes, leftLanes, rightLanes);
+            });
+            mask = Block::MoveMask(comparison);
+            return true;
+        }
+
+        return false;
+    }
+
+    HE_CPP_SIMD_ALWAYS_INLINE static bool TrySelect(const Vector512<T>& condition, const Vector512<T>& left, const Vector512<T>& right, Vector512<T>& result) {
+        if constexpr (WideLanes::Supports(VectorLaneOperation::Arithmetic)) {
+            if (UsesWideRegister()) {
+                WideLanes::SelectBlock(condition.Values, left.Values, right.Values, result.Values);
+                return true;
+            }
+        }
+
+        if constexpr (Block::Supports(VectorLaneOperation::Arithmetic)) {
+            Block::template Ternary<VectorLaneOperation::Arithmetic>(condition.Values, left.Values, right.Values, result.Values, [](auto lanes, auto conditionLanes, auto leftLanes, auto rightLanes) {
+                return decltype(lanes)::Select(conditionLanes, leftLanes, rightLanes);
+            });
+            return true;
+        }
+
+        return false;
+    }
+
+    HE_CPP_SIMD_ALWAYS_INLINE static bool TryMoveMask(const Vector512<T>& value, uint64_t& mask) {
+        if constexpr (WideLanes::Supports(VectorLaneOperation::Arithmetic)) {
+            if (UsesWideRegister()) {
+                mask = WideLanes::MoveMaskBlock(value.Values);
+                return true;
+            }
+        }
+
+        if constexpr (Block::Supports(VectorLaneOperation::Arithmetic)) {
+            mask = Block::MoveMask(value.Values);
+            return true;
+        }
+
+        return false;
+    }
+};
+
+template <typename T>
+HE_CPP_SIMD_ALWAYS_INLINE inline Vector512<T> operator+(const Vector512<T>& left, const Vector512<T>& right) {
+    Vector512<T> result;
+    if (Vector512Registers<T>::template TryBinary<VectorLaneKernel::Add>(left, right, result)) {
+        return result;
+    }
+
+    for (int32_t laneIndex = 0; laneIndex < Vector512<T>::LaneCount; ++laneIndex) {
+        result.Values[laneIndex] = left.Values[laneIndex] + right.Values[laneIndex];
+    }
+
+    return result;
+}
+
+template <typename T>
+HE_CPP_SIMD_ALWAYS_INLINE inline Vector512<T> operator-(const Vector512<T>& left, const Vector512<T>& right) {
+    Vector512<T> result;
+    if (Vector512Registers<T>::template TryBinary<VectorLaneKernel::Subtract>(left, right, result)) {
+        return result;
+    }
+
+    for (int32_t laneIndex = 0; laneIndex < Vector512<T>::LaneCount; ++laneIndex) {
+        result.Values[laneIndex] = left.Values[laneIndex] - right.Values[laneIndex];
+    }
+
+    return result;
+}
+
+template <typename T>
+HE_CPP_SIMD_ALWAYS_INLINE inline Vector512<T> operator*(const Vector512<T>& left, const Vector512<T>& right) {
+    Vector512<T> result;
+    if (Vector512Registers<T>::template TryBinary<VectorLaneKernel::Multiply>(left, right, result)) {
+        return result;
+    }
+
+    for (int32_t laneIndex = 0; laneIndex < Vector512<T>::LaneCount; ++laneIndex) {
+        result.Values[laneIndex] = left.Values[laneIndex] * right.Values[laneIndex];
+    }
+
+    return result;
+}
+
+/// <summary>
+/// Provides the subset of System.Runtime.Intrinsics.Vector512 used by transpiled managed numerics.
 /// </summary>
 class Vector512Runtime {
     template <typename TBits, typename TValue>
@@ -22,22 +217,58 @@ class Vector512Runtime {
         return bits;
     }
 
+    template <typename TValue, typename TBits>
+    static TValue BitCastBack(const TBits& bits) {
+        static_assert(sizeof(TValue) == sizeof(TBits));
+        TValue value;
+        std::memcpy(&value, &bits, sizeof(TValue));
+        return value;
+    }
+
+    template <typename T>
+    static uint64_t AllLanesMask() {
+        return Vector512<T>::LaneCount >= 64 ? ~0ull : (1ull << Vector512<T>::LaneCount) - 1;
+    }
+
+    template <VectorLaneKernel Kernel, typename T, typename TCompare>
+    HE_CPP_SIMD_ALWAYS_INLINE static uint64_t CompareMask(const Vector512<T>& left, const Vector512<T>& right, TCompare compare) {
+        uint64_t mask = 0;
+        if (Vector512Registers<T>::template TryCompareMask<Kernel>(left, right, mask)) {
+            return mask;
+        }
+
+        for (int32_t laneIndex = 0; laneIndex < Vector512<T>::LaneCount; ++laneIndex) {
+            if (compare(left.Values[laneIndex], right.Values[laneIndex])) {
+                mask |= 1ull << laneIndex;
+            }
+        }
+
+        return mask;
+    }
+
 public:
     template <typename T>
     static T AllBitsSetValue() {
-        if constexpr (std::is_same_v<T, float>) {
-            return BitCast<float>(0xFFFFFFFFu);
-        } else if constexpr (std::is_same_v<T, double>) {
-            return BitCast<double>(0xFFFFFFFFFFFFFFFFull);
+        if constexpr (std::is_floating_point_v<T>) {
+            return BitCastBack<T>(static_cast<VectorLaneBits<T>>(~VectorLaneBits<T>()));
         } else if constexpr (std::is_integral_v<T>) {
             return static_cast<T>(~T());
         } else {
-            static_assert(std::is_same_v<T, float> || std::is_same_v<T, double> || std::is_integral_v<T>, "Unsupported Vector512 mask lane type.");
+            static_assert(std::is_floating_point_v<T> || std::is_integral_v<T>, "Unsupported Vector512 mask lane type.");
         }
     }
 
-    static bool get_IsHardwareAccelerated() {
-        return false;
+    /// <summary>
+    /// Reports AVX-512 as the managed runtime does. On builds that dispatch at run time this is the cached cpuid
+    /// answer rather than a constant.
+    /// </summary>
+    HE_CPP_SIMD_ALWAYS_INLINE static bool get_IsHardwareAccelerated() {
+        return Vector512Registers<int32_t>::UsesWideRegister();
+    }
+
+    template <typename T>
+    static Vector512<T> Create(const T& value) {
+        return Vector512<T>(value);
     }
 
     template <typename T>
@@ -57,98 +288,204 @@ public:
     }
 
     template <typename T>
-    static Vector512<T> BitwiseOr(const Vector512<T>& left, const Vector512<T>& right) {
+    HE_CPP_SIMD_ALWAYS_INLINE static Vector512<T> BitwiseAnd(const Vector512<T>& left, const Vector512<T>& right) {
         Vector512<T> result;
+        if (Vector512Registers<T>::template TryBinary<VectorLaneKernel::And>(left, right, result)) {
+            return result;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector512<T>::LaneCount; ++laneIndex) {
-            using TBits = std::conditional_t<sizeof(T) == 8, uint64_t, uint32_t>;
+            using TBits = VectorLaneBits<T>;
             TBits leftBits = BitCast<TBits>(left.Values[laneIndex]);
             TBits rightBits = BitCast<TBits>(right.Values[laneIndex]);
-            TBits resultBits = leftBits | rightBits;
-            std::memcpy(&result.Values[laneIndex], &resultBits, sizeof(T));
+            result.Values[laneIndex] = BitCastBack<T>(static_cast<TBits>(leftBits & rightBits));
         }
         return result;
     }
 
     template <typename T>
-    static Vector512<T> Xor(const Vector512<T>& left, const Vector512<T>& right) {
+    HE_CPP_SIMD_ALWAYS_INLINE static Vector512<T> BitwiseOr(const Vector512<T>& left, const Vector512<T>& right) {
         Vector512<T> result;
+        if (Vector512Registers<T>::template TryBinary<VectorLaneKernel::Or>(left, right, result)) {
+            return result;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector512<T>::LaneCount; ++laneIndex) {
-            using TBits = std::conditional_t<sizeof(T) == 8, uint64_t, uint32_t>;
+            using TBits = VectorLaneBits<T>;
             TBits leftBits = BitCast<TBits>(left.Values[laneIndex]);
             TBits rightBits = BitCast<TBits>(right.Values[laneIndex]);
-            TBits resultBits = leftBits ^ rightBits;
-            std::memcpy(&result.Values[laneIndex], &resultBits, sizeof(T));
+            result.Values[laneIndex] = BitCastBack<T>(static_cast<TBits>(leftBits | rightBits));
         }
         return result;
     }
 
     template <typename T>
-    static Vector512<T> AndNot(const Vector512<T>& left, const Vector512<T>& right) {
+    HE_CPP_SIMD_ALWAYS_INLINE static Vector512<T> Xor(const Vector512<T>& left, const Vector512<T>& right) {
         Vector512<T> result;
+        if (Vector512Registers<T>::template TryBinary<VectorLaneKernel::Xor>(left, right, result)) {
+            return result;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector512<T>::LaneCount; ++laneIndex) {
-            using TBits = std::conditional_t<sizeof(T) == 8, uint64_t, uint32_t>;
+            using TBits = VectorLaneBits<T>;
             TBits leftBits = BitCast<TBits>(left.Values[laneIndex]);
             TBits rightBits = BitCast<TBits>(right.Values[laneIndex]);
-            TBits resultBits = leftBits & (~rightBits);
-            std::memcpy(&result.Values[laneIndex], &resultBits, sizeof(T));
+            result.Values[laneIndex] = BitCastBack<T>(static_cast<TBits>(leftBits ^ rightBits));
         }
         return result;
     }
 
     template <typename T>
-    static Vector512<T> Equals(const Vector512<T>& left, const Vector512<T>& right) {
+    HE_CPP_SIMD_ALWAYS_INLINE static Vector512<T> AndNot(const Vector512<T>& left, const Vector512<T>& right) {
         Vector512<T> result;
+        if (Vector512Registers<T>::template TryBinary<VectorLaneKernel::AndNot>(left, right, result)) {
+            return result;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector512<T>::LaneCount; ++laneIndex) {
-            result.Values[laneIndex] = left.Values[laneIndex] == right.Values[laneIndex] ? AllBitsSetValue<T>() : T();
+            using TBits = VectorLaneBits<T>;
+            TBits leftBits = BitCast<TBits>(left.Values[laneIndex]);
+            TBits rightBits = BitCast<TBits>(right.Values[laneIndex]);
+            result.Values[laneIndex] = BitCastBack<T>(static_cast<TBits>(leftBits & (~rightBits)));
         }
         return result;
     }
 
+    /// <summary>
+    /// Takes each bit from <paramref name="left"/> where <paramref name="condition"/> is set and from
+    /// <paramref name="right"/> elsewhere.
+    /// </summary>
     template <typename T>
-    static uint64_t ExtractMostSignificantBits(const Vector512<T>& value) {
-        uint64_t bits = 0;
-        for (int32_t laneIndex = 0; laneIndex < Vector512<T>::LaneCount && laneIndex < 64; ++laneIndex) {
-            using TBits = std::conditional_t<sizeof(T) == 8, uint64_t, uint32_t>;
-            TBits laneBits = BitCast<TBits>(value.Values[laneIndex]);
-            uint64_t signBit = static_cast<uint64_t>((laneBits >> ((sizeof(TBits) * 8) - 1)) & 1);
-            bits |= signBit << laneIndex;
+    HE_CPP_SIMD_ALWAYS_INLINE static Vector512<T> ConditionalSelect(const Vector512<T>& condition, const Vector512<T>& left, const Vector512<T>& right) {
+        Vector512<T> result;
+        if (Vector512Registers<T>::TrySelect(condition, left, right, result)) {
+            return result;
         }
-        return bits;
+
+        for (int32_t laneIndex = 0; laneIndex < Vector512<T>::LaneCount; ++laneIndex) {
+            using TBits = VectorLaneBits<T>;
+            TBits conditionBits = BitCast<TBits>(condition.Values[laneIndex]);
+            TBits leftBits = BitCast<TBits>(left.Values[laneIndex]);
+            TBits rightBits = BitCast<TBits>(right.Values[laneIndex]);
+            result.Values[laneIndex] = BitCastBack<T>(static_cast<TBits>((conditionBits & leftBits) | (~conditionBits & rightBits)));
+        }
+        return result;
     }
-};
 
-template <typename T>
-class Vector512 {
-public:
-    static constexpr int32_t LaneCount = sizeof(T) >= 64 ? 1 : static_cast<int32_t>(64 / sizeof(T));
+    template <typename T>
+    HE_CPP_SIMD_ALWAYS_INLINE static Vector512<T> Equals(const Vector512<T>& left, const Vector512<T>& right) {
+        Vector512<T> result;
+        if (Vector512Registers<T>::template TryBinary<VectorLaneKernel::CompareEqual>(left, right, result)) {
+            return result;
+        }
 
-    T Values[LaneCount];
+        for (int32_t laneIndex = 0; laneIndex < Vector512<T>::LaneCount; ++laneIndex) {
+            result.Values[laneIndex] = left.Values[laneIndex] == right.Values[laneIndex] ? AllBitsSetValue<T>() : T();
+        }
+        return result;
+    }
 
-    Vector512() {
-        for (int32_t laneIndex = 0; laneIndex < LaneCount; ++laneIndex) {
-            Values[laneIndex] = T();
+    template <typename T>
+    HE_CPP_SIMD_ALWAYS_INLINE static Vector512<T> GreaterThan(const Vector512<T>& left, const Vector512<T>& right) {
+        Vector512<T> result;
+        if (Vector512Registers<T>::template TryBinary<VectorLaneKernel::CompareGreaterThan>(left, right, result)) {
+            return result;
+        }
+
+        for (int32_t laneIndex = 0; laneIndex < Vector512<T>::LaneCount; ++laneIndex) {
+            result.Values[laneIndex] = left.Values[laneIndex] > right.Values[laneIndex] ? AllBitsSetValue<T>() : T();
         }
+        return result;
     }
 
-    explicit Vector512(const T& value) {
-        for (int32_t laneIndex = 0; laneIndex < LaneCount; ++laneIndex) {
-            Values[laneIndex] = value;
+    template <typename T>
+    HE_CPP_SIMD_ALWAYS_INLINE static Vector512<T> LessThan(const Vector512<T>& left, const Vector512<T>& right) {
+        Vector512<T> result;
+        if (Vector512Registers<T>::template TryBinary<VectorLaneKernel::CompareLessThan>(left, right, result)) {
+            return result;
+        }
+
+        for (int32_t laneIndex = 0; laneIndex < Vector512<T>::LaneCount; ++laneIndex) {
+            result.Values[laneIndex] = left.Values[laneIndex] < right.Values[laneIndex] ? AllBitsSetValue<T>() : T();
         }
+        return result;
     }
 
-    static Vector512 get_Zero() {
-        return Vector512(T());
+    template <typename T>
+    HE_CPP_SIMD_ALWAYS_INLINE static Vector512<T> LessThanOrEqual(const Vector512<T>& left, const Vector512<T>& right) {
+        Vector512<T> result;
+        if (Vector512Registers<T>::template TryBinary<VectorLaneKernel::CompareLessThanOrEqual>(left, right, result)) {
+            return result;
+        }
+
+        for (int32_t laneIndex = 0; laneIndex < Vector512<T>::LaneCount; ++laneIndex) {
+            result.Values[laneIndex] = left.Values[laneIndex] <= right.Values[laneIndex] ? AllBitsSetValue<T>() : T();
+        }
+        return result;
     }
 
-    static Vector512 get_AllBitsSet() {
-        return Vector512(Vector512Runtime::AllBitsSetValue<T>());
+    template <typename T>
+    HE_CPP_SIMD_ALWAYS_INLINE static bool EqualsAll(const Vector512<T>& left, const Vector512<T>& right) {
+        return CompareMask<VectorLaneKernel::CompareEqual>(left, right, [](const T& leftValue, const T& rightValue) {
+            return leftValue == rightValue;
+        }) == AllLanesMask<T>();
     }
 
-    T& operator[](size_t index) {
-        return Values[index];
+    template <typename T>
+    HE_CPP_SIMD_ALWAYS_INLINE static bool EqualsAny(const Vector512<T>& left, const Vector512<T>& right) {
+        return CompareMask<VectorLaneKernel::CompareEqual>(left, right, [](const T& leftValue, const T& rightValue) {
+            return leftValue == rightValue;
+        }) != 0;
     }
 
-    const T& operator[](size_t index) const {
-        return Values[index];
+    /// <summary>
+    /// Lane-wise minimum matching std::min: <paramref name="left"/> wins ties and unordered lanes.
+    /// </summary>
+    template <typename T>
+    HE_CPP_SIMD_ALWAYS_INLINE static Vector512<T> Min(const Vector512<T>& left, const Vector512<T>& right) {
+        Vector512<T> result;
+        if (Vector512Registers<T>::template TryBinary<VectorLaneKernel::Min>(left, right, result)) {
+            return result;
+        }
+
+        for (int32_t laneIndex = 0; laneIndex < Vector512<T>::LaneCount; ++laneIndex) {
+            result.Values[laneIndex] = right.Values[laneIndex] < left.Values[laneIndex] ? right.Values[laneIndex] : left.Values[laneIndex];
+        }
+        return result;
+    }
+
+    /// <summary>
+    /// Lane-wise maximum matching std::max: <paramref name="left"/> wins ties and unordered lanes.
+    /// </summary>
+    template <typename T>
+    HE_CPP_SIMD_ALWAYS_INLINE static Vector512<T> Max(const Vector512<T>& left, const Vector512<T>& right) {
+        Vector512<T> result;
+        if (Vector512Registers<T>::template TryBinary<VectorLaneKernel::Max>(left, right, result)) {
+            return result;
+        }
+
+        for (int32_t laneIndex = 0; laneIndex < Vector512<T>::LaneCount; ++laneIndex) {
+            result.Values[laneIndex] = left.Values[laneIndex] < right.Values[laneIndex] ? right.Values[laneIndex] : left.Values[laneIndex];
+        }
+        return result;
+    }
+
+    /// <summary>
+    /// Gathers each lane's sign bit; one vpmov*2m on AVX-512.
+    /// </summary>
+    template <typename T>
+    HE_CPP_SIMD_ALWAYS_INLINE static uint64_t ExtractMostSignificantBits(const Vector512<T>& value) {
+        uint64_t bits = 0;
+        if (Vector512Registers<T>::TryMoveMask(value, bits)) {
+            return bits;
+        }
+
+        for (int32_t laneIndex = 0; laneIndex < Vector512<T>::LaneCount && laneIndex < 64; ++laneIndex) {
+            using TBits = VectorLaneBits<T>;
+            TBits laneBits = BitCast<TBits>(value.Values[laneIndex]);
+            uint64_t signBit = static_cast<uint64_t>((laneBits >> ((sizeof(TBits) * 8) - 1)) & 1);
+            bits |= signBit << laneIndex;
+        }
+        return bits;
     }
 };
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+/// <summary>
+/// Groups of lane operations a register backend may or may not provide for a given lane type.
+/// </summary>
+enum class VectorLaneOperation {
+    /// <summary>Load, Store, Add, Subtract, Negate, the bitwise operations, Select, and MoveMask.</summary>
+    Arithmetic,
+    Multiply,
+    Divide,
+    CompareEqual,
+    /// <summary>LessThan, LessThanOrEqual, GreaterThan, Min, and Max.</summary>
+    CompareOrder
+};
+
+/// <summary>
+/// Binary lane operations by name. Most call sites hand the lane backends a generic lambda instead; the names exist for
+/// runtime-dispatched paths, whose register work must happen inside a function compiled for the wider instruction set
+/// where an ordinary lambda cannot follow.
+/// </summary>
+enum class VectorLaneKernel {
+    Add,
+    Subtract,
+    Multiply,
+    Divide,
+    And,
+    Or,
+    Xor,
+    AndNot,
+    CompareEqual,
+    CompareGreaterThan,
+    CompareLessThan,
+    CompareLessThanOrEqual,
+    Min,
+    Max
+};
+
+/// <summary>
+/// Returns the operation group a backend must support to run <paramref name="kernel"/>.
+/// </summary>
+constexpr VectorLaneOperation VectorLaneKernelOperation(VectorLaneKernel kernel) {
+    switch (kernel) {
+    case VectorLaneKernel::Add:
+    case VectorLaneKernel::Subtract:
+    case VectorLaneKernel::And:
+    case VectorLaneKernel::Or:
+    case VectorLaneKernel::Xor:
+    case VectorLaneKernel::AndNot:
+        return VectorLaneOperation::Arithmetic;
+    case VectorLaneKernel::Multiply:
+        return VectorLaneOperation::Multiply;
+    case VectorLaneKernel::Divide:
+        return VectorLaneOperation::Divide;
+    case VectorLaneKernel::CompareEqual:
+        return VectorLaneOperation::CompareEqual;
+    case VectorLaneKernel::CompareGreaterThan:
+    case VectorLaneKernel::CompareLessThan:
+    case VectorLaneKernel::CompareLessThanOrEqual:
+    case VectorLaneKernel::Min:
+    case VectorLaneKernel::Max:
+        return VectorLaneOperation::CompareOrder;
+    }
+
+    return VectorLaneOperation::Arithmetic;
+}
+
+/// <summary>
+/// Register backend for targets without vector instructions. Every operation reports unsupported, so the vector types
+/// keep their per-lane loops.
+/// </summary>
+template <typename T>
+struct PortableLanes {
+    static constexpr bool Enabled = false;
+
+    static constexpr bool Supports(VectorLaneOperation) {
+        return false;
+    }
+};
+
+/// <summary>
+/// Unsigned integer as wide as one lane of <typeparamref name="T"/>, used to treat floating-point lanes as bit patterns.
+/// </summary>
+template <typename T>
+using VectorLaneBits = std::conditional_t<sizeof(T) == 8, uint64_t,
+    std::conditional_t<sizeof(T) == 4, uint32_t, std::conditional_t<sizeof(T) == 2, uint16_t, uint8_t>>>;
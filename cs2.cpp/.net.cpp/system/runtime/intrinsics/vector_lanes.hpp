@@ -0,0 +1,234 @@
+#pragma once
+
+#include "system/runtime/intrinsics/simd_config.hpp"
+#include "system/runtime/intrinsics/vector_lane_operation.hpp"
+#include "system/runtime/intrinsics/x86/sse_lanes.hpp"
+#include "system/runtime/intrinsics/x86/avx_lanes.hpp"
+#include "system/runtime/intrinsics/x86/avx512_lanes.hpp"
+#include "system/runtime/intrinsics/arm/neon_lanes.hpp"
+
+/// <summary>
+/// Register backend behind Vector128 on the compile target.
+/// </summary>
+#if HE_CPP_SIMD_SSE2
+template <typename T>
+using Vector128Lanes = SseLanes<T>;
+#elif HE_CPP_SIMD_NEON
+template <typename T>
+using Vector128Lanes = NeonLanes<T>;
+#else
+template <typename T>
+using Vector128Lanes = PortableLanes<T>;
+#endif
+
+/// <summary>
+/// Register backend behind Vector256 on the compile target. Where it lacks an operation that Vector128Lanes has, the
+/// vector types run the 128-bit path on each half instead.
+/// </summary>
+#if HE_CPP_SIMD_AVX
+template <typename T>
+using Vector256Lanes = AvxLanes<T>;
+#else
+template <typename T>
+using Vector256Lanes = PortableLanes<T>;
+#endif
+
+/// <summary>
+/// AVX2 backend that builds dispatching at run time compile beside Vector256Lanes. Nothing inlines it: Vector256Registers
+/// enters it only through AvxLanes' block kernels once CpuFeatures::HasAvx2 has returned true.
+/// </summary>
+#if HE_CPP_SIMD_AVX2_DISPATCH
+template <typename T>
+using Vector256DispatchLanes = AvxLanes<T>;
+#else
+template <typename T>
+using Vector256DispatchLanes = PortableLanes<T>;
+#endif
+
+/// <summary>
+/// Register backend behind Vector512. Builds that dispatch at run time compile it too, but may enter it only through
+/// Avx512Lanes' block kernels once CpuFeatures::HasAvx512 has returned true; see Vector512Registers.
+/// </summary>
+#if HE_CPP_SIMD_AVX512 || HE_CPP_SIMD_AVX512_DISPATCH
+template <typename T>
+using Vector512Lanes = Avx512Lanes<T>;
+#else
+template <typename T>
+using Vector512Lanes = PortableLanes<T>;
+#endif
+
+/// <summary>
+/// Runs <typeparamref name="Kernel"/> on one register pair of <typeparamref name="Lanes"/>.
+/// </summary>
+template <VectorLaneKernel Kernel, typename Lanes, typename Register>
+Register ApplyVectorLaneKernel(Lanes, Register left, Register right) {
+    if constexpr (Kernel == VectorLaneKernel::Add) {
+        return Lanes::Add(left, right);
+    } else if constexpr (Kernel == VectorLaneKernel::Subtract) {
+        return Lanes::Subtract(left, right);
+    } else if constexpr (Kernel == VectorLaneKernel::Multiply) {
+        return Lanes::Multiply(left, right);
+    } else if constexpr (Kernel == VectorLaneKernel::Divide) {
+        return Lanes::Divide(left, right);
+    } else if constexpr (Kernel == VectorLaneKernel::And) {
+        return Lanes::And(left, right);
+    } else if constexpr (Kernel == VectorLaneKernel::Or) {
+        return Lanes::Or(left, right);
+    } else if constexpr (Kernel == VectorLaneKernel::Xor) {
+        return Lanes::Xor(left, right);
+    } else if constexpr (Kernel == VectorLaneKernel::AndNot) {
+        return Lanes::AndNot(left, right);
+    } else if constexpr (Kernel == VectorLaneKernel::CompareEqual) {
+        return Lanes::CompareEqual(left, right);
+    } else if constexpr (Kernel == VectorLaneKernel::CompareGreaterThan) {
+        return Lanes::CompareGreaterThan(left, right);
+    } else if constexpr (Kernel == VectorLaneKernel::CompareLessThan) {
+        return Lanes::CompareLessThan(left, right);
+    } else if constexpr (Kernel == VectorLaneKernel::CompareLessThanOrEqual) {
+        return Lanes::CompareLessThanOrEqual(left, right);
+    } else if constexpr (Kernel == VectorLaneKernel::Min) {
+        return Lanes::Min(left, right);
+    } else {
+        return Lanes::Max(left, right);
+    }
+}
+
+/// <summary>
+/// Runs lane operations over <typeparamref name="ByteCount"/> bytes of register-aligned lanes with the widest backend
+/// that has the operation: one Vector256Lanes register per 32 bytes when it can, otherwise one Vector128Lanes register
+/// per 16 bytes. Vector512 uses the 64-byte form when it cannot use an AVX-512 register.
+/// </summary>
+template <typename T, int32_t ByteCount>
+class VectorLaneBlock {
+    static_assert(ByteCount == 16 || ByteCount == 32 || ByteCount == 64, "Vector lane blocks are 16, 32, or 64 bytes.");
+
+    static constexpr int32_t LaneCount = ByteCount / static_cast<int32_t>(sizeof(T));
+    static constexpr int32_t RegisterLaneCount = 16 / static_cast<int32_t>(sizeof(T));
+    static constexpr int32_t WideRegisterLaneCount = 32 / static_cast<int32_t>(sizeof(T));
+
+    template <VectorLaneOperation Operation>
+    static constexpr bool UsesWideRegister() {
+        return ByteCount >= 32 && Vector256Lanes<T>::Supports(Operation);
+    }
+
+public:
+    /// <summary>
+    /// Lane mask wide enough for one bit per lane of the block.
+    /// </summary>
+    using Mask = std::conditional_t<(LaneCount > 32), uint64_t, uint32_t>;
+
+    static constexpr bool Supports(VectorLaneOperation operation) {
+        return (ByteCount >= 32 && Vector256Lanes<T>::Supports(operation)) || Vector128Lanes<T>::Supports(operation);
+    }
+
+    /// <summary>
+    /// Applies <paramref name="operation"/>, called as <c>operation(lanes, value)</c> with the chosen backend and its
+    /// register, to every lane.
+    /// </summary>
+    template <VectorLaneOperation Operation, typename TOperation>
+    static void Unary(const T* value, T* result, TOperation operation) {
+        if constexpr (UsesWideRegister<Operation>()) {
+            using Lanes = Vector256Lanes<T>;
+            for (int32_t laneIndex = 0; laneIndex < LaneCount; laneIndex += WideRegisterLaneCount) {
+                Lanes::Store(result + laneIndex, operation(Lanes(), Lanes::Load(value + laneIndex)));
+            }
+        } else {
+            using Lanes = Vector128Lanes<T>;
+            for (int32_t laneIndex = 0; laneIndex < LaneCount; laneIndex += RegisterLaneCount) {
+                Lanes::Store(result + laneIndex, operation(Lanes(), Lanes::Load(value + laneIndex)));
+            }
+        }
+    }
+
+    /// <summary>
+    /// Applies <paramref name="operation"/>, called as <c>operation(lanes, left, right)</c> with the chosen backend
+    /// and its registers, to every lane pair.
+    /// </summary>
+    template <VectorLaneOperation Operation, typename TOperation>
+    static void Binary(const T* left, const T* right, T* result, TOperation operation) {
+        if constexpr (UsesWideRegister<Operation>()) {
+            using Lanes = Vector256Lanes<T>;
+            for (int32_t laneIndex = 0; laneIndex < LaneCount; laneIndex += WideRegisterLaneCount) {
+                Lanes::Store(result + laneIndex, operation(Lanes(), Lanes::Load(left + laneIndex), Lanes::Load(right + laneIndex)));
+            }
+        } else {
+            using Lanes = Vector128Lanes<T>;
+            for (int32_t laneIndex = 0; laneIndex < LaneCount; laneIndex += RegisterLaneCount) {
+                Lanes::Store(result + laneIndex, operation(Lanes(), Lanes::Load(left + laneIndex), Lanes::Load(right + laneIndex)));
+            }
+        }
+    }
+
+    /// <summary>
+    /// Applies <paramref name="operation"/>, called as <c>operation(lanes, first, second, third)</c>, to every lane
+    /// triple; used for selects whose mask arrives as a separate vector.
+    /// </summary>
+    template <VectorLaneOperation Operation, typename TOperation>
+    static void Ternary(const T* first, const T* second, const T* third, T* result, TOperation operation) {
+        if constexpr (UsesWideRegister<Operation>()) {
+            using Lanes = Vector256Lanes<T>;
+            for (int32_t laneIndex = 0; laneIndex < LaneCount; laneIndex += WideRegisterLaneCount) {
+                Lanes::Store(result + laneIndex, operation(Lanes(), Lanes::Load(first + laneIndex), Lanes::Load(second + laneIndex), Lanes::Load(third + laneIndex)));
+            }
+        } else {
+            using Lanes = Vector128Lanes<T>;
+            for (int32_t laneIndex = 0; laneIndex < LaneCount; laneIndex += RegisterLaneCount) {
+                Lanes::Store(result + laneIndex, operation(Lanes(), Lanes::Load(first + laneIndex), Lanes::Load(second + laneIndex), Lanes::Load(third + laneIndex)));
+            }
+        }
+    }
+
+    /// <summary>
+    /// Copies lanes from unaligned <paramref name="source"/> into the aligned block <paramref name="destination"/>.
+    /// </summary>
+    static void LoadUnaligned(const T* source, T* destination) {
+        if constexpr (UsesWideRegister<VectorLaneOperation::Arithmetic>()) {
+            using Lanes = Vector256Lanes<T>;
+            for (int32_t laneIndex = 0; laneIndex < LaneCount; laneIndex += WideRegisterLaneCount) {
+                Lanes::Store(destination + laneIndex, Lanes::LoadUnaligned(source + laneIndex));
+            }
+        } else {
+            using Lanes = Vector128Lanes<T>;
+            for (int32_t laneIndex = 0; laneIndex < LaneCount; laneIndex += RegisterLaneCount) {
+                Lanes::Store(destination + laneIndex, Lanes::LoadUnaligned(source + laneIndex));
+            }
+        }
+    }
+
+    /// <summary>
+    /// Copies the aligned block <paramref name="source"/> to unaligned <paramref name="destination"/>.
+    /// </summary>
+    static void StoreUnaligned(const T* source, T* destination) {
+        if constexpr (UsesWideRegister<VectorLaneOperation::Arithmetic>()) {
+            using Lanes = Vector256Lanes<T>;
+            for (int32_t laneIndex = 0; laneIndex < LaneCount; laneIndex += WideRegisterLaneCount) {
+                Lanes::StoreUnaligned(destination + laneIndex, Lanes::Load(source + laneIndex));
+            }
+        } else {
+            using Lanes = Vector128Lanes<T>;
+            for (int32_t laneIndex = 0; laneIndex < LaneCount; laneIndex += RegisterLaneCount) {
+                Lanes::StoreUnaligned(destination + laneIndex, Lanes::Load(source + laneIndex));
+            }
+        }
+    }
+
+    /// <summary>
+    /// Gathers the most significant bit of every lane in the block into the low bits of the result.
+    /// </summary>
+    static Mask MoveMask(const T* value) {
+        Mask mask = 0;
+        if constexpr (UsesWideRegister<VectorLaneOperation::Arithmetic>()) {
+            using Lanes = Vector256Lanes<T>;
+            for (int32_t laneIndex = 0; laneIndex < LaneCount; laneIndex += WideRegisterLaneCount) {
+                mask |= static_cast<Mask>(Lanes::MoveMask(Lanes::Load(value + laneIndex))) << laneIndex;
+            }
+        } else {
+            using Lanes = Vector128Lanes<T>;
+            for (int32_t laneIndex = 0; laneIndex < LaneCount; laneIndex += RegisterLaneCount) {
+                mask |= static_cast<Mask>(Lanes::MoveMask(Lanes::Load(value + laneIndex))) << laneIndex;
+            }
+        }
+
+        return mask;
+    }
+};
@@ -8,11 +8,16 @@
 #include "../vector128.hpp"
 #include "system/runtime/intrinsics/vector256.hpp"
 
+/// <summary>
+/// Managed System.Runtime.Intrinsics.X86.Avx. On AVX targets each method maps to its instruction; elsewhere the lane
+/// loops reproduce the instruction's exact lane order, including the per-128-bit-half behavior of the unpack and
+/// shuffle forms.
+/// </summary>
 class Avx {
     template <typename T>
     static T ComparisonTrueValue() {
-        if constexpr (std::is_same_v<T, float>) {
-            uint32_t bits = 0xFFFFFFFFu;
+        if constexpr (std::is_floating_point_v<T>) {
+            VectorLaneBits<T> bits = static_cast<VectorLaneBits<T>>(~VectorLaneBits<T>());
             T value;
             std::memcpy(&value, &bits, sizeof(T));
             return value;
@@ -21,11 +26,28 @@ class Avx {
         }
     }
 
+    template <typename T>
+    static constexpr int32_t LanesPerHalf() {
+        return Vector256<T>::LaneCount / 2;
+    }
+
 public:
+    /// <summary>
+    /// A constant on builds that target AVX; on builds that dispatch at run time, the cached cpuid answer.
+    /// </summary>
     static bool get_IsSupported() {
+#if HE_CPP_SIMD_AVX
+        return true;
+#elif HE_CPP_SIMD_AVX2_DISPATCH
+        return CpuFeatures::HasAvx();
+#else
         return false;
+#endif
     }
 
+    /// <summary>
+    /// Loads from a 32-byte aligned source, as vmovaps requires.
+    /// </summary>
     template <typename T>
     static Vector256<T> LoadAlignedVector256(const T* source) {
         Vector256<T> result;
@@ -33,6 +55,12 @@ public:
             return result;
         }
 
+        if constexpr (Vector256Lanes<T>::Supports(VectorLaneOperation::Arithmetic)) {
+            using Lanes = Vector256Lanes<T>;
+            Lanes::Store(result.Values, Lanes::Load(source));
+            return result;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector256<T>::LaneCount; ++laneIndex) {
             result.Values[laneIndex] = source[laneIndex];
         }
@@ -42,32 +70,86 @@ public:
 
     template <typename T>
     static Vector256<T> LoadVector256(const T* source) {
-        return LoadAlignedVector256(source);
+        return Vector256Runtime::Load(source);
     }
 
+    /// <summary>
+    /// Interleaves the low lanes of each 128-bit half: for floats, <c>[l0, r0, l1, r1 | l4, r4, l5, r5]</c>.
+    /// </summary>
     template <typename T>
     static Vector256<T> UnpackLow(const Vector256<T>& left, const Vector256<T>& right) {
-        return left;
+        return Unpack(left, right, 0);
     }
 
+    /// <summary>
+    /// Interleaves the high lanes of each 128-bit half: for floats, <c>[l2, r2, l3, r3 | l6, r6, l7, r7]</c>.
+    /// </summary>
     template <typename T>
     static Vector256<T> UnpackHigh(const Vector256<T>& left, const Vector256<T>& right) {
-        return right;
+        return Unpack(left, right, LanesPerHalf<T>() / 2);
     }
 
+    /// <summary>
+    /// Selects lanes within each 128-bit half by the 2-bit (float) or 1-bit (double) fields of
+    /// <paramref name="control"/>, taking the lower result lanes of each half from <paramref name="left"/> and the upper
+    /// ones from <paramref name="right"/>. vshufps encodes the control as an immediate, which a runtime argument cannot
+    /// supply, so this is a lane loop that folds into the instruction once inlined with the managed call site's
+    /// constant.
+    /// </summary>
     template <typename T>
     static Vector256<T> Shuffle(const Vector256<T>& left, const Vector256<T>& right, int32_t control) {
-        return (control & 1) == 0 ? left : right;
+        static_assert(sizeof(T) == 4 || sizeof(T) == 8, "Avx.Shuffle takes float or double lanes.");
+        Vector256<T> result;
+        constexpr int32_t HalfLaneCount = LanesPerHalf<T>();
+        for (int32_t half = 0; half < 2; ++half) {
+            const int32_t offset = half * HalfLaneCount;
+            for (int32_t laneIndex = 0; laneIndex < HalfLaneCount; ++laneIndex) {
+                const Vector256<T>& source = laneIndex < HalfLaneCount / 2 ? left : right;
+                int32_t selector;
+                if constexpr (sizeof(T) == 4) {
+                    selector = (control >> (laneIndex * 2)) & 3;
+                } else {
+                    selector = (control >> (half * 2 + laneIndex)) & 1;
+                }
+
+                result.Values[offset + laneIndex] = source.Values[offset + selector];
+            }
+        }
+
+        return result;
     }
 
+    /// <summary>
+    /// Builds each 128-bit half of the result from one half of either operand, chosen by bits 0-1 (low half) and 4-5
+    /// (high half) of <paramref name="control"/>; bits 3 and 7 zero the corresponding half instead.
+    /// </summary>
     template <typename T>
     static Vector256<T> Permute2x128(const Vector256<T>& left, const Vector256<T>& right, int32_t control) {
-        return (control & 1) == 0 ? left : right;
+        Vector256<T> result;
+        constexpr int32_t HalfLaneCount = LanesPerHalf<T>();
+        for (int32_t half = 0; half < 2; ++half) {
+            const int32_t field = (control >> (half * 4)) & 0xF;
+            if ((field & 8) != 0) {
+                continue;
+            }
+
+            const Vector256<T>& source = (field & 2) == 0 ? left : right;
+            const int32_t sourceOffset = (field & 1) * HalfLaneCount;
+            for (int32_t laneIndex = 0; laneIndex < HalfLaneCount; ++laneIndex) {
+                result.Values[half * HalfLaneCount + laneIndex] = source.Values[sourceOffset + laneIndex];
+            }
+        }
+
+        return result;
     }
 
     template <typename T>
-    static Vector256<T> CompareEqual(const Vector256<T>& left, const Vector256<T>& right) {
+    HE_CPP_SIMD_ALWAYS_INLINE static Vector256<T> CompareEqual(const Vector256<T>& left, const Vector256<T>& right) {
         Vector256<T> result;
+        if (Vector256Registers<T>::template TryBinary<VectorLaneKernel::CompareEqual>(left, right, result)) {
+            return result;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector256<T>::LaneCount; ++laneIndex) {
             result.Values[laneIndex] = left.Values[laneIndex] == right.Values[laneIndex] ? ComparisonTrueValue<T>() : T();
         }
@@ -75,8 +157,12 @@ public:
     }
 
     template <typename T>
-    static Vector256<T> CompareGreaterThan(const Vector256<T>& left, const Vector256<T>& right) {
+    HE_CPP_SIMD_ALWAYS_INLINE static Vector256<T> CompareGreaterThan(const Vector256<T>& left, const Vector256<T>& right) {
         Vector256<T> result;
+        if (Vector256Registers<T>::template TryBinary<VectorLaneKernel::CompareGreaterThan>(left, right, result)) {
+            return result;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector256<T>::LaneCount; ++laneIndex) {
             result.Values[laneIndex] = left.Values[laneIndex] > right.Values[laneIndex] ? ComparisonTrueValue<T>() : T();
         }
@@ -84,17 +170,31 @@ public:
     }
 
     template <typename T>
-    static Vector256<T> CompareLessThanOrEqual(const Vector256<T>& left, const Vector256<T>& right) {
+    HE_CPP_SIMD_ALWAYS_INLINE static Vector256<T> CompareLessThanOrEqual(const Vector256<T>& left, const Vector256<T>& right) {
         Vector256<T> result;
+        if (Vector256Registers<T>::template TryBinary<VectorLaneKernel::CompareLessThanOrEqual>(left, right, result)) {
+            return result;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector256<T>::LaneCount; ++laneIndex) {
             result.Values[laneIndex] = left.Values[laneIndex] <= right.Values[laneIndex] ? ComparisonTrueValue<T>() : T();
         }
         return result;
     }
 
+    /// <summary>
+    /// Approximates 1/x with vrcpps (about 12 bits, as in the managed runtime) on AVX targets.
+    /// </summary>
     template <typename T>
     static Vector256<T> Reciprocal(const Vector256<T>& value) {
         Vector256<T> result;
+#if HE_CPP_SIMD_AVX
+        if constexpr (std::is_same_v<T, float>) {
+            _mm256_store_ps(result.Values, _mm256_rcp_ps(_mm256_load_ps(value.Values)));
+            return result;
+        }
+#endif
+
         for (int32_t laneIndex = 0; laneIndex < Vector256<T>::LaneCount; ++laneIndex) {
             result.Values[laneIndex] = static_cast<T>(1) / value.Values[laneIndex];
         }
@@ -102,9 +202,19 @@ public:
         return result;
     }
 
+    /// <summary>
+    /// Approximates 1/sqrt(x) with vrsqrtps on AVX targets.
+    /// </summary>
     template <typename T>
     static Vector256<T> ReciprocalSqrt(const Vector256<T>& value) {
         Vector256<T> result;
+#if HE_CPP_SIMD_AVX
+        if constexpr (std::is_same_v<T, float>) {
+            _mm256_store_ps(result.Values, _mm256_rsqrt_ps(_mm256_load_ps(value.Values)));
+            return result;
+        }
+#endif
+
         for (int32_t laneIndex = 0; laneIndex < Vector256<T>::LaneCount; ++laneIndex) {
             result.Values[laneIndex] = static_cast<T>(1) / static_cast<T>(std::sqrt(value.Values[laneIndex]));
         }
@@ -112,43 +222,73 @@ public:
         return result;
     }
 
+    /// <summary>
+    /// Gathers each lane's sign bit, as vmovmskps does.
+    /// </summary>
     template <typename T>
     static int32_t MoveMask(const Vector256<T>& value) {
-        int32_t mask = 0;
-        for (int32_t laneIndex = 0; laneIndex < Vector256<T>::LaneCount; ++laneIndex) {
-            if (value.Values[laneIndex] != T()) {
-                mask |= 1 << laneIndex;
-            }
-        }
-
-        return mask;
+        return static_cast<int32_t>(Vector256Runtime::ExtractMostSignificantBits(value));
     }
 
+    /// <summary>
+    /// Stores to a 32-byte aligned destination, as vmovaps requires.
+    /// </summary>
     template <typename T>
     static void StoreAligned(T* target, const Vector256<T>& value) {
         if (target == nullptr) {
             return;
         }
 
+        if constexpr (Vector256Lanes<T>::Supports(VectorLaneOperation::Arithmetic)) {
+            using Lanes = Vector256Lanes<T>;
+            Lanes::Store(target, Lanes::Load(value.Values));
+            return;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector256<T>::LaneCount; ++laneIndex) {
             target[laneIndex] = value.Values[laneIndex];
         }
     }
 
+    /// <summary>
+    /// Picks each result lane from <paramref name="value"/> by the low bits of the matching index lane, as vpermilps
+    /// does: bits 0-1 for float lanes and bit 1 for double lanes.
+    /// </summary>
     template <typename TIndex, typename TValue>
     static Vector128_1<TValue> PermuteVar(const Vector128_1<TValue>& value, const Vector128_1<TIndex>& indices) {
         Vector128_1<TValue> result;
+#if HE_CPP_SIMD_AVX
+        if constexpr (std::is_same_v<TValue, float> && sizeof(TIndex) == 4) {
+            _mm_store_ps(result.Values, _mm_permutevar_ps(_mm_load_ps(value.Values), _mm_load_si128(reinterpret_cast<const __m128i*>(indices.Values))));
+            return result;
+        } else if constexpr (std::is_same_v<TValue, double> && sizeof(TIndex) == 8) {
+            _mm_store_pd(result.Values, _mm_permutevar_pd(_mm_load_pd(value.Values), _mm_load_si128(reinterpret_cast<const __m128i*>(indices.Values))));
+            return result;
+        }
+#endif
+
         for (int32_t laneIndex = 0; laneIndex < Vector128_1<TValue>::LaneCount; ++laneIndex) {
-            int32_t index = static_cast<int32_t>(indices.Values[laneIndex]);
-            if (index < 0) {
-                index = 0;
-            }
+            const int64_t index = static_cast<int64_t>(indices.Values[laneIndex]);
+            const int32_t selector = sizeof(TValue) == 8
+                ? static_cast<int32_t>((index >> 1) & 1)
+                : static_cast<int32_t>(index & (Vector128_1<TValue>::LaneCount - 1));
+            result.Values[laneIndex] = value.Values[selector];
+        }
 
-            if (Vector128_1<TValue>::LaneCount > 0) {
-                index %= Vector128_1<TValue>::LaneCount;
-            }
+        return result;
+    }
 
-            result.Values[laneIndex] = value.Values[index];
+private:
+    template <typename T>
+    static Vector256<T> Unpack(const Vector256<T>& left, const Vector256<T>& right, int32_t sourceOffset) {
+        Vector256<T> result;
+        constexpr int32_t HalfLaneCount = LanesPerHalf<T>();
+        for (int32_t half = 0; half < 2; ++half) {
+            const int32_t offset = half * HalfLaneCount;
+            for (int32_t pairIndex = 0; pairIndex < HalfLaneCount / 2; ++pairIndex) {
+                result.Values[offset + pairIndex * 2] = left.Values[offset + sourceOffset + pairIndex];
+                result.Values[offset + pairIndex * 2 + 1] = right.Values[offset + sourceOffset + pairIndex];
+            }
         }
 
         return result;
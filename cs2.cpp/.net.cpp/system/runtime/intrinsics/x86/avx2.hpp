@@ -1,20 +1,54 @@
 #pragma once
 
+#include <type_traits>
+
 #include "../vector128.hpp"
+#include "system/runtime/intrinsics/cpu_features.hpp"
 
+/// <summary>
+/// Managed System.Runtime.Intrinsics.X86.Avx2.
+/// </summary>
 class Avx2 {
 public:
+    /// <summary>
+    /// A constant on builds that target AVX2; on builds that dispatch at run time, the cached cpuid answer.
+    /// </summary>
     static bool get_IsSupported() {
+#if HE_CPP_SIMD_AVX2
+        return true;
+#elif HE_CPP_SIMD_AVX2_DISPATCH
+        return CpuFeatures::HasAvx2();
+#else
         return false;
+#endif
     }
 
+    /// <summary>
+    /// Shifts each lane right by its own count, shifting in zeros; counts at or above the lane width clear the lane,
+    /// matching vpsrlvd and vpsrlvq.
+    /// </summary>
     template <typename TValue, typename TShift>
     static Vector128_1<TValue> ShiftRightLogicalVariable(const Vector128_1<TValue>& value, const Vector128_1<TShift>& shift) {
+        static_assert(sizeof(TValue) == sizeof(TShift), "Variable shifts pair each lane with a count of the same width.");
         Vector128_1<TValue> result;
+#if HE_CPP_SIMD_AVX2
+        if constexpr (std::is_integral_v<TValue> && sizeof(TValue) == 4) {
+            const __m128i shifted = _mm_srlv_epi32(_mm_load_si128(reinterpret_cast<const __m128i*>(value.Values)), _mm_load_si128(reinterpret_cast<const __m128i*>(shift.Values)));
+            _mm_store_si128(reinterpret_cast<__m128i*>(result.Values), shifted);
+            return result;
+        } else if constexpr (std::is_integral_v<TValue> && sizeof(TValue) == 8) {
+            const __m128i shifted = _mm_srlv_epi64(_mm_load_si128(reinterpret_cast<const __m128i*>(value.Values)), _mm_load_si128(reinterpret_cast<const __m128i*>(shift.Values)));
+            _mm_store_si128(reinterpret_cast<__m128i*>(result.Values), shifted);
+            return result;
+        }
+#endif
+
+        using TBits = std::make_unsigned_t<TValue>;
+        using TCount = std::make_unsigned_t<TShift>;
         for (int32_t laneIndex = 0; laneIndex < Vector128_1<TValue>::LaneCount; ++laneIndex) {
-            uint32_t laneValue = static_cast<uint32_t>(value.Values[laneIndex]);
-            uint32_t shiftCount = static_cast<uint32_t>(shift.Values[laneIndex]) & 31u;
-            result.Values[laneIndex] = static_cast<TValue>(laneValue >> shiftCount);
+            TBits laneValue = static_cast<TBits>(value.Values[laneIndex]);
+            TCount shiftCount = static_cast<TCount>(shift.Values[laneIndex]);
+            result.Values[laneIndex] = shiftCount >= sizeof(TBits) * 8 ? TValue() : static_cast<TValue>(laneValue >> shiftCount);
         }
 
         return result;
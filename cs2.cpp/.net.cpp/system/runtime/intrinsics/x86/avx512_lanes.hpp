@@ -0,0 +1,447 @@
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+#include "system/runtime/intrinsics/simd_config.hpp"
+#include "system/runtime/intrinsics/vector_lane_operation.hpp"
+
+#if HE_CPP_SIMD_AVX512 || HE_CPP_SIMD_AVX512_DISPATCH
+#include <immintrin.h>
+
+/// <summary>
+/// AVX-512 register type holding lanes of <typeparamref name="T"/>.
+/// </summary>
+template <typename T>
+struct Avx512Register {
+    using Type = __m512i;
+};
+
+template <>
+struct Avx512Register<float> {
+    using Type = __m512;
+};
+
+template <>
+struct Avx512Register<double> {
+    using Type = __m512d;
+};
+
+#if defined(__GNUC__) && !defined(__clang__)
+// GCC 12.1 and 12.2 report their own _mm512_undefined_* placeholders inside vpandn, vpmin, and vpmax as
+// uninitialized once these functions inline (GCC bug 105593).
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#endif
+
+/// <summary>
+/// AVX-512 lowering of the 512-bit lane operations for one lane type. Comparisons produce opmask values, one bit per
+/// lane, which the block kernels hand back directly for mask reductions and widen to all-bits lanes only when the
+/// managed API returns a vector. Every function carries HE_CPP_AVX512_TARGET so that builds dispatching at run time
+/// compile these for AVX-512 while the rest of the binary keeps the baseline instruction set; such builds must reach
+/// them only through the block kernels at the bottom, after CpuFeatures::HasAvx512 has returned true.
+/// </summary>
+template <typename T>
+struct Avx512Lanes {
+    static constexpr bool IsSingle = std::is_same_v<T, float>;
+    static constexpr bool IsDouble = std::is_same_v<T, double>;
+    static constexpr bool IsInteger = std::is_integral_v<T> && !std::is_same_v<T, bool> &&
+        (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+    static constexpr bool Enabled = IsSingle || IsDouble || IsInteger;
+
+    using Register = typename Avx512Register<T>::Type;
+
+    static constexpr bool Supports(VectorLaneOperation operation) {
+        switch (operation) {
+        case VectorLaneOperation::Arithmetic:
+        case VectorLaneOperation::CompareEqual:
+        case VectorLaneOperation::CompareOrder:
+            return Enabled;
+        case VectorLaneOperation::Multiply:
+            return IsSingle || IsDouble || (IsInteger && sizeof(T) >= 2);
+        case VectorLaneOperation::Divide:
+            return IsSingle || IsDouble;
+        }
+
+        return false;
+    }
+
+    HE_CPP_AVX512_TARGET static Register Load(const T* source) {
+        if constexpr (IsSingle) {
+            return _mm512_load_ps(source);
+        } else if constexpr (IsDouble) {
+            return _mm512_load_pd(source);
+        } else {
+            return _mm512_load_si512(source);
+        }
+    }
+
+    HE_CPP_AVX512_TARGET static void Store(T* destination, Register value) {
+        if constexpr (IsSingle) {
+            _mm512_store_ps(destination, value);
+        } else if constexpr (IsDouble) {
+            _mm512_store_pd(destination, value);
+        } else {
+            _mm512_store_si512(destination, value);
+        }
+    }
+
+    HE_CPP_AVX512_TARGET static Register Add(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm512_add_ps(left, right);
+        } else if constexpr (IsDouble) {
+            return _mm512_add_pd(left, right);
+        } else if constexpr (sizeof(T) == 1) {
+            return _mm512_add_epi8(left, right);
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm512_add_epi16(left, right);
+        } else if constexpr (sizeof(T) == 4) {
+            return _mm512_add_epi32(left, right);
+        } else {
+            return _mm512_add_epi64(left, right);
+        }
+    }
+
+    HE_CPP_AVX512_TARGET static Register Subtract(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm512_sub_ps(left, right);
+        } else if constexpr (IsDouble) {
+            return _mm512_sub_pd(left, right);
+        } else if constexpr (sizeof(T) == 1) {
+            return _mm512_sub_epi8(left, right);
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm512_sub_epi16(left, right);
+        } else if constexpr (sizeof(T) == 4) {
+            return _mm512_sub_epi32(left, right);
+        } else {
+            return _mm512_sub_epi64(left, right);
+        }
+    }
+
+    HE_CPP_AVX512_TARGET static Register Multiply(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm512_mul_ps(left, right);
+        } else if constexpr (IsDouble) {
+            return _mm512_mul_pd(left, right);
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm512_mullo_epi16(left, right);
+        } else if constexpr (sizeof(T) == 4) {
+            return _mm512_mullo_epi32(left, right);
+        } else {
+            return _mm512_mullo_epi64(left, right);
+        }
+    }
+
+    HE_CPP_AVX512_TARGET static Register Divide(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm512_div_ps(left, right);
+        } else {
+            return _mm512_div_pd(left, right);
+        }
+    }
+
+    HE_CPP_AVX512_TARGET static Register And(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm512_and_ps(left, right);
+        } else if constexpr (IsDouble) {
+            return _mm512_and_pd(left, right);
+        } else {
+            return _mm512_and_si512(left, right);
+        }
+    }
+
+    HE_CPP_AVX512_TARGET static Register Or(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm512_or_ps(left, right);
+        } else if constexpr (IsDouble) {
+            return _mm512_or_pd(left, right);
+        } else {
+            return _mm512_or_si512(left, right);
+        }
+    }
+
+    HE_CPP_AVX512_TARGET static Register Xor(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm512_xor_ps(left, right);
+        } else if constexpr (IsDouble) {
+            return _mm512_xor_pd(left, right);
+        } else {
+            return _mm512_xor_si512(left, right);
+        }
+    }
+
+    /// <summary>
+    /// Computes <c>left &amp; ~right</c>, the managed AndNot operand order.
+    /// </summary>
+    HE_CPP_AVX512_TARGET static Register AndNot(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm512_andnot_ps(right, left);
+        } else if constexpr (IsDouble) {
+            return _mm512_andnot_pd(right, left);
+        } else {
+            return _mm512_andnot_si512(right, left);
+        }
+    }
+
+    /// <summary>
+    /// Takes each bit from <paramref name="left"/> where <paramref name="mask"/> is set and from
+    /// <paramref name="right"/> elsewhere, as one vpternlog.
+    /// </summary>
+    HE_CPP_AVX512_TARGET static Register Select(Register mask, Register left, Register right) {
+        constexpr int BitwiseSelect = 0xCA;
+        if constexpr (IsSingle) {
+            return _mm512_castsi512_ps(_mm512_ternarylogic_epi32(_mm512_castps_si512(mask), _mm512_castps_si512(left), _mm512_castps_si512(right), BitwiseSelect));
+        } else if constexpr (IsDouble) {
+            return _mm512_castsi512_pd(_mm512_ternarylogic_epi64(_mm512_castpd_si512(mask), _mm512_castpd_si512(left), _mm512_castpd_si512(right), BitwiseSelect));
+        } else {
+            return _mm512_ternarylogic_epi64(mask, left, right, BitwiseSelect);
+        }
+    }
+
+    HE_CPP_AVX512_TARGET static uint64_t CompareEqualMask(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm512_cmp_ps_mask(left, right, _CMP_EQ_OQ);
+        } else if constexpr (IsDouble) {
+            return _mm512_cmp_pd_mask(left, right, _CMP_EQ_OQ);
+        } else if constexpr (sizeof(T) == 1) {
+            return _mm512_cmpeq_epi8_mask(left, right);
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm512_cmpeq_epi16_mask(left, right);
+        } else if constexpr (sizeof(T) == 4) {
+            return _mm512_cmpeq_epi32_mask(left, right);
+        } else {
+            return _mm512_cmpeq_epi64_mask(left, right);
+        }
+    }
+
+    HE_CPP_AVX512_TARGET static uint64_t CompareGreaterThanMask(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm512_cmp_ps_mask(left, right, _CMP_GT_OQ);
+        } else if constexpr (IsDouble) {
+            return _mm512_cmp_pd_mask(left, right, _CMP_GT_OQ);
+        } else if constexpr (std::is_signed_v<T>) {
+            if constexpr (sizeof(T) == 1) {
+                return _mm512_cmpgt_epi8_mask(left, right);
+            } else if constexpr (sizeof(T) == 2) {
+                return _mm512_cmpgt_epi16_mask(left, right);
+            } else if constexpr (sizeof(T) == 4) {
+                return _mm512_cmpgt_epi32_mask(left, right);
+            } else {
+                return _mm512_cmpgt_epi64_mask(left, right);
+            }
+        } else if constexpr (sizeof(T) == 1) {
+            return _mm512_cmpgt_epu8_mask(left, right);
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm512_cmpgt_epu16_mask(left, right);
+        } else if constexpr (sizeof(T) == 4) {
+            return _mm512_cmpgt_epu32_mask(left, right);
+        } else {
+            return _mm512_cmpgt_epu64_mask(left, right);
+        }
+    }
+
+    HE_CPP_AVX512_TARGET static uint64_t CompareLessThanMask(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm512_cmp_ps_mask(left, right, _CMP_LT_OQ);
+        } else if constexpr (IsDouble) {
+            return _mm512_cmp_pd_mask(left, right, _CMP_LT_OQ);
+        } else {
+            return CompareGreaterThanMask(right, left);
+        }
+    }
+
+    HE_CPP_AVX512_TARGET static uint64_t CompareLessThanOrEqualMask(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm512_cmp_ps_mask(left, right, _CMP_LE_OQ);
+        } else if constexpr (IsDouble) {
+            return _mm512_cmp_pd_mask(left, right, _CMP_LE_OQ);
+        } else if constexpr (std::is_signed_v<T>) {
+            if constexpr (sizeof(T) == 1) {
+                return _mm512_cmple_epi8_mask(left, right);
+            } else if constexpr (sizeof(T) == 2) {
+                return _mm512_cmple_epi16_mask(left, right);
+            } else if constexpr (sizeof(T) == 4) {
+                return _mm512_cmple_epi32_mask(left, right);
+            } else {
+                return _mm512_cmple_epi64_mask(left, right);
+            }
+        } else if constexpr (sizeof(T) == 1) {
+            return _mm512_cmple_epu8_mask(left, right);
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm512_cmple_epu16_mask(left, right);
+        } else if constexpr (sizeof(T) == 4) {
+            return _mm512_cmple_epu32_mask(left, right);
+        } else {
+            return _mm512_cmple_epu64_mask(left, right);
+        }
+    }
+
+    /// <summary>
+    /// Widens an opmask to all-bits-set lanes where its bits are set and zero lanes elsewhere.
+    /// </summary>
+    HE_CPP_AVX512_TARGET static Register ExpandMask(uint64_t mask) {
+        if constexpr (sizeof(T) == 1) {
+            return _mm512_movm_epi8(static_cast<__mmask64>(mask));
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm512_movm_epi16(static_cast<__mmask32>(mask));
+        } else if constexpr (IsSingle) {
+            return _mm512_castsi512_ps(_mm512_movm_epi32(static_cast<__mmask16>(mask)));
+        } else if constexpr (sizeof(T) == 4) {
+            return _mm512_movm_epi32(static_cast<__mmask16>(mask));
+        } else if constexpr (IsDouble) {
+            return _mm512_castsi512_pd(_mm512_movm_epi64(static_cast<__mmask8>(mask)));
+        } else {
+            return _mm512_movm_epi64(static_cast<__mmask8>(mask));
+        }
+    }
+
+    /// <summary>
+    /// Matches std::min(left, right): <paramref name="left"/> wins ties and unordered lanes.
+    /// </summary>
+    HE_CPP_AVX512_TARGET static Register Min(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm512_min_ps(right, left);
+        } else if constexpr (IsDouble) {
+            return _mm512_min_pd(right, left);
+        } else if constexpr (std::is_signed_v<T>) {
+            if constexpr (sizeof(T) == 1) {
+                return _mm512_min_epi8(left, right);
+            } else if constexpr (sizeof(T) == 2) {
+                return _mm512_min_epi16(left, right);
+            } else if constexpr (sizeof(T) == 4) {
+                return _mm512_min_epi32(left, right);
+            } else {
+                return _mm512_min_epi64(left, right);
+            }
+        } else if constexpr (sizeof(T) == 1) {
+            return _mm512_min_epu8(left, right);
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm512_min_epu16(left, right);
+        } else if constexpr (sizeof(T) == 4) {
+            return _mm512_min_epu32(left, right);
+        } else {
+            return _mm512_min_epu64(left, right);
+        }
+    }
+
+    /// <summary>
+    /// Matches std::max(left, right): <paramref name="left"/> wins ties and unordered lanes.
+    /// </summary>
+    HE_CPP_AVX512_TARGET static Register Max(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm512_max_ps(right, left);
+        } else if constexpr (IsDouble) {
+            return _mm512_max_pd(right, left);
+        } else if constexpr (std::is_signed_v<T>) {
+            if constexpr (sizeof(T) == 1) {
+                return _mm512_max_epi8(left, right);
+            } else if constexpr (sizeof(T) == 2) {
+                return _mm512_max_epi16(left, right);
+            } else if constexpr (sizeof(T) == 4) {
+                return _mm512_max_epi32(left, right);
+            } else {
+                return _mm512_max_epi64(left, right);
+            }
+        } else if constexpr (sizeof(T) == 1) {
+            return _mm512_max_epu8(left, right);
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm512_max_epu16(left, right);
+        } else if constexpr (sizeof(T) == 4) {
+            return _mm512_max_epu32(left, right);
+        } else {
+            return _mm512_max_epu64(left, right);
+        }
+    }
+
+    /// <summary>
+    /// Gathers the most significant bit of every lane into the low bits of the result with one vpmov*2m.
+    /// </summary>
+    HE_CPP_AVX512_TARGET static uint64_t MoveMask(Register value) {
+        if constexpr (IsSingle) {
+            return _mm512_movepi32_mask(_mm512_castps_si512(value));
+        } else if constexpr (IsDouble) {
+            return _mm512_movepi64_mask(_mm512_castpd_si512(value));
+        } else if constexpr (sizeof(T) == 1) {
+            return _mm512_movepi8_mask(value);
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm512_movepi16_mask(value);
+        } else if constexpr (sizeof(T) == 4) {
+            return _mm512_movepi32_mask(value);
+        } else {
+            return _mm512_movepi64_mask(value);
+        }
+    }
+
+    /// <summary>
+    /// Runs <typeparamref name="Kernel"/> on one register pair. Mirrors ApplyVectorLaneKernel, which cannot be called
+    /// from here because it is not compiled for AVX-512 on dispatching builds.
+    /// </summary>
+    template <VectorLaneKernel Kernel>
+    HE_CPP_AVX512_TARGET static Register Apply(Register left, Register right) {
+        if constexpr (Kernel == VectorLaneKernel::Add) {
+            return Add(left, right);
+        } else if constexpr (Kernel == VectorLaneKernel::Subtract) {
+            return Subtract(left, right);
+        } else if constexpr (Kernel == VectorLaneKernel::Multiply) {
+            return Multiply(left, right);
+        } else if constexpr (Kernel == VectorLaneKernel::Divide) {
+            return Divide(left, right);
+        } else if constexpr (Kernel == VectorLaneKernel::And) {
+            return And(left, right);
+        } else if constexpr (Kernel == VectorLaneKernel::Or) {
+            return Or(left, right);
+        } else if constexpr (Kernel == VectorLaneKernel::Xor) {
+            return Xor(left, right);
+        } else if constexpr (Kernel == VectorLaneKernel::AndNot) {
+            return AndNot(left, right);
+        } else if constexpr (Kernel == VectorLaneKernel::Min) {
+            return Min(left, right);
+        } else if constexpr (Kernel == VectorLaneKernel::Max) {
+            return Max(left, right);
+        } else {
+            return ExpandMask(CompareMask<Kernel>(left, right));
+        }
+    }
+
+    template <VectorLaneKernel Kernel>
+    HE_CPP_AVX512_TARGET static uint64_t CompareMask(Register left, Register right) {
+        if constexpr (Kernel == VectorLaneKernel::CompareEqual) {
+            return CompareEqualMask(left, right);
+        } else if constexpr (Kernel == VectorLaneKernel::CompareGreaterThan) {
+            return CompareGreaterThanMask(left, right);
+        } else if constexpr (Kernel == VectorLaneKernel::CompareLessThan) {
+            return CompareLessThanMask(left, right);
+        } else {
+            static_assert(Kernel == VectorLaneKernel::CompareLessThanOrEqual, "Only comparison kernels produce lane masks.");
+            return CompareLessThanOrEqualMask(left, right);
+        }
+    }
+
+    /// <summary>
+    /// Applies <typeparamref name="Kernel"/> to one 64-byte aligned block of lanes.
+    /// </summary>
+    template <VectorLaneKernel Kernel>
+    HE_CPP_AVX512_TARGET static void BinaryBlock(const T* left, const T* right, T* result) {
+        Store(result, Apply<Kernel>(Load(left), Load(right)));
+    }
+
+    /// <summary>
+    /// Compares one 64-byte aligned block of lanes and returns the opmask, one bit per lane.
+    /// </summary>
+    template <VectorLaneKernel Kernel>
+    HE_CPP_AVX512_TARGET static uint64_t CompareMaskBlock(const T* left, const T* right) {
+        return CompareMask<Kernel>(Load(left), Load(right));
+    }
+
+    HE_CPP_AVX512_TARGET static void SelectBlock(const T* mask, const T* left, const T* right, T* result) {
+        Store(result, Select(Load(mask), Load(left), Load(right)));
+    }
+
+    HE_CPP_AVX512_TARGET static uint64_t MoveMaskBlock(const T* value) {
+        return MoveMask(Load(value));
+    }
+};
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#endif
@@ -0,0 +1,430 @@
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+#include "system/runtime/intrinsics/simd_config.hpp"
+#include "system/runtime/intrinsics/vector_lane_operation.hpp"
+
+#if HE_CPP_SIMD_AVX || HE_CPP_SIMD_AVX2_DISPATCH
+#include <immintrin.h>
+
+/// <summary>
+/// AVX register type holding lanes of <typeparamref name="T"/>.
+/// </summary>
+template <typename T>
+struct AvxRegister {
+    using Type = __m256i;
+};
+
+template <>
+struct AvxRegister<float> {
+    using Type = __m256;
+};
+
+template <>
+struct AvxRegister<double> {
+    using Type = __m256d;
+};
+
+/// <summary>
+/// AVX lowering of the 256-bit lane operations for one lane type. Floating-point lanes need AVX; integer lanes need
+/// AVX2, and without it report unsupported so Vector256 runs SSE on each half instead. Builds that dispatch at run
+/// time compile every function for AVX2 through HE_CPP_AVX2_TARGET and must reach them only through the block kernels
+/// at the bottom, after CpuFeatures::HasAvx2 has returned true.
+/// </summary>
+template <typename T>
+struct AvxLanes {
+    static constexpr bool IsSingle = std::is_same_v<T, float>;
+    static constexpr bool IsDouble = std::is_same_v<T, double>;
+    static constexpr bool IsInteger = (HE_CPP_SIMD_AVX2 || HE_CPP_SIMD_AVX2_DISPATCH) && std::is_integral_v<T> && !std::is_same_v<T, bool> &&
+        (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+    static constexpr bool Enabled = IsSingle || IsDouble || IsInteger;
+
+    using Register = typename AvxRegister<T>::Type;
+
+    static constexpr bool Supports(VectorLaneOperation operation) {
+        switch (operation) {
+        case VectorLaneOperation::Arithmetic:
+        case VectorLaneOperation::CompareEqual:
+        case VectorLaneOperation::CompareOrder:
+            return Enabled;
+        case VectorLaneOperation::Multiply:
+            return IsSingle || IsDouble || (IsInteger && (sizeof(T) == 2 || sizeof(T) == 4));
+        case VectorLaneOperation::Divide:
+            return IsSingle || IsDouble;
+        }
+
+        return false;
+    }
+
+    HE_CPP_AVX2_TARGET static Register Load(const T* source) {
+        if constexpr (IsSingle) {
+            return _mm256_load_ps(source);
+        } else if constexpr (IsDouble) {
+            return _mm256_load_pd(source);
+        } else {
+            return _mm256_load_si256(reinterpret_cast<const __m256i*>(source));
+        }
+    }
+
+    HE_CPP_AVX2_TARGET static Register LoadUnaligned(const T* source) {
+        if constexpr (IsSingle) {
+            return _mm256_loadu_ps(source);
+        } else if constexpr (IsDouble) {
+            return _mm256_loadu_pd(source);
+        } else {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source));
+        }
+    }
+
+    HE_CPP_AVX2_TARGET static void Store(T* destination, Register value) {
+        if constexpr (IsSingle) {
+            _mm256_store_ps(destination, value);
+        } else if constexpr (IsDouble) {
+            _mm256_store_pd(destination, value);
+        } else {
+            _mm256_store_si256(reinterpret_cast<__m256i*>(destination), value);
+        }
+    }
+
+    HE_CPP_AVX2_TARGET static void StoreUnaligned(T* destination, Register value) {
+        if constexpr (IsSingle) {
+            _mm256_storeu_ps(destination, value);
+        } else if constexpr (IsDouble) {
+            _mm256_storeu_pd(destination, value);
+        } else {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination), value);
+        }
+    }
+
+    HE_CPP_AVX2_TARGET static Register Zero() {
+        if constexpr (IsSingle) {
+            return _mm256_setzero_ps();
+        } else if constexpr (IsDouble) {
+            return _mm256_setzero_pd();
+        } else {
+            return _mm256_setzero_si256();
+        }
+    }
+
+    HE_CPP_AVX2_TARGET static Register AllBitsSet() {
+        const __m256i ones = _mm256_set1_epi32(-1);
+        if constexpr (IsSingle) {
+            return _mm256_castsi256_ps(ones);
+        } else if constexpr (IsDouble) {
+            return _mm256_castsi256_pd(ones);
+        } else {
+            return ones;
+        }
+    }
+
+    HE_CPP_AVX2_TARGET static Register Add(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm256_add_ps(left, right);
+        } else if constexpr (IsDouble) {
+            return _mm256_add_pd(left, right);
+        } else if constexpr (sizeof(T) == 1) {
+            return _mm256_add_epi8(left, right);
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm256_add_epi16(left, right);
+        } else if constexpr (sizeof(T) == 4) {
+            return _mm256_add_epi32(left, right);
+        } else {
+            return _mm256_add_epi64(left, right);
+        }
+    }
+
+    HE_CPP_AVX2_TARGET static Register Subtract(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm256_sub_ps(left, right);
+        } else if constexpr (IsDouble) {
+            return _mm256_sub_pd(left, right);
+        } else if constexpr (sizeof(T) == 1) {
+            return _mm256_sub_epi8(left, right);
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm256_sub_epi16(left, right);
+        } else if constexpr (sizeof(T) == 4) {
+            return _mm256_sub_epi32(left, right);
+        } else {
+            return _mm256_sub_epi64(left, right);
+        }
+    }
+
+    HE_CPP_AVX2_TARGET static Register Multiply(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm256_mul_ps(left, right);
+        } else if constexpr (IsDouble) {
+            return _mm256_mul_pd(left, right);
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm256_mullo_epi16(left, right);
+        } else {
+            return _mm256_mullo_epi32(left, right);
+        }
+    }
+
+    HE_CPP_AVX2_TARGET static Register Divide(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm256_div_ps(left, right);
+        } else {
+            return _mm256_div_pd(left, right);
+        }
+    }
+
+    HE_CPP_AVX2_TARGET static Register Negate(Register value) {
+        if constexpr (IsSingle) {
+            return _mm256_xor_ps(value, _mm256_set1_ps(-0.0f));
+        } else if constexpr (IsDouble) {
+            return _mm256_xor_pd(value, _mm256_set1_pd(-0.0));
+        } else {
+            return Subtract(Zero(), value);
+        }
+    }
+
+    HE_CPP_AVX2_TARGET static Register And(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm256_and_ps(left, right);
+        } else if constexpr (IsDouble) {
+            return _mm256_and_pd(left, right);
+        } else {
+            return _mm256_and_si256(left, right);
+        }
+    }
+
+    HE_CPP_AVX2_TARGET static Register Or(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm256_or_ps(left, right);
+        } else if constexpr (IsDouble) {
+            return _mm256_or_pd(left, right);
+        } else {
+            return _mm256_or_si256(left, right);
+        }
+    }
+
+    HE_CPP_AVX2_TARGET static Register Xor(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm256_xor_ps(left, right);
+        } else if constexpr (IsDouble) {
+            return _mm256_xor_pd(left, right);
+        } else {
+            return _mm256_xor_si256(left, right);
+        }
+    }
+
+    /// <summary>
+    /// Computes <c>left &amp; ~right</c>, the managed AndNot operand order.
+    /// </summary>
+    HE_CPP_AVX2_TARGET static Register AndNot(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm256_andnot_ps(right, left);
+        } else if constexpr (IsDouble) {
+            return _mm256_andnot_pd(right, left);
+        } else {
+            return _mm256_andnot_si256(right, left);
+        }
+    }
+
+    HE_CPP_AVX2_TARGET static Register Select(Register mask, Register left, Register right) {
+        return Or(And(mask, left), AndNot(right, mask));
+    }
+
+    HE_CPP_AVX2_TARGET static Register CompareEqual(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm256_cmp_ps(left, right, _CMP_EQ_OQ);
+        } else if constexpr (IsDouble) {
+            return _mm256_cmp_pd(left, right, _CMP_EQ_OQ);
+        } else if constexpr (sizeof(T) == 1) {
+            return _mm256_cmpeq_epi8(left, right);
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm256_cmpeq_epi16(left, right);
+        } else if constexpr (sizeof(T) == 4) {
+            return _mm256_cmpeq_epi32(left, right);
+        } else {
+            return _mm256_cmpeq_epi64(left, right);
+        }
+    }
+
+    HE_CPP_AVX2_TARGET static Register CompareGreaterThan(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm256_cmp_ps(left, right, _CMP_GT_OQ);
+        } else if constexpr (IsDouble) {
+            return _mm256_cmp_pd(left, right, _CMP_GT_OQ);
+        } else if constexpr (std::is_signed_v<T>) {
+            return SignedGreaterThan(left, right);
+        } else {
+            const Register bias = SignBits();
+            return SignedGreaterThan(_mm256_xor_si256(left, bias), _mm256_xor_si256(right, bias));
+        }
+    }
+
+    HE_CPP_AVX2_TARGET static Register CompareLessThan(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm256_cmp_ps(left, right, _CMP_LT_OQ);
+        } else if constexpr (IsDouble) {
+            return _mm256_cmp_pd(left, right, _CMP_LT_OQ);
+        } else {
+            return CompareGreaterThan(right, left);
+        }
+    }
+
+    HE_CPP_AVX2_TARGET static Register CompareLessThanOrEqual(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm256_cmp_ps(left, right, _CMP_LE_OQ);
+        } else if constexpr (IsDouble) {
+            return _mm256_cmp_pd(left, right, _CMP_LE_OQ);
+        } else {
+            return Xor(CompareGreaterThan(left, right), AllBitsSet());
+        }
+    }
+
+    /// <summary>
+    /// Matches std::min(left, right): <paramref name="left"/> wins ties and unordered lanes.
+    /// </summary>
+    HE_CPP_AVX2_TARGET static Register Min(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm256_min_ps(right, left);
+        } else if constexpr (IsDouble) {
+            return _mm256_min_pd(right, left);
+        } else if constexpr (sizeof(T) == 8) {
+            return Select(CompareGreaterThan(left, right), right, left);
+        } else if constexpr (std::is_signed_v<T>) {
+            if constexpr (sizeof(T) == 1) {
+                return _mm256_min_epi8(left, right);
+            } else if constexpr (sizeof(T) == 2) {
+                return _mm256_min_epi16(left, right);
+            } else {
+                return _mm256_min_epi32(left, right);
+            }
+        } else if constexpr (sizeof(T) == 1) {
+            return _mm256_min_epu8(left, right);
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm256_min_epu16(left, right);
+        } else {
+            return _mm256_min_epu32(left, right);
+        }
+    }
+
+    /// <summary>
+    /// Matches std::max(left, right): <paramref name="left"/> wins ties and unordered lanes.
+    /// </summary>
+    HE_CPP_AVX2_TARGET static Register Max(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm256_max_ps(right, left);
+        } else if constexpr (IsDouble) {
+            return _mm256_max_pd(right, left);
+        } else if constexpr (sizeof(T) == 8) {
+            return Select(CompareGreaterThan(right, left), right, left);
+        } else if constexpr (std::is_signed_v<T>) {
+            if constexpr (sizeof(T) == 1) {
+                return _mm256_max_epi8(left, right);
+            } else if constexpr (sizeof(T) == 2) {
+                return _mm256_max_epi16(left, right);
+            } else {
+                return _mm256_max_epi32(left, right);
+            }
+        } else if constexpr (sizeof(T) == 1) {
+            return _mm256_max_epu8(left, right);
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm256_max_epu16(left, right);
+        } else {
+            return _mm256_max_epu32(left, right);
+        }
+    }
+
+    /// <summary>
+    /// Gathers the most significant bit of every lane into the low bits of the result.
+    /// </summary>
+    HE_CPP_AVX2_TARGET static uint32_t MoveMask(Register value) {
+        if constexpr (IsSingle) {
+            return static_cast<uint32_t>(_mm256_movemask_ps(value));
+        } else if constexpr (IsDouble) {
+            return static_cast<uint32_t>(_mm256_movemask_pd(value));
+        } else if constexpr (sizeof(T) == 1) {
+            return static_cast<uint32_t>(_mm256_movemask_epi8(value));
+        } else if constexpr (sizeof(T) == 2) {
+            // The pack works within each 128-bit half, leaving the low half's sign bytes in mask bits 0-7 and the
+            // high half's in bits 16-23.
+            const uint32_t packed = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_packs_epi16(value, _mm256_setzero_si256())));
+            return (packed & 0xFFu) | ((packed >> 8) & 0xFF00u);
+        } else if constexpr (sizeof(T) == 4) {
+            return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(value)));
+        } else {
+            return static_cast<uint32_t>(_mm256_movemask_pd(_mm256_castsi256_pd(value)));
+        }
+    }
+
+    /// <summary>
+    /// Runs <typeparamref name="Kernel"/> on one register pair. Mirrors ApplyVectorLaneKernel, which cannot be called
+    /// from here because it is not compiled for AVX2 on dispatching builds.
+    /// </summary>
+    template <VectorLaneKernel Kernel>
+    HE_CPP_AVX2_TARGET static Register Apply(Register left, Register right) {
+        if constexpr (Kernel == VectorLaneKernel::Add) {
+            return Add(left, right);
+        } else if constexpr (Kernel == VectorLaneKernel::Subtract) {
+            return Subtract(left, right);
+        } else if constexpr (Kernel == VectorLaneKernel::Multiply) {
+            return Multiply(left, right);
+        } else if constexpr (Kernel == VectorLaneKernel::Divide) {
+            return Divide(left, right);
+        } else if constexpr (Kernel == VectorLaneKernel::And) {
+            return And(left, right);
+        } else if constexpr (Kernel == VectorLaneKernel::Or) {
+            return Or(left, right);
+        } else if constexpr (Kernel == VectorLaneKernel::Xor) {
+            return Xor(left, right);
+        } else if constexpr (Kernel == VectorLaneKernel::AndNot) {
+            return AndNot(left, right);
+        } else if constexpr (Kernel == VectorLaneKernel::CompareEqual) {
+            return CompareEqual(left, right);
+        } else if constexpr (Kernel == VectorLaneKernel::CompareGreaterThan) {
+            return CompareGreaterThan(left, right);
+        } else if constexpr (Kernel == VectorLaneKernel::CompareLessThan) {
+            return CompareLessThan(left, right);
+        } else if constexpr (Kernel == VectorLaneKernel::CompareLessThanOrEqual) {
+            return CompareLessThanOrEqual(left, right);
+        } else if constexpr (Kernel == VectorLaneKernel::Min) {
+            return Min(left, right);
+        } else {
+            return Max(left, right);
+        }
+    }
+
+    /// <summary>
+    /// Applies <typeparamref name="Kernel"/> to one 32-byte aligned block of lanes.
+    /// </summary>
+    template <VectorLaneKernel Kernel>
+    HE_CPP_AVX2_TARGET static void BinaryBlock(const T* left, const T* right, T* result) {
+        Store(result, Apply<Kernel>(Load(left), Load(right)));
+    }
+
+    HE_CPP_AVX2_TARGET static uint32_t MoveMaskBlock(const T* value) {
+        return MoveMask(Load(value));
+    }
+
+private:
+    HE_CPP_AVX2_TARGET static __m256i SignBits() {
+        if constexpr (sizeof(T) == 1) {
+            return _mm256_set1_epi8(static_cast<char>(0x80));
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm256_set1_epi16(static_cast<short>(0x8000));
+        } else if constexpr (sizeof(T) == 4) {
+            return _mm256_set1_epi32(static_cast<int>(0x80000000u));
+        } else {
+            return _mm256_set1_epi64x(static_cast<long long>(0x8000000000000000ull));
+        }
+    }
+
+    HE_CPP_AVX2_TARGET static __m256i SignedGreaterThan(__m256i left, __m256i right) {
+        if constexpr (sizeof(T) == 1) {
+            return _mm256_cmpgt_epi8(left, right);
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm256_cmpgt_epi16(left, right);
+        } else if constexpr (sizeof(T) == 4) {
+            return _mm256_cmpgt_epi32(left, right);
+        } else {
+            return _mm256_cmpgt_epi64(left, right);
+        }
+    }
+};
+#endif
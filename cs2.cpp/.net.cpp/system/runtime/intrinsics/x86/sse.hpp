@@ -7,11 +7,15 @@
 
 #include "system/runtime/intrinsics/vector128.hpp"
 
+/// <summary>
+/// Managed System.Runtime.Intrinsics.X86.Sse. SSE2 is the floor of the x86 backend, so IsSupported follows it and every
+/// method maps to its SSE instruction on those targets; the lane loops remain for targets without SSE.
+/// </summary>
 class Sse {
     template <typename T>
     static T ComparisonTrueValue() {
-        if constexpr (std::is_same_v<T, float>) {
-            uint32_t bits = 0xFFFFFFFFu;
+        if constexpr (std::is_floating_point_v<T>) {
+            VectorLaneBits<T> bits = static_cast<VectorLaneBits<T>>(~VectorLaneBits<T>());
             T value;
             std::memcpy(&value, &bits, sizeof(T));
             return value;
@@ -21,13 +25,19 @@ class Sse {
     }
 
 public:
-    static bool get_IsSupported() {
-        return false;
+    static constexpr bool get_IsSupported() {
+        return HE_CPP_SIMD_SSE2 != 0;
     }
 
     template <typename T>
     static Vector128_1<T> CompareGreaterThan(const Vector128_1<T>& left, const Vector128_1<T>& right) {
         Vector128_1<T> result;
+        if constexpr (Vector128Lanes<T>::Supports(VectorLaneOperation::CompareOrder)) {
+            using Lanes = Vector128Lanes<T>;
+            Lanes::Store(result.Values, Lanes::CompareGreaterThan(Lanes::Load(left.Values), Lanes::Load(right.Values)));
+            return result;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector128_1<T>::LaneCount; ++laneIndex) {
             result.Values[laneIndex] = left.Values[laneIndex] > right.Values[laneIndex] ? ComparisonTrueValue<T>() : T();
         }
@@ -37,15 +47,32 @@ public:
     template <typename T>
     static Vector128_1<T> CompareLessThanOrEqual(const Vector128_1<T>& left, const Vector128_1<T>& right) {
         Vector128_1<T> result;
+        if constexpr (Vector128Lanes<T>::Supports(VectorLaneOperation::CompareOrder)) {
+            using Lanes = Vector128Lanes<T>;
+            Lanes::Store(result.Values, Lanes::CompareLessThanOrEqual(Lanes::Load(left.Values), Lanes::Load(right.Values)));
+            return result;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector128_1<T>::LaneCount; ++laneIndex) {
             result.Values[laneIndex] = left.Values[laneIndex] <= right.Values[laneIndex] ? ComparisonTrueValue<T>() : T();
         }
         return result;
     }
 
+    /// <summary>
+    /// Approximates 1/x. On SSE targets this is rcpps, accurate to about 12 bits exactly as in the managed runtime;
+    /// the fallback divides.
+    /// </summary>
     template <typename T>
     static Vector128_1<T> Reciprocal(const Vector128_1<T>& value) {
         Vector128_1<T> result;
+#if HE_CPP_SIMD_SSE2
+        if constexpr (std::is_same_v<T, float>) {
+            _mm_store_ps(result.Values, _mm_rcp_ps(_mm_load_ps(value.Values)));
+            return result;
+        }
+#endif
+
         for (int32_t laneIndex = 0; laneIndex < Vector128_1<T>::LaneCount; ++laneIndex) {
             result.Values[laneIndex] = static_cast<T>(1) / value.Values[laneIndex];
         }
@@ -53,9 +80,19 @@ public:
         return result;
     }
 
+    /// <summary>
+    /// Approximates 1/sqrt(x) with rsqrtps on SSE targets.
+    /// </summary>
     template <typename T>
     static Vector128_1<T> ReciprocalSqrt(const Vector128_1<T>& value) {
         Vector128_1<T> result;
+#if HE_CPP_SIMD_SSE2
+        if constexpr (std::is_same_v<T, float>) {
+            _mm_store_ps(result.Values, _mm_rsqrt_ps(_mm_load_ps(value.Values)));
+            return result;
+        }
+#endif
+
         for (int32_t laneIndex = 0; laneIndex < Vector128_1<T>::LaneCount; ++laneIndex) {
             result.Values[laneIndex] = static_cast<T>(1) / static_cast<T>(std::sqrt(value.Values[laneIndex]));
         }
@@ -63,20 +100,25 @@ public:
         return result;
     }
 
+    /// <summary>
+    /// Gathers each lane's sign bit, as movmskps does.
+    /// </summary>
     template <typename T>
     static int32_t MoveMask(const Vector128_1<T>& value) {
-        int32_t mask = 0;
-        for (int32_t laneIndex = 0; laneIndex < Vector128_1<T>::LaneCount; ++laneIndex) {
-            if (value.Values[laneIndex] != T()) {
-                mask |= 1 << laneIndex;
-            }
-        }
-
-        return mask;
+        return Vector128::ExtractMostSignificantBits(value);
     }
 
+    /// <summary>
+    /// Stores to a 16-byte aligned destination, as movaps requires.
+    /// </summary>
     template <typename T>
     static void StoreAligned(T* destination, const Vector128_1<T>& value) {
+        if constexpr (Vector128Lanes<T>::Supports(VectorLaneOperation::Arithmetic)) {
+            using Lanes = Vector128Lanes<T>;
+            Lanes::Store(destination, Lanes::Load(value.Values));
+            return;
+        }
+
         for (int32_t laneIndex = 0; laneIndex < Vector128_1<T>::LaneCount; ++laneIndex) {
             destination[laneIndex] = value.Values[laneIndex];
         }
@@ -1,13 +1,31 @@
 #pragma once
 
 #include "../vector128.hpp"
+#include "system/runtime/intrinsics/cpu_features.hpp"
 
+/// <summary>
+/// Managed System.Runtime.Intrinsics.X86.Sse41.
+/// </summary>
 class Sse41 {
 public:
+    /// <summary>
+    /// A constant on builds that target SSE4.1; on builds that dispatch at run time, the cached cpuid answer.
+    /// </summary>
     static bool get_IsSupported() {
+#if HE_CPP_SIMD_SSE41
+        return true;
+#elif HE_CPP_SIMD_AVX2_DISPATCH
+        return CpuFeatures::HasSse41();
+#else
         return false;
+#endif
     }
 
+    /// <summary>
+    /// Takes lane i from <paramref name="right"/> where bit i of <paramref name="control"/> is set. The blend
+    /// instructions encode the control as an immediate, which a runtime argument cannot supply, so this stays a lane
+    /// loop; once inlined with the constant control from the managed call site it folds into blendps.
+    /// </summary>
     template <typename T>
     static Vector128_1<T> Blend(const Vector128_1<T>& left, const Vector128_1<T>& right, int32_t control) {
         Vector128_1<T> result;
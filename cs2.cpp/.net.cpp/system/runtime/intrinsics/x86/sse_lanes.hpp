@@ -0,0 +1,397 @@
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+#include "system/runtime/intrinsics/simd_config.hpp"
+#include "system/runtime/intrinsics/vector_lane_operation.hpp"
+
+#if HE_CPP_SIMD_SSE2
+#include <immintrin.h>
+
+/// <summary>
+/// SSE register type holding lanes of <typeparamref name="T"/>.
+/// </summary>
+template <typename T>
+struct SseRegister {
+    using Type = __m128i;
+};
+
+template <>
+struct SseRegister<float> {
+    using Type = __m128;
+};
+
+template <>
+struct SseRegister<double> {
+    using Type = __m128d;
+};
+
+/// <summary>
+/// SSE2 (and SSE4.1 where the target has it) lowering of the 128-bit lane operations for one lane type. The vector
+/// types keep their lanes in register-aligned storage, so Load and Store are single aligned moves the optimizer folds
+/// into the surrounding instructions, and every operation below is one instruction or a short fixed sequence.
+/// </summary>
+template <typename T>
+struct SseLanes {
+    static constexpr bool IsSingle = std::is_same_v<T, float>;
+    static constexpr bool IsDouble = std::is_same_v<T, double>;
+    static constexpr bool IsInteger = std::is_integral_v<T> && !std::is_same_v<T, bool> &&
+        (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+    static constexpr bool Enabled = IsSingle || IsDouble || IsInteger;
+
+    using Register = typename SseRegister<T>::Type;
+
+    static constexpr bool Supports(VectorLaneOperation operation) {
+        switch (operation) {
+        case VectorLaneOperation::Arithmetic:
+            return Enabled;
+        case VectorLaneOperation::Multiply:
+            return IsSingle || IsDouble || (IsInteger && sizeof(T) == 2) || (IsInteger && sizeof(T) == 4 && HE_CPP_SIMD_SSE41);
+        case VectorLaneOperation::Divide:
+            return IsSingle || IsDouble;
+        case VectorLaneOperation::CompareEqual:
+            return IsSingle || IsDouble || (IsInteger && (sizeof(T) <= 4 || HE_CPP_SIMD_SSE41));
+        case VectorLaneOperation::CompareOrder:
+            // 64-bit integer ordering needs SSE4.2's pcmpgtq, which the x86 backend does not assume.
+            return IsSingle || IsDouble || (IsInteger && sizeof(T) <= 4);
+        }
+
+        return false;
+    }
+
+    static Register Load(const T* source) {
+        if constexpr (IsSingle) {
+            return _mm_load_ps(source);
+        } else if constexpr (IsDouble) {
+            return _mm_load_pd(source);
+        } else {
+            return _mm_load_si128(reinterpret_cast<const __m128i*>(source));
+        }
+    }
+
+    static Register LoadUnaligned(const T* source) {
+        if constexpr (IsSingle) {
+            return _mm_loadu_ps(source);
+        } else if constexpr (IsDouble) {
+            return _mm_loadu_pd(source);
+        } else {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+        }
+    }
+
+    static void Store(T* destination, Register value) {
+        if constexpr (IsSingle) {
+            _mm_store_ps(destination, value);
+        } else if constexpr (IsDouble) {
+            _mm_store_pd(destination, value);
+        } else {
+            _mm_store_si128(reinterpret_cast<__m128i*>(destination), value);
+        }
+    }
+
+    static void StoreUnaligned(T* destination, Register value) {
+        if constexpr (IsSingle) {
+            _mm_storeu_ps(destination, value);
+        } else if constexpr (IsDouble) {
+            _mm_storeu_pd(destination, value);
+        } else {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), value);
+        }
+    }
+
+    static Register Zero() {
+        if constexpr (IsSingle) {
+            return _mm_setzero_ps();
+        } else if constexpr (IsDouble) {
+            return _mm_setzero_pd();
+        } else {
+            return _mm_setzero_si128();
+        }
+    }
+
+    static Register AllBitsSet() {
+        const __m128i ones = _mm_set1_epi32(-1);
+        if constexpr (IsSingle) {
+            return _mm_castsi128_ps(ones);
+        } else if constexpr (IsDouble) {
+            return _mm_castsi128_pd(ones);
+        } else {
+            return ones;
+        }
+    }
+
+    static Register Add(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm_add_ps(left, right);
+        } else if constexpr (IsDouble) {
+            return _mm_add_pd(left, right);
+        } else if constexpr (sizeof(T) == 1) {
+            return _mm_add_epi8(left, right);
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm_add_epi16(left, right);
+        } else if constexpr (sizeof(T) == 4) {
+            return _mm_add_epi32(left, right);
+        } else {
+            return _mm_add_epi64(left, right);
+        }
+    }
+
+    static Register Subtract(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm_sub_ps(left, right);
+        } else if constexpr (IsDouble) {
+            return _mm_sub_pd(left, right);
+        } else if constexpr (sizeof(T) == 1) {
+            return _mm_sub_epi8(left, right);
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm_sub_epi16(left, right);
+        } else if constexpr (sizeof(T) == 4) {
+            return _mm_sub_epi32(left, right);
+        } else {
+            return _mm_sub_epi64(left, right);
+        }
+    }
+
+    static Register Multiply(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm_mul_ps(left, right);
+        } else if constexpr (IsDouble) {
+            return _mm_mul_pd(left, right);
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm_mullo_epi16(left, right);
+        } else {
+#if HE_CPP_SIMD_SSE41
+            return _mm_mullo_epi32(left, right);
+#else
+            static_assert(sizeof(T) == 0, "32-bit lane multiplication requires SSE4.1.");
+#endif
+        }
+    }
+
+    static Register Divide(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm_div_ps(left, right);
+        } else {
+            return _mm_div_pd(left, right);
+        }
+    }
+
+    static Register Negate(Register value) {
+        if constexpr (IsSingle) {
+            return _mm_xor_ps(value, _mm_set1_ps(-0.0f));
+        } else if constexpr (IsDouble) {
+            return _mm_xor_pd(value, _mm_set1_pd(-0.0));
+        } else {
+            return Subtract(Zero(), value);
+        }
+    }
+
+    static Register And(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm_and_ps(left, right);
+        } else if constexpr (IsDouble) {
+            return _mm_and_pd(left, right);
+        } else {
+            return _mm_and_si128(left, right);
+        }
+    }
+
+    static Register Or(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm_or_ps(left, right);
+        } else if constexpr (IsDouble) {
+            return _mm_or_pd(left, right);
+        } else {
+            return _mm_or_si128(left, right);
+        }
+    }
+
+    static Register Xor(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm_xor_ps(left, right);
+        } else if constexpr (IsDouble) {
+            return _mm_xor_pd(left, right);
+        } else {
+            return _mm_xor_si128(left, right);
+        }
+    }
+
+    /// <summary>
+    /// Computes <c>left &amp; ~right</c>, the managed AndNot operand order; the andnot instructions complement their
+    /// first operand instead.
+    /// </summary>
+    static Register AndNot(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm_andnot_ps(right, left);
+        } else if constexpr (IsDouble) {
+            return _mm_andnot_pd(right, left);
+        } else {
+            return _mm_andnot_si128(right, left);
+        }
+    }
+
+    /// <summary>
+    /// Takes each bit from <paramref name="left"/> where <paramref name="mask"/> is set and from
+    /// <paramref name="right"/> elsewhere.
+    /// </summary>
+    static Register Select(Register mask, Register left, Register right) {
+        return Or(And(mask, left), AndNot(right, mask));
+    }
+
+    static Register CompareEqual(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm_cmpeq_ps(left, right);
+        } else if constexpr (IsDouble) {
+            return _mm_cmpeq_pd(left, right);
+        } else if constexpr (sizeof(T) == 1) {
+            return _mm_cmpeq_epi8(left, right);
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm_cmpeq_epi16(left, right);
+        } else if constexpr (sizeof(T) == 4) {
+            return _mm_cmpeq_epi32(left, right);
+        } else {
+#if HE_CPP_SIMD_SSE41
+            return _mm_cmpeq_epi64(left, right);
+#else
+            static_assert(sizeof(T) == 0, "64-bit lane equality requires SSE4.1.");
+#endif
+        }
+    }
+
+    static Register CompareGreaterThan(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm_cmpgt_ps(left, right);
+        } else if constexpr (IsDouble) {
+            return _mm_cmpgt_pd(left, right);
+        } else if constexpr (std::is_signed_v<T>) {
+            return SignedGreaterThan(left, right);
+        } else {
+            // Flipping the sign bit maps unsigned order onto the signed order the compare instructions implement.
+            const Register bias = SignBits();
+            return SignedGreaterThan(_mm_xor_si128(left, bias), _mm_xor_si128(right, bias));
+        }
+    }
+
+    static Register CompareLessThan(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm_cmplt_ps(left, right);
+        } else if constexpr (IsDouble) {
+            return _mm_cmplt_pd(left, right);
+        } else {
+            return CompareGreaterThan(right, left);
+        }
+    }
+
+    static Register CompareLessThanOrEqual(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm_cmple_ps(left, right);
+        } else if constexpr (IsDouble) {
+            return _mm_cmple_pd(left, right);
+        } else {
+            return Xor(CompareGreaterThan(left, right), AllBitsSet());
+        }
+    }
+
+    /// <summary>
+    /// Matches std::min(left, right): <paramref name="left"/> wins ties and unordered lanes.
+    /// </summary>
+    static Register Min(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm_min_ps(right, left);
+        } else if constexpr (IsDouble) {
+            return _mm_min_pd(right, left);
+        } else if constexpr (sizeof(T) == 2 && std::is_signed_v<T>) {
+            return _mm_min_epi16(left, right);
+        } else if constexpr (sizeof(T) == 1 && !std::is_signed_v<T>) {
+            return _mm_min_epu8(left, right);
+        } else {
+#if HE_CPP_SIMD_SSE41
+            if constexpr (sizeof(T) == 1) {
+                return _mm_min_epi8(left, right);
+            } else if constexpr (sizeof(T) == 2) {
+                return _mm_min_epu16(left, right);
+            } else if constexpr (std::is_signed_v<T>) {
+                return _mm_min_epi32(left, right);
+            } else {
+                return _mm_min_epu32(left, right);
+            }
+#else
+            return Select(CompareGreaterThan(left, right), right, left);
+#endif
+        }
+    }
+
+    /// <summary>
+    /// Matches std::max(left, right): <paramref name="left"/> wins ties and unordered lanes.
+    /// </summary>
+    static Register Max(Register left, Register right) {
+        if constexpr (IsSingle) {
+            return _mm_max_ps(right, left);
+        } else if constexpr (IsDouble) {
+            return _mm_max_pd(right, left);
+        } else if constexpr (sizeof(T) == 2 && std::is_signed_v<T>) {
+            return _mm_max_epi16(left, right);
+        } else if constexpr (sizeof(T) == 1 && !std::is_signed_v<T>) {
+            return _mm_max_epu8(left, right);
+        } else {
+#if HE_CPP_SIMD_SSE41
+            if constexpr (sizeof(T) == 1) {
+                return _mm_max_epi8(left, right);
+            } else if constexpr (sizeof(T) == 2) {
+                return _mm_max_epu16(left, right);
+            } else if constexpr (std::is_signed_v<T>) {
+                return _mm_max_epi32(left, right);
+            } else {
+                return _mm_max_epu32(left, right);
+            }
+#else
+            return Select(CompareGreaterThan(right, left), right, left);
+#endif
+        }
+    }
+
+    /// <summary>
+    /// Gathers the most significant bit of every lane into the low bits of the result.
+    /// </summary>
+    static uint32_t MoveMask(Register value) {
+        if constexpr (IsSingle) {
+            return static_cast<uint32_t>(_mm_movemask_ps(value));
+        } else if constexpr (IsDouble) {
+            return static_cast<uint32_t>(_mm_movemask_pd(value));
+        } else if constexpr (sizeof(T) == 1) {
+            return static_cast<uint32_t>(_mm_movemask_epi8(value));
+        } else if constexpr (sizeof(T) == 2) {
+            // Signed saturation keeps each lane's sign, so the packed bytes carry the sign bits.
+            return static_cast<uint32_t>(_mm_movemask_epi8(_mm_packs_epi16(value, _mm_setzero_si128())));
+        } else if constexpr (sizeof(T) == 4) {
+            return static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(value)));
+        } else {
+            return static_cast<uint32_t>(_mm_movemask_pd(_mm_castsi128_pd(value)));
+        }
+    }
+
+private:
+    static __m128i SignBits() {
+        if constexpr (sizeof(T) == 1) {
+            return _mm_set1_epi8(static_cast<char>(0x80));
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm_set1_epi16(static_cast<short>(0x8000));
+        } else {
+            return _mm_set1_epi32(static_cast<int>(0x80000000u));
+        }
+    }
+
+    static __m128i SignedGreaterThan(__m128i left, __m128i right) {
+        if constexpr (sizeof(T) == 1) {
+            return _mm_cmpgt_epi8(left, right);
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm_cmpgt_epi16(left, right);
+        } else if constexpr (sizeof(T) == 4) {
+            return _mm_cmpgt_epi32(left, right);
+        } else {
+            static_assert(sizeof(T) == 0, "64-bit lane ordering requires SSE4.2.");
+        }
+    }
+};
+#endif
@@ -1,40 +1,94 @@
 #ifndef HE_CPP_SYSTEM_THREADING_AUTO_RESET_EVENT_HPP
 #define HE_CPP_SYSTEM_THREADING_AUTO_RESET_EVENT_HPP
 
-#include <condition_variable>
+#include "system/threading/futex.hpp"
+#include <atomic>
 #include <cstdint>
-#include <mutex>
 
+/// <summary>
+/// Managed AutoResetEvent built on one futex word: Set stores the signal and wakes a single parked waiter, and a waiter
+/// consumes the signal with one compare-exchange. Waiters spin briefly before parking, so a handoff between two busy
+/// threads never enters the kernel.
+/// </summary>
 class AutoResetEvent {
 public:
     explicit AutoResetEvent(bool initialState = false)
-        : signaled(initialState) {
+        : signaled(initialState ? 1u : 0u), waiters(0) {
     }
 
-    void Set() {
-        {
-            std::lock_guard<std::mutex> lock(mutex);
-            signaled = true;
+    AutoResetEvent(const AutoResetEvent&) = delete;
+    AutoResetEvent& operator=(const AutoResetEvent&) = delete;
+
+    bool Set() {
+        // Sequentially consistent against the waiter count so a waiter registering concurrently either sees the
+        // signal or is counted and woken.
+        signaled.store(1, std::memory_order_seq_cst);
+        if (waiters.load(std::memory_order_seq_cst) != 0) {
+            Futex::WakeOne(signaled);
         }
 
-        condition.notify_one();
+        return true;
+    }
+
+    bool Reset() {
+        signaled.store(0, std::memory_order_relaxed);
+        return true;
     }
 
     void WaitOne() {
-        std::unique_lock<std::mutex> lock(mutex);
-        condition.wait(lock, [this]() {
-            return signaled;
-        });
-        signaled = false;
+        WaitOne(-1);
+    }
+
+    /// <summary>
+    /// Waits for the event and consumes its signal.
+    /// </summary>
+    /// <param name="millisecondsTimeout">Timeout in milliseconds, or -1 to wait indefinitely.</param>
+    /// <returns><c>true</c> when the signal was consumed before the timeout.</returns>
+    bool WaitOne(int32_t millisecondsTimeout) {
+        if (TryConsume()) {
+            return true;
+        }
+
+        const FutexTimeout timeout = FutexTimeout::FromMilliseconds(millisecondsTimeout);
+        if (millisecondsTimeout != 0) {
+            for (int32_t iteration = 0; iteration < HE_CPP_FUTEX_SPIN_COUNT; ++iteration) {
+                Futex::SpinPause(iteration);
+                if (TryConsume()) {
+                    return true;
+                }
+            }
+        }
+
+        waiters.fetch_add(1, std::memory_order_seq_cst);
+        bool consumed = false;
+        for (;;) {
+            if (TryConsume()) {
+                consumed = true;
+                break;
+            }
+
+            if (!Futex::Wait(signaled, 0, timeout)) {
+                consumed = TryConsume();
+                break;
+            }
+        }
+
+        waiters.fetch_sub(1, std::memory_order_relaxed);
+        return consumed;
     }
 
     void Dispose() {
     }
 
 private:
-    std::condition_variable condition;
-    std::mutex mutex;
-    bool signaled;
+    bool TryConsume() {
+        uint32_t expected = 1;
+        return signaled.load(std::memory_order_seq_cst) == 1 &&
+            signaled.compare_exchange_strong(expected, 0, std::memory_order_acquire, std::memory_order_relaxed);
+    }
+
+    std::atomic<uint32_t> signaled;
+    std::atomic<uint32_t> waiters;
 };
 
 #endif
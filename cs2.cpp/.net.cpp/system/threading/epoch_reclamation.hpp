@@ -0,0 +1,218 @@
+#ifndef HE_CPP_SYSTEM_THREADING_EPOCH_RECLAMATION_HPP
+#define HE_CPP_SYSTEM_THREADING_EPOCH_RECLAMATION_HPP
+
+#include "helcpp_config.hpp"
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#if HE_CPP_PLATFORM_PS2 || HE_CPP_PLATFORM_N64 || HE_CPP_PLATFORM_DS || HE_CPP_RUNTIME_CUSTOM_RETRO
+#define HE_CPP_EPOCH_RECLAMATION_THREADED 0
+#else
+#define HE_CPP_EPOCH_RECLAMATION_THREADED 1
+#endif
+
+#if HE_CPP_EPOCH_RECLAMATION_THREADED
+#include <mutex>
+#endif
+
+/// <summary>
+/// Epoch-based memory reclamation for the lock-free readers of the concurrent collections. A reader pins the current
+/// epoch with a <see cref="Guard"/> while it follows shared pointers; a writer that unlinks a node retires it instead of
+/// deleting it, and the node is freed once the global epoch has advanced twice past its retirement, when no reader that
+/// could still hold it remains. Entering a guard is one store to a per-thread record, so readers never contend with
+/// each other. Targets without threads free retired nodes immediately.
+/// </summary>
+class EpochReclamation {
+private:
+    struct ThreadRecord;
+
+public:
+    /// <summary>
+    /// Pins the calling thread's epoch for the guard's lifetime. Guards nest.
+    /// </summary>
+    class Guard {
+    public:
+        Guard() {
+#if HE_CPP_EPOCH_RECLAMATION_THREADED
+            record = &LocalRecord();
+            if (record->Depth++ == 0) {
+                record->LocalEpoch.store(GlobalEpoch().load(std::memory_order_relaxed), std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+            }
+#endif
+        }
+
+        ~Guard() {
+#if HE_CPP_EPOCH_RECLAMATION_THREADED
+            if (--record->Depth == 0) {
+                record->LocalEpoch.store(0, std::memory_order_release);
+            }
+#endif
+        }
+
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+
+    private:
+#if HE_CPP_EPOCH_RECLAMATION_THREADED
+        ThreadRecord* record;
+#endif
+    };
+
+    /// <summary>
+    /// Deletes <paramref name="value"/> once no pinned reader can still reach it. The caller must already have unlinked it.
+    /// </summary>
+    template <typename T>
+    static void Retire(T* value) {
+        Retire(value, [](void* retired) {
+            delete static_cast<T*>(retired);
+        });
+    }
+
+    static void Retire(void* value, void (*deleter)(void*)) {
+#if HE_CPP_EPOCH_RECLAMATION_THREADED
+        ThreadRecord& record = LocalRecord();
+        record.Retired.push_back(RetiredNode { value, deleter, GlobalEpoch().load(std::memory_order_seq_cst) });
+        if (record.Retired.size() >= CollectThreshold) {
+            Collect(record);
+        }
+#else
+        deleter(value);
+#endif
+    }
+
+private:
+#if HE_CPP_EPOCH_RECLAMATION_THREADED
+    static constexpr size_t CollectThreshold = 64;
+
+    struct RetiredNode {
+        void* Value;
+        void (*Deleter)(void*);
+        uint64_t Epoch;
+    };
+
+    /// <summary>
+    /// Per-thread pin and retire list. Records are never freed; a record released by an exiting thread is reused by the
+    /// next new thread, so the record list stays as long as the peak thread count.
+    /// </summary>
+    struct ThreadRecord {
+        std::atomic<uint64_t> LocalEpoch { 0 };
+        std::atomic<bool> InUse { true };
+        int32_t Depth = 0;
+        ThreadRecord* Next = nullptr;
+        std::vector<RetiredNode> Retired;
+    };
+
+    /// <summary>
+    /// Releases the calling thread's record on exit and hands its unreclaimed nodes to the shared orphan list.
+    /// </summary>
+    struct RecordOwner {
+        ThreadRecord* Record = nullptr;
+
+        ~RecordOwner() {
+            if (Record == nullptr) {
+                return;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(OrphanMutex());
+                std::vector<RetiredNode>& orphans = Orphans();
+                orphans.insert(orphans.end(), Record->Retired.begin(), Record->Retired.end());
+            }
+
+            Record->Retired.clear();
+            Record->LocalEpoch.store(0, std::memory_order_release);
+            Record->InUse.store(false, std::memory_order_release);
+        }
+    };
+
+    static std::atomic<uint64_t>& GlobalEpoch() {
+        static std::atomic<uint64_t> epoch(1);
+        return epoch;
+    }
+
+    static std::atomic<ThreadRecord*>& Records() {
+        static std::atomic<ThreadRecord*> head(nullptr);
+        return head;
+    }
+
+    static std::mutex& OrphanMutex() {
+        static std::mutex* mutex = new std::mutex();
+        return *mutex;
+    }
+
+    static std::vector<RetiredNode>& Orphans() {
+        static std::vector<RetiredNode>* orphans = new std::vector<RetiredNode>();
+        return *orphans;
+    }
+
+    static ThreadRecord& LocalRecord() {
+        static thread_local RecordOwner owner;
+        if (owner.Record == nullptr) {
+            owner.Record = AcquireRecord();
+        }
+
+        return *owner.Record;
+    }
+
+    static ThreadRecord* AcquireRecord() {
+        for (ThreadRecord* record = Records().load(std::memory_order_acquire); record != nullptr; record = record->Next) {
+            bool expected = false;
+            if (!record->InUse.load(std::memory_order_relaxed) &&
+                record->InUse.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+                return record;
+            }
+        }
+
+        ThreadRecord* record = new ThreadRecord();
+        ThreadRecord* head = Records().load(std::memory_order_relaxed);
+        do {
+            record->Next = head;
+        } while (!Records().compare_exchange_weak(head, record, std::memory_order_release, std::memory_order_relaxed));
+
+        return record;
+    }
+
+    /// <summary>
+    /// Advances the global epoch when every pinned thread has observed the current one.
+    /// </summary>
+    static void TryAdvance() {
+        uint64_t current = GlobalEpoch().load(std::memory_order_seq_cst);
+        for (ThreadRecord* record = Records().load(std::memory_order_acquire); record != nullptr; record = record->Next) {
+            const uint64_t pinned = record->LocalEpoch.load(std::memory_order_seq_cst);
+            if (pinned != 0 && pinned != current) {
+                return;
+            }
+        }
+
+        GlobalEpoch().compare_exchange_strong(current, current + 1, std::memory_order_seq_cst);
+    }
+
+    static void FreeExpired(std::vector<RetiredNode>& retired, uint64_t safeEpoch) {
+        size_t kept = 0;
+        for (size_t index = 0; index < retired.size(); ++index) {
+            if (retired[index].Epoch + 2 <= safeEpoch) {
+                retired[index].Deleter(retired[index].Value);
+            } else {
+                retired[kept++] = retired[index];
+            }
+        }
+
+        retired.resize(kept);
+    }
+
+    static void Collect(ThreadRecord& record) {
+        TryAdvance();
+        const uint64_t current = GlobalEpoch().load(std::memory_order_seq_cst);
+        FreeExpired(record.Retired, current);
+
+        std::unique_lock<std::mutex> lock(OrphanMutex(), std::try_to_lock);
+        if (lock.owns_lock()) {
+            FreeExpired(Orphans(), current);
+        }
+    }
+#endif
+};
+
+#endif // HE_CPP_SYSTEM_THREADING_EPOCH_RECLAMATION_HPP
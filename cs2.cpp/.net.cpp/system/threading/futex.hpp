@@ -0,0 +1,286 @@
+#ifndef HE_CPP_SYSTEM_THREADING_FUTEX_HPP
+#define HE_CPP_SYSTEM_THREADING_FUTEX_HPP
+
+#include "helcpp_config.hpp"
+#include "runtime/native_exceptions.hpp"
+#include <atomic>
+#include <cstdint>
+
+#if HE_CPP_PLATFORM_PS2 || HE_CPP_PLATFORM_N64 || HE_CPP_PLATFORM_DS || HE_CPP_RUNTIME_CUSTOM_RETRO
+#define HE_CPP_FUTEX_THREADED 0
+#else
+#define HE_CPP_FUTEX_THREADED 1
+#endif
+
+#if HE_CPP_FUTEX_THREADED
+#include <chrono>
+#if defined(__linux__)
+#include <climits>
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#endif
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#elif defined(_MSC_VER) && (defined(_M_ARM64) || defined(_M_ARM))
+#include <intrin.h>
+#endif
+#endif
+
+/// <summary>
+/// Spin iterations the futex-based primitives (ManualResetEventSlim, SemaphoreSlim, Monitor, ReaderWriterLockSlim)
+/// spend re-checking their state before they park. Matches the .NET default for ManualResetEventSlim.SpinCount.
+/// </summary>
+#ifndef HE_CPP_FUTEX_SPIN_COUNT
+#define HE_CPP_FUTEX_SPIN_COUNT 35
+#endif
+
+/// <summary>
+/// Largest number of pause instructions issued in one spin iteration.
+/// </summary>
+#ifndef HE_CPP_FUTEX_MAX_PAUSES
+#define HE_CPP_FUTEX_MAX_PAUSES 64
+#endif
+
+/// <summary>
+/// Deadline for one blocking call, built from a managed millisecond timeout where -1 (Timeout.Infinite) never expires.
+/// </summary>
+class FutexTimeout {
+public:
+    static FutexTimeout Infinite() {
+        return FutexTimeout();
+    }
+
+    static FutexTimeout FromMilliseconds(int32_t millisecondsTimeout) {
+        if (millisecondsTimeout < -1) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+            throw ArgumentOutOfRangeException();
+#else
+            throw ArgumentOutOfRangeException("millisecondsTimeout", "The timeout must be -1 or a non-negative number of milliseconds.");
+#endif
+        }
+
+        FutexTimeout timeout;
+        if (millisecondsTimeout != -1) {
+            timeout.infinite = false;
+#if HE_CPP_FUTEX_THREADED
+            timeout.deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(millisecondsTimeout);
+#endif
+        }
+
+        return timeout;
+    }
+
+    bool get_IsInfinite() const {
+        return infinite;
+    }
+
+#if HE_CPP_FUTEX_THREADED
+    std::chrono::steady_clock::time_point get_Deadline() const {
+        return deadline;
+    }
+#endif
+
+    /// <summary>
+    /// Gets whether the deadline has passed. Without threads nothing can change while the caller waits, so every finite
+    /// timeout counts as already expired.
+    /// </summary>
+    bool HasExpired() const {
+#if HE_CPP_FUTEX_THREADED
+        return !infinite && std::chrono::steady_clock::now() >= deadline;
+#else
+        return !infinite;
+#endif
+    }
+
+private:
+    FutexTimeout()
+        : infinite(true) {
+    }
+
+    bool infinite;
+#if HE_CPP_FUTEX_THREADED
+    std::chrono::steady_clock::time_point deadline;
+#endif
+};
+
+/// <summary>
+/// Address-keyed parking shared by the threading primitives. A waiter sleeps only while a 32-bit word still holds the
+/// value it last observed, so a wake issued after the word changes can never be lost. Linux parks directly on the word
+/// with the private futex syscall; other hosts hash the address onto a small table of mutex and condition variable
+/// buckets, which keeps timed waits available where std::atomic::wait has no timeout.
+/// </summary>
+class Futex {
+public:
+    /// <summary>
+    /// Sleeps while <paramref name="word"/> equals <paramref name="expected"/>. Returns early on any wake, spurious or
+    /// not, so callers re-check their own state in a loop.
+    /// </summary>
+    static void Wait(std::atomic<uint32_t>& word, uint32_t expected) {
+        Wait(word, expected, FutexTimeout::Infinite());
+    }
+
+    /// <summary>
+    /// Sleeps while <paramref name="word"/> equals <paramref name="expected"/> until the deadline passes.
+    /// </summary>
+    /// <returns><c>false</c> once the deadline has passed; otherwise <c>true</c>.</returns>
+    static bool Wait(std::atomic<uint32_t>& word, uint32_t expected, const FutexTimeout& timeout) {
+        if (word.load(std::memory_order_acquire) != expected) {
+            return true;
+        }
+
+#if HE_CPP_FUTEX_THREADED
+#if defined(__linux__)
+        if (timeout.get_IsInfinite()) {
+            syscall(SYS_futex, Address(word), FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+            return true;
+        }
+
+        const std::chrono::steady_clock::duration remaining = timeout.get_Deadline() - std::chrono::steady_clock::now();
+        if (remaining <= std::chrono::steady_clock::duration::zero()) {
+            return false;
+        }
+
+        const int64_t nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(remaining).count();
+        struct timespec relative;
+        relative.tv_sec = static_cast<time_t>(nanoseconds / 1000000000);
+        relative.tv_nsec = static_cast<long>(nanoseconds % 1000000000);
+        syscall(SYS_futex, Address(word), FUTEX_WAIT_PRIVATE, expected, &relative, nullptr, 0);
+        return !timeout.HasExpired();
+#else
+        Bucket& bucket = BucketFor(&word);
+        std::unique_lock<std::mutex> lock(bucket.Mutex);
+        if (word.load(std::memory_order_acquire) != expected) {
+            return true;
+        }
+
+        if (timeout.get_IsInfinite()) {
+            bucket.Condition.wait(lock);
+            return true;
+        }
+
+        return bucket.Condition.wait_until(lock, timeout.get_Deadline()) == std::cv_status::no_timeout || !timeout.HasExpired();
+#endif
+#else
+        if (timeout.get_IsInfinite()) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+            throw InvalidOperationException();
+#else
+            throw InvalidOperationException("The wait can never be satisfied on a target without threads.");
+#endif
+        }
+
+        return false;
+#endif
+    }
+
+    /// <summary>
+    /// Wakes at least one thread parked on <paramref name="word"/>.
+    /// </summary>
+    static void WakeOne(std::atomic<uint32_t>& word) {
+#if HE_CPP_FUTEX_THREADED
+#if defined(__linux__)
+        syscall(SYS_futex, Address(word), FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+#else
+        // Buckets are shared between addresses, so waking one sleeper could pick a thread waiting on another word.
+        Wake(word);
+#endif
+#else
+        (void)word;
+#endif
+    }
+
+    /// <summary>
+    /// Wakes every thread parked on <paramref name="word"/>.
+    /// </summary>
+    static void WakeAll(std::atomic<uint32_t>& word) {
+#if HE_CPP_FUTEX_THREADED
+#if defined(__linux__)
+        syscall(SYS_futex, Address(word), FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+#else
+        Wake(word);
+#endif
+#else
+        (void)word;
+#endif
+    }
+
+    /// <summary>
+    /// Pauses for one spin iteration, doubling the pause count each iteration up to HE_CPP_FUTEX_MAX_PAUSES so a
+    /// hyperthread sibling keeps its execution resources while the caller waits for a short critical section.
+    /// </summary>
+    static void SpinPause(int32_t iteration) {
+#if HE_CPP_FUTEX_THREADED
+        int32_t pauses = HE_CPP_FUTEX_MAX_PAUSES;
+        if (iteration < 6) {
+            pauses = 1 << iteration;
+            if (pauses > HE_CPP_FUTEX_MAX_PAUSES) {
+                pauses = HE_CPP_FUTEX_MAX_PAUSES;
+            }
+        }
+
+        for (int32_t index = 0; index < pauses; ++index) {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+            _mm_pause();
+#elif defined(_MSC_VER) && (defined(_M_ARM64) || defined(_M_ARM))
+            __yield();
+#elif defined(__aarch64__) || defined(__arm__)
+            __asm__ __volatile__("yield");
+#endif
+        }
+#else
+        (void)iteration;
+#endif
+    }
+
+    /// <summary>
+    /// Returns a nonzero token that identifies the calling thread while it runs, used by the primitives to record
+    /// which thread owns a lock.
+    /// </summary>
+    static uintptr_t CurrentThreadToken() {
+#if HE_CPP_FUTEX_THREADED
+        static thread_local char marker;
+        return reinterpret_cast<uintptr_t>(&marker);
+#else
+        return 1;
+#endif
+    }
+
+private:
+#if HE_CPP_FUTEX_THREADED
+#if defined(__linux__)
+    static uint32_t* Address(std::atomic<uint32_t>& word) {
+        static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "Futex words must be plain 32-bit integers.");
+        return reinterpret_cast<uint32_t*>(&word);
+    }
+#else
+    struct Bucket {
+        std::mutex Mutex;
+        std::condition_variable Condition;
+    };
+
+    static Bucket& BucketFor(const void* address) {
+        static Bucket buckets[64];
+        const size_t value = reinterpret_cast<size_t>(address);
+        return buckets[(value >> 4 ^ value >> 10) & 63];
+    }
+
+    static void Wake(std::atomic<uint32_t>& word) {
+        Bucket& bucket = BucketFor(&word);
+        {
+            // Taking the bucket lock orders this wake after any waiter that saw the old value and is about to sleep.
+            std::lock_guard<std::mutex> lock(bucket.Mutex);
+        }
+
+        bucket.Condition.notify_all();
+    }
+#endif
+#endif
+};
+
+#endif
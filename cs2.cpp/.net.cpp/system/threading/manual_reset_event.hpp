@@ -0,0 +1,45 @@
+#ifndef HE_CPP_SYSTEM_THREADING_MANUAL_RESET_EVENT_HPP
+#define HE_CPP_SYSTEM_THREADING_MANUAL_RESET_EVENT_HPP
+
+#include "system/threading/manual_reset_event_slim.hpp"
+#include <cstdint>
+
+/// <summary>
+/// Managed ManualResetEvent. The native runtime has no kernel handles to share across processes, so the event is the
+/// same futex word as ManualResetEventSlim behind the WaitHandle-style surface.
+/// </summary>
+class ManualResetEvent {
+public:
+    explicit ManualResetEvent(bool initialState)
+        : event(initialState) {
+    }
+
+    ManualResetEvent(const ManualResetEvent&) = delete;
+    ManualResetEvent& operator=(const ManualResetEvent&) = delete;
+
+    bool Set() {
+        event.Set();
+        return true;
+    }
+
+    bool Reset() {
+        event.Reset();
+        return true;
+    }
+
+    void WaitOne() {
+        event.Wait();
+    }
+
+    bool WaitOne(int32_t millisecondsTimeout) {
+        return event.Wait(millisecondsTimeout);
+    }
+
+    void Dispose() {
+    }
+
+private:
+    ManualResetEventSlim event;
+};
+
+#endif
@@ -0,0 +1,98 @@
+#ifndef HE_CPP_SYSTEM_THREADING_MANUAL_RESET_EVENT_SLIM_HPP
+#define HE_CPP_SYSTEM_THREADING_MANUAL_RESET_EVENT_SLIM_HPP
+
+#include "system/threading/futex.hpp"
+#include <atomic>
+#include <cstdint>
+
+/// <summary>
+/// Managed ManualResetEventSlim built on one futex word. Wait spins for SpinCount iterations before parking, Set wakes
+/// every parked waiter only when one has registered, and an already-set event costs Wait a single load.
+/// </summary>
+class ManualResetEventSlim {
+public:
+    explicit ManualResetEventSlim(bool initialState = false, int32_t spinCount = HE_CPP_FUTEX_SPIN_COUNT)
+        : signaled(initialState ? 1u : 0u), waiters(0), spinCount(spinCount) {
+        if (spinCount < 0) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+            throw ArgumentOutOfRangeException();
+#else
+            throw ArgumentOutOfRangeException("spinCount", "The spin count must not be negative.");
+#endif
+        }
+    }
+
+    ManualResetEventSlim(const ManualResetEventSlim&) = delete;
+    ManualResetEventSlim& operator=(const ManualResetEventSlim&) = delete;
+
+    void Set() {
+        signaled.store(1, std::memory_order_seq_cst);
+        if (waiters.load(std::memory_order_seq_cst) != 0) {
+            Futex::WakeAll(signaled);
+        }
+    }
+
+    void Reset() {
+        signaled.store(0, std::memory_order_relaxed);
+    }
+
+    bool get_IsSet() const {
+        return signaled.load(std::memory_order_acquire) == 1;
+    }
+
+    int32_t get_SpinCount() const {
+        return spinCount;
+    }
+
+    void Wait() {
+        Wait(-1);
+    }
+
+    /// <summary>
+    /// Waits until the event is set.
+    /// </summary>
+    /// <param name="millisecondsTimeout">Timeout in milliseconds, or -1 to wait indefinitely.</param>
+    /// <returns><c>true</c> when the event was set before the timeout.</returns>
+    bool Wait(int32_t millisecondsTimeout) {
+        if (get_IsSet()) {
+            return true;
+        }
+
+        const FutexTimeout timeout = FutexTimeout::FromMilliseconds(millisecondsTimeout);
+        if (millisecondsTimeout != 0) {
+            for (int32_t iteration = 0; iteration < spinCount; ++iteration) {
+                Futex::SpinPause(iteration);
+                if (get_IsSet()) {
+                    return true;
+                }
+            }
+        }
+
+        waiters.fetch_add(1, std::memory_order_seq_cst);
+        bool set = false;
+        for (;;) {
+            if (signaled.load(std::memory_order_seq_cst) == 1) {
+                set = true;
+                break;
+            }
+
+            if (!Futex::Wait(signaled, 0, timeout)) {
+                set = get_IsSet();
+                break;
+            }
+        }
+
+        waiters.fetch_sub(1, std::memory_order_relaxed);
+        return set;
+    }
+
+    void Dispose() {
+    }
+
+private:
+    std::atomic<uint32_t> signaled;
+    std::atomic<uint32_t> waiters;
+    const int32_t spinCount;
+};
+
+#endif
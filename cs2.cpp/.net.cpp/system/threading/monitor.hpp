@@ -0,0 +1,538 @@
+#ifndef HE_CPP_SYSTEM_THREADING_MONITOR_HPP
+#define HE_CPP_SYSTEM_THREADING_MONITOR_HPP
+
+#include "helcpp_config.hpp"
+#include "runtime/native_exceptions.hpp"
+#include "system/collections/concurrent/concurrent_dictionary.hpp"
+#include "system/threading/epoch_reclamation.hpp"
+#include "system/threading/futex.hpp"
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+/// <summary>
+/// The re-entrant lock and condition queue behind one object's monitor. Entering is a three-state futex mutex
+/// (unlocked, locked, locked with sleepers) so an uncontended Enter and Exit are one atomic operation each and only an
+/// Exit that may have sleepers makes a wake call. Wait queues the caller on its own futex word, releases the lock, and
+/// reacquires it after a Pulse or the timeout, matching the managed Monitor.Wait contract.
+/// </summary>
+class MonitorLock {
+public:
+    MonitorLock()
+        : state(0), owner(0), recursion(0), waitersHead(nullptr), waitersTail(nullptr), users(0) {
+    }
+
+    MonitorLock(const MonitorLock&) = delete;
+    MonitorLock& operator=(const MonitorLock&) = delete;
+
+    void Enter() {
+        TryEnter(-1);
+    }
+
+    bool TryEnter(int32_t millisecondsTimeout) {
+        const uintptr_t self = Futex::CurrentThreadToken();
+        if (owner.load(std::memory_order_relaxed) == self) {
+            ++recursion;
+            return true;
+        }
+
+        uint32_t expected = Unlocked;
+        if (!state.compare_exchange_strong(expected, Locked, std::memory_order_acquire, std::memory_order_relaxed) &&
+            !LockContended(FutexTimeout::FromMilliseconds(millisecondsTimeout), millisecondsTimeout != 0)) {
+            return false;
+        }
+
+        owner.store(self, std::memory_order_relaxed);
+        recursion = 1;
+        return true;
+    }
+
+    void Exit() {
+        ThrowIfNotOwner();
+        if (--recursion != 0) {
+            return;
+        }
+
+        owner.store(0, std::memory_order_relaxed);
+        Unlock();
+    }
+
+    bool IsEntered() const {
+        return owner.load(std::memory_order_relaxed) == Futex::CurrentThreadToken();
+    }
+
+    /// <summary>
+    /// Releases the lock, waits for a Pulse or the timeout, and reacquires the lock at the caller's recursion depth.
+    /// </summary>
+    /// <returns><c>true</c> when a Pulse woke the caller; <c>false</c> when the timeout elapsed first.</returns>
+    bool Wait(int32_t millisecondsTimeout) {
+        ThrowIfNotOwner();
+        const FutexTimeout timeout = FutexTimeout::FromMilliseconds(millisecondsTimeout);
+#if !HE_CPP_FUTEX_THREADED
+        if (timeout.get_IsInfinite()) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+            throw InvalidOperationException();
+#else
+            throw InvalidOperationException("Monitor.Wait can never be pulsed on a target without threads.");
+#endif
+        }
+
+        return false;
+#else
+        Waiter waiter;
+        if (waitersTail == nullptr) {
+            waitersHead = &waiter;
+        } else {
+            waitersTail->Next = &waiter;
+        }
+
+        waitersTail = &waiter;
+
+        const int32_t savedRecursion = recursion;
+        const uintptr_t self = owner.load(std::memory_order_relaxed);
+        recursion = 0;
+        owner.store(0, std::memory_order_relaxed);
+        Unlock();
+
+        while (waiter.Signaled.load(std::memory_order_acquire) == 0) {
+            if (!Futex::Wait(waiter.Signaled, 0, timeout)) {
+                break;
+            }
+        }
+
+        // The pulser still holds the lock while it wakes this waiter, so the node stays alive until it is reacquired.
+        uint32_t expected = Unlocked;
+        if (!state.compare_exchange_strong(expected, Locked, std::memory_order_acquire, std::memory_order_relaxed)) {
+            LockContended(FutexTimeout::Infinite(), true);
+        }
+
+        owner.store(self, std::memory_order_relaxed);
+        recursion = savedRecursion;
+        if (waiter.Signaled.load(std::memory_order_relaxed) != 0) {
+            return true;
+        }
+
+        RemoveWaiter(&waiter);
+        return false;
+#endif
+    }
+
+    /// <summary>
+    /// Wakes the longest-waiting thread, which runs once the caller exits the lock.
+    /// </summary>
+    void Pulse() {
+        ThrowIfNotOwner();
+        Waiter* waiter = waitersHead;
+        if (waiter != nullptr) {
+            RemoveWaiter(waiter);
+            Signal(waiter);
+        }
+    }
+
+    void PulseAll() {
+        ThrowIfNotOwner();
+        Waiter* waiter = waitersHead;
+        waitersHead = nullptr;
+        waitersTail = nullptr;
+        while (waiter != nullptr) {
+            // Read the link first: the woken thread owns the node again as soon as it reacquires the lock.
+            Waiter* next = waiter->Next;
+            Signal(waiter);
+            waiter = next;
+        }
+    }
+
+private:
+    friend class Monitor;
+
+    static constexpr uint32_t Unlocked = 0;
+    static constexpr uint32_t Locked = 1;
+    static constexpr uint32_t Contended = 2;
+
+    /// <summary>
+    /// User count of a monitor that has been unlinked from the table and may no longer be entered.
+    /// </summary>
+    static constexpr int32_t Retired = -1;
+
+    /// <summary>
+    /// Counts a new user unless the monitor has already been retired.
+    /// </summary>
+    bool TryAddUser() {
+        int32_t current = users.load(std::memory_order_relaxed);
+        do {
+            if (current == Retired) {
+                return false;
+            }
+        } while (!users.compare_exchange_weak(current, current + 1, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+        return true;
+    }
+
+    /// <summary>
+    /// Drops one user and returns <c>true</c> when the caller was the last one and has claimed the monitor for removal.
+    /// </summary>
+    bool ReleaseUser() {
+        // The last user moves straight to Retired: once a count reaches zero another thread could retire and free the
+        // monitor, so no caller may touch it after its own decrement.
+        int32_t current = users.load(std::memory_order_relaxed);
+        while (!users.compare_exchange_weak(current, current == 1 ? Retired : current - 1, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+        }
+
+        return current == 1;
+    }
+
+    /// <summary>
+    /// One thread blocked in Wait, linked in FIFO order while the lock is held.
+    /// </summary>
+    struct Waiter {
+        std::atomic<uint32_t> Signaled { 0 };
+        Waiter* Next = nullptr;
+    };
+
+    bool LockContended(const FutexTimeout& timeout, bool spin) {
+        if (spin) {
+            for (int32_t iteration = 0; iteration < HE_CPP_FUTEX_SPIN_COUNT; ++iteration) {
+                Futex::SpinPause(iteration);
+                uint32_t expected = Unlocked;
+                if (state.load(std::memory_order_relaxed) == Unlocked &&
+                    state.compare_exchange_strong(expected, Locked, std::memory_order_acquire, std::memory_order_relaxed)) {
+                    return true;
+                }
+            }
+        }
+
+        // Marking the lock contended before sleeping makes the holder's Exit issue a wake.
+        for (;;) {
+            if (state.exchange(Contended, std::memory_order_acquire) == Unlocked) {
+                return true;
+            }
+
+            if (!Futex::Wait(state, Contended, timeout)) {
+                return state.exchange(Contended, std::memory_order_acquire) == Unlocked;
+            }
+        }
+    }
+
+    void Unlock() {
+        if (state.exchange(Unlocked, std::memory_order_release) == Contended) {
+            Futex::WakeOne(state);
+        }
+    }
+
+    void RemoveWaiter(Waiter* target) {
+        Waiter* previous = nullptr;
+        for (Waiter* waiter = waitersHead; waiter != nullptr; previous = waiter, waiter = waiter->Next) {
+            if (waiter != target) {
+                continue;
+            }
+
+            if (previous == nullptr) {
+                waitersHead = waiter->Next;
+            } else {
+                previous->Next = waiter->Next;
+            }
+
+            if (waitersTail == waiter) {
+                waitersTail = previous;
+            }
+
+            waiter->Next = nullptr;
+            return;
+        }
+    }
+
+    static void Signal(Waiter* waiter) {
+        waiter->Signaled.store(1, std::memory_order_release);
+        Futex::WakeOne(waiter->Signaled);
+    }
+
+    void ThrowIfNotOwner() const {
+        if (!IsEntered()) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+            throw SynchronizationLockException();
+#else
+            throw SynchronizationLockException("Object synchronization method was called from an unsynchronized block of code.");
+#endif
+        }
+    }
+
+    std::atomic<uint32_t> state;
+    std::atomic<uintptr_t> owner;
+    int32_t recursion;
+    Waiter* waitersHead;
+    Waiter* waitersTail;
+
+    /// <summary>
+    /// Enters not yet matched by an Exit, plus one for each thread that caches this monitor.
+    /// </summary>
+    std::atomic<int32_t> users;
+};
+
+/// <summary>
+/// Managed System.Threading.Monitor. Native objects carry no sync block, so each locked object's MonitorLock is found
+/// through a lock-free ConcurrentDictionary keyed by address, with a per-thread cache of the last object so a loop that
+/// locks the same object repeatedly skips the lookup. A monitor counts its unmatched enters and caching threads; the
+/// release that drops the count to zero unlinks it and retires it through <see cref="EpochReclamation"/>, so the table
+/// only holds objects that are locked or recently locked.
+/// </summary>
+class Monitor {
+public:
+    static void Enter(const void* obj) {
+        Acquire(obj).Enter();
+    }
+
+    static void Enter(const void* obj, bool& lockTaken) {
+        Acquire(obj).Enter();
+        lockTaken = true;
+    }
+
+    static bool TryEnter(const void* obj) {
+        return TryEnter(obj, 0);
+    }
+
+    static bool TryEnter(const void* obj, int32_t millisecondsTimeout) {
+        MonitorLock& lock = Acquire(obj);
+        if (lock.TryEnter(millisecondsTimeout)) {
+            return true;
+        }
+
+        Release(obj, lock);
+        return false;
+    }
+
+    static void TryEnter(const void* obj, bool& lockTaken) {
+        lockTaken = TryEnter(obj, 0);
+    }
+
+    static void TryEnter(const void* obj, int32_t millisecondsTimeout, bool& lockTaken) {
+        lockTaken = TryEnter(obj, millisecondsTimeout);
+    }
+
+    static void Exit(const void* obj) {
+        WithExisting(obj, [obj](MonitorLock* lock) {
+            if (lock == nullptr) {
+                ThrowNotEntered();
+            }
+
+            lock->Exit();
+            Release(obj, *lock);
+        });
+    }
+
+    static bool IsEntered(const void* obj) {
+        return WithExisting(obj, [](MonitorLock* lock) {
+            return lock != nullptr && lock->IsEntered();
+        });
+    }
+
+    static bool Wait(const void* obj) {
+        return Wait(obj, -1);
+    }
+
+    static bool Wait(const void* obj, int32_t millisecondsTimeout) {
+        // Only the ownership check runs under the lookup's guard: an owner keeps its monitor alive, and pinning the epoch
+        // for the whole wait would stall reclamation.
+        MonitorLock* lock = WithExisting(obj, [](MonitorLock* existing) {
+            if (existing == nullptr) {
+                ThrowNotEntered();
+            }
+
+            existing->ThrowIfNotOwner();
+            return existing;
+        });
+        return lock->Wait(millisecondsTimeout);
+    }
+
+    static void Pulse(const void* obj) {
+        WithExisting(obj, [](MonitorLock* lock) {
+            if (lock == nullptr) {
+                ThrowNotEntered();
+            }
+
+            lock->Pulse();
+        });
+    }
+
+    static void PulseAll(const void* obj) {
+        WithExisting(obj, [](MonitorLock* lock) {
+            if (lock == nullptr) {
+                ThrowNotEntered();
+            }
+
+            lock->PulseAll();
+        });
+    }
+
+    /// <summary>
+    /// Finds or creates the monitor for <paramref name="obj"/> and counts the caller as a user, so the monitor stays
+    /// alive until the matching <see cref="Release"/>.
+    /// </summary>
+    static MonitorLock& Acquire(const void* obj) {
+        if (obj == nullptr) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+            throw ArgumentNullException();
+#else
+            throw ArgumentNullException("obj");
+#endif
+        }
+
+        LastMonitor& last = LastResolved();
+        if (last.Object == obj) {
+            // The cache's own count keeps the monitor from being retired, so this cannot race with removal.
+            last.Lock->users.fetch_add(1, std::memory_order_relaxed);
+            return *last.Lock;
+        }
+
+        MonitorLock* lock;
+        {
+            EpochReclamation::Guard guard;
+            ConcurrentDictionary<const void*, MonitorLock*>& table = Table();
+            for (;;) {
+                lock = nullptr;
+                if (!table.TryGetValue(obj, lock)) {
+                    MonitorLock* created = new MonitorLock();
+                    lock = table.GetOrAdd(obj, created);
+                    if (lock != created) {
+                        delete created;
+                    }
+                }
+
+                // A retired monitor is about to be unlinked by the thread that retired it; look again until it is.
+                if (lock->TryAddUser()) {
+                    break;
+                }
+            }
+        }
+
+        lock->users.fetch_add(1, std::memory_order_relaxed);
+        last.Replace(obj, lock);
+        return *lock;
+    }
+
+    /// <summary>
+    /// Drops a use counted by <see cref="Acquire"/>; the last one unlinks the monitor and retires it.
+    /// </summary>
+    static void Release(const void* obj, MonitorLock& lock) {
+        if (lock.ReleaseUser()) {
+            Table().TryRemove(obj);
+            EpochReclamation::Retire(&lock);
+        }
+    }
+
+private:
+    /// <summary>
+    /// The calling thread's most recently acquired monitor, holding one user count so it cannot be retired while cached.
+    /// </summary>
+    struct LastMonitor {
+        const void* Object = nullptr;
+        MonitorLock* Lock = nullptr;
+
+        LastMonitor() {
+            // Touching the epoch record first makes it outlive this cache, whose destructor may retire a monitor.
+            EpochReclamation::Guard guard;
+        }
+
+        ~LastMonitor() {
+            Replace(nullptr, nullptr);
+        }
+
+        void Replace(const void* object, MonitorLock* lock) {
+            const void* previousObject = Object;
+            MonitorLock* previousLock = Lock;
+            Object = object;
+            Lock = lock;
+            if (previousLock != nullptr) {
+                Release(previousObject, *previousLock);
+            }
+        }
+    };
+
+    static LastMonitor& LastResolved() {
+#if HE_CPP_FUTEX_THREADED
+        static thread_local LastMonitor last;
+#else
+        static LastMonitor last;
+#endif
+        return last;
+    }
+
+    /// <summary>
+    /// Runs <paramref name="action"/> with the existing monitor of <paramref name="obj"/>, or with null when it has none,
+    /// without creating one. The cached monitor is kept alive by the cache; any other is read under an epoch guard.
+    /// </summary>
+    template <typename TAction>
+    static std::invoke_result_t<TAction&, MonitorLock*> WithExisting(const void* obj, TAction action) {
+        if (obj == nullptr) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+            throw ArgumentNullException();
+#else
+            throw ArgumentNullException("obj");
+#endif
+        }
+
+        LastMonitor& last = LastResolved();
+        if (last.Object == obj) {
+            return action(last.Lock);
+        }
+
+        EpochReclamation::Guard guard;
+        MonitorLock* lock = nullptr;
+        return action(Table().TryGetValue(obj, lock) ? lock : nullptr);
+    }
+
+    [[noreturn]] static void ThrowNotEntered() {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+        throw SynchronizationLockException();
+#else
+        throw SynchronizationLockException("Object synchronization method was called from an unsynchronized block of code.");
+#endif
+    }
+
+    static ConcurrentDictionary<const void*, MonitorLock*>& Table() {
+        // Deliberately leaked so objects locked from static destructors still find their monitors.
+        static ConcurrentDictionary<const void*, MonitorLock*>* table = new ConcurrentDictionary<const void*, MonitorLock*>();
+        return *table;
+    }
+};
+
+/// <summary>
+/// Scope guard that generated code wraps around the body of a C# lock statement: it enters the object's monitor on
+/// construction and exits it when the scope unwinds, including through an exception.
+/// </summary>
+class MonitorLockScope {
+public:
+    explicit MonitorLockScope(const void* obj)
+        : object(obj), lock(Monitor::Acquire(obj)) {
+        lock.Enter();
+    }
+
+    /// <summary>
+    /// Locks a value-form object (such as a lowered string) by its address.
+    /// </summary>
+    template <typename T>
+        requires (!std::is_pointer_v<T> && !std::is_null_pointer_v<T>)
+    explicit MonitorLockScope(const T& obj)
+        : MonitorLockScope(static_cast<const void*>(&obj)) {
+    }
+
+    /// <summary>
+    /// A temporary dies before the scope ends, so locking one would key the monitor on a dangling address.
+    /// </summary>
+    template <typename T>
+        requires (!std::is_pointer_v<T> && !std::is_null_pointer_v<T>)
+    explicit MonitorLockScope(const T&& obj) = delete;
+
+    ~MonitorLockScope() {
+        lock.Exit();
+        Monitor::Release(object, lock);
+    }
+
+    MonitorLockScope(const MonitorLockScope&) = delete;
+    MonitorLockScope& operator=(const MonitorLockScope&) = delete;
+
+private:
+    const void* object;
+    MonitorLock& lock;
+};
+
+#endif
@@ -0,0 +1,240 @@
+#ifndef HE_CPP_SYSTEM_THREADING_READER_WRITER_LOCK_SLIM_HPP
+#define HE_CPP_SYSTEM_THREADING_READER_WRITER_LOCK_SLIM_HPP
+
+#include "helcpp_config.hpp"
+#include "runtime/native_exceptions.hpp"
+#include "system/threading/futex.hpp"
+#include <atomic>
+#include <cstdint>
+
+/// <summary>
+/// Managed ReaderWriterLockSlim in the default no-recursion policy. The whole lock is one futex word holding the
+/// reader count, the number of waiting writers, and the writer bit, so a read lock is one compare-exchange and every
+/// state change is visible to parked threads. Writers take priority: once one is waiting, new readers queue behind it.
+/// One upgradeable reader at a time may hold a read lock and later convert it into the write lock.
+/// </summary>
+class ReaderWriterLockSlim {
+public:
+    ReaderWriterLockSlim()
+        : state(0), upgradeGate(0), parked(0), writerOwner(0), upgradeOwner(0) {
+    }
+
+    ReaderWriterLockSlim(const ReaderWriterLockSlim&) = delete;
+    ReaderWriterLockSlim& operator=(const ReaderWriterLockSlim&) = delete;
+
+    void EnterReadLock() {
+        TryEnterReadLock(-1);
+    }
+
+    bool TryEnterReadLock(int32_t millisecondsTimeout) {
+        if (TryAcquireRead()) {
+            return true;
+        }
+
+        return WaitUntilAcquired(state, FutexTimeout::FromMilliseconds(millisecondsTimeout), millisecondsTimeout != 0, [this]() {
+            return TryAcquireRead();
+        });
+    }
+
+    void ExitReadLock() {
+        uint32_t current = state.load(std::memory_order_relaxed);
+        do {
+            if ((current & ReaderMask) == 0) {
+                ThrowNotHeld();
+            }
+        } while (!state.compare_exchange_weak(current, current - 1, std::memory_order_seq_cst, std::memory_order_relaxed));
+
+        // Parked readers only wait on writers, so a reader leaving matters only to a writer waiting for the last
+        // reader, or to an upgrader waiting to be the last one.
+        if ((current & WaiterMask) != 0 && (current & ReaderMask) <= 2) {
+            WakeParked(state);
+        }
+    }
+
+    void EnterWriteLock() {
+        TryEnterWriteLock(-1);
+    }
+
+    bool TryEnterWriteLock(int32_t millisecondsTimeout) {
+        const uintptr_t self = Futex::CurrentThreadToken();
+        const bool upgrading = upgradeOwner.load(std::memory_order_relaxed) == self;
+        uint32_t expected = 0;
+        if (!upgrading && state.compare_exchange_strong(expected, WriterHeld, std::memory_order_acquire, std::memory_order_relaxed)) {
+            writerOwner.store(self, std::memory_order_relaxed);
+            return true;
+        }
+
+        // Announcing the waiting writer turns away new readers until this writer gets in or gives up.
+        state.fetch_add(WaiterUnit, std::memory_order_seq_cst);
+        const uint32_t ownReaders = upgrading ? 1u : 0u;
+        const bool acquired = WaitUntilAcquired(state, FutexTimeout::FromMilliseconds(millisecondsTimeout), millisecondsTimeout != 0, [this, ownReaders]() {
+            uint32_t current = state.load(std::memory_order_relaxed);
+            while ((current & WriterHeld) == 0 && (current & ReaderMask) == ownReaders) {
+                if (state.compare_exchange_weak(current, (current - WaiterUnit - ownReaders) | WriterHeld, std::memory_order_acquire, std::memory_order_relaxed)) {
+                    return true;
+                }
+            }
+
+            return false;
+        });
+
+        if (!acquired) {
+            state.fetch_sub(WaiterUnit, std::memory_order_seq_cst);
+            WakeParked(state);
+            return false;
+        }
+
+        writerOwner.store(self, std::memory_order_relaxed);
+        return true;
+    }
+
+    void ExitWriteLock() {
+        const uintptr_t self = Futex::CurrentThreadToken();
+        if (writerOwner.load(std::memory_order_relaxed) != self) {
+            ThrowNotHeld();
+        }
+
+        writerOwner.store(0, std::memory_order_relaxed);
+        if (upgradeOwner.load(std::memory_order_relaxed) == self) {
+            // An upgraded writer steps back down to the read lock it entered with.
+            state.fetch_add(1u - WriterHeld, std::memory_order_seq_cst);
+        } else {
+            state.fetch_sub(WriterHeld, std::memory_order_seq_cst);
+        }
+
+        WakeParked(state);
+    }
+
+    void EnterUpgradeableReadLock() {
+        TryEnterUpgradeableReadLock(-1);
+    }
+
+    bool TryEnterUpgradeableReadLock(int32_t millisecondsTimeout) {
+        const FutexTimeout timeout = FutexTimeout::FromMilliseconds(millisecondsTimeout);
+        const bool spin = millisecondsTimeout != 0;
+        uint32_t expected = 0;
+        if (!upgradeGate.compare_exchange_strong(expected, 1, std::memory_order_acquire, std::memory_order_relaxed) &&
+            !WaitUntilAcquired(upgradeGate, timeout, spin, [this]() {
+                uint32_t free = 0;
+                return upgradeGate.compare_exchange_strong(free, 1, std::memory_order_acquire, std::memory_order_relaxed);
+            })) {
+            return false;
+        }
+
+        if (!TryAcquireRead() && !WaitUntilAcquired(state, timeout, spin, [this]() { return TryAcquireRead(); })) {
+            ReleaseUpgradeGate();
+            return false;
+        }
+
+        upgradeOwner.store(Futex::CurrentThreadToken(), std::memory_order_relaxed);
+        return true;
+    }
+
+    void ExitUpgradeableReadLock() {
+        if (upgradeOwner.load(std::memory_order_relaxed) != Futex::CurrentThreadToken()) {
+            ThrowNotHeld();
+        }
+
+        upgradeOwner.store(0, std::memory_order_relaxed);
+        ExitReadLock();
+        ReleaseUpgradeGate();
+    }
+
+    bool get_IsWriteLockHeld() const {
+        return writerOwner.load(std::memory_order_relaxed) == Futex::CurrentThreadToken();
+    }
+
+    bool get_IsUpgradeableReadLockHeld() const {
+        return upgradeOwner.load(std::memory_order_relaxed) == Futex::CurrentThreadToken();
+    }
+
+    int32_t get_CurrentReadCount() const {
+        return static_cast<int32_t>(state.load(std::memory_order_relaxed) & ReaderMask);
+    }
+
+    int32_t get_WaitingWriteCount() const {
+        return static_cast<int32_t>((state.load(std::memory_order_relaxed) & WaiterMask) / WaiterUnit);
+    }
+
+    void Dispose() {
+    }
+
+private:
+    static constexpr uint32_t ReaderMask = 0x0000FFFFu;
+    static constexpr uint32_t WaiterUnit = 0x00010000u;
+    static constexpr uint32_t WaiterMask = 0x7FFF0000u;
+    static constexpr uint32_t WriterHeld = 0x80000000u;
+
+    bool TryAcquireRead() {
+        uint32_t current = state.load(std::memory_order_relaxed);
+        while ((current & (WriterHeld | WaiterMask)) == 0 && (current & ReaderMask) != ReaderMask) {
+            if (state.compare_exchange_weak(current, current + 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /// <summary>
+    /// Spins, then parks on <paramref name="word"/> until <paramref name="tryAcquire"/> succeeds or the timeout passes.
+    /// The parked count is raised before the word is sampled, pairing with the sequentially consistent state change and
+    /// parked-count check in every release path.
+    /// </summary>
+    template <typename TTryAcquire>
+    bool WaitUntilAcquired(std::atomic<uint32_t>& word, const FutexTimeout& timeout, bool spin, TTryAcquire tryAcquire) {
+        if (spin) {
+            for (int32_t iteration = 0; iteration < HE_CPP_FUTEX_SPIN_COUNT; ++iteration) {
+                Futex::SpinPause(iteration);
+                if (tryAcquire()) {
+                    return true;
+                }
+            }
+        }
+
+        parked.fetch_add(1, std::memory_order_seq_cst);
+        bool acquired = false;
+        for (;;) {
+            const uint32_t observed = word.load(std::memory_order_seq_cst);
+            if (tryAcquire()) {
+                acquired = true;
+                break;
+            }
+
+            if (!Futex::Wait(word, observed, timeout)) {
+                acquired = tryAcquire();
+                break;
+            }
+        }
+
+        parked.fetch_sub(1, std::memory_order_relaxed);
+        return acquired;
+    }
+
+    void WakeParked(std::atomic<uint32_t>& word) {
+        if (parked.load(std::memory_order_seq_cst) != 0) {
+            Futex::WakeAll(word);
+        }
+    }
+
+    void ReleaseUpgradeGate() {
+        upgradeGate.store(0, std::memory_order_seq_cst);
+        WakeParked(upgradeGate);
+    }
+
+    [[noreturn]] static void ThrowNotHeld() {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+        throw SynchronizationLockException();
+#else
+        throw SynchronizationLockException("The lock is being released without being held.");
+#endif
+    }
+
+    std::atomic<uint32_t> state;
+    std::atomic<uint32_t> upgradeGate;
+    std::atomic<uint32_t> parked;
+    std::atomic<uintptr_t> writerOwner;
+    std::atomic<uintptr_t> upgradeOwner;
+};
+
+#endif
@@ -0,0 +1,216 @@
+#ifndef HE_CPP_SYSTEM_THREADING_SEMAPHORE_SLIM_HPP
+#define HE_CPP_SYSTEM_THREADING_SEMAPHORE_SLIM_HPP
+
+#include "helcpp_config.hpp"
+#include "runtime/native_exceptions.hpp"
+#include "system/threading/futex.hpp"
+#include "system/threading/tasks/task.hpp"
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#if HE_CPP_FUTEX_THREADED
+#include <mutex>
+#endif
+
+/// <summary>
+/// Task handed to an asynchronous SemaphoreSlim waiter and completed by the Release that grants its permit.
+/// </summary>
+class SemaphoreSlimWaitPromise final : public Task {
+public:
+    SemaphoreSlimWaitPromise()
+        : Task(TaskStatus::WaitingForActivation) {
+    }
+
+    void Complete() {
+        if (TryReserveCompletion()) {
+            FinishCompletion(TaskStatus::RanToCompletion);
+        }
+    }
+};
+
+/// <summary>
+/// Managed SemaphoreSlim whose count is the futex word itself. Wait takes a permit with one compare-exchange, spins
+/// briefly while the count is zero, then parks on the word; Release wakes parked threads only when one has registered.
+/// Asynchronous waiters queue under a mutex that Release touches only while at least one of them is pending.
+/// </summary>
+class SemaphoreSlim {
+public:
+    explicit SemaphoreSlim(int32_t initialCount)
+        : SemaphoreSlim(initialCount, INT32_MAX) {
+    }
+
+    SemaphoreSlim(int32_t initialCount, int32_t maxCount)
+        : count(static_cast<uint32_t>(initialCount < 0 ? 0 : initialCount)), waiters(0), asyncWaiterCount(0), maxCount(maxCount) {
+        if (maxCount <= 0 || initialCount < 0 || initialCount > maxCount) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+            throw ArgumentOutOfRangeException();
+#else
+            throw ArgumentOutOfRangeException("initialCount", "The initial count must be between zero and a positive maximum count.");
+#endif
+        }
+    }
+
+    SemaphoreSlim(const SemaphoreSlim&) = delete;
+    SemaphoreSlim& operator=(const SemaphoreSlim&) = delete;
+
+    int32_t get_CurrentCount() const {
+        return static_cast<int32_t>(count.load(std::memory_order_acquire));
+    }
+
+    void Wait() {
+        Wait(-1);
+    }
+
+    /// <summary>
+    /// Takes one permit, blocking while none is available.
+    /// </summary>
+    /// <param name="millisecondsTimeout">Timeout in milliseconds, or -1 to wait indefinitely.</param>
+    /// <returns><c>true</c> when a permit was taken before the timeout.</returns>
+    bool Wait(int32_t millisecondsTimeout) {
+        if (TryAcquire()) {
+            return true;
+        }
+
+        const FutexTimeout timeout = FutexTimeout::FromMilliseconds(millisecondsTimeout);
+        if (millisecondsTimeout != 0) {
+            for (int32_t iteration = 0; iteration < HE_CPP_FUTEX_SPIN_COUNT; ++iteration) {
+                Futex::SpinPause(iteration);
+                if (TryAcquire()) {
+                    return true;
+                }
+            }
+        }
+
+        waiters.fetch_add(1, std::memory_order_seq_cst);
+        bool acquired = false;
+        for (;;) {
+            if (TryAcquire()) {
+                acquired = true;
+                break;
+            }
+
+            if (!Futex::Wait(count, 0, timeout)) {
+                acquired = TryAcquire();
+                break;
+            }
+        }
+
+        waiters.fetch_sub(1, std::memory_order_relaxed);
+        return acquired;
+    }
+
+    /// <summary>
+    /// Takes one permit asynchronously. The returned task is already complete when a permit was free; otherwise a later
+    /// Release completes it, running its continuations on the releasing thread.
+    /// </summary>
+    Task* WaitAsync() {
+        if (TryAcquire()) {
+            return Task::get_CompletedTask();
+        }
+
+#if HE_CPP_FUTEX_THREADED
+        std::lock_guard<std::mutex> lock(asyncMutex);
+#endif
+        // Registering before the retry pairs with Release, which adds its permits before it checks for async waiters:
+        // either the retry sees the permit or Release sees this waiter and serves the queue under the same mutex.
+        asyncWaiterCount.fetch_add(1, std::memory_order_seq_cst);
+        if (TryAcquire()) {
+            asyncWaiterCount.fetch_sub(1, std::memory_order_relaxed);
+            return Task::get_CompletedTask();
+        }
+
+        SemaphoreSlimWaitPromise* promise = new SemaphoreSlimWaitPromise();
+        asyncWaiters.push_back(promise);
+        return promise;
+    }
+
+    int32_t Release() {
+        return Release(1);
+    }
+
+    /// <summary>
+    /// Returns <paramref name="releaseCount"/> permits and wakes waiters that can take them.
+    /// </summary>
+    /// <returns>The count before the release.</returns>
+    int32_t Release(int32_t releaseCount) {
+        if (releaseCount < 1) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+            throw ArgumentOutOfRangeException();
+#else
+            throw ArgumentOutOfRangeException("releaseCount", "The release count must be positive.");
+#endif
+        }
+
+        uint32_t previous = count.load(std::memory_order_relaxed);
+        do {
+            if (static_cast<int64_t>(previous) + releaseCount > maxCount) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+                throw SemaphoreFullException();
+#else
+                throw SemaphoreFullException("Adding the specified count to the semaphore would cause it to exceed its maximum count.");
+#endif
+            }
+        } while (!count.compare_exchange_weak(previous, previous + static_cast<uint32_t>(releaseCount), std::memory_order_seq_cst, std::memory_order_relaxed));
+
+        if (waiters.load(std::memory_order_seq_cst) != 0) {
+            if (releaseCount == 1) {
+                Futex::WakeOne(count);
+            } else {
+                Futex::WakeAll(count);
+            }
+        }
+
+        if (asyncWaiterCount.load(std::memory_order_seq_cst) != 0) {
+            GrantAsyncWaiters();
+        }
+
+        return static_cast<int32_t>(previous);
+    }
+
+    void Dispose() {
+    }
+
+private:
+    bool TryAcquire() {
+        uint32_t current = count.load(std::memory_order_seq_cst);
+        while (current != 0) {
+            if (count.compare_exchange_weak(current, current - 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void GrantAsyncWaiters() {
+        std::vector<SemaphoreSlimWaitPromise*> granted;
+        {
+#if HE_CPP_FUTEX_THREADED
+            std::lock_guard<std::mutex> lock(asyncMutex);
+#endif
+            while (!asyncWaiters.empty() && TryAcquire()) {
+                granted.push_back(asyncWaiters.front());
+                asyncWaiters.pop_front();
+                asyncWaiterCount.fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+
+        // Completed outside the mutex because continuations run inline and may wait on or release this semaphore.
+        for (SemaphoreSlimWaitPromise* promise : granted) {
+            promise->Complete();
+        }
+    }
+
+    std::atomic<uint32_t> count;
+    std::atomic<uint32_t> waiters;
+    std::atomic<uint32_t> asyncWaiterCount;
+    const int32_t maxCount;
+#if HE_CPP_FUTEX_THREADED
+    std::mutex asyncMutex;
+#endif
+    std::deque<SemaphoreSlimWaitPromise*> asyncWaiters;
+};
+
+#endif
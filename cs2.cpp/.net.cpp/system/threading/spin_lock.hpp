@@ -1,10 +1,86 @@
 #pragma once
 
+#include "helcpp_config.hpp"
 #include <atomic>
+#include <cstdint>
 $GENERATED_FUNCTION_PROFILING_SPIN_LOCK_INCLUDE$
 
+#if HE_CPP_PLATFORM_PS2 || HE_CPP_PLATFORM_N64 || HE_CPP_PLATFORM_DS || HE_CPP_RUNTIME_CUSTOM_RETRO
+#define HE_CPP_SPIN_LOCK_THREADED 0
+#else
+#define HE_CPP_SPIN_LOCK_THREADED 1
+#endif
+
+#if HE_CPP_SPIN_LOCK_THREADED
+#include <thread>
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#elif defined(_MSC_VER) && (defined(_M_ARM64) || defined(_M_ARM))
+#include <intrin.h>
+#endif
+#endif
+
+/// <summary>
+/// Backoff rounds spent pausing on the lock's cache line before a contended Enter starts yielding its time slice. Each
+/// round doubles the pause count up to <see cref="HE_CPP_SPIN_LOCK_MAX_PAUSES"/>.
+/// </summary>
+#ifndef HE_CPP_SPIN_LOCK_SPIN_ROUNDS
+#define HE_CPP_SPIN_LOCK_SPIN_ROUNDS 10
+#endif
+
+/// <summary>
+/// Largest number of pause instructions issued in one backoff round.
+/// </summary>
+#ifndef HE_CPP_SPIN_LOCK_MAX_PAUSES
+#define HE_CPP_SPIN_LOCK_MAX_PAUSES 64
+#endif
+
+/// <summary>
+/// Yields a contended Enter performs after spinning before it parks in the OS until the holder exits.
+/// </summary>
+#ifndef HE_CPP_SPIN_LOCK_YIELD_ROUNDS
+#define HE_CPP_SPIN_LOCK_YIELD_ROUNDS 4
+#endif
+
+/// <summary>
+/// Enables per-lock contention counters. Profiling-enabled conversions turn them on through the profiling include hook
+/// and plot the backoff each contended Enter spent next to the Tracy lock events.
+/// </summary>
+#ifndef HE_CPP_SPIN_LOCK_STATISTICS
+#define HE_CPP_SPIN_LOCK_STATISTICS 0
+#endif
+
 /// <summary>
-/// Represents the managed SpinLock helper surface expected by transpiled multithreaded coordination code.
+/// Snapshot of one lock's contention counters. Only the slow path updates them, so an uncontended lock reports zeros.
+/// </summary>
+struct SpinLockStatistics {
+    /// <summary>
+    /// Enter calls that found the lock held.
+    /// </summary>
+    uint64_t ContendedEnters = 0;
+
+    /// <summary>
+    /// Backoff rounds spent pausing before the lock was acquired.
+    /// </summary>
+    uint64_t SpinRounds = 0;
+
+    /// <summary>
+    /// Time slices yielded while waiting.
+    /// </summary>
+    uint64_t Yields = 0;
+
+    /// <summary>
+    /// Times a waiter parked in the OS.
+    /// </summary>
+    uint64_t Parks = 0;
+};
+
+/// <summary>
+/// Represents the managed SpinLock helper surface expected by transpiled multithreaded coordination code. Enter is a
+/// test-and-test-and-set lock: waiters read the flag until it looks free instead of hammering it with exchanges, pause
+/// between reads with exponential backoff so a hyperthread sibling keeps its execution resources, then yield, and
+/// finally park on the flag through the C++20 atomic wait (a futex on Linux) so a lock held across a preemption does
+/// not burn whole cores.
 /// </summary>
 class SpinLock {
 public:
@@ -21,7 +97,10 @@ public:
     /// <param name="lockTaken">Receives <c>true</c> once the lock has been acquired.</param>
     void Enter(bool& lockTaken) {
         $GENERATED_FUNCTION_PROFILING_SPIN_LOCK_BEFORE_ENTER$
-        while (Locked.exchange(true, std::memory_order_acquire)) {
+        if (!TryAcquire()) {
+            $GENERATED_FUNCTION_PROFILING_SPIN_LOCK_BEFORE_CONTENDED_ENTER$
+            EnterContended();
+            $GENERATED_FUNCTION_PROFILING_SPIN_LOCK_AFTER_CONTENDED_ENTER$
         }
 
         $GENERATED_FUNCTION_PROFILING_SPIN_LOCK_AFTER_ENTER$
@@ -29,14 +108,122 @@ public:
     }
 
     /// <summary>
-    /// Releases the lock.
+    /// Releases the lock and wakes one parked waiter, if any.
     /// </summary>
     void Exit() {
+#if HE_CPP_SPIN_LOCK_THREADED
+        // Sequentially consistent so the parked-waiter check cannot be ordered before the release; otherwise a waiter
+        // that parks in between would sleep through the unlock.
+        Locked.store(false, std::memory_order_seq_cst);
+        if (ParkedWaiters.load(std::memory_order_seq_cst) != 0) {
+            Locked.notify_one();
+        }
+#else
         Locked.store(false, std::memory_order_release);
+#endif
         $GENERATED_FUNCTION_PROFILING_SPIN_LOCK_AFTER_EXIT$
     }
 
+    /// <summary>
+    /// Gets whether any thread currently holds the lock.
+    /// </summary>
+    bool get_IsHeld() const {
+        return Locked.load(std::memory_order_relaxed);
+    }
+
+    /// <summary>
+    /// Reads this lock's contention counters; all zero unless HE_CPP_SPIN_LOCK_STATISTICS is enabled.
+    /// </summary>
+    SpinLockStatistics GetStatistics() const {
+        SpinLockStatistics statistics;
+#if HE_CPP_SPIN_LOCK_STATISTICS
+        statistics.ContendedEnters = ContendedEnters.load(std::memory_order_relaxed);
+        statistics.SpinRounds = SpinRounds.load(std::memory_order_relaxed);
+        statistics.Yields = Yields.load(std::memory_order_relaxed);
+        statistics.Parks = Parks.load(std::memory_order_relaxed);
+#endif
+        return statistics;
+    }
+
 private:
+    bool TryAcquire() {
+        return !Locked.load(std::memory_order_relaxed) && !Locked.exchange(true, std::memory_order_acquire);
+    }
+
+    static void Pause() {
+#if HE_CPP_SPIN_LOCK_THREADED
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+        _mm_pause();
+#elif defined(_MSC_VER) && (defined(_M_ARM64) || defined(_M_ARM))
+        __yield();
+#elif defined(__aarch64__) || defined(__arm__)
+        __asm__ __volatile__("yield");
+#endif
+#endif
+    }
+
+    void EnterContended() {
+#if HE_CPP_SPIN_LOCK_STATISTICS
+        ContendedEnters.fetch_add(1, std::memory_order_relaxed);
+#endif
+        int32_t pauses = 1;
+        for (int32_t round = 0; round < HE_CPP_SPIN_LOCK_SPIN_ROUNDS; ++round) {
+#if HE_CPP_SPIN_LOCK_STATISTICS
+            SpinRounds.fetch_add(1, std::memory_order_relaxed);
+#endif
+            for (int32_t index = 0; index < pauses; ++index) {
+                Pause();
+            }
+
+            if (TryAcquire()) {
+                return;
+            }
+
+            if (pauses < HE_CPP_SPIN_LOCK_MAX_PAUSES) {
+                pauses *= 2;
+            }
+        }
+
+#if HE_CPP_SPIN_LOCK_THREADED
+        for (int32_t round = 0; round < HE_CPP_SPIN_LOCK_YIELD_ROUNDS; ++round) {
+#if HE_CPP_SPIN_LOCK_STATISTICS
+            Yields.fetch_add(1, std::memory_order_relaxed);
+#endif
+            std::this_thread::yield();
+            if (TryAcquire()) {
+                return;
+            }
+        }
+
+        for (;;) {
+            ParkedWaiters.fetch_add(1, std::memory_order_seq_cst);
+            if (Locked.load(std::memory_order_seq_cst)) {
+#if HE_CPP_SPIN_LOCK_STATISTICS
+                Parks.fetch_add(1, std::memory_order_relaxed);
+#endif
+                Locked.wait(true, std::memory_order_relaxed);
+            }
+
+            ParkedWaiters.fetch_sub(1, std::memory_order_relaxed);
+            if (TryAcquire()) {
+                return;
+            }
+        }
+#else
+        while (!TryAcquire()) {
+        }
+#endif
+    }
+
     std::atomic<bool> Locked;
+#if HE_CPP_SPIN_LOCK_THREADED
+    std::atomic<int32_t> ParkedWaiters { 0 };
+#endif
+#if HE_CPP_SPIN_LOCK_STATISTICS
+    std::atomic<uint64_t> ContendedEnters { 0 };
+    std::atomic<uint64_t> SpinRounds { 0 };
+    std::atomic<uint64_t> Yields { 0 };
+    std::atomic<uint64_t> Parks { 0 };
+#endif
     $GENERATED_FUNCTION_PROFILING_SPIN_LOCK_FIELD$
 };
@@ -0,0 +1,190 @@
+#ifndef HE_CPP_SYSTEM_THREADING_TASKS_COROUTINE_FRAME_ALLOCATOR_HPP
+#define HE_CPP_SYSTEM_THREADING_TASKS_COROUTINE_FRAME_ALLOCATOR_HPP
+
+#include "helcpp_config.hpp"
+#include "system/threading/thread_pool.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+#if HE_CPP_THREAD_POOL_THREADED
+#include <mutex>
+#endif
+
+/// <summary>
+/// Largest coroutine frame served from the pool; larger frames go straight to the global heap.
+/// </summary>
+#ifndef HE_CPP_COROUTINE_FRAME_POOL_MAX_SIZE
+#define HE_CPP_COROUTINE_FRAME_POOL_MAX_SIZE 4096
+#endif
+
+/// <summary>
+/// Pooled storage for the coroutine frames of lowered async methods. Frames are rounded up to power-of-two size classes
+/// and recycled through per-thread free lists, so an await-heavy loop reuses the same few blocks instead of paying a
+/// general heap allocation per call. Frames often finish on a different pool thread than the one that started them, so
+/// a thread whose list grows past its limit spills half of it to one shared list that other threads refill from in
+/// batches. Retro targets without threads keep a single set of lists.
+/// </summary>
+class CoroutineFrameAllocator {
+public:
+    static void* Allocate(size_t size) {
+        const int32_t sizeClass = GetSizeClass(size);
+        if (sizeClass < 0) {
+            return ::operator new(size);
+        }
+
+        ThreadCache& cache = LocalCache();
+        FreeBlock* block = cache.Heads[sizeClass];
+        if (block == nullptr) {
+            block = cache.Refill(sizeClass);
+        }
+
+        if (block == nullptr) {
+            return ::operator new(ClassSize(sizeClass));
+        }
+
+        cache.Heads[sizeClass] = block->Next;
+        --cache.Counts[sizeClass];
+        return block;
+    }
+
+    static void Free(void* frame, size_t size) {
+        const int32_t sizeClass = GetSizeClass(size);
+        if (sizeClass < 0) {
+            ::operator delete(frame);
+            return;
+        }
+
+        ThreadCache& cache = LocalCache();
+        FreeBlock* block = static_cast<FreeBlock*>(frame);
+        block->Next = cache.Heads[sizeClass];
+        cache.Heads[sizeClass] = block;
+        if (++cache.Counts[sizeClass] > CacheLimit) {
+            cache.Spill(sizeClass);
+        }
+    }
+
+private:
+    static constexpr size_t MinClassSize = 64;
+    static constexpr int32_t ClassCount = 7;
+    static constexpr int32_t CacheLimit = 64;
+    static constexpr int32_t RefillBatch = CacheLimit / 2;
+
+    struct FreeBlock {
+        FreeBlock* Next;
+    };
+
+    static constexpr size_t ClassSize(int32_t sizeClass) {
+        return MinClassSize << sizeClass;
+    }
+
+    static int32_t GetSizeClass(size_t size) {
+        if (size > HE_CPP_COROUTINE_FRAME_POOL_MAX_SIZE || size > ClassSize(ClassCount - 1)) {
+            return -1;
+        }
+
+        int32_t sizeClass = 0;
+        while (ClassSize(sizeClass) < size) {
+            ++sizeClass;
+        }
+
+        return sizeClass;
+    }
+
+#if HE_CPP_THREAD_POOL_THREADED
+    /// <summary>
+    /// Shared overflow lists. Blocks move in and out in batches, so the lock is taken once per batch rather than per
+    /// frame.
+    /// </summary>
+    struct SharedLists {
+        std::mutex Mutex;
+        FreeBlock* Heads[ClassCount] = {};
+    };
+
+    static SharedLists& Shared() {
+        // Never destroyed: pool threads can still return frames while static destructors run.
+        static SharedLists* shared = new SharedLists();
+        return *shared;
+    }
+#endif
+
+    struct ThreadCache {
+        FreeBlock* Heads[ClassCount] = {};
+        int32_t Counts[ClassCount] = {};
+
+        ~ThreadCache() {
+            for (int32_t sizeClass = 0; sizeClass < ClassCount; ++sizeClass) {
+#if HE_CPP_THREAD_POOL_THREADED
+                ReturnToShared(sizeClass, Counts[sizeClass]);
+#else
+                while (Heads[sizeClass] != nullptr) {
+                    FreeBlock* block = Heads[sizeClass];
+                    Heads[sizeClass] = block->Next;
+                    ::operator delete(block);
+                }
+#endif
+            }
+        }
+
+        FreeBlock* Refill(int32_t sizeClass) {
+#if HE_CPP_THREAD_POOL_THREADED
+            SharedLists& shared = Shared();
+            std::lock_guard<std::mutex> lock(shared.Mutex);
+            for (int32_t moved = 0; moved < RefillBatch && shared.Heads[sizeClass] != nullptr; ++moved) {
+                FreeBlock* block = shared.Heads[sizeClass];
+                shared.Heads[sizeClass] = block->Next;
+                block->Next = Heads[sizeClass];
+                Heads[sizeClass] = block;
+                ++Counts[sizeClass];
+            }
+#else
+            (void)sizeClass;
+#endif
+            return Heads[sizeClass];
+        }
+
+        void Spill(int32_t sizeClass) {
+#if HE_CPP_THREAD_POOL_THREADED
+            ReturnToShared(sizeClass, Counts[sizeClass] / 2);
+#else
+            FreeBlock* block = Heads[sizeClass];
+            Heads[sizeClass] = block->Next;
+            --Counts[sizeClass];
+            ::operator delete(block);
+#endif
+        }
+
+#if HE_CPP_THREAD_POOL_THREADED
+        void ReturnToShared(int32_t sizeClass, int32_t count) {
+            if (count <= 0) {
+                return;
+            }
+
+            FreeBlock* first = Heads[sizeClass];
+            FreeBlock* last = first;
+            for (int32_t index = 1; index < count; ++index) {
+                last = last->Next;
+            }
+
+            Heads[sizeClass] = last->Next;
+            Counts[sizeClass] -= count;
+
+            SharedLists& shared = Shared();
+            std::lock_guard<std::mutex> lock(shared.Mutex);
+            last->Next = shared.Heads[sizeClass];
+            shared.Heads[sizeClass] = first;
+        }
+#endif
+    };
+
+    static ThreadCache& LocalCache() {
+#if HE_CPP_THREAD_POOL_THREADED
+        static thread_local ThreadCache cache;
+#else
+        static ThreadCache cache;
+#endif
+        return cache;
+    }
+};
+
+#endif // HE_CPP_SYSTEM_THREADING_TASKS_COROUTINE_FRAME_ALLOCATOR_HPP
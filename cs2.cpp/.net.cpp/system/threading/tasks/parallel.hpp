@@ -0,0 +1,239 @@
+#ifndef HE_CPP_SYSTEM_THREADING_TASKS_PARALLEL_HPP
+#define HE_CPP_SYSTEM_THREADING_TASKS_PARALLEL_HPP
+
+#include "helcpp_config.hpp"
+#include "runtime/array.hpp"
+#include "runtime/native_exceptions.hpp"
+#include "runtime/native_read_only_list.hpp"
+#include "system/action.hpp"
+#include "system/threading/thread_pool.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if HE_CPP_THREAD_POOL_THREADED
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+/// <summary>
+/// Mirrors System.Threading.Tasks.ParallelLoopResult. Loops here never break early, so every loop that returns has
+/// completed.
+/// </summary>
+struct ParallelLoopResult {
+    bool get_IsCompleted() const {
+        return true;
+    }
+};
+
+/// <summary>
+/// Data-parallel loops over the work-stealing ThreadPool. The calling thread and up to one helper per pool worker claim
+/// fixed-size chunks of the index range from one shared counter, so uneven iterations balance themselves while each
+/// claim stays a single atomic add. Helpers are stack work items, so a loop allocates nothing beyond the helper list.
+/// With no pool workers the loop runs sequentially on the caller.
+/// </summary>
+class Parallel {
+public:
+    static ParallelLoopResult For(int32_t fromInclusive, int32_t toExclusive, Action<int32_t>* body) {
+        ThrowIfNull(body, "body");
+        RunRange(fromInclusive, toExclusive, [body](int64_t index) {
+            (*body)(static_cast<int32_t>(index));
+        });
+        return ParallelLoopResult();
+    }
+
+    static ParallelLoopResult For(int64_t fromInclusive, int64_t toExclusive, Action<int64_t>* body) {
+        ThrowIfNull(body, "body");
+        RunRange(fromInclusive, toExclusive, [body](int64_t index) {
+            (*body)(index);
+        });
+        return ParallelLoopResult();
+    }
+
+    /// <summary>
+    /// Runs a native callable over the range without a managed delegate, for runtime code and native kernels.
+    /// </summary>
+    template <typename TBody, typename = std::enable_if_t<!std::is_pointer_v<std::decay_t<TBody>>>>
+    static ParallelLoopResult For(int64_t fromInclusive, int64_t toExclusive, TBody&& body) {
+        RunRange(fromInclusive, toExclusive, [&body](int64_t index) {
+            body(index);
+        });
+        return ParallelLoopResult();
+    }
+
+    template <typename T>
+    static ParallelLoopResult ForEach(Array<T>* source, Action<T>* body) {
+        ThrowIfNull(source, "source");
+        ThrowIfNull(body, "body");
+        T* data = source->Data;
+        RunRange(0, source->Length, [data, body](int64_t index) {
+            (*body)(data[index]);
+        });
+        return ParallelLoopResult();
+    }
+
+    template <typename T>
+    static ParallelLoopResult ForEach(const IReadOnlyList<T>* source, Action<T>* body) {
+        ThrowIfNull(source, "source");
+        ThrowIfNull(body, "body");
+        RunRange(0, source->get_Count(), [source, body](int64_t index) {
+            (*body)(source->get_Item(static_cast<int32_t>(index)));
+        });
+        return ParallelLoopResult();
+    }
+
+private:
+    template <typename T>
+    static void ThrowIfNull(const T* value, const char* paramName) {
+        if (value == nullptr) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+            (void)paramName;
+            throw ArgumentNullException();
+#else
+            throw ArgumentNullException(paramName);
+#endif
+        }
+    }
+
+    /// <summary>
+    /// Loop state shared by the caller and its helpers for one call.
+    /// </summary>
+    template <typename TBody>
+    struct LoopState {
+        LoopState(int64_t fromInclusive, int64_t rangeLength, int64_t chunkLength, TBody& loopBody)
+            : From(fromInclusive), Length(rangeLength), Chunk(chunkLength), Body(loopBody), Next(0), Pending(0), Faulted(false) {
+        }
+
+        /// <summary>
+        /// Claims and runs chunks until the range is exhausted or an iteration throws. The first failure stops further
+        /// claims; iterations already running on other threads finish normally.
+        /// </summary>
+        void RunChunks() {
+            try {
+                for (;;) {
+                    if (Faulted.load(std::memory_order_relaxed)) {
+                        return;
+                    }
+
+                    const int64_t start = Next.fetch_add(Chunk, std::memory_order_relaxed);
+                    if (start >= Length) {
+                        return;
+                    }
+
+                    const int64_t end = std::min(start + Chunk, Length);
+                    for (int64_t offset = start; offset < end; ++offset) {
+                        Body(From + offset);
+                    }
+                }
+            } catch (...) {
+                if (!Faulted.exchange(true, std::memory_order_acq_rel)) {
+                    Failure = std::current_exception();
+                }
+            }
+        }
+
+        /// <summary>
+        /// Marks one helper finished. The count drops and the caller is signalled under PendingMutex, which the caller
+        /// takes before leaving, so the last helper is done with this state before the caller's frame can end.
+        /// </summary>
+        void Leave() {
+#if HE_CPP_THREAD_POOL_THREADED
+            std::lock_guard<std::mutex> guard(PendingMutex);
+            if (Pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                PendingSignal.notify_all();
+            }
+#else
+            Pending.fetch_sub(1, std::memory_order_acq_rel);
+#endif
+        }
+
+        /// <summary>
+        /// Returns once every helper has left. Helpers still queued are run here; they find the range exhausted and
+        /// finish immediately.
+        /// </summary>
+        void WaitForHelpers() {
+            while (Pending.load(std::memory_order_acquire) != 0) {
+                if (!ThreadPool::TryExecuteOne()) {
+#if HE_CPP_THREAD_POOL_THREADED
+                    std::unique_lock<std::mutex> lock(PendingMutex);
+                    PendingSignal.wait(lock, [this]() { return Pending.load(std::memory_order_acquire) == 0; });
+#endif
+                }
+            }
+
+#if HE_CPP_THREAD_POOL_THREADED
+            // The count can reach zero while the last helper still holds the mutex to signal.
+            std::lock_guard<std::mutex> guard(PendingMutex);
+#endif
+        }
+
+        const int64_t From;
+        const int64_t Length;
+        const int64_t Chunk;
+        TBody& Body;
+        std::atomic<int64_t> Next;
+        std::atomic<int32_t> Pending;
+        std::atomic<bool> Faulted;
+        std::exception_ptr Failure;
+#if HE_CPP_THREAD_POOL_THREADED
+        std::mutex PendingMutex;
+        std::condition_variable PendingSignal;
+#endif
+    };
+
+    template <typename TBody>
+    struct LoopHelper : ThreadPoolWorkItem {
+        LoopState<TBody>* State = nullptr;
+
+        static void Run(ThreadPoolWorkItem* item) {
+            LoopState<TBody>* state = static_cast<LoopHelper*>(item)->State;
+            state->RunChunks();
+            state->Leave();
+        }
+    };
+
+    template <typename TBody>
+    static void RunRange(int64_t fromInclusive, int64_t toExclusive, TBody body) {
+        if (toExclusive <= fromInclusive) {
+            return;
+        }
+
+        const int64_t length = toExclusive - fromInclusive;
+        const int64_t participants = std::min<int64_t>(static_cast<int64_t>(ThreadPool::get_ThreadCount()) + 1, length);
+        if (participants <= 1) {
+            for (int64_t index = fromInclusive; index < toExclusive; ++index) {
+                body(index);
+            }
+
+            return;
+        }
+
+        // About eight chunks per participant: small enough to rebalance uneven iterations, large enough that the
+        // shared counter is touched rarely.
+        const int64_t chunk = std::max<int64_t>(1, length / (participants * 8));
+        LoopState<TBody> state(fromInclusive, length, chunk, body);
+        std::vector<LoopHelper<TBody>> helpers(static_cast<size_t>(participants - 1));
+        state.Pending.store(static_cast<int32_t>(helpers.size()), std::memory_order_relaxed);
+        for (LoopHelper<TBody>& helper : helpers) {
+            helper.Execute = &LoopHelper<TBody>::Run;
+            helper.State = &state;
+            ThreadPool::Schedule(&helper);
+        }
+
+        state.RunChunks();
+
+        // Helpers reference this frame, so every one must have left before returning.
+        state.WaitForHelpers();
+
+        if (state.Failure) {
+            std::rethrow_exception(state.Failure);
+        }
+    }
+};
+
+#endif // HE_CPP_SYSTEM_THREADING_TASKS_PARALLEL_HPP
@@ -0,0 +1,1055 @@
+#ifndef HE_CPP_SYSTEM_THREADING_TASKS_TASK_HPP
+#define HE_CPP_SYSTEM_THREADING_TASKS_TASK_HPP
+
+#include "helcpp_config.hpp"
+#include "runtime/array.hpp"
+#include "runtime/native_exceptions.hpp"
+#include "system/action.hpp"
+#include "system/func.hpp"
+#include "system/threading/thread_pool.hpp"
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if HE_CPP_THREAD_POOL_THREADED
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+#else
+#include "system/diagnostics/stopwatch.hpp"
+#endif
+
+/// <summary>
+/// Enables lowering of async methods onto C++20 coroutines when the compiler supports them.
+/// </summary>
+#ifndef HE_CPP_TASK_COROUTINES
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+#define HE_CPP_TASK_COROUTINES 1
+#endif
+#endif
+#endif
+
+#ifndef HE_CPP_TASK_COROUTINES
+#define HE_CPP_TASK_COROUTINES 0
+#endif
+
+/// <summary>
+/// Mirrors System.Threading.Tasks.TaskStatus, including the managed numeric values.
+/// </summary>
+enum class TaskStatus : int32_t {
+    Created = 0,
+    WaitingForActivation = 1,
+    WaitingToRun = 2,
+    Running = 3,
+    WaitingForChildrenToComplete = 4,
+    RanToCompletion = 5,
+    Canceled = 6,
+    Faulted = 7
+};
+
+class Task;
+
+template <typename TResult>
+class Task_1;
+
+class TaskYieldAwaitable;
+
+/// <summary>
+/// Intrusive continuation node. Continuations, WhenAll, and WhenAny embed one per antecedent, so attaching a
+/// continuation is one compare-exchange onto the antecedent's list and never allocates.
+/// </summary>
+struct TaskContinuation {
+    TaskContinuation* Next;
+    void (*Invoke)(TaskContinuation* continuation, Task* antecedent);
+};
+
+/// <summary>
+/// Native Task backed by the work-stealing ThreadPool. A task is its own pool work item, so Run and Start schedule it
+/// without a wrapper allocation. Exceptions thrown by the body are captured and rethrown unchanged by Wait and
+/// get_Result; the runtime has no AggregateException, so the first failure is surfaced directly.
+/// </summary>
+class Task : protected ThreadPoolWorkItem {
+public:
+    /// <summary>
+    /// Initializes a task that runs <paramref name="action"/> once started.
+    /// </summary>
+    explicit Task(Action<>* action)
+        : Task(TaskStatus::Created) {
+        if (action == nullptr) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+            throw ArgumentNullException();
+#else
+            throw ArgumentNullException("action");
+#endif
+        }
+
+        body = action;
+    }
+
+    virtual ~Task() = default;
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    /// <summary>
+    /// Queues <paramref name="action"/> on the pool and returns the running task.
+    /// </summary>
+    static Task* Run(Action<>* action) {
+        Task* task = new Task(action);
+        task->Start();
+        return task;
+    }
+
+    /// <summary>
+    /// Queues <paramref name="function"/> on the pool and returns the task that completes with its result.
+    /// </summary>
+    template <typename TResult>
+    static Task_1<TResult>* Run(Func<TResult>* function);
+
+    /// <summary>
+    /// Queues a native callable without wrapping it in a managed delegate.
+    /// </summary>
+    template <typename TCallable, typename = std::enable_if_t<!std::is_pointer_v<std::decay_t<TCallable>> && std::is_invocable_v<std::decay_t<TCallable>&>>>
+    static auto Run(TCallable&& callable);
+
+    /// <summary>
+    /// Returns a task that has already completed with <paramref name="result"/>.
+    /// </summary>
+    template <typename TResult>
+    static Task_1<TResult>* FromResult(TResult result);
+
+    /// <summary>
+    /// Gets a shared task that has already completed successfully.
+    /// </summary>
+    static Task* get_CompletedTask() {
+        static Task completed(TaskStatus::RanToCompletion);
+        return &completed;
+    }
+
+    /// <summary>
+    /// Returns a task that completes when every task in <paramref name="tasks"/> has completed. The task faults with
+    /// the first captured failure if any antecedent faulted.
+    /// </summary>
+    static Task* WhenAll(Array<Task*>* tasks);
+
+    /// <summary>
+    /// Returns a task whose result holds every antecedent result in array order.
+    /// </summary>
+    template <typename TResult>
+    static Task_1<Array<TResult>*>* WhenAll(Array<Task_1<TResult>*>* tasks);
+
+    /// <summary>
+    /// Returns a task that completes with the first task in <paramref name="tasks"/> to complete.
+    /// </summary>
+    static Task_1<Task*>* WhenAny(Array<Task*>* tasks);
+
+    template <typename TResult>
+    static Task_1<Task_1<TResult>*>* WhenAny(Array<Task_1<TResult>*>* tasks);
+
+    /// <summary>
+    /// Waits for every task in <paramref name="tasks"/>, rethrowing the first failure after all have completed.
+    /// </summary>
+    static void WaitAll(Array<Task*>* tasks) {
+        WhenAll(tasks)->Wait();
+    }
+
+    /// <summary>
+    /// Waits for any task in <paramref name="tasks"/> and returns its index.
+    /// </summary>
+    static int32_t WaitAny(Array<Task*>* tasks);
+
+    /// <summary>
+    /// Returns a task that completes after <paramref name="millisecondsDelay"/> milliseconds without holding a pool
+    /// thread; -1 never completes. Targets without threads have nothing else to run meanwhile, so the delay elapses on
+    /// the calling thread and the returned task is already complete.
+    /// </summary>
+    static Task* Delay(int32_t millisecondsDelay);
+
+#if HE_CPP_TASK_COROUTINES
+    /// <summary>
+    /// Returns an awaitable that resumes the awaiting coroutine as a new pool work item.
+    /// </summary>
+    static TaskYieldAwaitable Yield();
+#endif
+
+    /// <summary>
+    /// Schedules a task created by the constructor.
+    /// </summary>
+    void Start() {
+        BeginRun();
+        ThreadPool::Schedule(this);
+    }
+
+    /// <summary>
+    /// Runs a task created by the constructor on the calling thread.
+    /// </summary>
+    void RunSynchronously() {
+        BeginRun();
+        ExecuteWorkItem(this);
+    }
+
+    /// <summary>
+    /// Blocks until the task completes, rethrowing its failure. A waiting thread runs queued pool work while it waits, so
+    /// waiting on a task from inside the pool cannot starve the pool of the worker it is sitting on.
+    /// </summary>
+    void Wait() {
+        WaitForCompletion();
+        if (LoadStatus() == TaskStatus::Faulted) {
+            std::rethrow_exception(exception);
+        }
+    }
+
+    TaskStatus get_Status() const {
+        return LoadStatus();
+    }
+
+    bool get_IsCompleted() const {
+        return LoadStatus() >= TaskStatus::RanToCompletion;
+    }
+
+    bool get_IsCompletedSuccessfully() const {
+        return LoadStatus() == TaskStatus::RanToCompletion;
+    }
+
+    bool get_IsFaulted() const {
+        return LoadStatus() == TaskStatus::Faulted;
+    }
+
+    bool get_IsCanceled() const {
+        return LoadStatus() == TaskStatus::Canceled;
+    }
+
+    /// <summary>
+    /// Schedules <paramref name="continuation"/> to run with this task once it completes.
+    /// </summary>
+    Task* ContinueWith(Action<Task*>* continuation);
+
+    /// <summary>
+    /// Schedules <paramref name="continuation"/> to run with this task once it completes and returns its result.
+    /// </summary>
+    template <typename TNewResult>
+    Task_1<TNewResult>* ContinueWith(Func<Task*, TNewResult>* continuation);
+
+    /// <summary>
+    /// Returns this task. There is no synchronization context to capture, so every await already resumes on the pool.
+    /// </summary>
+    Task* ConfigureAwait(bool continueOnCapturedContext) {
+        (void)continueOnCapturedContext;
+        return this;
+    }
+
+    /// <summary>
+    /// Attaches a native continuation node. The node runs inline on the completing thread, or immediately when the task
+    /// has already completed, so it must only do constant work such as scheduling or counting down.
+    /// </summary>
+    void AddContinuation(TaskContinuation* continuation) {
+        if (!TryAddContinuation(continuation)) {
+            continuation->Invoke(continuation, this);
+        }
+    }
+
+    /// <summary>
+    /// Attaches a native continuation node unless the task has already completed, in which case the node is not run and
+    /// the call returns <c>false</c>.
+    /// </summary>
+    bool TryAddContinuation(TaskContinuation* continuation) {
+        TaskContinuation* head = continuations.load(std::memory_order_acquire);
+        do {
+            if (head == CompletedSentinel()) {
+                return false;
+            }
+
+            continuation->Next = head;
+        } while (!continuations.compare_exchange_weak(head, continuation, std::memory_order_acq_rel, std::memory_order_acquire));
+
+        return true;
+    }
+
+protected:
+    /// <summary>
+    /// Initializes a task completed by the runtime rather than by a body, such as continuations and combinators.
+    /// </summary>
+    explicit Task(TaskStatus initialStatus)
+        : ThreadPoolWorkItem { &ExecuteWorkItem },
+          body(nullptr),
+          status(static_cast<int32_t>(initialStatus)),
+          completing(initialStatus >= TaskStatus::RanToCompletion),
+          continuations(initialStatus >= TaskStatus::RanToCompletion ? CompletedSentinel() : nullptr) {
+    }
+
+    /// <summary>
+    /// Runs the task body. Result-bearing tasks override this to store the body's result.
+    /// </summary>
+    virtual void InvokeBody() {
+        (*body)();
+    }
+
+    /// <summary>
+    /// Claims the right to complete the task; only the caller that wins may store a result and call FinishCompletion.
+    /// </summary>
+    bool TryReserveCompletion() {
+        bool expected = false;
+        return completing.compare_exchange_strong(expected, true, std::memory_order_acq_rel);
+    }
+
+    /// <summary>
+    /// Publishes the final status, wakes waiters, and runs attached continuations in attach order. Once the list is
+    /// detached the task is only passed to those continuations, so the last one, or an owner whose attach fails, may
+    /// release it.
+    /// </summary>
+    void FinishCompletion(TaskStatus finalStatus) {
+        status.store(static_cast<int32_t>(finalStatus), std::memory_order_release);
+#if HE_CPP_THREAD_POOL_THREADED
+        status.notify_all();
+#endif
+
+        TaskContinuation* pending = continuations.exchange(CompletedSentinel(), std::memory_order_acq_rel);
+        TaskContinuation* ordered = nullptr;
+        while (pending != nullptr) {
+            TaskContinuation* next = pending->Next;
+            pending->Next = ordered;
+            ordered = pending;
+            pending = next;
+        }
+
+        while (ordered != nullptr) {
+            TaskContinuation* next = ordered->Next;
+            ordered->Invoke(ordered, this);
+            ordered = next;
+        }
+    }
+
+    /// <summary>
+    /// Faults the task with <paramref name="failure"/> if no other completion won first.
+    /// </summary>
+    bool TrySetException(std::exception_ptr failure) {
+        if (!TryReserveCompletion()) {
+            return false;
+        }
+
+        exception = std::move(failure);
+        FinishCompletion(TaskStatus::Faulted);
+        return true;
+    }
+
+    /// <summary>
+    /// Moves a runtime-created task to the queue and schedules it, used when a continuation's antecedent completes.
+    /// </summary>
+    void ScheduleFromContinuation() {
+        status.store(static_cast<int32_t>(TaskStatus::WaitingToRun), std::memory_order_relaxed);
+        ThreadPool::Schedule(this);
+    }
+
+    std::exception_ptr GetException() const {
+        return exception;
+    }
+
+    /// <summary>
+    /// Blocks until the task completes without observing its failure.
+    /// </summary>
+    void WaitForCompletion() {
+        if (get_IsCompleted()) {
+            return;
+        }
+
+#if HE_CPP_THREAD_POOL_THREADED
+        int32_t idleSpins = 0;
+        for (;;) {
+            const int32_t observed = status.load(std::memory_order_acquire);
+            if (observed >= static_cast<int32_t>(TaskStatus::RanToCompletion)) {
+                return;
+            }
+
+            if (ThreadPool::TryExecuteOne()) {
+                idleSpins = 0;
+                continue;
+            }
+
+            if (idleSpins < 64) {
+                ++idleSpins;
+                std::this_thread::yield();
+                continue;
+            }
+
+            status.wait(observed, std::memory_order_acquire);
+        }
+#else
+        // Without threads every scheduled task has already run inline, so the only way to get here is a task nothing
+        // will ever complete.
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+        throw InvalidOperationException();
+#else
+        throw InvalidOperationException("The task cannot complete on a target without threads.");
+#endif
+#endif
+    }
+
+    template <typename TTask>
+    friend class TaskWhenAllPromise;
+
+    template <typename TTask>
+    friend class TaskWhenAnyPromise;
+
+    template <typename TAntecedent, typename TDelegate, typename TResult>
+    friend class TaskContinuationTask;
+
+    template <typename TTask>
+    friend class TaskCoroutinePromiseBase;
+
+    friend class TaskDelayPromise;
+
+    friend class SemaphoreSlimWaitPromise;
+
+private:
+    static void ExecuteWorkItem(ThreadPoolWorkItem* item) {
+        Task* task = static_cast<Task*>(item);
+        task->status.store(static_cast<int32_t>(TaskStatus::Running), std::memory_order_relaxed);
+        task->completing.store(true, std::memory_order_relaxed);
+        try {
+            task->InvokeBody();
+        } catch (...) {
+            task->exception = std::current_exception();
+            task->FinishCompletion(TaskStatus::Faulted);
+            return;
+        }
+
+        task->FinishCompletion(TaskStatus::RanToCompletion);
+    }
+
+    void BeginRun() {
+        int32_t expected = static_cast<int32_t>(TaskStatus::Created);
+        if (!status.compare_exchange_strong(expected, static_cast<int32_t>(TaskStatus::WaitingToRun), std::memory_order_acq_rel)) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+            throw InvalidOperationException();
+#else
+            throw InvalidOperationException("Start may not be called on a task that has already started.");
+#endif
+        }
+    }
+
+    TaskStatus LoadStatus() const {
+        return static_cast<TaskStatus>(status.load(std::memory_order_acquire));
+    }
+
+    static TaskContinuation* CompletedSentinel() {
+        static TaskContinuation sentinel { nullptr, nullptr };
+        return &sentinel;
+    }
+
+    Action<>* body;
+    std::atomic<int32_t> status;
+    std::atomic<bool> completing;
+    std::atomic<TaskContinuation*> continuations;
+    std::exception_ptr exception;
+};
+
+/// <summary>
+/// Native form of the managed generic <c>Task&lt;TResult&gt;</c>; the arity suffix keeps it distinct from the
+/// non-generic Task it derives from.
+/// </summary>
+template <typename TResult>
+class Task_1 : public Task {
+public:
+    /// <summary>
+    /// Initializes a task that runs <paramref name="function"/> once started.
+    /// </summary>
+    explicit Task_1(Func<TResult>* function)
+        : Task(TaskStatus::Created), function(function), result{} {
+        if (function == nullptr) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+            throw ArgumentNullException();
+#else
+            throw ArgumentNullException("function");
+#endif
+        }
+    }
+
+    /// <summary>
+    /// Waits for the task and returns its result, rethrowing its failure.
+    /// </summary>
+    TResult get_Result() {
+        Wait();
+        return result;
+    }
+
+    /// <summary>
+    /// Returns this task; see <see cref="Task::ConfigureAwait"/>.
+    /// </summary>
+    Task_1* ConfigureAwait(bool continueOnCapturedContext) {
+        (void)continueOnCapturedContext;
+        return this;
+    }
+
+    using Task::ContinueWith;
+
+    /// <summary>
+    /// Schedules <paramref name="continuation"/> to run with this typed task once it completes.
+    /// </summary>
+    Task* ContinueWith(Action<Task_1*>* continuation);
+
+    template <typename TNewResult>
+    Task_1<TNewResult>* ContinueWith(Func<Task_1*, TNewResult>* continuation);
+
+protected:
+    explicit Task_1(TaskStatus initialStatus)
+        : Task(initialStatus), function(nullptr), result{} {
+    }
+
+    void InvokeBody() override {
+        result = (*function)();
+    }
+
+    /// <summary>
+    /// Completes the task with <paramref name="value"/> if no other completion won first.
+    /// </summary>
+    bool TrySetResult(TResult value) {
+        if (!TryReserveCompletion()) {
+            return false;
+        }
+
+        result = std::move(value);
+        FinishCompletion(TaskStatus::RanToCompletion);
+        return true;
+    }
+
+    friend class Task;
+
+    template <typename TTask>
+    friend class TaskWhenAllPromise;
+
+    template <typename TTask>
+    friend class TaskWhenAnyPromise;
+
+    template <typename TAntecedent, typename TDelegate, typename TResultOfContinuation>
+    friend class TaskContinuationTask;
+
+    template <typename TTask>
+    friend class TaskCoroutinePromiseBase;
+
+    template <typename TTask>
+    friend class TaskCoroutinePromise;
+
+    Func<TResult>* function;
+    TResult result;
+};
+
+/// <summary>
+/// Task running a native callable stored inline, used by the callable Run overload.
+/// </summary>
+template <typename TCallable, typename TResult>
+class TaskCallable final : public Task_1<TResult> {
+public:
+    explicit TaskCallable(TCallable callableValue)
+        : Task_1<TResult>(TaskStatus::Created), callable(std::move(callableValue)) {
+    }
+
+protected:
+    void InvokeBody() override {
+        this->result = callable();
+    }
+
+private:
+    TCallable callable;
+};
+
+template <typename TCallable>
+class TaskCallable<TCallable, void> final : public Task {
+public:
+    explicit TaskCallable(TCallable callableValue)
+        : Task(TaskStatus::Created), callable(std::move(callableValue)) {
+    }
+
+protected:
+    void InvokeBody() override {
+        callable();
+    }
+
+private:
+    TCallable callable;
+};
+
+/// <summary>
+/// Task scheduled when its antecedent completes, then runs the managed continuation delegate with the antecedent.
+/// </summary>
+template <typename TAntecedent, typename TDelegate, typename TResult>
+class TaskContinuationTask final : public Task_1<TResult>, private TaskContinuation {
+public:
+    TaskContinuationTask(TAntecedent* antecedentTask, TDelegate* continuationDelegate)
+        : Task_1<TResult>(TaskStatus::WaitingForActivation), TaskContinuation { nullptr, &OnAntecedentCompleted },
+          antecedent(antecedentTask), continuation(continuationDelegate) {
+    }
+
+    void Attach() {
+        antecedent->AddContinuation(this);
+    }
+
+protected:
+    void InvokeBody() override {
+        this->result = (*continuation)(antecedent);
+    }
+
+private:
+    static void OnAntecedentCompleted(TaskContinuation* node, Task* completed) {
+        (void)completed;
+        static_cast<TaskContinuationTask*>(node)->ScheduleFromContinuation();
+    }
+
+    TAntecedent* antecedent;
+    TDelegate* continuation;
+};
+
+template <typename TAntecedent, typename TDelegate>
+class TaskContinuationTask<TAntecedent, TDelegate, void> final : public Task, private TaskContinuation {
+public:
+    TaskContinuationTask(TAntecedent* antecedentTask, TDelegate* continuationDelegate)
+        : Task(TaskStatus::WaitingForActivation), TaskContinuation { nullptr, &OnAntecedentCompleted },
+          antecedent(antecedentTask), continuation(continuationDelegate) {
+    }
+
+    void Attach() {
+        antecedent->AddContinuation(this);
+    }
+
+protected:
+    void InvokeBody() override {
+        (*continuation)(antecedent);
+    }
+
+private:
+    static void OnAntecedentCompleted(TaskContinuation* node, Task* completed) {
+        (void)completed;
+        static_cast<TaskContinuationTask*>(node)->ScheduleFromContinuation();
+    }
+
+    TAntecedent* antecedent;
+    TDelegate* continuation;
+};
+
+template <typename TTask>
+class TaskWhenAllPromise;
+
+/// <summary>
+/// Completes once every antecedent has completed. Each antecedent gets one embedded continuation node that counts the
+/// promise down, and the first fault seen is the one the promise faults with.
+/// </summary>
+template <>
+class TaskWhenAllPromise<Task> final : public Task {
+public:
+    explicit TaskWhenAllPromise(Array<Task*>* tasks)
+        : Task(TaskStatus::WaitingForActivation), remaining(tasks->Length), faulted(false),
+          nodes(static_cast<size_t>(tasks->Length)) {
+        for (int32_t index = 0; index < tasks->Length; ++index) {
+            nodes[static_cast<size_t>(index)].Owner = this;
+            nodes[static_cast<size_t>(index)].Invoke = &OnAntecedentCompleted;
+        }
+
+        for (int32_t index = 0; index < tasks->Length; ++index) {
+            tasks->Data[index]->AddContinuation(&nodes[static_cast<size_t>(index)]);
+        }
+    }
+
+private:
+    struct Node : TaskContinuation {
+        TaskWhenAllPromise* Owner = nullptr;
+    };
+
+    static void OnAntecedentCompleted(TaskContinuation* continuation, Task* completed) {
+        TaskWhenAllPromise* owner = static_cast<Node*>(continuation)->Owner;
+        if (completed->get_IsFaulted() && !owner->faulted.exchange(true, std::memory_order_acq_rel)) {
+            owner->firstFailure = completed->GetException();
+        }
+
+        if (owner->remaining.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+            return;
+        }
+
+        if (owner->faulted.load(std::memory_order_acquire)) {
+            owner->TrySetException(owner->firstFailure);
+        } else if (owner->TryReserveCompletion()) {
+            owner->FinishCompletion(TaskStatus::RanToCompletion);
+        }
+    }
+
+    std::atomic<int32_t> remaining;
+    std::atomic<bool> faulted;
+    std::exception_ptr firstFailure;
+    std::vector<Node> nodes;
+};
+
+/// <summary>
+/// Typed WhenAll promise: counts the antecedents down the same way and gathers their results in array order.
+/// </summary>
+template <typename TResult>
+class TaskWhenAllPromise<Task_1<TResult>> final : public Task_1<Array<TResult>*> {
+public:
+    explicit TaskWhenAllPromise(Array<Task_1<TResult>*>* tasks)
+        : Task_1<Array<TResult>*>(TaskStatus::WaitingForActivation), antecedents(tasks), remaining(tasks->Length),
+          faulted(false), nodes(static_cast<size_t>(tasks->Length)) {
+        for (int32_t index = 0; index < tasks->Length; ++index) {
+            nodes[static_cast<size_t>(index)].Owner = this;
+            nodes[static_cast<size_t>(index)].Invoke = &OnAntecedentCompleted;
+        }
+
+        for (int32_t index = 0; index < tasks->Length; ++index) {
+            tasks->Data[index]->AddContinuation(&nodes[static_cast<size_t>(index)]);
+        }
+    }
+
+private:
+    struct Node : TaskContinuation {
+        TaskWhenAllPromise* Owner = nullptr;
+    };
+
+    static void OnAntecedentCompleted(TaskContinuation* continuation, Task* completed) {
+        TaskWhenAllPromise* owner = static_cast<Node*>(continuation)->Owner;
+        if (completed->get_IsFaulted() && !owner->faulted.exchange(true, std::memory_order_acq_rel)) {
+            owner->firstFailure = completed->GetException();
+        }
+
+        if (owner->remaining.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+            return;
+        }
+
+        if (owner->faulted.load(std::memory_order_acquire)) {
+            owner->TrySetException(owner->firstFailure);
+            return;
+        }
+
+        Array<Task_1<TResult>*>* tasks = owner->antecedents;
+        Array<TResult>* results = new Array<TResult>(tasks->Length);
+        for (int32_t index = 0; index < tasks->Length; ++index) {
+            results->Data[index] = tasks->Data[index]->result;
+        }
+
+        owner->TrySetResult(results);
+    }
+
+    Array<Task_1<TResult>*>* antecedents;
+    std::atomic<int32_t> remaining;
+    std::atomic<bool> faulted;
+    std::exception_ptr firstFailure;
+    std::vector<Node> nodes;
+};
+
+/// <summary>
+/// Completes with the first antecedent to complete, whether it succeeded or faulted, matching managed WhenAny.
+/// </summary>
+template <typename TTask>
+class TaskWhenAnyPromise final : public Task_1<TTask*> {
+public:
+    explicit TaskWhenAnyPromise(Array<TTask*>* tasks)
+        : Task_1<TTask*>(TaskStatus::WaitingForActivation), nodes(static_cast<size_t>(tasks->Length)) {
+        for (int32_t index = 0; index < tasks->Length; ++index) {
+            nodes[static_cast<size_t>(index)].Owner = this;
+            nodes[static_cast<size_t>(index)].Invoke = &OnAntecedentCompleted;
+        }
+
+        for (int32_t index = 0; index < tasks->Length && !this->get_IsCompleted(); ++index) {
+            tasks->Data[index]->AddContinuation(&nodes[static_cast<size_t>(index)]);
+        }
+    }
+
+private:
+    struct Node : TaskContinuation {
+        TaskWhenAnyPromise* Owner = nullptr;
+    };
+
+    static void OnAntecedentCompleted(TaskContinuation* continuation, Task* completed) {
+        static_cast<Node*>(continuation)->Owner->TrySetResult(static_cast<TTask*>(completed));
+    }
+
+    std::vector<Node> nodes;
+};
+
+template <typename TResult>
+Task_1<TResult>* Task::Run(Func<TResult>* function) {
+    Task_1<TResult>* task = new Task_1<TResult>(function);
+    task->Start();
+    return task;
+}
+
+template <typename TCallable, typename>
+auto Task::Run(TCallable&& callable) {
+    using TStored = std::decay_t<TCallable>;
+    using TResult = std::invoke_result_t<TStored&>;
+    auto* task = new TaskCallable<TStored, TResult>(std::forward<TCallable>(callable));
+    task->Start();
+    if constexpr (std::is_void_v<TResult>) {
+        return static_cast<Task*>(task);
+    } else {
+        return static_cast<Task_1<TResult>*>(task);
+    }
+}
+
+template <typename TResult>
+Task_1<TResult>* Task::FromResult(TResult result) {
+    Task_1<TResult>* task = new Task_1<TResult>(TaskStatus::WaitingForActivation);
+    task->TrySetResult(std::move(result));
+    return task;
+}
+
+inline Task* Task::WhenAll(Array<Task*>* tasks) {
+    if (tasks == nullptr) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+        throw ArgumentNullException();
+#else
+        throw ArgumentNullException("tasks");
+#endif
+    }
+
+    if (tasks->Length == 0) {
+        return get_CompletedTask();
+    }
+
+    return new TaskWhenAllPromise<Task>(tasks);
+}
+
+template <typename TResult>
+Task_1<Array<TResult>*>* Task::WhenAll(Array<Task_1<TResult>*>* tasks) {
+    if (tasks == nullptr) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+        throw ArgumentNullException();
+#else
+        throw ArgumentNullException("tasks");
+#endif
+    }
+
+    if (tasks->Length == 0) {
+        return FromResult<Array<TResult>*>(new Array<TResult>(0));
+    }
+
+    return new TaskWhenAllPromise<Task_1<TResult>>(tasks);
+}
+
+inline Task_1<Task*>* Task::WhenAny(Array<Task*>* tasks) {
+    if (tasks == nullptr || tasks->Length == 0) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+        throw ArgumentException();
+#else
+        throw ArgumentException("The tasks argument must contain at least one task.", "tasks");
+#endif
+    }
+
+    return new TaskWhenAnyPromise<Task>(tasks);
+}
+
+template <typename TResult>
+Task_1<Task_1<TResult>*>* Task::WhenAny(Array<Task_1<TResult>*>* tasks) {
+    if (tasks == nullptr || tasks->Length == 0) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+        throw ArgumentException();
+#else
+        throw ArgumentException("The tasks argument must contain at least one task.", "tasks");
+#endif
+    }
+
+    return new TaskWhenAnyPromise<Task_1<TResult>>(tasks);
+}
+
+inline int32_t Task::WaitAny(Array<Task*>* tasks) {
+    Task* completed = WhenAny(tasks)->get_Result();
+    for (int32_t index = 0; index < tasks->Length; ++index) {
+        if (tasks->Data[index] == completed) {
+            return index;
+        }
+    }
+
+    return -1;
+}
+
+/// <summary>
+/// Task completed by the delay timer.
+/// </summary>
+class TaskDelayPromise final : public Task {
+public:
+    TaskDelayPromise()
+        : Task(TaskStatus::WaitingForActivation) {
+    }
+
+    void Complete() {
+        if (TryReserveCompletion()) {
+            FinishCompletion(TaskStatus::RanToCompletion);
+        }
+    }
+};
+
+#if HE_CPP_THREAD_POOL_THREADED
+
+/// <summary>
+/// One background thread that completes delay tasks at their deadlines, so pending delays cost a map entry rather than
+/// a blocked pool thread. The thread starts on the first delay.
+/// </summary>
+class TaskDelayTimer {
+public:
+    static TaskDelayTimer& Shared() {
+        static TaskDelayTimer timer;
+        return timer;
+    }
+
+    TaskDelayTimer(const TaskDelayTimer&) = delete;
+    TaskDelayTimer& operator=(const TaskDelayTimer&) = delete;
+
+    ~TaskDelayTimer() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+
+        signal.notify_all();
+        thread.join();
+    }
+
+    void Add(TaskDelayPromise* task, int32_t millisecondsDelay) {
+        const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(millisecondsDelay);
+        bool earliest;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            earliest = pending.empty() || deadline < pending.begin()->first;
+            pending.emplace(deadline, task);
+        }
+
+        if (earliest) {
+            signal.notify_one();
+        }
+    }
+
+private:
+    TaskDelayTimer()
+        : stopping(false), thread([this]() { Run(); }) {
+    }
+
+    void Run() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (!stopping) {
+            if (pending.empty()) {
+                signal.wait(lock);
+                continue;
+            }
+
+            const std::chrono::steady_clock::time_point deadline = pending.begin()->first;
+            if (std::chrono::steady_clock::now() < deadline) {
+                signal.wait_until(lock, deadline);
+                continue;
+            }
+
+            TaskDelayPromise* due = pending.begin()->second;
+            pending.erase(pending.begin());
+            lock.unlock();
+            due->Complete();
+            lock.lock();
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable signal;
+    std::multimap<std::chrono::steady_clock::time_point, TaskDelayPromise*> pending;
+    bool stopping;
+    std::thread thread;
+};
+#endif
+
+inline Task* Task::Delay(int32_t millisecondsDelay) {
+    if (millisecondsDelay < -1) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+        throw ArgumentOutOfRangeException();
+#else
+        throw ArgumentOutOfRangeException("millisecondsDelay");
+#endif
+    }
+
+    if (millisecondsDelay == 0) {
+        return get_CompletedTask();
+    }
+
+#if HE_CPP_THREAD_POOL_THREADED
+    TaskDelayPromise* task = new TaskDelayPromise();
+    if (millisecondsDelay > 0) {
+        TaskDelayTimer::Shared().Add(task, millisecondsDelay);
+    }
+
+    return task;
+#else
+    if (millisecondsDelay == -1) {
+        return new TaskDelayPromise();
+    }
+
+    System::Diagnostics::Stopwatch clock;
+    clock.Start();
+    while (static_cast<double>(clock.Elapsed.TotalMilliseconds) < millisecondsDelay) {
+    }
+
+    return get_CompletedTask();
+#endif
+}
+
+inline Task* Task::ContinueWith(Action<Task*>* continuation) {
+    if (continuation == nullptr) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+        throw ArgumentNullException();
+#else
+        throw ArgumentNullException("continuationAction");
+#endif
+    }
+
+    auto* task = new TaskContinuationTask<Task, Action<Task*>, void>(this, continuation);
+    task->Attach();
+    return task;
+}
+
+template <typename TNewResult>
+Task_1<TNewResult>* Task::ContinueWith(Func<Task*, TNewResult>* continuation) {
+    if (continuation == nullptr) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+        throw ArgumentNullException();
+#else
+        throw ArgumentNullException("continuationFunction");
+#endif
+    }
+
+    auto* task = new TaskContinuationTask<Task, Func<Task*, TNewResult>, TNewResult>(this, continuation);
+    task->Attach();
+    return task;
+}
+
+template <typename TResult>
+Task* Task_1<TResult>::ContinueWith(Action<Task_1*>* continuation) {
+    if (continuation == nullptr) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+        throw ArgumentNullException();
+#else
+        throw ArgumentNullException("continuationAction");
+#endif
+    }
+
+    auto* task = new TaskContinuationTask<Task_1, Action<Task_1*>, void>(this, continuation);
+    task->Attach();
+    return task;
+}
+
+template <typename TResult>
+template <typename TNewResult>
+Task_1<TNewResult>* Task_1<TResult>::ContinueWith(Func<Task_1*, TNewResult>* continuation) {
+    if (continuation == nullptr) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+        throw ArgumentNullException();
+#else
+        throw ArgumentNullException("continuationFunction");
+#endif
+    }
+
+    auto* task = new TaskContinuationTask<Task_1, Func<Task_1*, TNewResult>, TNewResult>(this, continuation);
+    task->Attach();
+    return task;
+}
+
+#if HE_CPP_TASK_COROUTINES
+#include "system/threading/tasks/task_coroutine.hpp"
+#endif
+
+#endif // HE_CPP_SYSTEM_THREADING_TASKS_TASK_HPP
@@ -0,0 +1,309 @@
+#ifndef HE_CPP_SYSTEM_THREADING_TASKS_TASK_COROUTINE_HPP
+#define HE_CPP_SYSTEM_THREADING_TASKS_TASK_COROUTINE_HPP
+
+#include "helcpp_config.hpp"
+#include "system/threading/tasks/task.hpp"
+
+#if HE_CPP_TASK_COROUTINES
+#include "system/threading/tasks/coroutine_frame_allocator.hpp"
+#include "system/threading/thread_pool.hpp"
+#include <coroutine>
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+/// <summary>
+/// Suspends an awaiting coroutine until a task completes. The awaiter embeds both the continuation node it attaches to
+/// the task and the work item that resumes the coroutine, and it lives in the coroutine frame, so an await never
+/// allocates. Resumption goes through the ThreadPool instead of running on the completing thread, which keeps the
+/// completing thread's stack shallow and spreads resumed continuations across workers.
+/// </summary>
+template <typename TTask>
+class TaskAwaiter final : private TaskContinuation, private ThreadPoolWorkItem {
+public:
+    explicit TaskAwaiter(TTask* awaitedTask)
+        : TaskContinuation { nullptr, &OnCompleted }, ThreadPoolWorkItem { &Resume }, task(awaitedTask) {
+    }
+
+    bool await_ready() const {
+        return task->get_IsCompleted();
+    }
+
+    /// <summary>
+    /// Attaches the continuation, or resumes immediately when the task completed after <see cref="await_ready"/>.
+    /// </summary>
+    bool await_suspend(std::coroutine_handle<> handle) {
+        continuation = handle;
+        return task->TryAddContinuation(this);
+    }
+
+    decltype(auto) await_resume() {
+        if constexpr (std::is_same_v<TTask, Task>) {
+            task->Wait();
+        } else {
+            return task->get_Result();
+        }
+    }
+
+private:
+    static void OnCompleted(TaskContinuation* node, Task* completed) {
+        (void)completed;
+        ThreadPool::Schedule(static_cast<TaskAwaiter*>(node));
+    }
+
+    static void Resume(ThreadPoolWorkItem* item) {
+        static_cast<TaskAwaiter*>(item)->continuation.resume();
+    }
+
+    TTask* task;
+    std::coroutine_handle<> continuation;
+};
+
+/// <summary>
+/// Awaitable returned by Task::Yield: always suspends and resumes the coroutine as a fresh pool work item.
+/// </summary>
+class TaskYieldAwaitable final : private ThreadPoolWorkItem {
+public:
+    TaskYieldAwaitable()
+        : ThreadPoolWorkItem { &Resume } {
+    }
+
+    bool await_ready() const noexcept {
+        return false;
+    }
+
+    void await_suspend(std::coroutine_handle<> handle) {
+        continuation = handle;
+        ThreadPool::Schedule(this);
+    }
+
+    void await_resume() const noexcept {
+    }
+
+private:
+    static void Resume(ThreadPoolWorkItem* item) {
+        static_cast<TaskYieldAwaitable*>(item)->continuation.resume();
+    }
+
+    std::coroutine_handle<> continuation;
+};
+
+inline TaskYieldAwaitable Task::Yield() {
+    return TaskYieldAwaitable();
+}
+
+/// <summary>
+/// Coroutine promise shared by lowered <c>async Task</c> and <c>async Task&lt;TResult&gt;</c> methods. The body
+/// starts running on the caller, like a managed async method, and the task it returns completes when the frame
+/// reaches its final suspend point. Frames come from <see cref="CoroutineFrameAllocator"/> and are released before the
+/// task completes, so continuations never observe a live frame.
+/// </summary>
+template <typename TTask>
+class TaskCoroutinePromiseBase {
+private:
+    /// <summary>
+    /// Releases the frame, then completes the task with the body's outcome.
+    /// </summary>
+    struct FinalAwaiter {
+        bool await_ready() const noexcept {
+            return false;
+        }
+
+        template <typename TPromise>
+        void await_suspend(std::coroutine_handle<TPromise> handle) const noexcept {
+            TaskCoroutinePromiseBase& promise = handle.promise();
+            TTask* completedTask = promise.task;
+            std::exception_ptr failure = std::move(promise.failure);
+            handle.destroy();
+            if (failure) {
+                completedTask->TrySetException(std::move(failure));
+            } else if (completedTask->TryReserveCompletion()) {
+                completedTask->FinishCompletion(TaskStatus::RanToCompletion);
+            }
+        }
+
+        void await_resume() const noexcept {
+        }
+    };
+
+public:
+    static void* operator new(size_t size) {
+        return CoroutineFrameAllocator::Allocate(size);
+    }
+
+    static void operator delete(void* frame, size_t size) {
+        CoroutineFrameAllocator::Free(frame, size);
+    }
+
+    TTask* get_return_object() {
+        task = new TTask(TaskStatus::WaitingForActivation);
+        return task;
+    }
+
+    std::suspend_never initial_suspend() const noexcept {
+        return {};
+    }
+
+    FinalAwaiter final_suspend() const noexcept {
+        return FinalAwaiter {};
+    }
+
+    void unhandled_exception() {
+        failure = std::current_exception();
+    }
+
+    TaskAwaiter<Task> await_transform(Task* awaited) const {
+        return TaskAwaiter<Task>(awaited);
+    }
+
+    template <typename TResult>
+    TaskAwaiter<Task_1<TResult>> await_transform(Task_1<TResult>* awaited) const {
+        return TaskAwaiter<Task_1<TResult>>(awaited);
+    }
+
+    /// <summary>
+    /// Passes every other awaitable through unchanged, so runtime awaitables such as I/O reads keep their own awaiters.
+    /// </summary>
+    template <typename TAwaitable, typename = std::enable_if_t<!std::is_convertible_v<TAwaitable, const Task*>>>
+    TAwaitable&& await_transform(TAwaitable&& awaitable) const noexcept {
+        return std::forward<TAwaitable>(awaitable);
+    }
+
+protected:
+    TTask* task = nullptr;
+
+private:
+    std::exception_ptr failure;
+};
+
+template <typename TTask>
+class TaskCoroutinePromise;
+
+template <>
+class TaskCoroutinePromise<Task> final : public TaskCoroutinePromiseBase<Task> {
+public:
+    void return_void() const noexcept {
+    }
+};
+
+template <typename TResult>
+class TaskCoroutinePromise<Task_1<TResult>> final : public TaskCoroutinePromiseBase<Task_1<TResult>> {
+public:
+    template <typename TValue>
+    void return_value(TValue&& value) {
+        this->task->result = std::forward<TValue>(value);
+    }
+};
+
+namespace std {
+template <typename... TArgs>
+struct coroutine_traits<Task*, TArgs...> {
+    using promise_type = TaskCoroutinePromise<Task>;
+};
+
+template <typename TResult, typename... TArgs>
+struct coroutine_traits<Task_1<TResult>*, TArgs...> {
+    using promise_type = TaskCoroutinePromise<Task_1<TResult>>;
+};
+} // namespace std
+
+/// <summary>
+/// Return type of the driver coroutine behind <see cref="AsyncVoidMethod"/>. Its promise creates no task, because
+/// nothing can observe an async void method, and its frame releases itself when the body finishes.
+/// </summary>
+class AsyncVoidDriver final {
+public:
+    class promise_type final {
+    public:
+        static void* operator new(size_t size) {
+            return CoroutineFrameAllocator::Allocate(size);
+        }
+
+        static void operator delete(void* frame, size_t size) {
+            CoroutineFrameAllocator::Free(frame, size);
+        }
+
+        AsyncVoidDriver get_return_object() const noexcept {
+            return AsyncVoidDriver {};
+        }
+
+        std::suspend_never initial_suspend() const noexcept {
+            return {};
+        }
+
+        std::suspend_never final_suspend() const noexcept {
+            return {};
+        }
+
+        void return_void() const noexcept {
+        }
+
+        void unhandled_exception() const noexcept {
+            std::terminate();
+        }
+    };
+};
+
+/// <summary>
+/// Runs the body of a lowered <c>async void</c> method. The generated body is a task-returning lambda; its closure is
+/// copied into the frame of a driver coroutine that awaits it, so captured state outlives the caller's stack. The body's
+/// task is released once the driver resumes, since no other code holds it. As in .NET, an exception escaping an async
+/// void method cannot be observed by the caller and terminates the process.
+/// </summary>
+class AsyncVoidMethod {
+public:
+    template <typename TBody>
+    static void Start(TBody body) {
+        Drive(std::move(body));
+    }
+
+private:
+    /// <summary>
+    /// Awaits the body's task through its continuation list only. The task reports completed before FinishCompletion
+    /// detaches that list, so get_IsCompleted cannot tell the driver the completing thread is done with the task; a
+    /// failed attach or a run continuation can.
+    /// </summary>
+    class CompletionAwaiter final : private TaskContinuation, private ThreadPoolWorkItem {
+    public:
+        explicit CompletionAwaiter(Task* awaitedTask)
+            : TaskContinuation { nullptr, &OnCompleted }, ThreadPoolWorkItem { &Resume }, task(awaitedTask) {
+        }
+
+        bool await_ready() const noexcept {
+            return false;
+        }
+
+        bool await_suspend(std::coroutine_handle<> handle) {
+            continuation = handle;
+            return task->TryAddContinuation(this);
+        }
+
+        void await_resume() const {
+            task->Wait();
+        }
+
+    private:
+        static void OnCompleted(TaskContinuation* node, Task* completed) {
+            (void)completed;
+            ThreadPool::Schedule(static_cast<CompletionAwaiter*>(node));
+        }
+
+        static void Resume(ThreadPoolWorkItem* item) {
+            static_cast<CompletionAwaiter*>(item)->continuation.resume();
+        }
+
+        Task* task;
+        std::coroutine_handle<> continuation;
+    };
+
+    template <typename TBody>
+    static AsyncVoidDriver Drive(TBody body) {
+        Task* task = body();
+        co_await CompletionAwaiter(task);
+        delete task;
+    }
+};
+
+#endif
+
+#endif // HE_CPP_SYSTEM_THREADING_TASKS_TASK_COROUTINE_HPP
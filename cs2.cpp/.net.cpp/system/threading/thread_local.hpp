@@ -0,0 +1,296 @@
+#ifndef HE_CPP_SYSTEM_THREADING_THREAD_LOCAL_HPP
+#define HE_CPP_SYSTEM_THREADING_THREAD_LOCAL_HPP
+
+#include "helcpp_config.hpp"
+#include "runtime/native_exceptions.hpp"
+#include "runtime/native_list.hpp"
+#include "system/func.hpp"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#if HE_CPP_PLATFORM_PS2 || HE_CPP_PLATFORM_N64 || HE_CPP_PLATFORM_DS || HE_CPP_RUNTIME_CUSTOM_RETRO
+#define HE_CPP_THREAD_LOCAL_THREADED 0
+#else
+#define HE_CPP_THREAD_LOCAL_THREADED 1
+#endif
+
+#if HE_CPP_THREAD_LOCAL_THREADED
+#include <mutex>
+#endif
+
+/// <summary>
+/// Shared bookkeeping behind every ThreadLocal instance. Each instance owns a dense slot index, and each thread keeps
+/// one table indexed by it, so reading a value is a bounds check and an id compare with no lock and no hashing. Indices
+/// are recycled after Dispose; the table entry also stores the owner's never-reused id so a recycled index can never
+/// surface another instance's value.
+/// </summary>
+class ThreadLocalStorage {
+public:
+    struct Entry {
+        uint64_t Id = 0;
+        void* Slot = nullptr;
+    };
+
+    static std::vector<Entry>& CurrentTable() {
+#if HE_CPP_THREAD_LOCAL_THREADED
+        static thread_local std::vector<Entry> table;
+#else
+        static std::vector<Entry> table;
+#endif
+        return table;
+    }
+
+    static uint64_t NextId() {
+        static std::atomic<uint64_t> nextId(1);
+        return nextId.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    static uint32_t AllocateIndex() {
+        Indices& indices = SharedIndices();
+#if HE_CPP_THREAD_LOCAL_THREADED
+        std::lock_guard<std::mutex> lock(indices.Mutex);
+#endif
+        if (!indices.Free.empty()) {
+            const uint32_t index = indices.Free.back();
+            indices.Free.pop_back();
+            return index;
+        }
+
+        return indices.Next++;
+    }
+
+    static void ReleaseIndex(uint32_t index) {
+        Indices& indices = SharedIndices();
+#if HE_CPP_THREAD_LOCAL_THREADED
+        std::lock_guard<std::mutex> lock(indices.Mutex);
+#endif
+        indices.Free.push_back(index);
+    }
+
+private:
+    struct Indices {
+#if HE_CPP_THREAD_LOCAL_THREADED
+        std::mutex Mutex;
+#endif
+        std::vector<uint32_t> Free;
+        uint32_t Next = 0;
+    };
+
+    static Indices& SharedIndices() {
+        static Indices indices;
+        return indices;
+    }
+};
+
+/// <summary>
+/// Managed ThreadLocal&lt;T&gt;. Each thread's value is created on its first read, from the value factory when one was
+/// supplied or as the default value otherwise. Values stay owned by the instance until Dispose, so values written by
+/// threads that have since exited still appear in Values, as they do in the managed runtime with trackAllValues.
+/// </summary>
+template <typename T>
+class ThreadLocal {
+public:
+    ThreadLocal()
+        : ThreadLocal(static_cast<Func<T>*>(nullptr), false) {
+    }
+
+    explicit ThreadLocal(bool trackAllValues)
+        : ThreadLocal(static_cast<Func<T>*>(nullptr), trackAllValues) {
+    }
+
+    explicit ThreadLocal(Func<T>* valueFactory, bool trackAllValues = false)
+        : id(ThreadLocalStorage::NextId()),
+          index(ThreadLocalStorage::AllocateIndex()),
+          valueFactory(valueFactory),
+          trackAllValues(trackAllValues),
+          slots(nullptr) {
+    }
+
+    /// <summary>
+    /// Accepts a native callable as the value factory, such as a lowered lambda. The instance owns the delegate it wraps
+    /// the callable in and frees it on Dispose.
+    /// </summary>
+    template <typename TFactory>
+        requires (!std::is_pointer_v<TFactory> && !std::is_same_v<TFactory, bool> && std::is_invocable_r_v<T, TFactory&>)
+    explicit ThreadLocal(TFactory valueFactory, bool trackAllValues = false)
+        : ThreadLocal(static_cast<Func<T>*>(nullptr), trackAllValues) {
+        ownedValueFactory.reset(new Func<T>(std::move(valueFactory)));
+        this->valueFactory = ownedValueFactory.get();
+    }
+
+    ~ThreadLocal() {
+        Dispose();
+    }
+
+    ThreadLocal(const ThreadLocal&) = delete;
+    ThreadLocal& operator=(const ThreadLocal&) = delete;
+
+    T get_Value() {
+        return LocalSlot().Value;
+    }
+
+    void set_Value(const T& value) {
+        const std::vector<ThreadLocalStorage::Entry>& table = ThreadLocalStorage::CurrentTable();
+        if (index < table.size() && table[index].Id == id && table[index].Slot != nullptr) {
+            static_cast<Slot*>(table[index].Slot)->Value = value;
+            return;
+        }
+
+        ThrowIfDisposed();
+        Publish(new Slot(value));
+    }
+
+    bool get_IsValueCreated() const {
+        const std::vector<ThreadLocalStorage::Entry>& table = ThreadLocalStorage::CurrentTable();
+        return index < table.size() && table[index].Id == id && table[index].Slot != nullptr;
+    }
+
+    /// <summary>
+    /// Snapshots the values created by every thread that has touched this instance.
+    /// </summary>
+    List<T>* get_Values() {
+        ThrowIfDisposed();
+        if (!trackAllValues) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+            throw InvalidOperationException();
+#else
+            throw InvalidOperationException("The ThreadLocal object is not tracking values. To use the Values property, use a ThreadLocal constructor that accepts the trackAllValues parameter and set the parameter to true.");
+#endif
+        }
+
+        List<T>* values = new List<T>();
+#if HE_CPP_THREAD_LOCAL_THREADED
+        std::lock_guard<std::mutex> lock(slotsMutex);
+#endif
+        for (Slot* slot = slots; slot != nullptr; slot = slot->Next) {
+            values->Add(slot->Value);
+        }
+
+        return values;
+    }
+
+    /// <summary>
+    /// Frees every thread's value and recycles the slot index. Stale per-thread table entries keep the old id, which no
+    /// live instance will ever match again.
+    /// </summary>
+    void Dispose() {
+        if (id == 0) {
+            return;
+        }
+
+        id = 0;
+        Slot* slot = nullptr;
+        {
+#if HE_CPP_THREAD_LOCAL_THREADED
+            std::lock_guard<std::mutex> lock(slotsMutex);
+#endif
+            slot = slots;
+            slots = nullptr;
+        }
+
+        while (slot != nullptr) {
+            Slot* next = slot->Next;
+            delete slot;
+            slot = next;
+        }
+
+        valueFactory = nullptr;
+        ownedValueFactory.reset();
+        ThreadLocalStorage::ReleaseIndex(index);
+    }
+
+private:
+    struct Slot {
+        explicit Slot(const T& value)
+            : Value(value) {
+        }
+
+        T Value;
+        Slot* Next = nullptr;
+    };
+
+    Slot& LocalSlot() {
+        std::vector<ThreadLocalStorage::Entry>& table = ThreadLocalStorage::CurrentTable();
+        if (index < table.size() && table[index].Id == id && table[index].Slot != nullptr) {
+            return *static_cast<Slot*>(table[index].Slot);
+        }
+
+        return CreateLocalSlot();
+    }
+
+    Slot& CreateLocalSlot() {
+        ThrowIfDisposed();
+        std::vector<ThreadLocalStorage::Entry>& table = ThreadLocalStorage::CurrentTable();
+        if (table.size() <= index) {
+            table.resize(static_cast<size_t>(index) + 1);
+        }
+
+        if (table[index].Id == id) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+            throw InvalidOperationException();
+#else
+            throw InvalidOperationException("ValueFactory attempted to access the Value property of this instance.");
+#endif
+        }
+
+        if (valueFactory == nullptr) {
+            return *Publish(new Slot(T {}));
+        }
+
+        // The id with a null slot marks this thread's value as under construction, so a factory that reads Value again
+        // fails instead of recursing.
+        table[index].Id = id;
+        table[index].Slot = nullptr;
+        try {
+            const T value = (*valueFactory)();
+            return *Publish(new Slot(value));
+        } catch (...) {
+            ThreadLocalStorage::CurrentTable()[index].Id = 0;
+            throw;
+        }
+    }
+
+    Slot* Publish(Slot* slot) {
+        {
+#if HE_CPP_THREAD_LOCAL_THREADED
+            std::lock_guard<std::mutex> lock(slotsMutex);
+#endif
+            slot->Next = slots;
+            slots = slot;
+        }
+
+        std::vector<ThreadLocalStorage::Entry>& table = ThreadLocalStorage::CurrentTable();
+        if (table.size() <= index) {
+            table.resize(static_cast<size_t>(index) + 1);
+        }
+
+        table[index].Id = id;
+        table[index].Slot = slot;
+        return slot;
+    }
+
+    void ThrowIfDisposed() const {
+        if (id == 0) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+            throw InvalidOperationException();
+#else
+            throw InvalidOperationException("The ThreadLocal object has been disposed.");
+#endif
+        }
+    }
+
+    uint64_t id;
+    const uint32_t index;
+    Func<T>* valueFactory;
+    std::unique_ptr<Func<T>> ownedValueFactory;
+    const bool trackAllValues;
+    Slot* slots;
+#if HE_CPP_THREAD_LOCAL_THREADED
+    std::mutex slotsMutex;
+#endif
+};
+
+#endif
@@ -0,0 +1,342 @@
+#ifndef HE_CPP_SYSTEM_THREADING_THREAD_POOL_HPP
+#define HE_CPP_SYSTEM_THREADING_THREAD_POOL_HPP
+
+#include "helcpp_config.hpp"
+#include "runtime/native_exceptions.hpp"
+#include "system/action.hpp"
+#include <atomic>
+#include <cstdint>
+
+#if HE_CPP_PLATFORM_PS2 || HE_CPP_PLATFORM_N64 || HE_CPP_PLATFORM_DS || HE_CPP_RUNTIME_CUSTOM_RETRO
+#define HE_CPP_THREAD_POOL_THREADED 0
+#else
+#define HE_CPP_THREAD_POOL_THREADED 1
+#endif
+
+/// <summary>
+/// Number of pool workers. Negative uses one fewer than the hardware thread count (at least one), because waiting
+/// callers run queued work themselves. Zero runs every work item inline on the thread that schedules it.
+/// </summary>
+#ifndef HE_CPP_THREAD_POOL_WORKER_COUNT
+#define HE_CPP_THREAD_POOL_WORKER_COUNT -1
+#endif
+
+#if HE_CPP_THREAD_POOL_THREADED
+#include "work_stealing_deque.hpp"
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#endif
+
+/// <summary>
+/// Intrusive unit of pool work. Tasks and parallel loops embed one so scheduling never allocates a wrapper.
+/// </summary>
+struct ThreadPoolWorkItem {
+    void (*Execute)(ThreadPoolWorkItem* item);
+};
+
+/// <summary>
+/// Work-stealing scheduler behind Task, Parallel, and the managed ThreadPool surface. Each worker owns a Chase-Lev
+/// deque: work scheduled from a worker stays on that worker's deque and runs newest-first, idle workers steal the oldest
+/// items from other deques, and work scheduled from outside the pool goes through one shared injection queue. Workers
+/// that find nothing park on a condition variable. Targets without threads, or a worker count of zero, run every item
+/// inline when it is scheduled.
+/// </summary>
+class ThreadPool {
+public:
+    /// <summary>
+    /// Queues a managed callback that receives a null state object.
+    /// </summary>
+    static bool QueueUserWorkItem(Action<void*>* callBack) {
+        return QueueUserWorkItem(callBack, nullptr);
+    }
+
+    /// <summary>
+    /// Queues a managed callback that receives <paramref name="state"/>.
+    /// </summary>
+    static bool QueueUserWorkItem(Action<void*>* callBack, void* state) {
+        if (callBack == nullptr) {
+#if HE_CPP_COMPACT_NATIVE_EXCEPTION_MESSAGES
+            throw ArgumentNullException();
+#else
+            throw ArgumentNullException("callBack");
+#endif
+        }
+
+        Schedule(new CallbackWorkItem(callBack, state));
+        return true;
+    }
+
+    /// <summary>
+    /// Sets the worker count before the pool first runs work. Returns <c>false</c> once the pool has started, matching
+    /// managed callers that treat the call as a request. The completion-port count is accepted for parity and ignored.
+    /// </summary>
+    static bool SetMaxThreads(int32_t workerThreads, int32_t completionPortThreads) {
+        (void)completionPortThreads;
+        if (workerThreads < 0) {
+            return false;
+        }
+
+        RequestedWorkerCount().store(workerThreads, std::memory_order_relaxed);
+        return !Started().load(std::memory_order_acquire);
+    }
+
+    static void GetMaxThreads(int32_t& workerThreads, int32_t& completionPortThreads) {
+        workerThreads = get_ThreadCount();
+        completionPortThreads = 0;
+    }
+
+    /// <summary>
+    /// Gets the number of pool worker threads, excluding callers that help while waiting.
+    /// </summary>
+    static int32_t get_ThreadCount() {
+#if HE_CPP_THREAD_POOL_THREADED
+        return Instance().WorkerCount();
+#else
+        return 0;
+#endif
+    }
+
+    /// <summary>
+    /// Schedules one work item. Items scheduled from a pool worker go to that worker's deque.
+    /// </summary>
+    static void Schedule(ThreadPoolWorkItem* item) {
+#if HE_CPP_THREAD_POOL_THREADED
+        Scheduler& scheduler = Instance();
+        if (scheduler.WorkerCount() > 0) {
+            scheduler.Schedule(item);
+            return;
+        }
+#endif
+        item->Execute(item);
+    }
+
+    /// <summary>
+    /// Runs one queued item on the calling thread, if any is available. Blocking waits call this so a waiting caller or
+    /// worker keeps the pool moving instead of deadlocking on work queued behind it.
+    /// </summary>
+    static bool TryExecuteOne() {
+#if HE_CPP_THREAD_POOL_THREADED
+        return Instance().TryExecuteOne();
+#else
+        return false;
+#endif
+    }
+
+private:
+    struct CallbackWorkItem : ThreadPoolWorkItem {
+        CallbackWorkItem(Action<void*>* callBack, void* state)
+            : ThreadPoolWorkItem { &Run }, CallBack(callBack), State(state) {
+        }
+
+        static void Run(ThreadPoolWorkItem* item) {
+            CallbackWorkItem* callbackItem = static_cast<CallbackWorkItem*>(item);
+            Action<void*>* callBack = callbackItem->CallBack;
+            void* state = callbackItem->State;
+            delete callbackItem;
+            (*callBack)(state);
+        }
+
+        Action<void*>* CallBack;
+        void* State;
+    };
+
+    static std::atomic<int32_t>& RequestedWorkerCount() {
+        static std::atomic<int32_t> requested(HE_CPP_THREAD_POOL_WORKER_COUNT);
+        return requested;
+    }
+
+    static std::atomic<bool>& Started() {
+        static std::atomic<bool> started(false);
+        return started;
+    }
+
+#if HE_CPP_THREAD_POOL_THREADED
+    class Scheduler {
+    public:
+        explicit Scheduler(int32_t workerCount)
+            : stopping(false), sleepers(0), signals(0), injectedCount(0) {
+            workers.reserve(static_cast<size_t>(workerCount));
+            for (int32_t index = 0; index < workerCount; ++index) {
+                Worker* worker = new Worker();
+                worker->Owner = this;
+                worker->Index = static_cast<size_t>(index);
+                worker->Random = 0x9E3779B9u ^ static_cast<uint32_t>(index + 1) * 0x85EBCA6Bu;
+                workers.emplace_back(worker);
+            }
+
+            Started().store(true, std::memory_order_release);
+
+            for (int32_t index = 0; index < workerCount; ++index) {
+                workers[static_cast<size_t>(index)]->Thread = std::thread([this, index]() {
+                    RunWorker(index);
+                });
+            }
+        }
+
+        ~Scheduler() {
+            {
+                std::lock_guard<std::mutex> lock(parkMutex);
+                stopping.store(true, std::memory_order_seq_cst);
+            }
+
+            parkCondition.notify_all();
+            for (std::unique_ptr<Worker>& worker : workers) {
+                if (worker->Thread.joinable()) {
+                    worker->Thread.join();
+                }
+            }
+        }
+
+        int32_t WorkerCount() const {
+            return static_cast<int32_t>(workers.size());
+        }
+
+        void Schedule(ThreadPoolWorkItem* item) {
+            Worker* current = CurrentWorker();
+            if (current != nullptr && current->Owner == this) {
+                current->Deque.Push(item);
+            } else {
+                std::lock_guard<std::mutex> lock(injectionMutex);
+                injection.push_back(item);
+                injectedCount.fetch_add(1, std::memory_order_release);
+            }
+
+            // Pairs with the sleeper count increment in Park so a parking worker either sees this signal or is woken.
+            signals.fetch_add(1, std::memory_order_seq_cst);
+            if (sleepers.load(std::memory_order_seq_cst) > 0) {
+                std::lock_guard<std::mutex> lock(parkMutex);
+                parkCondition.notify_one();
+            }
+        }
+
+        bool TryExecuteOne() {
+            ThreadPoolWorkItem* item = FindWork(CurrentWorker());
+            if (item == nullptr) {
+                return false;
+            }
+
+            item->Execute(item);
+            return true;
+        }
+
+    private:
+        struct Worker {
+            Worker()
+                : Owner(nullptr), Index(0), Random(0) {
+            }
+
+            WorkStealingDeque<ThreadPoolWorkItem*> Deque;
+            Scheduler* Owner;
+            size_t Index;
+            uint32_t Random;
+            std::thread Thread;
+        };
+
+        static Worker*& CurrentWorker() {
+            static thread_local Worker* current = nullptr;
+            return current;
+        }
+
+        ThreadPoolWorkItem* FindWork(Worker* self) {
+            ThreadPoolWorkItem* item = nullptr;
+            if (self != nullptr && self->Owner == this && self->Deque.TryPop(item)) {
+                return item;
+            }
+
+            if (injectedCount.load(std::memory_order_acquire) > 0) {
+                std::lock_guard<std::mutex> lock(injectionMutex);
+                if (!injection.empty()) {
+                    item = injection.front();
+                    injection.pop_front();
+                    injectedCount.fetch_sub(1, std::memory_order_relaxed);
+                    return item;
+                }
+            }
+
+            const size_t workerCount = workers.size();
+            size_t start = 0;
+            if (self != nullptr && self->Owner == this) {
+                // xorshift keeps victims spread without shared state.
+                self->Random ^= self->Random << 13;
+                self->Random ^= self->Random >> 17;
+                self->Random ^= self->Random << 5;
+                start = self->Random % workerCount;
+            }
+
+            for (size_t offset = 0; offset < workerCount; ++offset) {
+                Worker* victim = workers[(start + offset) % workerCount].get();
+                if (victim != self && victim->Deque.TrySteal(item)) {
+                    return item;
+                }
+            }
+
+            return nullptr;
+        }
+
+        void RunWorker(int32_t index) {
+            Worker* self = workers[static_cast<size_t>(index)].get();
+            CurrentWorker() = self;
+
+            while (!stopping.load(std::memory_order_acquire)) {
+                const uint64_t observedSignals = signals.load(std::memory_order_seq_cst);
+                ThreadPoolWorkItem* item = FindWork(self);
+                if (item != nullptr) {
+                    item->Execute(item);
+                    continue;
+                }
+
+                bool found = false;
+                for (int32_t spin = 0; spin < 64 && !found; ++spin) {
+                    std::this_thread::yield();
+                    found = signals.load(std::memory_order_relaxed) != observedSignals;
+                }
+
+                if (!found) {
+                    Park(observedSignals);
+                }
+            }
+
+            CurrentWorker() = nullptr;
+        }
+
+        void Park(uint64_t observedSignals) {
+            std::unique_lock<std::mutex> lock(parkMutex);
+            sleepers.fetch_add(1, std::memory_order_seq_cst);
+            parkCondition.wait(lock, [this, observedSignals]() {
+                return stopping.load(std::memory_order_relaxed) || signals.load(std::memory_order_seq_cst) != observedSignals;
+            });
+            sleepers.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        std::vector<std::unique_ptr<Worker>> workers;
+        std::mutex injectionMutex;
+        std::deque<ThreadPoolWorkItem*> injection;
+        std::mutex parkMutex;
+        std::condition_variable parkCondition;
+        std::atomic<bool> stopping;
+        std::atomic<int32_t> sleepers;
+        std::atomic<uint64_t> signals;
+        std::atomic<int32_t> injectedCount;
+    };
+
+    static int32_t ResolveWorkerCount(int32_t requested) {
+        if (requested >= 0) {
+            return requested;
+        }
+
+        const unsigned int hardwareThreads = std::thread::hardware_concurrency();
+        return hardwareThreads > 1 ? static_cast<int32_t>(hardwareThreads - 1) : 1;
+    }
+
+    static Scheduler& Instance() {
+        static Scheduler scheduler(ResolveWorkerCount(RequestedWorkerCount().load(std::memory_order_relaxed)));
+        return scheduler;
+    }
+#endif
+};
+
+#endif // HE_CPP_SYSTEM_THREADING_THREAD_POOL_HPP
@@ -0,0 +1,138 @@
+#ifndef HE_CPP_SYSTEM_THREADING_WORK_STEALING_DEQUE_HPP
+#define HE_CPP_SYSTEM_THREADING_WORK_STEALING_DEQUE_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+/// <summary>
+/// Chase-Lev work-stealing deque. The owning worker pushes and pops at the bottom without contention, while other
+/// workers steal from the top with one compare-exchange. The ring grows when full; replaced rings are kept until the
+/// deque is destroyed because a thief may still be reading from one.
+/// </summary>
+/// <typeparam name="T">Trivially copyable element type, normally a work-item pointer.</typeparam>
+template <typename T>
+class WorkStealingDeque {
+    static_assert(std::is_trivially_copyable_v<T>, "WorkStealingDeque elements must be trivially copyable.");
+
+public:
+    explicit WorkStealingDeque(int64_t initialCapacity = 256)
+        : top(0), bottom(0), ring(new Ring(initialCapacity)) {
+    }
+
+    ~WorkStealingDeque() {
+        delete ring.load(std::memory_order_relaxed);
+        for (Ring* retiredRing : retired) {
+            delete retiredRing;
+        }
+    }
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    /// <summary>
+    /// Pushes one element at the bottom. Only the owning worker may call this.
+    /// </summary>
+    void Push(T value) {
+        const int64_t currentBottom = bottom.load(std::memory_order_relaxed);
+        const int64_t currentTop = top.load(std::memory_order_acquire);
+        Ring* currentRing = ring.load(std::memory_order_relaxed);
+        if (currentBottom - currentTop > currentRing->Capacity - 1) {
+            currentRing = Grow(currentRing, currentTop, currentBottom);
+        }
+
+        currentRing->Store(currentBottom, value);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom.store(currentBottom + 1, std::memory_order_relaxed);
+    }
+
+    /// <summary>
+    /// Pops the most recently pushed element. Only the owning worker may call this.
+    /// </summary>
+    bool TryPop(T& value) {
+        const int64_t currentBottom = bottom.load(std::memory_order_relaxed) - 1;
+        Ring* currentRing = ring.load(std::memory_order_relaxed);
+        bottom.store(currentBottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t currentTop = top.load(std::memory_order_relaxed);
+        if (currentTop > currentBottom) {
+            bottom.store(currentBottom + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        value = currentRing->Load(currentBottom);
+        if (currentTop == currentBottom) {
+            // Last element: race thieves for it through top.
+            const bool won = top.compare_exchange_strong(currentTop, currentTop + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            bottom.store(currentBottom + 1, std::memory_order_relaxed);
+            return won;
+        }
+
+        return true;
+    }
+
+    /// <summary>
+    /// Steals the oldest element. Any thread may call this.
+    /// </summary>
+    bool TrySteal(T& value) {
+        int64_t currentTop = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64_t currentBottom = bottom.load(std::memory_order_acquire);
+        if (currentTop >= currentBottom) {
+            return false;
+        }
+
+        Ring* currentRing = ring.load(std::memory_order_acquire);
+        value = currentRing->Load(currentTop);
+        return top.compare_exchange_strong(currentTop, currentTop + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    }
+
+    /// <summary>
+    /// Gets whether the deque looked empty at the time of the call.
+    /// </summary>
+    bool IsEmpty() const {
+        return top.load(std::memory_order_acquire) >= bottom.load(std::memory_order_acquire);
+    }
+
+private:
+    struct Ring {
+        explicit Ring(int64_t capacity)
+            : Capacity(capacity), Mask(capacity - 1), Slots(new std::atomic<T>[static_cast<size_t>(capacity)]) {
+        }
+
+        ~Ring() {
+            delete[] Slots;
+        }
+
+        T Load(int64_t index) const {
+            return Slots[index & Mask].load(std::memory_order_relaxed);
+        }
+
+        void Store(int64_t index, T value) {
+            Slots[index & Mask].store(value, std::memory_order_relaxed);
+        }
+
+        const int64_t Capacity;
+        const int64_t Mask;
+        std::atomic<T>* Slots;
+    };
+
+    Ring* Grow(Ring* currentRing, int64_t currentTop, int64_t currentBottom) {
+        Ring* grown = new Ring(currentRing->Capacity * 2);
+        for (int64_t index = currentTop; index < currentBottom; ++index) {
+            grown->Store(index, currentRing->Load(index));
+        }
+
+        retired.push_back(currentRing);
+        ring.store(grown, std::memory_order_release);
+        return grown;
+    }
+
+    alignas(64) std::atomic<int64_t> top;
+    alignas(64) std::atomic<int64_t> bottom;
+    std::atomic<Ring*> ring;
+    std::vector<Ring*> retired;
+};
+
+#endif // HE_CPP_SYSTEM_THREADING_WORK_STEALING_DEQUE_HPP
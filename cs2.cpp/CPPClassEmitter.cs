@@ -103,6 +103,9 @@ namespace cs2.cpp {
             }
             headerWriter.WriteLine("#include <cstdint>");
             headerWriter.WriteLine("#include \"runtime/native_string.hpp\"");
+            if (conversionClass.Functions.Any(function => UsesSimdFunctionDispatch(conversionClass, function))) {
+                headerWriter.WriteLine("#include \"system/runtime/intrinsics/simd_dispatch.hpp\"");
+            }
             headerWriter.WriteLine();
 
             bool wroteInclude = false;
@@ -1044,6 +1047,54 @@ namespace cs2.cpp {
                 return "system/threading/auto_reset_event";
             }
 
+            if (string.Equals(referencedClass, "ManualResetEventSlim", StringComparison.Ordinal) ||
+                string.Equals(referencedClass, "System.Threading.ManualResetEventSlim", StringComparison.Ordinal) ||
+                string.Equals(normalizedReferencedClass, "ManualResetEventSlim", StringComparison.Ordinal) ||
+                string.Equals(referencedTypeName, "ManualResetEventSlim", StringComparison.Ordinal)) {
+                processor?.RegisterRuntimeRequirement("ManualResetEventSlim");
+                return "system/threading/manual_reset_event_slim";
+            }
+
+            if (string.Equals(referencedClass, "ManualResetEvent", StringComparison.Ordinal) ||
+                string.Equals(referencedClass, "System.Threading.ManualResetEvent", StringComparison.Ordinal) ||
+                string.Equals(normalizedReferencedClass, "ManualResetEvent", StringComparison.Ordinal) ||
+                string.Equals(referencedTypeName, "ManualResetEvent", StringComparison.Ordinal)) {
+                processor?.RegisterRuntimeRequirement("ManualResetEvent");
+                return "system/threading/manual_reset_event";
+            }
+
+            if (string.Equals(referencedClass, "SemaphoreSlim", StringComparison.Ordinal) ||
+                string.Equals(referencedClass, "System.Threading.SemaphoreSlim", StringComparison.Ordinal) ||
+                string.Equals(normalizedReferencedClass, "SemaphoreSlim", StringComparison.Ordinal) ||
+                string.Equals(referencedTypeName, "SemaphoreSlim", StringComparison.Ordinal)) {
+                processor?.RegisterRuntimeRequirement("SemaphoreSlim");
+                return "system/threading/semaphore_slim";
+            }
+
+            if (string.Equals(referencedClass, "ReaderWriterLockSlim", StringComparison.Ordinal) ||
+                string.Equals(referencedClass, "System.Threading.ReaderWriterLockSlim", StringComparison.Ordinal) ||
+                string.Equals(normalizedReferencedClass, "ReaderWriterLockSlim", StringComparison.Ordinal) ||
+                string.Equals(referencedTypeName, "ReaderWriterLockSlim", StringComparison.Ordinal)) {
+                processor?.RegisterRuntimeRequirement("ReaderWriterLockSlim");
+                return "system/threading/reader_writer_lock_slim";
+            }
+
+            if (string.Equals(referencedClass, "Monitor", StringComparison.Ordinal) ||
+                string.Equals(referencedClass, "System.Threading.Monitor", StringComparison.Ordinal) ||
+                string.Equals(normalizedReferencedClass, "Monitor", StringComparison.Ordinal) ||
+                string.Equals(referencedTypeName, "Monitor", StringComparison.Ordinal)) {
+                processor?.RegisterRuntimeRequirement("Monitor");
+                return "system/threading/monitor";
+            }
+
+            if (string.Equals(referencedClass, "ThreadLocal", StringComparison.Ordinal) ||
+                string.Equals(referencedClass, "System.Threading.ThreadLocal", StringComparison.Ordinal) ||
+                string.Equals(normalizedReferencedClass, "ThreadLocal", StringComparison.Ordinal) ||
+                string.Equals(referencedTypeName, "ThreadLocal", StringComparison.Ordinal)) {
+                processor?.RegisterRuntimeRequirement("ThreadLocal");
+                return "system/threading/thread_local";
+            }
+
             if (string.Equals(referencedClass, "Thread", StringComparison.Ordinal) ||
                 string.Equals(referencedClass, "System.Threading.Thread", StringComparison.Ordinal) ||
                 string.Equals(normalizedReferencedClass, "Thread", StringComparison.Ordinal) ||
@@ -1052,6 +1103,35 @@ namespace cs2.cpp {
                 return "system/threading/thread";
             }
 
+            if (string.Equals(referencedClass, "ThreadPool", StringComparison.Ordinal) ||
+                string.Equals(referencedClass, "System.Threading.ThreadPool", StringComparison.Ordinal) ||
+                string.Equals(normalizedReferencedClass, "ThreadPool", StringComparison.Ordinal) ||
+                string.Equals(referencedTypeName, "ThreadPool", StringComparison.Ordinal)) {
+                processor?.RegisterRuntimeRequirement("ThreadPool");
+                return "system/threading/thread_pool";
+            }
+
+            if (string.Equals(referencedClass, "Task", StringComparison.Ordinal) ||
+                string.Equals(referencedClass, "Task_1", StringComparison.Ordinal) ||
+                string.Equals(referencedClass, "System.Threading.Tasks.Task", StringComparison.Ordinal) ||
+                string.Equals(referencedClass, "ValueTask", StringComparison.Ordinal) ||
+                string.Equals(referencedClass, "System.Threading.Tasks.ValueTask", StringComparison.Ordinal) ||
+                string.Equals(normalizedReferencedClass, "Task", StringComparison.Ordinal) ||
+                string.Equals(normalizedReferencedClass, "ValueTask", StringComparison.Ordinal) ||
+                string.Equals(referencedTypeName, "Task", StringComparison.Ordinal) ||
+                string.Equals(referencedTypeName, "ValueTask", StringComparison.Ordinal)) {
+                processor?.RegisterRuntimeRequirement("Task");
+                return "system/threading/tasks/task";
+            }
+
+            if (string.Equals(referencedClass, "Parallel", StringComparison.Ordinal) ||
+                string.Equals(referencedClass, "System.Threading.Tasks.Parallel", StringComparison.Ordinal) ||
+                string.Equals(normalizedReferencedClass, "Parallel", StringComparison.Ordinal) ||
+                string.Equals(referencedTypeName, "Parallel", StringComparison.Ordinal)) {
+                processor?.RegisterRuntimeRequirement("Parallel");
+                return "system/threading/tasks/parallel";
+            }
+
             if (string.Equals(referencedClass, "NotImplementedException", StringComparison.Ordinal) ||
                 string.Equals(referencedClass, "System.NotImplementedException", StringComparison.Ordinal) ||
                 string.Equals(normalizedReferencedClass, "NotImplementedException", StringComparison.Ordinal) ||
@@ -1176,6 +1256,14 @@ namespace cs2.cpp {
                 return "system/runtime/intrinsics/x86/sse41";
             }
 
+            if (string.Equals(referencedClass, "AdvSimd", StringComparison.Ordinal) ||
+                string.Equals(referencedClass, "System.Runtime.Intrinsics.Arm.AdvSimd", StringComparison.Ordinal) ||
+                string.Equals(normalizedReferencedClass, "AdvSimd", StringComparison.Ordinal) ||
+                string.Equals(referencedTypeName, "AdvSimd", StringComparison.Ordinal)) {
+                processor?.RegisterRuntimeRequirement("AdvSimd");
+                return "system/runtime/intrinsics/arm/adv_simd";
+            }
+
             if (string.Equals(referencedClass, "Nullable", StringComparison.Ordinal) ||
                 string.Equals(referencedClass, "System.Nullable", StringComparison.Ordinal) ||
                 string.Equals(normalizedReferencedClass, "Nullable", StringComparison.Ordinal) ||
@@ -1284,6 +1372,14 @@ namespace cs2.cpp {
                 return "system/math";
             }
 
+            if (string.Equals(referencedClass, "BitConverter", StringComparison.Ordinal) ||
+                string.Equals(referencedClass, "System.BitConverter", StringComparison.Ordinal) ||
+                string.Equals(normalizedReferencedClass, "BitConverter", StringComparison.Ordinal) ||
+                string.Equals(referencedTypeName, "BitConverter", StringComparison.Ordinal)) {
+                processor?.RegisterRuntimeRequirement("BitConverter");
+                return "system/bit_converter";
+            }
+
             if (string.Equals(referencedClass, "BitOperations", StringComparison.Ordinal) ||
                 string.Equals(referencedClass, "System.Numerics.BitOperations", StringComparison.Ordinal) ||
                 string.Equals(normalizedReferencedClass, "BitOperations", StringComparison.Ordinal) ||
@@ -1292,6 +1388,14 @@ namespace cs2.cpp {
                 return "system/bit_operations";
             }
 
+            if (string.Equals(referencedClass, "MemoryExtensions", StringComparison.Ordinal) ||
+                string.Equals(referencedClass, "System.MemoryExtensions", StringComparison.Ordinal) ||
+                string.Equals(normalizedReferencedClass, "MemoryExtensions", StringComparison.Ordinal) ||
+                string.Equals(referencedTypeName, "MemoryExtensions", StringComparison.Ordinal)) {
+                processor?.RegisterRuntimeRequirement("MemoryExtensions");
+                return "system/memory_extensions";
+            }
+
             if (string.Equals(referencedClass, "Regex", StringComparison.Ordinal) ||
                 string.Equals(referencedClass, "Match", StringComparison.Ordinal) ||
                 string.Equals(referencedClass, "MatchCollection", StringComparison.Ordinal) ||
@@ -1336,6 +1440,30 @@ namespace cs2.cpp {
                 return "system/io/stream-reader";
             }
 
+            if (string.Equals(referencedClass, "ConcurrentDictionary", StringComparison.Ordinal) ||
+                string.Equals(referencedClass, "System.Collections.Concurrent.ConcurrentDictionary", StringComparison.Ordinal) ||
+                string.Equals(normalizedReferencedClass, "ConcurrentDictionary", StringComparison.Ordinal) ||
+                string.Equals(referencedTypeName, "ConcurrentDictionary", StringComparison.Ordinal)) {
+                processor?.RegisterRuntimeRequirement("ConcurrentDictionary");
+                return "system/collections/concurrent/concurrent_dictionary";
+            }
+
+            if (string.Equals(referencedClass, "ConcurrentQueue", StringComparison.Ordinal) ||
+                string.Equals(referencedClass, "System.Collections.Concurrent.ConcurrentQueue", StringComparison.Ordinal) ||
+                string.Equals(normalizedReferencedClass, "ConcurrentQueue", StringComparison.Ordinal) ||
+                string.Equals(referencedTypeName, "ConcurrentQueue", StringComparison.Ordinal)) {
+                processor?.RegisterRuntimeRequirement("ConcurrentQueue");
+                return "system/collections/concurrent/concurrent_queue";
+            }
+
+            if (string.Equals(referencedClass, "ConcurrentBag", StringComparison.Ordinal) ||
+                string.Equals(referencedClass, "System.Collections.Concurrent.ConcurrentBag", StringComparison.Ordinal) ||
+                string.Equals(normalizedReferencedClass, "ConcurrentBag", StringComparison.Ordinal) ||
+                string.Equals(referencedTypeName, "ConcurrentBag", StringComparison.Ordinal)) {
+                processor?.RegisterRuntimeRequirement("ConcurrentBag");
+                return "system/collections/concurrent/concurrent_bag";
+            }
+
             if (string.Equals(referencedClass, "Stack", StringComparison.Ordinal) ||
                 string.Equals(referencedClass, "System.Collections.Generic.Stack", StringComparison.Ordinal) ||
                 string.Equals(normalizedReferencedClass, "Stack", StringComparison.Ordinal) ||
@@ -1422,6 +1550,12 @@ namespace cs2.cpp {
                 return "system/io/file-stream";
             }
 
+            if (TryResolveCompressionIncludePath(referencedClass, normalizedReferencedClass, out string compressionIncludePath) &&
+                !program.Classes.Any(candidate => !candidate.IsNative && candidate.Name == normalizedReferencedClass)) {
+                processor?.RegisterRuntimeRequirement("Compression");
+                return compressionIncludePath;
+            }
+
             if (string.Equals(normalizedReferencedClass, "File", StringComparison.Ordinal) &&
                 !program.Classes.Any(candidate => !candidate.IsNative && candidate.Name == "File")) {
                 processor?.RegisterRuntimeRequirement("File");
@@ -1446,6 +1580,11 @@ namespace cs2.cpp {
                 return "runtime/native_exceptions";
             }
 
+            if (IsNativeNumericsQualifiedTypeName(referencedClass)) {
+                processor?.RegisterRuntimeRequirement("NativeNumericsVectors");
+                return "system/numerics/vectors";
+            }
+
             string includePath = TryResolveIncludePath(referencedClass);
             if (!string.IsNullOrWhiteSpace(includePath) &&
                 !string.Equals(includePath, referencedClass, StringComparison.Ordinal) &&
@@ -1515,6 +1654,26 @@ namespace cs2.cpp {
                 return "runtime/native_stack";
             }
 
+            if (string.Equals(normalizedTypeName, "ConcurrentDictionary", StringComparison.Ordinal)) {
+                processor?.RegisterRuntimeRequirement("ConcurrentDictionary");
+                return "system/collections/concurrent/concurrent_dictionary";
+            }
+
+            if (string.Equals(normalizedTypeName, "ConcurrentQueue", StringComparison.Ordinal)) {
+                processor?.RegisterRuntimeRequirement("ConcurrentQueue");
+                return "system/collections/concurrent/concurrent_queue";
+            }
+
+            if (string.Equals(normalizedTypeName, "ConcurrentBag", StringComparison.Ordinal)) {
+                processor?.RegisterRuntimeRequirement("ConcurrentBag");
+                return "system/collections/concurrent/concurrent_bag";
+            }
+
+            if (string.Equals(normalizedTypeName, "ThreadLocal", StringComparison.Ordinal)) {
+                processor?.RegisterRuntimeRequirement("ThreadLocal");
+                return "system/threading/thread_local";
+            }
+
             if (string.Equals(normalizedTypeName, "Interlocked", StringComparison.Ordinal) ||
                 string.Equals(variableType.TypeName, "System.Threading.Interlocked", StringComparison.Ordinal)) {
                 processor?.RegisterRuntimeRequirement("Interlocked");
@@ -1561,12 +1720,39 @@ namespace cs2.cpp {
                 return "system/runtime/intrinsics/x86/avx2";
             }
 
+            if (string.Equals(variableType.TypeName, "AdvSimd", StringComparison.Ordinal) ||
+                string.Equals(variableType.TypeName, "System.Runtime.Intrinsics.Arm.AdvSimd", StringComparison.Ordinal)) {
+                processor?.RegisterRuntimeRequirement("AdvSimd");
+                return "system/runtime/intrinsics/arm/adv_simd";
+            }
+
             if (string.Equals(variableType.TypeName, "Thread", StringComparison.Ordinal) ||
                 string.Equals(variableType.TypeName, "System.Threading.Thread", StringComparison.Ordinal)) {
                 processor?.RegisterRuntimeRequirement("Thread");
                 return "system/threading/thread";
             }
 
+            if (string.Equals(variableType.TypeName, "ThreadPool", StringComparison.Ordinal) ||
+                string.Equals(variableType.TypeName, "System.Threading.ThreadPool", StringComparison.Ordinal)) {
+                processor?.RegisterRuntimeRequirement("ThreadPool");
+                return "system/threading/thread_pool";
+            }
+
+            if (string.Equals(variableType.TypeName, "Task", StringComparison.Ordinal) ||
+                string.Equals(variableType.TypeName, "Task_1", StringComparison.Ordinal) ||
+                string.Equals(variableType.TypeName, "System.Threading.Tasks.Task", StringComparison.Ordinal) ||
+                string.Equals(variableType.TypeName, "ValueTask", StringComparison.Ordinal) ||
+                string.Equals(variableType.TypeName, "System.Threading.Tasks.ValueTask", StringComparison.Ordinal)) {
+                processor?.RegisterRuntimeRequirement("Task");
+                return "system/threading/tasks/task";
+            }
+
+            if (string.Equals(variableType.TypeName, "Parallel", StringComparison.Ordinal) ||
+                string.Equals(variableType.TypeName, "System.Threading.Tasks.Parallel", StringComparison.Ordinal)) {
+                processor?.RegisterRuntimeRequirement("Parallel");
+                return "system/threading/tasks/parallel";
+            }
+
             if (string.Equals(variableType.TypeName, "NotImplementedException", StringComparison.Ordinal) ||
                 string.Equals(variableType.TypeName, "System.NotImplementedException", StringComparison.Ordinal)) {
                 processor?.RegisterRuntimeRequirement("NotImplementedException");
@@ -1579,6 +1765,36 @@ namespace cs2.cpp {
                 return "system/threading/spin_lock";
             }
 
+            if (string.Equals(variableType.TypeName, "ManualResetEventSlim", StringComparison.Ordinal) ||
+                string.Equals(variableType.TypeName, "System.Threading.ManualResetEventSlim", StringComparison.Ordinal)) {
+                processor?.RegisterRuntimeRequirement("ManualResetEventSlim");
+                return "system/threading/manual_reset_event_slim";
+            }
+
+            if (string.Equals(variableType.TypeName, "ManualResetEvent", StringComparison.Ordinal) ||
+                string.Equals(variableType.TypeName, "System.Threading.ManualResetEvent", StringComparison.Ordinal)) {
+                processor?.RegisterRuntimeRequirement("ManualResetEvent");
+                return "system/threading/manual_reset_event";
+            }
+
+            if (string.Equals(variableType.TypeName, "SemaphoreSlim", StringComparison.Ordinal) ||
+                string.Equals(variableType.TypeName, "System.Threading.SemaphoreSlim", StringComparison.Ordinal)) {
+                processor?.RegisterRuntimeRequirement("SemaphoreSlim");
+                return "system/threading/semaphore_slim";
+            }
+
+            if (string.Equals(variableType.TypeName, "ReaderWriterLockSlim", StringComparison.Ordinal) ||
+                string.Equals(variableType.TypeName, "System.Threading.ReaderWriterLockSlim", StringComparison.Ordinal)) {
+                processor?.RegisterRuntimeRequirement("ReaderWriterLockSlim");
+                return "system/threading/reader_writer_lock_slim";
+            }
+
+            if (string.Equals(variableType.TypeName, "Monitor", StringComparison.Ordinal) ||
+                string.Equals(variableType.TypeName, "System.Threading.Monitor", StringComparison.Ordinal)) {
+                processor?.RegisterRuntimeRequirement("Monitor");
+                return "system/threading/monitor";
+            }
+
             if (string.Equals(variableType.TypeName, "SpinWait", StringComparison.Ordinal) ||
                 string.Equals(variableType.TypeName, "System.Threading.SpinWait", StringComparison.Ordinal)) {
                 processor?.RegisterRuntimeRequirement("SpinWait");
@@ -1604,11 +1820,21 @@ namespace cs2.cpp {
                 return "system/binary_primitives";
             }
 
+            if (string.Equals(variableType.TypeName, "BitConverter", StringComparison.Ordinal)) {
+                processor?.RegisterRuntimeRequirement("BitConverter");
+                return "system/bit_converter";
+            }
+
             if (string.Equals(variableType.TypeName, "BitOperations", StringComparison.Ordinal)) {
                 processor?.RegisterRuntimeRequirement("BitOperations");
                 return "system/bit_operations";
             }
 
+            if (string.Equals(variableType.TypeName, "MemoryExtensions", StringComparison.Ordinal)) {
+                processor?.RegisterRuntimeRequirement("MemoryExtensions");
+                return "system/memory_extensions";
+            }
+
             ConversionClass nativeExceptionCandidateClass = program.FindGeneratedClass(variableType);
             if (nativeExceptionCandidateClass == null &&
                 IsNativeExceptionQualifiedTypeName(variableType.QualifiedTypeName) &&
@@ -1672,6 +1898,33 @@ namespace cs2.cpp {
             return string.Empty;
         }
 
+        /// <summary>
+        /// Resolves the runtime header for one System.IO.Compression type reference.
+        /// </summary>
+        /// <param name="referencedClass">Referenced type name as written by the converter.</param>
+        /// <param name="normalizedReferencedClass">Referenced type name without namespace qualification.</param>
+        /// <param name="includePath">Runtime include path without extension when the type is a supported compression type.</param>
+        /// <returns><c>true</c> when the reference names a compression stream or enum; otherwise <c>false</c>.</returns>
+        static bool TryResolveCompressionIncludePath(string referencedClass, string normalizedReferencedClass, out string includePath) {
+            includePath = string.Empty;
+            if (referencedClass != null &&
+                referencedClass.Contains('.', StringComparison.Ordinal) &&
+                !referencedClass.StartsWith("System.IO.Compression.", StringComparison.Ordinal) &&
+                !referencedClass.StartsWith("global::System.IO.Compression.", StringComparison.Ordinal)) {
+                return false;
+            }
+
+            includePath = normalizedReferencedClass switch {
+                "DeflateStream" => "system/io/compression/deflate-stream",
+                "GZipStream" => "system/io/compression/gzip-stream",
+                "ZLibStream" => "system/io/compression/zlib-stream",
+                "CompressionMode" => "system/io/compression/compression-mode",
+                "CompressionLevel" => "system/io/compression/compression-level",
+                _ => string.Empty
+            };
+            return includePath.Length > 0;
+        }
+
         /// <summary>
         /// Collapses a namespace-qualified type reference to the leaf type name used by generated headers.
         /// </summary>
@@ -2653,11 +2906,31 @@ namespace cs2.cpp {
         }
 
         string GetFieldDeclaration(ConversionClass conversionClass, ConversionVariable variable, string indent) {
-            string staticKeyword = variable.IsStatic ? "static " : string.Empty;
-            string typeName = ConvertType(variable.VarType, conversionClass);
+            string staticKeyword = variable.IsStatic ? GetStaticFieldStorageKeyword(variable) : string.Empty;
+            string typeName = ConvertFieldType(conversionClass, variable);
             return $"{indent}{staticKeyword}{typeName} {variable.Name};";
         }
 
+        /// <summary>
+        /// Renders a field type, expanding event fields to the runtime event template typed by the delegate signature.
+        /// </summary>
+        /// <param name="conversionClass">Class that owns the field.</param>
+        /// <param name="variable">Field being emitted.</param>
+        /// <returns>The native field type.</returns>
+        string ConvertFieldType(ConversionClass conversionClass, ConversionVariable variable) {
+            string typeName = ConvertType(variable.VarType, conversionClass);
+            if (!string.Equals(variable.VarType?.TypeName, "Event", StringComparison.Ordinal)) {
+                return typeName;
+            }
+
+            if (!processor.TryGetEventArgumentTypes(conversionClass, variable.Name, program, out List<string> argumentTypes)) {
+                processor.ReportUnresolvedEventSignature(conversionClass, variable.Name);
+                return $"{typeName}<>";
+            }
+
+            return $"{typeName}<{QualifyRenderedTypeName(string.Join(", ", argumentTypes), conversionClass, null)}>";
+        }
+
         void WriteExplicitLayoutFields(ConversionClass conversionClass, TextWriter headerWriter, TextWriter sourceWriter) {
             List<ConversionVariable> fields = conversionClass.Variables
                 .Where(IsExplicitLayoutInstanceField)
@@ -3025,6 +3298,17 @@ namespace cs2.cpp {
             return variable?.AssignmentExpression is LiteralExpressionSyntax;
         }
 
+        /// <summary>
+        /// Resolves the storage keywords for one static field declaration. [ThreadStatic] fields become thread_local so every
+        /// thread gets its own copy; unlike the managed runtime, a field initializer runs on each thread's first use rather
+        /// than only on the thread that ran the static constructor.
+        /// </summary>
+        /// <param name="variable">Static field being declared.</param>
+        /// <returns>The keywords that precede the field type.</returns>
+        static string GetStaticFieldStorageKeyword(ConversionVariable variable) {
+            return variable.IsThreadStatic ? "static thread_local " : "static ";
+        }
+
         /// <summary>
         /// Writes one out-of-class definition for a static field so generated translation units satisfy native linkage.
         /// </summary>
@@ -3034,9 +3318,10 @@ namespace cs2.cpp {
         void WriteStaticFieldDefinition(ConversionClass conversionClass, ConversionVariable variable, TextWriter sourceWriter) {
             WriteTemplateDeclaration(conversionClass, sourceWriter);
 
-            string typeName = ConvertType(variable.VarType, conversionClass);
+            string typeName = ConvertFieldType(conversionClass, variable);
             string constQualifier = variable.IsConst ? "const " : string.Empty;
-            sourceWriter.Write($"{constQualifier}{typeName} {GetQualifiedClassName(conversionClass)}::{variable.Name}");
+            string threadLocalKeyword = variable.IsThreadStatic ? "thread_local " : string.Empty;
+            sourceWriter.Write($"{threadLocalKeyword}{constQualifier}{typeName} {GetQualifiedClassName(conversionClass)}::{variable.Name}");
 
             if (TryWriteStaticFieldInitializer(conversionClass, variable, sourceWriter)) {
                 sourceWriter.WriteLine(";");
@@ -3450,6 +3735,36 @@ namespace cs2.cpp {
             }
 
             headerWriter.WriteLine(";");
+
+            if (UsesSimdFunctionDispatch(conversionClass, function)) {
+                WriteSimdDispatchCloneDeclarations(conversionClass, function, headerWriter);
+            }
+        }
+
+        /// <summary>
+        /// Declares the per-instruction-set clones behind one SIMD-dispatched function, guarded like their definitions.
+        /// </summary>
+        /// <param name="conversionClass">The class that owns the function.</param>
+        /// <param name="function">The dispatched function.</param>
+        /// <param name="headerWriter">Writer that receives the declarations.</param>
+        void WriteSimdDispatchCloneDeclarations(ConversionClass conversionClass, ConversionFunction function, TextWriter headerWriter) {
+            headerWriter.WriteLine("#if HE_CPP_SIMD_FUNCTION_DISPATCH");
+            foreach ((string suffix, string targetMacro) in SimdDispatchClones) {
+                headerWriter.Write("    ");
+                if (function.IsStatic) {
+                    headerWriter.Write("static ");
+                }
+
+                headerWriter.Write($"{targetMacro}{GetReturnType(conversionClass, function)} {GetFunctionName(conversionClass, function)}{suffix}(");
+                WriteParameters(conversionClass, function, headerWriter);
+                headerWriter.Write(")");
+                if (ShouldEmitConstInstanceMember(conversionClass, function)) {
+                    headerWriter.Write(" const");
+                }
+
+                headerWriter.WriteLine(";");
+            }
+            headerWriter.WriteLine("#endif");
         }
 
         /// <summary>
@@ -3467,41 +3782,190 @@ namespace cs2.cpp {
                 return;
             }
 
+            StringWriter bodyWriter = new StringWriter();
+            WriteGeneratedFunctionProfilingScope(bodyWriter, conversionClass, function);
+
+            WriteValueTypeInParameterCopies(conversionClass, function, bodyWriter);
+
+            if (function.IsConstructor &&
+                ShouldEmitExplicitLayoutFieldAssignments(conversionClass) &&
+                !ConstructorDelegatesToThis(function)) {
+                WriteExplicitLayoutFieldAssignments(conversionClass, bodyWriter);
+            }
+
+            if (functionBodyOverrideCatalog.TryWriteOverride(processor?.Options, conversionClass, function, bodyWriter)) {
+            } else if (function.HasBody) {
+                function.WriteLines(processor, program, conversionClass, bodyWriter);
+            } else {
+                bodyWriter.WriteLine("throw new NotSupportedException(\"Method has no generated body.\");");
+            }
+
+            if (!UsesSimdFunctionDispatch(conversionClass, function)) {
+                WriteFunctionDefinitionSignature(conversionClass, function, GetFunctionName(conversionClass, function), string.Empty, sourceWriter);
+                WriteConstructorInitializer(conversionClass, function, sourceWriter);
+                sourceWriter.WriteLine();
+                sourceWriter.WriteLine("{");
+                sourceWriter.Write(bodyWriter.ToString());
+                sourceWriter.WriteLine("}");
+                sourceWriter.WriteLine();
+                return;
+            }
+
+            processor?.RegisterRuntimeRequirement("SimdDispatch");
+            sourceWriter.WriteLine("#if HE_CPP_SIMD_FUNCTION_DISPATCH");
+            WriteSimdDispatchResolver(conversionClass, function, sourceWriter);
+            foreach ((string suffix, string targetMacro) in SimdDispatchClones) {
+                WriteFunctionDefinitionSignature(conversionClass, function, GetFunctionName(conversionClass, function) + suffix, targetMacro, sourceWriter);
+                sourceWriter.WriteLine();
+                sourceWriter.WriteLine("{");
+                sourceWriter.Write(bodyWriter.ToString());
+                sourceWriter.WriteLine("}");
+                sourceWriter.WriteLine();
+            }
+
+            sourceWriter.WriteLine("#else");
+            WriteFunctionDefinitionSignature(conversionClass, function, GetFunctionName(conversionClass, function), string.Empty, sourceWriter);
+            sourceWriter.WriteLine();
+            sourceWriter.WriteLine("{");
+            sourceWriter.Write(bodyWriter.ToString());
+            sourceWriter.WriteLine("}");
+            sourceWriter.WriteLine("#endif");
+            sourceWriter.WriteLine();
+        }
+
+        /// <summary>
+        /// Writes the template lines, return type, qualified name, lowered parameters, and receiver qualifier that open one member function definition.
+        /// </summary>
+        /// <param name="conversionClass">The class that owns the function.</param>
+        /// <param name="function">The function being defined.</param>
+        /// <param name="emittedName">Name written after the class qualification.</param>
+        /// <param name="targetMacro">Instruction-set attribute macro, including its trailing space, or an empty string.</param>
+        /// <param name="sourceWriter">Writer that receives the signature.</param>
+        void WriteFunctionDefinitionSignature(ConversionClass conversionClass, ConversionFunction function, string emittedName, string targetMacro, TextWriter sourceWriter) {
             WriteTemplateDeclaration(conversionClass, sourceWriter);
             WriteFunctionTemplateDeclaration(function, sourceWriter, string.Empty);
+            sourceWriter.Write(targetMacro);
 
             if (!function.IsConstructor) {
                 sourceWriter.Write($"{GetReturnType(conversionClass, function)} ");
             }
 
-            sourceWriter.Write($"{GetQualifiedClassName(conversionClass)}::{GetFunctionName(conversionClass, function)}(");
+            sourceWriter.Write($"{GetQualifiedClassName(conversionClass)}::{emittedName}(");
             WriteParameters(conversionClass, function, sourceWriter, true);
             sourceWriter.Write(")");
             if (ShouldEmitConstInstanceMember(conversionClass, function)) {
                 sourceWriter.Write(" const");
             }
-            WriteConstructorInitializer(conversionClass, function, sourceWriter);
+        }
+
+        /// <summary>
+        /// Writes the definition that binds the widest clone the running CPU supports on first call and forwards every later call to it.
+        /// </summary>
+        /// <param name="conversionClass">The class that owns the function.</param>
+        /// <param name="function">The dispatched function.</param>
+        /// <param name="sourceWriter">Writer that receives the resolver.</param>
+        void WriteSimdDispatchResolver(ConversionClass conversionClass, ConversionFunction function, TextWriter sourceWriter) {
+            string qualifiedClassName = GetQualifiedClassName(conversionClass);
+            string functionName = GetFunctionName(conversionClass, function);
+            string returnType = GetReturnType(conversionClass, function);
+            string parameterTypes = string.Join(", ", function.InParameters.Select(parameter => GetParameterType(parameter, conversionClass, function)));
+            string arguments = string.Join(", ", function.InParameters.Select(parameter => {
+                string parameterType = GetParameterType(parameter, conversionClass, function);
+                return parameterType.EndsWith("&", StringComparison.Ordinal) ? parameter.Name : $"std::move({parameter.Name})";
+            }));
+            bool isConstInstanceMember = ShouldEmitConstInstanceMember(conversionClass, function);
+            string functionPointerType = function.IsStatic
+                ? $"{returnType} (*)({parameterTypes})"
+                : $"{returnType} ({qualifiedClassName}::*)({parameterTypes}){(isConstInstanceMember ? " const" : string.Empty)}";
+
+            WriteTemplateDeclaration(conversionClass, sourceWriter);
+            sourceWriter.Write($"{returnType} {qualifiedClassName}::{functionName}(");
+            WriteParameters(conversionClass, function, sourceWriter);
+            sourceWriter.Write(")");
+            if (isConstInstanceMember) {
+                sourceWriter.Write(" const");
+            }
             sourceWriter.WriteLine();
             sourceWriter.WriteLine("{");
-            WriteGeneratedFunctionProfilingScope(sourceWriter, conversionClass, function);
+            string clones = string.Join(", ", SimdDispatchClones.Select(clone => $"&{qualifiedClassName}::{functionName}{clone.Suffix}"));
+            sourceWriter.WriteLine($"static const auto implementation = SimdDispatch::Select<{functionPointerType}>({clones});");
+            sourceWriter.WriteLine(function.IsStatic
+                ? $"return implementation({arguments});"
+                : $"return (this->*implementation)({arguments});");
+            sourceWriter.WriteLine("}");
+            sourceWriter.WriteLine();
+        }
 
-            WriteValueTypeInParameterCopies(conversionClass, function, sourceWriter);
+        /// <summary>
+        /// Clone suffixes for SIMD-dispatched functions, each paired with the runtime macro that compiles the clone for its instruction set.
+        /// </summary>
+        static readonly (string Suffix, string TargetMacro)[] SimdDispatchClones = {
+            ("_SimdBaseline", string.Empty),
+            ("_SimdAvx2", "HE_CPP_AVX2_TARGET "),
+            ("_SimdAvx512", "HE_CPP_AVX512_TARGET ")
+        };
 
-            if (function.IsConstructor &&
-                ShouldEmitExplicitLayoutFieldAssignments(conversionClass) &&
-                !ConstructorDelegatesToThis(function)) {
-                WriteExplicitLayoutFieldAssignments(conversionClass, sourceWriter);
+        /// <summary>
+        /// Determines whether one method is emitted as per-instruction-set clones behind a resolver. Methods that branch on
+        /// Avx/Avx2/Avx512 support or on Vector256/Vector512 acceleration qualify, so inside each clone the vector kernels
+        /// compile for the instruction set that clone runs on; constructors, operators, generic methods, and property accessors do not.
+        /// </summary>
+        /// <param name="conversionClass">The class that owns the function.</param>
+        /// <param name="function">The function being emitted.</param>
+        /// <returns><c>true</c> when the function body queries x86 SIMD support; otherwise <c>false</c>.</returns>
+        static bool UsesSimdFunctionDispatch(ConversionClass conversionClass, ConversionFunction function) {
+            if (function == null ||
+                !function.HasBody ||
+                function.IsConstructor ||
+                function.IsAsync ||
+                IsNativeFreeFunctionStub(function) ||
+                IsFreeOperatorFunction(function) ||
+                HasMethodLevelGenericParameters(function) ||
+                ShouldSkipFunctionDefinition(conversionClass, function) ||
+                !conversionClass.Functions.Contains(function)) {
+                return false;
             }
 
-            if (functionBodyOverrideCatalog.TryWriteOverride(processor?.Options, conversionClass, function, sourceWriter)) {
-            } else if (function.HasBody) {
-                function.WriteLines(processor, program, conversionClass, sourceWriter);
-            } else {
-                sourceWriter.WriteLine("throw new NotSupportedException(\"Method has no generated body.\");");
+            SemanticModel semantic = function.Semantic ?? conversionClass.Semantic;
+            if (semantic == null) {
+                return false;
             }
 
-            sourceWriter.WriteLine("}");
-            sourceWriter.WriteLine();
+            foreach (SyntaxNode rootNode in EnumerateFunctionBodyRoots(function)) {
+                foreach (SimpleNameSyntax nameSyntax in rootNode.DescendantNodesAndSelf().OfType<SimpleNameSyntax>()) {
+                    string name = nameSyntax.Identifier.ValueText;
+                    if ((name == "IsSupported" || name == "IsHardwareAccelerated") &&
+                        semantic.GetSymbolInfo(nameSyntax).Symbol is IPropertySymbol property &&
+                        IsSimdSupportQuery(property)) {
+                        return true;
+                    }
+                }
+            }
+
+            return false;
+        }
+
+        /// <summary>
+        /// Determines whether one property reports AVX-family support: <c>IsSupported</c> on Avx, Avx2, or an Avx512 class, or
+        /// <c>IsHardwareAccelerated</c> on Vector256 or Vector512.
+        /// </summary>
+        /// <param name="property">Property referenced from a function body.</param>
+        /// <returns><c>true</c> when the property is one of the dispatching queries; otherwise <c>false</c>.</returns>
+        static bool IsSimdSupportQuery(IPropertySymbol property) {
+            INamedTypeSymbol ownerType = property.ContainingType;
+            while (ownerType?.ContainingType != null) {
+                ownerType = ownerType.ContainingType;
+            }
+
+            string ownerNamespace = ownerType?.ContainingNamespace?.ToDisplayString();
+            if (property.Name == "IsSupported") {
+                return ownerNamespace == "System.Runtime.Intrinsics.X86" &&
+                    (ownerType.Name == "Avx" || ownerType.Name == "Avx2" || ownerType.Name.StartsWith("Avx512", StringComparison.Ordinal));
+            }
+
+            return property.Name == "IsHardwareAccelerated" &&
+                ownerNamespace == "System.Runtime.Intrinsics" &&
+                (ownerType.Name == "Vector256" || ownerType.Name == "Vector512");
         }
 
         static bool IsNativeFreeFunctionStub(ConversionFunction function) {
@@ -4084,12 +4548,33 @@ namespace cs2.cpp {
             return string.Equals(typeName, "Stream", StringComparison.Ordinal) ||
                 string.Equals(typeName, "FileStream", StringComparison.Ordinal) ||
                 string.Equals(typeName, "MemoryStream", StringComparison.Ordinal) ||
+                string.Equals(typeName, "DeflateStream", StringComparison.Ordinal) ||
+                string.Equals(typeName, "GZipStream", StringComparison.Ordinal) ||
+                string.Equals(typeName, "ZLibStream", StringComparison.Ordinal) ||
                 string.Equals(typeName, "Span", StringComparison.Ordinal) ||
                 string.Equals(typeName, "ReadOnlySpan", StringComparison.Ordinal) ||
                 string.Equals(typeName, "Event", StringComparison.Ordinal) ||
                 string.Equals(typeName, "MathF", StringComparison.Ordinal);
         }
 
+        /// <summary>
+        /// Determines whether an include candidate names one of the System.Numerics math value types in system/numerics/vectors.hpp.
+        /// </summary>
+        /// <param name="typeName">Fully qualified managed type name, optionally prefixed by the Roslyn global alias.</param>
+        /// <returns><c>true</c> only for the exact framework names, so same-named engine types keep their generated headers.</returns>
+        static bool IsNativeNumericsQualifiedTypeName(string typeName) {
+            if (typeName != null && typeName.StartsWith("global::", StringComparison.Ordinal)) {
+                typeName = typeName[8..];
+            }
+
+            return string.Equals(typeName, "System.Numerics.Vector2", StringComparison.Ordinal) ||
+                string.Equals(typeName, "System.Numerics.Vector3", StringComparison.Ordinal) ||
+                string.Equals(typeName, "System.Numerics.Vector4", StringComparison.Ordinal) ||
+                string.Equals(typeName, "System.Numerics.Quaternion", StringComparison.Ordinal) ||
+                string.Equals(typeName, "System.Numerics.Plane", StringComparison.Ordinal) ||
+                string.Equals(typeName, "System.Numerics.Matrix4x4", StringComparison.Ordinal);
+        }
+
         /// <summary>
         /// Determines whether an include candidate carries the full managed identity of one native runtime exception.
         /// </summary>
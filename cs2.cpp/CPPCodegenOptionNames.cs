@@ -18,6 +18,11 @@ namespace cs2.cpp {
         /// </summary>
         public const string CompactNativeExceptionMessages = "codegen-compact-native-exception-messages";
 
+        /// <summary>
+        /// Gets the generic option name that fixes the native thread-pool worker count; zero runs pool work inline on the scheduling thread.
+        /// </summary>
+        public const string ThreadPoolWorkerCount = "codegen-thread-pool-worker-count";
+
         /// <summary>
         /// Gets the generic option name that enables direct Tracy scopes for generated C++ function bodies.
         /// </summary>
@@ -221,7 +221,8 @@ namespace cs2.cpp {
                     "HELENGINE_CODEGEN_DISABLE_MENU_REFLECTION"
                 },
                 PlatformOptionValues = new Dictionary<string, string>(StringComparer.OrdinalIgnoreCase) {
-                    [CPPCodegenOptionNames.ForcedDisabledFeatures] = "shaders;debug_overlay"
+                    [CPPCodegenOptionNames.ForcedDisabledFeatures] = "shaders;debug_overlay",
+                    [CPPCodegenOptionNames.ThreadPoolWorkerCount] = "0"
                 }
             };
         }
@@ -243,7 +244,8 @@ namespace cs2.cpp {
                 IncludeProjectDefinedPreprocessorSymbols = false,
                 AdditionalPreprocessorSymbols = Array.Empty<string>(),
                 PlatformOptionValues = new Dictionary<string, string>(StringComparer.OrdinalIgnoreCase) {
-                    [CPPCodegenOptionNames.ForcedDisabledFeatures] = "debug_overlay"
+                    [CPPCodegenOptionNames.ForcedDisabledFeatures] = "debug_overlay",
+                    [CPPCodegenOptionNames.ThreadPoolWorkerCount] = "0"
                 }
             };
         }
@@ -271,7 +273,8 @@ namespace cs2.cpp {
                     "HELENGINE_CODEGEN_DISABLE_MENU_REFLECTION"
                 },
                 PlatformOptionValues = new Dictionary<string, string>(StringComparer.OrdinalIgnoreCase) {
-                    [CPPCodegenOptionNames.ForcedDisabledFeatures] = "shaders;debug_overlay"
+                    [CPPCodegenOptionNames.ForcedDisabledFeatures] = "shaders;debug_overlay",
+                    [CPPCodegenOptionNames.ThreadPoolWorkerCount] = "1"
                 }
             };
         }
@@ -300,7 +303,8 @@ namespace cs2.cpp {
                     "HELENGINE_CODEGEN_DISABLE_MENU_REFLECTION"
                 },
                 PlatformOptionValues = new Dictionary<string, string>(StringComparer.OrdinalIgnoreCase) {
-                    [CPPCodegenOptionNames.ForcedDisabledFeatures] = "shaders;debug_overlay;render2d;text2d"
+                    [CPPCodegenOptionNames.ForcedDisabledFeatures] = "shaders;debug_overlay;render2d;text2d",
+                    [CPPCodegenOptionNames.ThreadPoolWorkerCount] = "0"
                 }
             };
         }
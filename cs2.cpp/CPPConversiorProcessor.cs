@@ -9,6 +9,7 @@ using System.Text.RegularExpressions;
 namespace cs2.cpp {
     public class CPPConversiorProcessor : ConversionProcessor {
         private CPPCodeConverter codeConverter;
+        private readonly HashSet<string> reportedUnresolvedEventSignatures = new HashSet<string>(StringComparer.Ordinal);
         private int temporaryNameCounter;
 
         public CPPConversiorProcessor(CPPCodeConverter converter) {
@@ -1472,6 +1473,11 @@ namespace cs2.cpp {
             VariableType returnType = localFunctionStatement.ReturnType == null
                 ? new VariableType(VariableDataType.Void, "void")
                 : VariableUtil.GetVarType(localFunctionStatement.ReturnType, semantic);
+            CPPCoroutineKind coroutineKind = GetCoroutineKind(semantic, localFunctionStatement);
+            bool captureThis = coroutineKind == CPPCoroutineKind.AsyncVoid && CanCaptureThis(semantic, localFunctionStatement);
+            if (coroutineKind != CPPCoroutineKind.None) {
+                RegisterRuntimeRequirement("Task");
+            }
 
             ConversionFunction localFunction = new ConversionFunction();
             localFunction.Name = localFunctionStatement.Identifier.Text;
@@ -1490,7 +1496,9 @@ namespace cs2.cpp {
 
             if (localFunctionStatement.Body != null) {
                 lines.Add(" {\n");
+                AppendCoroutineBodyPrologue(coroutineKind, captureThis, lines);
                 ProcessBlock(semantic, context, localFunctionStatement.Body, lines, depth);
+                AppendCoroutineBodyEpilogue(coroutineKind, lines);
                 lines.Add("};\n");
                 context.PopFunction(functionDepth);
                 return new ExpressionResult(true, VariablePath.FunctionStack, returnType);
@@ -1498,7 +1506,10 @@ namespace cs2.cpp {
 
             if (localFunctionStatement.ExpressionBody != null) {
                 lines.Add(" { ");
-                if (returnType.Type != VariableDataType.Void) {
+                AppendCoroutineBodyPrologue(coroutineKind, captureThis, lines);
+                if (coroutineKind == CPPCoroutineKind.AsyncTaskWithResult) {
+                    lines.Add("co_return ");
+                } else if (coroutineKind == CPPCoroutineKind.None && returnType.Type != VariableDataType.Void) {
                     lines.Add("return ");
                 }
 
@@ -1506,7 +1517,9 @@ namespace cs2.cpp {
                 ExpressionResult expressionResult = ProcessExpression(semantic, context, localFunctionStatement.ExpressionBody.Expression, lines);
                 context.PopClass(start);
 
-                lines.Add("; };\n");
+                lines.Add("; ");
+                AppendCoroutineBodyEpilogue(coroutineKind, lines);
+                lines.Add("};\n");
                 context.PopFunction(functionDepth);
                 return new ExpressionResult(expressionResult.Processed, VariablePath.FunctionStack, returnType);
             }
@@ -1646,6 +1659,10 @@ namespace cs2.cpp {
                 return;
             }
 
+            if (TryProcessDelegateCombineAssignment(semantic, context, assignment, lines)) {
+                return;
+            }
+
             if (TryProcessDiscardAssignmentExpression(semantic, context, assignment, lines)) {
                 return;
             }
@@ -1666,6 +1683,10 @@ namespace cs2.cpp {
                 return;
             }
 
+            if (TryProcessConcurrentDictionaryIndexerAssignment(semantic, context, assignment, lines)) {
+                return;
+            }
+
             if (TryProcessComputedPropertyAssignment(semantic, context, assignment, lines)) {
                 return;
             }
@@ -1760,6 +1781,113 @@ namespace cs2.cpp {
             }
         }
 
+        /// <summary>
+        /// Lowers <c>+=</c> and <c>-=</c> on delegate-typed fields, properties, and locals through the multicast runtime so the target keeps every combined handler.
+        /// </summary>
+        /// <param name="semantic">Semantic model used to resolve the target delegate type and method groups.</param>
+        /// <param name="context">Current C++ lowering context.</param>
+        /// <param name="assignment">Compound assignment that may combine or remove delegates.</param>
+        /// <param name="lines">Output token buffer receiving the rewritten assignment.</param>
+        /// <returns><c>true</c> when a delegate combine or remove was emitted; otherwise <c>false</c>.</returns>
+        bool TryProcessDelegateCombineAssignment(
+            SemanticModel semantic,
+            LayerContext context,
+            AssignmentExpressionSyntax assignment,
+            List<string> lines) {
+            if (semantic == null ||
+                context == null ||
+                assignment == null ||
+                lines == null ||
+                !assignment.IsKind(SyntaxKind.AddAssignmentExpression) &&
+                !assignment.IsKind(SyntaxKind.SubtractAssignmentExpression) ||
+                IsEventExpression(semantic, assignment.Left) ||
+                !TryGetAssignmentTargetTypeSymbol(semantic, assignment.Left, out ITypeSymbol targetTypeSymbol) ||
+                targetTypeSymbol is not INamedTypeSymbol delegateTypeSymbol ||
+                delegateTypeSymbol.TypeKind != TypeKind.Delegate) {
+                return false;
+            }
+
+            List<string> targetLines = new List<string>();
+            int startDepth = context.DepthClass;
+            ExpressionResult targetResult = ProcessExpression(semantic, context, assignment.Left, targetLines);
+            context.PopClass(startDepth);
+
+            List<string> valueLines = new List<string>();
+            startDepth = context.DepthClass;
+            ExpressionResult valueResult = ProcessExpression(semantic, context, assignment.Right, valueLines);
+            context.PopClass(startDepth);
+
+            // Lambdas and method groups become stack temporaries: Remove only compares them and Combine copies them
+            // into the delegate it returns, so neither path needs a heap wrapper for the operand.
+            List<string> delegateValueLines = new List<string>();
+            IMethodSymbol methodGroupSymbol = assignment.Right is AnonymousFunctionExpressionSyntax
+                ? null
+                : ResolveMethodSymbol(semantic.GetSymbolInfo(assignment.Right));
+            if (assignment.Right is AnonymousFunctionExpressionSyntax &&
+                TryGetDelegateLambdaWrapperTypeName(delegateTypeSymbol, context, out string delegateWrapperTypeName)) {
+                delegateValueLines.Add(QualifyRenderedCppTypeName(delegateWrapperTypeName, context));
+                delegateValueLines.Add("(");
+                delegateValueLines.AddRange(valueLines);
+                delegateValueLines.Add(")");
+            } else if (methodGroupSymbol == null ||
+                !TryAppendDelegateWrapperConstruction(semantic, context, delegateTypeSymbol, methodGroupSymbol, assignment.Right, delegateValueLines, false)) {
+                delegateValueLines.Clear();
+                delegateValueLines.AddRange(valueLines);
+            }
+
+            if (targetResult.BeforeLines != null && targetResult.BeforeLines.Count > 0) {
+                lines.AddRange(targetResult.BeforeLines);
+            }
+
+            RegisterRuntimeRequirement("MulticastDelegate");
+            string targetText = string.Concat(targetLines);
+            if (!IsRepeatableDelegateTarget(assignment.Left)) {
+                // The target is both read and written, so bind it once to keep receiver side effects single.
+                string targetName = CreateTemporaryName("__delegateTarget");
+                lines.Add($"auto& {targetName} = {targetText};\n");
+                targetText = targetName;
+            }
+            if (valueResult.BeforeLines != null && valueResult.BeforeLines.Count > 0) {
+                lines.AddRange(valueResult.BeforeLines);
+            }
+
+            lines.Add(targetText);
+            lines.Add(assignment.IsKind(SyntaxKind.AddAssignmentExpression)
+                ? " = MulticastDelegate::Combine("
+                : " = MulticastDelegate::Remove(");
+            lines.Add(targetText);
+            lines.Add(", ");
+            lines.AddRange(delegateValueLines);
+            lines.Add(")");
+
+            bool hasTargetAfterLines = targetResult.AfterLines != null && targetResult.AfterLines.Count > 0;
+            bool hasValueAfterLines = valueResult.AfterLines != null && valueResult.AfterLines.Count > 0;
+            if (hasTargetAfterLines || hasValueAfterLines) {
+                lines.Add(";\n");
+                if (hasTargetAfterLines) {
+                    lines.AddRange(targetResult.AfterLines);
+                }
+                if (hasValueAfterLines) {
+                    lines.AddRange(valueResult.AfterLines);
+                }
+            }
+            return true;
+        }
+
+        /// <summary>
+        /// Determines whether a delegate assignment target can be rendered twice without repeating side effects.
+        /// </summary>
+        /// <param name="target">Assignment target syntax.</param>
+        /// <returns><c>true</c> for locals, <c>this</c>, and member chains over them; otherwise <c>false</c>.</returns>
+        static bool IsRepeatableDelegateTarget(ExpressionSyntax target) {
+            return target switch {
+                IdentifierNameSyntax or ThisExpressionSyntax or BaseExpressionSyntax => true,
+                ParenthesizedExpressionSyntax parenthesized => IsRepeatableDelegateTarget(parenthesized.Expression),
+                MemberAccessExpressionSyntax memberAccess => IsRepeatableDelegateTarget(memberAccess.Expression),
+                _ => false
+            };
+        }
+
         /// <summary>
         /// Lowers one same-type checked integral add-assignment through a native helper that validates the result before writing the target.
         /// </summary>
@@ -2163,14 +2291,65 @@ namespace cs2.cpp {
                 return false;
             }
 
-            lines.Add("Event::Bind(");
-            lines.Add(receiverText);
-            lines.Add(", ");
+            lines.Add("BindEventHandler<");
             lines.Add(RenderQualifiedMethodPointerTarget(methodGroupSymbol, context));
+            lines.Add(">(");
+            lines.Add(receiverText);
             lines.Add(")");
             return true;
         }
 
+        /// <summary>
+        /// Resolves the native parameter types of one event's delegate signature so the field can use the typed runtime event.
+        /// </summary>
+        /// <param name="conversionClass">Class that declares the event.</param>
+        /// <param name="eventName">Declared event name.</param>
+        /// <param name="program">Program used to render native type tokens.</param>
+        /// <param name="argumentTypes">Native parameter type tokens in declaration order.</param>
+        /// <returns><c>true</c> when the event and its delegate signature were resolved; otherwise, <c>false</c>.</returns>
+        public bool TryGetEventArgumentTypes(
+            ConversionClass conversionClass,
+            string eventName,
+            ConversionProgram program,
+            out List<string> argumentTypes) {
+            argumentTypes = new List<string>();
+            IEventSymbol eventSymbol = conversionClass?.TypeSymbol?
+                .GetMembers(eventName)
+                .OfType<IEventSymbol>()
+                .FirstOrDefault();
+            if (eventSymbol?.Type is not INamedTypeSymbol delegateTypeSymbol ||
+                delegateTypeSymbol.DelegateInvokeMethod == null) {
+                return false;
+            }
+
+            foreach (IParameterSymbol parameterSymbol in delegateTypeSymbol.DelegateInvokeMethod.Parameters) {
+                argumentTypes.Add(GetCppParameterTypeToken(parameterSymbol, program));
+            }
+
+            return true;
+        }
+
+        /// <summary>
+        /// Records that one event field could not be typed because its delegate signature did not resolve.
+        /// </summary>
+        /// <param name="conversionClass">Class that declares the event.</param>
+        /// <param name="eventName">Declared event name.</param>
+        public void ReportUnresolvedEventSignature(ConversionClass conversionClass, string eventName) {
+            if (codeConverter == null ||
+                !reportedUnresolvedEventSignatures.Add($"{conversionClass?.Name}.{eventName}")) {
+                return;
+            }
+
+            string filePath = conversionClass?.TypeSymbol?.Locations.FirstOrDefault()?.SourceTree?.FilePath ?? string.Empty;
+            codeConverter.ReportUnsupportedConstruct(
+                conversionClass?.Name ?? string.Empty,
+                eventName,
+                nameof(SyntaxKind.EventFieldDeclaration),
+                $"Event '{eventName}' has no resolvable delegate signature, so its native Event<...> argument types are unknown.",
+                "Declare the event with a concrete delegate type such as Action<T> or a named delegate.",
+                filePath);
+        }
+
         bool TryGetDelegateLambdaWrapperTypeName(
             INamedTypeSymbol delegateTypeSymbol,
             LayerContext context,
@@ -3949,11 +4128,9 @@ namespace cs2.cpp {
                 return false;
             }
 
-            lines.Add("std::bind_front(");
-            lines.Add(RenderQualifiedMethodPointerTarget(methodGroupSymbol, context));
-            lines.Add(", ");
             lines.Add(receiverText);
-            lines.Add(")");
+            lines.Add(", ");
+            lines.Add(RenderQualifiedMethodPointerTarget(methodGroupSymbol, context));
             return true;
         }
 
@@ -4240,6 +4417,12 @@ namespace cs2.cpp {
                 return true;
             }
 
+            if (TryMapCompressionStreamTypeName(shortTypeName, qualifiedTypeName, out string compressionStreamTypeName)) {
+                runtimeTypeName = compressionStreamTypeName;
+                runtimeRequirementName = "Compression";
+                return true;
+            }
+
             if (string.Equals(shortTypeName, "Guid", StringComparison.Ordinal) ||
                 string.Equals(shortTypeName, "System.Guid", StringComparison.Ordinal) ||
                 string.Equals(shortTypeName, "global::System.Guid", StringComparison.Ordinal) ||
@@ -4253,6 +4436,31 @@ namespace cs2.cpp {
             return false;
         }
 
+        /// <summary>
+        /// Maps one System.IO.Compression stream construction to its runtime stream type.
+        /// </summary>
+        /// <param name="shortTypeName">Type name as written in the object creation expression.</param>
+        /// <param name="qualifiedTypeName">Fully qualified type name resolved by the semantic model.</param>
+        /// <param name="runtimeTypeName">Runtime stream type name when the construction targets a compression stream.</param>
+        /// <returns><c>true</c> for DeflateStream, GZipStream, and ZLibStream constructions; otherwise <c>false</c>.</returns>
+        static bool TryMapCompressionStreamTypeName(string shortTypeName, string qualifiedTypeName, out string runtimeTypeName) {
+            string[] compressionStreamTypeNames = { "DeflateStream", "GZipStream", "ZLibStream" };
+            foreach (string compressionStreamTypeName in compressionStreamTypeNames) {
+                string managedTypeName = "System.IO.Compression." + compressionStreamTypeName;
+                if (string.Equals(shortTypeName, compressionStreamTypeName, StringComparison.Ordinal) ||
+                    string.Equals(shortTypeName, managedTypeName, StringComparison.Ordinal) ||
+                    string.Equals(shortTypeName, "global::" + managedTypeName, StringComparison.Ordinal) ||
+                    string.Equals(qualifiedTypeName, managedTypeName, StringComparison.Ordinal) ||
+                    string.Equals(qualifiedTypeName, "global::" + managedTypeName, StringComparison.Ordinal)) {
+                    runtimeTypeName = compressionStreamTypeName;
+                    return true;
+                }
+            }
+
+            runtimeTypeName = string.Empty;
+            return false;
+        }
+
         protected override ExpressionResult ProcessMemberAccessExpressionSyntax(SemanticModel semantic, LayerContext context, MemberAccessExpressionSyntax memberAccess, List<string> lines, List<ExpressionResult> refTypes) {
             if (TryProcessNativeStringLengthMemberAccess(semantic, context, memberAccess, lines, out VariableType stringLengthType)) {
                 return new ExpressionResult(true, VariablePath.Unknown, stringLengthType);
@@ -4727,6 +4935,41 @@ namespace cs2.cpp {
             return true;
         }
 
+        /// <summary>
+        /// Lowers indexer assignments on ConcurrentDictionary to set_Item, because its lock-free get_Item returns a copy of
+        /// the stored value rather than a reference into the table.
+        /// </summary>
+        /// <param name="semantic">Semantic model associated with the assignment.</param>
+        /// <param name="context">Current lowering context.</param>
+        /// <param name="assignment">Assignment whose left side may be a concurrent dictionary indexer.</param>
+        /// <param name="lines">Output token buffer that receives the lowered setter call.</param>
+        /// <returns><c>true</c> when the assignment was lowered to set_Item; otherwise, <c>false</c>.</returns>
+        bool TryProcessConcurrentDictionaryIndexerAssignment(SemanticModel semantic, LayerContext context, AssignmentExpressionSyntax assignment, List<string> lines) {
+            if (!assignment.IsKind(SyntaxKind.SimpleAssignmentExpression) ||
+                assignment.Left is not ElementAccessExpressionSyntax elementAccess ||
+                elementAccess.ArgumentList.Arguments.Count != 1 ||
+                !TryGetExpressionTypeSymbol(semantic, elementAccess.Expression, out ITypeSymbol receiverTypeSymbol) ||
+                !IsConcurrentDictionaryTypeSymbol(receiverTypeSymbol)) {
+                return false;
+            }
+
+            int receiverStartDepth = context.Class.Count;
+            ProcessExpression(semantic, context, elementAccess.Expression, lines);
+            context.PopClass(receiverStartDepth);
+            lines.Add("->set_Item(");
+
+            int keyStartDepth = context.Class.Count;
+            ProcessExpression(semantic, context, elementAccess.ArgumentList.Arguments[0].Expression, lines);
+            context.PopClass(keyStartDepth);
+            lines.Add(", ");
+
+            int rightStartDepth = context.Class.Count;
+            ProcessExpression(semantic, context, assignment.Right, lines);
+            context.PopClass(rightStartDepth);
+            lines.Add(")");
+            return true;
+        }
+
         bool TryProcessRefReturnPropertyAssignment(SemanticModel semantic, LayerContext context, AssignmentExpressionSyntax assignment, List<string> lines) {
             if (!assignment.IsKind(SyntaxKind.SimpleAssignmentExpression) ||
                 !TryGetAssignedPropertySymbol(semantic, assignment.Left, out IPropertySymbol propertySymbol) ||
@@ -5751,6 +5994,10 @@ namespace cs2.cpp {
                 return new ExpressionResult(true, VariablePath.Unknown, encodingInvocationType);
             }
 
+            if (TryProcessBitConverterGetBytesCopyInvocation(semantic, context, invocationExpression, lines)) {
+                return new ExpressionResult(true, VariablePath.Unknown, VariableUtil.GetVarType("void"));
+            }
+
             if (TryProcessBinaryPrimitivesInvocation(semantic, context, invocationExpression, lines, out VariableType binaryPrimitivesInvocationType)) {
                 return new ExpressionResult(true, VariablePath.Unknown, binaryPrimitivesInvocationType);
             }
@@ -5803,6 +6050,10 @@ namespace cs2.cpp {
                 return new ExpressionResult(true, VariablePath.Unknown, VariableUtil.GetVarType("void"));
             }
 
+            if (TryProcessDelegateInvocationListInvocation(semantic, context, invocationExpression, lines, out VariableType invocationListType)) {
+                return new ExpressionResult(true, VariablePath.Unknown, invocationListType);
+            }
+
             if (TryProcessDelegateInvocation(semantic, context, invocationExpression, lines, out VariableType delegateInvocationType)) {
                 return new ExpressionResult(true, VariablePath.Unknown, delegateInvocationType);
             }
@@ -7337,6 +7588,111 @@ namespace cs2.cpp {
             return true;
         }
 
+        /// <summary>
+        /// Rewrites a copy of BitConverter.GetBytes(value) into a byte array, in the forms
+        /// Array.Copy(BitConverter.GetBytes(value), 0, destination, destinationIndex, length),
+        /// Array.Copy(BitConverter.GetBytes(value), destination, length), and
+        /// BitConverter.GetBytes(value).CopyTo(destination, destinationIndex), into one allocation-free
+        /// BitConverter::WriteBytes(destination, destinationIndex, value) call, which throws where the managed copy would.
+        /// Copies whose length is not the full value keep the GetBytes allocation.
+        /// </summary>
+        /// <param name="semantic">Semantic model for the invocation.</param>
+        /// <param name="context">Current conversion context.</param>
+        /// <param name="invocationExpression">Invocation being lowered.</param>
+        /// <param name="lines">Destination token buffer.</param>
+        /// <returns><c>true</c> when the copy was rewritten; otherwise <c>false</c>.</returns>
+        bool TryProcessBitConverterGetBytesCopyInvocation(
+            SemanticModel semantic,
+            LayerContext context,
+            InvocationExpressionSyntax invocationExpression,
+            List<string> lines) {
+            IMethodSymbol methodSymbol = ResolveInvokedMethodSymbol(semantic, invocationExpression);
+            if (methodSymbol == null ||
+                invocationExpression.Expression is not MemberAccessExpressionSyntax memberAccess) {
+                return false;
+            }
+
+            SeparatedSyntaxList<ArgumentSyntax> arguments = invocationExpression.ArgumentList.Arguments;
+            ExpressionSyntax getBytesExpression;
+            ExpressionSyntax destinationExpression;
+            ExpressionSyntax destinationIndexExpression = null;
+            ExpressionSyntax lengthExpression = null;
+            if (methodSymbol.IsStatic &&
+                string.Equals(methodSymbol.Name, "Copy", StringComparison.Ordinal) &&
+                string.Equals(methodSymbol.ContainingType?.ToDisplayString(), "System.Array", StringComparison.Ordinal) &&
+                arguments.Count == 5) {
+                Optional<object> sourceIndex = semantic.GetConstantValue(arguments[1].Expression);
+                if (!sourceIndex.HasValue || !Equals(sourceIndex.Value, 0)) {
+                    return false;
+                }
+
+                getBytesExpression = arguments[0].Expression;
+                destinationExpression = arguments[2].Expression;
+                destinationIndexExpression = arguments[3].Expression;
+                lengthExpression = arguments[4].Expression;
+            } else if (methodSymbol.IsStatic &&
+                string.Equals(methodSymbol.Name, "Copy", StringComparison.Ordinal) &&
+                string.Equals(methodSymbol.ContainingType?.ToDisplayString(), "System.Array", StringComparison.Ordinal) &&
+                arguments.Count == 3) {
+                getBytesExpression = arguments[0].Expression;
+                destinationExpression = arguments[1].Expression;
+                lengthExpression = arguments[2].Expression;
+            } else if (!methodSymbol.IsStatic &&
+                string.Equals(methodSymbol.Name, "CopyTo", StringComparison.Ordinal) &&
+                string.Equals(methodSymbol.ContainingType?.ToDisplayString(), "System.Array", StringComparison.Ordinal) &&
+                arguments.Count == 2) {
+                getBytesExpression = memberAccess.Expression;
+                destinationExpression = arguments[0].Expression;
+                destinationIndexExpression = arguments[1].Expression;
+            } else {
+                return false;
+            }
+
+            if (getBytesExpression is not InvocationExpressionSyntax getBytesInvocation ||
+                getBytesInvocation.ArgumentList.Arguments.Count != 1 ||
+                ResolveInvokedMethodSymbol(semantic, getBytesInvocation) is not IMethodSymbol getBytesSymbol ||
+                !string.Equals(getBytesSymbol.Name, "GetBytes", StringComparison.Ordinal) ||
+                !string.Equals(getBytesSymbol.ContainingType?.ToDisplayString(), "System.BitConverter", StringComparison.Ordinal) ||
+                getBytesSymbol.Parameters.Length != 1 ||
+                !TryGetExpressionTypeSymbol(semantic, destinationExpression, out ITypeSymbol destinationTypeSymbol) ||
+                !IsByteArrayTypeSymbol(destinationTypeSymbol)) {
+                return false;
+            }
+
+            ITypeSymbol valueTypeSymbol = getBytesSymbol.Parameters[0].Type;
+            int valueSize = valueTypeSymbol.SpecialType switch {
+                SpecialType.System_Boolean => 1,
+                SpecialType.System_Char or SpecialType.System_Int16 or SpecialType.System_UInt16 => 2,
+                SpecialType.System_Int32 or SpecialType.System_UInt32 or SpecialType.System_Single => 4,
+                SpecialType.System_Int64 or SpecialType.System_UInt64 or SpecialType.System_Double => 8,
+                _ => 0
+            };
+            if (valueSize == 0) {
+                return false;
+            }
+
+            if (lengthExpression != null) {
+                Optional<object> length = semantic.GetConstantValue(lengthExpression);
+                if (!length.HasValue || !Equals(length.Value, valueSize)) {
+                    return false;
+                }
+            }
+
+            RegisterRuntimeRequirement("BitConverter");
+            lines.Add("BitConverter::WriteBytes<");
+            lines.Add(GetCppTypeToken(VariableUtil.GetVarType(valueTypeSymbol), context.Program));
+            lines.Add(">(");
+            lines.Add(RenderExpressionText(semantic, context, destinationExpression));
+            lines.Add(", ");
+            lines.Add(destinationIndexExpression != null
+                ? RenderExpressionText(semantic, context, destinationIndexExpression)
+                : "0");
+            lines.Add(", ");
+            lines.Add(RenderExpressionText(semantic, context, getBytesInvocation.ArgumentList.Arguments[0].Expression));
+            lines.Add(")");
+            return true;
+        }
+
         /// <summary>
         /// Lowers BinaryPrimitives invocations onto the native runtime helper surface and rewrites managed byte-array buffers to raw pointer access.
         /// </summary>
@@ -7361,6 +7717,12 @@ namespace cs2.cpp {
                 return false;
             }
 
+            // TryRead*/TryWrite* check the span length and assign an out argument, so they keep the span and take the
+            // ordinary static invocation path.
+            if (memberIdentifier.Identifier.Text.StartsWith("Try", StringComparison.Ordinal)) {
+                return false;
+            }
+
             RegisterRuntimeRequirement(runtimeRequirementName);
             lines.Add("BinaryPrimitives::");
             lines.Add(memberIdentifier.Identifier.Text);
@@ -7394,7 +7756,9 @@ namespace cs2.cpp {
             string receiverName = receiverIdentifier.Identifier.Text;
             if (!string.Equals(receiverName, "FileMode", StringComparison.Ordinal) &&
                 !string.Equals(receiverName, "FileAccess", StringComparison.Ordinal) &&
-                !string.Equals(receiverName, "FileShare", StringComparison.Ordinal)) {
+                !string.Equals(receiverName, "FileShare", StringComparison.Ordinal) &&
+                !string.Equals(receiverName, "CompressionMode", StringComparison.Ordinal) &&
+                !string.Equals(receiverName, "CompressionLevel", StringComparison.Ordinal)) {
                 return false;
             }
 
@@ -8247,6 +8611,45 @@ namespace cs2.cpp {
             return true;
         }
 
+        /// <summary>
+        /// Lowers <c>GetInvocationList()</c> on a typed delegate to the multicast runtime, which returns one single-target delegate per handler.
+        /// </summary>
+        /// <param name="semantic">Semantic model used to resolve the invoked method and receiver type.</param>
+        /// <param name="context">Current C++ lowering context.</param>
+        /// <param name="invocationExpression">Invocation that may request a delegate invocation list.</param>
+        /// <param name="lines">Output token buffer receiving the runtime call.</param>
+        /// <param name="resultType">Array type produced by the lowering.</param>
+        /// <returns><c>true</c> when the invocation was lowered; otherwise <c>false</c>.</returns>
+        bool TryProcessDelegateInvocationListInvocation(
+            SemanticModel semantic,
+            LayerContext context,
+            InvocationExpressionSyntax invocationExpression,
+            List<string> lines,
+            out VariableType resultType) {
+            resultType = null;
+            if (invocationExpression.Expression is not MemberAccessExpressionSyntax memberAccess ||
+                invocationExpression.ArgumentList.Arguments.Count != 0 ||
+                !string.Equals(memberAccess.Name.Identifier.ValueText, "GetInvocationList", StringComparison.Ordinal) ||
+                !TryGetExpressionTypeSymbol(semantic, memberAccess.Expression, out ITypeSymbol receiverTypeSymbol) ||
+                receiverTypeSymbol.TypeKind != TypeKind.Delegate ||
+                IsEventExpression(semantic, memberAccess.Expression)) {
+                return false;
+            }
+
+            RegisterRuntimeRequirement("MulticastDelegate");
+            RegisterRuntimeRequirement("NativeArray");
+            lines.Add("MulticastDelegate::GetInvocationList(");
+            int start = context.DepthClass;
+            ProcessExpression(semantic, context, memberAccess.Expression, lines);
+            context.PopClass(start);
+            lines.Add(")");
+
+            VariableType arrayType = new VariableType(VariableDataType.Array, "Array");
+            arrayType.GenericArgs.Add(VariableUtil.GetVarType(receiverTypeSymbol));
+            resultType = arrayType;
+            return true;
+        }
+
         void AddRefOrOutDeclarationBeforeLines(
             SemanticModel semantic,
             LayerContext context,
@@ -8545,7 +8948,11 @@ namespace cs2.cpp {
             resultType = null;
             IMethodSymbol methodSymbol = ResolveInvokedMethodSymbol(semantic, invocationExpression);
             if (!TryResolveNativeFreeFunctionMetadata(methodSymbol, out string functionName, out string includePath)) {
-                return false;
+                if (!TryResolveNativeBatchKernelMetadata(methodSymbol, out functionName)) {
+                    return false;
+                }
+
+                RegisterRuntimeRequirement("NativeBatchKernels");
             }
 
             ConversionClass currentClass = context.GetCurrentClass();
@@ -8597,6 +9004,37 @@ namespace cs2.cpp {
             return false;
         }
 
+        /// <summary>
+        /// Resolves the BatchKernels entry point a [NativeBatchKernel] method forwards to: the attribute's kernel name, or the method name when none is given.
+        /// </summary>
+        static bool TryResolveNativeBatchKernelMetadata(IMethodSymbol methodSymbol, out string functionName) {
+            functionName = string.Empty;
+            if (methodSymbol == null) {
+                return false;
+            }
+
+            foreach (AttributeData attribute in methodSymbol.GetAttributes()) {
+                INamedTypeSymbol attributeType = attribute.AttributeClass;
+                if (attributeType == null) {
+                    continue;
+                }
+
+                string attributeName = attributeType.Name;
+                if (!string.Equals(attributeName, "NativeBatchKernelAttribute", StringComparison.Ordinal) &&
+                    !string.Equals(attributeName, "NativeBatchKernel", StringComparison.Ordinal)) {
+                    continue;
+                }
+
+                string kernelName = attribute.ConstructorArguments.Length >= 1
+                    ? attribute.ConstructorArguments[0].Value?.ToString()
+                    : null;
+                functionName = "BatchKernels::" + (string.IsNullOrWhiteSpace(kernelName) ? methodSymbol.Name : kernelName);
+                return true;
+            }
+
+            return false;
+        }
+
         bool TryProcessDirectoryInvocation(
             SemanticModel semantic,
             LayerContext context,
@@ -9815,6 +10253,15 @@ namespace cs2.cpp {
                 displayText.StartsWith("System.Collections.Generic.IEnumerable<", StringComparison.Ordinal);
         }
 
+        static bool IsConcurrentDictionaryTypeSymbol(ITypeSymbol typeSymbol) {
+            if (typeSymbol is not INamedTypeSymbol namedTypeSymbol) {
+                return false;
+            }
+
+            return string.Equals(namedTypeSymbol.Name, "ConcurrentDictionary", StringComparison.Ordinal) &&
+                namedTypeSymbol.ToDisplayString().StartsWith("System.Collections.Concurrent.ConcurrentDictionary<", StringComparison.Ordinal);
+        }
+
         static bool TryUnwrapNullableTypeSymbol(ITypeSymbol typeSymbol, out ITypeSymbol underlyingTypeSymbol) {
             underlyingTypeSymbol = null;
 
@@ -10709,11 +11156,121 @@ namespace cs2.cpp {
         }
 
         protected override void ProcessAwait(SemanticModel semantic, LayerContext context, AwaitExpressionSyntax awaitExpression, List<string> lines) {
-            lines.Add("await ");
+            lines.Add("co_await ");
 
             ProcessExpression(semantic, context, awaitExpression.Expression, lines);
         }
 
+        /// <summary>
+        /// Classifies how one function-like declaration lowers onto a C++20 coroutine.
+        /// </summary>
+        /// <param name="semantic">Semantic model associated with the declaration.</param>
+        /// <param name="functionSyntax">Method, local function, or lambda to classify.</param>
+        /// <returns>The coroutine shape, or <see cref="CPPCoroutineKind.None"/> when the declaration is not async.</returns>
+        public static CPPCoroutineKind GetCoroutineKind(SemanticModel semantic, SyntaxNode functionSyntax) {
+            if (!IsAsyncFunctionSyntax(functionSyntax)) {
+                return CPPCoroutineKind.None;
+            }
+
+            SemanticModel declarationSemantic = semantic?.SyntaxTree == functionSyntax.SyntaxTree ? semantic : null;
+            IMethodSymbol methodSymbol = functionSyntax is AnonymousFunctionExpressionSyntax anonymousFunction
+                ? declarationSemantic?.GetSymbolInfo(anonymousFunction).Symbol as IMethodSymbol
+                : declarationSemantic?.GetDeclaredSymbol(functionSyntax) as IMethodSymbol;
+            if (methodSymbol != null) {
+                if (methodSymbol.ReturnsVoid) {
+                    return CPPCoroutineKind.AsyncVoid;
+                }
+
+                return methodSymbol.ReturnType is INamedTypeSymbol { Arity: > 0 }
+                    ? CPPCoroutineKind.AsyncTaskWithResult
+                    : CPPCoroutineKind.AsyncTask;
+            }
+
+            TypeSyntax returnTypeSyntax = functionSyntax switch {
+                MethodDeclarationSyntax methodDeclaration => methodDeclaration.ReturnType,
+                LocalFunctionStatementSyntax localFunction => localFunction.ReturnType,
+                _ => null
+            };
+
+            if (returnTypeSyntax is PredefinedTypeSyntax predefinedType && predefinedType.Keyword.IsKind(SyntaxKind.VoidKeyword)) {
+                return CPPCoroutineKind.AsyncVoid;
+            }
+
+            return returnTypeSyntax is GenericNameSyntax
+                ? CPPCoroutineKind.AsyncTaskWithResult
+                : CPPCoroutineKind.AsyncTask;
+        }
+
+        /// <summary>
+        /// Emits the opening of one coroutine body. Async void bodies are wrapped in a task-returning lambda handed to
+        /// <c>AsyncVoidMethod::Start</c>, which copies the captured state into a coroutine frame that outlives the caller.
+        /// </summary>
+        /// <param name="coroutineKind">Coroutine shape of the function being emitted.</param>
+        /// <param name="captureThis">Whether the body may reference the enclosing instance.</param>
+        /// <param name="lines">Output line buffer that receives emitted C++ tokens.</param>
+        public static void AppendCoroutineBodyPrologue(CPPCoroutineKind coroutineKind, bool captureThis, List<string> lines) {
+            if (coroutineKind == CPPCoroutineKind.AsyncVoid) {
+                lines.Add(captureThis
+                    ? "AsyncVoidMethod::Start([=, this]() mutable -> Task* {\n"
+                    : "AsyncVoidMethod::Start([=]() mutable -> Task* {\n");
+            }
+        }
+
+        /// <summary>
+        /// Emits the closing of one coroutine body. Bodies without a result end in <c>co_return</c> so they are coroutines
+        /// even when they never await.
+        /// </summary>
+        /// <param name="coroutineKind">Coroutine shape of the function being emitted.</param>
+        /// <param name="lines">Output line buffer that receives emitted C++ tokens.</param>
+        public static void AppendCoroutineBodyEpilogue(CPPCoroutineKind coroutineKind, List<string> lines) {
+            if (coroutineKind == CPPCoroutineKind.AsyncTask) {
+                lines.Add("co_return;\n");
+            } else if (coroutineKind == CPPCoroutineKind.AsyncVoid) {
+                lines.Add("co_return;\n});\n");
+            }
+        }
+
+        /// <summary>
+        /// Returns whether one node lowers inside a coroutine body, where C# return statements become <c>co_return</c>.
+        /// </summary>
+        /// <param name="node">Statement or expression being lowered.</param>
+        /// <returns><c>true</c> when the nearest enclosing function is async; otherwise <c>false</c>.</returns>
+        static bool IsInsideCoroutineBody(SyntaxNode node) {
+            for (SyntaxNode currentNode = node?.Parent; currentNode != null; currentNode = currentNode.Parent) {
+                if (currentNode is AnonymousFunctionExpressionSyntax ||
+                    currentNode is LocalFunctionStatementSyntax ||
+                    currentNode is BaseMethodDeclarationSyntax ||
+                    currentNode is AccessorDeclarationSyntax ||
+                    currentNode is PropertyDeclarationSyntax) {
+                    return IsAsyncFunctionSyntax(currentNode);
+                }
+            }
+
+            return false;
+        }
+
+        static bool IsAsyncFunctionSyntax(SyntaxNode functionSyntax) {
+            return functionSyntax switch {
+                AnonymousFunctionExpressionSyntax anonymousFunction => anonymousFunction.AsyncKeyword.IsKind(SyntaxKind.AsyncKeyword),
+                LocalFunctionStatementSyntax localFunction => MemberUtil.IsAsync(localFunction.Modifiers),
+                MethodDeclarationSyntax methodDeclaration => MemberUtil.IsAsync(methodDeclaration.Modifiers),
+                _ => false
+            };
+        }
+
+        /// <summary>
+        /// Returns whether a lambda emitted at <paramref name="node"/> may capture <c>this</c>, which requires the nearest
+        /// enclosing member to be an instance member.
+        /// </summary>
+        static bool CanCaptureThis(SemanticModel semantic, SyntaxNode node) {
+            ISymbol enclosingSymbol = semantic?.GetEnclosingSymbol(node?.SpanStart ?? 0);
+            while (enclosingSymbol is IMethodSymbol { MethodKind: MethodKind.AnonymousFunction or MethodKind.LocalFunction }) {
+                enclosingSymbol = enclosingSymbol.ContainingSymbol;
+            }
+
+            return enclosingSymbol != null && !enclosingSymbol.IsStatic && enclosingSymbol is not INamespaceOrTypeSymbol;
+        }
+
         protected override ExpressionResult ProcessQualifiedName(SemanticModel semantic, LayerContext context, QualifiedNameSyntax qualifiedName, List<string> lines) {
             // Process the left part of the qualified name (e.g., "System" in "System.Console")
             if (ProcessExpression(semantic, context, qualifiedName.Left, lines).Processed) {
@@ -12826,12 +13383,63 @@ namespace cs2.cpp {
             IReadOnlyList<ParameterSyntax> parameters,
             CSharpSyntaxNode lambdaBody,
             List<string> lines) {
+            CPPCoroutineKind coroutineKind = GetCoroutineKind(semantic, lambdaExpression);
+            if (coroutineKind != CPPCoroutineKind.None) {
+                AppendCoroutineLambda(semantic, context, lambdaExpression, parameters, lambdaBody, coroutineKind, lines);
+                return;
+            }
+
             lines.Add("[&](");
             AppendLambdaParameters(semantic, context, parameters, lines);
             lines.Add(")");
             AppendNativeLambdaBody(semantic, context, lambdaExpression, lambdaBody, lines);
         }
 
+        /// <summary>
+        /// Lowers an async lambda into a coroutine lambda. The lambda captures by value because its frame can outlive the
+        /// enclosing scope, and it spells out its return type because coroutines cannot deduce one.
+        /// </summary>
+        void AppendCoroutineLambda(
+            SemanticModel semantic,
+            LayerContext context,
+            LambdaExpressionSyntax lambdaExpression,
+            IReadOnlyList<ParameterSyntax> parameters,
+            CSharpSyntaxNode lambdaBody,
+            CPPCoroutineKind coroutineKind,
+            List<string> lines) {
+            RegisterRuntimeRequirement("Task");
+            bool captureThis = CanCaptureThis(semantic, lambdaExpression);
+            lines.Add(captureThis ? "[=, this](" : "[=](");
+            AppendLambdaParameters(semantic, context, parameters, lines);
+            lines.Add(") mutable");
+
+            if (coroutineKind != CPPCoroutineKind.AsyncVoid) {
+                IMethodSymbol lambdaSymbol = semantic?.GetSymbolInfo(lambdaExpression).Symbol as IMethodSymbol;
+                lines.Add(" -> ");
+                lines.Add(lambdaSymbol != null
+                    ? GetCppTypeToken(VariableUtil.GetVarType(lambdaSymbol.ReturnType), context.Program)
+                    : "Task*");
+            }
+
+            lines.Add(" {\n");
+            AppendCoroutineBodyPrologue(coroutineKind, captureThis, lines);
+            if (lambdaBody is BlockSyntax block) {
+                ProcessBlock(semantic, context, block, lines);
+            } else if (lambdaBody is ExpressionSyntax expressionSyntax) {
+                if (coroutineKind == CPPCoroutineKind.AsyncTaskWithResult) {
+                    lines.Add("co_return ");
+                }
+
+                int expressionStart = context.DepthClass;
+                ProcessExpression(semantic, context, expressionSyntax, lines);
+                context.PopClass(expressionStart);
+                lines.Add(";\n");
+            }
+
+            AppendCoroutineBodyEpilogue(coroutineKind, lines);
+            lines.Add("}");
+        }
+
         void AppendLambdaParameters(
             SemanticModel semantic,
             LayerContext context,
@@ -13046,12 +13654,33 @@ namespace cs2.cpp {
             return cppType != null && typeData.IsPointer;
         }
 
+        /// <summary>
+        /// Lowers a C# lock statement onto a MonitorLockScope so the object's monitor is held for the body and released
+        /// on every exit path, including exceptions.
+        /// </summary>
         protected override void ProcessLockStatement(SemanticModel semantic, LayerContext context, LockStatementSyntax lockStatement, List<string> lines) {
-            // You can implement custom locking logic here if needed, otherwise omit the lock
-            lines.Add("// Lock omitted in TypeScript\n");
+            RegisterRuntimeRequirement("Monitor");
+
+            List<string> targetLines = new List<string>();
+            int start = context.DepthClass;
+            ExpressionResult targetResult = ProcessExpression(semantic, context, lockStatement.Expression, targetLines);
+            context.PopClass(start);
+
+            string scopeName = CreateTemporaryName("__lockScope");
+            lines.Add("{\n");
+            if (targetResult.BeforeLines != null && targetResult.BeforeLines.Count > 0) {
+                lines.AddRange(targetResult.BeforeLines);
+            }
+
+            lines.Add($"MonitorLockScope {scopeName}(");
+            lines.AddRange(targetLines);
+            lines.Add(");\n");
+            if (targetResult.AfterLines != null && targetResult.AfterLines.Count > 0) {
+                lines.AddRange(targetResult.AfterLines);
+            }
 
-            // Process the body of the lock statement
             ProcessStatement(semantic, context, lockStatement.Statement, lines);
+            lines.Add("}\n");
         }
 
 
@@ -13709,6 +14338,21 @@ namespace cs2.cpp {
                             return new VariableType(parsedType.Type, "SpinLock");
                         }
 
+                        if (string.Equals(parsedType.TypeName, "Task", StringComparison.Ordinal) ||
+                            string.Equals(parsedType.TypeName, "System.Threading.Tasks.Task", StringComparison.Ordinal) ||
+                            string.Equals(parsedType.TypeName, "ValueTask", StringComparison.Ordinal) ||
+                            string.Equals(parsedType.TypeName, "System.Threading.Tasks.ValueTask", StringComparison.Ordinal)) {
+                            codeConverter?.RegisterRuntimeRequirement("Task");
+                            typeData.IsNativeType = false;
+                            typeData.IsPointer = true;
+
+                            if (parsedType.GenericArgs.Count > 0) {
+                                return CreateConvertedGenericType(parsedType, "Task_1");
+                            }
+
+                            return new VariableType(parsedType.Type, "Task");
+                        }
+
                         if (string.Equals(parsedType.TypeName, "NotImplementedException", StringComparison.Ordinal) ||
                             string.Equals(parsedType.TypeName, "System.NotImplementedException", StringComparison.Ordinal)) {
                             codeConverter?.RegisterRuntimeRequirement("NotImplementedException");
@@ -13763,6 +14407,38 @@ namespace cs2.cpp {
                             return new VariableType(parsedType.Type, NormalizeRegexRuntimeTypeName(parsedType.TypeName));
                         }
 
+                        if (string.Equals(parsedType.TypeName, "ConcurrentDictionary", StringComparison.Ordinal) ||
+                            string.Equals(parsedType.TypeName, "System.Collections.Concurrent.ConcurrentDictionary", StringComparison.Ordinal)) {
+                            codeConverter?.RegisterRuntimeRequirement("ConcurrentDictionary");
+                            typeData.IsNativeType = false;
+                            typeData.IsPointer = true;
+                            return CreateConvertedGenericType(parsedType, "ConcurrentDictionary");
+                        }
+
+                        if (string.Equals(parsedType.TypeName, "ConcurrentQueue", StringComparison.Ordinal) ||
+                            string.Equals(parsedType.TypeName, "System.Collections.Concurrent.ConcurrentQueue", StringComparison.Ordinal)) {
+                            codeConverter?.RegisterRuntimeRequirement("ConcurrentQueue");
+                            typeData.IsNativeType = false;
+                            typeData.IsPointer = true;
+                            return CreateConvertedGenericType(parsedType, "ConcurrentQueue");
+                        }
+
+                        if (string.Equals(parsedType.TypeName, "ConcurrentBag", StringComparison.Ordinal) ||
+                            string.Equals(parsedType.TypeName, "System.Collections.Concurrent.ConcurrentBag", StringComparison.Ordinal)) {
+                            codeConverter?.RegisterRuntimeRequirement("ConcurrentBag");
+                            typeData.IsNativeType = false;
+                            typeData.IsPointer = true;
+                            return CreateConvertedGenericType(parsedType, "ConcurrentBag");
+                        }
+
+                        if (string.Equals(parsedType.TypeName, "ThreadLocal", StringComparison.Ordinal) ||
+                            string.Equals(parsedType.TypeName, "System.Threading.ThreadLocal", StringComparison.Ordinal)) {
+                            codeConverter?.RegisterRuntimeRequirement("ThreadLocal");
+                            typeData.IsNativeType = false;
+                            typeData.IsPointer = true;
+                            return CreateConvertedGenericType(parsedType, "ThreadLocal");
+                        }
+
                         if (string.Equals(parsedType.TypeName, "Stack", StringComparison.Ordinal) ||
                             string.Equals(parsedType.TypeName, "System.Collections.Generic.Stack", StringComparison.Ordinal)) {
                             codeConverter?.RegisterRuntimeRequirement("NativeStack");
@@ -13800,6 +14476,14 @@ namespace cs2.cpp {
                             return new VariableType(parsedType.Type, "BinaryPrimitives");
                         }
 
+                        if (string.Equals(parsedType.TypeName, "BitConverter", StringComparison.Ordinal) ||
+                            string.Equals(parsedType.TypeName, "System.BitConverter", StringComparison.Ordinal)) {
+                            codeConverter?.RegisterRuntimeRequirement("BitConverter");
+                            typeData.IsNativeType = false;
+                            typeData.IsPointer = false;
+                            return new VariableType(parsedType.Type, "BitConverter");
+                        }
+
                         if (string.Equals(parsedType.TypeName, "BitOperations", StringComparison.Ordinal) ||
                             string.Equals(parsedType.TypeName, "System.Numerics.BitOperations", StringComparison.Ordinal)) {
                             codeConverter?.RegisterRuntimeRequirement("BitOperations");
@@ -13808,6 +14492,14 @@ namespace cs2.cpp {
                             return new VariableType(parsedType.Type, "BitOperations");
                         }
 
+                        if (string.Equals(parsedType.TypeName, "MemoryExtensions", StringComparison.Ordinal) ||
+                            string.Equals(parsedType.TypeName, "System.MemoryExtensions", StringComparison.Ordinal)) {
+                            codeConverter?.RegisterRuntimeRequirement("MemoryExtensions");
+                            typeData.IsNativeType = false;
+                            typeData.IsPointer = false;
+                            return new VariableType(parsedType.Type, "MemoryExtensions");
+                        }
+
                         if (string.Equals(parsedType.TypeName, "MathF", StringComparison.Ordinal) ||
                             string.Equals(parsedType.TypeName, "System.MathF", StringComparison.Ordinal)) {
                             codeConverter?.RegisterRuntimeRequirement("Math");
@@ -13924,6 +14616,21 @@ namespace cs2.cpp {
                             return new VariableType(parsedType.Type, "Sse41");
                         }
 
+                        if (string.Equals(parsedType.TypeName, "AdvSimd", StringComparison.Ordinal) ||
+                            string.Equals(parsedType.TypeName, "System.Runtime.Intrinsics.Arm.AdvSimd", StringComparison.Ordinal)) {
+                            codeConverter?.RegisterRuntimeRequirement("AdvSimd");
+                            typeData.IsNativeType = false;
+                            typeData.IsPointer = false;
+                            return new VariableType(parsedType.Type, "AdvSimd");
+                        }
+
+                        if (TryGetNativeNumericsTypeName(parsedType, out string numericsTypeName)) {
+                            codeConverter?.RegisterRuntimeRequirement("NativeNumericsVectors");
+                            typeData.IsNativeType = false;
+                            typeData.IsPointer = false;
+                            return new VariableType(parsedType.Type, numericsTypeName);
+                        }
+
                         if (string.Equals(parsedType.TypeName, "nint", StringComparison.Ordinal) ||
                             string.Equals(parsedType.TypeName, "IntPtr", StringComparison.Ordinal) ||
                             string.Equals(parsedType.TypeName, "System.IntPtr", StringComparison.Ordinal)) {
@@ -14622,6 +15329,14 @@ namespace cs2.cpp {
                 return true;
             }
 
+            if (string.Equals(shortTypeName, "Monitor", StringComparison.Ordinal) ||
+                string.Equals(qualifiedTypeName, "System.Threading.Monitor", StringComparison.Ordinal) ||
+                string.Equals(qualifiedTypeName, "global::System.Threading.Monitor", StringComparison.Ordinal)) {
+                runtimeTypeName = "Monitor";
+                runtimeRequirementName = "Monitor";
+                return true;
+            }
+
             if (string.Equals(shortTypeName, "Volatile", StringComparison.Ordinal) ||
                 string.Equals(qualifiedTypeName, "System.Threading.Volatile", StringComparison.Ordinal) ||
                 string.Equals(qualifiedTypeName, "global::System.Threading.Volatile", StringComparison.Ordinal)) {
@@ -14630,6 +15345,33 @@ namespace cs2.cpp {
                 return true;
             }
 
+            if (string.Equals(shortTypeName, "ThreadPool", StringComparison.Ordinal) ||
+                string.Equals(qualifiedTypeName, "System.Threading.ThreadPool", StringComparison.Ordinal) ||
+                string.Equals(qualifiedTypeName, "global::System.Threading.ThreadPool", StringComparison.Ordinal)) {
+                runtimeTypeName = "ThreadPool";
+                runtimeRequirementName = "ThreadPool";
+                return true;
+            }
+
+            if (string.Equals(shortTypeName, "Task", StringComparison.Ordinal) ||
+                string.Equals(shortTypeName, "ValueTask", StringComparison.Ordinal) ||
+                string.Equals(qualifiedTypeName, "System.Threading.Tasks.Task", StringComparison.Ordinal) ||
+                string.Equals(qualifiedTypeName, "global::System.Threading.Tasks.Task", StringComparison.Ordinal) ||
+                string.Equals(qualifiedTypeName, "System.Threading.Tasks.ValueTask", StringComparison.Ordinal) ||
+                string.Equals(qualifiedTypeName, "global::System.Threading.Tasks.ValueTask", StringComparison.Ordinal)) {
+                runtimeTypeName = "Task";
+                runtimeRequirementName = "Task";
+                return true;
+            }
+
+            if (string.Equals(shortTypeName, "Parallel", StringComparison.Ordinal) ||
+                string.Equals(qualifiedTypeName, "System.Threading.Tasks.Parallel", StringComparison.Ordinal) ||
+                string.Equals(qualifiedTypeName, "global::System.Threading.Tasks.Parallel", StringComparison.Ordinal)) {
+                runtimeTypeName = "Parallel";
+                runtimeRequirementName = "Parallel";
+                return true;
+            }
+
             if (string.Equals(qualifiedTypeName, "System.Buffer", StringComparison.Ordinal) ||
                 string.Equals(qualifiedTypeName, "global::System.Buffer", StringComparison.Ordinal)) {
                 runtimeTypeName = "Buffer";
@@ -14661,6 +15403,14 @@ namespace cs2.cpp {
                 return true;
             }
 
+            if (string.Equals(shortTypeName, "MemoryExtensions", StringComparison.Ordinal) ||
+                string.Equals(qualifiedTypeName, "System.MemoryExtensions", StringComparison.Ordinal) ||
+                string.Equals(qualifiedTypeName, "global::System.MemoryExtensions", StringComparison.Ordinal)) {
+                runtimeTypeName = "MemoryExtensions";
+                runtimeRequirementName = "MemoryExtensions";
+                return true;
+            }
+
             if (string.Equals(shortTypeName, "MidpointRounding", StringComparison.Ordinal) ||
                 string.Equals(qualifiedTypeName, "System.MidpointRounding", StringComparison.Ordinal) ||
                 string.Equals(qualifiedTypeName, "global::System.MidpointRounding", StringComparison.Ordinal)) {
@@ -14866,22 +15616,21 @@ namespace cs2.cpp {
             ITypeSymbol delegateTypeSymbol,
             IMethodSymbol methodGroupSymbol,
             ExpressionSyntax methodGroupExpression,
-            List<string> lines) {
+            List<string> lines,
+            bool allocate = true) {
             if (!TryGetDelegateWrapperTypeName(delegateTypeSymbol, context, out string delegateWrapperTypeName)) {
                 return false;
             }
 
             List<string> delegateConstructionLines = new List<string> {
-                $"new {delegateWrapperTypeName}("
+                allocate ? $"new {delegateWrapperTypeName}(" : $"{delegateWrapperTypeName}("
             };
             if (methodGroupSymbol.IsStatic) {
                 delegateConstructionLines.Add(RenderQualifiedMethodPointerTarget(methodGroupSymbol, context));
             } else if (TryResolveBoundDelegateReceiverText(semantic, context, methodGroupExpression, methodGroupSymbol, out string receiverText)) {
-                delegateConstructionLines.Add("std::bind_front(");
-                delegateConstructionLines.Add(RenderQualifiedMethodPointerTarget(methodGroupSymbol, context));
-                delegateConstructionLines.Add(", ");
                 delegateConstructionLines.Add(receiverText);
-                delegateConstructionLines.Add(")");
+                delegateConstructionLines.Add(", ");
+                delegateConstructionLines.Add(RenderQualifiedMethodPointerTarget(methodGroupSymbol, context));
             } else {
                 return false;
             }
@@ -15377,6 +16126,38 @@ namespace cs2.cpp {
                 arrayTypeSymbol.ElementType.SpecialType == SpecialType.System_Byte;
         }
 
+        /// <summary>
+        /// Resolves the System.Numerics math value types the native runtime supplies in system/numerics/vectors.hpp. Only the
+        /// fully qualified framework names match, so engine-defined Vector3 or Matrix4x4 types stay generated project classes.
+        /// </summary>
+        /// <param name="parsedType">Parsed managed type to classify.</param>
+        /// <param name="nativeTypeName">Receives the unqualified native runtime type name.</param>
+        /// <returns><c>true</c> when the type is one of the supported System.Numerics value types.</returns>
+        static bool TryGetNativeNumericsTypeName(VariableType parsedType, out string nativeTypeName) {
+            const string NumericsNamespacePrefix = "System.Numerics.";
+            string qualifiedTypeName = parsedType.TypeName != null && parsedType.TypeName.StartsWith(NumericsNamespacePrefix, StringComparison.Ordinal)
+                ? parsedType.TypeName
+                : parsedType.QualifiedTypeName;
+            nativeTypeName = string.Empty;
+            if (string.IsNullOrEmpty(qualifiedTypeName) ||
+                !qualifiedTypeName.StartsWith(NumericsNamespacePrefix, StringComparison.Ordinal)) {
+                return false;
+            }
+
+            string typeName = qualifiedTypeName.Substring(NumericsNamespacePrefix.Length);
+            if (string.Equals(typeName, "Vector2", StringComparison.Ordinal) ||
+                string.Equals(typeName, "Vector3", StringComparison.Ordinal) ||
+                string.Equals(typeName, "Vector4", StringComparison.Ordinal) ||
+                string.Equals(typeName, "Quaternion", StringComparison.Ordinal) ||
+                string.Equals(typeName, "Plane", StringComparison.Ordinal) ||
+                string.Equals(typeName, "Matrix4x4", StringComparison.Ordinal)) {
+                nativeTypeName = typeName;
+                return true;
+            }
+
+            return false;
+        }
+
         /// <summary>
         /// Determines whether a fully qualified managed type name identifies one exception supplied by the native runtime.
         /// </summary>
@@ -15394,7 +16175,9 @@ namespace cs2.cpp {
                 string.Equals(typeName, "System.IO.EndOfStreamException", StringComparison.Ordinal) ||
                 string.Equals(typeName, "System.IO.FileNotFoundException", StringComparison.Ordinal) ||
                 string.Equals(typeName, "System.IO.DirectoryNotFoundException", StringComparison.Ordinal) ||
-                string.Equals(typeName, "System.NotSupportedException", StringComparison.Ordinal);
+                string.Equals(typeName, "System.NotSupportedException", StringComparison.Ordinal) ||
+                string.Equals(typeName, "System.Threading.SynchronizationLockException", StringComparison.Ordinal) ||
+                string.Equals(typeName, "System.Threading.SemaphoreFullException", StringComparison.Ordinal);
         }
 
         /// <summary>
@@ -15430,6 +16213,10 @@ namespace cs2.cpp {
                 nativeTypeName = "DirectoryNotFoundException";
             } else if (IsFrameworkTypeSymbol(compilation, typeSymbol, "System.NotSupportedException")) {
                 nativeTypeName = "NotSupportedException";
+            } else if (IsFrameworkTypeSymbol(compilation, typeSymbol, "System.Threading.SynchronizationLockException")) {
+                nativeTypeName = "SynchronizationLockException";
+            } else if (IsFrameworkTypeSymbol(compilation, typeSymbol, "System.Threading.SemaphoreFullException")) {
+                nativeTypeName = "SemaphoreFullException";
             }
 
             return nativeTypeName.Length > 0;
@@ -16930,7 +17717,7 @@ namespace cs2.cpp {
         }
 
         /// <summary>
-        /// Lowers StringReader.ReadLine declarations to a lightweight nullable line wrapper that preserves null end-of-stream semantics.
+        /// Lowers StringReader.ReadLine and StreamReader.ReadLine declarations to a lightweight nullable line wrapper that preserves null end-of-stream semantics.
         /// </summary>
         /// <param name="semantic">Semantic model associated with the declaration.</param>
         /// <param name="context">Current lowering context.</param>
@@ -16964,11 +17751,12 @@ namespace cs2.cpp {
 
             ITypeSymbol receiverTypeSymbol = semantic.GetTypeInfo(memberAccess.Expression).Type;
             if (receiverTypeSymbol == null ||
-                !string.Equals(receiverTypeSymbol.Name, "StringReader", StringComparison.Ordinal)) {
+                (!string.Equals(receiverTypeSymbol.Name, "StringReader", StringComparison.Ordinal) &&
+                 !string.Equals(receiverTypeSymbol.Name, "StreamReader", StringComparison.Ordinal))) {
                 return false;
             }
 
-            RegisterRuntimeRequirement("StringReader");
+            RegisterRuntimeRequirement(receiverTypeSymbol.Name);
 
             FunctionStack fn = context.GetCurrentFunction();
             if (fn != null) {
@@ -17452,8 +18240,9 @@ namespace cs2.cpp {
         }
 
         protected override void ProcessReturnStatement(SemanticModel semantic, LayerContext context, ReturnStatementSyntax ret, List<string> lines) {
+            string returnKeyword = IsInsideCoroutineBody(ret) ? "co_return" : "return";
             if (ret.Expression == null) {
-                lines.Add("return;");
+                lines.Add(returnKeyword + ";");
                 return;
             }
 
@@ -17481,7 +18270,7 @@ namespace cs2.cpp {
             }
 
             if (result.AfterLines == null || result.AfterLines.Count == 0) {
-                lines.Add("return ");
+                lines.Add(returnKeyword + " ");
                 lines.AddRange(returnLines);
                 lines.Add(";");
             } else {
@@ -17489,7 +18278,7 @@ namespace cs2.cpp {
                 lines.AddRange(returnLines);
                 lines.Add(";\n");
                 lines.AddRange(result.AfterLines);
-                lines.Add("return ___result;");
+                lines.Add(returnKeyword + " ___result;");
             }
 
             context.PopClass(start);
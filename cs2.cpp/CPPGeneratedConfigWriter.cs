@@ -48,6 +48,7 @@ namespace cs2.cpp {
                 $"#define HE_CPP_USE_RTTI {ToDefineValue(options.RuntimeProfile.UseRtti)}",
                 $"#define HE_CPP_PLATFORM_IS_LITTLE_ENDIAN {ToDefineValue(options.PlatformProfile.IsLittleEndian)}",
                 $"#define HE_CPP_PLATFORM_IS_WINDOWS_HOST {ToDefineValue(options.PlatformProfile.IsWindowsHost)}",
+                $"#define HE_CPP_MATH_COLUMN_VECTOR {ToDefineValue(options.PlatformProfile.GeneratedMathConvention == CPPGeneratedMathConventionKind.NativeColumnVector)}",
                 $"#define HE_CPP_RUNTIME_HAS_CUSTOM_FILE_SYSTEM {ToDefineValue(HasCustomFileSystem(options))}"
             };
 
@@ -56,6 +57,14 @@ namespace cs2.cpp {
                 lines.Add($"#define HE_CPP_RUNTIME_CUSTOM_FILE_SYSTEM_TYPE {GetRequiredPlatformOption(options, "native-file-system-type")}");
             }
 
+            if (TryGetPlatformOption(options, CPPCodegenOptionNames.ThreadPoolWorkerCount, out string rawWorkerCount)) {
+                lines.Add($"#define HE_CPP_THREAD_POOL_WORKER_COUNT {ParseThreadPoolWorkerCount(rawWorkerCount)}");
+            }
+
+            if (options.PlatformProfile.VectorWidthInBits > 0) {
+                lines.Add($"#define HE_CPP_VECTOR_WIDTH_BITS {options.PlatformProfile.VectorWidthInBits}");
+            }
+
             AppendAdditionalPreprocessorDefines(lines, options);
             AppendFeatureDefines(lines, buildUsageReport ?? new CPPBuildUsageReport());
 
@@ -87,6 +96,19 @@ namespace cs2.cpp {
             return bool.TryParse(rawValue, out bool parsedValue) && parsedValue;
         }
 
+        /// <summary>
+        /// Validates the fixed thread-pool worker count selected for the conversion run.
+        /// </summary>
+        /// <param name="rawValue">Raw option value supplied by the caller or preset.</param>
+        /// <returns>The non-negative worker count to emit.</returns>
+        static int ParseThreadPoolWorkerCount(string rawValue) {
+            if (!int.TryParse(rawValue, System.Globalization.NumberStyles.None, System.Globalization.CultureInfo.InvariantCulture, out int workerCount)) {
+                throw new InvalidOperationException($"Platform option '{CPPCodegenOptionNames.ThreadPoolWorkerCount}' must be a non-negative integer, but was '{rawValue}'.");
+            }
+
+            return workerCount;
+        }
+
         static bool HasCustomFileSystem(CPPConversionOptions options) {
             return TryGetPlatformOption(options, "native-file-system-header", out _) &&
                 TryGetPlatformOption(options, "native-file-system-type", out _);
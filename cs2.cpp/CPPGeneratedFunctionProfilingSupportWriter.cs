@@ -68,6 +68,7 @@ namespace cs2.cpp {
 #define HE_CPP_GENERATED_PROFILE_BEFORE_LOCK(lock, queued) const bool queued = lock.BeforeLock()
 #define HE_CPP_GENERATED_PROFILE_AFTER_LOCK(lock, queued) if (queued) { lock.AfterLock(); }
 #define HE_CPP_GENERATED_PROFILE_AFTER_UNLOCK(lock) lock.AfterUnlock()
+#define HE_CPP_GENERATED_PROFILE_SPIN_LOCK_CONTENTION(before, after) do { const auto profileContentionAfter = (after); TracyPlot("SpinLock contended enters", static_cast<int64_t>(profileContentionAfter.ContendedEnters)); TracyPlot("SpinLock spin rounds", static_cast<int64_t>(profileContentionAfter.SpinRounds - (before).SpinRounds)); TracyPlot("SpinLock yields", static_cast<int64_t>(profileContentionAfter.Yields - (before).Yields)); TracyPlot("SpinLock parks", static_cast<int64_t>(profileContentionAfter.Parks - (before).Parks)); } while (false)
 #endif
 """;
         }
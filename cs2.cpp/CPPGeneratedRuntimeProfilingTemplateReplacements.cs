@@ -23,7 +23,7 @@ namespace cs2.cpp {
                 ? "HE_CPP_GENERATED_PROFILE_FREE(value, \"NativeMemory::AlignedFree\");"
                 : string.Empty;
             replacements["GENERATED_FUNCTION_PROFILING_SPIN_LOCK_INCLUDE"] = enabled
-                ? "#include <mutex>\n#include \"../../runtime/generated_profiler.hpp\""
+                ? "#include <mutex>\n#include \"../../runtime/generated_profiler.hpp\"\n#define HE_CPP_SPIN_LOCK_STATISTICS 1"
                 : string.Empty;
             replacements["GENERATED_FUNCTION_PROFILING_SPIN_LOCK_FIELD"] = enabled
                 ? "HE_CPP_GENERATED_PROFILE_LOCKABLE(std::mutex, ProfileLock, \"SpinLock\");"
@@ -31,6 +31,12 @@ namespace cs2.cpp {
             replacements["GENERATED_FUNCTION_PROFILING_SPIN_LOCK_BEFORE_ENTER"] = enabled
                 ? "HE_CPP_GENERATED_PROFILE_BEFORE_LOCK(ProfileLock, profileLockQueued);"
                 : string.Empty;
+            replacements["GENERATED_FUNCTION_PROFILING_SPIN_LOCK_BEFORE_CONTENDED_ENTER"] = enabled
+                ? "const SpinLockStatistics profileContentionBefore = GetStatistics();"
+                : string.Empty;
+            replacements["GENERATED_FUNCTION_PROFILING_SPIN_LOCK_AFTER_CONTENDED_ENTER"] = enabled
+                ? "HE_CPP_GENERATED_PROFILE_SPIN_LOCK_CONTENTION(profileContentionBefore, GetStatistics());"
+                : string.Empty;
             replacements["GENERATED_FUNCTION_PROFILING_SPIN_LOCK_AFTER_ENTER"] = enabled
                 ? "HE_CPP_GENERATED_PROFILE_AFTER_LOCK(ProfileLock, profileLockQueued);"
                 : string.Empty;
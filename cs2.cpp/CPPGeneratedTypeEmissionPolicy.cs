@@ -10,6 +10,7 @@ namespace cs2.cpp {
         /// </summary>
         static readonly HashSet<string> ExcludedTypeNames = new HashSet<string>(StringComparer.Ordinal) {
             "cs2.attributes.CodeGenRenameAttribute",
+            "NativeBatchKernelAttribute",
             "NativeBorrowedReturnAttribute",
             "NativeFreeFunctionAttribute",
             "NativeNoEscapeAttribute",
@@ -17,6 +18,7 @@ namespace cs2.cpp {
             "NativeOwnedReturnAttribute",
             "NativeRetainsBorrowAttribute",
             "NativeTakesOwnershipAttribute",
+            "cs2.attributes.NativeBatchKernelAttribute",
             "cs2.attributes.NativeBorrowedReturnAttribute",
             "cs2.attributes.NativeOwnedMemberAttribute",
             "cs2.attributes.NativeOwnedReturnAttribute",
@@ -36,12 +36,15 @@ namespace cs2.cpp {
                 Make("NativeSpan", "runtime/native_span.hpp", "HE_CPP_REQ_NATIVE_SPAN", "Managed-style non-owning span view support for transient buffer access."),
                 Make("NativeFunctionPointer", "runtime/function_pointer.hpp", "HE_CPP_REQ_NATIVE_FUNCTION_POINTER", "Portable unmanaged function-pointer wrapper support for transpiled C# delegate* signatures."),
                 Make("Delegate", "system/delegate.hpp", "HE_CPP_REQ_DELEGATE", "Portable callable delegate wrapper support for emitted custom delegate declarations."),
-                Make("NativeVector", "system/numerics/vector.hpp", "HE_CPP_REQ_NATIVE_VECTOR", "Managed System.Numerics.Vector helper and value-bundle support for generic numeric lane operations."),
-                Make("NativeVector128", "system/runtime/intrinsics/vector128.hpp", "HE_CPP_REQ_NATIVE_VECTOR128", "Managed System.Runtime.Intrinsics.Vector128 helper and value-bundle support for portable intrinsic fallbacks."),
-                Make("NativeVector256", "system/runtime/intrinsics/vector256.hpp", "HE_CPP_REQ_NATIVE_VECTOR256", "Managed System.Runtime.Intrinsics.Vector256 helper and value-bundle support for portable intrinsic fallbacks."),
-                Make("NativeVector512", "system/runtime/intrinsics/vector512.hpp", "HE_CPP_REQ_NATIVE_VECTOR512", "Managed System.Runtime.Intrinsics.Vector512 helper and value-bundle support for portable intrinsic fallbacks."),
+                Make("NativeVector", "system/numerics/vector.hpp", "HE_CPP_REQ_NATIVE_VECTOR", "Managed System.Numerics.Vector helper and value-bundle support sized by the platform vector width and lowered to SSE/AVX or NEON registers."),
+                Make("NativeNumericsVectors", "system/numerics/vectors.hpp", "HE_CPP_REQ_NATIVE_NUMERICS_VECTORS", "Managed System.Numerics Vector2/3/4, Quaternion, Plane, and Matrix4x4 value types backed by aligned SSE/NEON registers and laid out for the platform math convention."),
+                Make("NativeBatchKernels", "system/numerics/batch_kernels.hpp", "HE_CPP_REQ_NATIVE_BATCH_KERNELS", "Structure-of-arrays transform composition, batched point transforms, and frustum culling kernels bound to [NativeBatchKernel] methods and run in Vector256 lanes."),
+                Make("NativeVector128", "system/runtime/intrinsics/vector128.hpp", "HE_CPP_REQ_NATIVE_VECTOR128", "Managed System.Runtime.Intrinsics.Vector128 helper and value-bundle support lowered to SSE/AVX registers with portable lane fallbacks."),
+                Make("NativeVector256", "system/runtime/intrinsics/vector256.hpp", "HE_CPP_REQ_NATIVE_VECTOR256", "Managed System.Runtime.Intrinsics.Vector256 helper and value-bundle support lowered to SSE/AVX registers with portable lane fallbacks."),
+                Make("NativeVector512", "system/runtime/intrinsics/vector512.hpp", "HE_CPP_REQ_NATIVE_VECTOR512", "Managed System.Runtime.Intrinsics.Vector512 helper and value-bundle support lowered to AVX-512 registers, dispatched at run time on x86-64 builds without AVX-512."),
                 Make("MemoryMarshal", "system/runtime/interopservices/memory_marshal.hpp", "HE_CPP_REQ_MEMORY_MARSHAL", "Managed System.Runtime.InteropServices.MemoryMarshal span reinterpretation helpers."),
                 Make("BitOperations", "system/bit_operations.hpp", "HE_CPP_REQ_BIT_OPERATIONS", "Managed System.Numerics.BitOperations helper support for integer bit manipulation."),
+                Make("MemoryExtensions", "system/memory_extensions.hpp", "HE_CPP_REQ_MEMORY_EXTENSIONS", "Managed System.MemoryExtensions span searches, comparisons, and reversal, vectorized over SSE2/AVX2/NEON lanes for primitive elements."),
                 Make("NativeNullable", "runtime/native_nullable.hpp", "HE_CPP_REQ_NATIVE_NULLABLE", "Managed-style nullable value wrapper support."),
                 Make("NativeNullComparison", "runtime/native_null.hpp", "HE_CPP_REQ_NATIVE_NULL_COMPARISON", "Portable null-comparison helpers for dependent managed generic values that may lower to either reference-like or value-like native forms."),
                 Make("NativeHashCode", "runtime/native_hash.hpp", "HE_CPP_REQ_NATIVE_HASH_CODE", "Portable hash-code helpers for dependent managed generic values that may lower to primitive, pointer, or struct native forms."),
@@ -49,6 +52,9 @@ namespace cs2.cpp {
                 Make("NativeList", "runtime/native_list.hpp", "HE_CPP_REQ_NATIVE_LIST", "Managed-style list abstraction support."),
                 Make("NativeStack", "runtime/native_stack.hpp", "HE_CPP_REQ_NATIVE_STACK", "Managed-style stack abstraction support for lightweight LIFO state."),
                 Make("NativeDictionary", "runtime/native_dictionary.hpp", "HE_CPP_REQ_NATIVE_DICTIONARY", "Managed-style dictionary abstraction support."),
+                Make("ConcurrentDictionary", "system/collections/concurrent/concurrent_dictionary.hpp", "HE_CPP_REQ_CONCURRENT_DICTIONARY", "Managed ConcurrentDictionary support with striped writer locks and lock-free, epoch-reclaimed reads."),
+                Make("ConcurrentQueue", "system/collections/concurrent/concurrent_queue.hpp", "HE_CPP_REQ_CONCURRENT_QUEUE", "Managed ConcurrentQueue support backed by linked bounded MPMC ring segments."),
+                Make("ConcurrentBag", "system/collections/concurrent/concurrent_bag.hpp", "HE_CPP_REQ_CONCURRENT_BAG", "Managed ConcurrentBag support with per-thread lists and cross-thread stealing."),
                 Make("NativeTuple", "runtime/native_tuple.hpp", "HE_CPP_REQ_NATIVE_TUPLE", "Lightweight managed tuple support for transpiled value-tuple data flow."),
                 Make("NativeEnum", "runtime/native_enum.hpp", "HE_CPP_REQ_NATIVE_ENUM", "Managed enum placeholder contract support for transpiled enum metadata edges."),
                 Make("NotImplementedException", "system/not_implemented_exception.hpp", "HE_CPP_REQ_NOT_IMPLEMENTED_EXCEPTION", "Managed System.NotImplementedException placeholder support for transpiled exception paths."),
@@ -80,23 +86,35 @@ namespace cs2.cpp {
                 Make("StringReader", "system/io/string-reader.hpp", "HE_CPP_REQ_STRING_READER", "String reader support for line-based text iteration without heap-heavy stream wrappers."),
                 Make("MemoryStream", "system/io/memory-stream.hpp", "HE_CPP_REQ_MEMORY_STREAM", "Memory stream abstraction support for transient in-memory IO."),
                 Make("FileStream", "system/io/file-stream.hpp", "HE_CPP_REQ_FILE_STREAM", "File stream abstraction support for host-backed runtime IO."),
+                Make("Compression", "system/io/compression/deflate-stream.hpp", "HE_CPP_REQ_COMPRESSION", "Block-parallel Deflate, GZip, and ZLib stream support for System.IO.Compression."),
                 Make("File", "system/io/file.hpp", "HE_CPP_REQ_FILE", "File abstraction support for host-backed IO."),
                 Make("Directory", "system/io/directory.hpp", "HE_CPP_REQ_DIRECTORY", "Directory abstraction support for host-backed existence checks."),
                 Make("Path", "system/io/path.hpp", "HE_CPP_REQ_PATH", "Path abstraction support for host-backed path normalization and resolution."),
                 Make("AppContext", "system/app_context.hpp", "HE_CPP_REQ_APP_CONTEXT", "Managed AppContext support for executable-base-directory initialization."),
                 Make("Debug", "system/diagnostics/debug.hpp", "HE_CPP_REQ_DEBUG", "Managed debug output surface support for System.Diagnostics.Debug."),
                 Make("NativeMemory", "system/runtime/interopservices/native_memory.hpp", "HE_CPP_REQ_NATIVE_MEMORY", "Managed NativeMemory helper surface for aligned unmanaged allocation and release."),
-                Make("Sse", "system/runtime/intrinsics/x86/sse.hpp", "HE_CPP_REQ_SSE", "Managed System.Runtime.Intrinsics.X86.Sse helper surface for portable intrinsic fallbacks."),
-                Make("Avx", "system/runtime/intrinsics/x86/avx.hpp", "HE_CPP_REQ_AVX", "Managed System.Runtime.Intrinsics.X86.Avx helper surface for portable intrinsic fallbacks."),
-                Make("Avx2", "system/runtime/intrinsics/x86/avx2.hpp", "HE_CPP_REQ_AVX2", "Managed System.Runtime.Intrinsics.X86.Avx2 helper surface for portable intrinsic fallbacks."),
-                Make("Sse41", "system/runtime/intrinsics/x86/sse41.hpp", "HE_CPP_REQ_SSE41", "Managed System.Runtime.Intrinsics.X86.Sse41 helper surface for portable intrinsic fallbacks."),
+                Make("Sse", "system/runtime/intrinsics/x86/sse.hpp", "HE_CPP_REQ_SSE", "Managed System.Runtime.Intrinsics.X86.Sse helper surface mapped to native instructions with portable lane fallbacks."),
+                Make("Avx", "system/runtime/intrinsics/x86/avx.hpp", "HE_CPP_REQ_AVX", "Managed System.Runtime.Intrinsics.X86.Avx helper surface mapped to native instructions with portable lane fallbacks."),
+                Make("Avx2", "system/runtime/intrinsics/x86/avx2.hpp", "HE_CPP_REQ_AVX2", "Managed System.Runtime.Intrinsics.X86.Avx2 helper surface mapped to native instructions with portable lane fallbacks."),
+                Make("Sse41", "system/runtime/intrinsics/x86/sse41.hpp", "HE_CPP_REQ_SSE41", "Managed System.Runtime.Intrinsics.X86.Sse41 helper surface mapped to native instructions with portable lane fallbacks."),
+                Make("AdvSimd", "system/runtime/intrinsics/arm/adv_simd.hpp", "HE_CPP_REQ_ADV_SIMD", "Managed System.Runtime.Intrinsics.Arm.AdvSimd helper surface mapped to AArch64 NEON instructions with portable lane fallbacks."),
+                Make("SimdDispatch", "system/runtime/intrinsics/simd_dispatch.hpp", "HE_CPP_REQ_SIMD_DISPATCH", "Run-time selection between the baseline, AVX2, and AVX-512 clones emitted for methods that branch on x86 SIMD support."),
                 Make("Stopwatch", "system/diagnostics/stopwatch.hpp", "HE_CPP_REQ_STOPWATCH", "Managed Stopwatch timing support for lightweight runtime profiling."),
                 Make("Encoding", "system/text/encoding.hpp", "HE_CPP_REQ_ENCODING", "Managed Encoding surface support for UTF-8 oriented text readers and writers."),
                 Make("Interlocked", "system/threading/interlocked.hpp", "HE_CPP_REQ_INTERLOCKED", "Managed Interlocked helper surface for portable atomic integer updates."),
                 Make("Volatile", "system/threading/volatile.hpp", "HE_CPP_REQ_VOLATILE", "Managed Volatile helper surface for portable acquire/release scalar reads and writes."),
-                Make("AutoResetEvent", "system/threading/auto_reset_event.hpp", "HE_CPP_REQ_AUTO_RESET_EVENT", "Managed AutoResetEvent helper surface for portable worker-thread signalling."),
+                Make("AutoResetEvent", "system/threading/auto_reset_event.hpp", "HE_CPP_REQ_AUTO_RESET_EVENT", "Managed AutoResetEvent helper surface for portable worker-thread signalling, parked on a futex word."),
+                Make("ManualResetEventSlim", "system/threading/manual_reset_event_slim.hpp", "HE_CPP_REQ_MANUAL_RESET_EVENT_SLIM", "Managed ManualResetEventSlim support that spins briefly and then parks on a futex word."),
+                Make("ManualResetEvent", "system/threading/manual_reset_event.hpp", "HE_CPP_REQ_MANUAL_RESET_EVENT", "Managed ManualResetEvent WaitHandle surface over the futex-based manual-reset event."),
+                Make("SemaphoreSlim", "system/threading/semaphore_slim.hpp", "HE_CPP_REQ_SEMAPHORE_SLIM", "Managed SemaphoreSlim support with a futex-word count, spin-then-park waits, and WaitAsync tasks."),
+                Make("ReaderWriterLockSlim", "system/threading/reader_writer_lock_slim.hpp", "HE_CPP_REQ_READER_WRITER_LOCK_SLIM", "Managed ReaderWriterLockSlim support with writer preference and upgradeable reads on one futex word."),
+                Make("Monitor", "system/threading/monitor.hpp", "HE_CPP_REQ_MONITOR", "Managed Monitor support backing lowered lock statements with re-entrant futex locks and Wait/Pulse queues."),
+                Make("ThreadLocal", "system/threading/thread_local.hpp", "HE_CPP_REQ_THREAD_LOCAL", "Managed ThreadLocal<T> support with lazy per-thread factory values, lock-free reads, and Values enumeration."),
                 Make("Thread", "system/threading/thread.hpp", "HE_CPP_REQ_THREAD", "Managed Thread helper surface for portable background worker execution."),
-                Make("SpinLock", "system/threading/spin_lock.hpp", "HE_CPP_REQ_SPIN_LOCK", "Managed SpinLock helper surface for lightweight scoped locking on portable native backends."),
+                Make("ThreadPool", "system/threading/thread_pool.hpp", "HE_CPP_REQ_THREAD_POOL", "Managed ThreadPool surface backed by a work-stealing scheduler with per-worker deques."),
+                Make("Task", "system/threading/tasks/task.hpp", "HE_CPP_REQ_TASK", "Managed Task and Task<TResult> support with continuations, WhenAll, WhenAny, and coroutine-lowered async methods on the work-stealing pool."),
+                Make("Parallel", "system/threading/tasks/parallel.hpp", "HE_CPP_REQ_PARALLEL", "Managed Parallel.For and Parallel.ForEach support with chunked range partitioning on the work-stealing pool."),
+                Make("SpinLock", "system/threading/spin_lock.hpp", "HE_CPP_REQ_SPIN_LOCK", "Managed SpinLock support with test-and-test-and-set backoff, yielding, OS parking, and optional per-lock contention counters."),
                 Make("SpinWait", "system/threading/spin_wait.hpp", "HE_CPP_REQ_SPIN_WAIT", "Managed SpinWait helper surface for lightweight busy-wait loops."),
                 Make("SHA256", "system/security/cryptography/sha256.hpp", "HE_CPP_REQ_SHA256", "Managed SHA256 helper surface for deterministic content hashing."),
                 Make("Number", "system/number.hpp", "HE_CPP_REQ_NUMBER", "Managed numeric helper surface for primitive TryParse and infinity checks."),
@@ -0,0 +1,26 @@
+namespace cs2.cpp {
+    /// <summary>
+    /// Describes how one async method, local function, or lambda lowers onto a C++20 coroutine.
+    /// </summary>
+    public enum CPPCoroutineKind {
+        /// <summary>
+        /// The function is not async and lowers to an ordinary function body.
+        /// </summary>
+        None,
+
+        /// <summary>
+        /// An <c>async void</c> function whose body runs as a fire-and-forget coroutine through <c>AsyncVoidMethod</c>.
+        /// </summary>
+        AsyncVoid,
+
+        /// <summary>
+        /// An async function returning the non-generic <c>Task</c> or <c>ValueTask</c>.
+        /// </summary>
+        AsyncTask,
+
+        /// <summary>
+        /// An async function returning <c>Task&lt;TResult&gt;</c> or <c>ValueTask&lt;TResult&gt;</c>.
+        /// </summary>
+        AsyncTaskWithResult
+    }
+}
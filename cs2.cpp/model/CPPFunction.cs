@@ -26,13 +26,21 @@ namespace cs2.cpp {
             context.AddClass(cl);
             context.AddFunction(new FunctionStack(fn));
             SemanticModel semantic = fn.Semantic ?? cl.Semantic;
+            SyntaxNode declaration = (SyntaxNode)fn.RawBlock?.Parent ?? fn.ArrowExpression?.Parent;
+            CPPCoroutineKind coroutineKind = CPPConversiorProcessor.GetCoroutineKind(semantic, declaration);
+            if (coroutineKind != CPPCoroutineKind.None && conversion is CPPConversiorProcessor cppConversion) {
+                cppConversion.RegisterRuntimeRequirement("Task");
+            }
 
+            CPPConversiorProcessor.AppendCoroutineBodyPrologue(coroutineKind, !fn.IsStatic, lines);
             if (fn.ArrowExpression != null) {
-                WriteExpressionBodiedFunctionLines(fn, conversion, cl, context, lines);
+                WriteExpressionBodiedFunctionLines(fn, conversion, cl, context, coroutineKind, lines);
             } else if (fn.RawBlock != null) {
                 conversion.ProcessBlock(semantic, context, fn.RawBlock, lines);
             }
 
+            CPPConversiorProcessor.AppendCoroutineBodyEpilogue(coroutineKind, lines);
+
             context.PopClass(start);
             context.PopFunction(startFn);
 
@@ -113,12 +121,14 @@ namespace cs2.cpp {
         /// <param name="conversion">Processor used to lower the Roslyn expression.</param>
         /// <param name="cl">Owning class for semantic binding.</param>
         /// <param name="context">Current lowering context.</param>
+        /// <param name="coroutineKind">Coroutine shape of the function, which selects <c>co_return</c> and drops task results.</param>
         /// <param name="lines">Destination collection that receives the lowered body tokens.</param>
         static void WriteExpressionBodiedFunctionLines(
             ConversionFunction fn,
             ConversionProcessor conversion,
             ConversionClass cl,
             LayerContext context,
+            CPPCoroutineKind coroutineKind,
             List<string> lines) {
             if (fn == null) {
                 throw new ArgumentNullException(nameof(fn));
@@ -152,7 +162,7 @@ namespace cs2.cpp {
                 lines.AddRange(expressionResult.BeforeLines);
             }
 
-            if (ReturnsVoid(fn)) {
+            if (ReturnsVoid(fn) || coroutineKind == CPPCoroutineKind.AsyncTask) {
                 if (expressionLines.Count > 0) {
                     lines.AddRange(expressionLines);
                     lines.Add(";");
@@ -165,8 +175,9 @@ namespace cs2.cpp {
                 return;
             }
 
+            string returnKeyword = coroutineKind == CPPCoroutineKind.None ? "return" : "co_return";
             if (expressionResult.AfterLines == null || expressionResult.AfterLines.Count == 0) {
-                lines.Add("return ");
+                lines.Add(returnKeyword + " ");
                 lines.AddRange(expressionLines);
                 lines.Add(";");
                 return;
@@ -176,7 +187,7 @@ namespace cs2.cpp {
             lines.AddRange(expressionLines);
             lines.Add(";\n");
             lines.AddRange(expressionResult.AfterLines);
-            lines.Add("return ___result;");
+            lines.Add(returnKeyword + " ___result;");
         }
 
         /// <summary>
@@ -38,6 +38,21 @@ namespace cs2.cpp {
         /// </summary>
         public int PointerSizeInBytes { get; set; }
 
+        /// <summary>
+        /// Gets or sets the System.Numerics.Vector&lt;T&gt; width in bits, 128 or 256; zero lets the native build follow
+        /// the widest vector instructions its compiler targets.
+        /// </summary>
+        public int VectorWidthInBits { get; set; }
+
+        /// <summary>
+        /// Returns whether <paramref name="vectorWidthInBits"/> is a Vector&lt;T&gt; width the native runtime supports.
+        /// </summary>
+        /// <param name="vectorWidthInBits">Candidate width in bits; zero selects the compile target's width.</param>
+        /// <returns>True for 0, 128, and 256.</returns>
+        public static bool IsSupportedVectorWidth(int vectorWidthInBits) {
+            return vectorWidthInBits == 0 || vectorWidthInBits == 128 || vectorWidthInBits == 256;
+        }
+
         /// <summary>
         /// Creates the default Windows headless development profile.
         /// </summary>
@@ -61,16 +76,20 @@ namespace cs2.cpp {
         /// <param name="isLittleEndian">Whether the target uses little-endian memory layout.</param>
         /// <param name="generatedMathConvention">Generated runtime math convention required by the target.</param>
         /// <param name="pointerSizeInBytes">Native pointer size used by the target runtime.</param>
+        /// <param name="vectorWidthInBits">Vector&lt;T&gt; width in bits, or zero to follow the native compile target.</param>
         /// <returns>The resolved custom platform profile.</returns>
         public static CPPPlatformProfile CreateCustomHeadless(
             string platformId,
             bool isLittleEndian,
             CPPGeneratedMathConventionKind generatedMathConvention,
-            int pointerSizeInBytes) {
+            int pointerSizeInBytes,
+            int vectorWidthInBits = 0) {
             if (string.IsNullOrWhiteSpace(platformId)) {
                 throw new ArgumentException("Platform id must not be empty.", nameof(platformId));
             } else if (pointerSizeInBytes <= 0) {
                 throw new ArgumentOutOfRangeException(nameof(pointerSizeInBytes), "Pointer size must be positive.");
+            } else if (!IsSupportedVectorWidth(vectorWidthInBits)) {
+                throw new ArgumentOutOfRangeException(nameof(vectorWidthInBits), "Vector width must be 0, 128, or 256 bits.");
             }
 
             return new CPPPlatformProfile {
@@ -80,7 +99,8 @@ namespace cs2.cpp {
                 IsLittleEndian = isLittleEndian,
                 IsWindowsHost = false,
                 GeneratedMathConvention = generatedMathConvention,
-                PointerSizeInBytes = pointerSizeInBytes
+                PointerSizeInBytes = pointerSizeInBytes,
+                VectorWidthInBits = vectorWidthInBits
             };
         }
 
@@ -96,7 +116,8 @@ namespace cs2.cpp {
                 IsLittleEndian = true,
                 IsWindowsHost = false,
                 GeneratedMathConvention = CPPGeneratedMathConventionKind.EngineRowVector,
-                PointerSizeInBytes = 4
+                PointerSizeInBytes = 4,
+                VectorWidthInBits = 128
             };
         }
 
@@ -112,7 +133,8 @@ namespace cs2.cpp {
                 IsLittleEndian = true,
                 IsWindowsHost = false,
                 GeneratedMathConvention = CPPGeneratedMathConventionKind.EngineRowVector,
-                PointerSizeInBytes = 4
+                PointerSizeInBytes = 4,
+                VectorWidthInBits = 128
             };
         }
 
@@ -128,7 +150,8 @@ namespace cs2.cpp {
                 IsLittleEndian = false,
                 IsWindowsHost = false,
                 GeneratedMathConvention = CPPGeneratedMathConventionKind.EngineRowVector,
-                PointerSizeInBytes = 4
+                PointerSizeInBytes = 4,
+                VectorWidthInBits = 128
             };
         }
     }